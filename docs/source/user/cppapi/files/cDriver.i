@@ -7,6 +7,8 @@
 nTurbinesGlob: 3
 #Enable debug outputs if set to true
 debug: False
+#Advance all turbines on a processor concurrently using OpenMP threads
+parallelTurbineStep: False
 #The simulation will not run if dryRun is set to true
 dryRun:  False
 #Flag indicating whether the simulation starts from scratch or restart
@@ -21,6 +23,32 @@ tMax:    4.0
 dtFAST:  0.00625
 #Restart files will be written every so many time steps
 nEveryCheckPoint: 160
+#Write restart files in the background (optional)
+asyncCheckpoint: False
+#Number of most recent restart files kept with asyncCheckpoint. Keep all if <= 0 (optional)
+nCheckpointsKept: 0
+#Number of time steps of actuator node inflow data buffered in memory before writing to the hdf5 file (optional)
+nStepsVelDataBuffer: 16
+#Number of time steps of actuator node inflow data read at a time with restartDriverInitFAST. Read all at once if <= 0 (optional)
+nStepsVelDataRead: 0
+#Write the average step time of each turbine to turbineCostFile after so many time steps (optional)
+nStepsTurbineCost: 20
+#Turbine costs used to balance the allocation of turbines to processors on restart (optional)
+turbineCostFile: "turbineCost.txt"
+#Write the time spent in each phase of a time step to phaseTimerFile.json and .csv at the end (optional)
+phaseTimers: False
+#Also write the time spent in each phase in every time step to phaseTimerFile.trace.<rank>.csv (optional)
+phaseTimerTrace: False
+#Root name of the phase timer files (optional)
+phaseTimerFile: "openfastcpp_timers"
+#Overlap each FAST step with the emulated CFD work and report the hidden step time (optional)
+nonBlockingStep: False
+#Wall clock time in seconds of the emulated CFD work per time step (optional)
+cfdWorkTime: 0.0
+#Couple all turbines to a wind farm supercontroller (optional)
+superController: False
+#Shared library implementing the supercontroller. Required if superController is true
+scLibFile: "libsupercontroller.so"
 
 Turbine0:
   #The position of the turbine base for actuator-line simulations
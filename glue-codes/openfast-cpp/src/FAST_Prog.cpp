@@ -1,6 +1,7 @@
 #include "OpenFAST.H"
 #include "yaml-cpp/yaml.h"
 #include <iostream>
+#include <chrono>
 #include <mpi.h>
 
 inline bool checkFileExists(const std::string& name) {
@@ -26,7 +27,13 @@ void readTurbineData(int iTurb, fast::fastInputs & fi, YAML::Node turbNode) {
     if (turbNode["air_density"]) fi.globTurbineData[iTurb].air_density = turbNode["air_density"].as<float>();
 }
 
-void readInputFile(fast::fastInputs & fi, std::string cInterfaceInputFile, double * tEnd) {
+void emulateCfdWork(double workTime) {
+    // Stand-in for the work of a CFD solver that does not need the new actuator forces, e.g. its pressure solve
+    std::chrono::steady_clock::time_point tStart = std::chrono::steady_clock::now();
+    while ( std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count() < workTime ) { }
+}
+
+void readInputFile(fast::fastInputs & fi, std::string cInterfaceInputFile, double * tEnd, std::string * turbineCostFile, int * nStepsTurbineCost, bool * nonBlockingStep, double * cfdWorkTime) {
 
     fi.comm = MPI_COMM_WORLD;
 
@@ -47,6 +54,30 @@ void readInputFile(fast::fastInputs & fi, std::string cInterfaceInputFile, doubl
                 fi.debug = cDriverInp["debug"].as<bool>();
             } 
 
+            if(cDriverInp["parallelTurbineStep"]) {
+                fi.parallelTurbineStep = cDriverInp["parallelTurbineStep"].as<bool>();
+            }
+
+            if(cDriverInp["nStepsVelDataBuffer"]) {
+                fi.nStepsVelDataBuffer = cDriverInp["nStepsVelDataBuffer"].as<int>();
+            }
+
+            if(cDriverInp["phaseTimers"]) {
+                fi.phaseTimers = cDriverInp["phaseTimers"].as<bool>();
+            }
+
+            if(cDriverInp["phaseTimerTrace"]) {
+                fi.phaseTimerTrace = cDriverInp["phaseTimerTrace"].as<bool>();
+            }
+
+            if(cDriverInp["phaseTimerFile"]) {
+                fi.phaseTimerFile = cDriverInp["phaseTimerFile"].as<std::string>();
+            }
+
+            if(cDriverInp["nStepsVelDataRead"]) {
+                fi.nStepsVelDataRead = cDriverInp["nStepsVelDataRead"].as<int>();
+            }
+
             if(cDriverInp["simStart"]) {
                 if (cDriverInp["simStart"].as<std::string>() == "init") {
                     fi.simStart = fast::init;
@@ -62,9 +93,31 @@ void readInputFile(fast::fastInputs & fi, std::string cInterfaceInputFile, doubl
             fi.tStart = cDriverInp["tStart"].as<double>();
             *tEnd = cDriverInp["tEnd"].as<double>();
             fi.nEveryCheckPoint = cDriverInp["nEveryCheckPoint"].as<int>();
+            if(cDriverInp["asyncCheckpoint"]) {
+                fi.asyncCheckpoint = cDriverInp["asyncCheckpoint"].as<bool>();
+            }
+            if(cDriverInp["nCheckpointsKept"]) {
+                fi.nCheckpointsKept = cDriverInp["nCheckpointsKept"].as<int>();
+            }
             fi.dtFAST = cDriverInp["dtFAST"].as<double>();
             fi.tMax = cDriverInp["tMax"].as<double>(); // tMax is the total duration to which you want to run FAST. This should be the same or greater than the max time given in the FAST fst file. Choose this carefully as FAST writes the output file only at this point if you choose the binary file output.
 
+            if(cDriverInp["turbineCostFile"]) {
+                *turbineCostFile = cDriverInp["turbineCostFile"].as<std::string>();
+            }
+
+            if(cDriverInp["nStepsTurbineCost"]) {
+                *nStepsTurbineCost = cDriverInp["nStepsTurbineCost"].as<int>();
+            }
+
+            if(cDriverInp["nonBlockingStep"]) {
+                *nonBlockingStep = cDriverInp["nonBlockingStep"].as<bool>();
+            }
+
+            if(cDriverInp["cfdWorkTime"]) {
+                *cfdWorkTime = cDriverInp["cfdWorkTime"].as<double>();
+            }
+
             if(cDriverInp["superController"]) {
                 fi.scStatus = cDriverInp["superController"].as<bool>();
                 fi.scLibFile = cDriverInp["scLibFile"].as<std::string>();
@@ -100,18 +153,23 @@ int main(int argc, char** argv) {
     std::vector<double> torque (3, 0.0);
     std::vector<double> thrust (3, 0.0);  
 
-    iErr = MPI_Init(NULL, NULL);
+    int mpiThreadLevel;
+    iErr = MPI_Init_thread(NULL, NULL, MPI_THREAD_MULTIPLE, &mpiThreadLevel); // stepAsync() with the supercontroller calls MPI from a background thread
     iErr = MPI_Comm_size( MPI_COMM_WORLD, &nProcs);
     iErr = MPI_Comm_rank( MPI_COMM_WORLD, &rank);
 
     double tEnd ; // This doesn't belong in the FAST - C++ interface 
     int ntEnd ; // This doesn't belong in the FAST - C++ interface
+    std::string turbineCostFile = ""; // File with the cost of each turbine to allocate turbines to procs
+    int nStepsTurbineCost = -1; // Write the cost of each turbine after this many time steps
+    bool nonBlockingStep = false; // Overlap each FAST step with emulated CFD work
+    double cfdWorkTime = 0.0; // Wall clock time (s) of the emulated CFD work per time step
 
     std::string cDriverInputFile=argv[1];
     fast::OpenFAST FAST;
     fast::fastInputs fi ;
     try {
-        readInputFile(fi, cDriverInputFile, &tEnd);
+        readInputFile(fi, cDriverInputFile, &tEnd, &turbineCostFile, &nStepsTurbineCost, &nonBlockingStep, &cfdWorkTime);
     } catch( const std::runtime_error & ex) {
         std::cerr << ex.what() << std::endl ;
         std::cerr << "Program quitting now" << std::endl ;
@@ -122,7 +180,14 @@ int main(int argc, char** argv) {
     ntEnd = tEnd/fi.dtFAST;
 
     FAST.setInputs(fi);
-    FAST.allocateTurbinesToProcsSimple(); 
+    if ( !turbineCostFile.empty() && checkFileExists(turbineCostFile) ) {
+        // Use the turbine costs measured in a previous run to balance the load across procs
+        std::vector<double> turbineCost;
+        FAST.readTurbineCostFile(turbineCostFile, turbineCost);
+        FAST.allocateTurbinesToProcsBalanced(turbineCost);
+    } else {
+        FAST.allocateTurbinesToProcsSimple();
+    }
     // Or allocate turbines to procs by calling "setTurbineProcNo(iTurbGlob, procId)" for turbine.
 
     FAST.init();
@@ -135,8 +200,24 @@ int main(int argc, char** argv) {
         return 0;
     }
 
+    double tLoopStart = MPI_Wtime();
+    double tStepTotal = 0.0; // Wall clock time of all FAST steps
+    double tWaitTotal = 0.0; // Wall clock time spent waiting for the FAST steps
     for (int nt = FAST.get_ntStart(); nt < ntEnd; nt++) {
-        FAST.step();
+        if (nonBlockingStep) {
+            // Start the FAST step, do the CFD work that does not depend on it and only then wait for the new actuator forces
+            FAST.stepAsync();
+            emulateCfdWork(cfdWorkTime);
+            tWaitTotal += FAST.wait();
+            tStepTotal += FAST.get_asyncStepTime();
+        } else {
+            emulateCfdWork(cfdWorkTime);
+            FAST.step();
+        }
+        if ( (nt + 1 - FAST.get_ntStart()) == nStepsTurbineCost ) {
+            FAST.reportTurbineLoadBalance();
+            if ( !turbineCostFile.empty() ) FAST.writeTurbineCostFile(turbineCostFile);
+        }
         if (FAST.isDebug()) {
             FAST.computeTorqueThrust(0,torque,thrust);
             std::cout.precision(16);
@@ -145,6 +226,22 @@ int main(int argc, char** argv) {
         }
     }
 
+    if (rank == 0) {
+        std::cout << "Wall clock time of time loop = " << MPI_Wtime() - tLoopStart << " s" << std::endl ;
+    }
+
+    if (nonBlockingStep) {
+        // The part of the FAST step latency that was hidden behind the CFD work, summed over all procs
+        double tHidden[2] = {tStepTotal, tStepTotal - tWaitTotal};
+        double tHiddenGlob[2];
+        MPI_Reduce(tHidden, tHiddenGlob, 2, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+        if (rank == 0) {
+            std::cout << "FAST step time hidden behind CFD work = " << tHiddenGlob[1] << " s of " << tHiddenGlob[0] << " s";
+            if (tHiddenGlob[0] > 0.0) std::cout << " (" << 100.0 * tHiddenGlob[1] / tHiddenGlob[0] << " %)";
+            std::cout << std::endl ;
+        }
+    }
+
     FAST.end() ;
     MPI_Finalize() ;
 
@@ -4,6 +4,10 @@
 #include <cmath>
 #include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <numeric>
+#include <sstream>
+#include <cstdio>
 
 int fast::OpenFAST::AbortErrLev = ErrID_Fatal; // abort error level; compare with NWTC Library
 
@@ -12,8 +16,16 @@ fast::fastInputs::fastInputs():
 nTurbinesGlob(0),
 dryRun(false),
 debug(false),
+parallelTurbineStep(false),
+nStepsVelDataBuffer(1),
+nStepsVelDataRead(0),
 tStart(-1.0),
 nEveryCheckPoint(-1),
+asyncCheckpoint(false),
+nCheckpointsKept(0),
+phaseTimers(false),
+phaseTimerTrace(false),
+phaseTimerFile("openfastcpp_timers"),
 tMax(0.0),
 dtFAST(0.0),
 scStatus(false),
@@ -33,8 +45,30 @@ nTurbinesGlob(0),
 nTurbinesProc(0),
 scStatus(false),
 simStart(fast::init),
-timeZero(false)
+timeZero(false),
+parallelTurbineStep(false),
+nStepsTimed(0),
+nStepsVelDataBuffer(1),
+nStepsVelDataRead(0),
+velNodeDataStart(0),
+velNodeDataCount(0),
+velDataFlushAsync(false),
+asyncCheckpoint(false),
+nCheckpointsKept(0),
+checkpointStallTime(0.0),
+checkpointStallTimeTotal(0.0),
+checkpointStallTimeMax(0.0),
+nCheckpoints(0),
+asyncStepTime(0.0)
 {
+    timerStep = timers.addTimer("step");
+    timerWriteVelocityData = timers.addTimer("writeVelocityData", true);
+    timerTurbineStep = timers.addTimer("FAST_OpFM_Step", true);
+    timerNacelleForce = timers.addTimer("calc_nacelle_force", true);
+    timerDebugOutput = timers.addTimer("debugOutput");
+    timerCheckpoint = timers.addTimer("checkpoint");
+    timerInterpolateVel = timers.addTimer("interpolateVel_ForceToVelNodes");
+    timerMPI = timers.addTimer("MPI");
 }
 
 fast::OpenFAST::~OpenFAST(){ }
@@ -55,6 +89,8 @@ void fast::OpenFAST::init() {
 
         case fast::trueRestart:
 
+            sc.init(scio, nTurbinesProc);
+
             for (int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
                 /* note that this will set nt_global inside the FAST library */
                 std::copy(
@@ -79,17 +115,14 @@ void fast::OpenFAST::init() {
                 );
                 checkError(ErrStat, ErrMsg);
                 nt_global = ntStart;
-
-                int nfpts = get_numForcePtsLoc(iTurb);
-                forceNodeVel[iTurb].resize(nfpts);
-                for (int k = 0; k < nfpts; k++) forceNodeVel[iTurb][k].resize(3) ;
             }
 
+            allocateNodeData();
             if (nTurbinesProc > 0) velNodeDataFile = openVelocityDataFile(false);
 
             if(scStatus) {
-                std::cout << "Use of Supercontroller is not supported through the C++ API right now" << std::endl;
-                //sc.readRestartFile(nt_global);
+                sc.init_sc(scio, nTurbinesProc, turbineMapProcToGlob, fastMPIComm);
+                sc.readRestartFile(nt_global);
             }
 
             break ;
@@ -98,9 +131,8 @@ void fast::OpenFAST::init() {
 
             sc.init(scio, nTurbinesProc);
             if(scStatus) {
-                std::cout << "Use of Supercontroller is not supported through the C++ API right now" << std::endl;
-                // sc.init_sc(scio, nTurbinesProc, turbineMapProcToGlob, fastMPIComm);
-                // sc.calcOutputs_n(0.0);
+                sc.init_sc(scio, nTurbinesProc, turbineMapProcToGlob, fastMPIComm);
+                sc.calcOutputs_n(0.0);
             }
 
             // this calls the Init() routines of each module
@@ -145,10 +177,6 @@ void fast::OpenFAST::init() {
                     std::cout << "Aerodyn doesn't want to calculate forces on the tower. All actuator points on the tower are turned off for turbine " << turbineMapProcToGlob[iTurb] << "." << std::endl ;
                 }
 
-                int nfpts = get_numForcePtsLoc(iTurb);
-                forceNodeVel[iTurb].resize(nfpts);
-                for (int k = 0; k < nfpts; k++) forceNodeVel[iTurb][k].resize(3) ;
-
                 if ( isDebug() ) {
                     for (int iNode=0; iNode < get_numVelPtsLoc(iTurb); iNode++) {
                         std::cout << "Node " << iNode << " Position = " << cDriver_Input_from_FAST[iTurb].pxVel[iNode] << " " << cDriver_Input_from_FAST[iTurb].pyVel[iNode] << " " << cDriver_Input_from_FAST[iTurb].pzVel[iNode] << " " << std::endl ;
@@ -156,6 +184,7 @@ void fast::OpenFAST::init() {
                 }
             }
 
+            allocateNodeData();
             if (nTurbinesProc > 0) velNodeDataFile = openVelocityDataFile(true);
 
             break ;
@@ -164,9 +193,8 @@ void fast::OpenFAST::init() {
 
             sc.init(scio, nTurbinesProc);
             if(scStatus) {
-                std::cout << "Use of Supercontroller is not supported through the C++ API right now" << std::endl;
-                // sc.init_sc(scio, nTurbinesProc, turbineMapProcToGlob, fastMPIComm);
-                // sc.calcOutputs_n(0.0);
+                sc.init_sc(scio, nTurbinesProc, turbineMapProcToGlob, fastMPIComm);
+                sc.calcOutputs_n(0.0);
             }
             
             for (int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
@@ -209,10 +237,6 @@ void fast::OpenFAST::init() {
                     std::cout << "Aerodyn doesn't want to calculate forces on the tower. All actuator points on the tower are turned off for turbine " << turbineMapProcToGlob[iTurb] << "." << std::endl ;
                 }
 
-                int nfpts = get_numForcePtsLoc(iTurb);
-                forceNodeVel[iTurb].resize(nfpts);
-                for (int k = 0; k < nfpts; k++) forceNodeVel[iTurb][k].resize(3) ;
-
                 if ( isDebug() ) {
                     for (int iNode=0; iNode < get_numVelPtsLoc(iTurb); iNode++) {
                         std::cout << "Node " << iNode << " Position = " << cDriver_Input_from_FAST[iTurb].pxVel[iNode] << " " << cDriver_Input_from_FAST[iTurb].pyVel[iNode] << " " << cDriver_Input_from_FAST[iTurb].pzVel[iNode] << " " << std::endl ;
@@ -220,24 +244,27 @@ void fast::OpenFAST::init() {
                 }
             }
 
-            int nTimesteps;
-
+            allocateNodeData();
             if (nTurbinesProc > 0) {
-                readVelocityData(ntStart);
+                beginVelocityDataStream(ntStart);
             }
             for (int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
-                applyVelocityData(0, iTurb, cDriver_Output_to_FAST[iTurb], velNodeData[iTurb]);
+                applyVelocityData(0, iTurb, cDriver_Output_to_FAST[iTurb], velNodeData);
             }
             solution0() ;
 
             for (int iPrestart=0 ; iPrestart < ntStart; iPrestart++) {
+                if (nTurbinesProc > 0) advanceVelocityDataStream(iPrestart);
                 for (int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
-                    applyVelocityData(iPrestart, iTurb, cDriver_Output_to_FAST[iTurb], velNodeData[iTurb]);
+                    applyVelocityData(iPrestart - velNodeDataStart, iTurb, cDriver_Output_to_FAST[iTurb], velNodeData);
                 }
                 stepNoWrite();
             }
 
-            if (nTurbinesProc > 0) velNodeDataFile = openVelocityDataFile(false);
+            if (nTurbinesProc > 0) {
+                endVelocityDataStream();
+                velNodeDataFile = openVelocityDataFile(false);
+            }
 
             break;
 
@@ -258,8 +285,7 @@ void fast::OpenFAST::solution0() {
         // }
 
         if(scStatus) {
-            std::cout << "Use of Supercontroller is not supported through the C++ API right now" << std::endl;
-            // sc.fastSCInputOutput();
+            sc.fastSCInputOutput();
         }
 
         for (int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
@@ -270,15 +296,17 @@ void fast::OpenFAST::solution0() {
         timeZero = false;
 
         if (scStatus) {
-            std::cout << "Use of Supercontroller is not supported through the C++ API right now" << std::endl;            
-            //  sc.calcOutputs_n(0.0);
-            //  sc.fastSCInputOutput();
+            sc.calcOutputs_n(0.0);
+            sc.fastSCInputOutput();
         }
     }
 }
 
 void fast::OpenFAST::step() {
 
+    timers.beginStep(nt_global);
+    FAST_SCOPED_TIMER(timers, timerStep);
+
     /* ******************************
     set inputs from this code and call FAST:
     ********************************* */
@@ -288,12 +316,13 @@ void fast::OpenFAST::step() {
         //  set wind speeds at original locations
         //     setOutputsToFAST(cDriver_Input_from_FAST[iTurb], cDriver_Output_to_FAST[iTurb]);
 
-        // this advances the states, calls CalcOutput, and solves for next inputs. Predictor-corrector loop is imbeded here:
-        // (note OpenFOAM could do subcycling around this step)
-
-        writeVelocityData(velNodeDataFile, iTurb, nt_global, cDriver_Input_from_FAST[iTurb], cDriver_Output_to_FAST[iTurb]);
+        {
+            FAST_SCOPED_TURBINE_TIMER(timers, timerWriteVelocityData, turbineMapProcToGlob[iTurb]);
+            writeVelocityData(iTurb, nt_global, cDriver_Input_from_FAST[iTurb], cDriver_Output_to_FAST[iTurb]);
+        }
 
         if ( isDebug() ) {
+            FAST_SCOPED_TIMER(timers, timerDebugOutput);
 
             std::ofstream fastcpp_velocity_file;
             fastcpp_velocity_file.open("fastcpp_velocity.csv") ;
@@ -304,12 +333,18 @@ void fast::OpenFAST::step() {
             fastcpp_velocity_file.close() ;
         }
 
-        FAST_OpFM_Step(&iTurb, &ErrStat, ErrMsg);
-        checkError(ErrStat, ErrMsg);
+    }
+
+    // this advances the states, calls CalcOutput, and solves for next inputs. Predictor-corrector loop is imbeded here:
+    // (note OpenFOAM could do subcycling around this step)
+    stepTurbines();
+
+    for (int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
 
         // Compute the force from the nacelle only if the drag coefficient is
         //   greater than zero
         if (nacelle_cd[iTurb]>0.) {
+            FAST_SCOPED_TURBINE_TIMER(timers, timerNacelleForce, turbineMapProcToGlob[iTurb]);
             calc_nacelle_force (
                 cDriver_Output_to_FAST[iTurb].u[0],
                 cDriver_Output_to_FAST[iTurb].v[0],
@@ -324,6 +359,7 @@ void fast::OpenFAST::step() {
         }
 
         if ( isDebug() ) {
+            FAST_SCOPED_TIMER(timers, timerDebugOutput);
             std::ofstream actuatorForcesFile;
             actuatorForcesFile.open("actuator_forces.csv") ;
             actuatorForcesFile << "# x, y, z, fx, fy, fz" << std::endl ;
@@ -335,71 +371,261 @@ void fast::OpenFAST::step() {
     }
 
     if(scStatus) {
-        std::cout << "Use of Supercontroller is not supported through the C++ API right now" << std::endl;
-        // sc.updateStates(nt_global * dtFAST); // Predict state at 'n+1' based on inputs
-        // sc.calcOutputs_np1( (nt_global + 1) * dtFAST);
-        // sc.fastSCInputOutput();
+        {
+            // Wait for the inputs to the supercontroller sent at the end of the previous time step
+            FAST_SCOPED_TIMER(timers, timerMPI);
+            sc.completeInputExchange();
+        }
+        sc.updateStates(nt_global * dtFAST); // Predict state at 'n+1' based on inputs
+        sc.calcOutputs_np1( (nt_global + 1) * dtFAST);
+        FAST_SCOPED_TIMER(timers, timerMPI);
+        sc.fastSCInputOutput();
     }
 
     nt_global = nt_global + 1;
     
     if(scStatus) {
-        std::cout << "Use of Supercontroller is not supported through the C++ API right now" << std::endl;
-        // sc.advanceTime(); // Advance states, inputs and outputs from 'n' to 'n+1'
+        sc.advanceTime(); // Advance states, inputs and outputs from 'n' to 'n+1'
     }
 
     if ( (((nt_global - ntStart) % nEveryCheckPoint) == 0 )  && (nt_global != ntStart) ) {
+        FAST_SCOPED_TIMER(timers, timerCheckpoint);
+        std::chrono::steady_clock::time_point tCheckpointStart = std::chrono::steady_clock::now();
+
+        if (asyncCheckpoint) {
+            createCheckpointAsync();
+        } else {
+            // Use default FAST naming convention for checkpoint file
+            // <RootName>.<nt_global>
+            char dummyCheckPointRoot[INTERFACE_STRING_LENGTH] = " ";
+            // Ensure that we have a null character
+            dummyCheckPointRoot[1] = 0;
+
+            if (nTurbinesProc > 0) backupVelocityDataFile(nt_global, velNodeDataFile);
+
+            for (int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
+                FAST_CreateCheckpoint(&iTurb, dummyCheckPointRoot, &ErrStat, ErrMsg);
+                checkError(ErrStat, ErrMsg);
+            }
+        }
+        if(scStatus) {
+            // The velocity data may still be written and backed up in the background. HDF-5 is not
+            // thread safe, so let that finish before the supercontroller writes its restart file.
+            waitVelocityDataFlush();
+            sc.writeRestartFile(nt_global);
+        }
+
+        checkpointStallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - tCheckpointStart).count();
+        checkpointStallTimeTotal += checkpointStallTime;
+        checkpointStallTimeMax = std::max(checkpointStallTimeMax, checkpointStallTime);
+        nCheckpoints++;
+    }
+}
+
+void fast::OpenFAST::createCheckpointAsync() {
+
+    // Pack the checkpoint data of all turbines into memory and write the checkpoint files in the
+    // background. Only one checkpoint is written at a time, so wait for the previous one first.
+    waitCheckpointWrite();
+
+    if (nTurbinesProc > 0) backupVelocityDataFileAsync(nt_global);
+
+    checkpointData.resize(nTurbinesProc);
+    checkpointDataRoot.resize(nTurbinesProc);
+    for (int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
         // Use default FAST naming convention for checkpoint file
         // <RootName>.<nt_global>
-        char dummyCheckPointRoot[INTERFACE_STRING_LENGTH] = " ";
+        char checkPointRoot[INTERFACE_STRING_LENGTH] = " ";
         // Ensure that we have a null character
-        dummyCheckPointRoot[1] = 0;
+        checkPointRoot[1] = 0;
 
-        if (nTurbinesProc > 0) backupVelocityDataFile(nt_global, velNodeDataFile);
+        int64_t nBytes = 0;
+        FAST_PackCheckpoint(&iTurb, checkPointRoot, &nBytes, &ErrStat, ErrMsg);
+        checkError(ErrStat, ErrMsg);
 
-        for (int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
-            FAST_CreateCheckpoint(&iTurb, dummyCheckPointRoot, &ErrStat, ErrMsg);
-            checkError(ErrStat, ErrMsg);
+        checkpointData[iTurb].resize(nBytes);
+        FAST_CopyPackedCheckpoint(&iTurb, checkpointData[iTurb].data());
+        checkpointDataRoot[iTurb] = checkPointRoot;
+    }
+
+    checkpointWrite = std::async(std::launch::async, &fast::OpenFAST::writeCheckpointFiles, this, nt_global);
+}
+
+void fast::OpenFAST::waitCheckpointWrite() {
+    if (checkpointWrite.valid()) checkpointWrite.get();
+}
+
+void fast::OpenFAST::writeCheckpointFiles(int curTimeStep) {
+
+    // Write the checkpoint files packed by createCheckpointAsync in the same format as FAST_CreateCheckpoint
+    std::vector<std::string> files;
+    for (int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
+        std::string fileName = checkpointDataRoot[iTurb] + ".chkp";
+        std::ofstream chkpFile(fileName, std::ios::binary);
+        chkpFile.write(checkpointData[iTurb].data(), checkpointData[iTurb].size());
+        chkpFile.close();
+        if (!chkpFile) {
+            throw std::runtime_error("Error writing checkpoint file " + fileName);
         }
-        if(scStatus) {
-            std::cout << "Use of Supercontroller is not supported through the C++ API right now" << std::endl;
-            // if (fastMPIRank == 0) {
-            // sc.writeRestartFile(nt_global);
-            // }
+        files.push_back(fileName);
+        files.push_back(checkpointDataRoot[iTurb] + ".dll.chkp");
+    }
+    if (nTurbinesProc > 0) {
+        files.push_back("velDatafile." + std::to_string(worldMPIRank) + ".h5." + std::to_string(curTimeStep) + ".bak");
+    }
+    if (scStatus && (fastMPIRank == 0)) {
+        // The supercontroller restart file of this checkpoint is shared by all processors, so only one of them removes it
+        files.push_back(SuperController::restartFileName(curTimeStep));
+    }
+
+    // Remove the oldest checkpoints beyond the nCheckpointsKept most recent ones
+    checkpointFiles.push_back(files);
+    while ( (nCheckpointsKept > 0) && (checkpointFiles.size() > (size_t)nCheckpointsKept) ) {
+        for (size_t iFile = 0; iFile < checkpointFiles.front().size(); iFile++) {
+            std::remove(checkpointFiles.front()[iFile].c_str());
         }
+        checkpointFiles.pop_front();
+    }
+}
+
+void fast::OpenFAST::printCheckpointStallTimes() {
+
+    // Print how long the time loop was held up by checkpoints on this processor
+    if (nCheckpoints > 0) {
+        std::cout << "Proc " << worldMPIRank << " checkpoint stall time: average = " << checkpointStallTimeTotal/nCheckpoints << " s, max = " << checkpointStallTimeMax << " s over " << nCheckpoints << " checkpoints" << std::endl ;
     }
 }
 
+void fast::OpenFAST::stepAsync() {
+
+    if (asyncStep.valid()) {
+        throw std::runtime_error("stepAsync() called while the previous time step is still pending. Call wait() first.");
+    }
+
+    // With the supercontroller, the time step makes MPI calls from the background thread (the exchange with the
+    // supercontroller and the collective writes of its restart files) while the caller may make its own
+    int mpiThreadLevel;
+    MPI_Query_thread(&mpiThreadLevel);
+    if (scStatus && (mpiThreadLevel < MPI_THREAD_MULTIPLE)) {
+        throw std::runtime_error("stepAsync() with the supercontroller requires MPI to be initialized with MPI_Init_thread at the thread support level MPI_THREAD_MULTIPLE.");
+    }
+
+    asyncStep = std::async(std::launch::async, [this]() {
+        std::chrono::steady_clock::time_point tStart = std::chrono::steady_clock::now();
+        step();
+        asyncStepTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+    });
+}
+
+double fast::OpenFAST::wait() {
+
+    if (!asyncStep.valid()) return 0.0;
+
+    std::chrono::steady_clock::time_point tStart = std::chrono::steady_clock::now();
+    asyncStep.get();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+}
+
 void fast::OpenFAST::stepNoWrite() {
 
     /* ******************************
     set inputs from this code and call FAST:
     ********************************* */
 
-    for (int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
+    //  set wind speeds at original locations
+    //     setOutputsToFAST(cDriver_Input_from_FAST[iTurb], cDriver_Output_to_FAST[iTurb]);
 
-        //  set wind speeds at original locations
-        //     setOutputsToFAST(cDriver_Input_from_FAST[iTurb], cDriver_Output_to_FAST[iTurb]);
-
-        // this advances the states, calls CalcOutput, and solves for next inputs. Predictor-corrector loop is imbeded here:
-        // (note OpenFOAM could do subcycling around this step)
-        FAST_OpFM_Step(&iTurb, &ErrStat, ErrMsg);
-        checkError(ErrStat, ErrMsg);
-
-    }
+    // this advances the states, calls CalcOutput, and solves for next inputs. Predictor-corrector loop is imbeded here:
+    // (note OpenFOAM could do subcycling around this step)
+    stepTurbines();
 
     if(scStatus) {
-        std::cout << "Use of Supercontroller is not supported through the C++ API right now" << std::endl;
-        // sc.updateStates( nt_global * dtFAST); // Predict state at 'n+1' based on inputs
-        // sc.calcOutputs_np1( (nt_global+1) * dtFAST);
-        // sc.fastSCInputOutput();
+        {
+            // Wait for the inputs to the supercontroller sent at the end of the previous time step
+            FAST_SCOPED_TIMER(timers, timerMPI);
+            sc.completeInputExchange();
+        }
+        sc.updateStates( nt_global * dtFAST); // Predict state at 'n+1' based on inputs
+        sc.calcOutputs_np1( (nt_global+1) * dtFAST);
+        FAST_SCOPED_TIMER(timers, timerMPI);
+        sc.fastSCInputOutput();
     }
 
     nt_global = nt_global + 1;
 
     if(scStatus) {
-        std::cout << "Use of Supercontroller is not supported through the C++ API right now" << std::endl;
-        // sc.advanceTime(); // Advance states, inputs and outputs from 'n' to 'n+1'
+        sc.advanceTime(); // Advance states, inputs and outputs from 'n' to 'n+1'
+    }
+}
+
+void fast::OpenFAST::stepTurbines() {
+
+    // Advance all turbines on this processor by one FAST time step. In parallel mode, each
+    // turbine is stepped on its own OpenMP thread and the time step counter inside the FAST
+    // library is advanced once all turbines are done.
+
+#ifdef OPENFAST_CPP_API_TIMERS
+    std::chrono::steady_clock::time_point tStart = std::chrono::steady_clock::now();
+#endif
+
+    if (parallelTurbineStep) {
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for (int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
+            int iTurbThread = iTurb;
+            std::chrono::steady_clock::time_point tStepStart = std::chrono::steady_clock::now();
+            FAST_OpFM_StepTurbine(&iTurbThread, &turbineErrStat[iTurb], &turbineErrMsg[iTurb*INTERFACE_STRING_LENGTH]);
+            turbineStepTime[iTurb] = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStepStart).count();
+        }
+        FAST_OpFM_IncrementStep();
+
+        // Exceptions can't be thrown from inside the parallel region
+        for (int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
+            checkError(turbineErrStat[iTurb], &turbineErrMsg[iTurb*INTERFACE_STRING_LENGTH]);
+        }
+
+    } else {
+
+        for (int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
+            std::chrono::steady_clock::time_point tStepStart = std::chrono::steady_clock::now();
+            FAST_OpFM_Step(&iTurb, &ErrStat, ErrMsg);
+            turbineStepTime[iTurb] = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStepStart).count();
+            checkError(ErrStat, ErrMsg);
+        }
+
+    }
+
+    for (int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
+        turbineStepTimeTotal[iTurb] += turbineStepTime[iTurb];
+    }
+    nStepsTimed++;
+
+#ifdef OPENFAST_CPP_API_TIMERS
+    // The turbine step times are measured anyway, so they don't need timers of their own
+    if (timers.isEnabled()) {
+        timers.add(timerTurbineStep, std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count());
+        for (int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
+            timers.addTurbine(timerTurbineStep, turbineMapProcToGlob[iTurb], turbineStepTime[iTurb]);
+        }
+    }
+#endif
+
+    if ( isDebug() ) {
+        for (int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
+            std::cout << "Turbine " << turbineMapProcToGlob[iTurb] << " step time = " << turbineStepTime[iTurb] << " s" << std::endl ;
+        }
+    }
+}
+
+void fast::OpenFAST::printTurbineStepTimes() {
+
+    // Print the average wall clock time per FAST step of each turbine on this processor
+    if (nStepsTimed > 0) {
+        for (int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
+            std::cout << "Proc " << worldMPIRank << " glob iTurb " << turbineMapProcToGlob[iTurb] << " average step time = " << turbineStepTimeTotal[iTurb]/nStepsTimed << " s over " << nStepsTimed << " steps" << std::endl ;
+        }
     }
 }
 
@@ -436,10 +662,48 @@ void fast::OpenFAST::setInputs(const fast::fastInputs & fi ) {
 
         dryRun = fi.dryRun;
         debug = fi.debug;
+        parallelTurbineStep = fi.parallelTurbineStep;
+        nStepsVelDataBuffer = std::max(fi.nStepsVelDataBuffer, 1);
+        nStepsVelDataRead = fi.nStepsVelDataRead;
+
+        // Writing the velocity node data in the background calls HDF-5 from another thread while the
+        // time loop may call it too (e.g. the supercontroller restart file). Only do so with a thread
+        // safe HDF-5 library; otherwise the data is written and backed up synchronously, also with
+        // asyncCheckpoint (which then only writes the checkpoint files of the turbines in the background).
+        hbool_t hdf5ThreadSafe = 0;
+        H5is_library_threadsafe(&hdf5ThreadSafe);
+        velDataFlushAsync = (hdf5ThreadSafe > 0);
+        if (!velDataFlushAsync && (worldMPIRank == 0)) {
+            std::cout << "The HDF-5 library is not thread safe. The velocity node data will be written synchronously." << std::endl;
+        }
+        // Reading ahead on restart has no synchronous fallback
+        if (!hdf5ThreadSafe && (fi.nStepsVelDataRead > 0)) {
+            throw std::runtime_error("nStepsVelDataRead > 0 requires an HDF-5 library built thread safe (--enable-threadsafe).");
+        }
+#ifndef _OPENMP
+        if (parallelTurbineStep && (worldMPIRank == 0)) {
+            std::cout << "parallelTurbineStep requires OpenMP support. Turbines will be stepped serially." << std::endl;
+        }
+#endif
 
         tStart = fi.tStart;
         simStart = fi.simStart;
         nEveryCheckPoint = fi.nEveryCheckPoint;
+        asyncCheckpoint = fi.asyncCheckpoint;
+        nCheckpointsKept = fi.nCheckpointsKept;
+
+        phaseTimerFile = fi.phaseTimerFile;
+        timers.setTurbines(nTurbinesGlob);
+#ifdef OPENFAST_CPP_API_TIMERS
+        timers.enable(fi.phaseTimers);
+        if (fi.phaseTimers && fi.phaseTimerTrace) {
+            timers.enableTrace(phaseTimerFile + ".trace." + std::to_string(worldMPIRank) + ".csv");
+        }
+#else
+        if (fi.phaseTimers && (worldMPIRank == 0)) {
+            std::cout << "phaseTimers requires the C++ API to be built with OPENFAST_CPP_API_TIMERS. No timers will be written." << std::endl;
+        }
+#endif
         tMax = fi.tMax;
         loadSuperController(fi);
         dtFAST = fi.dtFAST;
@@ -541,9 +805,10 @@ void fast::OpenFAST::getRelativeVelForceNode(double* currentVelocity, int iNode,
     int iTurbLoc = get_localTurbNo(iTurbGlob);
     for(int j=0; j < iTurbLoc; j++) iNode = iNode - get_numForcePtsLoc(iTurbLoc);
 
-    currentVelocity[0] = forceNodeVel[iTurbLoc][iNode][0] - cDriver_Input_from_FAST[iTurbLoc].xdotForce[iNode];
-    currentVelocity[1] = forceNodeVel[iTurbLoc][iNode][1] - cDriver_Input_from_FAST[iTurbLoc].ydotForce[iNode];
-    currentVelocity[2] = forceNodeVel[iTurbLoc][iNode][2] - cDriver_Input_from_FAST[iTurbLoc].zdotForce[iNode];
+    const double * vel = get_forceNodeVelLoc(iTurbLoc, iNode);
+    currentVelocity[0] = vel[0] - cDriver_Input_from_FAST[iTurbLoc].xdotForce[iNode];
+    currentVelocity[1] = vel[1] - cDriver_Input_from_FAST[iTurbLoc].ydotForce[iNode];
+    currentVelocity[2] = vel[2] - cDriver_Input_from_FAST[iTurbLoc].zdotForce[iNode];
 }
 
 void fast::OpenFAST::getForce(double* currentForce, int iNode, int iTurbGlob, int nSize) {
@@ -579,104 +844,221 @@ void fast::OpenFAST::setVelocityForceNode(double* currentVelocity, int iNode, in
     int iTurbLoc = get_localTurbNo(iTurbGlob);
     for(int j=0; j < iTurbLoc; j++) iNode = iNode - get_numForcePtsLoc(iTurbLoc);
 
+    double * vel = get_forceNodeVelLoc(iTurbLoc, iNode);
     for(int i=0; i<nSize; ++i){
-        forceNodeVel[iTurbLoc][iNode][i] = currentVelocity[i];
+        vel[i] = currentVelocity[i];
+    }
+}
+
+void fast::OpenFAST::getVelNodeCoordinatesLoc(double* px, double* py, double* pz, int iTurbLoc) {
+    // Get coordinates of all velocity nodes of current turbine
+    const OpFM_InputType_t & iData = cDriver_Input_from_FAST[iTurbLoc];
+    const float basePosX = TurbineBasePos[iTurbLoc][0];
+    const float basePosY = TurbineBasePos[iTurbLoc][1];
+    const float basePosZ = TurbineBasePos[iTurbLoc][2];
+    const int nNodes = get_numVelPtsLoc(iTurbLoc);
+    for(int iNode=0; iNode < nNodes; iNode++) {
+        px[iNode] = iData.pxVel[iNode] + basePosX;
+        py[iNode] = iData.pyVel[iNode] + basePosY;
+        pz[iNode] = iData.pzVel[iNode] + basePosZ;
+    }
+}
+
+void fast::OpenFAST::setVelocityLoc(const double* u, const double* v, const double* w, int iTurbLoc) {
+    // Set velocity at all velocity nodes of current turbine
+    OpFM_OutputType_t & oData = cDriver_Output_to_FAST[iTurbLoc];
+    const int nNodes = get_numVelPtsLoc(iTurbLoc);
+    for(int iNode=0; iNode < nNodes; iNode++) {
+        oData.u[iNode] = u[iNode];
+        oData.v[iNode] = v[iNode];
+        oData.w[iNode] = w[iNode];
+    }
+}
+
+void fast::OpenFAST::getForceNodeCoordinatesLoc(double* px, double* py, double* pz, int iTurbLoc) {
+    // Get coordinates of all force nodes of current turbine
+    const OpFM_InputType_t & iData = cDriver_Input_from_FAST[iTurbLoc];
+    const float basePosX = TurbineBasePos[iTurbLoc][0];
+    const float basePosY = TurbineBasePos[iTurbLoc][1];
+    const float basePosZ = TurbineBasePos[iTurbLoc][2];
+    const int nNodes = get_numForcePtsLoc(iTurbLoc);
+    for(int iNode=0; iNode < nNodes; iNode++) {
+        px[iNode] = iData.pxForce[iNode] + basePosX;
+        py[iNode] = iData.pyForce[iNode] + basePosY;
+        pz[iNode] = iData.pzForce[iNode] + basePosZ;
+    }
+}
+
+void fast::OpenFAST::getForceLoc(double* fx, double* fy, double* fz, int iTurbLoc) {
+    // Get forces at all force nodes of current turbine
+    const OpFM_InputType_t & iData = cDriver_Input_from_FAST[iTurbLoc];
+    const int nNodes = get_numForcePtsLoc(iTurbLoc);
+    for(int iNode=0; iNode < nNodes; iNode++) {
+        fx[iNode] = -iData.fx[iNode];
+        fy[iNode] = -iData.fy[iNode];
+        fz[iNode] = -iData.fz[iNode];
+    }
+}
+
+void fast::OpenFAST::setVelocityForceNodeLoc(const double* u, const double* v, const double* w, int iTurbLoc) {
+    // Set velocity at all force nodes of current turbine
+    const int nNodes = get_numForcePtsLoc(iTurbLoc);
+    double * vel = get_forceNodeVelLoc(iTurbLoc, 0);
+    for(int iNode=0; iNode < nNodes; iNode++) {
+        vel[iNode*3 + 0] = u[iNode];
+        vel[iNode*3 + 1] = v[iNode];
+        vel[iNode*3 + 2] = w[iNode];
+    }
+}
+
+void fast::OpenFAST::getRelativeVelForceNodeLoc(double* u, double* v, double* w, int iTurbLoc) {
+    // Get relative velocity at all force nodes of current turbine
+    const OpFM_InputType_t & iData = cDriver_Input_from_FAST[iTurbLoc];
+    const int nNodes = get_numForcePtsLoc(iTurbLoc);
+    const double * vel = get_forceNodeVelLoc(iTurbLoc, 0);
+    for(int iNode=0; iNode < nNodes; iNode++) {
+        u[iNode] = vel[iNode*3 + 0] - iData.xdotForce[iNode];
+        v[iNode] = vel[iNode*3 + 1] - iData.ydotForce[iNode];
+        w[iNode] = vel[iNode*3 + 2] - iData.zdotForce[iNode];
+    }
+}
+
+void fast::OpenFAST::getVelNodeCoordinates(double* px, double* py, double* pz) {
+    // Get coordinates of all velocity nodes of all turbines on this processor
+    for(int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
+        const int iStart = velNodeOffset[iTurb];
+        getVelNodeCoordinatesLoc(px + iStart, py + iStart, pz + iStart, iTurb);
+    }
+}
+
+void fast::OpenFAST::setVelocity(const double* u, const double* v, const double* w) {
+    // Set velocity at all velocity nodes of all turbines on this processor
+    for(int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
+        const int iStart = velNodeOffset[iTurb];
+        setVelocityLoc(u + iStart, v + iStart, w + iStart, iTurb);
+    }
+}
+
+void fast::OpenFAST::getForceNodeCoordinates(double* px, double* py, double* pz) {
+    // Get coordinates of all force nodes of all turbines on this processor
+    for(int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
+        const int iStart = forceNodeOffset[iTurb];
+        getForceNodeCoordinatesLoc(px + iStart, py + iStart, pz + iStart, iTurb);
+    }
+}
+
+void fast::OpenFAST::getForce(double* fx, double* fy, double* fz) {
+    // Get forces at all force nodes of all turbines on this processor
+    for(int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
+        const int iStart = forceNodeOffset[iTurb];
+        getForceLoc(fx + iStart, fy + iStart, fz + iStart, iTurb);
+    }
+}
+
+void fast::OpenFAST::setVelocityForceNode(const double* u, const double* v, const double* w) {
+    // Set velocity at all force nodes of all turbines on this processor
+    for(int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
+        const int iStart = forceNodeOffset[iTurb];
+        setVelocityForceNodeLoc(u + iStart, v + iStart, w + iStart, iTurb);
+    }
+}
+
+void fast::OpenFAST::getRelativeVelForceNode(double* u, double* v, double* w) {
+    // Get relative velocity at all force nodes of all turbines on this processor
+    for(int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
+        const int iStart = forceNodeOffset[iTurb];
+        getRelativeVelForceNodeLoc(u + iStart, v + iStart, w + iStart, iTurb);
     }
 }
 
 void fast::OpenFAST::interpolateVel_ForceToVelNodes() {
 
+    FAST_SCOPED_TIMER(timers, timerInterpolateVel);
+
     // Interpolates the velocity from the force nodes to the velocity nodes
     for(int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
         // Hub location
-        cDriver_Output_to_FAST[iTurb].u[0] = forceNodeVel[iTurb][0][0];
-        cDriver_Output_to_FAST[iTurb].v[0] = forceNodeVel[iTurb][0][1];
-        cDriver_Output_to_FAST[iTurb].w[0] = forceNodeVel[iTurb][0][2];
+        const double * velHub = get_forceNodeVelLoc(iTurb, 0);
+        cDriver_Output_to_FAST[iTurb].u[0] = velHub[0];
+        cDriver_Output_to_FAST[iTurb].v[0] = velHub[1];
+        cDriver_Output_to_FAST[iTurb].w[0] = velHub[2];
 
         if ( isDebug() ) {
             std::ofstream actuatorVelFile;
             actuatorVelFile.open("actuator_velocity.csv") ;
             actuatorVelFile << "# x, y, z, Vx, Vy, Vz" << std::endl ;
             for (int iNode=0; iNode < get_numForcePtsLoc(iTurb); iNode++) {
-                actuatorVelFile << cDriver_Input_from_FAST[iTurb].pxForce[iNode] << ", " << cDriver_Input_from_FAST[iTurb].pyForce[iNode] << ", " << cDriver_Input_from_FAST[iTurb].pzForce[iNode] << ", " << forceNodeVel[iTurb][iNode][0] << ", " << forceNodeVel[iTurb][iNode][1] << ", " << forceNodeVel[iTurb][iNode][2] << " " << std::endl ;
+                actuatorVelFile << cDriver_Input_from_FAST[iTurb].pxForce[iNode] << ", " << cDriver_Input_from_FAST[iTurb].pyForce[iNode] << ", " << cDriver_Input_from_FAST[iTurb].pzForce[iNode] << ", " << velHub[iNode*3 + 0] << ", " << velHub[iNode*3 + 1] << ", " << velHub[iNode*3 + 2] << " " << std::endl ;
             }
             actuatorVelFile.close() ;
         }
 
-        // Do the blades first
+        // Do the blades first - Interpolating parameter is the distance from the hub
         int nBlades = get_numBladesLoc(iTurb);
+        int nForcePtsBlade = get_numForcePtsBladeLoc(iTurb);
+        int nVelPtsBlade = get_numVelPtsBladeLoc(iTurb);
         for(int iBlade=0; iBlade < nBlades; iBlade++) {
-            // Create interpolating parameter - Distance from hub
-            int nForcePtsBlade = get_numForcePtsBladeLoc(iTurb);
-            std::vector<double> rDistForce(nForcePtsBlade) ;
-            for(int j=0; j < nForcePtsBlade; j++) {
-                int iNodeForce = 1 + iBlade * nForcePtsBlade + j ; //The number of actuator force points is always the same for all blades
-                rDistForce[j] = std::sqrt(
-                    (cDriver_Input_from_FAST[iTurb].pxForce[iNodeForce] - cDriver_Input_from_FAST[iTurb].pxForce[0])*(cDriver_Input_from_FAST[iTurb].pxForce[iNodeForce] - cDriver_Input_from_FAST[iTurb].pxForce[0])
-                    + (cDriver_Input_from_FAST[iTurb].pyForce[iNodeForce] - cDriver_Input_from_FAST[iTurb].pyForce[0])*(cDriver_Input_from_FAST[iTurb].pyForce[iNodeForce] - cDriver_Input_from_FAST[iTurb].pyForce[0])
-                    + (cDriver_Input_from_FAST[iTurb].pzForce[iNodeForce] - cDriver_Input_from_FAST[iTurb].pzForce[0])*(cDriver_Input_from_FAST[iTurb].pzForce[iNodeForce] - cDriver_Input_from_FAST[iTurb].pzForce[0])
-                );
-            }
-
-            // Interpolate to the velocity nodes
-            int nVelPtsBlade = get_numVelPtsBladeLoc(iTurb);
-            for(int j=0; j < nVelPtsBlade; j++) {
-                int iNodeVel = 1 + iBlade * nVelPtsBlade + j ; //Assumes the same number of velocity (Aerodyn) nodes for all blades
-                double rDistVel = std::sqrt(
-                    (cDriver_Input_from_FAST[iTurb].pxVel[iNodeVel] - cDriver_Input_from_FAST[iTurb].pxVel[0])*(cDriver_Input_from_FAST[iTurb].pxVel[iNodeVel] - cDriver_Input_from_FAST[iTurb].pxVel[0])
-                    + (cDriver_Input_from_FAST[iTurb].pyVel[iNodeVel] - cDriver_Input_from_FAST[iTurb].pyVel[0])*(cDriver_Input_from_FAST[iTurb].pyVel[iNodeVel] - cDriver_Input_from_FAST[iTurb].pyVel[0])
-                    + (cDriver_Input_from_FAST[iTurb].pzVel[iNodeVel] - cDriver_Input_from_FAST[iTurb].pzVel[0])*(cDriver_Input_from_FAST[iTurb].pzVel[iNodeVel] - cDriver_Input_from_FAST[iTurb].pzVel[0])
-                );
-                //Find nearest two force nodes
-                int jForceLower = 0;
-                while ( (rDistForce[jForceLower+1] < rDistVel) && ( jForceLower < (nForcePtsBlade-2)) ) {
-                    jForceLower = jForceLower + 1;
-                }
-                int iNodeForceLower = 1 + iBlade * nForcePtsBlade + jForceLower ;
-                double rInterp = (rDistVel - rDistForce[jForceLower])/(rDistForce[jForceLower+1]-rDistForce[jForceLower]);
-                cDriver_Output_to_FAST[iTurb].u[iNodeVel] = forceNodeVel[iTurb][iNodeForceLower][0] + rInterp * (forceNodeVel[iTurb][iNodeForceLower+1][0] - forceNodeVel[iTurb][iNodeForceLower][0] );
-                cDriver_Output_to_FAST[iTurb].v[iNodeVel] = forceNodeVel[iTurb][iNodeForceLower][1] + rInterp * (forceNodeVel[iTurb][iNodeForceLower+1][1] - forceNodeVel[iTurb][iNodeForceLower][1] );
-                cDriver_Output_to_FAST[iTurb].w[iNodeVel] = forceNodeVel[iTurb][iNodeForceLower][2] + rInterp * (forceNodeVel[iTurb][iNodeForceLower+1][2] - forceNodeVel[iTurb][iNodeForceLower][2] );
-            }
+            // The number of actuator force points is always the same for all blades
+            // Assumes the same number of velocity (Aerodyn) nodes for all blades
+            interpolateVel_ForceToVelNodesLine(cDriver_Input_from_FAST[iTurb], get_forceNodeVelLoc(iTurb, 0), 0, 1 + iBlade * nForcePtsBlade, nForcePtsBlade, 0, 1 + iBlade * nVelPtsBlade, nVelPtsBlade, interpDistForce, cDriver_Output_to_FAST[iTurb]);
         }
 
-        // Now the tower if present and used
+        // Now the tower if present and used - Interpolating parameter is the distance from the first node from ground
         int nVelPtsTower = get_numVelPtsTwrLoc(iTurb);
         if ( nVelPtsTower > 0 ) {
+            int iNodeBotTowerForce = 1 + nBlades * nForcePtsBlade;
+            int iNodeBotTowerVel = 1 + nBlades * nVelPtsBlade;
+            interpolateVel_ForceToVelNodesLine(cDriver_Input_from_FAST[iTurb], get_forceNodeVelLoc(iTurb, 0), iNodeBotTowerForce, iNodeBotTowerForce, get_numForcePtsTwrLoc(iTurb), iNodeBotTowerVel, iNodeBotTowerVel, nVelPtsTower, interpDistForce, cDriver_Output_to_FAST[iTurb]);
+        }
+    }
+}
 
-            // Create interpolating parameter - Distance from first node from ground
-            int nForcePtsTower = get_numForcePtsTwrLoc(iTurb);
-            std::vector<double> hDistForce(nForcePtsTower) ;
-            int iNodeBotTowerForce = 1 + nBlades * get_numForcePtsBladeLoc(iTurb); // The number of actuator force points is always the same for all blades
-            for(int j=0; j < nForcePtsTower; j++) {
-                int iNodeForce = iNodeBotTowerForce + j ;
-                hDistForce[j] = std::sqrt(
-                    (cDriver_Input_from_FAST[iTurb].pxForce[iNodeForce] - cDriver_Input_from_FAST[iTurb].pxForce[iNodeBotTowerForce])*(cDriver_Input_from_FAST[iTurb].pxForce[iNodeForce] - cDriver_Input_from_FAST[iTurb].pxForce[iNodeBotTowerForce])
-                    + (cDriver_Input_from_FAST[iTurb].pyForce[iNodeForce] - cDriver_Input_from_FAST[iTurb].pyForce[iNodeBotTowerForce])*(cDriver_Input_from_FAST[iTurb].pyForce[iNodeForce] - cDriver_Input_from_FAST[iTurb].pyForce[iNodeBotTowerForce])
-                    + (cDriver_Input_from_FAST[iTurb].pzForce[iNodeForce] - cDriver_Input_from_FAST[iTurb].pzForce[iNodeBotTowerForce])*(cDriver_Input_from_FAST[iTurb].pzForce[iNodeForce] - cDriver_Input_from_FAST[iTurb].pzForce[iNodeBotTowerForce])
-                );
-            }
+void fast::OpenFAST::interpolateVel_ForceToVelNodesLine(const OpFM_InputType_t & iData, const double * forceNodeVel, int iNodeRefForce, int iNodeStartForce, int nForcePts, int iNodeRefVel, int iNodeStartVel, int nVelPts, std::vector<double> & distForceBuffer, OpFM_OutputType_t & oData) {
+
+    // Linearly interpolate the velocity from 'nForcePts' force nodes starting at 'iNodeStartForce' to 'nVelPts'
+    // velocity nodes starting at 'iNodeStartVel' along a blade or the tower. The interpolating parameter is
+    // the distance from the reference nodes 'iNodeRefForce' and 'iNodeRefVel'.
+
+    // Distance of the force nodes from the reference node, computed once per call in a scratch buffer
+    distForceBuffer.resize(nForcePts);
+    double * distForce = distForceBuffer.data();
+    const float pxRefForce = iData.pxForce[iNodeRefForce];
+    const float pyRefForce = iData.pyForce[iNodeRefForce];
+    const float pzRefForce = iData.pzForce[iNodeRefForce];
+    bool distForceIncreasing = true;
+    for(int j=0; j < nForcePts; j++) {
+        const float dx = iData.pxForce[iNodeStartForce + j] - pxRefForce;
+        const float dy = iData.pyForce[iNodeStartForce + j] - pyRefForce;
+        const float dz = iData.pzForce[iNodeStartForce + j] - pzRefForce;
+        distForce[j] = std::sqrt(dx*dx + dy*dy + dz*dz);
+        if ( (j > 0) && (distForce[j] < distForce[j-1]) ) distForceIncreasing = false;
+    }
 
-            int iNodeBotTowerVel = 1 + nBlades * get_numVelPtsBladeLoc(iTurb); // Assumes the same number of velocity (Aerodyn) nodes for all blades
-            for(int j=0; j < nVelPtsTower; j++) {
-                int iNodeVel = iNodeBotTowerVel + j ;
-                double hDistVel = std::sqrt(
-                    (cDriver_Input_from_FAST[iTurb].pxVel[iNodeVel] - cDriver_Input_from_FAST[iTurb].pxVel[iNodeBotTowerVel])*(cDriver_Input_from_FAST[iTurb].pxVel[iNodeVel] - cDriver_Input_from_FAST[iTurb].pxVel[iNodeBotTowerVel])
-                    + (cDriver_Input_from_FAST[iTurb].pyVel[iNodeVel] - cDriver_Input_from_FAST[iTurb].pyVel[iNodeBotTowerVel])*(cDriver_Input_from_FAST[iTurb].pyVel[iNodeVel] - cDriver_Input_from_FAST[iTurb].pyVel[iNodeBotTowerVel])
-                    + (cDriver_Input_from_FAST[iTurb].pzVel[iNodeVel] - cDriver_Input_from_FAST[iTurb].pzVel[iNodeBotTowerVel])*(cDriver_Input_from_FAST[iTurb].pzVel[iNodeVel] - cDriver_Input_from_FAST[iTurb].pzVel[iNodeBotTowerVel])
-                );
-                //Find nearest two force nodes
-                int jForceLower = 0;
-                while ( (hDistForce[jForceLower+1] < hDistVel) && ( jForceLower < (nForcePtsTower-2)) )   {
-                    jForceLower = jForceLower + 1;
-                }
-                int iNodeForceLower = iNodeBotTowerForce + jForceLower ;
-                double rInterp = (hDistVel - hDistForce[jForceLower])/(hDistForce[jForceLower+1]-hDistForce[jForceLower]);
-                cDriver_Output_to_FAST[iTurb].u[iNodeVel] = forceNodeVel[iTurb][iNodeForceLower][0] + rInterp * (forceNodeVel[iTurb][iNodeForceLower+1][0] - forceNodeVel[iTurb][iNodeForceLower][0] );
-                cDriver_Output_to_FAST[iTurb].v[iNodeVel] = forceNodeVel[iTurb][iNodeForceLower][1] + rInterp * (forceNodeVel[iTurb][iNodeForceLower+1][1] - forceNodeVel[iTurb][iNodeForceLower][1] );
-                cDriver_Output_to_FAST[iTurb].w[iNodeVel] = forceNodeVel[iTurb][iNodeForceLower][2] + rInterp * (forceNodeVel[iTurb][iNodeForceLower+1][2] - forceNodeVel[iTurb][iNodeForceLower][2] );
-            }
+    const float pxRefVel = iData.pxVel[iNodeRefVel];
+    const float pyRefVel = iData.pyVel[iNodeRefVel];
+    const float pzRefVel = iData.pzVel[iNodeRefVel];
+    int jForceLower = 0;
+    for(int j=0; j < nVelPts; j++) {
+        const int iNodeVel = iNodeStartVel + j;
+        const float dx = iData.pxVel[iNodeVel] - pxRefVel;
+        const float dy = iData.pyVel[iNodeVel] - pyRefVel;
+        const float dz = iData.pzVel[iNodeVel] - pzRefVel;
+        const double distVel = std::sqrt(dx*dx + dy*dy + dz*dz);
+
+        //Find nearest two force nodes - the lowest jForceLower with distForce[jForceLower+1] >= distVel.
+        //When the force node distances increase along the line, the search can continue from the
+        //previous velocity node unless this velocity node is closer to the reference node.
+        if ( !distForceIncreasing || (distForce[jForceLower] >= distVel) ) jForceLower = 0;
+        while ( (distForce[jForceLower+1] < distVel) && ( jForceLower < (nForcePts-2)) ) {
+            jForceLower = jForceLower + 1;
         }
+        const int iNodeForceLower = iNodeStartForce + jForceLower ;
+        const double rInterp = (distVel - distForce[jForceLower])/(distForce[jForceLower+1]-distForce[jForceLower]);
+        const double * velLower = &forceNodeVel[iNodeForceLower*3];
+        const double * velUpper = velLower + 3;
+        oData.u[iNodeVel] = velLower[0] + rInterp * (velUpper[0] - velLower[0]);
+        oData.v[iNodeVel] = velLower[1] + rInterp * (velUpper[1] - velLower[1]);
+        oData.w[iNodeVel] = velLower[2] + rInterp * (velUpper[2] - velLower[2]);
     }
 }
 
@@ -811,7 +1193,10 @@ void fast::OpenFAST::allocateMemory() {
     numForcePtsTwr.resize(nTurbinesProc);
     numVelPtsBlade.resize(nTurbinesProc);
     numVelPtsTwr.resize(nTurbinesProc);
-    forceNodeVel.resize(nTurbinesProc);
+    turbineStepTime.resize(nTurbinesProc);
+    turbineStepTimeTotal.resize(nTurbinesProc);
+    turbineErrStat.resize(nTurbinesProc);
+    turbineErrMsg.resize(nTurbinesProc*INTERFACE_STRING_LENGTH);
 
     for (int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
 
@@ -839,11 +1224,26 @@ void fast::OpenFAST::allocateMemory() {
     cDriver_Output_to_FAST.resize(nTurbinesProc) ;
     
     if(scStatus) {
-        std::cout << "Use of Supercontroller is not supported through the C++ API right now" << std::endl;
-        // scio.from_SC.resize(nTurbinesProc);
+        scio.from_SC.resize(nTurbinesProc);
     }
 }
 
+void fast::OpenFAST::allocateNodeData() {
+
+    // The velocity data at the force and velocity nodes of all turbines on this processor is stored in
+    // flat arrays. The nodes of turbine 'iTurb' start at forceNodeOffset[iTurb] and velNodeOffset[iTurb].
+    forceNodeOffset.resize(nTurbinesProc + 1);
+    velNodeOffset.resize(nTurbinesProc + 1);
+    forceNodeOffset[0] = 0;
+    velNodeOffset[0] = 0;
+    for (int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
+        forceNodeOffset[iTurb+1] = forceNodeOffset[iTurb] + get_numForcePtsLoc(iTurb);
+        velNodeOffset[iTurb+1] = velNodeOffset[iTurb] + get_numVelPtsLoc(iTurb);
+    }
+
+    forceNodeVel.assign(forceNodeOffset[nTurbinesProc] * 3, 0.0);
+}
+
 void fast::OpenFAST::allocateTurbinesToProcsSimple() {
     // Allocate turbines to each processor - round robin fashion
     int nProcs ;
@@ -851,12 +1251,145 @@ void fast::OpenFAST::allocateTurbinesToProcsSimple() {
     for(int j = 0; j < nTurbinesGlob; j++)  turbineMapGlobToProc[j] = j % nProcs ;
 }
 
+void fast::OpenFAST::allocateTurbinesToProcsBalanced(const std::vector<double> & turbineCost) {
+    // Allocate turbines to each processor to minimize the maximum step time over all processors.
+    // Turbines are assigned in decreasing order of cost, each to the processor with the least
+    // load so far (longest processing time first).
+    if (int(turbineCost.size()) != nTurbinesGlob) {
+        throw std::runtime_error("Size of turbine cost array is not equal to the number of turbines");
+    }
+
+    int nProcs ;
+    MPI_Comm_size(mpiComm, &nProcs);
+
+    std::vector<int> turbOrder(nTurbinesGlob);
+    for(int j = 0; j < nTurbinesGlob; j++) turbOrder[j] = j;
+    std::stable_sort(turbOrder.begin(), turbOrder.end(), [&turbineCost](int a, int b) { return turbineCost[a] > turbineCost[b]; });
+
+    predictedProcLoad.assign(nProcs, 0.0);
+    for(int j = 0; j < nTurbinesGlob; j++) {
+        int iTurbGlob = turbOrder[j];
+        int iProc = std::min_element(predictedProcLoad.begin(), predictedProcLoad.end()) - predictedProcLoad.begin();
+        setTurbineProcNo(iTurbGlob, iProc);
+        predictedProcLoad[iProc] += turbineCost[iTurbGlob];
+    }
+}
+
+void fast::OpenFAST::getTurbineCosts(std::vector<double> & turbineCost) {
+    // Get the average step time of all turbines from all processors. Must be called on all processors in mpiComm.
+    turbineCost.assign(nTurbinesGlob, 0.0);
+    if (nStepsTimed > 0) {
+        for (int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
+            turbineCost[turbineMapProcToGlob[iTurb]] = turbineStepTimeTotal[iTurb]/nStepsTimed;
+        }
+    }
+    FAST_SCOPED_TIMER(timers, timerMPI);
+    MPI_Allreduce(MPI_IN_PLACE, turbineCost.data(), nTurbinesGlob, MPI_DOUBLE, MPI_SUM, mpiComm);
+}
+
+void fast::OpenFAST::readTurbineCostFile(const std::string & costFileName, std::vector<double> & turbineCost) {
+    // Read the cost of each turbine from a file written by writeTurbineCostFile
+    std::ifstream costFile(costFileName);
+    if (!costFile.is_open()) {
+        throw std::runtime_error("Turbine cost file " + costFileName + " does not exist or I cannot access it");
+    }
+
+    turbineCost.assign(nTurbinesGlob, -1.0);
+    std::string line;
+    while (std::getline(costFile, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        std::istringstream lineStream(line);
+        int iTurbGlob;
+        double cost;
+        if ( (lineStream >> iTurbGlob >> cost) && (iTurbGlob >= 0) && (iTurbGlob < nTurbinesGlob) ) {
+            turbineCost[iTurbGlob] = cost;
+        }
+    }
+    costFile.close();
+
+    for (int iTurbGlob=0; iTurbGlob < nTurbinesGlob; iTurbGlob++) {
+        if (turbineCost[iTurbGlob] < 0.0) {
+            throw std::runtime_error("Cost of turbine " + std::to_string(iTurbGlob) + " not present in turbine cost file " + costFileName);
+        }
+    }
+}
+
+void fast::OpenFAST::writeTurbineCostFile(const std::string & costFileName) {
+    // Write the average step time of all turbines to a file that can be used to allocate turbines on restart.
+    // Must be called on all processors in mpiComm.
+    std::vector<double> turbineCost;
+    getTurbineCosts(turbineCost);
+
+    if (worldMPIRank == 0) {
+        std::ofstream costFile;
+        costFile.open(costFileName) ;
+        costFile << "# Average step time of each turbine over " << nStepsTimed << " steps" << std::endl ;
+        costFile << "# iTurbGlob, cost (s)" << std::endl ;
+        costFile.precision(16);
+        for (int iTurbGlob=0; iTurbGlob < nTurbinesGlob; iTurbGlob++) {
+            costFile << iTurbGlob << " " << turbineCost[iTurbGlob] << std::endl ;
+        }
+        costFile.close() ;
+    }
+}
+
+void fast::OpenFAST::reportTurbineLoadBalance() {
+    // Print the achieved step time of each processor, and the predicted step time if the turbines
+    // were allocated with allocateTurbinesToProcsBalanced. Must be called on all processors in mpiComm.
+    int nProcs ;
+    MPI_Comm_size(mpiComm, &nProcs);
+
+    std::vector<double> achievedProcLoad(nProcs, 0.0);
+    if (nStepsTimed > 0) {
+        for (int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
+            achievedProcLoad[worldMPIRank] += turbineStepTimeTotal[iTurb]/nStepsTimed;
+        }
+    }
+    {
+        FAST_SCOPED_TIMER(timers, timerMPI);
+        MPI_Allreduce(MPI_IN_PLACE, achievedProcLoad.data(), nProcs, MPI_DOUBLE, MPI_SUM, mpiComm);
+    }
+
+    if (worldMPIRank == 0) {
+        bool havePrediction = (int(predictedProcLoad.size()) == nProcs);
+        for (int iProc=0; iProc < nProcs; iProc++) {
+            std::cout << "Proc " << iProc << " step time = " << achievedProcLoad[iProc] << " s" ;
+            if (havePrediction) std::cout << " (predicted " << predictedProcLoad[iProc] << " s)" ;
+            std::cout << std::endl ;
+        }
+
+        double achievedMax = *std::max_element(achievedProcLoad.begin(), achievedProcLoad.end());
+        double achievedMean = std::accumulate(achievedProcLoad.begin(), achievedProcLoad.end(), 0.0)/nProcs;
+        std::cout << "Achieved max/mean step time = " << achievedMax << " / " << achievedMean << " s, imbalance = " << (achievedMean > 0.0 ? achievedMax/achievedMean : 1.0) << std::endl ;
+        if (havePrediction) {
+            double predictedMax = *std::max_element(predictedProcLoad.begin(), predictedProcLoad.end());
+            double predictedMean = std::accumulate(predictedProcLoad.begin(), predictedProcLoad.end(), 0.0)/nProcs;
+            std::cout << "Predicted max/mean step time = " << predictedMax << " / " << predictedMean << " s, imbalance = " << (predictedMean > 0.0 ? predictedMax/predictedMean : 1.0) << std::endl ;
+        }
+    }
+}
+
 void fast::OpenFAST::end() {
     // Deallocate types we allocated earlier
 
+    wait();
+
+    // Report a failed background checkpoint write, but still shut down the turbines below
+    std::string checkpointWriteError;
+    try {
+        waitCheckpointWrite();
+    } catch (const std::exception & e) {
+        checkpointWriteError = e.what();
+        std::cerr << "Proc " << worldMPIRank << ": background checkpoint write failed: " << checkpointWriteError << std::endl;
+    }
+
     if (nTurbinesProc > 0) closeVelocityDataFile(nt_global, velNodeDataFile);
 
     if ( !dryRun) {
+        if (parallelTurbineStep || isDebug()) printTurbineStepTimes();
+        printCheckpointStallTimes();
+        if (timers.isEnabled()) timers.writeSummary(mpiComm, phaseTimerFile);
+
         bool stopTheProgram = false;
         for (int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
             FAST_End(&iTurb, &stopTheProgram);
@@ -864,23 +1397,36 @@ void fast::OpenFAST::end() {
         FAST_DeallocateTurbines(&ErrStat, ErrMsg);
     }
 
+    if(scStatus) {
+        sc.end();
+    }
+
     MPI_Group_free(&fastMPIGroup);
     if (MPI_COMM_NULL != fastMPIComm) {
         MPI_Comm_free(&fastMPIComm);
     }
     MPI_Group_free(&worldMPIGroup);
 
-    if(scStatus) {
-        std::cout << "Use of Supercontroller is not supported through the C++ API right now" << std::endl;
-        // sc.end();
+    if (!checkpointWriteError.empty()) {
+        throw std::runtime_error("Background checkpoint write failed: " + checkpointWriteError);
     }
 }
 
 void fast::OpenFAST::readVelocityData(int nTimesteps) {
 
-    int nTurbines;
+    // Read the velocity data of the first 'nTimesteps' time steps of all turbines into velNodeData
+    hid_t velDataFile = H5Fopen(("velDatafile." + std::to_string(worldMPIRank) + ".h5").c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    readVelocityDataChunk(velDataFile, 0, nTimesteps, velNodeData);
+    velNodeDataStart = 0;
+    velNodeDataCount = nTimesteps;
+    H5Fclose(velDataFile);
+}
 
-    hid_t velDataFile = H5Fopen(("velDatafile." + std::to_string(worldMPIRank) + ".h5").c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+void fast::OpenFAST::readVelocityDataChunk(hid_t velDataFile, int iStepStart, int nSteps, std::vector<double> & velData) {
+
+    // Read the velocity data of time steps [iStepStart, iStepStart + nSteps) of all turbines.
+    // All time steps of a turbine are read as one hyperslab straight into its nodes in velData.
+    int nTurbines;
 
     {
         hid_t attr = H5Aopen(velDataFile, "nTurbines", H5P_DEFAULT);
@@ -888,28 +1434,87 @@ void fast::OpenFAST::readVelocityData(int nTimesteps) {
         H5Aclose(attr);
     }
 
-    // Allocate memory and read the velocity data.
-    velNodeData.resize(nTurbines);
+    if (nTurbines != nTurbinesProc) {
+        throw std::runtime_error("Velocity data file contains " + std::to_string(nTurbines) + " turbines instead of " + std::to_string(nTurbinesProc));
+    }
+
+    // Allocate memory and read the velocity data. The memory is only reallocated when it grows.
+    int nVelPtsProc = get_numVelPtsProc();
+    velData.resize(nSteps*nVelPtsProc*6);
+    if (nSteps == 0) return;
+
+    hsize_t mdims[3]; mdims[0] = nSteps; mdims[1] = nVelPtsProc; mdims[2] = 6;
+    hid_t mspace_id = H5Screate_simple(3, mdims, NULL);
+
     for (int iTurb=0; iTurb < nTurbines; iTurb++) {
         int nVelPts = get_numVelPtsLoc(iTurb) ;
-        velNodeData[iTurb].resize(nTimesteps*nVelPts*6) ;
+
         hid_t dset_id = H5Dopen2(velDataFile, ("/turbine" + std::to_string(iTurb)).c_str(), H5P_DEFAULT);
         hid_t dspace_id = H5Dget_space(dset_id);
 
-        hsize_t start[3]; start[1] = 0; start[2] = 0;
-        hsize_t count[3]; count[0] = 1; count[1] = nVelPts; count[2] = 6;
-        hid_t mspace_id = H5Screate_simple(3, count, NULL);
+        hsize_t start[3]; start[0] = iStepStart; start[1] = 0; start[2] = 0;
+        hsize_t count[3]; count[0] = nSteps; count[1] = nVelPts; count[2] = 6;
+        H5Sselect_hyperslab(dspace_id, H5S_SELECT_SET, start, NULL, count, NULL);
 
-        for (int iStep=0; iStep < nTimesteps; iStep++) {
-            start[0] = iStep;
-            H5Sselect_hyperslab(dspace_id, H5S_SELECT_SET, start, NULL, count, NULL);
-            herr_t status = H5Dread(dset_id, H5T_NATIVE_DOUBLE, mspace_id, dspace_id, H5P_DEFAULT, &velNodeData[iTurb][iStep*nVelPts*6] );
-        }
+        hsize_t mstart[3]; mstart[0] = 0; mstart[1] = velNodeOffset[iTurb]; mstart[2] = 0;
+        H5Sselect_hyperslab(mspace_id, H5S_SELECT_SET, mstart, NULL, count, NULL);
+
+        herr_t status = H5Dread(dset_id, H5T_NATIVE_DOUBLE, mspace_id, dspace_id, H5P_DEFAULT, velData.data());
+
+        status = H5Sclose(dspace_id);
+        status = H5Dclose(dset_id);
+    }
+
+    H5Sclose(mspace_id);
+}
+
+void fast::OpenFAST::beginVelocityDataStream(int nTimesteps) {
 
-        herr_t status = H5Dclose(dset_id);
+    // Start reading the velocity data of the first 'nTimesteps' time steps in chunks of
+    // nStepsVelDataRead time steps. The first chunk is read right away and the next one is
+    // read in the background while the current one is used.
+    velNodeDataEnd = nTimesteps;
+    int nStepsChunk = ( (nStepsVelDataRead > 0) && (nStepsVelDataRead < nTimesteps) ) ? nStepsVelDataRead : nTimesteps;
+
+    velNodeDataReadFile = H5Fopen(("velDatafile." + std::to_string(worldMPIRank) + ".h5").c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    readVelocityDataChunk(velNodeDataReadFile, 0, nStepsChunk, velNodeData);
+    velNodeDataStart = 0;
+    velNodeDataCount = nStepsChunk;
+
+    velNodeDataNextStart = nStepsChunk;
+    velNodeDataNextCount = std::min(nStepsChunk, velNodeDataEnd - velNodeDataNextStart);
+    if (velNodeDataNextCount > 0) {
+        velNodeDataRead = std::async(std::launch::async, &fast::OpenFAST::readVelocityDataChunk, this, velNodeDataReadFile, velNodeDataNextStart, velNodeDataNextCount, std::ref(velNodeDataNext));
     }
 }
 
+void fast::OpenFAST::advanceVelocityDataStream(int iStep) {
+
+    // Make sure velNodeData contains time step 'iStep'. Time steps must be requested in increasing order.
+    if (iStep < velNodeDataStart + velNodeDataCount) return;
+
+    if (velNodeDataRead.valid()) velNodeDataRead.get();
+    velNodeData.swap(velNodeDataNext);
+    velNodeDataStart = velNodeDataNextStart;
+    velNodeDataCount = velNodeDataNextCount;
+
+    velNodeDataNextStart = velNodeDataStart + velNodeDataCount;
+    velNodeDataNextCount = std::min(velNodeDataCount, velNodeDataEnd - velNodeDataNextStart);
+    if (velNodeDataNextCount > 0) {
+        velNodeDataRead = std::async(std::launch::async, &fast::OpenFAST::readVelocityDataChunk, this, velNodeDataReadFile, velNodeDataNextStart, velNodeDataNextCount, std::ref(velNodeDataNext));
+    }
+}
+
+void fast::OpenFAST::endVelocityDataStream() {
+
+    if (velNodeDataRead.valid()) velNodeDataRead.get();
+    H5Fclose(velNodeDataReadFile);
+
+    // The velocity data is not needed anymore
+    std::vector<double>().swap(velNodeData);
+    std::vector<double>().swap(velNodeDataNext);
+}
+
 hid_t fast::OpenFAST::openVelocityDataFile(bool createFile) {
 
     hid_t velDataFile;
@@ -957,11 +1562,33 @@ hid_t fast::OpenFAST::openVelocityDataFile(bool createFile) {
         velDataFile = H5Fopen(("velDatafile." + std::to_string(worldMPIRank) + ".h5").c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
     }
 
+    // Keep the data sets open until the file is closed
+    velNodeDataSets.resize(nTurbinesProc);
+    for (int iTurb = 0; iTurb < nTurbinesProc; iTurb++) {
+        velNodeDataSets[iTurb] = H5Dopen2(velDataFile, ("/turbine" + std::to_string(iTurb)).c_str(), H5P_DEFAULT);
+    }
+
+    velDataBuffer.resize(nStepsVelDataBuffer * get_numVelPtsProc() * 6);
+    velDataFlushBuffer.resize(nStepsVelDataBuffer * get_numVelPtsProc() * 6);
+    velDataBufferStart.assign(nTurbinesProc, 0);
+    velDataBufferCount.assign(nTurbinesProc, 0);
+    velDataFlushStart.assign(nTurbinesProc, 0);
+    velDataFlushCount.assign(nTurbinesProc, 0);
+
     return velDataFile;
 
 }
 
 herr_t fast::OpenFAST::closeVelocityDataFile(int nt_global, hid_t velDataFile) {
+    // Write out all buffered data before closing the file
+    flushVelocityData();
+    waitVelocityDataFlush();
+
+    for (size_t iTurb = 0; iTurb < velNodeDataSets.size(); iTurb++) {
+        H5Dclose(velNodeDataSets[iTurb]);
+    }
+    velNodeDataSets.clear();
+
     herr_t status = H5Fclose(velDataFile) ;
     return status;
 }
@@ -970,65 +1597,154 @@ void fast::OpenFAST::backupVelocityDataFile(int curTimeStep, hid_t & velDataFile
 
     closeVelocityDataFile(curTimeStep, velDataFile);
 
+    copyVelocityDataFile(curTimeStep);
+
+    velDataFile = openVelocityDataFile(false);
+}
+
+void fast::OpenFAST::backupVelocityDataFileAsync(int curTimeStep) {
+
+    // Hand over the buffered velocity data to the background writer and back up the file once the
+    // data is written. The file is flushed instead of closed, so the time loop can keep buffering.
+    // Without a thread safe HDF-5 library, this is all done right away.
+    waitVelocityDataFlush();
+    bool haveData = swapVelocityDataBuffers();
+    if (!velDataFlushAsync) {
+        writeAndBackupVelocityData(curTimeStep, haveData);
+        return;
+    }
+    velDataFlush = std::async(std::launch::async, &fast::OpenFAST::writeAndBackupVelocityData, this, curTimeStep, haveData);
+}
+
+void fast::OpenFAST::writeAndBackupVelocityData(int curTimeStep, bool writeData) {
+
+    if (writeData) writeVelocityDataFlushBuffer();
+    H5Fflush(velNodeDataFile, H5F_SCOPE_GLOBAL);
+    copyVelocityDataFile(curTimeStep);
+}
+
+void fast::OpenFAST::copyVelocityDataFile(int curTimeStep) {
+
     std::ifstream source("velDatafile." + std::to_string(worldMPIRank) + ".h5", std::ios::binary);
     std::ofstream dest("velDatafile." + std::to_string(worldMPIRank) + ".h5." + std::to_string(curTimeStep) + ".bak", std::ios::binary);
 
     dest << source.rdbuf();
     source.close();
     dest.close();
-
-    velDataFile = openVelocityDataFile(false);
 }
 
-void fast::OpenFAST::writeVelocityData(hid_t h5File, int iTurb, int iTimestep, OpFM_InputType_t iData, OpFM_OutputType_t oData) {
+void fast::OpenFAST::writeVelocityData(int iTurb, int iTimestep, OpFM_InputType_t iData, OpFM_OutputType_t oData) {
 
-    hsize_t start[3]; start[0] = iTimestep; start[1] = 0; start[2] = 0;
-    int nVelPts = get_numVelPtsLoc(iTurb) ;
-    hsize_t count[3]; count[0] = 1; count[1] = nVelPts; count[2] = 6;
+    // The data is accumulated in velDataBuffer and written to velNodeDataFile in the background every
+    // nStepsVelDataBuffer time steps. Write out the buffer first if it is full or if this time
+    // step does not follow the ones already in the buffer.
+    if ( (velDataBufferCount[iTurb] == nStepsVelDataBuffer) ||
+         ( (velDataBufferCount[iTurb] > 0) && (iTimestep != velDataBufferStart[iTurb] + velDataBufferCount[iTurb]) ) ) {
+        flushVelocityData();
+    }
 
-    std::vector<double> tmpVelData;
-    tmpVelData.resize(nVelPts * 6);
+    if (velDataBufferCount[iTurb] == 0) velDataBufferStart[iTurb] = iTimestep;
+
+    int nVelPts = get_numVelPtsLoc(iTurb) ;
+    double * velData = &velDataBuffer[(velDataBufferCount[iTurb] * get_numVelPtsProc() + velNodeOffset[iTurb]) * 6];
 
     for (int iNode=0 ; iNode < nVelPts; iNode++) {
-        tmpVelData[iNode*6 + 0] = iData.pxVel[iNode];
-        tmpVelData[iNode*6 + 1] = iData.pyVel[iNode];
-        tmpVelData[iNode*6 + 2] = iData.pzVel[iNode];
-        tmpVelData[iNode*6 + 3] = oData.u[iNode];
-        tmpVelData[iNode*6 + 4] = oData.v[iNode];
-        tmpVelData[iNode*6 + 5] = oData.w[iNode];
-    }
-
-    hid_t dset_id = H5Dopen2(h5File, ("/turbine" + std::to_string(iTurb)).c_str(), H5P_DEFAULT);
-    hid_t dspace_id = H5Dget_space(dset_id);
-    H5Sselect_hyperslab(dspace_id, H5S_SELECT_SET, start, NULL, count, NULL);
-    hid_t mspace_id = H5Screate_simple(3, count, NULL);
-    H5Dwrite(dset_id, H5T_NATIVE_DOUBLE, mspace_id, dspace_id, H5P_DEFAULT, tmpVelData.data());
-
-    H5Dclose(dset_id);
-    H5Sclose(dspace_id);
+        velData[iNode*6 + 0] = iData.pxVel[iNode];
+        velData[iNode*6 + 1] = iData.pyVel[iNode];
+        velData[iNode*6 + 2] = iData.pzVel[iNode];
+        velData[iNode*6 + 3] = oData.u[iNode];
+        velData[iNode*6 + 4] = oData.v[iNode];
+        velData[iNode*6 + 5] = oData.w[iNode];
+    }
+
+    velDataBufferCount[iTurb]++;
+}
+
+void fast::OpenFAST::flushVelocityData() {
+
+    // Start writing the velocity data accumulated so far in the background. Only one write is in
+    // flight at any time, so wait for the previous one to finish before handing over the buffer.
+    // Without a thread safe HDF-5 library, the data is written right away.
+    waitVelocityDataFlush();
+
+    if (!swapVelocityDataBuffers()) return;
+
+    if (!velDataFlushAsync) {
+        writeVelocityDataFlushBuffer();
+        return;
+    }
+    velDataFlush = std::async(std::launch::async, &fast::OpenFAST::writeVelocityDataFlushBuffer, this);
+}
+
+bool fast::OpenFAST::swapVelocityDataBuffers() {
+
+    // Move the velocity data accumulated so far to velDataFlushBuffer. Returns false if there is no data.
+    bool haveData = false;
+    for (size_t iTurb = 0; iTurb < velDataBufferCount.size(); iTurb++) {
+        if (velDataBufferCount[iTurb] > 0) haveData = true;
+    }
+    if (!haveData) return false;
+
+    velDataBuffer.swap(velDataFlushBuffer);
+    velDataBufferStart.swap(velDataFlushStart);
+    velDataBufferCount.swap(velDataFlushCount);
+    std::fill(velDataBufferCount.begin(), velDataBufferCount.end(), 0);
+
+    return true;
+}
+
+void fast::OpenFAST::waitVelocityDataFlush() {
+    if (velDataFlush.valid()) velDataFlush.get();
+}
+
+void fast::OpenFAST::writeVelocityDataFlushBuffer() {
+
+    // Write all time steps of each turbine in velDataFlushBuffer as one hyperslab
+    hsize_t mdims[3]; mdims[0] = nStepsVelDataBuffer; mdims[1] = get_numVelPtsProc(); mdims[2] = 6;
+    hid_t mspace_id = H5Screate_simple(3, mdims, NULL);
+
+    int lastTimestep = -1;
+    for (size_t iTurb = 0; iTurb < velDataFlushCount.size(); iTurb++) {
+        if (velDataFlushCount[iTurb] == 0) continue;
+
+        int nVelPts = get_numVelPtsLoc(iTurb) ;
+        hsize_t start[3]; start[0] = velDataFlushStart[iTurb]; start[1] = 0; start[2] = 0;
+        hsize_t count[3]; count[0] = velDataFlushCount[iTurb]; count[1] = nVelPts; count[2] = 6;
+
+        hid_t dspace_id = H5Dget_space(velNodeDataSets[iTurb]);
+        H5Sselect_hyperslab(dspace_id, H5S_SELECT_SET, start, NULL, count, NULL);
+
+        hsize_t mstart[3]; mstart[0] = 0; mstart[1] = velNodeOffset[iTurb]; mstart[2] = 0;
+        H5Sselect_hyperslab(mspace_id, H5S_SELECT_SET, mstart, NULL, count, NULL);
+        H5Dwrite(velNodeDataSets[iTurb], H5T_NATIVE_DOUBLE, mspace_id, dspace_id, H5P_DEFAULT, velDataFlushBuffer.data());
+
+        H5Sclose(dspace_id);
+
+        lastTimestep = std::max(lastTimestep, velDataFlushStart[iTurb] + velDataFlushCount[iTurb] - 1);
+    }
     H5Sclose(mspace_id);
 
-    hid_t attr_id = H5Aopen_by_name(h5File, ".", "nTimesteps", H5P_DEFAULT, H5P_DEFAULT);
-    herr_t status = H5Awrite(attr_id, H5T_NATIVE_INT, &iTimestep);
+    hid_t attr_id = H5Aopen_by_name(velNodeDataFile, ".", "nTimesteps", H5P_DEFAULT, H5P_DEFAULT);
+    herr_t status = H5Awrite(attr_id, H5T_NATIVE_INT, &lastTimestep);
     status = H5Aclose(attr_id);
 
 }
 
-void fast::OpenFAST::applyVelocityData(int iPrestart, int iTurb, OpFM_OutputType_t cDriver_Output_to_FAST, std::vector<double> & velData) {
+void fast::OpenFAST::applyVelocityData(int iPrestart, int iTurb, OpFM_OutputType_t cDriver_Output_to_FAST, const std::vector<double> & velData) {
     int nVelPts = get_numVelPtsLoc(iTurb);
+    const double * velTurb = &velData[(iPrestart*get_numVelPtsProc() + velNodeOffset[iTurb])*6];
     for (int j = 0; j < nVelPts; j++){
-        cDriver_Output_to_FAST.u[j] = velData[(iPrestart*nVelPts+j)*6 + 3];
-        cDriver_Output_to_FAST.v[j] = velData[(iPrestart*nVelPts+j)*6 + 4];
-        cDriver_Output_to_FAST.w[j] = velData[(iPrestart*nVelPts+j)*6 + 5];
+        cDriver_Output_to_FAST.u[j] = velTurb[j*6 + 3];
+        cDriver_Output_to_FAST.v[j] = velTurb[j*6 + 4];
+        cDriver_Output_to_FAST.w[j] = velTurb[j*6 + 5];
     }
 }
 
 void fast::OpenFAST::loadSuperController(const fast::fastInputs & fi) {
 
     if(fi.scStatus) {
-        std::cout << "Use of Supercontroller is not supported through the C++ API right now" << std::endl;
-        // scStatus = fi.scStatus;
-        // sc.load(fi.nTurbinesGlob, fi.scLibFile, scio);
+        scStatus = fi.scStatus;
+        sc.load(fi.nTurbinesGlob, fi.scLibFile, scio);
 
     } else {
         scStatus = false;
@@ -0,0 +1,133 @@
+#include "PhaseTimers.H"
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+
+fast::PhaseTimers::PhaseTimers():
+enabled(false),
+trace(false),
+traceStep(-1),
+nTurbinesGlob(0)
+{
+}
+
+int fast::PhaseTimers::addTimer(const std::string & name, bool perTurbine) {
+
+    timerName.push_back(name);
+    timerPerTurbine.push_back(perTurbine);
+    timerTime.push_back(0.0);
+    timerCount.push_back(0);
+    timerStepTime.push_back(0.0);
+    timerTurbineTime.push_back(std::vector<double>(perTurbine ? nTurbinesGlob : 0, 0.0));
+
+    return timerName.size() - 1;
+}
+
+void fast::PhaseTimers::setTurbines(int nTurbines) {
+
+    nTurbinesGlob = nTurbines;
+    for (size_t iTimer = 0; iTimer < timerName.size(); iTimer++) {
+        if (timerPerTurbine[iTimer]) timerTurbineTime[iTimer].assign(nTurbinesGlob, 0.0);
+    }
+}
+
+void fast::PhaseTimers::enableTrace(const std::string & traceFileName) {
+
+    traceFile.open(traceFileName);
+    if (!traceFile) {
+        throw std::runtime_error("Cannot open timer trace file " + traceFileName);
+    }
+    traceFile << "step";
+    for (size_t iTimer = 0; iTimer < timerName.size(); iTimer++) traceFile << "," << timerName[iTimer];
+    traceFile << std::endl;
+    trace = true;
+}
+
+void fast::PhaseTimers::writeTraceStep(int iNextStep) {
+
+    if (traceStep >= 0) {
+        traceFile << traceStep;
+        for (size_t iTimer = 0; iTimer < timerName.size(); iTimer++) {
+            traceFile << "," << timerStepTime[iTimer];
+            timerStepTime[iTimer] = 0.0;
+        }
+        traceFile << "\n";
+    }
+    traceStep = iNextStep;
+}
+
+void fast::PhaseTimers::writeSummary(MPI_Comm comm, const std::string & fileRoot) {
+
+    if (trace) {
+        writeTraceStep(-1);
+        traceFile.close();
+        trace = false;
+    }
+
+    int rank, nProcs;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &nProcs);
+
+    int nTimers = timerName.size();
+    std::vector<double> timeMin(nTimers), timeMax(nTimers), timeSum(nTimers);
+    std::vector<long> countMax(nTimers);
+    MPI_Reduce(timerTime.data(), timeMin.data(), nTimers, MPI_DOUBLE, MPI_MIN, 0, comm);
+    MPI_Reduce(timerTime.data(), timeMax.data(), nTimers, MPI_DOUBLE, MPI_MAX, 0, comm);
+    MPI_Reduce(timerTime.data(), timeSum.data(), nTimers, MPI_DOUBLE, MPI_SUM, 0, comm);
+    MPI_Reduce(timerCount.data(), countMax.data(), nTimers, MPI_LONG, MPI_MAX, 0, comm);
+
+    // Each turbine runs on one processor only, so the sum over all processors is the time of the turbine
+    std::vector<std::vector<double> > turbineTime(nTimers);
+    for (int iTimer = 0; iTimer < nTimers; iTimer++) {
+        if (!timerPerTurbine[iTimer]) continue;
+        turbineTime[iTimer].resize(nTurbinesGlob);
+        MPI_Reduce(timerTurbineTime[iTimer].data(), turbineTime[iTimer].data(), nTurbinesGlob, MPI_DOUBLE, MPI_SUM, 0, comm);
+    }
+
+    if (rank != 0) return;
+
+    std::ofstream jsonFile(fileRoot + ".json");
+    jsonFile.precision(9);
+    jsonFile << "{" << std::endl;
+    jsonFile << "  \"nProcs\": " << nProcs << "," << std::endl;
+    jsonFile << "  \"phases\": [" << std::endl;
+    for (int iTimer = 0; iTimer < nTimers; iTimer++) {
+        jsonFile << "    {\"name\": \"" << timerName[iTimer] << "\", \"calls\": " << countMax[iTimer]
+                 << ", \"min\": " << timeMin[iTimer] << ", \"max\": " << timeMax[iTimer]
+                 << ", \"mean\": " << timeSum[iTimer]/nProcs << "}" << (iTimer < nTimers - 1 ? "," : "") << std::endl;
+    }
+    jsonFile << "  ]," << std::endl;
+    jsonFile << "  \"turbines\": [" << std::endl;
+    for (int iTurb = 0; iTurb < nTurbinesGlob; iTurb++) {
+        jsonFile << "    {\"turbine\": " << iTurb;
+        for (int iTimer = 0; iTimer < nTimers; iTimer++) {
+            if (timerPerTurbine[iTimer]) jsonFile << ", \"" << timerName[iTimer] << "\": " << turbineTime[iTimer][iTurb];
+        }
+        jsonFile << "}" << (iTurb < nTurbinesGlob - 1 ? "," : "") << std::endl;
+    }
+    jsonFile << "  ]" << std::endl;
+    jsonFile << "}" << std::endl;
+    jsonFile.close();
+
+    std::ofstream csvFile(fileRoot + ".csv");
+    csvFile.precision(9);
+    csvFile << "# phase, calls, min (s), max (s), mean (s) over " << nProcs << " procs" << std::endl;
+    for (int iTimer = 0; iTimer < nTimers; iTimer++) {
+        csvFile << timerName[iTimer] << ", " << countMax[iTimer] << ", " << timeMin[iTimer] << ", " << timeMax[iTimer] << ", " << timeSum[iTimer]/nProcs << std::endl;
+    }
+    csvFile << "# turbine";
+    for (int iTimer = 0; iTimer < nTimers; iTimer++) {
+        if (timerPerTurbine[iTimer]) csvFile << ", " << timerName[iTimer] << " (s)";
+    }
+    csvFile << std::endl;
+    for (int iTurb = 0; iTurb < nTurbinesGlob; iTurb++) {
+        csvFile << iTurb;
+        for (int iTimer = 0; iTimer < nTimers; iTimer++) {
+            if (timerPerTurbine[iTimer]) csvFile << ", " << turbineTime[iTimer][iTurb];
+        }
+        csvFile << std::endl;
+    }
+    csvFile.close();
+
+    std::cout << "Phase timers written to " << fileRoot << ".json and " << fileRoot << ".csv" << std::endl ;
+}
@@ -1,6 +1,12 @@
 #include "SC.h"
 
 SuperController::SuperController():
+fastMPIComm(MPI_COMM_NULL),
+fastMPIRank(0),
+nTurbinesProc(0),
+toSCRequest(MPI_REQUEST_NULL),
+toSCPending(false),
+toSCAdvancePending(false),
 nCtrl2SC(0),
 nSC2Ctrl(0),
 nInpGlobal(0),
@@ -27,7 +33,7 @@ void SuperController::load(int inNTurbinesGlob, std::string inScLibFile, scInitO
     // open the library
     scLibHandle = dlopen(scLibFile.c_str(), RTLD_LAZY);
     if (!scLibHandle) {
-        std::cerr << "Cannot open library: " << dlerror() << '\n';
+        throw std::runtime_error("Cannot open supercontroller library " + scLibFile + ": " + dlerror());
     }
     sc_library_loaded = true;
 
@@ -100,9 +106,10 @@ void SuperController::init(scInitOutData & scio, int nTurbinesProc) {
     ip_from_FAST.resize(nTurbinesProc) ;
     op_to_FAST.resize(nTurbinesProc) ;
 
-    scio.nSC2CtrlGlob = 0;
-    scio.nSC2Ctrl = 0;
-    scio.nCtrl2SC = 0;
+    // These are zero unless the supercontroller library was loaded
+    scio.nSC2CtrlGlob = nSC2CtrlGlob;
+    scio.nSC2Ctrl = nSC2Ctrl;
+    scio.nCtrl2SC = nCtrl2SC;
 
     scio.from_SCglob.resize(nSC2CtrlGlob);
     scio.from_SC.resize(nTurbinesProc);
@@ -115,10 +122,42 @@ void SuperController::init_sc(scInitOutData & scio, int inNTurbinesProc, std::ma
 
     fastMPIComm = inFastMPIComm;
     nTurbinesProc = inNTurbinesProc;
-    turbineMapProcToGlob = iTurbineMapProcToGlob;
+    turbineGlob.resize(nTurbinesProc);
+    for (int iTurb = 0 ; iTurb < nTurbinesProc; iTurb++) {
+        turbineGlob[iTurb] = iTurbineMapProcToGlob[iTurb];
+    }
+    turbineGlobSorted = turbineGlob;
+    std::sort(turbineGlobSorted.begin(), turbineGlobSorted.end());
 
     if (nTurbinesProc > 0) {
 
+        MPI_Comm_rank(fastMPIComm, &fastMPIRank);
+
+        // Set up the sparse exchange of the inputs to the supercontroller
+        int nProcs;
+        MPI_Comm_size(fastMPIComm, &nProcs);
+        std::vector<int> nTurbines(nProcs);
+        MPI_Allgather(&nTurbinesProc, 1, MPI_INT, nTurbines.data(), 1, MPI_INT, fastMPIComm);
+
+        std::vector<int> turbineDispls(nProcs);
+        gatherCounts.resize(nProcs);
+        gatherDispls.resize(nProcs);
+        int nTurbinesGathered = 0;
+        for (int iProc = 0; iProc < nProcs; iProc++) {
+            turbineDispls[iProc] = nTurbinesGathered;
+            gatherCounts[iProc] = nTurbines[iProc]*nCtrl2SC;
+            gatherDispls[iProc] = nTurbinesGathered*nCtrl2SC;
+            nTurbinesGathered += nTurbines[iProc];
+        }
+        if (nTurbinesGathered != nTurbinesGlob) {
+            throw std::runtime_error("Supercontroller: The number of turbines on all processors is not equal to nTurbinesGlob");
+        }
+        gatherTurbGlob.resize(nTurbinesGlob);
+        MPI_Allgatherv(turbineGlob.data(), nTurbinesProc, MPI_INT, gatherTurbGlob.data(), nTurbines.data(), turbineDispls.data(), MPI_INT, fastMPIComm);
+
+        to_SC_send.resize(nTurbinesProc*nCtrl2SC);
+        to_SC_gathered.resize(nTurbinesGlob*nCtrl2SC);
+
         paramGlobal.resize(nParamGlobal);
         paramTurbine.resize(nTurbinesGlob*nParamTurbine);
 
@@ -152,7 +191,7 @@ void SuperController::init_sc(scInitOutData & scio, int inNTurbinesProc, std::ma
 
         for (int iTurb = 0 ; iTurb < nTurbinesProc; iTurb++) {
             for(int i=0; i < nSC2Ctrl; i++) {
-                scio.from_SC[iTurb][i] = from_SC_nm1[turbineMapProcToGlob[iTurb]*nSC2Ctrl + i];
+                scio.from_SC[iTurb][i] = from_SC_nm1[turbineGlob[iTurb]*nSC2Ctrl + i];
             }
         }
 
@@ -162,6 +201,8 @@ void SuperController::init_sc(scInitOutData & scio, int inNTurbinesProc, std::ma
 
 void SuperController::calcOutputs_n(double t) {
 
+    completeInputExchange();
+
     if (nTurbinesProc > 0) {
         sc_calcOutputs(&t, &nTurbinesGlob, &nParamGlobal, paramGlobal.data(), &nParamTurbine, paramTurbine.data(), &nInpGlobal, to_SCglob_n.data(), &nCtrl2SC, to_SC_n.data(), &nStatesGlobal, globStates.data(), &nStatesTurbine, turbineStates.data(), &nSC2CtrlGlob, from_SCglob_n.data(), &nSC2Ctrl, from_SC_n.data(), &ErrStat, ErrMsg);
     }
@@ -170,6 +211,8 @@ void SuperController::calcOutputs_n(double t) {
 
 void SuperController::calcOutputs_np1(double t) {
 
+    completeInputExchange();
+
     if (nTurbinesProc > 0) {
         sc_calcOutputs(&t, &nTurbinesGlob, &nParamGlobal, paramGlobal.data(), &nParamTurbine, paramTurbine.data(), &nInpGlobal, to_SCglob_n.data(), &nCtrl2SC, to_SC_n.data(), &nStatesGlobal, globStates_np1.data(), &nStatesTurbine, turbineStates_np1.data(), &nSC2CtrlGlob, from_SCglob_np1.data(), &nSC2Ctrl, from_SC_np1.data(), &ErrStat, ErrMsg);
     }
@@ -178,85 +221,183 @@ void SuperController::calcOutputs_np1(double t) {
 
 void SuperController::updateStates(double t) {
 
+    completeInputExchange();
+
     if (nTurbinesProc > 0) {
         sc_updateStates(&t, &nTurbinesGlob, &nParamGlobal, paramGlobal.data(), &nParamTurbine, paramTurbine.data(), &nInpGlobal, to_SCglob_n.data(), &nCtrl2SC, to_SC_n.data(), &nStatesGlobal, globStates.data(), globStates_np1.data(), &nStatesTurbine, turbineStates.data(), turbineStates_np1.data(), &ErrStat, ErrMsg);
     }
 
 }
 
-int SuperController::readRestartFile(int n_t_global) {
+hid_t SuperController::openRestartFile(int n_t_global, bool create) {
 
-    if (nTurbinesProc > 0) {
+    std::string fileName = restartFileName(n_t_global);
 
-        hid_t restartFile = H5Fopen(("sc" + std::to_string(n_t_global) + ".chkp.h5").c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+    hid_t accessPlist = H5Pcreate(H5P_FILE_ACCESS);
+#ifdef H5_HAVE_PARALLEL
+    H5Pset_fapl_mpio(accessPlist, fastMPIComm, MPI_INFO_NULL);
+#endif
+    hid_t restartFile;
+    if (create) {
+        restartFile = H5Fcreate(fileName.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, accessPlist);
+    } else {
+        restartFile = H5Fopen(fileName.c_str(), H5F_ACC_RDONLY, accessPlist);
+    }
+    H5Pclose(accessPlist);
 
-        {
-            hid_t attr = H5Aopen(restartFile, "nTurbinesGlob", H5P_DEFAULT);
-            herr_t ret = H5Aread(attr, H5T_NATIVE_INT, &nTurbinesGlob) ;
-            H5Aclose(attr);
+    return restartFile;
+}
 
-            attr = H5Aopen(restartFile, "nCtrl2SC", H5P_DEFAULT);
-            ret = H5Aread(attr, H5T_NATIVE_INT, &nCtrl2SC) ;
-            H5Aclose(attr);
+hid_t SuperController::createRestartHeaderType() {
 
-            attr = H5Aopen(restartFile, "nSC2Ctrl", H5P_DEFAULT);
-            ret = H5Aread(attr, H5T_NATIVE_INT, &nSC2Ctrl) ;
-            H5Aclose(attr);
+    hid_t headerType = H5Tcreate(H5T_COMPOUND, sizeof(scRestartHeader));
+    H5Tinsert(headerType, "version", HOFFSET(scRestartHeader, version), H5T_NATIVE_INT);
+    H5Tinsert(headerType, "n_t_global", HOFFSET(scRestartHeader, n_t_global), H5T_NATIVE_INT);
+    H5Tinsert(headerType, "nTurbinesGlob", HOFFSET(scRestartHeader, nTurbinesGlob), H5T_NATIVE_INT);
+    H5Tinsert(headerType, "nCtrl2SC", HOFFSET(scRestartHeader, nCtrl2SC), H5T_NATIVE_INT);
+    H5Tinsert(headerType, "nSC2Ctrl", HOFFSET(scRestartHeader, nSC2Ctrl), H5T_NATIVE_INT);
+    H5Tinsert(headerType, "nInpGlobal", HOFFSET(scRestartHeader, nInpGlobal), H5T_NATIVE_INT);
+    H5Tinsert(headerType, "nSC2CtrlGlob", HOFFSET(scRestartHeader, nSC2CtrlGlob), H5T_NATIVE_INT);
+    H5Tinsert(headerType, "nStatesGlobal", HOFFSET(scRestartHeader, nStatesGlobal), H5T_NATIVE_INT);
+    H5Tinsert(headerType, "nStatesTurbine", HOFFSET(scRestartHeader, nStatesTurbine), H5T_NATIVE_INT);
 
-            attr = H5Aopen(restartFile, "nInpGlobal", H5P_DEFAULT);
-            ret = H5Aread(attr, H5T_NATIVE_INT, &nInpGlobal) ;
-            H5Aclose(attr);
+    return headerType;
+}
 
-            attr = H5Aopen(restartFile, "nSC2CtrlGlob", H5P_DEFAULT);
-            ret = H5Aread(attr, H5T_NATIVE_INT, &nSC2CtrlGlob) ;
-            H5Aclose(attr);
+hid_t SuperController::createRestartXferPlist() {
 
-            attr = H5Aopen(restartFile, "nStatesGlobal", H5P_DEFAULT);
-            ret = H5Aread(attr, H5T_NATIVE_INT, &nStatesGlobal) ;
-            H5Aclose(attr);
+    hid_t xferPlist = H5Pcreate(H5P_DATASET_XFER);
+#ifdef H5_HAVE_PARALLEL
+    H5Pset_dxpl_mpio(xferPlist, H5FD_MPIO_COLLECTIVE);
+#endif
+    return xferPlist;
+}
 
-            globStates.resize(nStatesGlobal);
-            globStates_np1.resize(nStatesGlobal);
+void SuperController::writeRestartData(hid_t restartFile, hid_t xferPlist, const char * name, const float * data, int n) {
 
-            attr = H5Aopen(restartFile, "nStatesTurbine", H5P_DEFAULT);
-            ret = H5Aread(attr, H5T_NATIVE_INT, &nStatesTurbine) ;
-            H5Aclose(attr);
+    if (n == 0) return;
 
-            turbineStates.resize(nTurbinesGlob*nStatesTurbine);
-            turbineStates_np1.resize(nTurbinesGlob*nStatesTurbine);
+    hsize_t dims[1];
+    dims[0] = n;
+    hid_t fileSpace = H5Screate_simple(1, dims, NULL);
+    hid_t memSpace = H5Screate_simple(1, dims, NULL);
+    hid_t dataSet = H5Dcreate2(restartFile, name, H5T_NATIVE_FLOAT, fileSpace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
 
-#ifdef DEBUG
-            std::cout << "nTurbinesGlob = " << nTurbinesGlob << std::endl ;
-            std::cout << "nCtrl2SC = " << nCtrl2SC << std::endl ;
-            std::cout << "nSC2Ctrl = " << nSC2Ctrl << std::endl ;
-            std::cout << "nInpGlobal = " << nInpGlobal << std::endl ;
-            std::cout << "nSC2CtrlGlob = " << nSC2CtrlGlob << std::endl ;
-            std::cout << "nStatesGlobal = " << nStatesGlobal << std::endl ;
-            std::cout << "nStatesTurbine = " << nStatesTurbine << std::endl ;
+    // The global data is the same on all processors and is written by the first one
+    if (fastMPIRank != 0) {
+        H5Sselect_none(fileSpace);
+        H5Sselect_none(memSpace);
+    }
+    herr_t status = H5Dwrite(dataSet, H5T_NATIVE_FLOAT, memSpace, fileSpace, xferPlist, data);
+
+    status = H5Dclose(dataSet);
+    status = H5Sclose(memSpace);
+    status = H5Sclose(fileSpace);
+}
+
+void SuperController::writeRestartTurbineData(hid_t restartFile, hid_t xferPlist, const char * name, const float * data, int nPerTurbine) {
+
+    if (nPerTurbine == 0) return;
+
+    hsize_t dims[2];
+    dims[0] = nTurbinesGlob;
+    dims[1] = nPerTurbine;
+    hid_t fileSpace = H5Screate_simple(2, dims, NULL);
+    hid_t dataSet = H5Dcreate2(restartFile, name, H5T_NATIVE_FLOAT, fileSpace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+
+#ifdef H5_HAVE_PARALLEL
+    // Each processor writes the rows of its own turbines. The selected rows are transferred in increasing
+    // order of the global turbine index, so they are packed in the order of turbineGlobSorted.
+    std::vector<float> turbineData(nTurbinesProc*nPerTurbine);
+    for (int i=0; i < nTurbinesProc; i++) {
+        int iTurbGlob = turbineGlobSorted[i];
+        std::copy(data + iTurbGlob*nPerTurbine, data + (iTurbGlob+1)*nPerTurbine, turbineData.begin() + i*nPerTurbine);
+
+        hsize_t start[2]; start[0] = iTurbGlob; start[1] = 0;
+        hsize_t count[2]; count[0] = 1; count[1] = nPerTurbine;
+        H5Sselect_hyperslab(fileSpace, (i == 0) ? H5S_SELECT_SET : H5S_SELECT_OR, start, NULL, count, NULL);
+    }
+    dims[0] = nTurbinesProc;
+    hid_t memSpace = H5Screate_simple(2, dims, NULL);
+    herr_t status = H5Dwrite(dataSet, H5T_NATIVE_FLOAT, memSpace, fileSpace, xferPlist, turbineData.data());
+    status = H5Sclose(memSpace);
+#else
+    herr_t status = H5Dwrite(dataSet, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, xferPlist, data);
 #endif
 
-        }
+    status = H5Dclose(dataSet);
+    status = H5Sclose(fileSpace);
+}
 
-        if (nStatesGlobal > 0) {
-            hid_t dataSet = H5Dopen2(restartFile, "/globStates", H5P_DEFAULT);
-            herr_t status = H5Dread(dataSet, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, globStates.data());
-            status = H5Dclose(dataSet);
+void SuperController::readRestartData(hid_t restartFile, hid_t xferPlist, const char * name, float * data, int n) {
 
-            dataSet = H5Dopen2(restartFile, "/globStates_np1", H5P_DEFAULT);
-            status = H5Dread(dataSet, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, globStates_np1.data());
-            status = H5Dclose(dataSet);
-        }
+    if (n == 0) return;
 
-        if (nStatesTurbine > 0) {
-            hid_t dataSet = H5Dopen2(restartFile, "turbineStates", H5P_DEFAULT);
-            herr_t status = H5Dread(dataSet, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, turbineStates.data());
-            status = H5Dclose(dataSet);
+#ifndef H5_HAVE_PARALLEL
+    if (fastMPIRank == 0) {
+#endif
+        hid_t dataSet = H5Dopen2(restartFile, name, H5P_DEFAULT);
+        herr_t status = H5Dread(dataSet, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, xferPlist, data);
+        status = H5Dclose(dataSet);
+#ifndef H5_HAVE_PARALLEL
+    }
+    MPI_Bcast(data, n, MPI_FLOAT, 0, fastMPIComm);
+#endif
+}
 
-            dataSet = H5Dopen2(restartFile, "turbineStates_np1", H5P_DEFAULT);
-            status = H5Dread(dataSet, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, turbineStates_np1.data());
-            status = H5Dclose(dataSet);
+int SuperController::readRestartFile(int n_t_global) {
+
+    // With parallel HDF5, all processors with turbines open the file and read all data collectively, because
+    // each of them evaluates the supercontroller for all turbines. Otherwise, the first processor reads the
+    // file and broadcasts the data.
+    if (nTurbinesProc > 0) {
+
+        scRestartHeader header = {};
+        hid_t restartFile = -1;
+        hid_t xferPlist = createRestartXferPlist();
+        hid_t headerType = createRestartHeaderType();
+
+#ifndef H5_HAVE_PARALLEL
+        if (fastMPIRank == 0) {
+#endif
+            restartFile = openRestartFile(n_t_global, false);
+            if ( (restartFile >= 0) && (H5Lexists(restartFile, "header", H5P_DEFAULT) > 0) ) {
+                hid_t dataSet = H5Dopen2(restartFile, "header", H5P_DEFAULT);
+                herr_t status = H5Dread(dataSet, headerType, H5S_ALL, H5S_ALL, xferPlist, &header);
+                status = H5Dclose(dataSet);
+            }
+#ifndef H5_HAVE_PARALLEL
+        }
+        MPI_Bcast(&header, sizeof(scRestartHeader), MPI_BYTE, 0, fastMPIComm);
+#endif
+        H5Tclose(headerType);
+
+        std::string fileName = restartFileName(n_t_global);
+        if (header.version != scRestartFileVersion) {
+            throw std::runtime_error("Supercontroller restart file " + fileName + " does not exist or has version " + std::to_string(header.version) + " instead of " + std::to_string(scRestartFileVersion));
+        }
+        if ( (header.n_t_global != n_t_global) || (header.nTurbinesGlob != nTurbinesGlob) || (header.nCtrl2SC != nCtrl2SC) || (header.nSC2Ctrl != nSC2Ctrl) || (header.nInpGlobal != nInpGlobal) || (header.nSC2CtrlGlob != nSC2CtrlGlob) || (header.nStatesGlobal != nStatesGlobal) || (header.nStatesTurbine != nStatesTurbine) ) {
+            throw std::runtime_error("Supercontroller restart file " + fileName + " does not match the time step or the sizes of the supercontroller library");
         }
 
+#ifdef DEBUG
+        std::cout << "nTurbinesGlob = " << nTurbinesGlob << std::endl ;
+        std::cout << "nCtrl2SC = " << nCtrl2SC << std::endl ;
+        std::cout << "nSC2Ctrl = " << nSC2Ctrl << std::endl ;
+        std::cout << "nInpGlobal = " << nInpGlobal << std::endl ;
+        std::cout << "nSC2CtrlGlob = " << nSC2CtrlGlob << std::endl ;
+        std::cout << "nStatesGlobal = " << nStatesGlobal << std::endl ;
+        std::cout << "nStatesTurbine = " << nStatesTurbine << std::endl ;
+#endif
+
+        readRestartData(restartFile, xferPlist, "globStates", globStates.data(), nStatesGlobal);
+        readRestartData(restartFile, xferPlist, "globStates_np1", globStates_np1.data(), nStatesGlobal);
+        readRestartData(restartFile, xferPlist, "turbineStates", turbineStates.data(), nTurbinesGlob*nStatesTurbine);
+        readRestartData(restartFile, xferPlist, "turbineStates_np1", turbineStates_np1.data(), nTurbinesGlob*nStatesTurbine);
+        readRestartData(restartFile, xferPlist, "to_SC_n", to_SC_n.data(), nTurbinesGlob*nCtrl2SC);
+        readRestartData(restartFile, xferPlist, "from_SC_n", from_SC_n.data(), nTurbinesGlob*nSC2Ctrl);
+        readRestartData(restartFile, xferPlist, "from_SCglob_n", from_SCglob_n.data(), nSC2CtrlGlob);
+
 #ifdef DEBUG
         for(int iTurb=0; iTurb < nTurbinesGlob; iTurb++) {
             for(int i=0; i < nStatesTurbine; i++) {
@@ -265,7 +406,8 @@ int SuperController::readRestartFile(int n_t_global) {
             }
         }
 #endif
-        herr_t status = H5Fclose(restartFile);
+        H5Pclose(xferPlist);
+        if (restartFile >= 0) H5Fclose(restartFile);
     }
 
     return 0;
@@ -274,100 +416,61 @@ int SuperController::readRestartFile(int n_t_global) {
 
 int SuperController::writeRestartFile(int n_t_global) {
 
-  /* // HDF5 stuff to write states to restart file or read back from it */
-
+    // All processors with turbines write one shared file. With parallel HDF5, each processor writes the rows of
+    // its own turbines and the first processor writes the header and the global data. Otherwise, the first
+    // processor writes everything, since it holds the data of all turbines too.
     if (nTurbinesProc > 0) {
 
-        hid_t restartFile = H5Fcreate(("sc" + std::to_string(n_t_global) + ".chkp.h5").c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+        // The inputs at time step 'n' are part of the restart data
+        completeInputExchange();
 
-        {
-            hsize_t dims[1];
-            dims[0] = 1;
-            hid_t dataSpace = H5Screate_simple(1, dims, NULL);
-            hid_t attr = H5Acreate2(restartFile, "nTurbinesGlob", H5T_NATIVE_INT, dataSpace, H5P_DEFAULT, H5P_DEFAULT) ;
-            herr_t status = H5Awrite(attr, H5T_NATIVE_INT, &nTurbinesGlob);
-            status = H5Aclose(attr);
-            status = H5Sclose(dataSpace);
-
-            dataSpace = H5Screate_simple(1, dims, NULL);
-            attr = H5Acreate2(restartFile, "nCtrl2SC", H5T_NATIVE_INT, dataSpace, H5P_DEFAULT, H5P_DEFAULT) ;
-            status = H5Awrite(attr, H5T_NATIVE_INT, &nCtrl2SC);
-            status = H5Aclose(attr);
-            status = H5Sclose(dataSpace);
-
-            dataSpace = H5Screate_simple(1, dims, NULL);
-            attr = H5Acreate2(restartFile, "nSC2Ctrl", H5T_NATIVE_INT, dataSpace, H5P_DEFAULT, H5P_DEFAULT) ;
-            status = H5Awrite(attr, H5T_NATIVE_INT, &nSC2Ctrl);
-            status = H5Aclose(attr);
-            status = H5Sclose(dataSpace);
-
-            dataSpace = H5Screate_simple(1, dims, NULL);
-            attr = H5Acreate2(restartFile, "nInpGlobal", H5T_NATIVE_INT, dataSpace, H5P_DEFAULT, H5P_DEFAULT) ;
-            status = H5Awrite(attr, H5T_NATIVE_INT, &nInpGlobal);
-            status = H5Aclose(attr);
-            status = H5Sclose(dataSpace);
-
-            dataSpace = H5Screate_simple(1, dims, NULL);
-            attr = H5Acreate2(restartFile, "nSC2CtrlGlob", H5T_NATIVE_INT, dataSpace, H5P_DEFAULT, H5P_DEFAULT) ;
-            status = H5Awrite(attr, H5T_NATIVE_INT, &nSC2CtrlGlob);
-            status = H5Aclose(attr);
-            status = H5Sclose(dataSpace);
-
-            dataSpace = H5Screate_simple(1, dims, NULL);
-            attr = H5Acreate2(restartFile, "nStatesGlobal", H5T_NATIVE_INT, dataSpace, H5P_DEFAULT, H5P_DEFAULT) ;
-            status = H5Awrite(attr, H5T_NATIVE_INT, &nStatesGlobal);
-            status = H5Aclose(attr);
-            status = H5Sclose(dataSpace);
-
-            dataSpace = H5Screate_simple(1, dims, NULL);
-            attr = H5Acreate2(restartFile, "nStatesTurbine", H5T_NATIVE_INT, dataSpace, H5P_DEFAULT, H5P_DEFAULT) ;
-            status = H5Awrite(attr, H5T_NATIVE_INT, &nStatesTurbine);
-            status = H5Aclose(attr);
-            status = H5Sclose(dataSpace);
+#ifndef H5_HAVE_PARALLEL
+        if (fastMPIRank != 0) return 0;
+#endif
 
+        hid_t restartFile = openRestartFile(n_t_global, true);
+        if (restartFile < 0) {
+            throw std::runtime_error("Cannot create supercontroller restart file " + restartFileName(n_t_global));
         }
+        hid_t xferPlist = createRestartXferPlist();
 
-        if (nStatesGlobal > 0) {
-            hsize_t dims[1];
-            dims[0] = nStatesGlobal;
-            hid_t dataSpace = H5Screate_simple(1, dims, NULL);
-            hid_t dataSet = H5Dcreate2(restartFile, "/globStates", H5T_NATIVE_FLOAT, dataSpace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
-            herr_t status = H5Dwrite(dataSet, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, globStates.data());
-
-            status = H5Dclose(dataSet);
-            status = H5Sclose(dataSpace);
-
-            dataSpace = H5Screate_simple(1, dims, NULL);
-            dataSet = H5Dcreate2(restartFile, "/globStates_np1", H5T_NATIVE_FLOAT, dataSpace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
-            status = H5Dwrite(dataSet, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, globStates_np1.data());
+        {
+            scRestartHeader header;
+            header.version = scRestartFileVersion;
+            header.n_t_global = n_t_global;
+            header.nTurbinesGlob = nTurbinesGlob;
+            header.nCtrl2SC = nCtrl2SC;
+            header.nSC2Ctrl = nSC2Ctrl;
+            header.nInpGlobal = nInpGlobal;
+            header.nSC2CtrlGlob = nSC2CtrlGlob;
+            header.nStatesGlobal = nStatesGlobal;
+            header.nStatesTurbine = nStatesTurbine;
+
+            hid_t headerType = createRestartHeaderType();
+            hid_t fileSpace = H5Screate(H5S_SCALAR);
+            hid_t memSpace = H5Screate(H5S_SCALAR);
+            hid_t dataSet = H5Dcreate2(restartFile, "header", headerType, fileSpace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+            if (fastMPIRank != 0) {
+                H5Sselect_none(fileSpace);
+                H5Sselect_none(memSpace);
+            }
+            herr_t status = H5Dwrite(dataSet, headerType, memSpace, fileSpace, xferPlist, &header);
 
             status = H5Dclose(dataSet);
-            status = H5Sclose(dataSpace);
-
-
+            status = H5Sclose(memSpace);
+            status = H5Sclose(fileSpace);
+            status = H5Tclose(headerType);
         }
 
-        if (nStatesTurbine > 0) {
-
-            hsize_t dims[2];
-            dims[0] = nTurbinesGlob;
-            dims[1] = nStatesTurbine;
-
-            hid_t dataSpace = H5Screate_simple(2, dims, NULL);
-            hid_t dataSet = H5Dcreate2(restartFile, "turbineStates", H5T_NATIVE_FLOAT, dataSpace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
-            herr_t status = H5Dwrite(dataSet, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, turbineStates.data());
-
-            status = H5Dclose(dataSet);
-            status = H5Sclose(dataSpace);
-
-            dataSpace = H5Screate_simple(2, dims, NULL);
-            dataSet = H5Dcreate2(restartFile, "turbineStates_np1", H5T_NATIVE_FLOAT, dataSpace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
-            status = H5Dwrite(dataSet, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, turbineStates_np1.data());
-
-            status = H5Dclose(dataSet);
-            status = H5Sclose(dataSpace);
-        }
+        writeRestartData(restartFile, xferPlist, "globStates", globStates.data(), nStatesGlobal);
+        writeRestartData(restartFile, xferPlist, "globStates_np1", globStates_np1.data(), nStatesGlobal);
+        writeRestartTurbineData(restartFile, xferPlist, "turbineStates", turbineStates.data(), nStatesTurbine);
+        writeRestartTurbineData(restartFile, xferPlist, "turbineStates_np1", turbineStates_np1.data(), nStatesTurbine);
+        writeRestartTurbineData(restartFile, xferPlist, "to_SC_n", to_SC_n.data(), nCtrl2SC);
+        writeRestartTurbineData(restartFile, xferPlist, "from_SC_n", from_SC_n.data(), nSC2Ctrl);
+        writeRestartData(restartFile, xferPlist, "from_SCglob_n", from_SCglob_n.data(), nSC2CtrlGlob);
 
+        H5Pclose(xferPlist);
         herr_t status = H5Fclose(restartFile);
     }
 
@@ -380,47 +483,81 @@ void SuperController::fastSCInputOutput() {
     // Transfers
     // to_SC_np1 <------ ip_from_FAST
     // op_to_FAST <------- from_SC_np1, from_SCglob_np1
+    //
+    // Only the inputs of the turbines on this processor are sent. The exchange overlaps with
+    // whatever runs until the inputs are needed, usually the next turbine step, and is completed
+    // in completeInputExchange.
 
-    for(int iTurb=0; iTurb < nTurbinesGlob; iTurb++) {
-        for(int iInput=0; iInput < nCtrl2SC; iInput++) {
-            to_SC_np1[iTurb*nCtrl2SC + iInput] = 0.0; // Initialize to zero
-        }
-    }
+    completeInputExchange();
 
-    for(int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
-        for(int iInput=0; iInput < nCtrl2SC; iInput++) {
-            to_SC_np1[turbineMapProcToGlob[iTurb]*nCtrl2SC + iInput] = ip_from_FAST[iTurb].toSC[iInput] ;
+    if (nTurbinesProc > 0) {
+
+        for(int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
+            for(int iInput=0; iInput < nCtrl2SC; iInput++) {
+                to_SC_send[iTurb*nCtrl2SC + iInput] = ip_from_FAST[iTurb].toSC[iInput] ;
+            }
         }
-    }
 
-    if (MPI_COMM_NULL != fastMPIComm) {
-        MPI_Allreduce(MPI_IN_PLACE, to_SC_np1.data(), nCtrl2SC*nTurbinesGlob, MPI_FLOAT, MPI_SUM, fastMPIComm) ;
+        MPI_Iallgatherv(to_SC_send.data(), nTurbinesProc*nCtrl2SC, MPI_FLOAT, to_SC_gathered.data(), gatherCounts.data(), gatherDispls.data(), MPI_FLOAT, fastMPIComm, &toSCRequest) ;
+        toSCPending = true;
     }
 
     for(int iTurb=0; iTurb < nTurbinesProc; iTurb++) {
 
         for(int iOutput=0; iOutput < nSC2Ctrl; iOutput++) {
-            op_to_FAST[iTurb].fromSC[iOutput] = from_SC_np1[turbineMapProcToGlob[iTurb]*nSC2Ctrl + iOutput] ;
+            op_to_FAST[iTurb].fromSC[iOutput] = from_SC_np1[turbineGlob[iTurb]*nSC2Ctrl + iOutput] ;
         }
 
         for(int iOutput=0; iOutput < nSC2CtrlGlob; iOutput++) {
-            op_to_FAST[iTurb].fromSCglob[iOutput] = from_SCglob_np1[turbineMapProcToGlob[iTurb]*nSC2Ctrl + iOutput] ;
+            op_to_FAST[iTurb].fromSCglob[iOutput] = from_SCglob_np1[iOutput] ;
         }
 
     }
 
 }
 
+void SuperController::completeInputExchange() {
 
-void SuperController::advanceTime() {
+    if (!toSCPending) return;
 
-    if (nTurbinesProc > 0) {
+    MPI_Wait(&toSCRequest, MPI_STATUS_IGNORE);
+    toSCPending = false;
+
+    for(int i=0; i < nTurbinesGlob; i++) {
+        for(int iInput=0; iInput < nCtrl2SC; iInput++) {
+            to_SC_np1[gatherTurbGlob[i]*nCtrl2SC + iInput] = to_SC_gathered[i*nCtrl2SC + iInput];
+        }
+    }
 
+    if (toSCAdvancePending) {
         for(int iTurb=0; iTurb < nTurbinesGlob; iTurb++) {
             for(int iInput=0; iInput < nCtrl2SC; iInput++) {
                 to_SC_nm1[iTurb*nCtrl2SC + iInput] = to_SC_n[iTurb*nCtrl2SC + iInput];
                 to_SC_n[iTurb*nCtrl2SC + iInput] = to_SC_np1[iTurb*nCtrl2SC + iInput];
-//            to_SC_np1[iTurb*nCtrl2SC + iInput] = Predictor?
+            }
+        }
+        toSCAdvancePending = false;
+    }
+
+}
+
+
+void SuperController::advanceTime() {
+
+    if (nTurbinesProc > 0) {
+
+        // The inputs at 'n+1' may still be on their way from the other processors
+        if (toSCPending) {
+            toSCAdvancePending = true;
+        }
+
+        for(int iTurb=0; iTurb < nTurbinesGlob; iTurb++) {
+            if (!toSCAdvancePending) {
+                for(int iInput=0; iInput < nCtrl2SC; iInput++) {
+                    to_SC_nm1[iTurb*nCtrl2SC + iInput] = to_SC_n[iTurb*nCtrl2SC + iInput];
+                    to_SC_n[iTurb*nCtrl2SC + iInput] = to_SC_np1[iTurb*nCtrl2SC + iInput];
+//                to_SC_np1[iTurb*nCtrl2SC + iInput] = Predictor?
+                }
             }
             for(int iOutput=0; iOutput < nSC2Ctrl; iOutput++) {
                 from_SC_nm1[iTurb*nSC2Ctrl + iOutput] = from_SC_n[iTurb*nSC2Ctrl + iOutput];
@@ -10,6 +10,8 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <algorithm>
+#include <stdexcept>
 #include "mpi.h"
 #include "hdf5.h"
 #include "dlfcn.h"
@@ -25,6 +27,20 @@ public:
     std::vector<std::vector<float>> from_SC;
 };
 
+// Header of the supercontroller restart file. Increment scRestartFileVersion whenever the layout of the file changes.
+static const int scRestartFileVersion = 2;
+struct scRestartHeader {
+    int version;
+    int n_t_global;
+    int nTurbinesGlob;
+    int nCtrl2SC;
+    int nSC2Ctrl;
+    int nInpGlobal;
+    int nSC2CtrlGlob;
+    int nStatesGlobal;
+    int nStatesTurbine;
+};
+
 class SuperController {
 
 public:
@@ -37,10 +53,24 @@ public:
 private:
 
     MPI_Comm  fastMPIComm;
+    int fastMPIRank;
 
     int nTurbinesGlob;
     int nTurbinesProc;
-    std::map<int, int> turbineMapProcToGlob;
+    std::vector<int> turbineGlob; // Global index of each turbine on this processor
+    std::vector<int> turbineGlobSorted; // Global index of the turbines on this processor in increasing order
+
+    // Sparse exchange of the inputs to the supercontroller. Each processor contributes only the
+    // inputs of its own turbines to a non-blocking all-gather. The exchange started at the end of a
+    // time step is completed the next time the inputs are needed.
+    std::vector<int> gatherCounts; // Number of inputs contributed by each processor in fastMPIComm
+    std::vector<int> gatherDispls; // Offset of the inputs of each processor in to_SC_gathered
+    std::vector<int> gatherTurbGlob; // Global index of each turbine in to_SC_gathered
+    std::vector<float> to_SC_send; // Inputs of the turbines on this processor - Must not change while the exchange is in flight
+    std::vector<float> to_SC_gathered; // Inputs of all turbines in processor order
+    MPI_Request toSCRequest;
+    bool toSCPending; // An exchange of the inputs is in flight
+    bool toSCAdvancePending; // to_SC_* still has to be advanced to the next time step once the exchange is complete
 
     int nCtrl2SC;
     int nSC2Ctrl;
@@ -98,6 +128,14 @@ private:
     typedef void sc_calcOutputs_t(double *  t, int * nTurbinesGlob, int * nParamGlobal, float * paramGlobal, int * nParamTurbine, float * paramTurbine, int * nInpGlobal, float * to_SCglob, int * nCtrl2SC, float * to_SC, int * nStatesGlobal, float * statesGlob, int * nStatesTurbine, float * statesTurbine, int * nSC2CtrlGlob, float * from_SCglob, int * nSC2Ctrl, float * from_SC, int * ErrStat, char * ErrMsg);
     sc_calcOutputs_t * sc_calcOutputs;
 
+    // Restart file
+    hid_t openRestartFile(int n_t_global, bool create);
+    hid_t createRestartHeaderType();
+    hid_t createRestartXferPlist();
+    void writeRestartData(hid_t restartFile, hid_t xferPlist, const char * name, const float * data, int n);
+    void writeRestartTurbineData(hid_t restartFile, hid_t xferPlist, const char * name, const float * data, int nPerTurbine);
+    void readRestartData(hid_t restartFile, hid_t xferPlist, const char * name, float * data, int n);
+
 
 public:
 
@@ -115,13 +153,17 @@ public:
     void calcOutputs_n(double t) ;
     void calcOutputs_np1(double t) ;
 
-    void fastSCInputOutput() ; // Exchange input output information with OpenFAST turbines
+    void fastSCInputOutput() ; // Exchange input output information with OpenFAST turbines - Does not wait for the inputs from other processors
 
     void advanceTime() ; //Advance states to time step 'n+1'
 
+    void completeInputExchange() ; // Wait for the inputs to the supercontroller from all turbines
+
     int writeRestartFile(int n_t_global);
 
+    static std::string restartFileName(int n_t_global) { return "sc" + std::to_string(n_t_global) + ".chkp.h5"; }
+
     int readRestartFile(int n_t_global);
 
-    void end() {} ;
+    void end() { completeInputExchange(); } ;
 };
@@ -0,0 +1,67 @@
+/*
+ * Supercontroller library used by test_sc_restart. Every output depends on the inputs and states of all
+ * turbines, so restarting with wrong or misplaced restart data changes the outputs.
+ */
+
+#define N_CTRL2SC 2
+#define N_SC2CTRL 2
+#define N_SC2CTRL_GLOB 1
+#define N_STATES_GLOBAL 1
+#define N_STATES_TURBINE 2
+#define N_PARAM_TURBINE 1
+
+void sc_init(int * nTurbinesGlob, int * nInpGlobal, int * nCtrl2SC, int * nParamGlobal, int * nParamTurbine, int * nStatesGlobal, int * nStatesTurbine, int * nSC2CtrlGlob, int * nSC2Ctrl, int * ErrStat, char * ErrMsg) {
+
+    *nInpGlobal = 0;
+    *nCtrl2SC = N_CTRL2SC;
+    *nParamGlobal = 0;
+    *nParamTurbine = N_PARAM_TURBINE;
+    *nStatesGlobal = N_STATES_GLOBAL;
+    *nStatesTurbine = N_STATES_TURBINE;
+    *nSC2CtrlGlob = N_SC2CTRL_GLOB;
+    *nSC2Ctrl = N_SC2CTRL;
+    *ErrStat = 0;
+}
+
+void sc_getInitData(int * nTurbinesGlob, int * nParamGlobal, int * nParamTurbine, float * paramGlobal, float * paramTurbine, int * nSC2CtrlGlob, float * from_SCglob, int * nSC2Ctrl, float * from_SC, int * nStatesGlobal, float * globStates, int * nStatesTurbine, float * turbineStates, int * ErrStat, char * ErrMsg) {
+
+    for (int iTurb = 0; iTurb < *nTurbinesGlob; iTurb++) {
+        paramTurbine[iTurb*N_PARAM_TURBINE] = 1.0f + 0.25f*iTurb;
+        for (int i = 0; i < N_STATES_TURBINE; i++) {
+            turbineStates[iTurb*N_STATES_TURBINE + i] = 0.5f*i - 0.1f*iTurb;
+        }
+        for (int i = 0; i < N_SC2CTRL; i++) {
+            from_SC[iTurb*N_SC2CTRL + i] = 0.0f;
+        }
+    }
+    globStates[0] = 1.0f;
+    from_SCglob[0] = 0.0f;
+    *ErrStat = 0;
+}
+
+void sc_updateStates(double * t, int * nTurbinesGlob, int * nParamGlobal, float * paramGlobal, int * nParamTurbine, float * paramTurbine, int * nInpGlobal, float * to_SCglob, int * nCtrl2SC, float * to_SC, int * nStatesGlobal, float * statesGlob_n, float * statesGlob_np1, int * nStatesTurbine, float * statesTurbine_n, float * statesTurbine_np1, int * ErrStat, char * ErrMsg) {
+
+    float sum = 0.0f;
+    for (int iTurb = 0; iTurb < *nTurbinesGlob; iTurb++) {
+        const float * u = &to_SC[iTurb*N_CTRL2SC];
+        const float * x = &statesTurbine_n[iTurb*N_STATES_TURBINE];
+        float * xNew = &statesTurbine_np1[iTurb*N_STATES_TURBINE];
+        xNew[0] = 0.9f*x[0] + 0.1f*paramTurbine[iTurb*N_PARAM_TURBINE]*u[0];
+        xNew[1] = 0.8f*x[1] + 0.2f*u[1] - 0.05f*x[0]*statesGlob_n[0];
+        sum += u[0];
+    }
+    statesGlob_np1[0] = 0.95f*statesGlob_n[0] + 0.01f*sum + 0.001f*(float)(*t);
+    *ErrStat = 0;
+}
+
+void sc_calcOutputs(double * t, int * nTurbinesGlob, int * nParamGlobal, float * paramGlobal, int * nParamTurbine, float * paramTurbine, int * nInpGlobal, float * to_SCglob, int * nCtrl2SC, float * to_SC, int * nStatesGlobal, float * statesGlob, int * nStatesTurbine, float * statesTurbine, int * nSC2CtrlGlob, float * from_SCglob, int * nSC2Ctrl, float * from_SC, int * ErrStat, char * ErrMsg) {
+
+    for (int iTurb = 0; iTurb < *nTurbinesGlob; iTurb++) {
+        const float * u = &to_SC[iTurb*N_CTRL2SC];
+        const float * x = &statesTurbine[iTurb*N_STATES_TURBINE];
+        from_SC[iTurb*N_SC2CTRL + 0] = x[0] + 0.5f*u[1];
+        from_SC[iTurb*N_SC2CTRL + 1] = x[1]*statesGlob[0];
+    }
+    from_SCglob[0] = statesGlob[0];
+    *ErrStat = 0;
+}
@@ -0,0 +1,213 @@
+// Checks that the batch actuator node accessors of fast::OpenFAST, for one turbine and for all turbines on
+// this processor, give the same data as the per-node accessors, and times the three ways of exchanging the
+// data of all nodes of all turbines.
+//
+// Usage: test_batch_accessors [number of timed repetitions]
+
+#include "OpenFAST.H"
+#include <chrono>
+#include <iostream>
+#include <random>
+
+namespace fast {
+
+// Sets up the node data of turbines without running FAST
+struct OpenFASTTestAccess {
+
+    std::vector<std::vector<float> > inputData;
+    std::vector<std::vector<float> > outputData;
+
+    void setupTurbines(OpenFAST & fast, const std::vector<int> & turbineGlob, int nBlades, int nForcePtsBlade, int nForcePtsTwr, int nVelPtsBlade, int nVelPtsTwr) {
+
+        std::mt19937 rng(4321);
+        std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+
+        const int nTurbines = turbineGlob.size();
+        fast.nTurbinesGlob = nTurbines;
+        fast.nTurbinesProc = nTurbines;
+        fast.numBlades.assign(nTurbines, nBlades);
+        fast.numForcePtsBlade.assign(nTurbines, nForcePtsBlade);
+        fast.numForcePtsTwr.assign(nTurbines, nForcePtsTwr);
+        fast.numVelPtsBlade.assign(nTurbines, nVelPtsBlade);
+        fast.numVelPtsTwr.assign(nTurbines, nVelPtsTwr);
+        fast.TurbineBasePos.resize(nTurbines);
+        fast.cDriver_Input_from_FAST.resize(nTurbines);
+        fast.cDriver_Output_to_FAST.resize(nTurbines);
+        inputData.resize(nTurbines);
+        outputData.resize(nTurbines);
+
+        for (int iTurb=0; iTurb < nTurbines; iTurb++) {
+            fast.turbineMapProcToGlob[iTurb] = turbineGlob[iTurb];
+            fast.reverseTurbineMapProcToGlob[turbineGlob[iTurb]] = iTurb;
+            fast.TurbineBasePos[iTurb] = {dist(rng), dist(rng), dist(rng)};
+
+            // The 12 force node arrays, then the 3 velocity node arrays
+            const int nForcePts = fast.get_numForcePtsLoc(iTurb);
+            const int nVelPts = fast.get_numVelPtsLoc(iTurb);
+            inputData[iTurb].resize(12*nForcePts + 3*nVelPts);
+            for (size_t i=0; i < inputData[iTurb].size(); i++) inputData[iTurb][i] = dist(rng);
+            outputData[iTurb].assign(3*nVelPts, 0.0f);
+
+            OpFM_InputType_t & iData = fast.cDriver_Input_from_FAST[iTurb];
+            float * p = inputData[iTurb].data();
+            float ** forceArrays[] = {&iData.pxForce, &iData.pyForce, &iData.pzForce, &iData.xdotForce, &iData.ydotForce, &iData.zdotForce,
+                                      &iData.fx, &iData.fy, &iData.fz, &iData.momentx, &iData.momenty, &iData.momentz};
+            for (float ** a : forceArrays) { *a = p; p += nForcePts; }
+            iData.pxVel = p; p += nVelPts;
+            iData.pyVel = p; p += nVelPts;
+            iData.pzVel = p;
+
+            OpFM_OutputType_t & oData = fast.cDriver_Output_to_FAST[iTurb];
+            oData.u = &outputData[iTurb][0];
+            oData.v = &outputData[iTurb][nVelPts];
+            oData.w = &outputData[iTurb][2*nVelPts];
+        }
+
+        fast.allocateNodeData();
+    }
+};
+
+}
+
+namespace {
+
+// One component array per quantity, for all nodes of all turbines on this processor
+struct NodeArrays {
+    std::vector<double> velCoords[3], vel[3], forceCoords[3], force[3], forceVel[3], relVel[3];
+
+    NodeArrays(int nVelPts, int nForcePts) {
+        for (int i=0; i < 3; i++) {
+            velCoords[i].assign(nVelPts, 0.0);
+            vel[i].assign(nVelPts, 0.0);
+            forceCoords[i].assign(nForcePts, 0.0);
+            force[i].assign(nForcePts, 0.0);
+            forceVel[i].assign(nForcePts, 0.0);
+            relVel[i].assign(nForcePts, 0.0);
+        }
+    }
+};
+
+// The data exchanged with a CFD code every time step, with the per-node accessors. These expect the node
+// number on this processor, which is the node number on the turbine plus the number of nodes of the turbines
+// before it when all turbines have the same number of nodes; getForceNodeCoordinates expects the node number
+// on the turbine.
+void exchangePerNode(fast::OpenFAST & fast, const std::vector<int> & turbineGlob, NodeArrays & a) {
+    std::vector<double> buf(3);
+    for (size_t iTurb=0; iTurb < turbineGlob.size(); iTurb++) {
+        const int iTurbGlob = turbineGlob[iTurb];
+        const int nVelPts = fast.get_numVelPts(iTurbGlob);
+        const int velOffset = fast.get_velNodeOffset(iTurbGlob);
+        for (int iNode=0; iNode < nVelPts; iNode++) {
+            fast.getVelNodeCoordinates(buf, velOffset + iNode, iTurbGlob);
+            for (int i=0; i < 3; i++) a.velCoords[i][velOffset + iNode] = buf[i];
+            for (int i=0; i < 3; i++) buf[i] = a.vel[i][velOffset + iNode];
+            fast.setVelocity(buf, velOffset + iNode, iTurbGlob);
+        }
+        const int nForcePts = fast.get_numForcePts(iTurbGlob);
+        const int forceOffset = fast.get_forceNodeOffset(iTurbGlob);
+        for (int iNode=0; iNode < nForcePts; iNode++) {
+            fast.getForceNodeCoordinates(buf, iNode, iTurbGlob);
+            for (int i=0; i < 3; i++) a.forceCoords[i][forceOffset + iNode] = buf[i];
+            for (int i=0; i < 3; i++) buf[i] = a.forceVel[i][forceOffset + iNode];
+            fast.setVelocityForceNode(buf, forceOffset + iNode, iTurbGlob);
+            fast.getRelativeVelForceNode(buf, forceOffset + iNode, iTurbGlob);
+            for (int i=0; i < 3; i++) a.relVel[i][forceOffset + iNode] = buf[i];
+            fast.getForce(buf, forceOffset + iNode, iTurbGlob);
+            for (int i=0; i < 3; i++) a.force[i][forceOffset + iNode] = buf[i];
+        }
+    }
+}
+
+// The same with the batch accessors for one turbine
+void exchangePerTurbine(fast::OpenFAST & fast, const std::vector<int> & turbineGlob, NodeArrays & a) {
+    for (size_t iTurb=0; iTurb < turbineGlob.size(); iTurb++) {
+        const int iTurbGlob = turbineGlob[iTurb];
+        const int v = fast.get_velNodeOffset(iTurbGlob);
+        const int f = fast.get_forceNodeOffset(iTurbGlob);
+        fast.getVelNodeCoordinates(&a.velCoords[0][v], &a.velCoords[1][v], &a.velCoords[2][v], iTurbGlob);
+        fast.setVelocity(&a.vel[0][v], &a.vel[1][v], &a.vel[2][v], iTurbGlob);
+        fast.getForceNodeCoordinates(&a.forceCoords[0][f], &a.forceCoords[1][f], &a.forceCoords[2][f], iTurbGlob);
+        fast.setVelocityForceNode(&a.forceVel[0][f], &a.forceVel[1][f], &a.forceVel[2][f], iTurbGlob);
+        fast.getRelativeVelForceNode(&a.relVel[0][f], &a.relVel[1][f], &a.relVel[2][f], iTurbGlob);
+        fast.getForce(&a.force[0][f], &a.force[1][f], &a.force[2][f], iTurbGlob);
+    }
+}
+
+// The same with the batch accessors for all turbines on this processor
+void exchangeAllTurbines(fast::OpenFAST & fast, NodeArrays & a) {
+    fast.getVelNodeCoordinates(a.velCoords[0].data(), a.velCoords[1].data(), a.velCoords[2].data());
+    fast.setVelocity(a.vel[0].data(), a.vel[1].data(), a.vel[2].data());
+    fast.getForceNodeCoordinates(a.forceCoords[0].data(), a.forceCoords[1].data(), a.forceCoords[2].data());
+    fast.setVelocityForceNode(a.forceVel[0].data(), a.forceVel[1].data(), a.forceVel[2].data());
+    fast.getRelativeVelForceNode(a.relVel[0].data(), a.relVel[1].data(), a.relVel[2].data());
+    fast.getForce(a.force[0].data(), a.force[1].data(), a.force[2].data());
+}
+
+bool sameOutputs(const NodeArrays & a, const NodeArrays & b) {
+    for (int i=0; i < 3; i++) {
+        if ( (a.velCoords[i] != b.velCoords[i]) || (a.forceCoords[i] != b.forceCoords[i]) ||
+             (a.relVel[i] != b.relVel[i]) || (a.force[i] != b.force[i]) ) return false;
+    }
+    return true;
+}
+
+}
+
+int main(int argc, char** argv) {
+
+    const int nRepeat = (argc > 1) ? std::atoi(argv[1]) : 200;
+    int nFailures = 0;
+
+    // Four turbines with three blades of 50 force and 30 velocity nodes and a tower of 20 force and 15 velocity
+    // nodes, not in the order of the global turbine number
+    const std::vector<int> turbineGlob = {5, 2, 7, 0};
+    fast::OpenFAST fast;
+    fast::OpenFASTTestAccess access;
+    access.setupTurbines(fast, turbineGlob, 3, 50, 20, 30, 15);
+    const int nVelPts = fast.get_numVelPtsProc();
+    const int nForcePts = fast.get_numForcePtsProc();
+
+    NodeArrays perNode(nVelPts, nForcePts), perTurbine(nVelPts, nForcePts), allTurbines(nVelPts, nForcePts);
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<double> dist(-10.0, 10.0);
+    for (int i=0; i < 3; i++) {
+        for (int iNode=0; iNode < nVelPts; iNode++) perNode.vel[i][iNode] = dist(rng);
+        for (int iNode=0; iNode < nForcePts; iNode++) perNode.forceVel[i][iNode] = dist(rng);
+        perTurbine.vel[i] = allTurbines.vel[i] = perNode.vel[i];
+        perTurbine.forceVel[i] = allTurbines.forceVel[i] = perNode.forceVel[i];
+    }
+
+    // Same data out, and the same velocities set at the nodes
+    exchangePerNode(fast, turbineGlob, perNode);
+    std::vector<std::vector<float> > velSetPerNode = access.outputData;
+    exchangePerTurbine(fast, turbineGlob, perTurbine);
+    std::vector<std::vector<float> > velSetPerTurbine = access.outputData;
+    exchangeAllTurbines(fast, allTurbines);
+    if (!sameOutputs(perNode, perTurbine) || (velSetPerNode != velSetPerTurbine)) {
+        std::cerr << "The batch accessors for one turbine differ from the per-node accessors" << std::endl;
+        nFailures++;
+    }
+    if (!sameOutputs(perNode, allTurbines) || (velSetPerNode != access.outputData)) {
+        std::cerr << "The batch accessors for all turbines differ from the per-node accessors" << std::endl;
+        nFailures++;
+    }
+
+    // The fastest of five rounds, taking turns
+    double time[3] = {1.0e30, 1.0e30, 1.0e30};
+    for (int iRound=0; iRound < 5; iRound++) {
+        for (int iImpl=0; iImpl < 3; iImpl++) {
+            auto tStart = std::chrono::steady_clock::now();
+            for (int iRepeat=0; iRepeat < nRepeat; iRepeat++) {
+                if (iImpl == 0) exchangePerNode(fast, turbineGlob, perNode);
+                if (iImpl == 1) exchangePerTurbine(fast, turbineGlob, perTurbine);
+                if (iImpl == 2) exchangeAllTurbines(fast, allTurbines);
+            }
+            time[iImpl] = std::min(time[iImpl], std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count());
+        }
+    }
+    std::cout << "Exchange time for " << turbineGlob.size() << " turbines, " << nVelPts << " velocity and " << nForcePts << " force nodes: per node "
+              << 1.0e6*time[0]/nRepeat << " us, per turbine " << 1.0e6*time[1]/nRepeat << " us, all turbines " << 1.0e6*time[2]/nRepeat << " us" << std::endl;
+
+    std::cout << "test_batch_accessors: " << ((nFailures == 0) ? "passed" : "FAILED") << std::endl;
+    return (nFailures == 0) ? 0 : 1;
+}
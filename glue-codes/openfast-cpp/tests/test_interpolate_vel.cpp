@@ -0,0 +1,177 @@
+// Checks that fast::OpenFAST::interpolateVel_ForceToVelNodesLine gives bitwise the same velocities as the
+// original interpolation from the force nodes to the velocity nodes, and times both.
+//
+// Usage: test_interpolate_vel [number of timed repetitions]
+
+#include "OpenFAST.H"
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <random>
+
+namespace {
+
+// Nodes of one blade or tower: the reference node followed by the nodes along the line
+struct LineData {
+    std::vector<float> pxForce, pyForce, pzForce;
+    std::vector<float> pxVel, pyVel, pzVel;
+    std::vector<double> forceNodeVel;
+    std::vector<float> u, v, w;
+    OpFM_InputType_t iData;
+    OpFM_OutputType_t oData;
+
+    void setPointers() {
+        iData.pxForce = pxForce.data(); iData.pyForce = pyForce.data(); iData.pzForce = pzForce.data();
+        iData.pxVel = pxVel.data(); iData.pyVel = pyVel.data(); iData.pzVel = pzVel.data();
+        oData.u = u.data(); oData.v = v.data(); oData.w = w.data();
+    }
+};
+
+// The interpolation along a blade as it was before interpolateVel_ForceToVelNodesLine, with the hub
+// replaced by the reference node
+void interpolateReference(const OpFM_InputType_t & iData, const double * forceNodeVel, int iNodeRefForce, int iNodeStartForce, int nForcePts, int iNodeRefVel, int iNodeStartVel, int nVelPts, OpFM_OutputType_t & oData) {
+
+    std::vector<double> rDistForce(nForcePts) ;
+    for(int j=0; j < nForcePts; j++) {
+        int iNodeForce = iNodeStartForce + j ;
+        rDistForce[j] = std::sqrt(
+            (iData.pxForce[iNodeForce] - iData.pxForce[iNodeRefForce])*(iData.pxForce[iNodeForce] - iData.pxForce[iNodeRefForce])
+            + (iData.pyForce[iNodeForce] - iData.pyForce[iNodeRefForce])*(iData.pyForce[iNodeForce] - iData.pyForce[iNodeRefForce])
+            + (iData.pzForce[iNodeForce] - iData.pzForce[iNodeRefForce])*(iData.pzForce[iNodeForce] - iData.pzForce[iNodeRefForce])
+        );
+    }
+
+    for(int j=0; j < nVelPts; j++) {
+        int iNodeVel = iNodeStartVel + j ;
+        double rDistVel = std::sqrt(
+            (iData.pxVel[iNodeVel] - iData.pxVel[iNodeRefVel])*(iData.pxVel[iNodeVel] - iData.pxVel[iNodeRefVel])
+            + (iData.pyVel[iNodeVel] - iData.pyVel[iNodeRefVel])*(iData.pyVel[iNodeVel] - iData.pyVel[iNodeRefVel])
+            + (iData.pzVel[iNodeVel] - iData.pzVel[iNodeRefVel])*(iData.pzVel[iNodeVel] - iData.pzVel[iNodeRefVel])
+        );
+        //Find nearest two force nodes
+        int jForceLower = 0;
+        while ( (rDistForce[jForceLower+1] < rDistVel) && ( jForceLower < (nForcePts-2)) ) {
+            jForceLower = jForceLower + 1;
+        }
+        int iNodeForceLower = iNodeStartForce + jForceLower ;
+        double rInterp = (rDistVel - rDistForce[jForceLower])/(rDistForce[jForceLower+1]-rDistForce[jForceLower]);
+        oData.u[iNodeVel] = forceNodeVel[iNodeForceLower*3 + 0] + rInterp * (forceNodeVel[(iNodeForceLower+1)*3 + 0] - forceNodeVel[iNodeForceLower*3 + 0] );
+        oData.v[iNodeVel] = forceNodeVel[iNodeForceLower*3 + 1] + rInterp * (forceNodeVel[(iNodeForceLower+1)*3 + 1] - forceNodeVel[iNodeForceLower*3 + 1] );
+        oData.w[iNodeVel] = forceNodeVel[iNodeForceLower*3 + 2] + rInterp * (forceNodeVel[(iNodeForceLower+1)*3 + 2] - forceNodeVel[iNodeForceLower*3 + 2] );
+    }
+}
+
+enum LineKind { monotone, monotoneBeyondEnds, monotoneRepeated, shuffled };
+
+// A line of length 'length' in a random direction from a random reference node
+LineData makeLine(std::mt19937 & rng, LineKind kind, int nForcePts, int nVelPts) {
+
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::normal_distribution<float> normal(0.0f, 1.0f);
+    const float length = 10.0f + 100.0f*unit(rng);
+    float dir[3] = {normal(rng), normal(rng), normal(rng)};
+    const float norm = std::sqrt(dir[0]*dir[0] + dir[1]*dir[1] + dir[2]*dir[2]);
+    const float ref[3] = {1000.0f*normal(rng), 1000.0f*normal(rng), 100.0f*unit(rng)};
+
+    std::vector<float> sForce(nForcePts), sVel(nVelPts);
+    for (int j=0; j < nForcePts; j++) sForce[j] = length*(j + 0.5f*unit(rng))/nForcePts;
+    std::sort(sForce.begin(), sForce.end());
+    const float sVelMin = (kind == monotoneBeyondEnds) ? -0.1f*length : 0.0f;
+    const float sVelMax = (kind == monotoneBeyondEnds) ? 1.1f*length : length;
+    for (int j=0; j < nVelPts; j++) sVel[j] = sVelMin + (sVelMax - sVelMin)*unit(rng);
+    if (kind != shuffled) std::sort(sVel.begin(), sVel.end());
+    if (kind == monotoneRepeated) {
+        for (int j=1; j < nForcePts; j += 3) sForce[j] = sForce[j-1];
+        for (int j=0; j < nVelPts; j += 4) sVel[j] = sForce[(j*nForcePts)/nVelPts];
+    }
+    if (kind == shuffled) std::shuffle(sForce.begin(), sForce.end(), rng);
+
+    LineData line;
+    for (int j=-1; j < nForcePts; j++) {
+        float s = (j < 0) ? 0.0f : sForce[j];
+        line.pxForce.push_back(ref[0] + s*dir[0]/norm);
+        line.pyForce.push_back(ref[1] + s*dir[1]/norm);
+        line.pzForce.push_back(ref[2] + s*dir[2]/norm);
+        for (int i=0; i < 3; i++) line.forceNodeVel.push_back(10.0*normal(rng));
+    }
+    for (int j=-1; j < nVelPts; j++) {
+        float s = (j < 0) ? 0.0f : sVel[j];
+        line.pxVel.push_back(ref[0] + s*dir[0]/norm);
+        line.pyVel.push_back(ref[1] + s*dir[1]/norm);
+        line.pzVel.push_back(ref[2] + s*dir[2]/norm);
+    }
+    line.u.assign(nVelPts + 1, 0.0f);
+    line.v.assign(nVelPts + 1, 0.0f);
+    line.w.assign(nVelPts + 1, 0.0f);
+    line.setPointers();
+    return line;
+}
+
+bool sameBits(const std::vector<float> & a, const std::vector<float> & b) {
+    return (a.size() == b.size()) && (std::memcmp(a.data(), b.data(), a.size()*sizeof(float)) == 0);
+}
+
+}
+
+int main(int argc, char** argv) {
+
+    const int nRepeat = (argc > 1) ? std::atoi(argv[1]) : 2000;
+    std::mt19937 rng(12345);
+    std::vector<double> distForceBuffer;
+    int nFailures = 0;
+
+    // Bitwise comparison on random lines, with the reference node before the line (blades) or as the first
+    // node of the line (tower)
+    const LineKind kinds[] = {monotone, monotoneBeyondEnds, monotoneRepeated, shuffled};
+    for (LineKind kind : kinds) {
+        for (int iLine=0; iLine < 500; iLine++) {
+            std::uniform_int_distribution<int> nPts(2, 60);
+            const int nForcePts = nPts(rng);
+            const int nVelPts = nPts(rng);
+            LineData line = makeLine(rng, kind, nForcePts, nVelPts);
+            LineData lineRef = line;
+            lineRef.setPointers();
+            const int iNodeStart = (iLine % 2 == 0) ? 1 : 0;
+
+            fast::OpenFAST::interpolateVel_ForceToVelNodesLine(line.iData, line.forceNodeVel.data(), 0, iNodeStart, nForcePts + 1 - iNodeStart, 0, iNodeStart, nVelPts + 1 - iNodeStart, distForceBuffer, line.oData);
+            interpolateReference(lineRef.iData, lineRef.forceNodeVel.data(), 0, iNodeStart, nForcePts + 1 - iNodeStart, 0, iNodeStart, nVelPts + 1 - iNodeStart, lineRef.oData);
+
+            if (!sameBits(line.u, lineRef.u) || !sameBits(line.v, lineRef.v) || !sameBits(line.w, lineRef.w)) {
+                if (nFailures == 0) std::cerr << "Velocities differ from the reference for line kind " << kind << ", line " << iLine << std::endl;
+                nFailures++;
+            }
+        }
+    }
+
+    // Time a turbine with three blades of 50 force and 30 velocity nodes and a tower of 20 force and 15
+    // velocity nodes
+    std::vector<LineData> turbine;
+    for (int iBlade=0; iBlade < 3; iBlade++) turbine.push_back(makeLine(rng, monotone, 50, 30));
+    turbine.push_back(makeLine(rng, monotone, 20, 15));
+    for (size_t i=0; i < turbine.size(); i++) turbine[i].setPointers();
+
+    // The two implementations take turns, and the fastest of five rounds is reported
+    double time[2] = {1.0e30, 1.0e30};
+    for (int iRound=0; iRound < 5; iRound++) {
+        for (int iImpl=0; iImpl < 2; iImpl++) {
+            auto tStart = std::chrono::steady_clock::now();
+            for (int iRepeat=0; iRepeat < nRepeat; iRepeat++) {
+                for (size_t i=0; i < turbine.size(); i++) {
+                    LineData & line = turbine[i];
+                    const int nForcePts = line.pxForce.size() - 1;
+                    const int nVelPts = line.pxVel.size() - 1;
+                    if (iImpl == 0) {
+                        interpolateReference(line.iData, line.forceNodeVel.data(), 0, 1, nForcePts, 0, 1, nVelPts, line.oData);
+                    } else {
+                        fast::OpenFAST::interpolateVel_ForceToVelNodesLine(line.iData, line.forceNodeVel.data(), 0, 1, nForcePts, 0, 1, nVelPts, distForceBuffer, line.oData);
+                    }
+                }
+            }
+            time[iImpl] = std::min(time[iImpl], std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count());
+        }
+    }
+    std::cout << "Interpolation time per turbine: original " << 1.0e6*time[0]/nRepeat << " us, interpolateVel_ForceToVelNodesLine " << 1.0e6*time[1]/nRepeat << " us" << std::endl;
+
+    std::cout << "test_interpolate_vel: " << ((nFailures == 0) ? "passed" : "FAILED") << std::endl;
+    return (nFailures == 0) ? 0 : 1;
+}
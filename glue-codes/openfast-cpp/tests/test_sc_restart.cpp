@@ -0,0 +1,192 @@
+// Checks that the supercontroller restart file written on any number of processors restores the
+// supercontroller exactly: a simulation restarted from the file, with the turbines distributed
+// differently over the processors, must give the same outputs as the one that wrote the file.
+//
+// Usage: mpiexec -np <nProcs> test_sc_restart <supercontroller library>
+
+#include "SC.h"
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+
+namespace {
+
+const int nStepsBeforeRestart = 7;
+const int nStepsAfterRestart = 5;
+const double dt = 0.1;
+
+// Turbines stepped on this processor and the buffers the supercontroller reads from and writes to
+struct TurbineSet {
+    std::map<int, int> procToGlob;
+    std::vector<std::vector<float> > toSC;
+    std::vector<std::vector<float> > fromSC;
+    std::vector<std::vector<float> > fromSCglob;
+};
+
+// Round robin over the processors, with the local turbines in decreasing order of the global index
+TurbineSet roundRobinTurbines(int nTurbinesGlob, int rank, int nProcs) {
+    TurbineSet turbines;
+    int iTurb = 0;
+    for (int iTurbGlob = nTurbinesGlob - 1; iTurbGlob >= 0; iTurbGlob--) {
+        if (iTurbGlob % nProcs == rank) turbines.procToGlob[iTurb++] = iTurbGlob;
+    }
+    return turbines;
+}
+
+// Contiguous blocks of turbines, with the remainder on the last processors
+TurbineSet blockTurbines(int nTurbinesGlob, int rank, int nProcs) {
+    TurbineSet turbines;
+    int nBase = nTurbinesGlob / nProcs;
+    int nExtra = nTurbinesGlob % nProcs;
+    int iStart = rank*nBase + std::max(0, rank - (nProcs - nExtra));
+    int nLocal = nBase + ((rank >= nProcs - nExtra) ? 1 : 0);
+    for (int iTurb = 0; iTurb < nLocal; iTurb++) {
+        turbines.procToGlob[iTurb] = iStart + iTurb;
+    }
+    return turbines;
+}
+
+// Inputs to the supercontroller from the turbines at time step 'n'
+void setInputs(TurbineSet & turbines, int n) {
+    for (size_t iTurb = 0; iTurb < turbines.toSC.size(); iTurb++) {
+        int iTurbGlob = turbines.procToGlob[iTurb];
+        turbines.toSC[iTurb][0] = std::sin(0.3f*n + iTurbGlob);
+        turbines.toSC[iTurb][1] = std::cos(0.7f*n)*(iTurbGlob + 1);
+    }
+}
+
+void initSC(SuperController & sc, TurbineSet & turbines, int nTurbinesGlob, const std::string & scLibFile) {
+
+    scInitOutData scio;
+    int nTurbinesProc = turbines.procToGlob.size();
+    sc.load(nTurbinesGlob, scLibFile, scio);
+    sc.init(scio, nTurbinesProc);
+
+    turbines.toSC.resize(nTurbinesProc, std::vector<float>(scio.nCtrl2SC));
+    turbines.fromSC.resize(nTurbinesProc, std::vector<float>(scio.nSC2Ctrl));
+    turbines.fromSCglob.resize(nTurbinesProc, std::vector<float>(scio.nSC2CtrlGlob));
+    for (int iTurb = 0; iTurb < nTurbinesProc; iTurb++) {
+        sc.ip_from_FAST[iTurb].toSC = turbines.toSC[iTurb].data();
+        sc.ip_from_FAST[iTurb].toSC_Len = scio.nCtrl2SC;
+        sc.op_to_FAST[iTurb].fromSC = turbines.fromSC[iTurb].data();
+        sc.op_to_FAST[iTurb].fromSC_Len = scio.nSC2Ctrl;
+        sc.op_to_FAST[iTurb].fromSCglob = turbines.fromSCglob[iTurb].data();
+        sc.op_to_FAST[iTurb].fromSCglob_Len = scio.nSC2CtrlGlob;
+    }
+
+    sc.init_sc(scio, nTurbinesProc, turbines.procToGlob, MPI_COMM_WORLD);
+}
+
+// Time step from 'n' to 'n+1' in the same order of calls as fast::OpenFAST::step
+void stepSC(SuperController & sc, TurbineSet & turbines, int n) {
+    setInputs(turbines, n + 1);
+    sc.updateStates(n*dt);
+    sc.calcOutputs_np1((n + 1)*dt);
+    sc.fastSCInputOutput();
+    sc.advanceTime();
+}
+
+// Outputs to all turbines after each of the time steps following the restart, gathered on all processors
+std::vector<float> runAfterRestart(SuperController & sc, TurbineSet & turbines, int nTurbinesGlob, int nStart) {
+
+    int nOutputs = turbines.fromSC.empty() ? 0 : turbines.fromSC[0].size() + turbines.fromSCglob[0].size();
+    MPI_Allreduce(MPI_IN_PLACE, &nOutputs, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+
+    std::vector<float> outputs(nStepsAfterRestart*nTurbinesGlob*nOutputs, 0.0f);
+    for (int iStep = 0; iStep < nStepsAfterRestart; iStep++) {
+        stepSC(sc, turbines, nStart + iStep);
+        for (size_t iTurb = 0; iTurb < turbines.fromSC.size(); iTurb++) {
+            float * out = &outputs[(iStep*nTurbinesGlob + turbines.procToGlob[iTurb])*nOutputs];
+            std::copy(turbines.fromSC[iTurb].begin(), turbines.fromSC[iTurb].end(), out);
+            std::copy(turbines.fromSCglob[iTurb].begin(), turbines.fromSCglob[iTurb].end(), out + turbines.fromSC[iTurb].size());
+        }
+    }
+    sc.end();
+
+    // Each output is set on exactly one processor, so the sum is exact
+    MPI_Allreduce(MPI_IN_PLACE, outputs.data(), outputs.size(), MPI_FLOAT, MPI_SUM, MPI_COMM_WORLD);
+    return outputs;
+}
+
+}
+
+int main(int argc, char** argv) {
+
+    MPI_Init(&argc, &argv);
+    int rank, nProcs;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &nProcs);
+
+    if (argc != 2) {
+        if (rank == 0) std::cerr << "Usage: test_sc_restart <supercontroller library>" << std::endl;
+        MPI_Finalize();
+        return 1;
+    }
+    std::string scLibFile = argv[1];
+
+    // Unevenly distributed, so that the processors write different numbers of rows of the turbine data
+    int nTurbinesGlob = 2*nProcs + 1;
+    int nFailures = 0;
+
+    try {
+        // Reference simulation, which writes the restart file halfway
+        std::vector<float> outputsRef;
+        {
+            SuperController sc;
+            TurbineSet turbines = roundRobinTurbines(nTurbinesGlob, rank, nProcs);
+            initSC(sc, turbines, nTurbinesGlob, scLibFile);
+            setInputs(turbines, 0);
+            sc.calcOutputs_n(0.0);
+            sc.fastSCInputOutput();
+            for (int n = 0; n < nStepsBeforeRestart; n++) {
+                stepSC(sc, turbines, n);
+            }
+            sc.writeRestartFile(nStepsBeforeRestart);
+            outputsRef = runAfterRestart(sc, turbines, nTurbinesGlob, nStepsBeforeRestart);
+        }
+
+        // Restarted simulation, with the turbines distributed differently
+        {
+            SuperController sc;
+            TurbineSet turbines = blockTurbines(nTurbinesGlob, rank, nProcs);
+            initSC(sc, turbines, nTurbinesGlob, scLibFile);
+            sc.readRestartFile(nStepsBeforeRestart);
+            std::vector<float> outputs = runAfterRestart(sc, turbines, nTurbinesGlob, nStepsBeforeRestart);
+
+            if (outputs != outputsRef) {
+                nFailures++;
+                if (rank == 0) std::cerr << "The outputs after the restart differ from the reference outputs" << std::endl;
+            }
+        }
+
+        // Restarting from a time step without a restart file fails
+        {
+            SuperController sc;
+            TurbineSet turbines = blockTurbines(nTurbinesGlob, rank, nProcs);
+            initSC(sc, turbines, nTurbinesGlob, scLibFile);
+            bool thrown = false;
+            try {
+                sc.readRestartFile(nStepsBeforeRestart + 1);
+            } catch (const std::runtime_error &) {
+                thrown = true;
+            }
+            if (!thrown) {
+                nFailures++;
+                if (rank == 0) std::cerr << "Reading a missing restart file did not fail" << std::endl;
+            }
+        }
+    } catch (const std::exception & e) {
+        std::cerr << "Proc " << rank << ": " << e.what() << std::endl;
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    MPI_Allreduce(MPI_IN_PLACE, &nFailures, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Barrier(MPI_COMM_WORLD);
+    if (rank == 0) {
+        std::remove(("sc" + std::to_string(nStepsBeforeRestart) + ".chkp.h5").c_str());
+        std::cout << "test_sc_restart on " << nProcs << " processors: " << ((nFailures == 0) ? "passed" : "FAILED") << std::endl;
+    }
+
+    MPI_Finalize();
+    return (nFailures == 0) ? 0 : 1;
+}
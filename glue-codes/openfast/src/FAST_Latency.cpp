@@ -0,0 +1,244 @@
+
+#include "stdio.h"
+#include <string.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include "FastLibAPI.h"
+
+// openfast_latency runs one case through FastLibAPI the way a real-time (e.g. hardware-in-the-loop) application does,
+// fast_start once and then fast_step for each time step, and measures the wall clock time of each step. It prints the
+// percentiles and a histogram of the step latencies after the warm-up steps, the number of steps that took longer than
+// the time step (missed the real-time deadline) and, with glibc, the heap allocations made in those steps.
+//
+// With -c N1,N2,... it instead runs the case once for each number of output channels, subscribed to the first N
+// channels of the OutList (0 means all channels), and prints a table of the step latency against the number of channels.
+
+#if defined(__GLIBC__)
+// Counts the heap allocations of the whole process, including those in the FAST library, by wrapping the glibc allocator.
+#define COUNT_ALLOCATIONS
+extern "C" {
+   void *__libc_malloc(size_t size);
+   void *__libc_calloc(size_t n, size_t size);
+   void *__libc_realloc(void *ptr, size_t size);
+   void *__libc_memalign(size_t alignment, size_t size);
+}
+
+static std::atomic<long> n_allocations(0);
+
+extern "C" void *malloc(size_t size) {
+   n_allocations.fetch_add(1, std::memory_order_relaxed);
+   return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t n, size_t size) {
+   n_allocations.fetch_add(1, std::memory_order_relaxed);
+   return __libc_calloc(n, size);
+}
+
+extern "C" void *realloc(void *ptr, size_t size) {
+   n_allocations.fetch_add(1, std::memory_order_relaxed);
+   return __libc_realloc(ptr, size);
+}
+
+extern "C" void *memalign(size_t alignment, size_t size) {
+   n_allocations.fetch_add(1, std::memory_order_relaxed);
+   return __libc_memalign(alignment, size);
+}
+
+extern "C" void *aligned_alloc(size_t alignment, size_t size) {
+   n_allocations.fetch_add(1, std::memory_order_relaxed);
+   return __libc_memalign(alignment, size);
+}
+
+extern "C" int posix_memalign(void **ptr, size_t alignment, size_t size) {
+   n_allocations.fetch_add(1, std::memory_order_relaxed);
+   if (alignment % sizeof(void *) != 0 || (alignment & (alignment - 1)) != 0) return EINVAL;
+   void *p = __libc_memalign(alignment, size);
+   if (p == NULL) return ENOMEM;
+   *ptr = p;
+   return 0;
+}
+
+static long allocations() { return n_allocations.load(std::memory_order_relaxed); }
+#else
+static long allocations() { return 0; }
+#endif
+
+static double percentile(const std::vector<double> & sorted, double p) {
+   size_t i = (size_t) ceil(p / 100.0 * sorted.size());
+   return sorted[i > 0 ? i - 1 : 0];
+}
+
+// Latencies of the time steps of one run of a case
+struct LatencyRun {
+   std::vector<double> latency;   // wall clock time of each time step after the warm-up steps (s)
+   double warmup_max = 0.0;       // longest warm-up step (s)
+   long steady_allocations = 0;   // heap allocations in the time steps after the warm-up steps
+   int steps_allocating = 0;      // number of time steps after the warm-up steps that allocated
+   double dt = 0.0;
+   int num_outs = 0;              // number of output channels, including the time
+};
+
+// Runs the case; with n_channels >= 0 the outputs are limited to the first n_channels channels (0 means all channels)
+static void run_case(const char * input_file, int n_warmup, int n_channels, LatencyRun & run) {
+   FastLibAPI fastlib(input_file);
+   // Keep only the latest output step, so that the outputs need no memory per step
+   fastlib.set_output_sink(std::make_shared<RingBufferOutputSink>(1));
+
+   fastlib.fast_init();
+   if (n_channels > 0) {
+      std::vector<std::string> all_names = fastlib.output_channel_names;
+      int n_subscribed = std::min(n_channels, (int) all_names.size() - 1);
+      fastlib.subscribe_output_channels(std::vector<std::string>(all_names.begin() + 1, all_names.begin() + 1 + n_subscribed));
+   }
+   run.dt = fastlib.get_dt();
+   run.num_outs = fastlib.output_channel_names.size();
+   run.latency.reserve(fastlib.total_time_steps());
+
+   fastlib.fast_start();
+   bool more_steps = fastlib.total_time_steps() > 1;
+   for (int i_step = 1; more_steps; i_step++) {
+      long n_before = allocations();
+      std::chrono::steady_clock::time_point t_start = std::chrono::steady_clock::now();
+      more_steps = fastlib.fast_step();
+      std::chrono::steady_clock::time_point t_end = std::chrono::steady_clock::now();
+      long n_step = allocations() - n_before;
+
+      double step_time = std::chrono::duration<double>(t_end - t_start).count();
+      if (i_step <= n_warmup) {
+         run.warmup_max = std::max(run.warmup_max, step_time);
+      } else {
+         run.latency.push_back(step_time);
+         run.steady_allocations += n_step;
+         if (n_step > 0) run.steps_allocating++;
+      }
+   }
+   fastlib.fast_deinit();
+}
+
+static double mean_of(const std::vector<double> & values) {
+   double mean = 0.0;
+   for (size_t i = 0; i < values.size(); i++) mean += values[i];
+   return mean / values.size();
+}
+
+static int print_channel_sweep(const char * input_file, int n_warmup, const std::vector<int> & channel_counts) {
+   std::vector<LatencyRun> runs(channel_counts.size());
+   try {
+      for (size_t i = 0; i < channel_counts.size(); i++) {
+         run_case(input_file, n_warmup, channel_counts[i], runs[i]);
+      }
+   } catch (const std::exception & e) {
+      std::cerr << e.what() << std::endl;
+      return 1;
+   }
+
+   printf("\n");
+   printf("Step latency of %s against the number of output channels: DT = %g s, %d warm-up steps\n", input_file, runs[0].dt, n_warmup);
+   printf("  %10s %12s %12s %12s %12s\n", "Channels", "Mean (us)", "p50 (us)", "p99 (us)", "Max (us)");
+   for (size_t i = 0; i < runs.size(); i++) {
+      std::vector<double> sorted(runs[i].latency);
+      if (sorted.empty()) {
+         printf("  %10d %12s\n", runs[i].num_outs - 1, "no steps after the warm-up steps");
+         continue;
+      }
+      std::sort(sorted.begin(), sorted.end());
+      printf("  %10d %12.1f %12.1f %12.1f %12.1f\n", runs[i].num_outs - 1, mean_of(sorted) * 1e6,
+         percentile(sorted, 50.0) * 1e6, percentile(sorted, 99.0) * 1e6, sorted.back() * 1e6);
+   }
+   printf("  (channels exclude the time)\n");
+
+   return 0;
+}
+
+int main(int argc, char** argv) {
+   int n_warmup = 10;
+   std::vector<int> channel_counts;
+   int i_arg = 1;
+   bool bad_syntax = false;
+   while (i_arg < argc - 1 && argv[i_arg][0] == '-') {
+      if (strcmp(argv[i_arg], "-w") == 0 && i_arg + 2 < argc) {
+         n_warmup = atoi(argv[i_arg + 1]);
+         if (n_warmup < 0) bad_syntax = true;
+      } else if (strcmp(argv[i_arg], "-c") == 0 && i_arg + 2 < argc) {
+         for (char * count = strtok(argv[i_arg + 1], ","); count != NULL; count = strtok(NULL, ",")) {
+            channel_counts.push_back(atoi(count));
+            if (channel_counts.back() < 0) bad_syntax = true;
+         }
+         if (channel_counts.empty()) bad_syntax = true;
+      } else {
+         bad_syntax = true;
+         break;
+      }
+      i_arg += 2;
+   }
+   if (argc - i_arg != 1 || bad_syntax) {
+      std::cerr << "Incorrect syntax. Expected syntax is `openfast_latency [-w N_WARMUP_STEPS] [-c N1,N2,...] input.fst`" << std::endl;
+      return 1;
+   }
+   const char * input_file = argv[i_arg];
+
+   if (!channel_counts.empty()) {
+      return print_channel_sweep(input_file, n_warmup, channel_counts);
+   }
+
+   LatencyRun run;
+   try {
+      run_case(input_file, n_warmup, -1, run);
+   } catch (const std::exception & e) {
+      std::cerr << e.what() << std::endl;
+      return 1;
+   }
+
+   printf("\n");
+   printf("Step latency of %s: DT = %g s, %d warm-up steps (longest %.1f us)\n", input_file, run.dt, n_warmup, run.warmup_max * 1e6);
+   if (run.latency.empty()) {
+      printf("  No time steps after the warm-up steps\n");
+      return 0;
+   }
+
+   std::vector<double> sorted(run.latency);
+   std::sort(sorted.begin(), sorted.end());
+   double mean = mean_of(sorted);
+   long deadline_misses = sorted.end() - std::upper_bound(sorted.begin(), sorted.end(), run.dt);
+
+   printf("  Steps:     %12zu\n", sorted.size());
+   printf("  Mean:      %12.1f us\n", mean * 1e6);
+   printf("  p50:       %12.1f us\n", percentile(sorted, 50.0) * 1e6);
+   printf("  p90:       %12.1f us\n", percentile(sorted, 90.0) * 1e6);
+   printf("  p99:       %12.1f us\n", percentile(sorted, 99.0) * 1e6);
+   printf("  p99.9:     %12.1f us\n", percentile(sorted, 99.9) * 1e6);
+   printf("  Max:       %12.1f us\n", sorted.back() * 1e6);
+   printf("  Steps longer than DT (missed real-time deadline): %ld\n", deadline_misses);
+#ifdef COUNT_ALLOCATIONS
+   printf("  Heap allocations: %ld in %d of the steps\n", run.steady_allocations, run.steps_allocating);
+#else
+   printf("  Heap allocations: not counted (needs glibc)\n");
+#endif
+
+   // Histogram with power-of-two buckets in microseconds: bucket k holds the steps with 2^k <= latency < 2^(k+1) us
+   const int n_buckets = 32;
+   long counts[n_buckets] = {};
+   for (size_t i = 0; i < sorted.size(); i++) {
+      double us = sorted[i] * 1e6;
+      int k = us < 1.0 ? 0 : std::min(n_buckets - 1, (int) floor(log2(us)));
+      counts[k]++;
+   }
+   long max_count = *std::max_element(counts, counts + n_buckets);
+   printf("\n  Latency histogram (us):\n");
+   for (int k = 0; k < n_buckets; k++) {
+      if (counts[k] == 0) continue;
+      int bar = (int) ceil(50.0 * counts[k] / max_count);
+      printf("  %10.0f - %-10.0f %10ld %s\n", k == 0 ? 0.0 : ldexp(1.0, k), ldexp(1.0, k + 1), counts[k], std::string(bar, '#').c_str());
+   }
+
+   return 0;
+}
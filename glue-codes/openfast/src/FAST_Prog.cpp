@@ -3,15 +3,133 @@
 #include <string.h>
 #include <stdlib.h>
 #include <iostream>
+#include <stdexcept>
 #include "FastLibAPI.h"
+#include "FastBatchRunner.h"
+#include <ctime>
+
+// Runs n_cases copies of each case twice and prints the CPU time of each set: once from the start (cold) and
+// once from a snapshot of the case at time t_settle (warm). The warm copies of a case all start from the same
+// snapshot, so its start-up transient is simulated once instead of n_cases times. A warm copy restores the whole
+// state of the case from the snapshot, so copies of one case can only differ through their external inputs;
+// cases with different input files (e.g. wind seeds) each need their own snapshot.
+static int run_warm_start_benchmark(const std::vector<std::string> & input_file_names, double t_settle, int n_cases) {
+   std::vector<double> cold_times, warm_times, snapshot_times;
+
+   for (const std::string & input_file_name : input_file_names) {
+      std::string root_name = input_file_name.substr(0, input_file_name.find_last_of('.'));
+      std::string snapshot_root = root_name + ".snapshot";
+
+      try {
+         std::clock_t cold_start = std::clock();
+         for (int i_case = 0; i_case < n_cases; i_case++) {
+            FastLibAPI fastlib(input_file_name);
+            fastlib.fast_run();
+         }
+         double cold_time = double(std::clock() - cold_start) / CLOCKS_PER_SEC;
+
+         std::clock_t warm_start = std::clock();
+         {
+            FastLibAPI fastlib(input_file_name);
+            fastlib.fast_init();
+            fastlib.fast_snapshot(t_settle, snapshot_root);
+            fastlib.fast_deinit();
+         }
+         double snapshot_time = double(std::clock() - warm_start) / CLOCKS_PER_SEC;
+         for (int i_case = 0; i_case < n_cases; i_case++) {
+            FastLibAPI fastlib(input_file_name);
+            fastlib.fast_warm_start(snapshot_root, root_name + ".warm" + std::to_string(i_case + 1));
+            fastlib.fast_sim();
+            fastlib.fast_deinit();
+         }
+         double warm_time = double(std::clock() - warm_start) / CLOCKS_PER_SEC;
+
+         cold_times.push_back(cold_time);
+         warm_times.push_back(warm_time);
+         snapshot_times.push_back(snapshot_time);
+      } catch (const std::exception & e) {
+         std::cerr << input_file_name << ": " << e.what() << std::endl;
+         return 1;
+      }
+   }
+
+   double total_cold_time = 0.0;
+   double total_warm_time = 0.0;
+   printf("\n");
+   printf("Warm start benchmark: %d copies of each of %zu case(s), settled at t = %g s\n", n_cases, input_file_names.size(), t_settle);
+   printf("  %-30s %12s %12s %12s\n", "case", "cold (s)", "warm (s)", "snapshot (s)");
+   for (size_t i_file = 0; i_file < input_file_names.size(); i_file++) {
+      printf("  %-30s %12.2f %12.2f %12.2f\n", input_file_names[i_file].c_str(), cold_times[i_file], warm_times[i_file], snapshot_times[i_file]);
+      total_cold_time += cold_times[i_file];
+      total_warm_time += warm_times[i_file];
+   }
+   printf("  CPU time from the start:    %12.2f s\n", total_cold_time);
+   printf("  CPU time from the snapshot: %12.2f s\n", total_warm_time);
+   printf("  CPU time saved:             %12.2f s = %.4f CPU-hours (%.1f%%)\n", total_cold_time - total_warm_time,
+      (total_cold_time - total_warm_time) / 3600.0, total_cold_time > 0.0 ? 100.0 * (total_cold_time - total_warm_time) / total_cold_time : 0.0);
+   return 0;
+}
 
 int main(int argc, char** argv) {
-   if (argc != 2) {
-      std::cerr << "Incorrect syntax. Expected syntax is `openfast_cpp input.fst`" << std::endl;
+   // openfast_cpp input.fst runs one case through FastLibAPI.
+   // openfast_cpp -j N input1.fst input2.fst ... runs all cases in one process with N workers.
+   // --input-cache DIR reuses the module input data parsed by earlier runs with unchanged input files.
+   // --warm-start-benchmark T N input1.fst [input2.fst ...] compares the CPU time of N copies of each case run from the start
+   // and from a snapshot of the case at time T.
+   int n_workers = 0;
+   bool batch_run = false;
+   std::string input_cache_dir;
+   double t_settle = 0.0;
+   int n_warm_cases = 0;
+   int i_arg = 1;
+   while (i_arg + 1 < argc) {
+      if (strcmp(argv[i_arg], "-j") == 0) {
+         n_workers = atoi(argv[i_arg + 1]);
+         batch_run = true;
+      } else if (strcmp(argv[i_arg], "--warm-start-benchmark") == 0 && i_arg + 2 < argc) {
+         t_settle = atof(argv[i_arg + 1]);
+         n_warm_cases = atoi(argv[i_arg + 2]);
+         i_arg++;
+         if (n_warm_cases < 1) {
+            std::cerr << "The warm start benchmark needs at least one case" << std::endl;
+            return 1;
+         }
+      } else if (strcmp(argv[i_arg], "--input-cache") == 0) {
+         input_cache_dir = argv[i_arg + 1];
+      } else {
+         break;
+      }
+      i_arg += 2;
+   }
+   if (argc - i_arg < 1 || (!batch_run && n_warm_cases == 0 && argc - i_arg != 1) || (batch_run && n_workers < 1)) {
+      std::cerr << "Incorrect syntax. Expected syntax is `openfast_cpp [--input-cache DIR] input.fst` or `openfast_cpp [--input-cache DIR] -j N input1.fst [input2.fst ...]` or `openfast_cpp --warm-start-benchmark T N input1.fst [input2.fst ...]`" << std::endl;
       return 1;
    }
 
-   std::string input_file_name = argv[1];
+   if (!input_cache_dir.empty()) {
+      try {
+         FastLibAPI::set_input_cache(input_cache_dir);
+      } catch (const std::exception & e) {
+         std::cerr << e.what() << std::endl;
+         return 1;
+      }
+   }
+
+   if (n_warm_cases > 0) {
+      return run_warm_start_benchmark(std::vector<std::string>(argv + i_arg, argv + argc), t_settle, n_warm_cases);
+   }
+
+   if (batch_run) {
+      FastBatchRunner batch(n_workers);
+      for (; i_arg < argc; i_arg++) {
+         batch.add_case(argv[i_arg]);
+      }
+      batch.run();
+      batch.print_summary();
+      return batch.cases_failed() > 0 ? 1 : 0;
+   }
+
+   std::string input_file_name = argv[i_arg];
 
    FastLibAPI fastlib = FastLibAPI(input_file_name);
    fastlib.fast_run();
@@ -0,0 +1,142 @@
+#include "FastBatchRunner.h"
+#include <iostream>
+#include <thread>
+#include <chrono>
+#include <math.h>
+#include <stdexcept>
+#include <algorithm>
+
+
+FastBatchRunner::FastBatchRunner(int n_workers):
+n_workers(n_workers),
+next_case(0),
+wall_time(0.0),
+allocated(false)
+{
+    if (n_workers < 1) {
+        throw std::runtime_error( "FastBatchRunner: the number of workers must be at least 1" );
+    }
+}
+
+FastBatchRunner::~FastBatchRunner() {
+    if (allocated) {
+        int _error_status = 0;
+        char _error_message[INTERFACE_STRING_LENGTH];
+        FAST_DeallocateTurbines(&_error_status, _error_message);
+    }
+}
+
+void FastBatchRunner::add_case(std::string input_file, std::shared_ptr<FastOutputSink> output_sink) {
+    Case c;
+    c.input_file_name = input_file;
+    c.output_sink = output_sink;
+    c.error_status = ErrID_None;
+    c.wall_time = 0.0;
+    cases.push_back(c);
+}
+
+void FastBatchRunner::run() {
+    int _error_status = 0;
+    char _error_message[INTERFACE_STRING_LENGTH];
+
+    // One turbine slot per worker, but no more than there are cases. The time steps of different turbines
+    // can only run concurrently if the library was built reentrant (with OpenMP), so use one worker otherwise.
+    bool reentrant = false;
+    FAST_IsReentrant(&reentrant);
+    if (!reentrant && n_workers > 1) {
+        std::cout << "FastBatchRunner: the FAST library was not built reentrant (OPENMP=ON), so the cases run on 1 worker instead of "
+                  << n_workers << std::endl;
+        n_workers = 1;
+    }
+    int n_turbines = std::min(n_workers, (int) cases.size());
+    if (n_turbines == 0) {
+        return;
+    }
+
+    if (!allocated) {
+        FAST_AllocateTurbines(
+            &n_turbines,
+            &_error_status,
+            _error_message
+        );
+        if (_error_status >= ErrID_Fatal) {
+            throw std::runtime_error( "Error " + std::to_string(_error_status) + ": " + _error_message );
+        }
+        allocated = true;
+    }
+
+    std::chrono::steady_clock::time_point t_start = std::chrono::steady_clock::now();
+
+    next_case = 0;
+    std::vector<std::thread> workers;
+    for (int i_turb = 0; i_turb < n_turbines; i_turb++) {
+        workers.push_back(std::thread(&FastBatchRunner::run_worker, this, i_turb));
+    }
+    for (size_t i = 0; i < workers.size(); i++) {
+        workers[i].join();
+    }
+
+    wall_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - t_start).count();
+}
+
+void FastBatchRunner::run_worker(int i_turb) {
+    for (int i_case = next_case++; i_case < (int) cases.size(); i_case = next_case++) {
+        std::chrono::steady_clock::time_point t_start = std::chrono::steady_clock::now();
+        run_case(i_turb, cases[i_case]);
+        cases[i_case].wall_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - t_start).count();
+    }
+}
+
+void FastBatchRunner::run_case(int i_turb, Case &c) {
+    FastLibAPI fastlib(c.input_file_name, i_turb);
+    if (c.output_sink) {
+        fastlib.set_output_sink(c.output_sink);
+    } else {
+        fastlib.set_output_sink(std::make_shared<CallbackOutputSink>([](int, const double *, int) {}));
+    }
+
+    try {
+        bool reentrant = false;
+        {
+            std::lock_guard<std::mutex> lock(library_mutex);
+            fastlib.fast_init();
+            fastlib.fast_start();
+            FAST_IsTurbineReentrant(&i_turb, &reentrant);
+        }
+        if (reentrant) {
+            fastlib.fast_sim();
+        } else {
+            std::lock_guard<std::mutex> lock(serial_mutex);
+            fastlib.fast_sim();
+        }
+    } catch (const std::exception &e) {
+        c.error_status = ErrID_Fatal;
+        c.error_message = e.what();
+    }
+
+    // Deallocate all the internal variables and allocatable arrays of the turbine, so that the slot can be reused
+    std::lock_guard<std::mutex> lock(library_mutex);
+    fastlib.fast_deinit();
+}
+
+int FastBatchRunner::cases_failed() const {
+    int n_failed = 0;
+    for (size_t i = 0; i < cases.size(); i++) {
+        if (cases[i].error_status != ErrID_None) n_failed++;
+    }
+    return n_failed;
+}
+
+double FastBatchRunner::cases_per_hour() const {
+    return (wall_time > 0.0) ? 3600.0 * cases.size() / wall_time : 0.0;
+}
+
+void FastBatchRunner::print_summary() const {
+    for (size_t i = 0; i < cases.size(); i++) {
+        if (cases[i].error_status != ErrID_None) {
+            std::cout << "Case " << cases[i].input_file_name << " failed: " << cases[i].error_message << std::endl;
+        }
+    }
+    std::cout << "Ran " << cases.size() << " cases (" << cases_failed() << " failed) on " << std::min(n_workers, (int) cases.size())
+              << " workers in " << wall_time << " s = " << cases_per_hour() << " cases per hour" << std::endl;
+}
@@ -0,0 +1,65 @@
+#ifndef FastBatchRunner_h
+#define FastBatchRunner_h
+
+#include "FAST_Library.h"
+#include "FastLibAPI.h"
+#include "FastOutputSink.h"
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+
+// Runs many independent single-turbine simulations (e.g. the cases of a load sweep) in one process.
+// The FAST library is allocated once with one turbine slot per worker thread. Each worker takes the
+// next case, runs it with a FastLibAPI on its own slot and then reuses the slot for the next case until
+// all cases are done.
+//
+// fast_init, fast_start and fast_deinit are serialized across the workers with library_mutex, since they use
+// global data in the FAST library (e.g. n_t_global, the error variables and file unit numbers). The time steps
+// only use the data of their turbine and run concurrently. That requires a reentrant build of the library
+// (see FAST_IsReentrant); otherwise run() uses a single worker. The time steps of a case whose configuration
+// is not reentrant (see FAST_IsTurbineReentrant) are serialized with the other such cases with serial_mutex.
+class FastBatchRunner {
+
+    public:
+
+        struct Case {
+            std::string input_file_name;
+            std::shared_ptr<FastOutputSink> output_sink; // Receives the outputs of the case - May be null
+            int error_status; // ErrID_None if the case ran to the end, ErrID_Fatal if an error aborted it
+            std::string error_message; // The error that aborted the case
+            double wall_time; // Wall clock time (s) to run the case
+        };
+
+    private:
+        int n_workers;
+        std::vector<Case> cases;
+        std::atomic<int> next_case;
+        std::mutex library_mutex;
+        std::mutex serial_mutex;
+        double wall_time;
+        bool allocated;
+
+        void run_worker(int i_turb);
+        void run_case(int i_turb, Case &c);
+
+    public:
+
+        // Constructor
+        FastBatchRunner(int n_workers);
+
+        // Destructor
+        ~FastBatchRunner();
+
+        void add_case(std::string input_file, std::shared_ptr<FastOutputSink> output_sink = nullptr);
+        void run();
+
+        const std::vector<Case> &get_cases() const { return cases; }
+        int cases_failed() const;
+        double get_wall_time() const { return wall_time; }
+        double cases_per_hour() const;
+        void print_summary() const;
+};
+
+#endif
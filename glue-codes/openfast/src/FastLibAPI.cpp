@@ -7,6 +7,8 @@
 #include <math.h>
 #include <cstring>
 #include <stdexcept>
+#include <algorithm>
+#include <ctype.h>
 
 
 FastLibAPI::FastLibAPI(std::string input_file):
@@ -19,15 +21,53 @@ abort_error_level(4),
 end_early(false),
 num_outs(0),
 num_inputs(NumFixedInputs),
-ended(false)
+ended(false),
+owns_turbines(true),
+n_t_global(-1),
+output_pending(false),
+output_sink(std::make_shared<MemoryOutputSink>())
 {
     input_file_name = input_file;
 }
 
+FastLibAPI::FastLibAPI(std::string input_file, int i_turb):
+FastLibAPI(input_file)
+{
+    this->i_turb = i_turb;
+    owns_turbines = false;
+}
+
 FastLibAPI::~FastLibAPI() {
     fast_deinit();
 }
 
+void FastLibAPI::set_output_sink(std::shared_ptr<FastOutputSink> sink) {
+    if (!sink) {
+        throw std::runtime_error( "FastLibAPI: the output sink must not be null" );
+    }
+    output_sink = sink;
+}
+
+void FastLibAPI::set_input_cache(const std::string & cache_dir) {
+    int _error_status = 0;
+    char _error_message[INTERFACE_STRING_LENGTH];
+    char _cache_dir[INTERFACE_STRING_LENGTH] = {};
+
+    if (cache_dir.size() >= INTERFACE_STRING_LENGTH) {
+        throw std::runtime_error( "FastLibAPI: the input cache directory name is too long: " + cache_dir );
+    }
+    strncpy(_cache_dir, cache_dir.c_str(), INTERFACE_STRING_LENGTH - 1);
+
+    FAST_SetInputCache(
+        _cache_dir,
+        &_error_status,
+        _error_message
+    );
+    if (_error_status >= ErrID_Fatal) {
+        throw std::runtime_error( "Error " + std::to_string(_error_status) + ": " + _error_message );
+    }
+}
+
 bool FastLibAPI::fatal_error(int error_status) {
     return error_status >= abort_error_level;
 }
@@ -39,13 +79,15 @@ void FastLibAPI::fast_init() {
 
     std::cout << input_file_name;
 
-    FAST_AllocateTurbines(
-        &n_turbines,
-        &_error_status,
-        _error_message
-    );
-    if (fatal_error(_error_status)) {
-        throw std::runtime_error( "Error " + std::to_string(_error_status) + ": " + _error_message );
+    if (owns_turbines) {
+        FAST_AllocateTurbines(
+            &n_turbines,
+            &_error_status,
+            _error_message
+        );
+        if (fatal_error(_error_status)) {
+            throw std::runtime_error( "Error " + std::to_string(_error_status) + ": " + _error_message );
+        }
     }
 
     FAST_Sizes(
@@ -64,8 +106,13 @@ void FastLibAPI::fast_init() {
         throw std::runtime_error( "Error " + std::to_string(_error_status) + ": " + _error_message );
     }
 
-    // Allocate the data for the outputs
-    output_values.resize(total_output_steps(), std::vector<double>(num_outs, 0));
+    n_t_global = -1;
+    set_output_channels(channel_names);
+}
+
+void FastLibAPI::set_output_channels(const char *channel_names) {
+    // Allocate the data for the outputs of one time step
+    output_array.assign(num_outs, 0.0);
 
     // Get output channel names
     std::istringstream ss(channel_names);
@@ -75,9 +122,62 @@ void FastLibAPI::fast_init() {
     {
         output_channel_names.push_back(channel_name);
     }
+    all_channel_names = output_channel_names;
+
+    output_sink->begin(output_channel_names, total_output_steps());
+}
+
+static bool same_channel_name(const std::string & a, const std::string & b) {
+    // Channel names are case insensitive, like the OutList entries they come from
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); i++) {
+        if (toupper(a[i]) != toupper(b[i])) {
+            return false;
+        }
+    }
+    return true;
 }
 
-void FastLibAPI::fast_sim() {
+void FastLibAPI::subscribe_output_channels(const std::vector<std::string> & channel_names) {
+    int _error_status = 0;
+    char _error_message[INTERFACE_STRING_LENGTH];
+
+    // Indices in the channel list of FAST_Sizes, where 1 is the time
+    std::vector<int> channel_indices;
+    std::vector<std::string> subscribed_names(1, all_channel_names.empty() ? "Time" : all_channel_names[0]);
+    for (size_t i = 0; i < channel_names.size(); i++) {
+        size_t i_channel = 1;
+        while (i_channel < all_channel_names.size() && !same_channel_name(all_channel_names[i_channel], channel_names[i])) {
+            i_channel++;
+        }
+        if (i_channel >= all_channel_names.size()) {
+            throw std::runtime_error( "FastLibAPI: unknown output channel: " + channel_names[i] );
+        }
+        channel_indices.push_back(i_channel + 1);
+        subscribed_names.push_back(all_channel_names[i_channel]);
+    }
+
+    int num_channels = channel_indices.size();
+    FAST_SetOutputChannels(
+        &i_turb,
+        &num_channels,
+        channel_indices.data(),
+        &_error_status,
+        _error_message
+    );
+    if (fatal_error(_error_status)) {
+        throw std::runtime_error( "Error " + std::to_string(_error_status) + ": " + _error_message );
+    }
+
+    output_channel_names = num_channels > 0 ? subscribed_names : all_channel_names;
+    num_outs = output_channel_names.size();
+    output_array.assign(num_outs, 0.0);
+    output_sink->begin(output_channel_names, total_output_steps());
+}
+
+void FastLibAPI::fast_start() {
     int _error_status = 0;
     char _error_message[INTERFACE_STRING_LENGTH];
 
@@ -86,42 +186,177 @@ void FastLibAPI::fast_sim() {
         &num_inputs,
         &num_outs,
         inp_array,
-        output_values[0].data(),
+        output_array.data(),
         &_error_status,
         _error_message
     );
     if (fatal_error(_error_status)) {
-        fast_deinit();
+        if (owns_turbines) fast_deinit();
         throw std::runtime_error( "Error " + std::to_string(_error_status) + ": " + _error_message );
     }
+    output_sink->write(0, output_array.data(), num_outs);
+    n_t_global = 0;
+    output_pending = false;
+}
+
+void FastLibAPI::fast_advance(int n_t_end) {
+    // Runs the time steps n_t_global+1 through n_t_end, or until OpenFAST ends the simulation early
+    int _error_status = 0;
+    char _error_message[INTERFACE_STRING_LENGTH];
 
     int output_frequency = round(dt_out/dt);
-    int i_out = 1;
 
-    for (int i=1; i<total_time_steps(); i++) {
-        FAST_Update(
+    // A turbine slot steps from its own time step counter in the library, not from the one shared by all turbines
+    void (*update)(int *, int *, int *, double *, double *, bool *, int *, char *) = owns_turbines ? FAST_Update : FAST_UpdateTurbine;
+
+    while (n_t_global < n_t_end && !end_early) {
+        update(
             &i_turb,
             &num_inputs,
             &num_outs,
             inp_array,
-            output_values[i_out].data(),
+            output_array.data(),
             &end_early,
             &_error_status,
             _error_message
         );
-        if (i%output_frequency == 0) {
-            i_out++;
+        n_t_global++;
+        output_pending = true;
+        if (n_t_global%output_frequency == 0) {
+            output_sink->write(n_t_global/output_frequency, output_array.data(), num_outs);
+            output_pending = false;
         }
         if (fatal_error(_error_status)) {
-            fast_deinit();
+            if (owns_turbines) fast_deinit();
             throw std::runtime_error( "Error " + std::to_string(_error_status) + ": " + _error_message );
         }
-        if (end_early) {
-            break;
+    }
+}
+
+bool FastLibAPI::fast_step() {
+    // Runs the next time step and returns whether there are more to run
+    if (n_t_global < 0) {
+        throw std::runtime_error( "FastLibAPI: fast_start must be called before fast_step" );
+    }
+    if (n_t_global < total_time_steps() - 1) {
+        fast_advance(n_t_global + 1);
+    }
+    return n_t_global < total_time_steps() - 1 && !end_early;
+}
+
+void FastLibAPI::fast_sim() {
+    if (n_t_global < 0) {
+        fast_start();
+    }
+    fast_advance(total_time_steps() - 1);
+
+    // The last time step may not fall on an output step
+    int output_frequency = round(dt_out/dt);
+    int i_out = n_t_global/output_frequency + 1;
+    if (output_pending && i_out < total_output_steps()) {
+        output_sink->write(i_out, output_array.data(), num_outs);
+    }
+    output_pending = false;
+    output_sink->end();
+
+}
+
+void FastLibAPI::fast_snapshot(double t_settle, const std::string & snapshot_root) {
+    int _error_status = 0;
+    char _error_message[INTERFACE_STRING_LENGTH];
+    char _snapshot_root[INTERFACE_STRING_LENGTH] = {};
+
+    if (!owns_turbines) {
+        // FAST_CreateCheckpoint saves the time step counter shared by all turbines, which a turbine slot does not advance
+        throw std::runtime_error( "FastLibAPI: fast_snapshot is not supported on a turbine slot" );
+    }
+    if (snapshot_root.empty() || snapshot_root.size() >= INTERFACE_STRING_LENGTH) {
+        throw std::runtime_error( "FastLibAPI: invalid snapshot root name: " + snapshot_root );
+    }
+    strncpy(_snapshot_root, snapshot_root.c_str(), INTERFACE_STRING_LENGTH - 1);
+
+    int n_t_settle = round(t_settle/dt);
+    if (n_t_settle < 0 || n_t_settle >= total_time_steps() - 1) {
+        throw std::runtime_error( "FastLibAPI: the settling time must be between 0 and TMax" );
+    }
+    if (n_t_global > n_t_settle) {
+        throw std::runtime_error( "FastLibAPI: the simulation is already past the settling time" );
+    }
+
+    if (n_t_global < 0) {
+        fast_start();
+    }
+    fast_advance(n_t_settle);
+    if (end_early) {
+        throw std::runtime_error( "FastLibAPI: the simulation ended before the settling time" );
+    }
+
+    FAST_CreateCheckpoint(
+        &i_turb,
+        _snapshot_root,
+        &_error_status,
+        _error_message
+    );
+    if (fatal_error(_error_status)) {
+        throw std::runtime_error( "Error " + std::to_string(_error_status) + ": " + _error_message );
+    }
+}
+
+void FastLibAPI::fast_warm_start(const std::string & snapshot_root, const std::string & out_file_root) {
+    int _error_status = 0;
+    char _error_message[INTERFACE_STRING_LENGTH];
+    char channel_names[MAXIMUM_OUTPUTS * CHANNEL_LENGTH + 1];
+    char _snapshot_root[INTERFACE_STRING_LENGTH] = {};
+    char _out_file_root[INTERFACE_STRING_LENGTH] = {};
+
+    if (snapshot_root.empty() || snapshot_root.size() >= INTERFACE_STRING_LENGTH) {
+        throw std::runtime_error( "FastLibAPI: invalid snapshot root name: " + snapshot_root );
+    }
+    if (out_file_root.empty() || out_file_root.size() >= INTERFACE_STRING_LENGTH) {
+        throw std::runtime_error( "FastLibAPI: invalid output file root name: " + out_file_root );
+    }
+    strncpy(_snapshot_root, snapshot_root.c_str(), INTERFACE_STRING_LENGTH - 1);
+    strncpy(_out_file_root, out_file_root.c_str(), INTERFACE_STRING_LENGTH - 1);
+
+    if (owns_turbines) {
+        FAST_AllocateTurbines(
+            &n_turbines,
+            &_error_status,
+            _error_message
+        );
+        if (fatal_error(_error_status)) {
+            throw std::runtime_error( "Error " + std::to_string(_error_status) + ": " + _error_message );
         }
     }
 
+    FAST_WarmStart(
+        &i_turb,
+        _snapshot_root,
+        _out_file_root,
+        &abort_error_level,
+        &num_outs,
+        &dt,
+        &dt_out,
+        &t_max,
+        &n_t_global,
+        &_error_status,
+        _error_message,
+        channel_names
+    );
+    if (fatal_error(_error_status)) {
+        throw std::runtime_error( "Error " + std::to_string(_error_status) + ": " + _error_message );
+    }
+
+    // The outputs up to the snapshot belong to the case that created it
+    output_pending = false;
+    set_output_channels(channel_names);
+}
 
+void FastLibAPI::set_external_inputs(const std::vector<double> & inputs) {
+    if (inputs.size() > NumFixedInputs) {
+        throw std::runtime_error( "FastLibAPI: too many external inputs" );
+    }
+    std::copy(inputs.begin(), inputs.end(), inp_array);
 }
 
 void FastLibAPI::fast_deinit() {
@@ -142,6 +377,10 @@ void FastLibAPI::fast_deinit() {
         &stop_the_program
     );
 
+    if (!owns_turbines) {
+        return;
+    }
+
     // Deallocate the Turbine array
     FAST_DeallocateTurbines(
         &_error_status,
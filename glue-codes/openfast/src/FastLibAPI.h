@@ -2,9 +2,11 @@
 #define FastLibAPI_h
 
 #include "FAST_Library.h"
+#include "FastOutputSink.h"
 #include <string>
 #include <stdlib.h>
 #include <vector>
+#include <memory>
 
 class FastLibAPI {
 
@@ -20,6 +22,12 @@ class FastLibAPI {
         bool end_early;
         int num_outs;
         bool ended;
+        // Whether this instance allocates and deallocates the turbines of the FAST library (false for a turbine slot)
+        bool owns_turbines;
+        // Number of time steps done, -1 before FAST_Start
+        int n_t_global;
+        // Whether output_array holds the values of an output step that were not passed on to output_sink yet
+        bool output_pending;
 
         // The inputs are meant to be from Simulink.
         // If < NumFixedInputs, FAST_SetExternalInputs simply returns,
@@ -28,15 +36,28 @@ class FastLibAPI {
         int num_inputs;
         double inp_array[NumFixedInputs] = {};
 
-        // These arrays hold the outputs from OpenFAST
-        // output_values is a 2D array for the values from all steps in the simulation
-        std::vector<std::vector<double>> output_values;
+        // output_array holds the outputs from OpenFAST at the current time step.
+        // The values at each output step are passed on to output_sink.
+        std::vector<double> output_array;
+        // All output channels of the turbine, including those not subscribed to
+        std::vector<std::string> all_channel_names;
+        std::shared_ptr<FastOutputSink> output_sink;
+
+        void set_output_channels(const char *channel_names);
+        void fast_advance(int n_t_end);
 
     public:
 
         // Constructor
         FastLibAPI(std::string input_file);
 
+        // Constructor for turbine i_turb of a FAST library whose turbines the caller allocates (FAST_AllocateTurbines) and
+        // deallocates, e.g. FastBatchRunner. The time steps use FAST_UpdateTurbine, so instances on different turbines can
+        // step concurrently if their configurations are reentrant (see FAST_IsTurbineReentrant). fast_init, fast_start, fast_warm_start and fast_deinit use global data in
+        // the library and must be serialized by the caller, which also calls fast_deinit after an error.
+        // fast_snapshot is not supported.
+        FastLibAPI(std::string input_file, int i_turb);
+
         // Destructor
         ~FastLibAPI();
 
@@ -45,9 +66,45 @@ class FastLibAPI {
         void fast_sim();
         void fast_deinit();
         void fast_run();
+
+        // Real-time use (e.g. hardware in the loop): call fast_start once and then fast_step once per time step, updating
+        // the external inputs in between. After the first time steps, a step makes no heap allocations in this class or in
+        // the C interface of the FAST library (FAST_Update and FAST_UpdateTurbine), provided the output sink does not
+        // allocate in write() (the default MemoryOutputSink and RingBufferOutputSink do not). With ElastoDyn alone, the
+        // time steps make no heap allocations either, except those in which the simulation status is written to the
+        // screen (every SttsTime seconds): openfast_latency counts allocations in 20 of 4,000 steps with SttsTime=1 s.
+        // Other modules have not been audited and may still allocate in their calculations. Writing the text output file
+        // allocates too; use binary output files (OutFileFmt=2) to avoid formatted writes in the time steps.
+        // See openfast_latency for a harness that measures the step latency and counts the allocations.
+        void fast_start();
+        bool fast_step();
+
+        // Warm start: a case is run once to a settled state with fast_init and fast_snapshot, which saves the state of the
+        // turbine in the checkpoint file snapshot_root.chkp. Any number of cases can then start from that state with
+        // fast_warm_start instead of fast_init and continue to the end with fast_sim, skipping the start-up transient.
+        // The cases write their output files with the root name out_file_root and may differ in their external inputs.
+        void fast_snapshot(double t_settle, const std::string & snapshot_root);
+        void fast_warm_start(const std::string & snapshot_root, const std::string & out_file_root);
+        void set_external_inputs(const std::vector<double> & inputs);
+        double current_time() const { return n_t_global < 0 ? 0.0 : n_t_global * dt; }
+        double get_dt() const { return dt; }
         int total_time_steps();
         int total_output_steps();
         std::vector<std::string> output_channel_names;
+
+        // Parsed module input data are cached in cache_dir and reused by later initializations of any
+        // turbine in this process whose input files are unchanged. An empty directory disables the cache.
+        static void set_input_cache(const std::string & cache_dir);
+
+        // Subscribes to a subset of output_channel_names after fast_init (or fast_warm_start) and before the first time step,
+        // so that each time step only copies those channels. output_channel_names then holds "Time" followed by the subscribed
+        // channels, and the output sink is restarted with them. An empty list subscribes to all channels again.
+        // The channels written to the OpenFAST output files are not affected.
+        void subscribe_output_channels(const std::vector<std::string> & channel_names);
+
+        // The sink must be set before fast_init. Defaults to a MemoryOutputSink.
+        void set_output_sink(std::shared_ptr<FastOutputSink> sink);
+        std::shared_ptr<FastOutputSink> get_output_sink() { return output_sink; }
         void get_hub_position(float *absolute_position, float *rotational_velocity, double *orientation_dcm);
 };
 
@@ -0,0 +1,96 @@
+#include "FastOutputSink.h"
+#include "FAST_Library.h"
+#include <algorithm>
+#include <stdexcept>
+#include <stdint.h>
+
+
+MemoryOutputSink::MemoryOutputSink():
+num_channels(0),
+num_steps(0)
+{
+}
+
+void MemoryOutputSink::begin(const std::vector<std::string> &channel_names, int total_output_steps) {
+    num_channels = channel_names.size();
+    num_steps = total_output_steps;
+    output_values.assign(num_steps * num_channels, 0.0);
+}
+
+void MemoryOutputSink::write(int i_out, const double *values, int num_outs) {
+    if (i_out < num_steps) {
+        std::copy(values, values + num_outs, &output_values[i_out * num_channels]);
+    }
+}
+
+
+RingBufferOutputSink::RingBufferOutputSink(int capacity):
+capacity(capacity),
+num_channels(0),
+num_written(0),
+last_step(-1)
+{
+    if (capacity < 1) {
+        throw std::runtime_error( "RingBufferOutputSink: capacity must be at least 1" );
+    }
+}
+
+void RingBufferOutputSink::begin(const std::vector<std::string> &channel_names, int /*total_output_steps*/) {
+    num_channels = channel_names.size();
+    num_written = 0;
+    last_step = -1;
+    output_values.assign(capacity * num_channels, 0.0);
+}
+
+void RingBufferOutputSink::write(int i_out, const double *values, int num_outs) {
+    std::copy(values, values + num_outs, &output_values[(i_out % capacity) * num_channels]);
+    num_written++;
+    last_step = i_out;
+}
+
+
+CallbackOutputSink::CallbackOutputSink(callback_t callback):
+callback(callback)
+{
+}
+
+void CallbackOutputSink::write(int i_out, const double *values, int num_outs) {
+    callback(i_out, values, num_outs);
+}
+
+
+BinaryOutputSink::BinaryOutputSink(std::string file_name):
+file_name(file_name)
+{
+}
+
+void BinaryOutputSink::begin(const std::vector<std::string> &channel_names, int /*total_output_steps*/) {
+    if (file.is_open()) {
+        file.close();
+    }
+    file.open(file_name, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error( "BinaryOutputSink: cannot open " + file_name );
+    }
+
+    int32_t header[2] = { 1, (int32_t) channel_names.size() };
+    file.write(reinterpret_cast<const char *>(header), sizeof(header));
+    for (size_t i = 0; i < channel_names.size(); i++) {
+        std::string name = channel_names[i].substr(0, CHANNEL_LENGTH);
+        name.resize(CHANNEL_LENGTH, ' ');
+        file.write(name.data(), CHANNEL_LENGTH);
+    }
+}
+
+void BinaryOutputSink::write(int i_out, const double *values, int num_outs) {
+    int32_t step = i_out;
+    file.write(reinterpret_cast<const char *>(&step), sizeof(step));
+    file.write(reinterpret_cast<const char *>(values), num_outs * sizeof(double));
+}
+
+void BinaryOutputSink::end() {
+    file.close();
+    if (file.fail()) {
+        throw std::runtime_error( "BinaryOutputSink: error writing " + file_name );
+    }
+}
@@ -0,0 +1,104 @@
+#ifndef FastOutputSink_h
+#define FastOutputSink_h
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <functional>
+#include <algorithm>
+
+// Receives the values of all output channels at each output step of a FastLibAPI simulation.
+// FastLibAPI calls begin() once the channels are known, write() for each output step and end()
+// once the simulation is done.
+class FastOutputSink {
+
+    public:
+
+        virtual ~FastOutputSink() {}
+
+        virtual void begin(const std::vector<std::string> & /*channel_names*/, int /*total_output_steps*/) {}
+        virtual void write(int i_out, const double *values, int num_outs) = 0;
+        virtual void end() {}
+};
+
+// Keeps the values of all output steps in memory. This needs total_output_steps x num_outs doubles
+// for the whole simulation.
+class MemoryOutputSink : public FastOutputSink {
+
+    private:
+        int num_channels;
+        int num_steps;
+        std::vector<double> output_values; // (num_steps, num_channels)
+
+    public:
+
+        MemoryOutputSink();
+
+        void begin(const std::vector<std::string> &channel_names, int total_output_steps);
+        void write(int i_out, const double *values, int num_outs);
+
+        int output_steps() const { return num_steps; }
+        const double *values(int i_out) const { return &output_values[i_out * num_channels]; }
+};
+
+// Keeps the values of the most recent 'capacity' output steps in memory.
+class RingBufferOutputSink : public FastOutputSink {
+
+    private:
+        int capacity;
+        int num_channels;
+        int num_written;
+        int last_step;
+        std::vector<double> output_values; // (capacity, num_channels)
+
+    public:
+
+        RingBufferOutputSink(int capacity);
+
+        void begin(const std::vector<std::string> &channel_names, int total_output_steps);
+        void write(int i_out, const double *values, int num_outs);
+
+        // Number of output steps held, at most 'capacity'
+        int size() const { return std::min(num_written, capacity); }
+        // Index of the most recent output step written, -1 if none
+        int latest_step() const { return last_step; }
+        // Values of output step 'i_out', which must be one of the last size() output steps
+        const double *values(int i_out) const { return &output_values[(i_out % capacity) * num_channels]; }
+};
+
+// Passes the values of each output step to a function and keeps nothing.
+class CallbackOutputSink : public FastOutputSink {
+
+    public:
+        typedef std::function<void(int i_out, const double *values, int num_outs)> callback_t;
+
+    private:
+        callback_t callback;
+
+    public:
+
+        CallbackOutputSink(callback_t callback);
+
+        void write(int i_out, const double *values, int num_outs);
+};
+
+// Streams the values of each output step to a binary file and keeps nothing. The file holds:
+//   int32 format version (1), int32 num_outs,
+//   num_outs channel names of CHANNEL_LENGTH characters each, padded with blanks,
+//   then per output step: int32 i_out, num_outs doubles
+class BinaryOutputSink : public FastOutputSink {
+
+    private:
+        std::string file_name;
+        std::ofstream file;
+
+    public:
+
+        BinaryOutputSink(std::string file_name);
+
+        void begin(const std::vector<std::string> &channel_names, int total_output_steps);
+        void write(int i_out, const double *values, int num_outs);
+        void end();
+};
+
+#endif
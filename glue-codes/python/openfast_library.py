@@ -10,13 +10,15 @@ from ctypes import (
     c_bool
 )
 import os
-from typing import List, Tuple
+from typing import List, Optional, Tuple
 import numpy as np
 import math
 
 
 IntfStrLen = 1025    # FAST_Library global
 NumFixedInputs = 51  # FAST_Library global
+ChanLen = 20         # FAST_Library global
+MaxOutputs = 4000    # FAST_Library global
 
 
 class FastLibAPI(CDLL):
@@ -40,6 +42,9 @@ class FastLibAPI(CDLL):
         self.output_channel_names = []
         self.ended = False
 
+        # Number of time steps taken since FAST_Start; the outputs of FAST_Start are at time step 0
+        self.time_step = 0
+
         # The inputs are meant to be from Simulink.
         # If < 51, FAST_SetExternalInputs simply returns,
         # but this behavior may change to an error
@@ -49,9 +54,21 @@ class FastLibAPI(CDLL):
         self.inp_array = (c_double * self.num_inputs.value)(0.0, )
 
         # These arrays hold the outputs from OpenFAST
-        # output_values is a 2D array for the values from all output steps in the simulation
+        # output_values is a 2D array for the values from all output steps in the simulation.
+        # The library writes directly into it, so it is never copied.
         self.output_values = None
 
+        # channel_names is a view of the channel name buffer filled by FAST_Sizes
+        # with one blank-padded bytes entry per output channel.
+        self._channel_names_buffer = create_string_buffer(ChanLen * MaxOutputs + 1)
+        self.channel_names = None
+
+        # Hub state buffers filled in place by get_hub_position
+        self.hub_absolute_position = np.zeros(3, dtype=c_float)
+        self.hub_rotational_velocity = np.zeros(3, dtype=c_float)
+        # The 9 values of the orientation DCM in Fortran (column-major) order, as returned by FAST_HubPosition
+        self.hub_orientation_dcm = np.zeros(9, dtype=c_double)
+
 
     def _initialize_routines(self) -> None:
         self.FAST_AllocateTurbines.argtypes = [
@@ -61,7 +78,7 @@ class FastLibAPI(CDLL):
         ]
         self.FAST_AllocateTurbines.restype = c_int
 
-        self.FAST_Sizes.argtype = [
+        self.FAST_Sizes.argtypes = [
             POINTER(c_int),         # iTurb IN
             POINTER(c_char),        # InputFileName_c IN
             POINTER(c_int),         # AbortErrLev_c OUT
@@ -77,7 +94,16 @@ class FastLibAPI(CDLL):
         ]
         self.FAST_Sizes.restype = c_int
 
-        self.FAST_Start.argtype = [
+        self.FAST_SetOutputChannels.argtypes = [
+            POINTER(c_int),         # iTurb IN
+            POINTER(c_int),         # NumChannels_c IN
+            POINTER(c_int),         # ChannelIndx_c IN
+            POINTER(c_int),         # ErrStat_c OUT
+            POINTER(c_char)         # ErrMsg_c OUT
+        ]
+        self.FAST_SetOutputChannels.restype = c_int
+
+        self.FAST_Start.argtypes = [
             POINTER(c_int),         # iTurb IN
             POINTER(c_int),         # NumInputs_c IN
             POINTER(c_int),         # NumOutputs_c IN
@@ -88,7 +114,7 @@ class FastLibAPI(CDLL):
         ]
         self.FAST_Start.restype = c_int
 
-        self.FAST_Update.argtype = [
+        self.FAST_Update.argtypes = [
             POINTER(c_int),         # iTurb IN
             POINTER(c_int),         # NumInputs_c IN
             POINTER(c_int),         # NumOutputs_c IN
@@ -100,18 +126,64 @@ class FastLibAPI(CDLL):
         ]
         self.FAST_Update.restype = c_int
 
+        self.FAST_UpdateSteps.argtypes = [
+            POINTER(c_int),         # iTurb IN
+            POINTER(c_int),         # nSteps IN
+            POINTER(c_int),         # StepsPerOutput IN
+            POINTER(c_int),         # NumInputs_c IN
+            POINTER(c_int),         # NumOutputs_c IN
+            POINTER(c_double),      # InputAry IN
+            POINTER(c_double),      # OutputAry(NumOutputs_c, *) INOUT
+            POINTER(c_int),         # nStepsDone OUT
+            POINTER(c_bool),        # EndSimulationEarly OUT
+            POINTER(c_int),         # ErrStat_c OUT
+            POINTER(c_char)         # ErrMsg_c OUT
+        ]
+        self.FAST_UpdateSteps.restype = c_int
+
         self.FAST_DeallocateTurbines.argtypes = [
             POINTER(c_int),         # ErrStat_c OUT
             POINTER(c_char),        # ErrMsg_c OUT
         ]
         self.FAST_DeallocateTurbines.restype = c_int
 
+        self.FAST_SetInputCache.argtypes = [
+            POINTER(c_char),        # CacheDir_c IN
+            POINTER(c_int),         # ErrStat_c OUT
+            POINTER(c_char)         # ErrMsg_c OUT
+        ]
+        self.FAST_SetInputCache.restype = c_int
+
         self.FAST_End.argtypes = [
             POINTER(c_int),         # iTurb IN
             POINTER(c_bool),        # StopTheProgram IN
         ]
         self.FAST_End.restype = c_int
 
+        self.FAST_CreateCheckpoint.argtypes = [
+            POINTER(c_int),         # iTurb IN
+            POINTER(c_char),        # CheckpointRootName_c IN
+            POINTER(c_int),         # ErrStat_c OUT
+            POINTER(c_char)         # ErrMsg_c OUT
+        ]
+        self.FAST_CreateCheckpoint.restype = c_int
+
+        self.FAST_WarmStart.argtypes = [
+            POINTER(c_int),         # iTurb IN
+            POINTER(c_char),        # CheckpointRootName_c IN
+            POINTER(c_char),        # OutFileRoot_c IN
+            POINTER(c_int),         # AbortErrLev_c OUT
+            POINTER(c_int),         # NumOuts_c OUT
+            POINTER(c_double),      # dt_c OUT
+            POINTER(c_double),      # dt_out_c OUT
+            POINTER(c_double),      # tmax_c OUT
+            POINTER(c_int),         # n_t_global_c OUT
+            POINTER(c_int),         # ErrStat_c OUT
+            POINTER(c_char),        # ErrMsg_c OUT
+            POINTER(c_char)         # ChannelNames_c OUT
+        ]
+        self.FAST_WarmStart.restype = c_int
+
         self.FAST_HubPosition.argtypes = [
             POINTER(c_int),         # iTurb IN
             POINTER(c_float),       # AbsPosition_c(3) OUT
@@ -127,7 +199,32 @@ class FastLibAPI(CDLL):
         return error_status.value >= self.abort_error_level.value
 
 
-    def fast_init(self) -> None:
+    def set_input_cache(self, cache_dir: str) -> None:
+        """
+        Caches the parsed module input data in cache_dir, so that later initializations in this process
+        whose input files are unchanged skip parsing them. An empty string disables the cache.
+        """
+        _error_status = c_int(0)
+        _error_message = create_string_buffer(IntfStrLen)
+        _cache_dir = os.path.abspath(cache_dir).encode('utf-8') if cache_dir else b""
+        if len(_cache_dir) >= IntfStrLen:
+            raise ValueError(f"The input cache directory name is too long: {cache_dir}")
+
+        self.FAST_SetInputCache(
+            create_string_buffer(_cache_dir, IntfStrLen),
+            byref(_error_status),
+            _error_message
+        )
+        if _error_status.value >= 4:    # ErrID_Fatal; the abort level is only known after FAST_Sizes
+            raise RuntimeError(f"Error {_error_status.value}: {_error_message.value}")
+
+
+    def fast_init(self, output_values: Optional[np.ndarray] = None) -> None:
+        """
+        Allocates the turbine and reads the input file. The outputs of the simulation are written
+        into output_values, which may be given by the caller to avoid a copy into its own storage.
+        It must be a C-contiguous float64 array of shape (total_output_steps, num_outs).
+        """
         _error_status = c_int(0)
         _error_message = create_string_buffer(IntfStrLen)
 
@@ -139,9 +236,6 @@ class FastLibAPI(CDLL):
         if self.fatal_error(_error_status):
             raise RuntimeError(f"Error {_error_status.value}: {_error_message.value}")
 
-        # Create channel names argument
-        channel_names = create_string_buffer(20 * 4000)
-
         self.FAST_Sizes(
             byref(self.i_turb),
             self.input_file_name,
@@ -152,27 +246,74 @@ class FastLibAPI(CDLL):
             byref(self.t_max),
             byref(_error_status),
             _error_message,
-            channel_names,
+            self._channel_names_buffer,
             None,   # Optional arguments must pass C-Null pointer; with ctypes, use None.
             None    # Optional arguments must pass C-Null pointer; with ctypes, use None.
         )
         if self.fatal_error(_error_status):
             raise RuntimeError(f"Error {_error_status.value}: {_error_message.value}")
 
+        self._set_output_channels(output_values)
+
+        # Delete error message character buffer
+        del _error_message
+
+    def _set_output_channels(self, output_values: Optional[np.ndarray]) -> None:
         # Extract channel name strings from argument
-        if len(channel_names.value.split()) == 0:
-            self.output_channel_names = []
-        else:
-            self.output_channel_names = [n.decode('UTF-8') for n in channel_names.value.split()] 
+        self.channel_names = np.frombuffer(self._channel_names_buffer, dtype=f"S{ChanLen}", count=self.num_outs.value)
+        self.output_channel_names = [n.decode('UTF-8').strip() for n in self.channel_names]
+        self._all_channel_names = self.channel_names
+        self._allocate_output_values(output_values)
 
+    def _allocate_output_values(self, output_values: Optional[np.ndarray]) -> None:
         # Allocate the data for the outputs
-        self.output_values = np.zeros( (self.total_output_steps, self.num_outs.value), dtype=c_double, order='C' )
+        output_shape = (self.total_output_steps, self.num_outs.value)
+        if output_values is None:
+            self.output_values = np.zeros( output_shape, dtype=c_double, order='C' )
+        else:
+            if output_values.shape != output_shape or output_values.dtype != np.float64 or not output_values.flags.c_contiguous:
+                raise ValueError(f"output_values must be a C-contiguous float64 array of shape {output_shape}")
+            self.output_values = output_values
+
+    def subscribe_output_channels(self, channel_names: List[str], output_values: Optional[np.ndarray] = None) -> None:
+        """
+        Limits the outputs returned by each time step to the time and the given channels, so that
+        only those are copied from the modules. Call it after fast_init (or fast_warm_start) and before
+        the first time step; output_values is reallocated (or replaced by the given array) to the new
+        number of channels. An empty list restores all the channels. The OpenFAST output files still
+        hold all the channels.
+        """
+        _error_status = c_int(0)
+        _error_message = create_string_buffer(IntfStrLen)
 
-        # Delete error message and channel name character buffers
-        del _error_message
-        del channel_names
+        # Channel names are case insensitive; indices are 1-based in the FAST_Sizes list, where 1 is the time
+        all_names = [n.decode('UTF-8').strip().upper() for n in self._all_channel_names]
+        indices = []
+        for name in channel_names:
+            if name.upper() not in all_names[1:]:
+                raise ValueError(f"Unknown output channel: {name}")
+            indices.append(all_names.index(name.upper(), 1) + 1)
+        _channel_indices = (c_int * max(len(indices), 1))(*indices)
 
-    def fast_sim(self) -> None:
+        self.FAST_SetOutputChannels(
+            byref(self.i_turb),
+            byref(c_int(len(indices))),
+            _channel_indices,
+            byref(_error_status),
+            _error_message
+        )
+        if self.fatal_error(_error_status):
+            raise RuntimeError(f"Error {_error_status.value}: {_error_message.value}")
+
+        if indices:
+            self.channel_names = self._all_channel_names[[0] + [i - 1 for i in indices]]
+        else:
+            self.channel_names = self._all_channel_names
+        self.output_channel_names = [n.decode('UTF-8').strip() for n in self.channel_names]
+        self.num_outs = c_int(len(self.channel_names))
+        self._allocate_output_values(output_values)
+
+    def fast_start(self) -> None:
         _error_status = c_int(0)
         _error_message = create_string_buffer(IntfStrLen)
 
@@ -180,7 +321,7 @@ class FastLibAPI(CDLL):
             byref(self.i_turb),
             byref(self.num_inputs),
             byref(self.num_outs),
-            byref(self.inp_array),
+            self.inp_array,
             self.output_values[0].ctypes.data_as(POINTER(c_double)),
             byref(_error_status),
             _error_message
@@ -189,28 +330,115 @@ class FastLibAPI(CDLL):
             self.fast_deinit()
             raise RuntimeError(f"Error {_error_status.value}: {_error_message.value}")
 
-        # Calculate output frequency and initialize output index
+        self.time_step = 0
+
+
+    def step(self, n_steps: int = 1) -> int:
+        """
+        Advances the simulation by up to n_steps time steps in a single call into the library and
+        returns the number of time steps taken. Fewer steps are taken at the end of the simulation
+        or if it ends early. The outputs are written directly into the rows of output_values.
+        """
+        _error_status = c_int(0)
+        _error_message = create_string_buffer(IntfStrLen)
+
+        n_steps = min(n_steps, self.total_time_steps - 1 - self.time_step)
+        if n_steps <= 0 or self.end_early:
+            return 0
+
+        # Output step i_out holds the last time step i with (i - 1) // output_frequency + 1 == i_out
         output_frequency = round(self.dt_out.value/self.dt.value)
-        i_out = 1
+        i_out = self.time_step // output_frequency + 1
+        n_steps_done = c_int(0)
 
-        for i in range( 1, self.total_time_steps ):
-            self.FAST_Update(
-                byref(self.i_turb),
-                byref(self.num_inputs),
-                byref(self.num_outs),
-                byref(self.inp_array),
-                self.output_values[i_out].ctypes.data_as(POINTER(c_double)),
-                byref(self.end_early),
-                byref(_error_status),
-                _error_message
-            )
-            if i%output_frequency == 0:
-                i_out += 1
-            if self.fatal_error(_error_status):
-                self.fast_deinit()
-                raise RuntimeError(f"Error {_error_status.value}: {_error_message.value}")
-            if self.end_early:
-                break
+        self.FAST_UpdateSteps(
+            byref(self.i_turb),
+            byref(c_int(n_steps)),
+            byref(c_int(output_frequency)),
+            byref(self.num_inputs),
+            byref(self.num_outs),
+            self.inp_array,
+            self.output_values[i_out:].ctypes.data_as(POINTER(c_double)),
+            byref(n_steps_done),
+            byref(self.end_early),
+            byref(_error_status),
+            _error_message
+        )
+        self.time_step += n_steps_done.value
+        if self.fatal_error(_error_status):
+            self.fast_deinit()
+            raise RuntimeError(f"Error {_error_status.value}: {_error_message.value}")
+
+        return n_steps_done.value
+
+
+    def fast_sim(self) -> None:
+        self.fast_start()
+        self.step(self.total_time_steps - 1)
+
+
+    def fast_snapshot(self, t_settle: float, snapshot_root: str) -> None:
+        """
+        Advances a simulation started with fast_start to time t_settle and saves the state of the turbine
+        in the checkpoint file snapshot_root.chkp, from which fast_warm_start can start other cases.
+        """
+        _error_status = c_int(0)
+        _error_message = create_string_buffer(IntfStrLen)
+
+        n_settle = round(t_settle / self.dt.value)
+        if n_settle < self.time_step or n_settle >= self.total_time_steps - 1:
+            raise ValueError(f"The settling time must be between the current time and TMax: {t_settle}")
+        self.step(n_settle - self.time_step)
+        if self.time_step != n_settle:
+            raise RuntimeError("The simulation ended before the settling time")
+
+        self.FAST_CreateCheckpoint(
+            byref(self.i_turb),
+            create_string_buffer(os.path.abspath(snapshot_root).encode('utf-8'), IntfStrLen),
+            byref(_error_status),
+            _error_message
+        )
+        if self.fatal_error(_error_status):
+            raise RuntimeError(f"Error {_error_status.value}: {_error_message.value}")
+
+
+    def fast_warm_start(self, snapshot_root: str, out_file_root: str, output_values: Optional[np.ndarray] = None) -> None:
+        """
+        Allocates the turbine from the checkpoint file written by fast_snapshot instead of reading the input file.
+        The case writes its output files with the root name out_file_root. Call step() to continue it; the
+        rows of output_values before the snapshot are left untouched.
+        """
+        _error_status = c_int(0)
+        _error_message = create_string_buffer(IntfStrLen)
+        n_t_global = c_int(0)
+
+        self.FAST_AllocateTurbines(
+            byref(self.n_turbines),
+            byref(_error_status),
+            _error_message
+        )
+        if self.fatal_error(_error_status):
+            raise RuntimeError(f"Error {_error_status.value}: {_error_message.value}")
+
+        self.FAST_WarmStart(
+            byref(self.i_turb),
+            create_string_buffer(os.path.abspath(snapshot_root).encode('utf-8'), IntfStrLen),
+            create_string_buffer(os.path.abspath(out_file_root).encode('utf-8'), IntfStrLen),
+            byref(self.abort_error_level),
+            byref(self.num_outs),
+            byref(self.dt),
+            byref(self.dt_out),
+            byref(self.t_max),
+            byref(n_t_global),
+            byref(_error_status),
+            _error_message,
+            self._channel_names_buffer
+        )
+        if self.fatal_error(_error_status):
+            raise RuntimeError(f"Error {_error_status.value}: {_error_message.value}")
+
+        self._set_output_channels(output_values)
+        self.time_step = n_t_global.value
 
 
     def fast_deinit(self) -> None:
@@ -266,24 +494,24 @@ class FastLibAPI(CDLL):
 
 
     def get_hub_position(self) -> Tuple:
+        """
+        Returns the hub absolute position, rotational velocity and orientation DCM as NumPy arrays.
+        The DCM holds its 9 values in Fortran (column-major) order; use reshape((3, 3), order='F') for the matrix.
+        The arrays are filled in place on each call, so copy them to keep the values of a previous call.
+        """
         _error_status = c_int(0)
         _error_message = create_string_buffer(IntfStrLen)
 
-        # Data buffers
-        absolute_position = (c_float * 3)(0.0, )
-        rotational_velocity = (c_float * 3)(0.0, )
-        orientation_dcm = (c_double * 9)(0.0, )
-
         # Get hub position from the fast library
         self.FAST_HubPosition(
             byref(self.i_turb),
-            absolute_position,
-            rotational_velocity,
-            orientation_dcm,
+            self.hub_absolute_position.ctypes.data_as(POINTER(c_float)),
+            self.hub_rotational_velocity.ctypes.data_as(POINTER(c_float)),
+            self.hub_orientation_dcm.ctypes.data_as(POINTER(c_double)),
             byref(_error_status),
             _error_message            
         )
         if self.fatal_error(_error_status):
             raise RuntimeError(f"Error {_error_status.value}: {_error_message.value}")
 
-        return absolute_position, rotational_velocity, orientation_dcm
+        return self.hub_absolute_position, self.hub_rotational_velocity, self.hub_orientation_dcm
@@ -31,42 +31,95 @@
 #include "matrix.h"  // for mxCreateDoubleScalar
 #include "FAST_Library.h"
 #include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
 #define min(a,b) fmin(a,b)
 
 
 #define PARAM_FILENAME 0
 #define PARAM_TMAX 1
 #define PARAM_ADDINPUTS 2
-#define NUM_PARAM 3
+#define PARAM_TURBINE 3     // optional: number of this block's turbine (1 to NumTurbines); default 1
+#define PARAM_NTURBINES 4   // optional: number of FAST blocks (turbines) in the model; default 1
+#define PARAM_PARALLEL 5    // optional: nonzero to step the turbine in a worker thread, in parallel with the other blocks; default 0
+#define NUM_PARAM_REQUIRED 3
+#define NUM_PARAM 6
 
 // two DWork arrays:
 #define WORKARY_OUTPUT 0
 #define WORKARY_INPUT 1
 
 
-static double dt = 0;
-static double dt_out = 0;
-static double TMax = 0;
-static int NumInputs = NumFixedInputs;
-static int NumAddInputs = 0;  // number of additional inputs
-static int NumOutputs = 1;
-static bool EndEarly = false;
-static int ErrStat = 0;
-static char ErrMsg[INTERFACE_STRING_LENGTH];        // make sure this is the same size as IntfStrLen in FAST_Library.f90
-static int ErrStat2 = 0;
-static char ErrMsg2[INTERFACE_STRING_LENGTH];        // make sure this is the same size as IntfStrLen in FAST_Library.f90
-static char InputFileName[INTERFACE_STRING_LENGTH]; // make sure this is the same size as IntfStrLen in FAST_Library.f90
-static int n_t_global = -2;  // counter to determine which fixed-step simulation time we are at currently (start at -2 for initialization)
-static int AbortErrLev = ErrID_Fatal;      // abort error level; compare with NWTC Library
+// Worker thread that steps the turbine of one block (used when the block's PARAM_PARALLEL is set)
+typedef struct {
+#ifdef _WIN32
+   HANDLE thread;
+   HANDLE startEvent;         // auto-reset; set to request a time step (or to quit)
+   HANDLE doneEvent;          // manual-reset; set while no time step is pending
+#else
+   pthread_t thread;
+   pthread_mutex_t mutex;
+   pthread_cond_t cond;
+   bool pending;              // a time step is requested or running
+#endif
+   bool quit;
+} StepWorker;
+
+// Data of one FAST block, kept with ssSetUserData from mdlInitializeSizes (which needs FAST_Sizes for the port widths, before 
+// any work vectors exist) until mdlTerminate, so that several FAST blocks can run different turbines in one model
+typedef struct {
+   int iTurb;                 // turbine of this block in the FAST library (zero based)
+   bool OwnsTurbine;          // iTurb is reserved for this block in TurbineInUse
+   double dt;
+   double dt_out;
+   double TMax;
+   int NumInputs;
+   int NumAddInputs;          // number of additional inputs
+   int NumOutputs;
+   bool EndEarly;
+   int ErrStat;
+   char ErrMsg[INTERFACE_STRING_LENGTH];        // make sure this is the same size as IntfStrLen in FAST_Library.f90
+   char InputFileName[INTERFACE_STRING_LENGTH]; // make sure this is the same size as IntfStrLen in FAST_Library.f90
+   char ChannelNames[CHANNEL_LENGTH * MAXIMUM_OUTPUTS + 1]; // names of the output channels, from FAST_Sizes
+   char OutList[CHANNEL_LENGTH + 1];                        // name of one output channel, for the OutList variable
+   double InitInputAry[MAXInitINPUTS];
+   int n_t_global;            // counter to determine which fixed-step simulation time we are at currently (-1 before FAST_Start)
+   int AbortErrLev;           // abort error level; compare with NWTC Library
+   double *InputAry;          // DWork arrays of the block, set in mdlStart
+   double *OutputAry;
+   bool Parallel;             // step in a worker thread
+   bool StepPending;          // a time step was started in the worker thread and its outputs have not been collected yet
+   StepWorker *Worker;
+} FAST_BlockData;
+
+// The FAST library holds the turbines of all blocks in one array, allocated by the first block that is initialized and
+// deallocated after the last one terminates. These keep track of it. They are only used with LibraryLock held, which also
+// serializes the library routines that use its global data (FAST_AllocateTurbines, FAST_Sizes, FAST_Start, FAST_End and
+// FAST_DeallocateTurbines). Do not call checkError with the lock held: it may call mdlTerminate.
+static int NumTurbinesAllocated = 0; // size of the turbine array in the FAST library (0 when it is not allocated)
+static int NumBlocksActive = 0;      // number of blocks whose turbine is in use
+static bool *TurbineInUse = NULL;    // turbines that belong to a block
+#ifdef _WIN32
+static SRWLOCK LibraryLock = SRWLOCK_INIT;
+#else
+static pthread_mutex_t LibraryLock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+static char ErrStatusMsg[INTERFACE_STRING_LENGTH]; // the message given to ssSetErrorStatus must persist after the block data is freed
 
 // function definitions
-static int checkError(SimStruct *S);
+static int checkError(SimStruct *S, FAST_BlockData *blk);
 static void mdlTerminate(SimStruct *S); // defined here so I can call it from checkError
 static void getInputs(SimStruct *S, double *InputAry);
 static void setOutputs(SimStruct *S, double *OutputAry);
-// Hard coding single Turbine 
-static int iTurb = 0; //zero based
-static int nTurbines = 1;
+static void lockLibrary(void);
+static void unlockLibrary(void);
 
 /* Error handling
 * --------------
@@ -81,21 +134,22 @@ static int nTurbines = 1;
 * It cannot be a local variable. 
 */
 static int
-checkError(SimStruct *S){
+checkError(SimStruct *S, FAST_BlockData *blk){
 
-    if (ErrStat >= AbortErrLev) {
+    if (blk->ErrStat >= blk->AbortErrLev) {
         ssPrintf("\n");
-        ssSetErrorStatus(S, ErrMsg);
+        strcpy(ErrStatusMsg, blk->ErrMsg);
+        ssSetErrorStatus(S, ErrStatusMsg);
         mdlTerminate(S);  // terminate on error (in case Simulink doesn't do so itself)
         return 1;
     }
-    else if (ErrStat >= ErrID_Warn) {
+    else if (blk->ErrStat >= ErrID_Warn) {
         ssPrintf("\n");
-        ssWarning(S, ErrMsg);
+        ssWarning(S, blk->ErrMsg);
     }
-    else if (ErrStat != ErrID_None) {
+    else if (blk->ErrStat != ErrID_None) {
         ssPrintf("\n");
-        ssPrintf("%s\n", ErrMsg);
+        ssPrintf("%s\n", blk->ErrMsg);
     }
     return 0;
 
@@ -125,6 +179,208 @@ setOutputs(SimStruct *S, double *OutputAry){
 
 }
 
+static void
+lockLibrary(void){
+#ifdef _WIN32
+   AcquireSRWLockExclusive(&LibraryLock);
+#else
+   pthread_mutex_lock(&LibraryLock);
+#endif
+}
+
+static void
+unlockLibrary(void){
+#ifdef _WIN32
+   ReleaseSRWLockExclusive(&LibraryLock);
+#else
+   pthread_mutex_unlock(&LibraryLock);
+#endif
+}
+
+/* Time steps
+* ----------
+*
+* Each block advances its own turbine with FAST_UpdateTurbine, which keeps the time step of each turbine in the library. 
+* With PARAM_PARALLEL set, mdlUpdate hands the time step to the block's worker thread and returns, so the turbines of all 
+* parallel blocks are stepped at the same time; mdlOutputs of the next time step (or mdlTerminate) waits for it. The outputs 
+* are the same as stepping in mdlUpdate because the block has no direct feedthrough. Parallel blocks need a FAST library that
+* was built reentrant (with OpenMP, see FAST_IsReentrant), since otherwise the modules keep some local variables in static
+* memory that is shared by all turbines.
+*/
+static void
+stepTurbine(FAST_BlockData *blk){
+
+   FAST_UpdateTurbine(&blk->iTurb, &blk->NumInputs, &blk->NumOutputs, blk->InputAry, blk->OutputAry, &blk->EndEarly, &blk->ErrStat, blk->ErrMsg);
+   blk->n_t_global = blk->n_t_global + 1;
+
+}
+
+#ifdef _WIN32
+static DWORD WINAPI
+workerMain(LPVOID arg){
+
+   FAST_BlockData *blk = (FAST_BlockData *)arg;
+
+   for (;;) {
+      WaitForSingleObject(blk->Worker->startEvent, INFINITE);
+      if (blk->Worker->quit) break;
+      stepTurbine(blk);
+      SetEvent(blk->Worker->doneEvent);
+   }
+   return 0;
+
+}
+
+static int
+startWorker(FAST_BlockData *blk){
+
+   StepWorker *w = (StepWorker *)calloc(1, sizeof(StepWorker));
+   if (w == NULL) return 1;
+
+   w->startEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
+   w->doneEvent = CreateEvent(NULL, TRUE, TRUE, NULL);
+   blk->Worker = w;
+   w->thread = CreateThread(NULL, 0, workerMain, blk, 0, NULL);
+   if (w->thread == NULL) {
+      CloseHandle(w->startEvent);
+      CloseHandle(w->doneEvent);
+      free(w);
+      blk->Worker = NULL;
+      return 1;
+   }
+   return 0;
+
+}
+
+static void
+requestStep(StepWorker *w){
+   ResetEvent(w->doneEvent);
+   SetEvent(w->startEvent);
+}
+
+static void
+waitForStep(StepWorker *w){
+   WaitForSingleObject(w->doneEvent, INFINITE);
+}
+
+static void
+stopWorker(StepWorker *w){
+
+   waitForStep(w);
+   w->quit = true;
+   SetEvent(w->startEvent);
+   WaitForSingleObject(w->thread, INFINITE);
+   CloseHandle(w->thread);
+   CloseHandle(w->startEvent);
+   CloseHandle(w->doneEvent);
+   free(w);
+
+}
+#else
+static void *
+workerMain(void *arg){
+
+   FAST_BlockData *blk = (FAST_BlockData *)arg;
+   StepWorker *w = blk->Worker;
+
+   pthread_mutex_lock(&w->mutex);
+   for (;;) {
+      while (!w->pending && !w->quit) {
+         pthread_cond_wait(&w->cond, &w->mutex);
+      }
+      if (!w->pending) break; // quit
+      pthread_mutex_unlock(&w->mutex);
+
+      stepTurbine(blk);
+
+      pthread_mutex_lock(&w->mutex);
+      w->pending = false;
+      pthread_cond_broadcast(&w->cond);
+   }
+   pthread_mutex_unlock(&w->mutex);
+   return NULL;
+
+}
+
+static int
+startWorker(FAST_BlockData *blk){
+
+   StepWorker *w = (StepWorker *)calloc(1, sizeof(StepWorker));
+   if (w == NULL) return 1;
+
+   pthread_mutex_init(&w->mutex, NULL);
+   pthread_cond_init(&w->cond, NULL);
+   blk->Worker = w;
+   if (pthread_create(&w->thread, NULL, workerMain, blk) != 0) {
+      pthread_cond_destroy(&w->cond);
+      pthread_mutex_destroy(&w->mutex);
+      free(w);
+      blk->Worker = NULL;
+      return 1;
+   }
+   return 0;
+
+}
+
+static void
+requestStep(StepWorker *w){
+   pthread_mutex_lock(&w->mutex);
+   w->pending = true;
+   pthread_cond_broadcast(&w->cond);
+   pthread_mutex_unlock(&w->mutex);
+}
+
+static void
+waitForStep(StepWorker *w){
+   pthread_mutex_lock(&w->mutex);
+   while (w->pending) {
+      pthread_cond_wait(&w->cond, &w->mutex);
+   }
+   pthread_mutex_unlock(&w->mutex);
+}
+
+static void
+stopWorker(StepWorker *w){
+
+   pthread_mutex_lock(&w->mutex);
+   w->quit = true;
+   pthread_cond_broadcast(&w->cond);
+   pthread_mutex_unlock(&w->mutex);  // the worker finishes a pending time step before it quits
+   pthread_join(w->thread, NULL);
+   pthread_cond_destroy(&w->cond);
+   pthread_mutex_destroy(&w->mutex);
+   free(w);
+
+}
+#endif
+
+// Checks the results of the time step of blk; returns nonzero if the block was terminated
+static int
+finishStep(SimStruct *S, FAST_BlockData *blk){
+
+   // For trim solution or any other reason to end early when there is no error
+   if (blk->EndEarly) {
+      mdlTerminate(S);  // terminate after simulation completes (in case Simulink doesn't do so itself)
+      return 1;
+   }
+
+   // Handle errors
+   return checkError(S, blk);
+
+}
+
+// Waits for the time step started in the worker thread of a parallel block; returns nonzero if the block was terminated
+static int
+collectStep(SimStruct *S, FAST_BlockData *blk){
+
+   if (!blk->StepPending) return 0;
+
+   waitForStep(blk->Worker);
+   blk->StepPending = false;
+   return finishStep(S, blk);
+
+}
+
 
 
 /*====================*
@@ -142,161 +398,250 @@ static void mdlInitializeSizes(SimStruct *S)
    int i = 0;
    int j = 0;
    int k = 0;
-   static char ChannelNames[CHANNEL_LENGTH * MAXIMUM_OUTPUTS + 1];
-   static double InitInputAry[MAXInitINPUTS];
-   //static char OutList[MAXIMUM_OUTPUTS][CHANNEL_LENGTH + 1];
-   static char OutList[CHANNEL_LENGTH + 1];
+   int nParams = 0;
+   int TurbineNumber = 1;
+   int nTurbines = 1;
+   char OutListName[32];
    double *AdditionalInitInputs;
    mxArray *pm, *chrAry;
    mwSize m, n;
    mwIndex indx;
+   FAST_BlockData *blk;
 
-   if (n_t_global == -2) {
+   if (ssGetUserData(S) == NULL) { // this block's turbine has not been initialized
 
             /* Expected S-Function Input Parameter(s) */
-      ssSetNumSFcnParams(S, NUM_PARAM);  /* Number of expected parameters */
-      if (ssGetNumSFcnParams(S) != ssGetSFcnParamsCount(S)) {
-           /* Return if number of expected != number of actual parameters */
-           return;
-       }
+      nParams = ssGetSFcnParamsCount(S);
+      if (nParams < NUM_PARAM_REQUIRED || nParams > NUM_PARAM) {
+         ssSetNumSFcnParams(S, NUM_PARAM_REQUIRED);  /* Number of expected parameters */
+         return; /* Simulink reports the wrong number of parameters */
+      }
+      ssSetNumSFcnParams(S, nParams);
     
-         // The parameters should not be changed during the course of a simulation
-       ssSetSFcnParamTunable(S, PARAM_FILENAME, SS_PRM_NOT_TUNABLE); 
-       mxGetString(ssGetSFcnParam(S, PARAM_FILENAME), InputFileName, INTERFACE_STRING_LENGTH);
-
-       ssSetSFcnParamTunable(S, PARAM_TMAX, SS_PRM_NOT_TUNABLE); 
-       TMax = mxGetScalar(ssGetSFcnParam(S, PARAM_TMAX));
-
-       ssSetSFcnParamTunable(S, PARAM_ADDINPUTS, SS_PRM_NOT_TUNABLE);
-       NumAddInputs = (int)(mxGetScalar(ssGetSFcnParam(S, PARAM_ADDINPUTS)) + 0.5); // add 0.5 for rounding from double
+      blk = (FAST_BlockData *)calloc(1, sizeof(FAST_BlockData));
+      if (blk == NULL) {
+         ssSetErrorStatus(S, "Error allocating the data of the FAST SFunc block.");
+         return;
+      }
+      blk->n_t_global = -2;
+      blk->AbortErrLev = ErrID_Fatal;
+      blk->NumInputs = NumFixedInputs;
+      blk->NumOutputs = 1;
+      ssSetUserData(S, blk);
+
+      // set this before possibility of error in Fortran library:
+
+      ssSetOptions(S,
+         SS_OPTION_CALL_TERMINATE_ON_EXIT);
 
-       if (NumAddInputs < 0){
-          ErrStat = ErrID_Fatal;
-          strcpy(ErrMsg, "Parameter specifying number of additional inputs to the FAST SFunc must not be negative.\n");
-          checkError(S);
-          return;
-       }
-       NumInputs = NumFixedInputs + NumAddInputs;
-
-       // now see if there are other inputs that need to be processed...
-       if (NumAddInputs > 0){
+         // The parameters should not be changed during the course of a simulation
+      ssSetSFcnParamTunable(S, PARAM_FILENAME, SS_PRM_NOT_TUNABLE); 
+      mxGetString(ssGetSFcnParam(S, PARAM_FILENAME), blk->InputFileName, INTERFACE_STRING_LENGTH);
+
+      ssSetSFcnParamTunable(S, PARAM_TMAX, SS_PRM_NOT_TUNABLE); 
+      blk->TMax = mxGetScalar(ssGetSFcnParam(S, PARAM_TMAX));
+
+      ssSetSFcnParamTunable(S, PARAM_ADDINPUTS, SS_PRM_NOT_TUNABLE);
+      blk->NumAddInputs = (int)(mxGetScalar(ssGetSFcnParam(S, PARAM_ADDINPUTS)) + 0.5); // add 0.5 for rounding from double
+
+      if (nParams > PARAM_TURBINE) {
+         ssSetSFcnParamTunable(S, PARAM_TURBINE, SS_PRM_NOT_TUNABLE);
+         TurbineNumber = (int)floor(mxGetScalar(ssGetSFcnParam(S, PARAM_TURBINE)) + 0.5);
+      }
+      if (nParams > PARAM_NTURBINES) {
+         ssSetSFcnParamTunable(S, PARAM_NTURBINES, SS_PRM_NOT_TUNABLE);
+         nTurbines = (int)floor(mxGetScalar(ssGetSFcnParam(S, PARAM_NTURBINES)) + 0.5);
+      }
+      if (nParams > PARAM_PARALLEL) {
+         ssSetSFcnParamTunable(S, PARAM_PARALLEL, SS_PRM_NOT_TUNABLE);
+         blk->Parallel = mxGetScalar(ssGetSFcnParam(S, PARAM_PARALLEL)) != 0.0;
+      }
+      if (blk->Parallel){
+         bool reentrant = false;
+         FAST_IsReentrant(&reentrant);
+         if (!reentrant){
+            blk->ErrStat = ErrID_Fatal;
+            strcpy(blk->ErrMsg, "The parameter to step the turbine in parallel requires a FAST library built with OpenMP (OPENMP=ON); this one is not reentrant.\n");
+            checkError(S, blk);
+            return;
+         }
+      }
+
+      if (blk->NumAddInputs < 0){
+         blk->ErrStat = ErrID_Fatal;
+         strcpy(blk->ErrMsg, "Parameter specifying number of additional inputs to the FAST SFunc must not be negative.\n");
+         checkError(S, blk);
+         return;
+      }
+      blk->NumInputs = NumFixedInputs + blk->NumAddInputs;
+
+      if (nTurbines < 1 || TurbineNumber < 1 || TurbineNumber > nTurbines){
+         blk->ErrStat = ErrID_Fatal;
+         strcpy(blk->ErrMsg, "Parameters specifying the turbine number and number of turbines of the FAST SFunc must satisfy 1 <= turbine number <= number of turbines.\n");
+         checkError(S, blk);
+         return;
+      }
+      blk->iTurb = TurbineNumber - 1;
+
+      // now see if there are other inputs that need to be processed...
+      if (blk->NumAddInputs > 0){
     
-          k = (int)mxGetNumberOfElements(ssGetSFcnParam(S, PARAM_ADDINPUTS));
-          k = min( k , MAXInitINPUTS );
-
-          AdditionalInitInputs = (double *)mxGetData(ssGetSFcnParam(S, PARAM_ADDINPUTS));
-          for (i = 0; i < k; i++){
-             InitInputAry[i] = AdditionalInitInputs[i + 1];
-          }
-       }
-       else{
-          InitInputAry[0] = SensorType_None; // tell it not to use lidar (shouldn't be necessary, but we'll cover our bases)
-       }
-
-       // set this before possibility of error in Fortran library:
-
-       ssSetOptions(S,
-          SS_OPTION_CALL_TERMINATE_ON_EXIT);
-
-
-    /*  ---------------------------------------------  */
-    //   strcpy(InputFileName, "../../CertTest/Test01.fst");
-       FAST_AllocateTurbines(&nTurbines, &ErrStat, ErrMsg);
-       if (checkError(S)) return;
-
-       FAST_Sizes(&iTurb, InputFileName, &AbortErrLev, &NumOutputs, &dt, &dt_out, &TMax, &ErrStat, ErrMsg, ChannelNames, &TMax, InitInputAry);
-       n_t_global = -1;
-       if (checkError(S)) return;
-
-
-       // set DT in the Matlab workspace (necessary for Simulink block solver options)
-       pm = mxCreateDoubleScalar(dt);
-       ErrStat = mexPutVariable("base", "DT", pm);
-       mxDestroyArray(pm);
-       if (ErrStat != 0){
-          ErrStat = ErrID_Fatal;
-          strcpy(ErrMsg, "Error copying string array to 'DT' variable in the base Matlab workspace.");
-          checkError(S);
-          return;
-       }
+         k = (int)mxGetNumberOfElements(ssGetSFcnParam(S, PARAM_ADDINPUTS));
+         k = min( k , MAXInitINPUTS );
+
+         AdditionalInitInputs = (double *)mxGetData(ssGetSFcnParam(S, PARAM_ADDINPUTS));
+         for (i = 0; i < k; i++){
+            blk->InitInputAry[i] = AdditionalInitInputs[i + 1];
+         }
+      }
+      else{
+         blk->InitInputAry[0] = SensorType_None; // tell it not to use lidar (shouldn't be necessary, but we'll cover our bases)
+      }
+
+
+   /*  ---------------------------------------------  */
+   //   strcpy(InputFileName, "../../CertTest/Test01.fst");
+      lockLibrary();
+      if (NumTurbinesAllocated > 0 && nTurbines != NumTurbinesAllocated){
+         blk->ErrStat = ErrID_Fatal;
+         sprintf(blk->ErrMsg, "All FAST SFunc blocks in a model must specify the same number of turbines (%d, not %d).\n", NumTurbinesAllocated, nTurbines);
+         unlockLibrary();
+         checkError(S, blk);
+         return;
+      }
+
+      if (NumTurbinesAllocated == 0) {
+         TurbineInUse = (bool *)calloc(nTurbines, sizeof(bool));
+         if (TurbineInUse == NULL) {
+            unlockLibrary();
+            blk->ErrStat = ErrID_Fatal;
+            strcpy(blk->ErrMsg, "Error allocating the turbine list of the FAST SFunc.");
+            checkError(S, blk);
+            return;
+         }
+
+         FAST_AllocateTurbines(&nTurbines, &blk->ErrStat, blk->ErrMsg);
+         if (blk->ErrStat >= blk->AbortErrLev) {
+            free(TurbineInUse);
+            TurbineInUse = NULL;
+            unlockLibrary();
+            checkError(S, blk);
+            return;
+         }
+         NumTurbinesAllocated = nTurbines;
+      }
+
+      if (TurbineInUse[blk->iTurb]){
+         unlockLibrary();
+         blk->ErrStat = ErrID_Fatal;
+         sprintf(blk->ErrMsg, "Turbine %d is already used by another FAST SFunc block.\n", TurbineNumber);
+         checkError(S, blk);
+         return;
+      }
+      TurbineInUse[blk->iTurb] = true;
+      blk->OwnsTurbine = true;
+      NumBlocksActive++;
+
+      FAST_Sizes(&blk->iTurb, blk->InputFileName, &blk->AbortErrLev, &blk->NumOutputs, &blk->dt, &blk->dt_out, &blk->TMax, &blk->ErrStat, blk->ErrMsg, blk->ChannelNames, &blk->TMax, blk->InitInputAry);
+      unlockLibrary();
+      blk->n_t_global = -1;
+      if (checkError(S, blk)) return;
+
+
+      // set DT in the Matlab workspace (necessary for Simulink block solver options)
+      pm = mxCreateDoubleScalar(blk->dt);
+      blk->ErrStat = mexPutVariable("base", "DT", pm);
+      mxDestroyArray(pm);
+      if (blk->ErrStat != 0){
+         blk->ErrStat = ErrID_Fatal;
+         strcpy(blk->ErrMsg, "Error copying string array to 'DT' variable in the base Matlab workspace.");
+         checkError(S, blk);
+         return;
+      }
 
   
-       // put the names of the output channels in a cell-array variable called "OutList" in the base matlab workspace
-       m = NumOutputs;
-       n = 1;
-       pm = mxCreateCellMatrix(m, n);
-       for (i = 0; i < NumOutputs; i++){
-          j = CHANNEL_LENGTH - 1;
-          while (ChannelNames[i*CHANNEL_LENGTH + j] == ' '){
-             j--;
-          }
-          strncpy(&OutList[0], &ChannelNames[i*CHANNEL_LENGTH], j+1);
-          OutList[j + 1] = '\0';
-
-          chrAry = mxCreateString(OutList);
-          indx = i;
-          mxSetCell(pm, indx, chrAry);
-          //mxDestroyArray(chrAry);
-       }
-       ErrStat = mexPutVariable("base", "OutList", pm);
-       mxDestroyArray(pm);
-
-       if (ErrStat != 0){
-          ErrStat = ErrID_Fatal;
-          strcpy(ErrMsg, "Error copying string array to 'OutList' variable in the base Matlab workspace.");
-          checkError(S);
-          return;
-       }
-       //  ---------------------------------------------  
+      // put the names of the output channels in a cell-array variable called "OutList" in the base matlab workspace
+      // (or "OutList<turbine number>" when the model has several turbines)
+      m = blk->NumOutputs;
+      n = 1;
+      pm = mxCreateCellMatrix(m, n);
+      for (i = 0; i < blk->NumOutputs; i++){
+         j = CHANNEL_LENGTH - 1;
+         while (blk->ChannelNames[i*CHANNEL_LENGTH + j] == ' '){
+            j--;
+         }
+         strncpy(&blk->OutList[0], &blk->ChannelNames[i*CHANNEL_LENGTH], j+1);
+         blk->OutList[j + 1] = '\0';
+
+         chrAry = mxCreateString(blk->OutList);
+         indx = i;
+         mxSetCell(pm, indx, chrAry);
+         //mxDestroyArray(chrAry);
+      }
+      if (nTurbines > 1) {
+         sprintf(OutListName, "OutList%d", TurbineNumber);
+      } else {
+         strcpy(OutListName, "OutList");
+      }
+      blk->ErrStat = mexPutVariable("base", OutListName, pm);
+      mxDestroyArray(pm);
+
+      if (blk->ErrStat != 0){
+         blk->ErrStat = ErrID_Fatal;
+         sprintf(blk->ErrMsg, "Error copying string array to '%s' variable in the base Matlab workspace.", OutListName);
+         checkError(S, blk);
+         return;
+      }
+      //  ---------------------------------------------  
     
 
-       ssSetNumContStates(S, 0);  /* how many continuous states? */
-       ssSetNumDiscStates(S, 0);  /* how many discrete states?*/
+      ssSetNumContStates(S, 0);  /* how many continuous states? */
+      ssSetNumDiscStates(S, 0);  /* how many discrete states?*/
 
-         /* sets input port characteristics */
-       if (!ssSetNumInputPorts(S, 1)) return; 
-       ssSetInputPortWidth(S, 0, NumInputs); // width of first input port
+        /* sets input port characteristics */
+      if (!ssSetNumInputPorts(S, 1)) return; 
+      ssSetInputPortWidth(S, 0, blk->NumInputs); // width of first input port
 
-       /*
-        * Set direct feedthrough flag (1=yes, 0=no).
-        * A port has direct feedthrough if the input is used in either
-        * the mdlOutputs or mdlGetTimeOfNextVarHit functions.
-        */
-       ssSetInputPortDirectFeedThrough(S, 0, 0); // no direct feedthrough because we're just putting everything in one update routine (acting like a discrete system)
+      /*
+       * Set direct feedthrough flag (1=yes, 0=no).
+       * A port has direct feedthrough if the input is used in either
+       * the mdlOutputs or mdlGetTimeOfNextVarHit functions.
+       */
+      ssSetInputPortDirectFeedThrough(S, 0, 0); // no direct feedthrough because we're just putting everything in one update routine (acting like a discrete system)
 
-       if (!ssSetNumOutputPorts(S, 1)) return;
-       ssSetOutputPortWidth(S, 0, NumOutputs);
+      if (!ssSetNumOutputPorts(S, 1)) return;
+      ssSetOutputPortWidth(S, 0, blk->NumOutputs);
 
-       ssSetNumSampleTimes(S, 1); // -> setting this > 0 calls mdlInitializeSampleTimes()
+      ssSetNumSampleTimes(S, 1); // -> setting this > 0 calls mdlInitializeSampleTimes()
 
-       /* 
-        * If your Fortran code uses REAL for the state, input, and/or output 
-        * datatypes, use these DWorks as work areas to downcast continuous 
-        * states from double to REAL before calling your code.  You could
-        * also put the work vectors in hard-coded local (stack) variables.
-        *
-        * For fixed step code, keep a copy of the variables  to be output 
-        * in a DWork vector so the mdlOutputs() function can provide output 
-        * data when needed. You can use as many DWork vectors as you like 
-        * for both input and output (or hard-code local variables).
-        */
-       if(!ssSetNumDWork(   S, 2)) return;
+      /* 
+       * If your Fortran code uses REAL for the state, input, and/or output 
+       * datatypes, use these DWorks as work areas to downcast continuous 
+       * states from double to REAL before calling your code.  You could
+       * also put the work vectors in hard-coded local (stack) variables.
+       *
+       * For fixed step code, keep a copy of the variables  to be output 
+       * in a DWork vector so the mdlOutputs() function can provide output 
+       * data when needed. You can use as many DWork vectors as you like 
+       * for both input and output (or hard-code local variables).
+       */
+      if(!ssSetNumDWork(   S, 2)) return;
 
-       ssSetDWorkWidth(   S, WORKARY_OUTPUT, ssGetOutputPortWidth(S, 0));
-       ssSetDWorkDataType(S, WORKARY_OUTPUT, SS_DOUBLE); /* use SS_DOUBLE if needed */
+      ssSetDWorkWidth(   S, WORKARY_OUTPUT, ssGetOutputPortWidth(S, 0));
+      ssSetDWorkDataType(S, WORKARY_OUTPUT, SS_DOUBLE); /* use SS_DOUBLE if needed */
 
-       ssSetDWorkWidth(   S, WORKARY_INPUT, ssGetInputPortWidth(S, 0));
-       ssSetDWorkDataType(S, WORKARY_INPUT, SS_DOUBLE);
+      ssSetDWorkWidth(   S, WORKARY_INPUT, ssGetInputPortWidth(S, 0));
+      ssSetDWorkDataType(S, WORKARY_INPUT, SS_DOUBLE);
 
-       ssSetNumNonsampledZCs(S, 0);
+      ssSetNumNonsampledZCs(S, 0);
 
-       /* Specify the sim state compliance to be same as a built-in block */
-       /* see sfun_simstate.c for example of other possible settings */
-       ssSetSimStateCompliance(S, USE_DEFAULT_SIM_STATE);
+      /* Specify the sim state compliance to be same as a built-in block */
+      /* see sfun_simstate.c for example of other possible settings */
+      ssSetSimStateCompliance(S, USE_DEFAULT_SIM_STATE);
 
-       // ssSetOptions(S, 0); // bjj: what does this do? (not sure what 0 means: no options?) set option to call Terminate earlier...
+      // ssSetOptions(S, 0); // bjj: what does this do? (not sure what 0 means: no options?) set option to call Terminate earlier...
 
-    }
+   }
 }
 
 /* Function: mdlInitializeSampleTimes =========================================
@@ -307,6 +652,9 @@ static void mdlInitializeSizes(SimStruct *S)
  */
 static void mdlInitializeSampleTimes(SimStruct *S)
 {
+    FAST_BlockData *blk = (FAST_BlockData *)ssGetUserData(S);
+
+    if (blk == NULL) return; // terminated after an error in mdlInitializeSizes
 
     /* 
      * If the Fortran code implicitly steps time
@@ -315,7 +663,7 @@ static void mdlInitializeSampleTimes(SimStruct *S)
      * step) sample time, 1 second is chosen below.
      */
 
-    ssSetSampleTime(S, 0, dt); /* Choose the sample time here if discrete */ 
+    ssSetSampleTime(S, 0, blk->dt); /* Choose the sample time here if discrete */ 
     ssSetOffsetTime(S, 0, 0.0);
    
     ssSetModelReferenceSampleTimeDefaultInheritance(S);
@@ -337,17 +685,31 @@ static void mdlInitializeSampleTimes(SimStruct *S)
      /* bjj: this is really the initial output; I'd really like to have the inputs from Simulink here.... maybe if we put it in mdlOutputs? 
         but then do we need to say we have direct feed-through?
      */
-     double *InputAry = (double *)ssGetDWork(S, WORKARY_INPUT); //malloc(NumInputs*sizeof(double));   
-     double *OutputAry = (double *)ssGetDWork(S, WORKARY_OUTPUT);
+     FAST_BlockData *blk = (FAST_BlockData *)ssGetUserData(S);
+     if (blk == NULL) return; // terminated after an error in mdlInitializeSizes
+
+     blk->InputAry = (double *)ssGetDWork(S, WORKARY_INPUT); //malloc(NumInputs*sizeof(double));   
+     blk->OutputAry = (double *)ssGetDWork(S, WORKARY_OUTPUT);
+
+     if (blk->Parallel && blk->Worker == NULL) {
+        if (startWorker(blk)) {
+           blk->ErrStat = ErrID_Fatal;
+           strcpy(blk->ErrMsg, "Error starting the worker thread of the FAST SFunc block.");
+           checkError(S, blk);
+           return;
+        }
+     }
 
      //n_t_global is -1 here; maybe use this fact in mdlOutputs
-     if (n_t_global == -1){ // first time to compute outputs:
+     if (blk->n_t_global == -1){ // first time to compute outputs:
 
-//        getInputs(S, InputAry);
+//        getInputs(S, blk->InputAry);
 
-        FAST_Start(&iTurb, &NumInputs, &NumOutputs, InputAry, OutputAry, &ErrStat, ErrMsg);
-        n_t_global = 0;
-        if (checkError(S)) return;
+        lockLibrary();
+        FAST_Start(&blk->iTurb, &blk->NumInputs, &blk->NumOutputs, blk->InputAry, blk->OutputAry, &blk->ErrStat, blk->ErrMsg);
+        unlockLibrary();
+        blk->n_t_global = 0;
+        if (checkError(S, blk)) return;
 
      }
   }
@@ -380,20 +742,26 @@ static void mdlOutputs(SimStruct *S, int_T tid)
      * this code is active.
      */
     
-    double *InputAry  = (double *)ssGetDWork(S, WORKARY_INPUT);
-    double *OutputAry = (double *)ssGetDWork(S, WORKARY_OUTPUT);
+    FAST_BlockData *blk = (FAST_BlockData *)ssGetUserData(S);
 
-    if (n_t_global == -1){ // first time to compute outputs:
+    if (blk == NULL) return; // terminated early
 
-       getInputs(S, InputAry);
+    if (blk->n_t_global == -1){ // first time to compute outputs:
 
-       FAST_Start(&iTurb, &NumInputs, &NumOutputs, InputAry, OutputAry, &ErrStat, ErrMsg);
-       n_t_global = 0;
-       if (checkError(S)) return;
+       getInputs(S, blk->InputAry);
+
+       lockLibrary();
+       FAST_Start(&blk->iTurb, &blk->NumInputs, &blk->NumOutputs, blk->InputAry, blk->OutputAry, &blk->ErrStat, blk->ErrMsg);
+       unlockLibrary();
+       blk->n_t_global = 0;
+       if (checkError(S, blk)) return;
 
     }
 
-    setOutputs(S, OutputAry);
+    // outputs of the time step started in the previous mdlUpdate of a parallel block
+    if (collectStep(S, blk)) return;
+
+    setOutputs(S, blk->OutputAry);
 
 }
 
@@ -418,28 +786,27 @@ static void mdlUpdate(SimStruct *S, int_T tid)
      * in mdlOutputs().  The states in the Fortran code need not be
      * continuous if you call your code from here.
      */
-    double *InputAry  = (double *)ssGetDWork(S, WORKARY_INPUT);
-    double *OutputAry = (double *)ssGetDWork(S, WORKARY_OUTPUT);
+    FAST_BlockData *blk = (FAST_BlockData *)ssGetUserData(S);
 
     //time_T t = ssGetSampleTime(S, 0);
 
-    getInputs(S, InputAry);
+    if (blk == NULL) return; // terminated early
+    if (collectStep(S, blk)) return;   // (in case mdlOutputs was not called since the last update)
+
+    getInputs(S, blk->InputAry);
 
     /* ==== Call the Fortran routine (args are pass-by-reference) */
     
-    FAST_Update(&iTurb, &NumInputs, &NumOutputs, InputAry, OutputAry, &EndEarly, &ErrStat, ErrMsg);
-    n_t_global = n_t_global + 1;
-
-   // For trim solution or any other reason to end early when there is no error
-   if (EndEarly) {
-      mdlTerminate(S);  // terminate after simulation completes (in case Simulink doesn't do so itself)
-      return;
-   }
+    if (blk->Parallel) {
+       blk->StepPending = true;
+       requestStep(blk->Worker);
+       return;
+    }
 
-   // Handle errors
-    if (checkError(S)) return;
+    stepTurbine(blk);
+    if (finishStep(S, blk)) return;
 
-    setOutputs(S, OutputAry);
+    setOutputs(S, blk->OutputAry);
 
 }
 #endif /* MDL_UPDATE */
@@ -455,15 +822,43 @@ static void mdlUpdate(SimStruct *S, int_T tid)
  */
 static void mdlTerminate(SimStruct *S)
 {
-   if (n_t_global > -2){ // just in case we've never initialized, check this time step
-      bool tr = 1; // Yes, stoptheprogram
-      FAST_End(&iTurb, &tr);
-      n_t_global = -2;
+   FAST_BlockData *blk = (FAST_BlockData *)ssGetUserData(S);
+   int ErrStat2 = 0;
+   char ErrMsg2[INTERFACE_STRING_LENGTH];        // make sure this is the same size as IntfStrLen in FAST_Library.f90
+   bool tr;
+
+   if (blk == NULL) return; // already terminated
+   ssSetUserData(S, NULL);
+
+   if (blk->Worker != NULL) {
+      stopWorker(blk->Worker);  // waits for a pending time step
+      blk->Worker = NULL;
+   }
+
+   lockLibrary();
+   if (blk->n_t_global > -2){ // just in case we've never initialized, check this time step
+      tr = (NumBlocksActive == 1); // Yes, stoptheprogram (if this is the last turbine)
+      FAST_End(&blk->iTurb, &tr);
+      blk->n_t_global = -2;
    }  
-   FAST_DeallocateTurbines(&ErrStat2, ErrMsg2);
-   if (ErrStat2 != ErrID_None){
-      ssPrintf("\n%s\n", ErrMsg2);
+
+   if (blk->OwnsTurbine) {
+      TurbineInUse[blk->iTurb] = false;
+      NumBlocksActive--;
    }
+
+   if (NumBlocksActive == 0 && NumTurbinesAllocated > 0) {
+      FAST_DeallocateTurbines(&ErrStat2, ErrMsg2);
+      if (ErrStat2 != ErrID_None){
+         ssPrintf("\n%s\n", ErrMsg2);
+      }
+      NumTurbinesAllocated = 0;
+      free(TurbineInUse);
+      TurbineInUse = NULL;
+   }
+   unlockLibrary();
+
+   free(blk);
 }
 
 
@@ -56,6 +56,13 @@ else
     libName = 'openfastlib';
 end
 
+% FAST_SFunc steps turbines in worker threads when its parallel parameter is set
+if ( isunix && ~ismac )
+    threadLibs = {'-lpthread'};
+else
+    threadLibs = {};
+end
+
 %% BUILD COMMAND
 fprintf( '\n----------------------------\n' );
 fprintf( 'Creating %s\n\n', [outDir filesep mexname '.' mexext] );
@@ -64,6 +71,7 @@ mex('-largeArrayDims', ...
     ... % '-v', ... %add this line for "verbose" output (for debugging)
     ['-L' libDir], ...
     ['-l' libName], ...
+    threadLibs{:}, ...
     ['-I' includeDir], ...
     '-I../../../modules/supercontroller/src', ... % needed for visual studio builds to find "SuperController_Types.h"
     '-I../../../modules/openfoam/src',        ... % needed for visual studio builds to find "OpenFOAM_Types.h"
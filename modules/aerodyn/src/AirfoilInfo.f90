@@ -84,6 +84,13 @@ CONTAINS
          ! Local declarations.
 
       REAL(ReKi), ALLOCATABLE                :: Coef          (:)             ! The coefficients to send to the regrid routine for 2D splines.
+      REAL(ReKi), ALLOCATABLE                :: ReKiBuf       (:)             ! Packed reals of the input cache key or data.
+      REAL(DbKi), ALLOCATABLE                :: DbKiBuf       (:)             ! Packed doubles of the input cache key or data.
+      INTEGER(IntKi), ALLOCATABLE            :: IntKiBuf      (:)             ! Packed integers of the input cache key or data.
+      CHARACTER(MaxFileInfoLineLen), ALLOCATABLE :: FileList  (:)             ! The airfoil file and the files it includes.
+      INTEGER(B8Ki)                          :: CacheKey      (2)             ! Key of the parameters in the input cache.
+      LOGICAL                                :: UseCache                      ! Whether the parameters are looked up in and stored to the input cache.
+      LOGICAL                                :: Found                         ! Whether the parameters were found in the input cache.
 
       INTEGER                                :: UnEc                          ! Local echo file unit number
       INTEGER                                :: NumCoefs                      ! The number of aerodynamic coefficients to be stored
@@ -112,6 +119,29 @@ CONTAINS
       ELSE
          UnEc = -1
       END IF
+
+         ! Use the parameters from an earlier initialization with the same inputs if the input cache has them and
+         ! none of the files they were read from have changed. The echo file needs the file to be parsed.
+
+      UseCache = LEN_TRIM( InputCacheDir ) > 0 .AND. UnEc <= 0
+      IF ( UseCache ) THEN
+         CALL AFI_PackInitInput( ReKiBuf, DbKiBuf, IntKiBuf, InitInput, ErrStat2, ErrMsg2 )
+         UseCache = ErrStat2 == ErrID_None
+      END IF
+
+      IF ( UseCache ) THEN
+         CALL InputCacheKey( 'AFI', ReKiBuf, DbKiBuf, IntKiBuf, CacheKey )
+         CALL InputCacheRead( 'AFI', CacheKey, ReKiBuf, DbKiBuf, IntKiBuf, Found )
+         IF ( Found ) THEN
+            CALL AFI_UnPackParam( ReKiBuf, DbKiBuf, IntKiBuf, p, ErrStat2, ErrMsg2 )
+            IF ( ErrStat2 == ErrID_None ) THEN
+               CALL Cleanup ( )
+               RETURN
+            END IF
+            CALL AFI_DestroyParam( p, ErrStat2, ErrMsg2 )
+            p%FileName = InitInput%FileName
+         END IF
+      END IF
              
          ! Set the lookup model:  1 = 1D, 2 = 2D based on (AoA,Re), 3 = 2D based on (AoA,UserProp)
       p%AFTabMod   = InitInput%AFTabMod
@@ -143,7 +173,7 @@ CONTAINS
       END IF
          
 
-      CALL ReadAFfile ( InitInput, NumCoefs, p, ErrStat2, ErrMsg2, UnEc ) 
+      CALL ReadAFfile ( InitInput, NumCoefs, p, ErrStat2, ErrMsg2, UnEc, FileList ) 
          CALL SetErrStat ( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
          IF ( ErrStat >= AbortErrLev )  THEN
             CALL Cleanup ( )
@@ -302,6 +332,13 @@ CONTAINS
             
       end do
 
+         ! Store the parameters in the input cache for later initializations.
+
+      IF ( UseCache .AND. ErrStat == ErrID_None ) THEN
+         CALL AFI_PackParam( ReKiBuf, DbKiBuf, IntKiBuf, p, ErrStat2, ErrMsg2 )
+         IF ( ErrStat2 == ErrID_None )  CALL InputCacheWrite( 'AFI', CacheKey, FileList, ReKiBuf, DbKiBuf, IntKiBuf )
+      END IF
+
       CALL Cleanup ( )
 
       RETURN
@@ -312,9 +349,13 @@ CONTAINS
       SUBROUTINE Cleanup ( )
 
          ! This subroutine cleans up the parent routine before exiting.
-            ! Deallocate the temporary Coef array.
+            ! Deallocate the temporary Coef array and the input cache buffers.
 
          IF ( ALLOCATED( Coef       ) ) DEALLOCATE( Coef )
+         IF ( ALLOCATED( ReKiBuf    ) ) DEALLOCATE( ReKiBuf )
+         IF ( ALLOCATED( DbKiBuf    ) ) DEALLOCATE( DbKiBuf )
+         IF ( ALLOCATED( IntKiBuf   ) ) DEALLOCATE( IntKiBuf )
+         IF ( ALLOCATED( FileList   ) ) DEALLOCATE( FileList )
 
          RETURN
 
@@ -348,7 +389,7 @@ CONTAINS
    END SUBROUTINE AFI_ValidateInitInput
   
    !=============================================================================
-   SUBROUTINE ReadAFfile ( InitInp, NumCoefsIn, p, ErrStat, ErrMsg, UnEc )
+   SUBROUTINE ReadAFfile ( InitInp, NumCoefsIn, p, ErrStat, ErrMsg, UnEc, FileList )
 
 
          ! This routine reads an airfoil file.
@@ -367,6 +408,8 @@ CONTAINS
 
       TYPE (AFI_ParameterType), INTENT(INOUT)   :: p                          ! This structure stores all the module parameters that are set by AirfoilInfo during the initialization phase.
 
+      CHARACTER(MaxFileInfoLineLen), ALLOCATABLE, OPTIONAL, INTENT(OUT) :: FileList(:) ! The names of the airfoil file and the files it includes.
+
 
          ! Local declarations.
 
@@ -411,6 +454,16 @@ CONTAINS
             CALL Cleanup()
             RETURN
          END IF
+
+      IF ( PRESENT( FileList ) ) THEN
+         ALLOCATE ( FileList( FileInfo%NumFiles ), STAT=ErrStat2 )
+         IF ( ErrStat2 /= 0 )  THEN
+            CALL SetErrStat ( ErrID_Fatal, 'Error allocating memory for the FileList array.', ErrStat, ErrMsg, RoutineName )
+            CALL Cleanup()
+            RETURN
+         ENDIF
+         FileList = FileInfo%FileList( 1:FileInfo%NumFiles )
+      END IF
          
 
          ! Process the airfoil shape information if it is included.
@@ -187,6 +187,11 @@ SUBROUTINE ED_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, InitOut
    CALL Init_u( u, p, x, InputFileData, m, ErrStat2, ErrMsg2 )      
       CALL CheckError( ErrStat2, ErrMsg2 )
       IF (ErrStat >= AbortErrLev) RETURN                  
+
+      ! the integrators interpolate the inputs into m%u_interp; allocate it here so that the time steps do not have to
+   CALL ED_CopyInput( u, m%u_interp, MESH_NEWCOPY, ErrStat2, ErrMsg2 )
+      CALL CheckError( ErrStat2, ErrMsg2 )
+      IF (ErrStat >= AbortErrLev) RETURN
    
 
       !............................................................................................
@@ -540,15 +545,6 @@ SUBROUTINE ED_CalcOutput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
    REAL(R8Ki)                   :: TmpVec    (NDims)                               ! A temporary vector used in various computations.
    REAL(R8Ki)                   :: TmpVec2   (NDims)                               ! A temporary vector.
 
-   REAL(ReKi)                   :: LinAccES (NDims,0:p%TipNode,p%NumBl)            ! Total linear acceleration of a point on a   blade (point S) in the inertia frame (body E for earth).
-   REAL(ReKi)                   :: AngAccEK (NDims,0:p%TipNode,p%NumBl)            ! Total rotational acceleration of a point on a blade (point S) in the inertia frame (body E for earth).
-   REAL(ReKi)                   :: LinAccET (NDims,0:p%TwrNodes)                   ! Total linear acceleration of a point on the tower (point T) in the inertia frame (body E for earth).
-   REAL(ReKi)                   :: AngAccEF (NDims,0:p%TwrNodes)                   ! Total angular acceleration of tower element J (body F) in the inertia frame (body E for earth).
-   REAL(ReKi)                   :: FrcS0B   (NDims,p%NumBl)                        ! Total force at the blade root (point S(0)) due to the blade.
-   REAL(ReKi)                   :: FTTower  (NDims,p%TwrNodes)                     ! Total hydrodynamic + aerodynamic force per unit length acting on the tower at point T.
-   REAL(ReKi)                   :: MFHydro  (NDims,p%TwrNodes)                     ! Total hydrodynamic + aerodynamic moment per unit length acting on a tower element (body F) at point T.
-   REAL(ReKi)                   :: MomH0B   (NDims,p%NumBl)                        ! Total moment at the hub (body H) / blade root (point S(0)) due to the blade.
-
 
    INTEGER(IntKi)               :: I                                               ! Generic index
    INTEGER(IntKi)               :: J, J2                                           ! Loops through nodes / elements
@@ -560,7 +556,6 @@ SUBROUTINE ED_CalcOutput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
    
 
    LOGICAL, PARAMETER           :: UpdateValues  = .TRUE.                          ! determines if the OtherState values need to be updated
-   TYPE(ED_ContinuousStateType) :: dxdt                                            ! Continuous state derivs at t
 
          ! Initialize some output values
       ErrStat = ErrID_None
@@ -571,8 +566,7 @@ SUBROUTINE ED_CalcOutput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
    IF ( UpdateValues ) THEN    
          ! Update the OtherState data by calculating the derivative...
       !OtherState%HSSBrTrqC = SIGN( u%HSSBrTrqC, x%QDT(DOF_GeAz) )
-      CALL ED_CalcContStateDeriv( t, u, p, x, xd, z, OtherState, m, dxdt, ErrStat, ErrMsg ) ! sets m%QD2T = dxdt%QDT
-      CALL ED_DestroyContState( dxdt, ErrStat2, ErrMsg2 )  
+      CALL ED_CalcContStateDeriv( t, u, p, x, xd, z, OtherState, m, m%xdot, ErrStat, ErrMsg ) ! sets m%QD2T = m%xdot%QDT
       IF (ErrStat >= AbortErrLev) RETURN
    END IF      
 
@@ -667,21 +661,21 @@ SUBROUTINE ED_CalcOutput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
 
    DO K = 1,p%NumBl ! Loop through all blades
 
-      FrcS0B  (:          ,K) = m%RtHS%FrcS0Bt  (:,K          )
-      MomH0B  (:          ,K) = m%RtHS%MomH0Bt  (:,K          )
+      m%FrcS0B  (:          ,K) = m%RtHS%FrcS0Bt  (:,K          )
+      m%MomH0B  (:          ,K) = m%RtHS%MomH0Bt  (:,K          )
 
       DO I = 1,p%DOFs%NPSE(K)  ! Loop through all active (enabled) DOFs that contribute to the QD2T-related linear accelerations of blade K
-         FrcS0B  (:          ,K) = FrcS0B  (:          ,K) + m%RtHS%PFrcS0B  (:,K,          p%DOFs%PSE(K,I)  )*m%QD2T(p%DOFs%PSE(K,I))
-         MomH0B  (:          ,K) = MomH0B  (:          ,K) + m%RtHS%PMomH0B  (:,K,          p%DOFs%PSE(K,I)  )*m%QD2T(p%DOFs%PSE(K,I))
+         m%FrcS0B  (:          ,K) = m%FrcS0B  (:          ,K) + m%RtHS%PFrcS0B  (:,K,          p%DOFs%PSE(K,I)  )*m%QD2T(p%DOFs%PSE(K,I))
+         m%MomH0B  (:          ,K) = m%MomH0B  (:          ,K) + m%RtHS%PMomH0B  (:,K,          p%DOFs%PSE(K,I)  )*m%QD2T(p%DOFs%PSE(K,I))
       ENDDO             ! I - All active (enabled) DOFs that contribute to the QD2T-related linear accelerations of blade K
 
       DO J = 0,p%TipNode ! Loop through the blade nodes / elements
 
-         LinAccES(:,J,K) = m%RtHS%LinAccESt(:,K,J)
-         AngAccEK(:,J,K) = m%RtHs%AngAccEKt(:,J,K)
+         m%LinAccES(:,J,K) = m%RtHS%LinAccESt(:,K,J)
+         m%AngAccEK(:,J,K) = m%RtHs%AngAccEKt(:,J,K)
          DO I = 1,p%DOFs%NPSE(K)  ! Loop through all active (enabled) DOFs that contribute to the QD2T-related linear accelerations of blade K
-            LinAccES(:,J,K) = LinAccES(:,J,K) + m%RtHS%PLinVelES(K,J,p%DOFs%PSE(K,I),0,:)*m%QD2T(p%DOFs%PSE(K,I))
-            AngAccEK(:,J,K) = AngAccEK(:,J,K) + m%RtHS%PAngVelEM(K,J,p%DOFs%PSE(K,I),0,:)*m%QD2T(p%DOFs%PSE(K,I))
+            m%LinAccES(:,J,K) = m%LinAccES(:,J,K) + m%RtHS%PLinVelES(K,J,p%DOFs%PSE(K,I),0,:)*m%QD2T(p%DOFs%PSE(K,I))
+            m%AngAccEK(:,J,K) = m%AngAccEK(:,J,K) + m%RtHS%PAngVelEM(K,J,p%DOFs%PSE(K,I),0,:)*m%QD2T(p%DOFs%PSE(K,I))
          ENDDO             ! I - All active (enabled) DOFs that contribute to the QD2T-related linear accelerations of blade K
 
       ENDDO             ! J - Blade nodes / elements
@@ -690,12 +684,12 @@ SUBROUTINE ED_CalcOutput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
 
    DO J = 0,p%TwrNodes  ! Loop through the tower nodes / elements, starting at the tower base (0)
 
-      LinAccET(:,J) = m%RtHS%LinAccETt(:,J)
-      AngAccEF(:,J) = m%RtHS%AngAccEFt(:,J)
+      m%LinAccET(:,J) = m%RtHS%LinAccETt(:,J)
+      m%AngAccEF(:,J) = m%RtHS%AngAccEFt(:,J)
 
       DO I = 1,p%DOFs%NPTE  ! Loop through all active (enabled) DOFs that contribute to the QD2T-related linear accelerations of the yaw bearing center of mass (point O)
-         LinAccET(:,J) = LinAccET(:,J) + m%RtHS%PLinVelET(J,p%DOFs%PTE(I),0,:)*m%QD2T(p%DOFs%PTE(I))
-         AngAccEF(:,J) = AngAccEF(:,J) + m%RtHS%PAngVelEF(J,p%DOFs%PTE(I),0,:)*m%QD2T(p%DOFs%PTE(I))
+         m%LinAccET(:,J) = m%LinAccET(:,J) + m%RtHS%PLinVelET(J,p%DOFs%PTE(I),0,:)*m%QD2T(p%DOFs%PTE(I))
+         m%AngAccEF(:,J) = m%AngAccEF(:,J) + m%RtHS%PAngVelEF(J,p%DOFs%PTE(I),0,:)*m%QD2T(p%DOFs%PTE(I))
       ENDDO          ! I - All active (enabled) DOFs that contribute to the QD2T-related linear accelerations of the yaw bearing center of mass (point O)
 
    ENDDO ! J - Tower nodes / elements
@@ -703,12 +697,12 @@ SUBROUTINE ED_CalcOutput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
 
    DO J = 1,p%TwrNodes  ! Loop through the tower nodes / elements
 
-      FTTower (:,J) = m%RtHS%FTHydrot (:,J)
-      MFHydro (:,J) = m%RtHS%MFHydrot (:,J)
+      m%FTTower (:,J) = m%RtHS%FTHydrot (:,J)
+      m%MFHydro (:,J) = m%RtHS%MFHydrot (:,J)
 
       DO I = 1,p%DOFs%NPTE  ! Loop through all active (enabled) DOFs that contribute to the QD2T-related linear accelerations of the yaw bearing center of mass (point O)
-         FTTower (:,J) = FTTower (:,J) + m%RtHS%PFTHydro (:,J,p%DOFs%PTE(I)  )*m%QD2T(p%DOFs%PTE(I))
-         MFHydro (:,J) = MFHydro (:,J) + m%RtHS%PMFHydro (:,J,p%DOFs%PTE(I)  )*m%QD2T(p%DOFs%PTE(I))
+         m%FTTower (:,J) = m%FTTower (:,J) + m%RtHS%PFTHydro (:,J,p%DOFs%PTE(I)  )*m%QD2T(p%DOFs%PTE(I))
+         m%MFHydro (:,J) = m%MFHydro (:,J) + m%RtHS%PMFHydro (:,J,p%DOFs%PTE(I)  )*m%QD2T(p%DOFs%PTE(I))
       ENDDO          ! I - All active (enabled) DOFs that contribute to the QD2T-related linear accelerations of the yaw bearing center of mass (point O)
 
    ENDDO ! J - Tower nodes / elements
@@ -727,8 +721,8 @@ SUBROUTINE ED_CalcOutput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
    MomNTail = 0.001*MomNTail
    MomX0Trb = 0.001*MomX0Trb
    MXHydro  = 0.001*MXHydro
-   FrcS0B   = 0.001*FrcS0B
-   MomH0B   = 0.001*MomH0B
+   m%FrcS0B   = 0.001*m%FrcS0B
+   m%MomH0B   = 0.001*m%MomH0B
 
 
    !...............................................................................................................................
@@ -755,9 +749,9 @@ SUBROUTINE ED_CalcOutput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
          m%AllOuts(  TipDxb(K) ) = DOT_PRODUCT(            rSTipPSTip, m%CoordSys%j1(K,         :) )
          m%AllOuts(  TipDyb(K) ) = DOT_PRODUCT(            rSTipPSTip, m%CoordSys%j2(K,         :) )
       !JASON: USE TipNode HERE INSTEAD OF BldNodes IF YOU ALLOCATE AND DEFINE n1, n2, n3, m1, m2, AND m3 TO USE TipNode.  THIS WILL REQUIRE THAT THE AERODYNAMIC AND STRUCTURAL TWISTS, AeroTwst() AND ThetaS(), BE KNOWN AT THE TIP!!!
-         m%AllOuts( TipALxb(K) ) = DOT_PRODUCT( LinAccES(:,p%TipNode,K), m%CoordSys%n1(K,p%BldNodes,:) )
-         m%AllOuts( TipALyb(K) ) = DOT_PRODUCT( LinAccES(:,p%TipNode,K), m%CoordSys%n2(K,p%BldNodes,:) )
-         m%AllOuts( TipALzb(K) ) = DOT_PRODUCT( LinAccES(:,p%TipNode,K), m%CoordSys%n3(K,p%BldNodes,:) )
+         m%AllOuts( TipALxb(K) ) = DOT_PRODUCT( m%LinAccES(:,p%TipNode,K), m%CoordSys%n1(K,p%BldNodes,:) )
+         m%AllOuts( TipALyb(K) ) = DOT_PRODUCT( m%LinAccES(:,p%TipNode,K), m%CoordSys%n2(K,p%BldNodes,:) )
+         m%AllOuts( TipALzb(K) ) = DOT_PRODUCT( m%LinAccES(:,p%TipNode,K), m%CoordSys%n3(K,p%BldNodes,:) )
          m%AllOuts( TipRDxb(K) ) = DOT_PRODUCT( m%RtHS%AngPosHM(:,K,p%TipNode), m%CoordSys%j1(K,         :) )*R2D
          m%AllOuts( TipRDyb(K) ) = DOT_PRODUCT( m%RtHS%AngPosHM(:,K,p%TipNode), m%CoordSys%j2(K,         :) )*R2D
          ! There is no sense computing AllOuts( TipRDzc(K) ) here since it is always zero for FAST simulation results.
@@ -775,9 +769,9 @@ SUBROUTINE ED_CalcOutput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
    DO K = 1,p%NumBl
       DO I = 1, p%NBlGages
 
-         m%AllOuts( SpnALxb(I,K) ) = DOT_PRODUCT( LinAccES(:,p%BldGagNd(I),K), m%CoordSys%n1(K,p%BldGagNd(I),:) )
-         m%AllOuts( SpnALyb(I,K) ) = DOT_PRODUCT( LinAccES(:,p%BldGagNd(I),K), m%CoordSys%n2(K,p%BldGagNd(I),:) )
-         m%AllOuts( SpnALzb(I,K) ) = DOT_PRODUCT( LinAccES(:,p%BldGagNd(I),K), m%CoordSys%n3(K,p%BldGagNd(I),:) )
+         m%AllOuts( SpnALxb(I,K) ) = DOT_PRODUCT( m%LinAccES(:,p%BldGagNd(I),K), m%CoordSys%n1(K,p%BldGagNd(I),:) )
+         m%AllOuts( SpnALyb(I,K) ) = DOT_PRODUCT( m%LinAccES(:,p%BldGagNd(I),K), m%CoordSys%n2(K,p%BldGagNd(I),:) )
+         m%AllOuts( SpnALzb(I,K) ) = DOT_PRODUCT( m%LinAccES(:,p%BldGagNd(I),K), m%CoordSys%n3(K,p%BldGagNd(I),:) )
 
          rSPS                      = m%RtHS%rS0S(:,K,p%BldGagNd(I)) - p%RNodes(p%BldGagNd(I))*m%CoordSys%j3(K,:)
 
@@ -912,9 +906,9 @@ END IF
 
    DO I = 1, p%NTwGages
 
-      m%AllOuts( TwHtALxt(I) ) =      DOT_PRODUCT( LinAccET(:,p%TwrGagNd(I)), m%CoordSys%t1(p%TwrGagNd(I),:) )
-      m%AllOuts( TwHtALyt(I) ) = -1.0*DOT_PRODUCT( LinAccET(:,p%TwrGagNd(I)), m%CoordSys%t3(p%TwrGagNd(I),:) )
-      m%AllOuts( TwHtALzt(I) ) =      DOT_PRODUCT( LinAccET(:,p%TwrGagNd(I)), m%CoordSys%t2(p%TwrGagNd(I),:) )
+      m%AllOuts( TwHtALxt(I) ) =      DOT_PRODUCT( m%LinAccET(:,p%TwrGagNd(I)), m%CoordSys%t1(p%TwrGagNd(I),:) )
+      m%AllOuts( TwHtALyt(I) ) = -1.0*DOT_PRODUCT( m%LinAccET(:,p%TwrGagNd(I)), m%CoordSys%t3(p%TwrGagNd(I),:) )
+      m%AllOuts( TwHtALzt(I) ) =      DOT_PRODUCT( m%LinAccET(:,p%TwrGagNd(I)), m%CoordSys%t2(p%TwrGagNd(I),:) )
 
       rTPT                   = m%RtHS%rT0T(:,p%TwrGagNd(I)) - p%HNodes(p%TwrGagNd(I))*m%CoordSys%a2(:)
 
@@ -979,16 +973,16 @@ END IF
       ! Blade Root Loads:
 
    DO K=1,p%NumBl
-      m%AllOuts( RootFxc(K) ) = DOT_PRODUCT( FrcS0B(:,K), m%CoordSys%i1(K,:) )
-      m%AllOuts( RootFyc(K) ) = DOT_PRODUCT( FrcS0B(:,K), m%CoordSys%i2(K,:) )
-      m%AllOuts( RootFzc(K) ) = DOT_PRODUCT( FrcS0B(:,K), m%CoordSys%i3(K,:) )
-      m%AllOuts( RootFxb(K) ) = DOT_PRODUCT( FrcS0B(:,K), m%CoordSys%j1(K,:) )
-      m%AllOuts( RootFyb(K) ) = DOT_PRODUCT( FrcS0B(:,K), m%CoordSys%j2(K,:) )
-      m%AllOuts( RootMxc(K) ) = DOT_PRODUCT( MomH0B(:,K), m%CoordSys%i1(K,:) )
-      m%AllOuts( RootMyc(K) ) = DOT_PRODUCT( MomH0B(:,K), m%CoordSys%i2(K,:) )
-      m%AllOuts( RootMzc(K) ) = DOT_PRODUCT( MomH0B(:,K), m%CoordSys%i3(K,:) )
-      m%AllOuts( RootMxb(K) ) = DOT_PRODUCT( MomH0B(:,K), m%CoordSys%j1(K,:) )
-      m%AllOuts( RootMyb(K) ) = DOT_PRODUCT( MomH0B(:,K), m%CoordSys%j2(K,:) )
+      m%AllOuts( RootFxc(K) ) = DOT_PRODUCT( m%FrcS0B(:,K), m%CoordSys%i1(K,:) )
+      m%AllOuts( RootFyc(K) ) = DOT_PRODUCT( m%FrcS0B(:,K), m%CoordSys%i2(K,:) )
+      m%AllOuts( RootFzc(K) ) = DOT_PRODUCT( m%FrcS0B(:,K), m%CoordSys%i3(K,:) )
+      m%AllOuts( RootFxb(K) ) = DOT_PRODUCT( m%FrcS0B(:,K), m%CoordSys%j1(K,:) )
+      m%AllOuts( RootFyb(K) ) = DOT_PRODUCT( m%FrcS0B(:,K), m%CoordSys%j2(K,:) )
+      m%AllOuts( RootMxc(K) ) = DOT_PRODUCT( m%MomH0B(:,K), m%CoordSys%i1(K,:) )
+      m%AllOuts( RootMyc(K) ) = DOT_PRODUCT( m%MomH0B(:,K), m%CoordSys%i2(K,:) )
+      m%AllOuts( RootMzc(K) ) = DOT_PRODUCT( m%MomH0B(:,K), m%CoordSys%i3(K,:) )
+      m%AllOuts( RootMxb(K) ) = DOT_PRODUCT( m%MomH0B(:,K), m%CoordSys%j1(K,:) )
+      m%AllOuts( RootMyb(K) ) = DOT_PRODUCT( m%MomH0B(:,K), m%CoordSys%j2(K,:) )
    END DO !K
 
 
@@ -999,16 +993,16 @@ END IF
 
       ! Initialize FrcMGagB and MomMGagB using the tip brake effects:
 
-         FrcMGagB = m%RtHS%FSTipDrag(:,K) - p%TipMass(K)*( p%Gravity*m%CoordSys%z2 + LinAccES(:,p%TipNode,K) )
-         MomMGagB = CROSS_PRODUCT( m%RtHS%rS0S(:,K,p%TipNode) - m%RtHS%rS0S(:,K,p%BldGagNd(I)), FrcMGagB )
+         FrcMGagB = m%RtHS%FSTipDrag(:,K) - p%TipMass(K)*( p%Gravity*m%CoordSys%z2 + m%LinAccES(:,p%TipNode,K) )
+         MomMGagB = CROSS_PRODUCT( m%RtHS%rS0S(1:3,K,p%TipNode) - m%RtHS%rS0S(1:3,K,p%BldGagNd(I)), FrcMGagB )
 
       ! Integrate to find FrcMGagB and MomMGagB using all of the nodes / elements above the current strain gage location:
          DO J = ( p%BldGagNd(I) + 1 ),p%BldNodes ! Loop through blade nodes / elements above strain gage node
 
-            TmpVec2  = m%RtHS%FSAero(:,K,J) - p%MassB(K,J)*( p%Gravity*m%CoordSys%z2 + LinAccES(:,J,K) )  ! Portion of FrcMGagB associated with element J
+            TmpVec2  = m%RtHS%FSAero(:,K,J) - p%MassB(K,J)*( p%Gravity*m%CoordSys%z2 + m%LinAccES(:,J,K) )  ! Portion of FrcMGagB associated with element J
             FrcMGagB = FrcMGagB + TmpVec2*p%DRNodes(J)
 
-            TmpVec = CROSS_PRODUCT( m%RtHS%rS0S(:,K,J) - m%RtHS%rS0S(:,K,p%BldGagNd(I)), TmpVec2 )           ! Portion of MomMGagB associated with element J
+            TmpVec = CROSS_PRODUCT( m%RtHS%rS0S(1:3,K,J) - m%RtHS%rS0S(1:3,K,p%BldGagNd(I)), TmpVec2 )           ! Portion of MomMGagB associated with element J
             MomMGagB = MomMGagB + ( TmpVec + m%RtHS%MMAero(:,K,J) )*p%DRNodes(J)
 
          ENDDO ! J - Blade nodes / elements above strain gage node
@@ -1019,12 +1013,12 @@ END IF
       !   the moment arm for the force is 1/4 of p%DRNodes() and the element
       !   length is 1/2 of p%DRNodes().
 
-         TmpVec2  = m%RtHS%FSAero(:,K,p%BldGagNd(I)) - p%MassB(K,p%BldGagNd(I))* ( p%Gravity*m%CoordSys%z2 + LinAccES(:,p%BldGagNd(I),K) ) ! Portion of FrcMGagB associated with 1/2 of the strain gage element
+         TmpVec2  = m%RtHS%FSAero(:,K,p%BldGagNd(I)) - p%MassB(K,p%BldGagNd(I))* ( p%Gravity*m%CoordSys%z2 + m%LinAccES(:,p%BldGagNd(I),K) ) ! Portion of FrcMGagB associated with 1/2 of the strain gage element
          FrcMGagB = FrcMGagB + TmpVec2 * 0.5 * p%DRNodes(p%BldGagNd(I))                                                    ! Portion of FrcMGagB associated with 1/2 of the strain gage element
          FrcMGagB = 0.001*FrcMGagB           ! Convert the local force to kN
 
 
-         TmpVec = CROSS_PRODUCT( ( 0.25_R8Ki*p%DRNodes(p%BldGagNd(I)) )*m%CoordSys%j3(K,:), TmpVec2 )                              ! Portion of MomMGagB associated with 1/2 of the strain gage element
+         TmpVec = CROSS_PRODUCT( ( 0.25_R8Ki*p%DRNodes(p%BldGagNd(I)) )*m%CoordSys%j3(K,1:3), TmpVec2 )                              ! Portion of MomMGagB associated with 1/2 of the strain gage element
 
          MomMGagB = MomMGagB + ( TmpVec + m%RtHS%MMAero(:,K,p%BldGagNd(I)) )* ( 0.5 *p%DRNodes(p%BldGagNd(I)) )
          MomMGagB = 0.001*MomMGagB           ! Convert the local moment to kN-m
@@ -1169,11 +1163,11 @@ END IF
 
       ! Integrate to find FrcFGagT and MomFGagT using all of the nodes / elements above the current strain gage location:
       DO J = ( p%TwrGagNd(I) + 1 ),p%TwrNodes ! Loop through tower nodes / elements above strain gage node
-         TmpVec2  = FTTower(:,J) - p%MassT(J)*( p%Gravity*m%CoordSys%z2 + LinAccET(:,J) )           ! Portion of FrcFGagT associated with element J
+         TmpVec2  = m%FTTower(:,J) - p%MassT(J)*( p%Gravity*m%CoordSys%z2 + m%LinAccET(:,J) )           ! Portion of FrcFGagT associated with element J
          FrcFGagT = FrcFGagT + TmpVec2*p%DHNodes(J)
 
-         TmpVec = CROSS_PRODUCT( m%RtHS%rZT(:,J) - m%RtHS%rZT(:,p%TwrGagNd(I)), TmpVec2 )                          ! Portion of MomFGagT associated with element J
-         MomFGagT = MomFGagT + ( TmpVec + MFHydro(:,J) )*p%DHNodes(J)
+         TmpVec = CROSS_PRODUCT( m%RtHS%rZT(1:3,J) - m%RtHS%rZT(1:3,p%TwrGagNd(I)), TmpVec2 )                          ! Portion of MomFGagT associated with element J
+         MomFGagT = MomFGagT + ( TmpVec + m%MFHydro(:,J) )*p%DHNodes(J)
       ENDDO ! J -Tower nodes / elements above strain gage node
 
       ! Add the effects of 1/2 the strain gage element:
@@ -1181,13 +1175,13 @@ END IF
       !   effect (due to tower bending) within the element.  Thus, the moment arm
       !   for the force is 1/4 of DHNodes() and the element length is 1/2 of DHNodes().
 
-      TmpVec2  = FTTower(:,p%TwrGagNd(I)) - p%MassT(p%TwrGagNd(I))*( p%Gravity*m%CoordSys%z2 + LinAccET(:,p%TwrGagNd(I)))
+      TmpVec2  = m%FTTower(:,p%TwrGagNd(I)) - p%MassT(p%TwrGagNd(I))*( p%Gravity*m%CoordSys%z2 + m%LinAccET(:,p%TwrGagNd(I)))
 
       FrcFGagT = FrcFGagT + TmpVec2 * 0.5 * p%DHNodes(p%TwrGagNd(I))
       FrcFGagT = 0.001*FrcFGagT  ! Convert the local force to kN
 
       TmpVec = CROSS_PRODUCT( ( 0.25_R8Ki*p%DHNodes( p%TwrGagNd(I)) )*m%CoordSys%a2, TmpVec2 )              ! Portion of MomFGagT associated with 1/2 of the strain gage element
-      TmpVec   = TmpVec   + MFHydro(:,p%TwrGagNd(I))
+      TmpVec   = TmpVec   + m%MFHydro(:,p%TwrGagNd(I))
       MomFGagT = MomFGagT + TmpVec * 0.5 * p%DHNodes(p%TwrGagNd(I))
       MomFGagT = 0.001*MomFGagT  ! Convert the local moment to kN-m
 
@@ -1325,7 +1319,7 @@ END IF
       y%WriteOutput(p%NumOuts+1:) = 0.0_ReKi
 
          ! Now we need to populate the blade node outputs here
-      call Calc_WriteAllBldNdOutput( p, u, m, y, LinAccES, ErrStat2, ErrMsg2 )   ! Call after normal writeoutput.  Will just postpend data on here.
+      call Calc_WriteAllBldNdOutput( p, u, m, y, m%LinAccES, ErrStat2, ErrMsg2 )   ! Call after normal writeoutput.  Will just postpend data on here.
       call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'ED_CalcOutput')
    ENDIF
 
@@ -1406,14 +1400,14 @@ END IF
             y%BladeLn2Mesh(K)%RotationVel(3,NodeNum) =     m%RtHS%AngVelEM(2,J2,K)  
 
                ! Translational Acceleration
-            y%BladeLn2Mesh(K)%TranslationAcc(1,NodeNum) =     LinAccES(1,J2,K)
-            y%BladeLn2Mesh(K)%TranslationAcc(2,NodeNum) = -1.*LinAccES(3,J2,K)
-            y%BladeLn2Mesh(K)%TranslationAcc(3,NodeNum) =     LinAccES(2,J2,K)  
+            y%BladeLn2Mesh(K)%TranslationAcc(1,NodeNum) =     m%LinAccES(1,J2,K)
+            y%BladeLn2Mesh(K)%TranslationAcc(2,NodeNum) = -1.*m%LinAccES(3,J2,K)
+            y%BladeLn2Mesh(K)%TranslationAcc(3,NodeNum) =     m%LinAccES(2,J2,K)  
 
                ! Rotational Acceleration
-            y%BladeLn2Mesh(K)%RotationAcc(1,NodeNum)     =     AngAccEK(1,J2,K)
-            y%BladeLn2Mesh(K)%RotationAcc(2,NodeNum)     = -1.*AngAccEK(3,J2,K)
-            y%BladeLn2Mesh(K)%RotationAcc(3,NodeNum)     =     AngAccEK(2,J2,K) 
+            y%BladeLn2Mesh(K)%RotationAcc(1,NodeNum)     =     m%AngAccEK(1,J2,K)
+            y%BladeLn2Mesh(K)%RotationAcc(2,NodeNum)     = -1.*m%AngAccEK(3,J2,K)
+            y%BladeLn2Mesh(K)%RotationAcc(3,NodeNum)     =     m%AngAccEK(2,J2,K) 
                
             
          END DO !J = 1,p%BldNodes ! Loop through the blade nodes / elements
@@ -1483,9 +1477,9 @@ END IF
       y%BladeRootMotion(K)%RotationVel(3,1)     =      m%RtHS%AngVelEH(2)
       
       ! Translation acceleration
-      y%BladeRootMotion(K)%TranslationAcc(1,1)  =      LinAccES(1,0,K)
-      y%BladeRootMotion(K)%TranslationAcc(2,1)  =  -1.*LinAccES(3,0,K)
-      y%BladeRootMotion(K)%TranslationAcc(3,1)  =      LinAccES(2,0,K)
+      y%BladeRootMotion(K)%TranslationAcc(1,1)  =      m%LinAccES(1,0,K)
+      y%BladeRootMotion(K)%TranslationAcc(2,1)  =  -1.*m%LinAccES(3,0,K)
+      y%BladeRootMotion(K)%TranslationAcc(3,1)  =      m%LinAccES(2,0,K)
       
       ! Rotation acceleration  
       y%BladeRootMotion(K)%RotationAcc(1,1)     =      AngAccEH(1) 
@@ -1689,13 +1683,13 @@ END IF
       y%TowerLn2Mesh%RotationVel(2,J)     = -1.*m%RtHS%AngVelEF(3,J)
       y%TowerLn2Mesh%RotationVel(3,J)     =     m%RtHS%AngVelEF(2,J) 
             
-      y%TowerLn2Mesh%TranslationAcc(1,J)  =     LinAccET(1,J)
-      y%TowerLn2Mesh%TranslationAcc(2,J)  = -1.*LinAccET(3,J)
-      y%TowerLn2Mesh%TranslationAcc(3,J)  =     LinAccET(2,J)
+      y%TowerLn2Mesh%TranslationAcc(1,J)  =     m%LinAccET(1,J)
+      y%TowerLn2Mesh%TranslationAcc(2,J)  = -1.*m%LinAccET(3,J)
+      y%TowerLn2Mesh%TranslationAcc(3,J)  =     m%LinAccET(2,J)
             
-      y%TowerLn2Mesh%RotationAcc(1,J)     =     AngAccEF(1,J)
-      y%TowerLn2Mesh%RotationAcc(2,J)     = -1.*AngAccEF(3,J)
-      y%TowerLn2Mesh%RotationAcc(3,J)     =     AngAccEF(2,J) 
+      y%TowerLn2Mesh%RotationAcc(1,J)     =     m%AngAccEF(1,J)
+      y%TowerLn2Mesh%RotationAcc(2,J)     = -1.*m%AngAccEF(3,J)
+      y%TowerLn2Mesh%RotationAcc(3,J)     =     m%AngAccEF(2,J) 
       
    END DO
                
@@ -1759,13 +1753,13 @@ END IF
    y%TowerLn2Mesh%RotationVel(2,J)     = -1.*m%RtHS%AngVelEF(3,0)
    y%TowerLn2Mesh%RotationVel(3,J)     =     m%RtHS%AngVelEF(2,0) 
    
-   y%TowerLn2Mesh%TranslationAcc(1,J)  =     LinAccET(1,0)
-   y%TowerLn2Mesh%TranslationAcc(2,J)  = -1.*LinAccET(3,0)
-   y%TowerLn2Mesh%TranslationAcc(3,J)  =     LinAccET(2,0)
+   y%TowerLn2Mesh%TranslationAcc(1,J)  =     m%LinAccET(1,0)
+   y%TowerLn2Mesh%TranslationAcc(2,J)  = -1.*m%LinAccET(3,0)
+   y%TowerLn2Mesh%TranslationAcc(3,J)  =     m%LinAccET(2,0)
    
-   y%TowerLn2Mesh%RotationAcc(1,J)     =     AngAccEF(1,0)
-   y%TowerLn2Mesh%RotationAcc(2,J)     = -1.*AngAccEF(3,0)
-   y%TowerLn2Mesh%RotationAcc(3,J)     =     AngAccEF(2,0) 
+   y%TowerLn2Mesh%RotationAcc(1,J)     =     m%AngAccEF(1,0)
+   y%TowerLn2Mesh%RotationAcc(2,J)     = -1.*m%AngAccEF(3,0)
+   y%TowerLn2Mesh%RotationAcc(3,J)     =     m%AngAccEF(2,0) 
    
    !...............................................................................................................................
    ! Outputs required for ServoDyn
@@ -1843,6 +1837,7 @@ SUBROUTINE ED_CalcContStateDeriv( t, u, p, x, xd, z, OtherState, m, dxdt, ErrSta
    LOGICAL, PARAMETER           :: UpdateValues  = .TRUE.      ! determines if the OtherState values need to be updated
       
    INTEGER(IntKi)                         :: I                 ! Loops through some or all of the DOFs.
+   INTEGER(IntKi)                         :: J                 ! Loops through some or all of the DOFs.
    INTEGER(IntKi)                         :: ErrStat2          ! The error status code
    CHARACTER(ErrMsgLen)                   :: ErrMsg2           ! The error message, if an error occurred
    CHARACTER(*), PARAMETER                :: RoutineName = 'ED_CalcContStateDeriv'
@@ -1897,8 +1892,13 @@ SUBROUTINE ED_CalcContStateDeriv( t, u, p, x, xd, z, OtherState, m, dxdt, ErrSta
    !   in INTENT(OUT) arguments.
 
    IF ( p%DOFs%NActvDOF > 0 ) THEN
-      m%AugMat_factor = m%AugMat( p%DOFs%SrtPS( 1:p%DOFs%NActvDOF ), p%DOFs%SrtPSNAUG(1:p%DOFs%NActvDOF) )
-      m%SolnVec       = m%AugMat( p%DOFs%SrtPS( 1:p%DOFs%NActvDOF ), p%DOFs%SrtPSNAUG(1+p%DOFs%NActvDOF) )
+         ! (element by element: the vector subscripts would make array temporaries)
+      DO J = 1,p%DOFs%NActvDOF
+         DO I = 1,p%DOFs%NActvDOF
+            m%AugMat_factor(I,J) = m%AugMat( p%DOFs%SrtPS(I), p%DOFs%SrtPSNAUG(J) )
+         ENDDO
+         m%SolnVec(J)         = m%AugMat( p%DOFs%SrtPS(J), p%DOFs%SrtPSNAUG(1+p%DOFs%NActvDOF) )
+      ENDDO
    
 
       CALL LAPACK_getrf( M=p%DOFs%NActvDOF, N=p%DOFs%NActvDOF, A=m%AugMat_factor, IPIV=m%AugMat_pivot, ErrStat=ErrStat2, ErrMsg=ErrMsg2 )
@@ -3861,6 +3861,16 @@ SUBROUTINE Init_MiscOtherStates( m, OtherState, p, x, InputFileData, ErrStat, Er
          RETURN
       ENDIF   
    m%AllOuts = 0.0_ReKi
+
+      ! totals computed by ED_CalcOutput:
+   ALLOCATE ( m%LinAccES(3,0:p%TipNode,p%NumBl), m%AngAccEK(3,0:p%TipNode,p%NumBl), m%LinAccET(3,0:p%TwrNodes), &
+              m%AngAccEF(3,0:p%TwrNodes), m%FrcS0B(3,p%NumBl), m%FTTower(3,p%TwrNodes), m%MFHydro(3,p%TwrNodes), &
+              m%MomH0B(3,p%NumBl), STAT=ErrStat )
+      IF ( ErrStat /= 0 )  THEN
+         ErrStat = ErrID_Fatal
+         ErrMsg  = ' Error allocating memory for the ED_CalcOutput totals.'
+         RETURN
+      ENDIF
    
    m%IgnoreMod = .false. ! for general time steps, we don't ignore the modulos in ED_CalcOutput
    
@@ -3906,6 +3916,12 @@ SUBROUTINE Init_MiscOtherStates( m, OtherState, p, x, InputFileData, ErrStat, Er
       CALL ED_CopyContState( x, OtherState%xdot(i), MESH_NEWCOPY, ErrStat, ErrMsg)
          IF ( ErrStat >= AbortErrLev ) RETURN 
    ENDDO
+
+      ! states used by the integrators in each time step:
+   CALL ED_CopyContState( x, m%x_pred, MESH_NEWCOPY, ErrStat, ErrMsg)
+      IF ( ErrStat >= AbortErrLev ) RETURN
+   CALL ED_CopyContState( x, m%xdot, MESH_NEWCOPY, ErrStat, ErrMsg)
+      IF ( ErrStat >= AbortErrLev ) RETURN
    
       ! hacks for HSS brake function:
    
@@ -6088,7 +6104,7 @@ SUBROUTINE SetCoordSy( t, CoordSys, RtHSdat, BlPitch, p, x, ErrStat, ErrMsg )
 
       ! Tower base / platform coordinate system:
 
-   CALL SmllRotTrans( 'platform displacement (ElastoDyn SetCoordSy)', x%QT(DOF_R), x%QT(DOF_Y), -x%QT(DOF_P), TransMat, TRIM(Num2LStr(t))//' s', ErrStat2, ErrMsg2 )  ! Get the transformation matrix, TransMat, from inertial frame to tower base / platform coordinate systems.
+   CALL SmllRotTrans( 'platform displacement (ElastoDyn SetCoordSy)', x%QT(DOF_R), x%QT(DOF_Y), -x%QT(DOF_P), TransMat, ErrStat=ErrStat2, ErrMsg=ErrMsg2 )  ! Get the transformation matrix, TransMat, from inertial frame to tower base / platform coordinate systems.
       CALL CheckError( ErrStat2, ErrMsg2 )
       IF (ErrStat >= AbortErrLev) RETURN
 
@@ -6105,7 +6121,7 @@ SUBROUTINE SetCoordSy( t, CoordSys, RtHSdat, BlPitch, p, x, ErrStat, ErrMsg )
       ThetaFA = -p%TwrFASF(1,J       ,1)*x%QT(DOF_TFA1) - p%TwrFASF(2,J       ,1)*x%QT(DOF_TFA2)
       ThetaSS =  p%TwrSSSF(1,J       ,1)*x%QT(DOF_TSS1) + p%TwrSSSF(2,J       ,1)*x%QT(DOF_TSS2)
 
-      CALL SmllRotTrans( 'tower deflection (ElastoDyn SetCoordSy)', ThetaSS, 0.0_R8Ki, ThetaFA, TransMat, TRIM(Num2LStr(t))//' s', ErrStat2, ErrMsg2 )   ! Get the transformation matrix, TransMat, from tower-base to tower element-fixed coordinate systems.
+      CALL SmllRotTrans( 'tower deflection (ElastoDyn SetCoordSy)', ThetaSS, 0.0_R8Ki, ThetaFA, TransMat, ErrStat=ErrStat2, ErrMsg=ErrMsg2 )   ! Get the transformation matrix, TransMat, from tower-base to tower element-fixed coordinate systems.
          CALL CheckError( ErrStat2, ErrMsg2 )
          IF (ErrStat >= AbortErrLev) RETURN
 
@@ -6122,7 +6138,7 @@ SUBROUTINE SetCoordSy( t, CoordSys, RtHSdat, BlPitch, p, x, ErrStat, ErrMsg )
    ThetaFA    = -p%TwrFASF(1,p%TTopNode,1)*x%QT(DOF_TFA1) - p%TwrFASF(2,p%TTopNode,1)*x%QT(DOF_TFA2)
    ThetaSS    =  p%TwrSSSF(1,p%TTopNode,1)*x%QT(DOF_TSS1) + p%TwrSSSF(2,p%TTopNode,1)*x%QT(DOF_TSS2)
 
-   CALL SmllRotTrans( 'tower deflection (ElastoDyn SetCoordSy)', ThetaSS, 0.0_R8Ki, ThetaFA, TransMat, TRIM(Num2LStr(t))//' s', ErrStat2, ErrMsg2 )   ! Get the transformation matrix, TransMat, from tower-base to tower-top/base-plate coordinate systems.
+   CALL SmllRotTrans( 'tower deflection (ElastoDyn SetCoordSy)', ThetaSS, 0.0_R8Ki, ThetaFA, TransMat, ErrStat=ErrStat2, ErrMsg=ErrMsg2 )   ! Get the transformation matrix, TransMat, from tower-base to tower-top/base-plate coordinate systems.
       CALL CheckError( ErrStat2, ErrMsg2 )
       IF (ErrStat >= AbortErrLev) RETURN
 
@@ -6258,7 +6274,7 @@ SUBROUTINE SetCoordSy( t, CoordSys, RtHSdat, BlPitch, p, x, ErrStat, ErrMsg )
          ThetaLxb = p%CThetaS(K,J)*ThetaIP - p%SThetaS(K,J)*ThetaOoP
          ThetaLyb = p%SThetaS(K,J)*ThetaIP + p%CThetaS(K,J)*ThetaOoP
 
-         CALL SmllRotTrans( 'blade deflection (ElastoDyn SetCoordSy)', ThetaLxb, ThetaLyb, 0.0_R8Ki, TransMat, TRIM(Num2LStr(t))//' s', ErrStat2, ErrMsg2 ) ! Get the transformation matrix, TransMat, from blade coordinate system aligned with local structural axes (not element fixed) to blade element-fixed coordinate system aligned with local structural axes.
+         CALL SmllRotTrans( 'blade deflection (ElastoDyn SetCoordSy)', ThetaLxb, ThetaLyb, 0.0_R8Ki, TransMat, ErrStat=ErrStat2, ErrMsg=ErrMsg2 ) ! Get the transformation matrix, TransMat, from blade coordinate system aligned with local structural axes (not element fixed) to blade element-fixed coordinate system aligned with local structural axes.
             CALL CheckError( ErrStat2, ErrMsg2 )
             IF (ErrStat >= AbortErrLev) RETURN
 
@@ -6351,8 +6367,11 @@ CONTAINS
 
       IF ( ErrID /= ErrID_None ) THEN
 
+            ! The errors are from SmllRotTrans; the time is added here rather than passed to it, so that it is only formatted
+            ! when there is an error instead of in each call.
          IF (ErrStat /= ErrID_None) ErrMsg = TRIM(ErrMsg)//NewLine
-         ErrMsg = TRIM(ErrMsg)//'SetCoordSy:'//TRIM(Msg)
+         ErrMsg = TRIM(ErrMsg)//'SetCoordSy:'//TRIM(Msg)//NewLine//' Additional debugging message from SUBROUTINE SmllRotTrans(): '// &
+                  TRIM(Num2LStr(t))//' s'
          ErrStat = MAX(ErrStat, ErrID)
 
          !.........................................................................................................................
@@ -6822,6 +6841,7 @@ SUBROUTINE CalculateAngularPosVelPAcc( p, x, CoordSys, RtHSdat )
    REAL(ReKi)                   :: AngVelHM  (3)                                   ! Angular velocity of eleMent J of blade K (body M) in the hub (body H).
 !   REAL(ReKi)                   :: AngVelEN  (3)                                   ! Angular velocity of the nacelle (body N) in the inertia frame (body E for earth).
    REAL(ReKi)                   :: AngAccELt (3)                                   ! Portion of the angular acceleration of the low-speed shaft (body L) in the inertia frame (body E for earth) associated with everything but the QD2T()'s.
+   INTEGER(IntKi)               :: I                                               ! Counter for vector components
    INTEGER(IntKi)               :: J                                               ! Counter for elements
    INTEGER(IntKi)               :: K                                               ! Counter for blades
 
@@ -6897,42 +6917,42 @@ ENDIF
    RtHSdat%AngAccEXt               = 0.0
 
    RtHSdat%PAngVelEB(       :,1,:) =                  RtHSdat%PAngVelEX(:,1,:)
-   RtHSdat%PAngVelEB(DOF_TFA1,1,:) = CROSS_PRODUCT(   RtHSdat%AngVelEX,                   RtHSdat%PAngVelEB(DOF_TFA1,0,:) )
-   RtHSdat%PAngVelEB(DOF_TSS1,1,:) = CROSS_PRODUCT(   RtHSdat%AngVelEX,                   RtHSdat%PAngVelEB(DOF_TSS1,0,:) )
-   RtHSdat%PAngVelEB(DOF_TFA2,1,:) = CROSS_PRODUCT(   RtHSdat%AngVelEX,                   RtHSdat%PAngVelEB(DOF_TFA2,0,:) )
-   RtHSdat%PAngVelEB(DOF_TSS2,1,:) = CROSS_PRODUCT(   RtHSdat%AngVelEX,                   RtHSdat%PAngVelEB(DOF_TSS2,0,:) )
+   RtHSdat%PAngVelEB(DOF_TFA1,1,:) = CROSS_PRODUCT(   RtHSdat%AngVelEX,                   RtHSdat%PAngVelEB(DOF_TFA1,0,1:3) )
+   RtHSdat%PAngVelEB(DOF_TSS1,1,:) = CROSS_PRODUCT(   RtHSdat%AngVelEX,                   RtHSdat%PAngVelEB(DOF_TSS1,0,1:3) )
+   RtHSdat%PAngVelEB(DOF_TFA2,1,:) = CROSS_PRODUCT(   RtHSdat%AngVelEX,                   RtHSdat%PAngVelEB(DOF_TFA2,0,1:3) )
+   RtHSdat%PAngVelEB(DOF_TSS2,1,:) = CROSS_PRODUCT(   RtHSdat%AngVelEX,                   RtHSdat%PAngVelEB(DOF_TSS2,0,1:3) )
    RtHSdat%AngAccEBt               =                  RtHSdat%AngAccEXt + x%QDT(DOF_TFA1)*RtHSdat%PAngVelEB(DOF_TFA1,1,:) &
                                                                         + x%QDT(DOF_TSS1)*RtHSdat%PAngVelEB(DOF_TSS1,1,:) &
                                                                         + x%QDT(DOF_TFA2)*RtHSdat%PAngVelEB(DOF_TFA2,1,:) &
                                                                         + x%QDT(DOF_TSS2)*RtHSdat%PAngVelEB(DOF_TSS2,1,:)
 
    RtHSdat%PAngVelEN(       :,1,:) =                 RtHSdat%PAngVelEB(:,1,:)
-   RtHSdat%PAngVelEN(DOF_Yaw ,1,:) = CROSS_PRODUCT(  RtHSdat%AngVelEB,                    RtHSdat%PAngVelEN(DOF_Yaw ,0,:) )
+   RtHSdat%PAngVelEN(DOF_Yaw ,1,:) = CROSS_PRODUCT(  RtHSdat%AngVelEB,                    RtHSdat%PAngVelEN(DOF_Yaw ,0,1:3) )
    RtHSdat%AngAccENt               =                 RtHSdat%AngAccEBt  + x%QDT(DOF_Yaw )*RtHSdat%PAngVelEN(DOF_Yaw ,1,:)
 
    RtHSdat%PAngVelER(       :,1,:) =                 RtHSdat%PAngVelEN(:,1,:)
-   RtHSdat%PAngVelER(DOF_RFrl,1,:) = CROSS_PRODUCT(  RtHSdat%AngVelEN,                    RtHSdat%PAngVelER(DOF_RFrl,0,:) )
+   RtHSdat%PAngVelER(DOF_RFrl,1,:) = CROSS_PRODUCT(  RtHSdat%AngVelEN,                    RtHSdat%PAngVelER(DOF_RFrl,0,1:3) )
    RtHSdat%AngAccERt               =                 RtHSdat%AngAccENt  + x%QDT(DOF_RFrl)*RtHSdat%PAngVelER(DOF_RFrl,1,:)
 
    RtHSdat%PAngVelEL(       :,1,:) =                 RtHSdat%PAngVelER(:,1,:)
-   RtHSdat%PAngVelEL(DOF_GeAz,1,:) = CROSS_PRODUCT(  RtHSdat%AngVelER,                    RtHSdat%PAngVelEL(DOF_GeAz,0,:) )
-   RtHSdat%PAngVelEL(DOF_DrTr,1,:) = CROSS_PRODUCT(  RtHSdat%AngVelER,                    RtHSdat%PAngVelEL(DOF_DrTr,0,:) )
+   RtHSdat%PAngVelEL(DOF_GeAz,1,:) = CROSS_PRODUCT(  RtHSdat%AngVelER,                    RtHSdat%PAngVelEL(DOF_GeAz,0,1:3) )
+   RtHSdat%PAngVelEL(DOF_DrTr,1,:) = CROSS_PRODUCT(  RtHSdat%AngVelER,                    RtHSdat%PAngVelEL(DOF_DrTr,0,1:3) )
            AngAccELt               =                 RtHSdat%AngAccERt  + x%QDT(DOF_GeAz)*RtHSdat%PAngVelEL(DOF_GeAz,1,:) &
                                                                         + x%QDT(DOF_DrTr)*RtHSdat%PAngVelEL(DOF_DrTr,1,:)
 
    RtHSdat%PAngVelEH(       :,1,:) = RtHSdat%PAngVelEL(:,1,:)
    RtHSdat%AngAccEHt               =                  AngAccELt
 IF ( p%NumBl == 2 )  THEN ! 2-blader
-   RtHSdat%PAngVelEH(DOF_Teet,1,:) = CROSS_PRODUCT(  RtHSdat%AngVelEH,                    RtHSdat%PAngVelEH(DOF_Teet,0,:) )
+   RtHSdat%PAngVelEH(DOF_Teet,1,:) = CROSS_PRODUCT(  RtHSdat%AngVelEH,                    RtHSdat%PAngVelEH(DOF_Teet,0,1:3) )
    RtHSdat%AngAccEHt               =                 RtHSdat%AngAccEHt   + x%QDT(DOF_Teet)*RtHSdat%PAngVelEH(DOF_Teet,1,:)
 ENDIF
 
    RtHSdat%PAngVelEG(       :,1,:) = RtHSdat%PAngVelER(:,1,:)
-   RtHSdat%PAngVelEG(DOF_GeAz,1,:) = CROSS_PRODUCT(  RtHSdat%AngVelER,                    RtHSdat%PAngVelEG(DOF_GeAz,0,:) )
+   RtHSdat%PAngVelEG(DOF_GeAz,1,:) = CROSS_PRODUCT(  RtHSdat%AngVelER,                    RtHSdat%PAngVelEG(DOF_GeAz,0,1:3) )
    RtHSdat%AngAccEGt               =                 RtHSdat%AngAccERt  + x%QDT(DOF_GeAz)*RtHSdat%PAngVelEG(DOF_GeAz,1,:)
 
    RtHSdat%PAngVelEA(       :,1,:) = RtHSdat%PAngVelEN(:,1,:)
-   RtHSdat%PAngVelEA(DOF_TFrl,1,:) = CROSS_PRODUCT(  RtHSdat%AngVelEN,                    RtHSdat%PAngVelEA(DOF_TFrl,0,:) )
+   RtHSdat%PAngVelEA(DOF_TFrl,1,:) = CROSS_PRODUCT(  RtHSdat%AngVelEN,                    RtHSdat%PAngVelEA(DOF_TFrl,0,1:3) )
    RtHSdat%AngAccEAt               =                 RtHSdat%AngAccENt  + x%QDT(DOF_TFrl)*RtHSdat%PAngVelEA(DOF_TFrl,1,:)
 
 
@@ -6944,7 +6964,9 @@ ENDIF
       ! NOTE: PAngVelEM(K,J,I,D,:) = the Dth-derivative of the partial angular velocity
       !   of DOF I for body M of blade K, element J in body E.
 
-         RtHSdat%PAngVelEM(K,J,          :,0,:) = RtHSdat%PAngVelEH(:,0,:)
+         DO I = 1,3  ! (component by component: the whole-block copy would make an array temporary)
+            RtHSdat%PAngVelEM(K,J,       :,0,I) = RtHSdat%PAngVelEH(:,0,I)
+         END DO
          RtHSdat%PAngVelEM(K,J,DOF_BF(K,1),0,:) = - p%TwistedSF(K,2,1,J,1)*CoordSys%j1(K,:) &
                                                   + p%TwistedSF(K,1,1,J,1)*CoordSys%j2(K,:)
          RtHSdat%PAngVelEM(K,J,DOF_BF(K,2),0,:) = - p%TwistedSF(K,2,2,J,1)*CoordSys%j1(K,:) &
@@ -7001,10 +7023,10 @@ ENDIF
       RtHSdat%PAngVelEF (J,DOF_TSS2,0,:) =  p%TwrSSSF(2,J,1)*CoordSys%a1
 
       RtHSdat%PAngVelEF (J,       :,1,:) = RtHSdat%PAngVelEX(:,1,:)
-      RtHSdat%PAngVelEF (J,DOF_TFA1,1,:) = CROSS_PRODUCT(  RtHSdat%AngVelEX  ,  RtHSdat%PAngVelEF(J,DOF_TFA1,0,:) )
-      RtHSdat%PAngVelEF (J,DOF_TSS1,1,:) = CROSS_PRODUCT(  RtHSdat%AngVelEX  ,  RtHSdat%PAngVelEF(J,DOF_TSS1,0,:) )
-      RtHSdat%PAngVelEF (J,DOF_TFA2,1,:) = CROSS_PRODUCT(  RtHSdat%AngVelEX  ,  RtHSdat%PAngVelEF(J,DOF_TFA2,0,:) )
-      RtHSdat%PAngVelEF (J,DOF_TSS2,1,:) = CROSS_PRODUCT(  RtHSdat%AngVelEX  ,  RtHSdat%PAngVelEF(J,DOF_TSS2,0,:) )
+      RtHSdat%PAngVelEF (J,DOF_TFA1,1,:) = CROSS_PRODUCT(  RtHSdat%AngVelEX  ,  RtHSdat%PAngVelEF(J,DOF_TFA1,0,1:3) )
+      RtHSdat%PAngVelEF (J,DOF_TSS1,1,:) = CROSS_PRODUCT(  RtHSdat%AngVelEX  ,  RtHSdat%PAngVelEF(J,DOF_TSS1,0,1:3) )
+      RtHSdat%PAngVelEF (J,DOF_TFA2,1,:) = CROSS_PRODUCT(  RtHSdat%AngVelEX  ,  RtHSdat%PAngVelEF(J,DOF_TFA2,0,1:3) )
+      RtHSdat%PAngVelEF (J,DOF_TSS2,1,:) = CROSS_PRODUCT(  RtHSdat%AngVelEX  ,  RtHSdat%PAngVelEF(J,DOF_TSS2,0,1:3) )
 
 
       RtHSdat%AngVelEF (:,J)            =  RtHSdat%AngVelEX  + x%QDT(DOF_TFA1)*RtHSdat%PAngVelEF(J,DOF_TFA1,0,:) &
@@ -7136,8 +7158,8 @@ SUBROUTINE CalculateLinearVelPAcc( p, x, CoordSys, RtHSdat )
    RtHSdat%PLinVelEY(       :,:,:) = RtHSdat%PLinVelEZ(:,:,:)
    DO I = 1,NPX   ! Loop through all DOFs associated with the angular motion of the platform (body X)
 
-      TmpVec0 = CROSS_PRODUCT( RtHSdat%PAngVelEX(PX(I)   ,0,:), RtHSdat%rZY  )
-      TmpVec1 = CROSS_PRODUCT( RtHSdat%PAngVelEX(PX(I)   ,0,:),     EwXXrZY  )
+      TmpVec0 = CROSS_PRODUCT( RtHSdat%PAngVelEX(PX(I)   ,0,1:3), RtHSdat%rZY  )
+      TmpVec1 = CROSS_PRODUCT( RtHSdat%PAngVelEX(PX(I)   ,0,1:3),     EwXXrZY  )
 
       RtHSdat%PLinVelEY(PX(I),0,:) = TmpVec0   +                       RtHSdat%PLinVelEY(PX(I)   ,0,:)
       RtHSdat%PLinVelEY(PX(I),1,:) = TmpVec1   +                       RtHSdat%PLinVelEY(PX(I)   ,1,:)
@@ -7157,10 +7179,10 @@ SUBROUTINE CalculateLinearVelPAcc( p, x, CoordSys, RtHSdat )
    RtHSdat%PLinVelEO(DOF_TSS2,0,:) = CoordSys%a3 - (   p%AxRedTSS(2,2,p%TTopNode)* x%QT(DOF_TSS2) &
                                                      + p%AxRedTSS(1,2,p%TTopNode)* x%QT(DOF_TSS1)   )*CoordSys%a2
 
-   TmpVec1 = CROSS_PRODUCT(   RtHSdat%AngVelEX   , RtHSdat%PLinVelEO(DOF_TFA1,0,:) )
-   TmpVec2 = CROSS_PRODUCT(   RtHSdat%AngVelEX   , RtHSdat%PLinVelEO(DOF_TSS1,0,:) )
-   TmpVec3 = CROSS_PRODUCT(   RtHSdat%AngVelEX   , RtHSdat%PLinVelEO(DOF_TFA2,0,:) )
-   TmpVec4 = CROSS_PRODUCT(   RtHSdat%AngVelEX   , RtHSdat%PLinVelEO(DOF_TSS2,0,:) )
+   TmpVec1 = CROSS_PRODUCT(   RtHSdat%AngVelEX   , RtHSdat%PLinVelEO(DOF_TFA1,0,1:3) )
+   TmpVec2 = CROSS_PRODUCT(   RtHSdat%AngVelEX   , RtHSdat%PLinVelEO(DOF_TSS1,0,1:3) )
+   TmpVec3 = CROSS_PRODUCT(   RtHSdat%AngVelEX   , RtHSdat%PLinVelEO(DOF_TFA2,0,1:3) )
+   TmpVec4 = CROSS_PRODUCT(   RtHSdat%AngVelEX   , RtHSdat%PLinVelEO(DOF_TSS2,0,1:3) )
 
    RtHSdat%PLinVelEO(DOF_TFA1,1,:) = TmpVec1 - (   p%AxRedTFA(1,1,p%TTopNode)*x%QDT(DOF_TFA1) &
                                                  + p%AxRedTFA(1,2,p%TTopNode)*x%QDT(DOF_TFA2)   )*CoordSys%a2
@@ -7183,8 +7205,8 @@ SUBROUTINE CalculateLinearVelPAcc( p, x, CoordSys, RtHSdat )
    RtHSdat%LinVelEO = LinVelXO + RtHSdat%LinVelEZ
    DO I = 1,NPX   ! Loop through all DOFs associated with the angular motion of the platform (body X)
 
-      TmpVec0 = CROSS_PRODUCT( RtHSdat%PAngVelEX(PX(I)   ,0,:), RtHSdat%rZO                 )
-      TmpVec1 = CROSS_PRODUCT( RtHSdat%PAngVelEX(PX(I)   ,0,:),     EwXXrZO + LinVelXO      )
+      TmpVec0 = CROSS_PRODUCT( RtHSdat%PAngVelEX(PX(I)   ,0,1:3), RtHSdat%rZO                 )
+      TmpVec1 = CROSS_PRODUCT( RtHSdat%PAngVelEX(PX(I)   ,0,1:3),     EwXXrZO + LinVelXO      )
 
       RtHSdat%PLinVelEO(PX(I),0,:) = TmpVec0    +                       RtHSdat%PLinVelEO(PX(I)   ,0,:)
       RtHSdat%PLinVelEO(PX(I),1,:) = TmpVec1    +                       RtHSdat%PLinVelEO(PX(I)   ,1,:)
@@ -7198,9 +7220,9 @@ SUBROUTINE CalculateLinearVelPAcc( p, x, CoordSys, RtHSdat )
    RtHSdat%PLinVelEU(       :,:,:) = RtHSdat%PLinVelEO(:,:,:)
    DO I = 1,NPN   ! Loop through all DOFs associated with the angular motion of the nacelle (body N)
 
-      TmpVec0 = CROSS_PRODUCT( RtHSdat%PAngVelEN(PN(I)   ,0,:), RtHSdat%rOU                 )
-      TmpVec1 = CROSS_PRODUCT( RtHSdat%PAngVelEN(PN(I)   ,0,:),     EwNXrOU                 )
-      TmpVec2 = CROSS_PRODUCT( RtHSdat%PAngVelEN(PN(I)   ,1,:), RtHSdat%rOU                 )
+      TmpVec0 = CROSS_PRODUCT( RtHSdat%PAngVelEN(PN(I)   ,0,1:3), RtHSdat%rOU                 )
+      TmpVec1 = CROSS_PRODUCT( RtHSdat%PAngVelEN(PN(I)   ,0,1:3),     EwNXrOU                 )
+      TmpVec2 = CROSS_PRODUCT( RtHSdat%PAngVelEN(PN(I)   ,1,1:3), RtHSdat%rOU                 )
 
       RtHSdat%PLinVelEU(PN(I),0,:) = TmpVec0    +               RtHSdat%PLinVelEU(PN(I)   ,0,:)
       RtHSdat%PLinVelEU(PN(I),1,:) = TmpVec1    + TmpVec2 +     RtHSdat%PLinVelEU(PN(I)   ,1,:)
@@ -7213,9 +7235,9 @@ SUBROUTINE CalculateLinearVelPAcc( p, x, CoordSys, RtHSdat )
    RtHSdat%PLinVelEV(       :,:,:) = RtHSdat%PLinVelEO(:,:,:)
    DO I = 1,NPN   ! Loop through all DOFs associated with the angular motion of the nacelle (body N)
 
-      TmpVec0 = CROSS_PRODUCT( RtHSdat%PAngVelEN(PN(I)   ,0,:), RtHSdat%rOV                 )
-      TmpVec1 = CROSS_PRODUCT( RtHSdat%PAngVelEN(PN(I)   ,0,:),     EwNXrOV                 )
-      TmpVec2 = CROSS_PRODUCT( RtHSdat%PAngVelEN(PN(I)   ,1,:), RtHSdat%rOV                 )
+      TmpVec0 = CROSS_PRODUCT( RtHSdat%PAngVelEN(PN(I)   ,0,1:3), RtHSdat%rOV                 )
+      TmpVec1 = CROSS_PRODUCT( RtHSdat%PAngVelEN(PN(I)   ,0,1:3),     EwNXrOV                 )
+      TmpVec2 = CROSS_PRODUCT( RtHSdat%PAngVelEN(PN(I)   ,1,1:3), RtHSdat%rOV                 )
 
       RtHSdat%PLinVelEV(PN(I),0,:) = TmpVec0    +               RtHSdat%PLinVelEV(PN(I)   ,0,:)
       RtHSdat%PLinVelEV(PN(I),1,:) = TmpVec1    + TmpVec2 +     RtHSdat%PLinVelEV(PN(I)   ,1,:)
@@ -7228,9 +7250,9 @@ SUBROUTINE CalculateLinearVelPAcc( p, x, CoordSys, RtHSdat )
    RtHSdat%PLinVelED(       :,:,:) = RtHSdat%PLinVelEV(:,:,:)
    DO I = 1,NPR   ! Loop through all DOFs associated with the angular motion of the structure that furls with the rotor (not including rotor) (body R)
 
-      TmpVec0 = CROSS_PRODUCT( RtHSdat%PAngVelER(PR(I)   ,0,:), RtHSdat%rVD                 )
-      TmpVec1 = CROSS_PRODUCT( RtHSdat%PAngVelER(PR(I)   ,0,:),     EwRXrVD                 )
-      TmpVec2 = CROSS_PRODUCT( RtHSdat%PAngVelER(PR(I)   ,1,:), RtHSdat%rVD                 )
+      TmpVec0 = CROSS_PRODUCT( RtHSdat%PAngVelER(PR(I)   ,0,1:3), RtHSdat%rVD                 )
+      TmpVec1 = CROSS_PRODUCT( RtHSdat%PAngVelER(PR(I)   ,0,1:3),     EwRXrVD                 )
+      TmpVec2 = CROSS_PRODUCT( RtHSdat%PAngVelER(PR(I)   ,1,1:3), RtHSdat%rVD                 )
 
       RtHSdat%PLinVelED(PR(I),0,:) = TmpVec0    +                       RtHSdat%PLinVelED(PR(I)   ,0,:)
       RtHSdat%PLinVelED(PR(I),1,:) = TmpVec1    + TmpVec2 +             RtHSdat%PLinVelED(PR(I)   ,1,:)
@@ -7244,9 +7266,9 @@ SUBROUTINE CalculateLinearVelPAcc( p, x, CoordSys, RtHSdat )
     RtHSdat%LinVelEIMU             =  RtHSdat%LinVelEZ
    DO I = 1,NPR   ! Loop through all DOFs associated with the angular motion of the structure that furls with the rotor (not including rotor) (body R)
 
-      TmpVec0 = CROSS_PRODUCT( RtHSdat%PAngVelER(PR(I)   ,0,:), RtHSdat%rVIMU               )
-      TmpVec1 = CROSS_PRODUCT( RtHSdat%PAngVelER(PR(I)   ,0,:),     EwRXrVIMU               )
-      TmpVec2 = CROSS_PRODUCT( RtHSdat%PAngVelER(PR(I)   ,1,:), RtHSdat%rVIMU               )
+      TmpVec0 = CROSS_PRODUCT( RtHSdat%PAngVelER(PR(I)   ,0,1:3), RtHSdat%rVIMU               )
+      TmpVec1 = CROSS_PRODUCT( RtHSdat%PAngVelER(PR(I)   ,0,1:3),     EwRXrVIMU               )
+      TmpVec2 = CROSS_PRODUCT( RtHSdat%PAngVelER(PR(I)   ,1,1:3), RtHSdat%rVIMU               )
 
       RtHSdat%PLinVelEIMU(PR(I),0,:) = TmpVec0    +                         RtHSdat%PLinVelEIMU(PR(I) ,0,:)
       RtHSdat%PLinVelEIMU(PR(I),1,:) = TmpVec1    + TmpVec2 +               RtHSdat%PLinVelEIMU(PR(I) ,1,:)
@@ -7260,9 +7282,9 @@ SUBROUTINE CalculateLinearVelPAcc( p, x, CoordSys, RtHSdat )
    RtHSdat%PLinVelEP(       :,:,:) = RtHSdat%PLinVelEV(:,:,:)
    DO I = 1,NPR   ! Loop through all DOFs associated with the angular motion of the structure that furls with the rotor (not including rotor) (body R)
 
-      TmpVec0 = CROSS_PRODUCT(             RtHSdat%PAngVelER(PR(I)   ,0,:),     RtHSdat%rVP                 )
-      TmpVec1 = CROSS_PRODUCT(             RtHSdat%PAngVelER(PR(I)   ,0,:), EwRXrVP                 )
-      TmpVec2 = CROSS_PRODUCT(             RtHSdat%PAngVelER(PR(I)   ,1,:),     RtHSdat%rVP                 )
+      TmpVec0 = CROSS_PRODUCT(             RtHSdat%PAngVelER(PR(I)   ,0,1:3),     RtHSdat%rVP                 )
+      TmpVec1 = CROSS_PRODUCT(             RtHSdat%PAngVelER(PR(I)   ,0,1:3), EwRXrVP                 )
+      TmpVec2 = CROSS_PRODUCT(             RtHSdat%PAngVelER(PR(I)   ,1,1:3),     RtHSdat%rVP                 )
 
       RtHSdat%PLinVelEP(PR(I),0,:) = TmpVec0    +               RtHSdat%PLinVelEP(PR(I)   ,0,:)
       RtHSdat%PLinVelEP(PR(I),1,:) = TmpVec1    + TmpVec2 +     RtHSdat%PLinVelEP(PR(I)   ,1,:)
@@ -7276,9 +7298,9 @@ SUBROUTINE CalculateLinearVelPAcc( p, x, CoordSys, RtHSdat )
     RtHSdat%LinVelEQ               =  RtHSdat%LinVelEZ
    DO I = 1,p%NPH   ! Loop through all DOFs associated with the angular motion of the hub (body H)
 
-      TmpVec0 = CROSS_PRODUCT( RtHSdat%PAngVelEH(p%PH(I)   ,0,:),   RtHSdat%rPQ  )
-      TmpVec1 = CROSS_PRODUCT( RtHSdat%PAngVelEH(p%PH(I)   ,0,:),       EwHXrPQ  )
-      TmpVec2 = CROSS_PRODUCT( RtHSdat%PAngVelEH(p%PH(I)   ,1,:),   RtHSdat%rPQ  )
+      TmpVec0 = CROSS_PRODUCT( RtHSdat%PAngVelEH(p%PH(I)   ,0,1:3),   RtHSdat%rPQ  )
+      TmpVec1 = CROSS_PRODUCT( RtHSdat%PAngVelEH(p%PH(I)   ,0,1:3),       EwHXrPQ  )
+      TmpVec2 = CROSS_PRODUCT( RtHSdat%PAngVelEH(p%PH(I)   ,1,1:3),   RtHSdat%rPQ  )
 
       RtHSdat%PLinVelEQ(p%PH(I),0,:) = TmpVec0    +                 RtHSdat%PLinVelEQ(p%PH(I)   ,0,:)
       RtHSdat%PLinVelEQ(p%PH(I),1,:) = TmpVec1    + TmpVec2 +       RtHSdat%PLinVelEQ(p%PH(I)   ,1,:)
@@ -7292,9 +7314,9 @@ SUBROUTINE CalculateLinearVelPAcc( p, x, CoordSys, RtHSdat )
    RtHSdat%PLinVelEC(       :,:,:) = RtHSdat%PLinVelEQ(:,:,:)
    DO I = 1,p%NPH   ! Loop through all DOFs associated with the angular motion of the hub (body H)
 
-      TmpVec0 = CROSS_PRODUCT( RtHSdat%PAngVelEH(p%PH(I)   ,0,:), RtHSdat%rQC )
-      TmpVec1 = CROSS_PRODUCT( RtHSdat%PAngVelEH(p%PH(I)   ,0,:),     EwHXrQC )
-      TmpVec2 = CROSS_PRODUCT( RtHSdat%PAngVelEH(p%PH(I)   ,1,:), RtHSdat%rQC )
+      TmpVec0 = CROSS_PRODUCT( RtHSdat%PAngVelEH(p%PH(I)   ,0,1:3), RtHSdat%rQC )
+      TmpVec1 = CROSS_PRODUCT( RtHSdat%PAngVelEH(p%PH(I)   ,0,1:3),     EwHXrQC )
+      TmpVec2 = CROSS_PRODUCT( RtHSdat%PAngVelEH(p%PH(I)   ,1,1:3), RtHSdat%rQC )
 
       RtHSdat%PLinVelEC(p%PH(I),0,:) = TmpVec0    +                         RtHSdat%PLinVelEC(p%PH(I)   ,0,:)
       RtHSdat%PLinVelEC(p%PH(I),1,:) = TmpVec1    + TmpVec2 +               RtHSdat%PLinVelEC(p%PH(I)   ,1,:)
@@ -7318,7 +7340,9 @@ SUBROUTINE CalculateLinearVelPAcc( p, x, CoordSys, RtHSdat )
 
          EwHXrQS = CROSS_PRODUCT(  RtHSdat%AngVelEH, RtHSdat%rQS(:,K,J) )
 
-         RtHSdat%PLinVelES(K,J,          :,:,:) = RtHSdat%PLinVelEQ(:,:,:)
+         DO I = 1,3  ! (component by component: the whole-block copy would make an array temporary)
+            RtHSdat%PLinVelES(K,J,       :,:,I) = RtHSdat%PLinVelEQ(:,:,I)
+         END DO
          RtHSdat%PLinVelES(K,J,DOF_BF(K,1),0,:) = p%TwistedSF(K,1,1,J,0)                          *CoordSys%j1(K,:) &  !bjj: this line can be optimized
                                                 + p%TwistedSF(K,2,1,J,0)                          *CoordSys%j2(K,:) &
                                                 - (   p%AxRedBld(K,1,1,J)*x%QT ( DOF_BF(K,1) ) &
@@ -7335,9 +7359,9 @@ SUBROUTINE CalculateLinearVelPAcc( p, x, CoordSys, RtHSdat )
                                                     + p%AxRedBld(K,1,2,J)*x%QT ( DOF_BF(K,1) ) &
                                                     + p%AxRedBld(K,2,3,J)*x%QT ( DOF_BE(K,1) )   )*CoordSys%j3(K,:)
 
-         TmpVec1 = CROSS_PRODUCT( RtHSdat%AngVelEH, RtHSdat%PLinVelES(K,J,DOF_BF(K,1),0,:) )
-         TmpVec2 = CROSS_PRODUCT( RtHSdat%AngVelEH, RtHSdat%PLinVelES(K,J,DOF_BE(K,1),0,:) )
-         TmpVec3 = CROSS_PRODUCT( RtHSdat%AngVelEH, RtHSdat%PLinVelES(K,J,DOF_BF(K,2),0,:) )
+         TmpVec1 = CROSS_PRODUCT( RtHSdat%AngVelEH, RtHSdat%PLinVelES(K,J,DOF_BF(K,1),0,1:3) )
+         TmpVec2 = CROSS_PRODUCT( RtHSdat%AngVelEH, RtHSdat%PLinVelES(K,J,DOF_BE(K,1),0,1:3) )
+         TmpVec3 = CROSS_PRODUCT( RtHSdat%AngVelEH, RtHSdat%PLinVelES(K,J,DOF_BF(K,2),0,1:3) )
 
          RtHSdat%PLinVelES(K,J,DOF_BF(K,1),1,:) = TmpVec1 &
                                                 - (   p%AxRedBld(K,1,1,J)*x%QDT( DOF_BF(K,1) ) &
@@ -7362,9 +7386,9 @@ SUBROUTINE CalculateLinearVelPAcc( p, x, CoordSys, RtHSdat )
          RtHSdat%LinVelES(:,J,K)  = LinVelHS + RtHSdat%LinVelEZ
          DO I = 1,p%NPH   ! Loop through all DOFs associated with the angular motion of the hub (body H)
 
-            TmpVec0 = CROSS_PRODUCT(   RtHSdat%PAngVelEH(p%PH(I),0,:), RtHSdat%rQS(:,K,J)            )  !bjj: this line can be optimized
-            TmpVec1 = CROSS_PRODUCT(   RtHSdat%PAngVelEH(p%PH(I),0,:),     EwHXrQS        + LinVelHS )  !bjj: this line can be optimized
-            TmpVec2 = CROSS_PRODUCT(   RtHSdat%PAngVelEH(p%PH(I),1,:), RtHSdat%rQS(:,K,J)            )  !bjj: this line can be optimized
+            TmpVec0 = CROSS_PRODUCT(   RtHSdat%PAngVelEH(p%PH(I),0,1:3), RtHSdat%rQS(:,K,J)            )  !bjj: this line can be optimized
+            TmpVec1 = CROSS_PRODUCT(   RtHSdat%PAngVelEH(p%PH(I),0,1:3),     EwHXrQS        + LinVelHS )  !bjj: this line can be optimized
+            TmpVec2 = CROSS_PRODUCT(   RtHSdat%PAngVelEH(p%PH(I),1,1:3), RtHSdat%rQS(:,K,J)            )  !bjj: this line can be optimized
 
             RtHSdat%PLinVelES(K,J,p%PH(I),0,:) = RtHSdat%PLinVelES(K,J,p%PH(I),0,:) + TmpVec0            !bjj: this line can be optimized
             RtHSdat%PLinVelES(K,J,p%PH(I),1,:) = RtHSdat%PLinVelES(K,J,p%PH(I),1,:) + TmpVec1 + TmpVec2  !bjj: this line can be optimized
@@ -7388,9 +7412,9 @@ SUBROUTINE CalculateLinearVelPAcc( p, x, CoordSys, RtHSdat )
    RtHSdat%PLinVelEW(       :,:,:) = RtHSdat%PLinVelEO(:,:,:)
    DO I = 1,NPN   ! Loop through all DOFs associated with the angular motion of the nacelle (body N)
 
-      TmpVec0 = CROSS_PRODUCT( RtHSdat%PAngVelEN(PN(I)   ,0,:), RtHSdat%rOW                 )
-      TmpVec1 = CROSS_PRODUCT( RtHSdat%PAngVelEN(PN(I)   ,0,:),     EwNXrOW                 )
-      TmpVec2 = CROSS_PRODUCT( RtHSdat%PAngVelEN(PN(I)   ,1,:), RtHSdat%rOW                 )
+      TmpVec0 = CROSS_PRODUCT( RtHSdat%PAngVelEN(PN(I)   ,0,1:3), RtHSdat%rOW                 )
+      TmpVec1 = CROSS_PRODUCT( RtHSdat%PAngVelEN(PN(I)   ,0,1:3),     EwNXrOW                 )
+      TmpVec2 = CROSS_PRODUCT( RtHSdat%PAngVelEN(PN(I)   ,1,1:3), RtHSdat%rOW                 )
 
       RtHSdat%PLinVelEW(PN(I),0,:) = TmpVec0    +               RtHSdat%PLinVelEW(PN(I)   ,0,:)
       RtHSdat%PLinVelEW(PN(I),1,:) = TmpVec1    + TmpVec2 +     RtHSdat%PLinVelEW(PN(I)   ,1,:)
@@ -7403,9 +7427,9 @@ SUBROUTINE CalculateLinearVelPAcc( p, x, CoordSys, RtHSdat )
    RtHSdat%PLinVelEI(       :,:,:) = RtHSdat%PLinVelEW(:,:,:)
    DO I = 1,NPA   ! Loop through all DOFs associated with the angular motion of the tail (body A)
 
-      TmpVec0 = CROSS_PRODUCT( RtHSdat%PAngVelEA(PA(I)   ,0,:), RtHSdat%rWI                 )
-      TmpVec1 = CROSS_PRODUCT( RtHSdat%PAngVelEA(PA(I)   ,0,:),     EwAXrWI                 )
-      TmpVec2 = CROSS_PRODUCT( RtHSdat%PAngVelEA(PA(I)   ,1,:), RtHSdat%rWI                 )
+      TmpVec0 = CROSS_PRODUCT( RtHSdat%PAngVelEA(PA(I)   ,0,1:3), RtHSdat%rWI                 )
+      TmpVec1 = CROSS_PRODUCT( RtHSdat%PAngVelEA(PA(I)   ,0,1:3),     EwAXrWI                 )
+      TmpVec2 = CROSS_PRODUCT( RtHSdat%PAngVelEA(PA(I)   ,1,1:3), RtHSdat%rWI                 )
 
       RtHSdat%PLinVelEI(PA(I),0,:) = TmpVec0    +                       RtHSdat%PLinVelEI(PA(I)   ,0,:)
       RtHSdat%PLinVelEI(PA(I),1,:) = TmpVec1    + TmpVec2 +             RtHSdat%PLinVelEI(PA(I)   ,1,:)
@@ -7418,9 +7442,9 @@ SUBROUTINE CalculateLinearVelPAcc( p, x, CoordSys, RtHSdat )
    RtHSdat%PLinVelEJ(       :,:,:) = RtHSdat%PLinVelEW(:,:,:)
    DO I = 1,NPA   ! Loop through all DOFs associated with the angular motion of the tail (body A)
 
-      TmpVec0 = CROSS_PRODUCT( RtHSdat%PAngVelEA(PA(I)   ,0,:), RtHSdat%rWJ                 )
-      TmpVec1 = CROSS_PRODUCT( RtHSdat%PAngVelEA(PA(I)   ,0,:),     EwAXrWJ                 )
-      TmpVec2 = CROSS_PRODUCT( RtHSdat%PAngVelEA(PA(I)   ,1,:), RtHSdat%rWJ                 )
+      TmpVec0 = CROSS_PRODUCT( RtHSdat%PAngVelEA(PA(I)   ,0,1:3), RtHSdat%rWJ                 )
+      TmpVec1 = CROSS_PRODUCT( RtHSdat%PAngVelEA(PA(I)   ,0,1:3),     EwAXrWJ                 )
+      TmpVec2 = CROSS_PRODUCT( RtHSdat%PAngVelEA(PA(I)   ,1,1:3), RtHSdat%rWJ                 )
 
       RtHSdat%PLinVelEJ(PA(I),0,:) = TmpVec0    +               RtHSdat%PLinVelEJ(PA(I)   ,0,:)
       RtHSdat%PLinVelEJ(PA(I),1,:) = TmpVec1    + TmpVec2 +     RtHSdat%PLinVelEJ(PA(I)   ,1,:)
@@ -7433,9 +7457,9 @@ SUBROUTINE CalculateLinearVelPAcc( p, x, CoordSys, RtHSdat )
     LinVelEK               =  RtHSdat%LinVelEZ
    DO I = 1,NPA   ! Loop through all DOFs associated with the angular motion of the tail (body A)
 
-      TmpVec0  = CROSS_PRODUCT( RtHSdat%PAngVelEA(PA(I)   ,0,:), RtHSdat%rWK                 )
-      TmpVec1  = CROSS_PRODUCT( RtHSdat%PAngVelEA(PA(I)   ,0,:),         EwAXrWK             )
-      TmpVec2  = CROSS_PRODUCT( RtHSdat%PAngVelEA(PA(I)   ,1,:), RtHSdat%rWK                 )
+      TmpVec0  = CROSS_PRODUCT( RtHSdat%PAngVelEA(PA(I)   ,0,1:3), RtHSdat%rWK                 )
+      TmpVec1  = CROSS_PRODUCT( RtHSdat%PAngVelEA(PA(I)   ,0,1:3),         EwAXrWK             )
+      TmpVec2  = CROSS_PRODUCT( RtHSdat%PAngVelEA(PA(I)   ,1,1:3), RtHSdat%rWK                 )
 
       RtHSdat%PLinVelEK(PA(I),0,:) = TmpVec0    +                RtHSdat%PLinVelEK(PA(I)   ,0,:)
       RtHSdat%PLinVelEK(PA(I),1,:) = TmpVec1    + TmpVec2 +      RtHSdat%PLinVelEK(PA(I)   ,1,:)
@@ -7457,7 +7481,10 @@ SUBROUTINE CalculateLinearVelPAcc( p, x, CoordSys, RtHSdat )
 
       EwXXrZT                   = CROSS_PRODUCT(  RtHSdat%AngVelEX, RtHSdat%rZT(:,J) )
 
-      RtHSdat%PLinVelET(J,       :,:,:) = RtHSdat%PLinVelEZ(:,:,:)  !bjj: can this line be optimized
+      DO I = 1,3  ! (component by component: the whole-block copy would make an array temporary)
+         RtHSdat%PLinVelET(J,    :,0,I) = RtHSdat%PLinVelEZ(:,0,I)
+         RtHSdat%PLinVelET(J,    :,1,I) = RtHSdat%PLinVelEZ(:,1,I)
+      END DO
       RtHSdat%PLinVelET(J,DOF_TFA1,0,:) = p%TwrFASF(1,J,0)*CoordSys%a1 - (   p%AxRedTFA(1,1,J)* x%QT(DOF_TFA1) &
                                                                            + p%AxRedTFA(1,2,J)* x%QT(DOF_TFA2)   )*CoordSys%a2  
       RtHSdat%PLinVelET(J,DOF_TSS1,0,:) = p%TwrSSSF(1,J,0)*CoordSys%a3 - (   p%AxRedTSS(1,1,J)* x%QT(DOF_TSS1) &
@@ -7467,10 +7494,10 @@ SUBROUTINE CalculateLinearVelPAcc( p, x, CoordSys, RtHSdat )
       RtHSdat%PLinVelET(J,DOF_TSS2,0,:) = p%TwrSSSF(2,J,0)*CoordSys%a3 - (   p%AxRedTSS(2,2,J)* x%QT(DOF_TSS2) &
                                                                            + p%AxRedTSS(1,2,J)* x%QT(DOF_TSS1)   )*CoordSys%a2
 
-      TmpVec1 = CROSS_PRODUCT( RtHSdat%AngVelEX, RtHSdat%PLinVelET(J,DOF_TFA1,0,:) )
-      TmpVec2 = CROSS_PRODUCT( RtHSdat%AngVelEX, RtHSdat%PLinVelET(J,DOF_TSS1,0,:) )
-      TmpVec3 = CROSS_PRODUCT( RtHSdat%AngVelEX, RtHSdat%PLinVelET(J,DOF_TFA2,0,:) )
-      TmpVec4 = CROSS_PRODUCT( RtHSdat%AngVelEX, RtHSdat%PLinVelET(J,DOF_TSS2,0,:) )
+      TmpVec1 = CROSS_PRODUCT( RtHSdat%AngVelEX, RtHSdat%PLinVelET(J,DOF_TFA1,0,1:3) )
+      TmpVec2 = CROSS_PRODUCT( RtHSdat%AngVelEX, RtHSdat%PLinVelET(J,DOF_TSS1,0,1:3) )
+      TmpVec3 = CROSS_PRODUCT( RtHSdat%AngVelEX, RtHSdat%PLinVelET(J,DOF_TFA2,0,1:3) )
+      TmpVec4 = CROSS_PRODUCT( RtHSdat%AngVelEX, RtHSdat%PLinVelET(J,DOF_TSS2,0,1:3) )
 
       RtHSdat%PLinVelET(J,DOF_TFA1,1,:) = TmpVec1 - (   p%AxRedTFA(1,1,J)*x%QDT(DOF_TFA1) &
                                                       + p%AxRedTFA(1,2,J)*x%QDT(DOF_TFA2)   )*CoordSys%a2
@@ -7493,8 +7520,8 @@ SUBROUTINE CalculateLinearVelPAcc( p, x, CoordSys, RtHSdat )
       RtHSdat%LinVelET(:,J)  = LinVelXT + RtHSdat%LinVelEZ
       DO I = 1,NPX   ! Loop through all DOFs associated with the angular motion of the platform (body X)
 
-         TmpVec0   = CROSS_PRODUCT( RtHSdat%PAngVelEX(PX(I),0,:), RtHSdat%rZT(:,J)            )
-         TmpVec1   = CROSS_PRODUCT( RtHSdat%PAngVelEX(PX(I),0,:), EwXXrZT      + LinVelXT )
+         TmpVec0   = CROSS_PRODUCT( RtHSdat%PAngVelEX(PX(I),0,1:3), RtHSdat%rZT(:,J)            )
+         TmpVec1   = CROSS_PRODUCT( RtHSdat%PAngVelEX(PX(I),0,1:3), EwXXrZT      + LinVelXT )
 
          RtHSdat%PLinVelET(J,PX(I),0,:) = RtHSdat%PLinVelET(J,PX(I),0,:) + TmpVec0
          RtHSdat%PLinVelET(J,PX(I),1,:) = RtHSdat%PLinVelET(J,PX(I),1,:) + TmpVec1
@@ -9768,8 +9795,8 @@ SUBROUTINE ED_AB4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, ErrMsg
 
 
       ! local variables
-      TYPE(ED_InputType)                             :: u_interp
-      TYPE(ED_ContinuousStateType)                   :: xdot
+      INTEGER(IntKi)                                 :: IC_last     ! last value of OtherState%IC before the shift
+      INTEGER(IntKi)                                 :: I           ! loops through OtherState%IC
          
       INTEGER(IntKi)                                 :: ErrStat2    ! local error status
       CHARACTER(ErrMsgLen)                           :: ErrMsg2     ! local error message (ErrMsg)
@@ -9787,7 +9814,12 @@ SUBROUTINE ED_AB4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, ErrMsg
             
          ! Update IC() index so IC(1) is the location of xdot values at n.
          ! (this allows us to shift the indices into the array, not copy all of the values)
-         OtherState%IC = CSHIFT( OtherState%IC, -1 ) ! circular shift of all values to the right
+         ! circular shift of all values to the right (element by element: CSHIFT would make an array temporary)
+         IC_last = OtherState%IC(SIZE(OtherState%IC))
+         DO I = SIZE(OtherState%IC), 2, -1
+            OtherState%IC(I) = OtherState%IC(I-1)
+         END DO
+         OtherState%IC(1) = IC_last
             
       elseif (OtherState%n .gt. n) then
  
@@ -9797,28 +9829,22 @@ SUBROUTINE ED_AB4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, ErrMsg
       endif        
       
       
-      ! Allocate the input arrays
-      CALL ED_CopyInput( u(1), u_interp, MESH_NEWCOPY, ErrStat2, ErrMsg2 )
-         CALL CheckError(ErrStat2,ErrMsg2)
-         IF ( ErrStat >= AbortErrLev ) RETURN
-
-      
-      ! need xdot at t
-      CALL ED_Input_ExtrapInterp(u, utimes, u_interp, t, ErrStat2, ErrMsg2)
+      ! need xdot at t (m%u_interp and m%xdot were allocated in ED_Init, so that the time steps do not allocate them)
+      CALL ED_Input_ExtrapInterp(u, utimes, m%u_interp, t, ErrStat2, ErrMsg2)
          CALL CheckError(ErrStat2,ErrMsg2)
          IF ( ErrStat >= AbortErrLev ) RETURN                  
       IF (EqualRealNos( x%qdt(DOF_GeAz) ,0.0_R8Ki ) ) THEN
-         OtherState%HSSBrTrqC = u_interp%HSSBrTrqC
+         OtherState%HSSBrTrqC = m%u_interp%HSSBrTrqC
       ELSE
-         OtherState%HSSBrTrqC  = SIGN( u_interp%HSSBrTrqC, real(x%qdt(DOF_GeAz),ReKi) ) ! hack for HSS brake (need correct sign)
+         OtherState%HSSBrTrqC  = SIGN( m%u_interp%HSSBrTrqC, real(x%qdt(DOF_GeAz),ReKi) ) ! hack for HSS brake (need correct sign)
       END IF
       OtherState%HSSBrTrq   = OtherState%HSSBrTrqC
       OtherState%SgnPrvLSTQ = OtherState%SgnLSTQ(OtherState%IC(2))
       
-      CALL ED_CalcContStateDeriv( t, u_interp, p, x, xd, z, OtherState, m, xdot, ErrStat2, ErrMsg2 )
+      CALL ED_CalcContStateDeriv( t, m%u_interp, p, x, xd, z, OtherState, m, m%xdot, ErrStat2, ErrMsg2 )
          CALL CheckError(ErrStat2,ErrMsg2)
          
-         CALL ED_CopyContState(xdot, OtherState%xdot ( OtherState%IC(1) ), MESH_NEWCOPY, ErrStat2, ErrMsg2)
+         CALL ED_CopyContState(m%xdot, OtherState%xdot ( OtherState%IC(1) ), MESH_NEWCOPY, ErrStat2, ErrMsg2)
             CALL CheckError(ErrStat2,ErrMsg2)
             IF ( ErrStat >= AbortErrLev ) RETURN
 
@@ -9855,37 +9881,16 @@ SUBROUTINE ED_AB4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, ErrMsg
       OtherState%SgnLSTQ(OtherState%IC(1)) = OtherState%SgnPrvLSTQ 
       
       
-         ! clean up local variables:
-      CALL ExitThisRoutine()
-      
 CONTAINS      
-   !...............................................................................................................................
-   SUBROUTINE ExitThisRoutine()
-   ! This subroutine destroys all the local variables
-   !...............................................................................................................................
-
-         ! local variables
-      INTEGER(IntKi)             :: ErrStat3    ! The error identifier (ErrStat)
-      CHARACTER(ErrMsgLen)       :: ErrMsg3     ! The error message (ErrMsg)
-   
-   
-      CALL ED_DestroyInput(     u_interp, ErrStat3, ErrMsg3 )
-      CALL ED_DestroyContState( xdot,     ErrStat2, ErrMsg3 )
-      
-   END SUBROUTINE ExitThisRoutine    
    !...............................................................................................................................
    SUBROUTINE CheckError(ErrID,Msg)
-   ! This subroutine sets the error message and level and cleans up if the error is >= AbortErrLev
+   ! This subroutine sets the error message and level
    !...............................................................................................................................
 
          ! Passed arguments
       INTEGER(IntKi), INTENT(IN) :: ErrID       ! The error identifier (ErrStat)
       CHARACTER(*),   INTENT(IN) :: Msg         ! The error message (ErrMsg)
 
-         ! local variables
-      INTEGER(IntKi)             :: ErrStat3    ! The error identifier (ErrStat)
-      CHARACTER(ErrMsgLen)       :: ErrMsg3     ! The error message (ErrMsg)
-
       !............................................................................................................................
       ! Set error status/message;
       !............................................................................................................................
@@ -9896,12 +9901,6 @@ CONTAINS
          ErrMsg = TRIM(ErrMsg)//'ED_AB4:'//TRIM(Msg)
          ErrStat = MAX(ErrStat, ErrID)
 
-         !.........................................................................................................................
-         ! Clean up if we're going to return on error: close files, deallocate local arrays
-         !.........................................................................................................................
-         
-         IF ( ErrStat >= AbortErrLev ) CALL ExitThisRoutine( )                  
-         
       END IF
 
    END SUBROUTINE CheckError            
@@ -9943,10 +9942,6 @@ SUBROUTINE ED_ABM4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, ErrMsg
 
       ! local variables
 
-      TYPE(ED_InputType)                             :: u_interp    ! Inputs at t
-      TYPE(ED_ContinuousStateType)                   :: x_pred      ! Continuous states at t
-      TYPE(ED_ContinuousStateType)                   :: xdot_pred   ! Derivative of continuous states at t
-
       INTEGER(IntKi)                                 :: ErrStat2    ! local error status
       CHARACTER(ErrMsgLen)                           :: ErrMsg2     ! local error message (ErrMsg)
       
@@ -9956,13 +9951,13 @@ SUBROUTINE ED_ABM4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, ErrMsg
       ErrStat = ErrID_None
       ErrMsg  = "" 
       
-         ! predict:
+         ! predict (m%x_pred, m%u_interp and m%xdot were allocated in ED_Init, so that the time steps do not allocate them):
 
-      CALL ED_CopyContState(x, x_pred, MESH_NEWCOPY, ErrStat2, ErrMsg2)
+      CALL ED_CopyContState(x, m%x_pred, MESH_NEWCOPY, ErrStat2, ErrMsg2)
          CALL CheckError(ErrStat2,ErrMsg2)
          IF ( ErrStat >= AbortErrLev ) RETURN
 
-      CALL ED_AB4( t, n, u, utimes, p, x_pred, xd, z, OtherState, m, ErrStat2, ErrMsg2 )
+      CALL ED_AB4( t, n, u, utimes, p, m%x_pred, xd, z, OtherState, m, ErrStat2, ErrMsg2 )
          CALL CheckError(ErrStat2,ErrMsg2)
          IF ( ErrStat >= AbortErrLev ) RETURN
 
@@ -9971,33 +9966,28 @@ SUBROUTINE ED_ABM4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, ErrMsg
          
             ! correct:
          
-            ! allocate the arrays in u_interp
-         CALL ED_CopyInput( u(1), u_interp, MESH_NEWCOPY, ErrStat2, ErrMsg2 )
-            CALL CheckError(ErrStat2,ErrMsg2)
-            IF ( ErrStat >= AbortErrLev ) RETURN
-         
-         CALL ED_Input_ExtrapInterp(u, utimes, u_interp, t + p%dt, ErrStat2, ErrMsg2)
+         CALL ED_Input_ExtrapInterp(u, utimes, m%u_interp, t + p%dt, ErrStat2, ErrMsg2)
             CALL CheckError(ErrStat2,ErrMsg2)
             IF ( ErrStat >= AbortErrLev ) RETURN
             
-         u_interp%HSSBrTrqC = max(0.0_ReKi, min(u_interp%HSSBrTrqC, ABS( OtherState%HSSBrTrqC) )) ! hack for extrapolation of limits  (OtherState%HSSBrTrqC is HSSBrTrqC at t)     
-         IF (EqualRealNos( x_pred%qdt(DOF_GeAz) ,0.0_R8Ki ) ) THEN
-            OtherState%HSSBrTrqC = u_interp%HSSBrTrqC
+         m%u_interp%HSSBrTrqC = max(0.0_ReKi, min(m%u_interp%HSSBrTrqC, ABS( OtherState%HSSBrTrqC) )) ! hack for extrapolation of limits  (OtherState%HSSBrTrqC is HSSBrTrqC at t)     
+         IF (EqualRealNos( m%x_pred%qdt(DOF_GeAz) ,0.0_R8Ki ) ) THEN
+            OtherState%HSSBrTrqC = m%u_interp%HSSBrTrqC
          ELSE
-            OtherState%HSSBrTrqC  = SIGN( u_interp%HSSBrTrqC, real(x_pred%qdt(DOF_GeAz),ReKi) ) ! hack for HSS brake (need correct sign)
+            OtherState%HSSBrTrqC  = SIGN( m%u_interp%HSSBrTrqC, real(m%x_pred%qdt(DOF_GeAz),ReKi) ) ! hack for HSS brake (need correct sign)
          END IF
          OtherState%HSSBrTrq  = OtherState%HSSBrTrqC
 
-         CALL ED_CalcContStateDeriv(t + p%dt, u_interp, p, x_pred, xd, z, OtherState, m, xdot_pred, ErrStat2, ErrMsg2 )
+         CALL ED_CalcContStateDeriv(t + p%dt, m%u_interp, p, m%x_pred, xd, z, OtherState, m, m%xdot, ErrStat2, ErrMsg2 )
             CALL CheckError(ErrStat2,ErrMsg2)
             IF ( ErrStat >= AbortErrLev ) RETURN
 
          
-         x%qt  = x%qt  + p%DT24 * ( 9. * xdot_pred%qt +  19. * OtherState%xdot(OtherState%IC(1))%qt &
+         x%qt  = x%qt  + p%DT24 * ( 9. * m%xdot%qt +  19. * OtherState%xdot(OtherState%IC(1))%qt &
                                                         - 5. * OtherState%xdot(OtherState%IC(2))%qt &
                                                         + 1. * OtherState%xdot(OtherState%IC(3))%qt )
 
-         x%qdt = x%qdt + p%DT24 * ( 9. * xdot_pred%qdt + 19. * OtherState%xdot(OtherState%IC(1))%qdt &
+         x%qdt = x%qdt + p%DT24 * ( 9. * m%xdot%qdt + 19. * OtherState%xdot(OtherState%IC(1))%qdt &
                                                        -  5. * OtherState%xdot(OtherState%IC(2))%qdt &
                                                        +  1. * OtherState%xdot(OtherState%IC(3))%qdt )
          
@@ -10012,44 +10002,21 @@ SUBROUTINE ED_ABM4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, ErrMsg
                                                                     
       else
 
-         x%qt  = x_pred%qt
-         x%qdt = x_pred%qdt
+         x%qt  = m%x_pred%qt
+         x%qdt = m%x_pred%qdt
 
       endif
       
-      
-         ! clean up local variables:
-      CALL ExitThisRoutine()
-      
 CONTAINS      
-   !...............................................................................................................................
-   SUBROUTINE ExitThisRoutine()
-   ! This subroutine destroys all the local variables
-   !...............................................................................................................................
-
-         ! local variables
-      INTEGER(IntKi)             :: ErrStat3    ! The error identifier (ErrStat)
-      CHARACTER(ErrMsgLen)       :: ErrMsg3     ! The error message (ErrMsg)
-   
-   
-      CALL ED_DestroyContState( xdot_pred,  ErrStat3, ErrMsg3 )
-      CALL ED_DestroyContState( x_pred,     ErrStat3, ErrMsg3 )
-      CALL ED_DestroyInput(     u_interp,   ErrStat3, ErrMsg3 )               
-      
-   END SUBROUTINE ExitThisRoutine    
    !...............................................................................................................................
    SUBROUTINE CheckError(ErrID,Msg)
-   ! This subroutine sets the error message and level and cleans up if the error is >= AbortErrLev
+   ! This subroutine sets the error message and level
    !...............................................................................................................................
 
          ! Passed arguments
       INTEGER(IntKi), INTENT(IN) :: ErrID       ! The error identifier (ErrStat)
       CHARACTER(*),   INTENT(IN) :: Msg         ! The error message (ErrMsg)
 
-         ! local variables
-      INTEGER(IntKi)             :: ErrStat3    ! The error identifier (ErrStat)
-      CHARACTER(ErrMsgLen)       :: ErrMsg3     ! The error message (ErrMsg)
-
       !............................................................................................................................
       ! Set error status/message;
       !............................................................................................................................
@@ -10060,11 +10027,6 @@ CONTAINS
          ErrMsg = TRIM(ErrMsg)//'ED_ABM4:'//TRIM(Msg)
          ErrStat = MAX(ErrStat, ErrID)
 
-         !.........................................................................................................................
-         ! Clean up if we're going to return on error: close files, deallocate local arrays
-         !.........................................................................................................................
-         IF ( ErrStat >= AbortErrLev ) CALL ExitThisRoutine( )                  
-         
       END IF
 
    END SUBROUTINE CheckError                 
@@ -10340,6 +10302,7 @@ SUBROUTINE FixHSSBrTq ( Integrator, p, x, OtherState, m, ErrStat, ErrMsg )
    REAL(ReKi)                             :: RqdQD2GeAz                           ! The required QD2T(DOF_GeAz) to cause the HSS to stop rotating.
 
    INTEGER                                :: I                                    ! Loops through all DOFs.
+   INTEGER                                :: J                                    ! Loops through all DOFs.
    INTEGER(IntKi)                         :: ErrStat2
    CHARACTER(ErrMsgLen)                   :: ErrMsg2
    CHARACTER(*), PARAMETER                :: RoutineName = 'FixHSSBrTq'
@@ -10433,8 +10396,13 @@ SUBROUTINE FixHSSBrTq ( Integrator, p, x, OtherState, m, ErrStat, ErrMsg )
    !   of the solution vector, SolnVec(). These are transfered to the proper index locations of the acceleration vector QD2T()
    !   using the vector subscript array SrtPS(), after Gauss() has been called:
 
-      m%AugMat_factor = m%AugMat( p%DOFs%SrtPS( 1:p%DOFs%NActvDOF ), p%DOFs%SrtPSNAUG(1:p%DOFs%NActvDOF) )
-      m%SolnVec       = m%AugMat( p%DOFs%SrtPS( 1:p%DOFs%NActvDOF ), p%DOFs%SrtPSNAUG(1+p%DOFs%NActvDOF) )
+         ! (element by element: the vector subscripts would make array temporaries)
+      DO J = 1,p%DOFs%NActvDOF
+         DO I = 1,p%DOFs%NActvDOF
+            m%AugMat_factor(I,J) = m%AugMat( p%DOFs%SrtPS(I), p%DOFs%SrtPSNAUG(J) )
+         ENDDO
+         m%SolnVec(J)         = m%AugMat( p%DOFs%SrtPS(J), p%DOFs%SrtPSNAUG(1+p%DOFs%NActvDOF) )
+      ENDDO
    
       CALL LAPACK_getrf( M=p%DOFs%NActvDOF, N=p%DOFs%NActvDOF, A=m%AugMat_factor, IPIV=m%AugMat_pivot, ErrStat=ErrStat2, ErrMsg=ErrMsg2 )
          CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)   
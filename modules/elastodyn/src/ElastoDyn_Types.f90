@@ -558,6 +558,21 @@ IMPLICIT NONE
     INTEGER(IntKi) , DIMENSION(ED_NMX)  :: SgnLSTQ      !< history of sign of LSTQ [-]
   END TYPE ED_OtherStateType
 ! =======================
+! =========  ED_InputType  =======
+  TYPE, PUBLIC :: ED_InputType
+    TYPE(MeshType) , DIMENSION(:), ALLOCATABLE  :: BladePtLoads      !< A mesh on each blade, containing aerodynamic forces and moments (formerly AeroBladeForce and AeroBladeMoment) [-]
+    TYPE(MeshType)  :: PlatformPtMesh      !< A mesh at the platform reference (point Z), containing force: surge/xi (1), sway/yi (2), and heave/zi (3)-components; and moments: roll/xi (1), pitch/yi (2), and yaw/zi (3)-components acting at the platform (body X) / platform reference (point Z) associated with everything but the QD2T()s [N]
+    TYPE(MeshType)  :: TowerPtLoads      !< Tower line2 mesh with forces: surge/xi (1), sway/yi (2), and heave/zi (3)-components of the portion of the tower force at the current tower node (point T); and moments: roll/xi (1), pitch/yi (2), and yaw/zi (3)-components of the portion of the tower moment acting at the current tower node [N/m]
+    TYPE(MeshType)  :: HubPtLoad      !< A mesh at the teeter pin, containing forces: surge/xi (1), sway/yi (2), and heave/zi (3)-components; and moments: roll/xi (1), pitch/yi (2), and yaw/zi (3)-components acting at the hub. Passed from BeamDyn [-]
+    TYPE(MeshType)  :: NacelleLoads      !< From ServoDyn/TMD: loads on the nacelle. [-]
+    REAL(ReKi) , DIMENSION(:,:,:), ALLOCATABLE  :: TwrAddedMass      !< 6-by-6 added mass matrix of the tower elements, per unit length-bjj: place on a mesh [per unit length]
+    REAL(ReKi) , DIMENSION(1:6,1:6)  :: PtfmAddedMass      !< Platform added mass matrix [kg, kg-m, kg-m^2]
+    REAL(ReKi) , DIMENSION(:), ALLOCATABLE  :: BlPitchCom      !< Commanded blade pitch angles [radians]
+    REAL(ReKi)  :: YawMom      !< Torque transmitted through the yaw bearing [N-m]
+    REAL(ReKi)  :: GenTrq      !< Electrical generator torque [N-m]
+    REAL(ReKi)  :: HSSBrTrqC      !< Commanded HSS brake torque [N-m]
+  END TYPE ED_InputType
+! =======================
 ! =========  ED_MiscVarType  =======
   TYPE, PUBLIC :: ED_MiscVarType
     TYPE(ED_CoordSys)  :: CoordSys      !< Coordinate systems in the FAST framework [-]
@@ -571,6 +586,17 @@ IMPLICIT NONE
     REAL(R8Ki) , DIMENSION(:), ALLOCATABLE  :: QD2T      !< Solution (acceleration) vector; the first time derivative of QDT [-]
     LOGICAL  :: IgnoreMod      !< whether to ignore the modulo in ED outputs (necessary for linearization perturbations) [-]
     REAL(ReKi)  :: LSSTrqLoss      !< Low Speed Shaft torque loss [N-m]
+    REAL(ReKi) , DIMENSION(:,:,:), ALLOCATABLE  :: LinAccES      !< Total linear acceleration of a point on a blade (point S) in the inertia frame (body E for earth), computed by ED_CalcOutput [m/s^2]
+    REAL(ReKi) , DIMENSION(:,:,:), ALLOCATABLE  :: AngAccEK      !< Total rotational acceleration of a point on a blade (point S) in the inertia frame (body E for earth), computed by ED_CalcOutput [rad/s^2]
+    REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: LinAccET      !< Total linear acceleration of a point on the tower (point T) in the inertia frame (body E for earth), computed by ED_CalcOutput [m/s^2]
+    REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: AngAccEF      !< Total angular acceleration of tower element J (body F) in the inertia frame (body E for earth), computed by ED_CalcOutput [rad/s^2]
+    REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: FrcS0B      !< Total force at the blade root (point S(0)) due to the blade, computed by ED_CalcOutput [N]
+    REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: FTTower      !< Total hydrodynamic + aerodynamic force per unit length acting on the tower at point T, computed by ED_CalcOutput [N/m]
+    REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: MFHydro      !< Total hydrodynamic + aerodynamic moment per unit length acting on a tower element (body F) at point T, computed by ED_CalcOutput [N-m/m]
+    REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: MomH0B      !< Total moment at the hub (body H) / blade root (point S(0)) due to the blade, computed by ED_CalcOutput [N-m]
+    TYPE(ED_InputType)  :: u_interp      !< Inputs interpolated to the times at which ED_AB4 and ED_ABM4 evaluate the derivatives [-]
+    TYPE(ED_ContinuousStateType)  :: x_pred      !< Continuous states predicted by ED_ABM4 [-]
+    TYPE(ED_ContinuousStateType)  :: xdot      !< Derivative of the continuous states computed by ED_AB4, ED_ABM4 and ED_CalcOutput [-]
   END TYPE ED_MiscVarType
 ! =======================
 ! =========  ED_ParameterType  =======
@@ -830,21 +856,6 @@ IMPLICIT NONE
     INTEGER(IntKi)  :: Jac_ny      !< number of outputs in jacobian matrix [-]
   END TYPE ED_ParameterType
 ! =======================
-! =========  ED_InputType  =======
-  TYPE, PUBLIC :: ED_InputType
-    TYPE(MeshType) , DIMENSION(:), ALLOCATABLE  :: BladePtLoads      !< A mesh on each blade, containing aerodynamic forces and moments (formerly AeroBladeForce and AeroBladeMoment) [-]
-    TYPE(MeshType)  :: PlatformPtMesh      !< A mesh at the platform reference (point Z), containing force: surge/xi (1), sway/yi (2), and heave/zi (3)-components; and moments: roll/xi (1), pitch/yi (2), and yaw/zi (3)-components acting at the platform (body X) / platform reference (point Z) associated with everything but the QD2T()s [N]
-    TYPE(MeshType)  :: TowerPtLoads      !< Tower line2 mesh with forces: surge/xi (1), sway/yi (2), and heave/zi (3)-components of the portion of the tower force at the current tower node (point T); and moments: roll/xi (1), pitch/yi (2), and yaw/zi (3)-components of the portion of the tower moment acting at the current tower node [N/m]
-    TYPE(MeshType)  :: HubPtLoad      !< A mesh at the teeter pin, containing forces: surge/xi (1), sway/yi (2), and heave/zi (3)-components; and moments: roll/xi (1), pitch/yi (2), and yaw/zi (3)-components acting at the hub. Passed from BeamDyn [-]
-    TYPE(MeshType)  :: NacelleLoads      !< From ServoDyn/TMD: loads on the nacelle. [-]
-    REAL(ReKi) , DIMENSION(:,:,:), ALLOCATABLE  :: TwrAddedMass      !< 6-by-6 added mass matrix of the tower elements, per unit length-bjj: place on a mesh [per unit length]
-    REAL(ReKi) , DIMENSION(1:6,1:6)  :: PtfmAddedMass      !< Platform added mass matrix [kg, kg-m, kg-m^2]
-    REAL(ReKi) , DIMENSION(:), ALLOCATABLE  :: BlPitchCom      !< Commanded blade pitch angles [radians]
-    REAL(ReKi)  :: YawMom      !< Torque transmitted through the yaw bearing [N-m]
-    REAL(ReKi)  :: GenTrq      !< Electrical generator torque [N-m]
-    REAL(ReKi)  :: HSSBrTrqC      !< Commanded HSS brake torque [N-m]
-  END TYPE ED_InputType
-! =======================
 ! =========  ED_OutputType  =======
   TYPE, PUBLIC :: ED_OutputType
     TYPE(MeshType) , DIMENSION(:), ALLOCATABLE  :: BladeLn2Mesh      !< A mesh on each blade, containing positions and orientations of the blade elements [-]
@@ -15922,9 +15933,9 @@ ENDIF
     END DO
  END SUBROUTINE ED_UnPackOtherState
 
- SUBROUTINE ED_CopyMisc( SrcMiscData, DstMiscData, CtrlCode, ErrStat, ErrMsg )
-   TYPE(ED_MiscVarType), INTENT(IN) :: SrcMiscData
-   TYPE(ED_MiscVarType), INTENT(INOUT) :: DstMiscData
+ SUBROUTINE ED_CopyInput( SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg )
+   TYPE(ED_InputType), INTENT(INOUT) :: SrcInputData
+   TYPE(ED_InputType), INTENT(INOUT) :: DstInputData
    INTEGER(IntKi),  INTENT(IN   ) :: CtrlCode
    INTEGER(IntKi),  INTENT(  OUT) :: ErrStat
    CHARACTER(*),    INTENT(  OUT) :: ErrMsg
@@ -15932,112 +15943,77 @@ ENDIF
    INTEGER(IntKi)                 :: i,j,k
    INTEGER(IntKi)                 :: i1, i1_l, i1_u  !  bounds (upper/lower) for an array dimension 1
    INTEGER(IntKi)                 :: i2, i2_l, i2_u  !  bounds (upper/lower) for an array dimension 2
+   INTEGER(IntKi)                 :: i3, i3_l, i3_u  !  bounds (upper/lower) for an array dimension 3
    INTEGER(IntKi)                 :: ErrStat2
    CHARACTER(ErrMsgLen)           :: ErrMsg2
-   CHARACTER(*), PARAMETER        :: RoutineName = 'ED_CopyMisc'
+   CHARACTER(*), PARAMETER        :: RoutineName = 'ED_CopyInput'
 ! 
    ErrStat = ErrID_None
    ErrMsg  = ""
-      CALL ED_Copycoordsys( SrcMiscData%CoordSys, DstMiscData%CoordSys, CtrlCode, ErrStat2, ErrMsg2 )
-         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg,RoutineName)
-         IF (ErrStat>=AbortErrLev) RETURN
-      CALL ED_Copyrthndside( SrcMiscData%RtHS, DstMiscData%RtHS, CtrlCode, ErrStat2, ErrMsg2 )
-         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg,RoutineName)
-         IF (ErrStat>=AbortErrLev) RETURN
-IF (ALLOCATED(SrcMiscData%AllOuts)) THEN
-  i1_l = LBOUND(SrcMiscData%AllOuts,1)
-  i1_u = UBOUND(SrcMiscData%AllOuts,1)
-  IF (.NOT. ALLOCATED(DstMiscData%AllOuts)) THEN 
-    ALLOCATE(DstMiscData%AllOuts(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%AllOuts.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstMiscData%AllOuts = SrcMiscData%AllOuts
-ENDIF
-IF (ALLOCATED(SrcMiscData%AugMat)) THEN
-  i1_l = LBOUND(SrcMiscData%AugMat,1)
-  i1_u = UBOUND(SrcMiscData%AugMat,1)
-  i2_l = LBOUND(SrcMiscData%AugMat,2)
-  i2_u = UBOUND(SrcMiscData%AugMat,2)
-  IF (.NOT. ALLOCATED(DstMiscData%AugMat)) THEN 
-    ALLOCATE(DstMiscData%AugMat(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%AugMat.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstMiscData%AugMat = SrcMiscData%AugMat
-ENDIF
-IF (ALLOCATED(SrcMiscData%AugMat_factor)) THEN
-  i1_l = LBOUND(SrcMiscData%AugMat_factor,1)
-  i1_u = UBOUND(SrcMiscData%AugMat_factor,1)
-  i2_l = LBOUND(SrcMiscData%AugMat_factor,2)
-  i2_u = UBOUND(SrcMiscData%AugMat_factor,2)
-  IF (.NOT. ALLOCATED(DstMiscData%AugMat_factor)) THEN 
-    ALLOCATE(DstMiscData%AugMat_factor(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%AugMat_factor.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstMiscData%AugMat_factor = SrcMiscData%AugMat_factor
-ENDIF
-IF (ALLOCATED(SrcMiscData%SolnVec)) THEN
-  i1_l = LBOUND(SrcMiscData%SolnVec,1)
-  i1_u = UBOUND(SrcMiscData%SolnVec,1)
-  IF (.NOT. ALLOCATED(DstMiscData%SolnVec)) THEN 
-    ALLOCATE(DstMiscData%SolnVec(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%SolnVec.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstMiscData%SolnVec = SrcMiscData%SolnVec
-ENDIF
-IF (ALLOCATED(SrcMiscData%AugMat_pivot)) THEN
-  i1_l = LBOUND(SrcMiscData%AugMat_pivot,1)
-  i1_u = UBOUND(SrcMiscData%AugMat_pivot,1)
-  IF (.NOT. ALLOCATED(DstMiscData%AugMat_pivot)) THEN 
-    ALLOCATE(DstMiscData%AugMat_pivot(i1_l:i1_u),STAT=ErrStat2)
+IF (ALLOCATED(SrcInputData%BladePtLoads)) THEN
+  i1_l = LBOUND(SrcInputData%BladePtLoads,1)
+  i1_u = UBOUND(SrcInputData%BladePtLoads,1)
+  IF (.NOT. ALLOCATED(DstInputData%BladePtLoads)) THEN 
+    ALLOCATE(DstInputData%BladePtLoads(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%AugMat_pivot.', ErrStat, ErrMsg,RoutineName)
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstInputData%BladePtLoads.', ErrStat, ErrMsg,RoutineName)
       RETURN
     END IF
   END IF
-    DstMiscData%AugMat_pivot = SrcMiscData%AugMat_pivot
+    DO i1 = LBOUND(SrcInputData%BladePtLoads,1), UBOUND(SrcInputData%BladePtLoads,1)
+      CALL MeshCopy( SrcInputData%BladePtLoads(i1), DstInputData%BladePtLoads(i1), CtrlCode, ErrStat2, ErrMsg2 )
+         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         IF (ErrStat>=AbortErrLev) RETURN
+    ENDDO
 ENDIF
-IF (ALLOCATED(SrcMiscData%OgnlGeAzRo)) THEN
-  i1_l = LBOUND(SrcMiscData%OgnlGeAzRo,1)
-  i1_u = UBOUND(SrcMiscData%OgnlGeAzRo,1)
-  IF (.NOT. ALLOCATED(DstMiscData%OgnlGeAzRo)) THEN 
-    ALLOCATE(DstMiscData%OgnlGeAzRo(i1_l:i1_u),STAT=ErrStat2)
+      CALL MeshCopy( SrcInputData%PlatformPtMesh, DstInputData%PlatformPtMesh, CtrlCode, ErrStat2, ErrMsg2 )
+         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         IF (ErrStat>=AbortErrLev) RETURN
+      CALL MeshCopy( SrcInputData%TowerPtLoads, DstInputData%TowerPtLoads, CtrlCode, ErrStat2, ErrMsg2 )
+         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         IF (ErrStat>=AbortErrLev) RETURN
+      CALL MeshCopy( SrcInputData%HubPtLoad, DstInputData%HubPtLoad, CtrlCode, ErrStat2, ErrMsg2 )
+         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         IF (ErrStat>=AbortErrLev) RETURN
+      CALL MeshCopy( SrcInputData%NacelleLoads, DstInputData%NacelleLoads, CtrlCode, ErrStat2, ErrMsg2 )
+         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         IF (ErrStat>=AbortErrLev) RETURN
+IF (ALLOCATED(SrcInputData%TwrAddedMass)) THEN
+  i1_l = LBOUND(SrcInputData%TwrAddedMass,1)
+  i1_u = UBOUND(SrcInputData%TwrAddedMass,1)
+  i2_l = LBOUND(SrcInputData%TwrAddedMass,2)
+  i2_u = UBOUND(SrcInputData%TwrAddedMass,2)
+  i3_l = LBOUND(SrcInputData%TwrAddedMass,3)
+  i3_u = UBOUND(SrcInputData%TwrAddedMass,3)
+  IF (.NOT. ALLOCATED(DstInputData%TwrAddedMass)) THEN 
+    ALLOCATE(DstInputData%TwrAddedMass(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%OgnlGeAzRo.', ErrStat, ErrMsg,RoutineName)
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstInputData%TwrAddedMass.', ErrStat, ErrMsg,RoutineName)
       RETURN
     END IF
   END IF
-    DstMiscData%OgnlGeAzRo = SrcMiscData%OgnlGeAzRo
+    DstInputData%TwrAddedMass = SrcInputData%TwrAddedMass
 ENDIF
-IF (ALLOCATED(SrcMiscData%QD2T)) THEN
-  i1_l = LBOUND(SrcMiscData%QD2T,1)
-  i1_u = UBOUND(SrcMiscData%QD2T,1)
-  IF (.NOT. ALLOCATED(DstMiscData%QD2T)) THEN 
-    ALLOCATE(DstMiscData%QD2T(i1_l:i1_u),STAT=ErrStat2)
+    DstInputData%PtfmAddedMass = SrcInputData%PtfmAddedMass
+IF (ALLOCATED(SrcInputData%BlPitchCom)) THEN
+  i1_l = LBOUND(SrcInputData%BlPitchCom,1)
+  i1_u = UBOUND(SrcInputData%BlPitchCom,1)
+  IF (.NOT. ALLOCATED(DstInputData%BlPitchCom)) THEN 
+    ALLOCATE(DstInputData%BlPitchCom(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%QD2T.', ErrStat, ErrMsg,RoutineName)
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstInputData%BlPitchCom.', ErrStat, ErrMsg,RoutineName)
       RETURN
     END IF
   END IF
-    DstMiscData%QD2T = SrcMiscData%QD2T
+    DstInputData%BlPitchCom = SrcInputData%BlPitchCom
 ENDIF
-    DstMiscData%IgnoreMod = SrcMiscData%IgnoreMod
-    DstMiscData%LSSTrqLoss = SrcMiscData%LSSTrqLoss
- END SUBROUTINE ED_CopyMisc
+    DstInputData%YawMom = SrcInputData%YawMom
+    DstInputData%GenTrq = SrcInputData%GenTrq
+    DstInputData%HSSBrTrqC = SrcInputData%HSSBrTrqC
+ END SUBROUTINE ED_CopyInput
 
- SUBROUTINE ED_DestroyMisc( MiscData, ErrStat, ErrMsg, DEALLOCATEpointers )
-  TYPE(ED_MiscVarType), INTENT(INOUT) :: MiscData
+ SUBROUTINE ED_DestroyInput( InputData, ErrStat, ErrMsg, DEALLOCATEpointers )
+  TYPE(ED_InputType), INTENT(INOUT) :: InputData
   INTEGER(IntKi),  INTENT(  OUT) :: ErrStat
   CHARACTER(*),    INTENT(  OUT) :: ErrMsg
   LOGICAL,OPTIONAL,INTENT(IN   ) :: DEALLOCATEpointers
@@ -16046,7 +16022,7 @@ ENDIF
   LOGICAL                        :: DEALLOCATEpointers_local
   INTEGER(IntKi)                 :: ErrStat2
   CHARACTER(ErrMsgLen)           :: ErrMsg2
-  CHARACTER(*),    PARAMETER :: RoutineName = 'ED_DestroyMisc'
+  CHARACTER(*),    PARAMETER :: RoutineName = 'ED_DestroyInput'
 
   ErrStat = ErrID_None
   ErrMsg  = ""
@@ -16057,38 +16033,34 @@ ENDIF
      DEALLOCATEpointers_local = .true.
   END IF
   
-  CALL ED_Destroycoordsys( MiscData%CoordSys, ErrStat2, ErrMsg2, DEALLOCATEpointers_local )
-     CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-  CALL ED_Destroyrthndside( MiscData%RtHS, ErrStat2, ErrMsg2, DEALLOCATEpointers_local )
+IF (ALLOCATED(InputData%BladePtLoads)) THEN
+DO i1 = LBOUND(InputData%BladePtLoads,1), UBOUND(InputData%BladePtLoads,1)
+  CALL MeshDestroy( InputData%BladePtLoads(i1), ErrStat2, ErrMsg2 )
      CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-IF (ALLOCATED(MiscData%AllOuts)) THEN
-  DEALLOCATE(MiscData%AllOuts)
-ENDIF
-IF (ALLOCATED(MiscData%AugMat)) THEN
-  DEALLOCATE(MiscData%AugMat)
-ENDIF
-IF (ALLOCATED(MiscData%AugMat_factor)) THEN
-  DEALLOCATE(MiscData%AugMat_factor)
-ENDIF
-IF (ALLOCATED(MiscData%SolnVec)) THEN
-  DEALLOCATE(MiscData%SolnVec)
-ENDIF
-IF (ALLOCATED(MiscData%AugMat_pivot)) THEN
-  DEALLOCATE(MiscData%AugMat_pivot)
+ENDDO
+  DEALLOCATE(InputData%BladePtLoads)
 ENDIF
-IF (ALLOCATED(MiscData%OgnlGeAzRo)) THEN
-  DEALLOCATE(MiscData%OgnlGeAzRo)
+  CALL MeshDestroy( InputData%PlatformPtMesh, ErrStat2, ErrMsg2 )
+     CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+  CALL MeshDestroy( InputData%TowerPtLoads, ErrStat2, ErrMsg2 )
+     CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+  CALL MeshDestroy( InputData%HubPtLoad, ErrStat2, ErrMsg2 )
+     CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+  CALL MeshDestroy( InputData%NacelleLoads, ErrStat2, ErrMsg2 )
+     CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+IF (ALLOCATED(InputData%TwrAddedMass)) THEN
+  DEALLOCATE(InputData%TwrAddedMass)
 ENDIF
-IF (ALLOCATED(MiscData%QD2T)) THEN
-  DEALLOCATE(MiscData%QD2T)
+IF (ALLOCATED(InputData%BlPitchCom)) THEN
+  DEALLOCATE(InputData%BlPitchCom)
 ENDIF
- END SUBROUTINE ED_DestroyMisc
+ END SUBROUTINE ED_DestroyInput
 
- SUBROUTINE ED_PackMisc( ReKiBuf, DbKiBuf, IntKiBuf, Indata, ErrStat, ErrMsg, SizeOnly )
+ SUBROUTINE ED_PackInput( ReKiBuf, DbKiBuf, IntKiBuf, Indata, ErrStat, ErrMsg, SizeOnly )
   REAL(ReKi),       ALLOCATABLE, INTENT(  OUT) :: ReKiBuf(:)
   REAL(DbKi),       ALLOCATABLE, INTENT(  OUT) :: DbKiBuf(:)
   INTEGER(IntKi),   ALLOCATABLE, INTENT(  OUT) :: IntKiBuf(:)
-  TYPE(ED_MiscVarType),  INTENT(IN) :: InData
+  TYPE(ED_InputType),  INTENT(IN) :: InData
   INTEGER(IntKi),   INTENT(  OUT) :: ErrStat
   CHARACTER(*),     INTENT(  OUT) :: ErrMsg
   LOGICAL,OPTIONAL, INTENT(IN   ) :: SizeOnly
@@ -16103,7 +16075,7 @@ ENDIF
   LOGICAL                        :: OnlySize ! if present and true, do not pack, just allocate buffers
   INTEGER(IntKi)                 :: ErrStat2
   CHARACTER(ErrMsgLen)           :: ErrMsg2
-  CHARACTER(*), PARAMETER        :: RoutineName = 'ED_PackMisc'
+  CHARACTER(*), PARAMETER        :: RoutineName = 'ED_PackInput'
  ! buffers to store subtypes, if any
   REAL(ReKi),      ALLOCATABLE   :: Re_Buf(:)
   REAL(DbKi),      ALLOCATABLE   :: Db_Buf(:)
@@ -16119,78 +16091,112 @@ ENDIF
   Re_BufSz  = 0
   Db_BufSz  = 0
   Int_BufSz  = 0
+  Int_BufSz   = Int_BufSz   + 1     ! BladePtLoads allocated yes/no
+  IF ( ALLOCATED(InData%BladePtLoads) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*1  ! BladePtLoads upper/lower bounds for each dimension
    ! Allocate buffers for subtypes, if any (we'll get sizes from these) 
-      Int_BufSz   = Int_BufSz + 3  ! CoordSys: size of buffers for each call to pack subtype
-      CALL ED_Packcoordsys( Re_Buf, Db_Buf, Int_Buf, InData%CoordSys, ErrStat2, ErrMsg2, .TRUE. ) ! CoordSys 
+    DO i1 = LBOUND(InData%BladePtLoads,1), UBOUND(InData%BladePtLoads,1)
+      Int_BufSz   = Int_BufSz + 3  ! BladePtLoads: size of buffers for each call to pack subtype
+      CALL MeshPack( InData%BladePtLoads(i1), Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2, .TRUE. ) ! BladePtLoads 
         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
         IF (ErrStat >= AbortErrLev) RETURN
 
-      IF(ALLOCATED(Re_Buf)) THEN ! CoordSys
+      IF(ALLOCATED(Re_Buf)) THEN ! BladePtLoads
          Re_BufSz  = Re_BufSz  + SIZE( Re_Buf  )
          DEALLOCATE(Re_Buf)
       END IF
-      IF(ALLOCATED(Db_Buf)) THEN ! CoordSys
+      IF(ALLOCATED(Db_Buf)) THEN ! BladePtLoads
          Db_BufSz  = Db_BufSz  + SIZE( Db_Buf  )
          DEALLOCATE(Db_Buf)
       END IF
-      IF(ALLOCATED(Int_Buf)) THEN ! CoordSys
+      IF(ALLOCATED(Int_Buf)) THEN ! BladePtLoads
          Int_BufSz = Int_BufSz + SIZE( Int_Buf )
          DEALLOCATE(Int_Buf)
       END IF
-      Int_BufSz   = Int_BufSz + 3  ! RtHS: size of buffers for each call to pack subtype
-      CALL ED_Packrthndside( Re_Buf, Db_Buf, Int_Buf, InData%RtHS, ErrStat2, ErrMsg2, .TRUE. ) ! RtHS 
+    END DO
+  END IF
+      Int_BufSz   = Int_BufSz + 3  ! PlatformPtMesh: size of buffers for each call to pack subtype
+      CALL MeshPack( InData%PlatformPtMesh, Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2, .TRUE. ) ! PlatformPtMesh 
         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
         IF (ErrStat >= AbortErrLev) RETURN
 
-      IF(ALLOCATED(Re_Buf)) THEN ! RtHS
+      IF(ALLOCATED(Re_Buf)) THEN ! PlatformPtMesh
          Re_BufSz  = Re_BufSz  + SIZE( Re_Buf  )
          DEALLOCATE(Re_Buf)
       END IF
-      IF(ALLOCATED(Db_Buf)) THEN ! RtHS
+      IF(ALLOCATED(Db_Buf)) THEN ! PlatformPtMesh
          Db_BufSz  = Db_BufSz  + SIZE( Db_Buf  )
          DEALLOCATE(Db_Buf)
       END IF
-      IF(ALLOCATED(Int_Buf)) THEN ! RtHS
+      IF(ALLOCATED(Int_Buf)) THEN ! PlatformPtMesh
          Int_BufSz = Int_BufSz + SIZE( Int_Buf )
          DEALLOCATE(Int_Buf)
       END IF
-  Int_BufSz   = Int_BufSz   + 1     ! AllOuts allocated yes/no
-  IF ( ALLOCATED(InData%AllOuts) ) THEN
-    Int_BufSz   = Int_BufSz   + 2*1  ! AllOuts upper/lower bounds for each dimension
-      Re_BufSz   = Re_BufSz   + SIZE(InData%AllOuts)  ! AllOuts
-  END IF
-  Int_BufSz   = Int_BufSz   + 1     ! AugMat allocated yes/no
-  IF ( ALLOCATED(InData%AugMat) ) THEN
-    Int_BufSz   = Int_BufSz   + 2*2  ! AugMat upper/lower bounds for each dimension
-      Db_BufSz   = Db_BufSz   + SIZE(InData%AugMat)  ! AugMat
-  END IF
-  Int_BufSz   = Int_BufSz   + 1     ! AugMat_factor allocated yes/no
-  IF ( ALLOCATED(InData%AugMat_factor) ) THEN
-    Int_BufSz   = Int_BufSz   + 2*2  ! AugMat_factor upper/lower bounds for each dimension
-      Db_BufSz   = Db_BufSz   + SIZE(InData%AugMat_factor)  ! AugMat_factor
-  END IF
-  Int_BufSz   = Int_BufSz   + 1     ! SolnVec allocated yes/no
-  IF ( ALLOCATED(InData%SolnVec) ) THEN
-    Int_BufSz   = Int_BufSz   + 2*1  ! SolnVec upper/lower bounds for each dimension
-      Db_BufSz   = Db_BufSz   + SIZE(InData%SolnVec)  ! SolnVec
-  END IF
-  Int_BufSz   = Int_BufSz   + 1     ! AugMat_pivot allocated yes/no
-  IF ( ALLOCATED(InData%AugMat_pivot) ) THEN
-    Int_BufSz   = Int_BufSz   + 2*1  ! AugMat_pivot upper/lower bounds for each dimension
-      Int_BufSz  = Int_BufSz  + SIZE(InData%AugMat_pivot)  ! AugMat_pivot
-  END IF
-  Int_BufSz   = Int_BufSz   + 1     ! OgnlGeAzRo allocated yes/no
-  IF ( ALLOCATED(InData%OgnlGeAzRo) ) THEN
-    Int_BufSz   = Int_BufSz   + 2*1  ! OgnlGeAzRo upper/lower bounds for each dimension
-      Re_BufSz   = Re_BufSz   + SIZE(InData%OgnlGeAzRo)  ! OgnlGeAzRo
+      Int_BufSz   = Int_BufSz + 3  ! TowerPtLoads: size of buffers for each call to pack subtype
+      CALL MeshPack( InData%TowerPtLoads, Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2, .TRUE. ) ! TowerPtLoads 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf)) THEN ! TowerPtLoads
+         Re_BufSz  = Re_BufSz  + SIZE( Re_Buf  )
+         DEALLOCATE(Re_Buf)
+      END IF
+      IF(ALLOCATED(Db_Buf)) THEN ! TowerPtLoads
+         Db_BufSz  = Db_BufSz  + SIZE( Db_Buf  )
+         DEALLOCATE(Db_Buf)
+      END IF
+      IF(ALLOCATED(Int_Buf)) THEN ! TowerPtLoads
+         Int_BufSz = Int_BufSz + SIZE( Int_Buf )
+         DEALLOCATE(Int_Buf)
+      END IF
+      Int_BufSz   = Int_BufSz + 3  ! HubPtLoad: size of buffers for each call to pack subtype
+      CALL MeshPack( InData%HubPtLoad, Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2, .TRUE. ) ! HubPtLoad 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf)) THEN ! HubPtLoad
+         Re_BufSz  = Re_BufSz  + SIZE( Re_Buf  )
+         DEALLOCATE(Re_Buf)
+      END IF
+      IF(ALLOCATED(Db_Buf)) THEN ! HubPtLoad
+         Db_BufSz  = Db_BufSz  + SIZE( Db_Buf  )
+         DEALLOCATE(Db_Buf)
+      END IF
+      IF(ALLOCATED(Int_Buf)) THEN ! HubPtLoad
+         Int_BufSz = Int_BufSz + SIZE( Int_Buf )
+         DEALLOCATE(Int_Buf)
+      END IF
+      Int_BufSz   = Int_BufSz + 3  ! NacelleLoads: size of buffers for each call to pack subtype
+      CALL MeshPack( InData%NacelleLoads, Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2, .TRUE. ) ! NacelleLoads 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf)) THEN ! NacelleLoads
+         Re_BufSz  = Re_BufSz  + SIZE( Re_Buf  )
+         DEALLOCATE(Re_Buf)
+      END IF
+      IF(ALLOCATED(Db_Buf)) THEN ! NacelleLoads
+         Db_BufSz  = Db_BufSz  + SIZE( Db_Buf  )
+         DEALLOCATE(Db_Buf)
+      END IF
+      IF(ALLOCATED(Int_Buf)) THEN ! NacelleLoads
+         Int_BufSz = Int_BufSz + SIZE( Int_Buf )
+         DEALLOCATE(Int_Buf)
+      END IF
+  Int_BufSz   = Int_BufSz   + 1     ! TwrAddedMass allocated yes/no
+  IF ( ALLOCATED(InData%TwrAddedMass) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*3  ! TwrAddedMass upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%TwrAddedMass)  ! TwrAddedMass
   END IF
-  Int_BufSz   = Int_BufSz   + 1     ! QD2T allocated yes/no
-  IF ( ALLOCATED(InData%QD2T) ) THEN
-    Int_BufSz   = Int_BufSz   + 2*1  ! QD2T upper/lower bounds for each dimension
-      Db_BufSz   = Db_BufSz   + SIZE(InData%QD2T)  ! QD2T
+      Re_BufSz   = Re_BufSz   + SIZE(InData%PtfmAddedMass)  ! PtfmAddedMass
+  Int_BufSz   = Int_BufSz   + 1     ! BlPitchCom allocated yes/no
+  IF ( ALLOCATED(InData%BlPitchCom) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*1  ! BlPitchCom upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%BlPitchCom)  ! BlPitchCom
   END IF
-      Int_BufSz  = Int_BufSz  + 1  ! IgnoreMod
-      Re_BufSz   = Re_BufSz   + 1  ! LSSTrqLoss
+      Re_BufSz   = Re_BufSz   + 1  ! YawMom
+      Re_BufSz   = Re_BufSz   + 1  ! GenTrq
+      Re_BufSz   = Re_BufSz   + 1  ! HSSBrTrqC
   IF ( Re_BufSz  .GT. 0 ) THEN 
      ALLOCATE( ReKiBuf(  Re_BufSz  ), STAT=ErrStat2 )
      IF (ErrStat2 /= 0) THEN 
@@ -16218,7 +16224,18 @@ ENDIF
   Db_Xferred  = 1
   Int_Xferred = 1
 
-      CALL ED_Packcoordsys( Re_Buf, Db_Buf, Int_Buf, InData%CoordSys, ErrStat2, ErrMsg2, OnlySize ) ! CoordSys 
+  IF ( .NOT. ALLOCATED(InData%BladePtLoads) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%BladePtLoads,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%BladePtLoads,1)
+    Int_Xferred = Int_Xferred + 2
+
+    DO i1 = LBOUND(InData%BladePtLoads,1), UBOUND(InData%BladePtLoads,1)
+      CALL MeshPack( InData%BladePtLoads(i1), Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2, OnlySize ) ! BladePtLoads 
         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
         IF (ErrStat >= AbortErrLev) RETURN
 
@@ -16246,7 +16263,9 @@ ENDIF
       ELSE
         IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
       ENDIF
-      CALL ED_Packrthndside( Re_Buf, Db_Buf, Int_Buf, InData%RtHS, ErrStat2, ErrMsg2, OnlySize ) ! RtHS 
+    END DO
+  END IF
+      CALL MeshPack( InData%PlatformPtMesh, Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2, OnlySize ) ! PlatformPtMesh 
         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
         IF (ErrStat >= AbortErrLev) RETURN
 
@@ -16274,132 +16293,149 @@ ENDIF
       ELSE
         IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
       ENDIF
-  IF ( .NOT. ALLOCATED(InData%AllOuts) ) THEN
-    IntKiBuf( Int_Xferred ) = 0
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    IntKiBuf( Int_Xferred ) = 1
-    Int_Xferred = Int_Xferred + 1
-    IntKiBuf( Int_Xferred    ) = LBOUND(InData%AllOuts,1)
-    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%AllOuts,1)
-    Int_Xferred = Int_Xferred + 2
+      CALL MeshPack( InData%TowerPtLoads, Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2, OnlySize ) ! TowerPtLoads 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
 
-      DO i1 = LBOUND(InData%AllOuts,1), UBOUND(InData%AllOuts,1)
-        ReKiBuf(Re_Xferred) = InData%AllOuts(i1)
-        Re_Xferred = Re_Xferred + 1
-      END DO
-  END IF
-  IF ( .NOT. ALLOCATED(InData%AugMat) ) THEN
+      IF(ALLOCATED(Re_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Re_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Re_Buf) > 0) ReKiBuf( Re_Xferred:Re_Xferred+SIZE(Re_Buf)-1 ) = Re_Buf
+        Re_Xferred = Re_Xferred + SIZE(Re_Buf)
+        DEALLOCATE(Re_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      IF(ALLOCATED(Db_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Db_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Db_Buf) > 0) DbKiBuf( Db_Xferred:Db_Xferred+SIZE(Db_Buf)-1 ) = Db_Buf
+        Db_Xferred = Db_Xferred + SIZE(Db_Buf)
+        DEALLOCATE(Db_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      IF(ALLOCATED(Int_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Int_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Int_Buf) > 0) IntKiBuf( Int_Xferred:Int_Xferred+SIZE(Int_Buf)-1 ) = Int_Buf
+        Int_Xferred = Int_Xferred + SIZE(Int_Buf)
+        DEALLOCATE(Int_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      CALL MeshPack( InData%HubPtLoad, Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2, OnlySize ) ! HubPtLoad 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Re_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Re_Buf) > 0) ReKiBuf( Re_Xferred:Re_Xferred+SIZE(Re_Buf)-1 ) = Re_Buf
+        Re_Xferred = Re_Xferred + SIZE(Re_Buf)
+        DEALLOCATE(Re_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      IF(ALLOCATED(Db_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Db_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Db_Buf) > 0) DbKiBuf( Db_Xferred:Db_Xferred+SIZE(Db_Buf)-1 ) = Db_Buf
+        Db_Xferred = Db_Xferred + SIZE(Db_Buf)
+        DEALLOCATE(Db_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      IF(ALLOCATED(Int_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Int_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Int_Buf) > 0) IntKiBuf( Int_Xferred:Int_Xferred+SIZE(Int_Buf)-1 ) = Int_Buf
+        Int_Xferred = Int_Xferred + SIZE(Int_Buf)
+        DEALLOCATE(Int_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      CALL MeshPack( InData%NacelleLoads, Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2, OnlySize ) ! NacelleLoads 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Re_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Re_Buf) > 0) ReKiBuf( Re_Xferred:Re_Xferred+SIZE(Re_Buf)-1 ) = Re_Buf
+        Re_Xferred = Re_Xferred + SIZE(Re_Buf)
+        DEALLOCATE(Re_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      IF(ALLOCATED(Db_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Db_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Db_Buf) > 0) DbKiBuf( Db_Xferred:Db_Xferred+SIZE(Db_Buf)-1 ) = Db_Buf
+        Db_Xferred = Db_Xferred + SIZE(Db_Buf)
+        DEALLOCATE(Db_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      IF(ALLOCATED(Int_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Int_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Int_Buf) > 0) IntKiBuf( Int_Xferred:Int_Xferred+SIZE(Int_Buf)-1 ) = Int_Buf
+        Int_Xferred = Int_Xferred + SIZE(Int_Buf)
+        DEALLOCATE(Int_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+  IF ( .NOT. ALLOCATED(InData%TwrAddedMass) ) THEN
     IntKiBuf( Int_Xferred ) = 0
     Int_Xferred = Int_Xferred + 1
   ELSE
     IntKiBuf( Int_Xferred ) = 1
     Int_Xferred = Int_Xferred + 1
-    IntKiBuf( Int_Xferred    ) = LBOUND(InData%AugMat,1)
-    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%AugMat,1)
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%TwrAddedMass,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%TwrAddedMass,1)
     Int_Xferred = Int_Xferred + 2
-    IntKiBuf( Int_Xferred    ) = LBOUND(InData%AugMat,2)
-    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%AugMat,2)
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%TwrAddedMass,2)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%TwrAddedMass,2)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%TwrAddedMass,3)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%TwrAddedMass,3)
     Int_Xferred = Int_Xferred + 2
 
-      DO i2 = LBOUND(InData%AugMat,2), UBOUND(InData%AugMat,2)
-        DO i1 = LBOUND(InData%AugMat,1), UBOUND(InData%AugMat,1)
-          DbKiBuf(Db_Xferred) = InData%AugMat(i1,i2)
-          Db_Xferred = Db_Xferred + 1
+      DO i3 = LBOUND(InData%TwrAddedMass,3), UBOUND(InData%TwrAddedMass,3)
+        DO i2 = LBOUND(InData%TwrAddedMass,2), UBOUND(InData%TwrAddedMass,2)
+          DO i1 = LBOUND(InData%TwrAddedMass,1), UBOUND(InData%TwrAddedMass,1)
+            ReKiBuf(Re_Xferred) = InData%TwrAddedMass(i1,i2,i3)
+            Re_Xferred = Re_Xferred + 1
+          END DO
         END DO
       END DO
   END IF
-  IF ( .NOT. ALLOCATED(InData%AugMat_factor) ) THEN
+    DO i2 = LBOUND(InData%PtfmAddedMass,2), UBOUND(InData%PtfmAddedMass,2)
+      DO i1 = LBOUND(InData%PtfmAddedMass,1), UBOUND(InData%PtfmAddedMass,1)
+        ReKiBuf(Re_Xferred) = InData%PtfmAddedMass(i1,i2)
+        Re_Xferred = Re_Xferred + 1
+      END DO
+    END DO
+  IF ( .NOT. ALLOCATED(InData%BlPitchCom) ) THEN
     IntKiBuf( Int_Xferred ) = 0
     Int_Xferred = Int_Xferred + 1
   ELSE
     IntKiBuf( Int_Xferred ) = 1
     Int_Xferred = Int_Xferred + 1
-    IntKiBuf( Int_Xferred    ) = LBOUND(InData%AugMat_factor,1)
-    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%AugMat_factor,1)
-    Int_Xferred = Int_Xferred + 2
-    IntKiBuf( Int_Xferred    ) = LBOUND(InData%AugMat_factor,2)
-    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%AugMat_factor,2)
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%BlPitchCom,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%BlPitchCom,1)
     Int_Xferred = Int_Xferred + 2
 
-      DO i2 = LBOUND(InData%AugMat_factor,2), UBOUND(InData%AugMat_factor,2)
-        DO i1 = LBOUND(InData%AugMat_factor,1), UBOUND(InData%AugMat_factor,1)
-          DbKiBuf(Db_Xferred) = InData%AugMat_factor(i1,i2)
-          Db_Xferred = Db_Xferred + 1
-        END DO
+      DO i1 = LBOUND(InData%BlPitchCom,1), UBOUND(InData%BlPitchCom,1)
+        ReKiBuf(Re_Xferred) = InData%BlPitchCom(i1)
+        Re_Xferred = Re_Xferred + 1
       END DO
   END IF
-  IF ( .NOT. ALLOCATED(InData%SolnVec) ) THEN
-    IntKiBuf( Int_Xferred ) = 0
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    IntKiBuf( Int_Xferred ) = 1
-    Int_Xferred = Int_Xferred + 1
-    IntKiBuf( Int_Xferred    ) = LBOUND(InData%SolnVec,1)
-    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%SolnVec,1)
-    Int_Xferred = Int_Xferred + 2
-
-      DO i1 = LBOUND(InData%SolnVec,1), UBOUND(InData%SolnVec,1)
-        DbKiBuf(Db_Xferred) = InData%SolnVec(i1)
-        Db_Xferred = Db_Xferred + 1
-      END DO
-  END IF
-  IF ( .NOT. ALLOCATED(InData%AugMat_pivot) ) THEN
-    IntKiBuf( Int_Xferred ) = 0
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    IntKiBuf( Int_Xferred ) = 1
-    Int_Xferred = Int_Xferred + 1
-    IntKiBuf( Int_Xferred    ) = LBOUND(InData%AugMat_pivot,1)
-    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%AugMat_pivot,1)
-    Int_Xferred = Int_Xferred + 2
-
-      DO i1 = LBOUND(InData%AugMat_pivot,1), UBOUND(InData%AugMat_pivot,1)
-        IntKiBuf(Int_Xferred) = InData%AugMat_pivot(i1)
-        Int_Xferred = Int_Xferred + 1
-      END DO
-  END IF
-  IF ( .NOT. ALLOCATED(InData%OgnlGeAzRo) ) THEN
-    IntKiBuf( Int_Xferred ) = 0
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    IntKiBuf( Int_Xferred ) = 1
-    Int_Xferred = Int_Xferred + 1
-    IntKiBuf( Int_Xferred    ) = LBOUND(InData%OgnlGeAzRo,1)
-    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%OgnlGeAzRo,1)
-    Int_Xferred = Int_Xferred + 2
-
-      DO i1 = LBOUND(InData%OgnlGeAzRo,1), UBOUND(InData%OgnlGeAzRo,1)
-        ReKiBuf(Re_Xferred) = InData%OgnlGeAzRo(i1)
-        Re_Xferred = Re_Xferred + 1
-      END DO
-  END IF
-  IF ( .NOT. ALLOCATED(InData%QD2T) ) THEN
-    IntKiBuf( Int_Xferred ) = 0
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    IntKiBuf( Int_Xferred ) = 1
-    Int_Xferred = Int_Xferred + 1
-    IntKiBuf( Int_Xferred    ) = LBOUND(InData%QD2T,1)
-    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%QD2T,1)
-    Int_Xferred = Int_Xferred + 2
-
-      DO i1 = LBOUND(InData%QD2T,1), UBOUND(InData%QD2T,1)
-        DbKiBuf(Db_Xferred) = InData%QD2T(i1)
-        Db_Xferred = Db_Xferred + 1
-      END DO
-  END IF
-    IntKiBuf(Int_Xferred) = TRANSFER(InData%IgnoreMod, IntKiBuf(1))
-    Int_Xferred = Int_Xferred + 1
-    ReKiBuf(Re_Xferred) = InData%LSSTrqLoss
+    ReKiBuf(Re_Xferred) = InData%YawMom
     Re_Xferred = Re_Xferred + 1
- END SUBROUTINE ED_PackMisc
+    ReKiBuf(Re_Xferred) = InData%GenTrq
+    Re_Xferred = Re_Xferred + 1
+    ReKiBuf(Re_Xferred) = InData%HSSBrTrqC
+    Re_Xferred = Re_Xferred + 1
+ END SUBROUTINE ED_PackInput
 
- SUBROUTINE ED_UnPackMisc( ReKiBuf, DbKiBuf, IntKiBuf, Outdata, ErrStat, ErrMsg )
+ SUBROUTINE ED_UnPackInput( ReKiBuf, DbKiBuf, IntKiBuf, Outdata, ErrStat, ErrMsg )
   REAL(ReKi),      ALLOCATABLE, INTENT(IN   ) :: ReKiBuf(:)
   REAL(DbKi),      ALLOCATABLE, INTENT(IN   ) :: DbKiBuf(:)
   INTEGER(IntKi),  ALLOCATABLE, INTENT(IN   ) :: IntKiBuf(:)
-  TYPE(ED_MiscVarType), INTENT(INOUT) :: OutData
+  TYPE(ED_InputType), INTENT(INOUT) :: OutData
   INTEGER(IntKi),  INTENT(  OUT) :: ErrStat
   CHARACTER(*),    INTENT(  OUT) :: ErrMsg
     ! Local variables
@@ -16410,9 +16446,10 @@ ENDIF
   INTEGER(IntKi)                 :: i
   INTEGER(IntKi)                 :: i1, i1_l, i1_u  !  bounds (upper/lower) for an array dimension 1
   INTEGER(IntKi)                 :: i2, i2_l, i2_u  !  bounds (upper/lower) for an array dimension 2
+  INTEGER(IntKi)                 :: i3, i3_l, i3_u  !  bounds (upper/lower) for an array dimension 3
   INTEGER(IntKi)                 :: ErrStat2
   CHARACTER(ErrMsgLen)           :: ErrMsg2
-  CHARACTER(*), PARAMETER        :: RoutineName = 'ED_UnPackMisc'
+  CHARACTER(*), PARAMETER        :: RoutineName = 'ED_UnPackInput'
  ! buffers to store meshes, if any
   REAL(ReKi),      ALLOCATABLE   :: Re_Buf(:)
   REAL(DbKi),      ALLOCATABLE   :: Db_Buf(:)
@@ -16423,6 +16460,20 @@ ENDIF
   Re_Xferred  = 1
   Db_Xferred  = 1
   Int_Xferred  = 1
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! BladePtLoads not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%BladePtLoads)) DEALLOCATE(OutData%BladePtLoads)
+    ALLOCATE(OutData%BladePtLoads(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%BladePtLoads.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    DO i1 = LBOUND(OutData%BladePtLoads,1), UBOUND(OutData%BladePtLoads,1)
       Buf_size=IntKiBuf( Int_Xferred )
       Int_Xferred = Int_Xferred + 1
       IF(Buf_size > 0) THEN
@@ -16456,13 +16507,15 @@ ENDIF
         Int_Buf = IntKiBuf( Int_Xferred:Int_Xferred+Buf_size-1 )
         Int_Xferred = Int_Xferred + Buf_size
       END IF
-      CALL ED_Unpackcoordsys( Re_Buf, Db_Buf, Int_Buf, OutData%CoordSys, ErrStat2, ErrMsg2 ) ! CoordSys 
+      CALL MeshUnpack( OutData%BladePtLoads(i1), Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2 ) ! BladePtLoads 
         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
         IF (ErrStat >= AbortErrLev) RETURN
 
       IF(ALLOCATED(Re_Buf )) DEALLOCATE(Re_Buf )
       IF(ALLOCATED(Db_Buf )) DEALLOCATE(Db_Buf )
       IF(ALLOCATED(Int_Buf)) DEALLOCATE(Int_Buf)
+    END DO
+  END IF
       Buf_size=IntKiBuf( Int_Xferred )
       Int_Xferred = Int_Xferred + 1
       IF(Buf_size > 0) THEN
@@ -16496,158 +16549,200 @@ ENDIF
         Int_Buf = IntKiBuf( Int_Xferred:Int_Xferred+Buf_size-1 )
         Int_Xferred = Int_Xferred + Buf_size
       END IF
-      CALL ED_Unpackrthndside( Re_Buf, Db_Buf, Int_Buf, OutData%RtHS, ErrStat2, ErrMsg2 ) ! RtHS 
+      CALL MeshUnpack( OutData%PlatformPtMesh, Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2 ) ! PlatformPtMesh 
         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
         IF (ErrStat >= AbortErrLev) RETURN
 
       IF(ALLOCATED(Re_Buf )) DEALLOCATE(Re_Buf )
       IF(ALLOCATED(Db_Buf )) DEALLOCATE(Db_Buf )
       IF(ALLOCATED(Int_Buf)) DEALLOCATE(Int_Buf)
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! AllOuts not allocated
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Re_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Re_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Re_Buf = ReKiBuf( Re_Xferred:Re_Xferred+Buf_size-1 )
+        Re_Xferred = Re_Xferred + Buf_size
+      END IF
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Db_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Db_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Db_Buf = DbKiBuf( Db_Xferred:Db_Xferred+Buf_size-1 )
+        Db_Xferred = Db_Xferred + Buf_size
+      END IF
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Int_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Int_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Int_Buf = IntKiBuf( Int_Xferred:Int_Xferred+Buf_size-1 )
+        Int_Xferred = Int_Xferred + Buf_size
+      END IF
+      CALL MeshUnpack( OutData%TowerPtLoads, Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2 ) ! TowerPtLoads 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf )) DEALLOCATE(Re_Buf )
+      IF(ALLOCATED(Db_Buf )) DEALLOCATE(Db_Buf )
+      IF(ALLOCATED(Int_Buf)) DEALLOCATE(Int_Buf)
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Re_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Re_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Re_Buf = ReKiBuf( Re_Xferred:Re_Xferred+Buf_size-1 )
+        Re_Xferred = Re_Xferred + Buf_size
+      END IF
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Db_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Db_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Db_Buf = DbKiBuf( Db_Xferred:Db_Xferred+Buf_size-1 )
+        Db_Xferred = Db_Xferred + Buf_size
+      END IF
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Int_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Int_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Int_Buf = IntKiBuf( Int_Xferred:Int_Xferred+Buf_size-1 )
+        Int_Xferred = Int_Xferred + Buf_size
+      END IF
+      CALL MeshUnpack( OutData%HubPtLoad, Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2 ) ! HubPtLoad 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf )) DEALLOCATE(Re_Buf )
+      IF(ALLOCATED(Db_Buf )) DEALLOCATE(Db_Buf )
+      IF(ALLOCATED(Int_Buf)) DEALLOCATE(Int_Buf)
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Re_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Re_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Re_Buf = ReKiBuf( Re_Xferred:Re_Xferred+Buf_size-1 )
+        Re_Xferred = Re_Xferred + Buf_size
+      END IF
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Db_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Db_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Db_Buf = DbKiBuf( Db_Xferred:Db_Xferred+Buf_size-1 )
+        Db_Xferred = Db_Xferred + Buf_size
+      END IF
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Int_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Int_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Int_Buf = IntKiBuf( Int_Xferred:Int_Xferred+Buf_size-1 )
+        Int_Xferred = Int_Xferred + Buf_size
+      END IF
+      CALL MeshUnpack( OutData%NacelleLoads, Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2 ) ! NacelleLoads 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf )) DEALLOCATE(Re_Buf )
+      IF(ALLOCATED(Db_Buf )) DEALLOCATE(Db_Buf )
+      IF(ALLOCATED(Int_Buf)) DEALLOCATE(Int_Buf)
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! TwrAddedMass not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%AllOuts)) DEALLOCATE(OutData%AllOuts)
-    ALLOCATE(OutData%AllOuts(i1_l:i1_u),STAT=ErrStat2)
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i3_l = IntKiBuf( Int_Xferred    )
+    i3_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%TwrAddedMass)) DEALLOCATE(OutData%TwrAddedMass)
+    ALLOCATE(OutData%TwrAddedMass(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%AllOuts.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%TwrAddedMass.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i1 = LBOUND(OutData%AllOuts,1), UBOUND(OutData%AllOuts,1)
-        OutData%AllOuts(i1) = ReKiBuf(Re_Xferred)
-        Re_Xferred = Re_Xferred + 1
+      DO i3 = LBOUND(OutData%TwrAddedMass,3), UBOUND(OutData%TwrAddedMass,3)
+        DO i2 = LBOUND(OutData%TwrAddedMass,2), UBOUND(OutData%TwrAddedMass,2)
+          DO i1 = LBOUND(OutData%TwrAddedMass,1), UBOUND(OutData%TwrAddedMass,1)
+            OutData%TwrAddedMass(i1,i2,i3) = ReKiBuf(Re_Xferred)
+            Re_Xferred = Re_Xferred + 1
+          END DO
+        END DO
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! AugMat not allocated
+    i1_l = LBOUND(OutData%PtfmAddedMass,1)
+    i1_u = UBOUND(OutData%PtfmAddedMass,1)
+    i2_l = LBOUND(OutData%PtfmAddedMass,2)
+    i2_u = UBOUND(OutData%PtfmAddedMass,2)
+    DO i2 = LBOUND(OutData%PtfmAddedMass,2), UBOUND(OutData%PtfmAddedMass,2)
+      DO i1 = LBOUND(OutData%PtfmAddedMass,1), UBOUND(OutData%PtfmAddedMass,1)
+        OutData%PtfmAddedMass(i1,i2) = ReKiBuf(Re_Xferred)
+        Re_Xferred = Re_Xferred + 1
+      END DO
+    END DO
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! BlPitchCom not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    i2_l = IntKiBuf( Int_Xferred    )
-    i2_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%AugMat)) DEALLOCATE(OutData%AugMat)
-    ALLOCATE(OutData%AugMat(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%BlPitchCom)) DEALLOCATE(OutData%BlPitchCom)
+    ALLOCATE(OutData%BlPitchCom(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%AugMat.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%BlPitchCom.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%AugMat,2), UBOUND(OutData%AugMat,2)
-        DO i1 = LBOUND(OutData%AugMat,1), UBOUND(OutData%AugMat,1)
-          OutData%AugMat(i1,i2) = REAL(DbKiBuf(Db_Xferred), R8Ki)
-          Db_Xferred = Db_Xferred + 1
-        END DO
-      END DO
-  END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! AugMat_factor not allocated
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    Int_Xferred = Int_Xferred + 1
-    i1_l = IntKiBuf( Int_Xferred    )
-    i1_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    i2_l = IntKiBuf( Int_Xferred    )
-    i2_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%AugMat_factor)) DEALLOCATE(OutData%AugMat_factor)
-    ALLOCATE(OutData%AugMat_factor(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%AugMat_factor.', ErrStat, ErrMsg,RoutineName)
-       RETURN
-    END IF
-      DO i2 = LBOUND(OutData%AugMat_factor,2), UBOUND(OutData%AugMat_factor,2)
-        DO i1 = LBOUND(OutData%AugMat_factor,1), UBOUND(OutData%AugMat_factor,1)
-          OutData%AugMat_factor(i1,i2) = REAL(DbKiBuf(Db_Xferred), R8Ki)
-          Db_Xferred = Db_Xferred + 1
-        END DO
-      END DO
-  END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! SolnVec not allocated
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    Int_Xferred = Int_Xferred + 1
-    i1_l = IntKiBuf( Int_Xferred    )
-    i1_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%SolnVec)) DEALLOCATE(OutData%SolnVec)
-    ALLOCATE(OutData%SolnVec(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%SolnVec.', ErrStat, ErrMsg,RoutineName)
-       RETURN
-    END IF
-      DO i1 = LBOUND(OutData%SolnVec,1), UBOUND(OutData%SolnVec,1)
-        OutData%SolnVec(i1) = REAL(DbKiBuf(Db_Xferred), R8Ki)
-        Db_Xferred = Db_Xferred + 1
-      END DO
-  END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! AugMat_pivot not allocated
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    Int_Xferred = Int_Xferred + 1
-    i1_l = IntKiBuf( Int_Xferred    )
-    i1_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%AugMat_pivot)) DEALLOCATE(OutData%AugMat_pivot)
-    ALLOCATE(OutData%AugMat_pivot(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%AugMat_pivot.', ErrStat, ErrMsg,RoutineName)
-       RETURN
-    END IF
-      DO i1 = LBOUND(OutData%AugMat_pivot,1), UBOUND(OutData%AugMat_pivot,1)
-        OutData%AugMat_pivot(i1) = IntKiBuf(Int_Xferred)
-        Int_Xferred = Int_Xferred + 1
-      END DO
-  END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! OgnlGeAzRo not allocated
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    Int_Xferred = Int_Xferred + 1
-    i1_l = IntKiBuf( Int_Xferred    )
-    i1_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%OgnlGeAzRo)) DEALLOCATE(OutData%OgnlGeAzRo)
-    ALLOCATE(OutData%OgnlGeAzRo(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%OgnlGeAzRo.', ErrStat, ErrMsg,RoutineName)
-       RETURN
-    END IF
-      DO i1 = LBOUND(OutData%OgnlGeAzRo,1), UBOUND(OutData%OgnlGeAzRo,1)
-        OutData%OgnlGeAzRo(i1) = ReKiBuf(Re_Xferred)
+      DO i1 = LBOUND(OutData%BlPitchCom,1), UBOUND(OutData%BlPitchCom,1)
+        OutData%BlPitchCom(i1) = ReKiBuf(Re_Xferred)
         Re_Xferred = Re_Xferred + 1
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! QD2T not allocated
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    Int_Xferred = Int_Xferred + 1
-    i1_l = IntKiBuf( Int_Xferred    )
-    i1_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%QD2T)) DEALLOCATE(OutData%QD2T)
-    ALLOCATE(OutData%QD2T(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%QD2T.', ErrStat, ErrMsg,RoutineName)
-       RETURN
-    END IF
-      DO i1 = LBOUND(OutData%QD2T,1), UBOUND(OutData%QD2T,1)
-        OutData%QD2T(i1) = REAL(DbKiBuf(Db_Xferred), R8Ki)
-        Db_Xferred = Db_Xferred + 1
-      END DO
-  END IF
-    OutData%IgnoreMod = TRANSFER(IntKiBuf(Int_Xferred), OutData%IgnoreMod)
-    Int_Xferred = Int_Xferred + 1
-    OutData%LSSTrqLoss = ReKiBuf(Re_Xferred)
+    OutData%YawMom = ReKiBuf(Re_Xferred)
     Re_Xferred = Re_Xferred + 1
- END SUBROUTINE ED_UnPackMisc
+    OutData%GenTrq = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%HSSBrTrqC = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+ END SUBROUTINE ED_UnPackInput
 
- SUBROUTINE ED_CopyParam( SrcParamData, DstParamData, CtrlCode, ErrStat, ErrMsg )
-   TYPE(ED_ParameterType), INTENT(IN) :: SrcParamData
-   TYPE(ED_ParameterType), INTENT(INOUT) :: DstParamData
+ SUBROUTINE ED_CopyMisc( SrcMiscData, DstMiscData, CtrlCode, ErrStat, ErrMsg )
+   TYPE(ED_MiscVarType), INTENT(INOUT) :: SrcMiscData
+   TYPE(ED_MiscVarType), INTENT(INOUT) :: DstMiscData
    INTEGER(IntKi),  INTENT(IN   ) :: CtrlCode
    INTEGER(IntKi),  INTENT(  OUT) :: ErrStat
    CHARACTER(*),    INTENT(  OUT) :: ErrMsg
@@ -16656,752 +16751,2291 @@ ENDIF
    INTEGER(IntKi)                 :: i1, i1_l, i1_u  !  bounds (upper/lower) for an array dimension 1
    INTEGER(IntKi)                 :: i2, i2_l, i2_u  !  bounds (upper/lower) for an array dimension 2
    INTEGER(IntKi)                 :: i3, i3_l, i3_u  !  bounds (upper/lower) for an array dimension 3
-   INTEGER(IntKi)                 :: i4, i4_l, i4_u  !  bounds (upper/lower) for an array dimension 4
-   INTEGER(IntKi)                 :: i5, i5_l, i5_u  !  bounds (upper/lower) for an array dimension 5
    INTEGER(IntKi)                 :: ErrStat2
    CHARACTER(ErrMsgLen)           :: ErrMsg2
-   CHARACTER(*), PARAMETER        :: RoutineName = 'ED_CopyParam'
+   CHARACTER(*), PARAMETER        :: RoutineName = 'ED_CopyMisc'
 ! 
    ErrStat = ErrID_None
    ErrMsg  = ""
-    DstParamData%DT = SrcParamData%DT
-    DstParamData%DT24 = SrcParamData%DT24
-    DstParamData%BldNodes = SrcParamData%BldNodes
-    DstParamData%TipNode = SrcParamData%TipNode
-    DstParamData%NDOF = SrcParamData%NDOF
-    DstParamData%TwoPiNB = SrcParamData%TwoPiNB
-    DstParamData%NAug = SrcParamData%NAug
-    DstParamData%NPH = SrcParamData%NPH
-IF (ALLOCATED(SrcParamData%PH)) THEN
-  i1_l = LBOUND(SrcParamData%PH,1)
-  i1_u = UBOUND(SrcParamData%PH,1)
-  IF (.NOT. ALLOCATED(DstParamData%PH)) THEN 
-    ALLOCATE(DstParamData%PH(i1_l:i1_u),STAT=ErrStat2)
+      CALL ED_Copycoordsys( SrcMiscData%CoordSys, DstMiscData%CoordSys, CtrlCode, ErrStat2, ErrMsg2 )
+         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg,RoutineName)
+         IF (ErrStat>=AbortErrLev) RETURN
+      CALL ED_Copyrthndside( SrcMiscData%RtHS, DstMiscData%RtHS, CtrlCode, ErrStat2, ErrMsg2 )
+         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg,RoutineName)
+         IF (ErrStat>=AbortErrLev) RETURN
+IF (ALLOCATED(SrcMiscData%AllOuts)) THEN
+  i1_l = LBOUND(SrcMiscData%AllOuts,1)
+  i1_u = UBOUND(SrcMiscData%AllOuts,1)
+  IF (.NOT. ALLOCATED(DstMiscData%AllOuts)) THEN 
+    ALLOCATE(DstMiscData%AllOuts(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%PH.', ErrStat, ErrMsg,RoutineName)
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%AllOuts.', ErrStat, ErrMsg,RoutineName)
       RETURN
     END IF
   END IF
-    DstParamData%PH = SrcParamData%PH
+    DstMiscData%AllOuts = SrcMiscData%AllOuts
 ENDIF
-    DstParamData%NPM = SrcParamData%NPM
-IF (ALLOCATED(SrcParamData%PM)) THEN
-  i1_l = LBOUND(SrcParamData%PM,1)
-  i1_u = UBOUND(SrcParamData%PM,1)
-  i2_l = LBOUND(SrcParamData%PM,2)
-  i2_u = UBOUND(SrcParamData%PM,2)
-  IF (.NOT. ALLOCATED(DstParamData%PM)) THEN 
-    ALLOCATE(DstParamData%PM(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+IF (ALLOCATED(SrcMiscData%AugMat)) THEN
+  i1_l = LBOUND(SrcMiscData%AugMat,1)
+  i1_u = UBOUND(SrcMiscData%AugMat,1)
+  i2_l = LBOUND(SrcMiscData%AugMat,2)
+  i2_u = UBOUND(SrcMiscData%AugMat,2)
+  IF (.NOT. ALLOCATED(DstMiscData%AugMat)) THEN 
+    ALLOCATE(DstMiscData%AugMat(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%PM.', ErrStat, ErrMsg,RoutineName)
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%AugMat.', ErrStat, ErrMsg,RoutineName)
       RETURN
     END IF
   END IF
-    DstParamData%PM = SrcParamData%PM
+    DstMiscData%AugMat = SrcMiscData%AugMat
 ENDIF
-IF (ALLOCATED(SrcParamData%DOF_Flag)) THEN
-  i1_l = LBOUND(SrcParamData%DOF_Flag,1)
-  i1_u = UBOUND(SrcParamData%DOF_Flag,1)
-  IF (.NOT. ALLOCATED(DstParamData%DOF_Flag)) THEN 
-    ALLOCATE(DstParamData%DOF_Flag(i1_l:i1_u),STAT=ErrStat2)
+IF (ALLOCATED(SrcMiscData%AugMat_factor)) THEN
+  i1_l = LBOUND(SrcMiscData%AugMat_factor,1)
+  i1_u = UBOUND(SrcMiscData%AugMat_factor,1)
+  i2_l = LBOUND(SrcMiscData%AugMat_factor,2)
+  i2_u = UBOUND(SrcMiscData%AugMat_factor,2)
+  IF (.NOT. ALLOCATED(DstMiscData%AugMat_factor)) THEN 
+    ALLOCATE(DstMiscData%AugMat_factor(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%DOF_Flag.', ErrStat, ErrMsg,RoutineName)
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%AugMat_factor.', ErrStat, ErrMsg,RoutineName)
       RETURN
     END IF
   END IF
-    DstParamData%DOF_Flag = SrcParamData%DOF_Flag
+    DstMiscData%AugMat_factor = SrcMiscData%AugMat_factor
 ENDIF
-IF (ALLOCATED(SrcParamData%DOF_Desc)) THEN
-  i1_l = LBOUND(SrcParamData%DOF_Desc,1)
-  i1_u = UBOUND(SrcParamData%DOF_Desc,1)
-  IF (.NOT. ALLOCATED(DstParamData%DOF_Desc)) THEN 
-    ALLOCATE(DstParamData%DOF_Desc(i1_l:i1_u),STAT=ErrStat2)
+IF (ALLOCATED(SrcMiscData%SolnVec)) THEN
+  i1_l = LBOUND(SrcMiscData%SolnVec,1)
+  i1_u = UBOUND(SrcMiscData%SolnVec,1)
+  IF (.NOT. ALLOCATED(DstMiscData%SolnVec)) THEN 
+    ALLOCATE(DstMiscData%SolnVec(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%DOF_Desc.', ErrStat, ErrMsg,RoutineName)
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%SolnVec.', ErrStat, ErrMsg,RoutineName)
       RETURN
     END IF
   END IF
-    DstParamData%DOF_Desc = SrcParamData%DOF_Desc
+    DstMiscData%SolnVec = SrcMiscData%SolnVec
 ENDIF
-      CALL ED_Copyactivedofs( SrcParamData%DOFs, DstParamData%DOFs, CtrlCode, ErrStat2, ErrMsg2 )
-         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg,RoutineName)
-         IF (ErrStat>=AbortErrLev) RETURN
-    DstParamData%NumOuts = SrcParamData%NumOuts
-    DstParamData%OutFmt = SrcParamData%OutFmt
-    DstParamData%NBlGages = SrcParamData%NBlGages
-    DstParamData%NTwGages = SrcParamData%NTwGages
-IF (ALLOCATED(SrcParamData%OutParam)) THEN
-  i1_l = LBOUND(SrcParamData%OutParam,1)
-  i1_u = UBOUND(SrcParamData%OutParam,1)
-  IF (.NOT. ALLOCATED(DstParamData%OutParam)) THEN 
-    ALLOCATE(DstParamData%OutParam(i1_l:i1_u),STAT=ErrStat2)
+IF (ALLOCATED(SrcMiscData%AugMat_pivot)) THEN
+  i1_l = LBOUND(SrcMiscData%AugMat_pivot,1)
+  i1_u = UBOUND(SrcMiscData%AugMat_pivot,1)
+  IF (.NOT. ALLOCATED(DstMiscData%AugMat_pivot)) THEN 
+    ALLOCATE(DstMiscData%AugMat_pivot(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%OutParam.', ErrStat, ErrMsg,RoutineName)
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%AugMat_pivot.', ErrStat, ErrMsg,RoutineName)
       RETURN
     END IF
   END IF
-    DO i1 = LBOUND(SrcParamData%OutParam,1), UBOUND(SrcParamData%OutParam,1)
-      CALL NWTC_Library_Copyoutparmtype( SrcParamData%OutParam(i1), DstParamData%OutParam(i1), CtrlCode, ErrStat2, ErrMsg2 )
-         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg,RoutineName)
-         IF (ErrStat>=AbortErrLev) RETURN
-    ENDDO
+    DstMiscData%AugMat_pivot = SrcMiscData%AugMat_pivot
 ENDIF
-    DstParamData%Delim = SrcParamData%Delim
-    DstParamData%AvgNrmTpRd = SrcParamData%AvgNrmTpRd
-    DstParamData%AzimB1Up = SrcParamData%AzimB1Up
-    DstParamData%CosDel3 = SrcParamData%CosDel3
-IF (ALLOCATED(SrcParamData%CosPreC)) THEN
-  i1_l = LBOUND(SrcParamData%CosPreC,1)
-  i1_u = UBOUND(SrcParamData%CosPreC,1)
-  IF (.NOT. ALLOCATED(DstParamData%CosPreC)) THEN 
-    ALLOCATE(DstParamData%CosPreC(i1_l:i1_u),STAT=ErrStat2)
+IF (ALLOCATED(SrcMiscData%OgnlGeAzRo)) THEN
+  i1_l = LBOUND(SrcMiscData%OgnlGeAzRo,1)
+  i1_u = UBOUND(SrcMiscData%OgnlGeAzRo,1)
+  IF (.NOT. ALLOCATED(DstMiscData%OgnlGeAzRo)) THEN 
+    ALLOCATE(DstMiscData%OgnlGeAzRo(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%CosPreC.', ErrStat, ErrMsg,RoutineName)
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%OgnlGeAzRo.', ErrStat, ErrMsg,RoutineName)
       RETURN
     END IF
   END IF
-    DstParamData%CosPreC = SrcParamData%CosPreC
+    DstMiscData%OgnlGeAzRo = SrcMiscData%OgnlGeAzRo
 ENDIF
-    DstParamData%CRFrlSkew = SrcParamData%CRFrlSkew
-    DstParamData%CRFrlSkw2 = SrcParamData%CRFrlSkw2
-    DstParamData%CRFrlTilt = SrcParamData%CRFrlTilt
-    DstParamData%CRFrlTlt2 = SrcParamData%CRFrlTlt2
-    DstParamData%CShftSkew = SrcParamData%CShftSkew
-    DstParamData%CShftTilt = SrcParamData%CShftTilt
-    DstParamData%CSRFrlSkw = SrcParamData%CSRFrlSkw
-    DstParamData%CSRFrlTlt = SrcParamData%CSRFrlTlt
-    DstParamData%CSTFrlSkw = SrcParamData%CSTFrlSkw
-    DstParamData%CSTFrlTlt = SrcParamData%CSTFrlTlt
-    DstParamData%CTFinBank = SrcParamData%CTFinBank
-    DstParamData%CTFinSkew = SrcParamData%CTFinSkew
-    DstParamData%CTFinTilt = SrcParamData%CTFinTilt
-    DstParamData%CTFrlSkew = SrcParamData%CTFrlSkew
-    DstParamData%CTFrlSkw2 = SrcParamData%CTFrlSkw2
-    DstParamData%CTFrlTilt = SrcParamData%CTFrlTilt
-    DstParamData%CTFrlTlt2 = SrcParamData%CTFrlTlt2
-    DstParamData%HubHt = SrcParamData%HubHt
-    DstParamData%HubCM = SrcParamData%HubCM
-    DstParamData%HubRad = SrcParamData%HubRad
-    DstParamData%NacCMxn = SrcParamData%NacCMxn
-    DstParamData%NacCMyn = SrcParamData%NacCMyn
-    DstParamData%NacCMzn = SrcParamData%NacCMzn
-    DstParamData%OverHang = SrcParamData%OverHang
-    DstParamData%ProjArea = SrcParamData%ProjArea
-    DstParamData%PtfmRefzt = SrcParamData%PtfmRefzt
-    DstParamData%RefTwrHt = SrcParamData%RefTwrHt
-    DstParamData%RFrlPntxn = SrcParamData%RFrlPntxn
-    DstParamData%RFrlPntyn = SrcParamData%RFrlPntyn
-    DstParamData%RFrlPntzn = SrcParamData%RFrlPntzn
-    DstParamData%rVDxn = SrcParamData%rVDxn
-    DstParamData%rVDyn = SrcParamData%rVDyn
-    DstParamData%rVDzn = SrcParamData%rVDzn
-    DstParamData%rVIMUxn = SrcParamData%rVIMUxn
-    DstParamData%rVIMUyn = SrcParamData%rVIMUyn
-    DstParamData%rVIMUzn = SrcParamData%rVIMUzn
-    DstParamData%rVPxn = SrcParamData%rVPxn
-    DstParamData%rVPyn = SrcParamData%rVPyn
-    DstParamData%rVPzn = SrcParamData%rVPzn
-    DstParamData%rWIxn = SrcParamData%rWIxn
-    DstParamData%rWIyn = SrcParamData%rWIyn
-    DstParamData%rWIzn = SrcParamData%rWIzn
-    DstParamData%rWJxn = SrcParamData%rWJxn
-    DstParamData%rWJyn = SrcParamData%rWJyn
-    DstParamData%rWJzn = SrcParamData%rWJzn
-    DstParamData%rWKxn = SrcParamData%rWKxn
-    DstParamData%rWKyn = SrcParamData%rWKyn
-    DstParamData%rWKzn = SrcParamData%rWKzn
-    DstParamData%rZT0zt = SrcParamData%rZT0zt
-    DstParamData%rZYzt = SrcParamData%rZYzt
-    DstParamData%SinDel3 = SrcParamData%SinDel3
-IF (ALLOCATED(SrcParamData%SinPreC)) THEN
-  i1_l = LBOUND(SrcParamData%SinPreC,1)
-  i1_u = UBOUND(SrcParamData%SinPreC,1)
-  IF (.NOT. ALLOCATED(DstParamData%SinPreC)) THEN 
-    ALLOCATE(DstParamData%SinPreC(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%SinPreC.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstParamData%SinPreC = SrcParamData%SinPreC
-ENDIF
-    DstParamData%SRFrlSkew = SrcParamData%SRFrlSkew
-    DstParamData%SRFrlSkw2 = SrcParamData%SRFrlSkw2
-    DstParamData%SRFrlTilt = SrcParamData%SRFrlTilt
-    DstParamData%SRFrlTlt2 = SrcParamData%SRFrlTlt2
-    DstParamData%SShftSkew = SrcParamData%SShftSkew
-    DstParamData%SShftTilt = SrcParamData%SShftTilt
-    DstParamData%STFinBank = SrcParamData%STFinBank
-    DstParamData%STFinSkew = SrcParamData%STFinSkew
-    DstParamData%STFinTilt = SrcParamData%STFinTilt
-    DstParamData%STFrlSkew = SrcParamData%STFrlSkew
-    DstParamData%STFrlSkw2 = SrcParamData%STFrlSkw2
-    DstParamData%STFrlTilt = SrcParamData%STFrlTilt
-    DstParamData%STFrlTlt2 = SrcParamData%STFrlTlt2
-    DstParamData%TFrlPntxn = SrcParamData%TFrlPntxn
-    DstParamData%TFrlPntyn = SrcParamData%TFrlPntyn
-    DstParamData%TFrlPntzn = SrcParamData%TFrlPntzn
-    DstParamData%TipRad = SrcParamData%TipRad
-    DstParamData%TowerHt = SrcParamData%TowerHt
-    DstParamData%TowerBsHt = SrcParamData%TowerBsHt
-    DstParamData%UndSling = SrcParamData%UndSling
-    DstParamData%NumBl = SrcParamData%NumBl
-IF (ALLOCATED(SrcParamData%AxRedTFA)) THEN
-  i1_l = LBOUND(SrcParamData%AxRedTFA,1)
-  i1_u = UBOUND(SrcParamData%AxRedTFA,1)
-  i2_l = LBOUND(SrcParamData%AxRedTFA,2)
-  i2_u = UBOUND(SrcParamData%AxRedTFA,2)
-  i3_l = LBOUND(SrcParamData%AxRedTFA,3)
-  i3_u = UBOUND(SrcParamData%AxRedTFA,3)
-  IF (.NOT. ALLOCATED(DstParamData%AxRedTFA)) THEN 
-    ALLOCATE(DstParamData%AxRedTFA(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+IF (ALLOCATED(SrcMiscData%QD2T)) THEN
+  i1_l = LBOUND(SrcMiscData%QD2T,1)
+  i1_u = UBOUND(SrcMiscData%QD2T,1)
+  IF (.NOT. ALLOCATED(DstMiscData%QD2T)) THEN 
+    ALLOCATE(DstMiscData%QD2T(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%AxRedTFA.', ErrStat, ErrMsg,RoutineName)
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%QD2T.', ErrStat, ErrMsg,RoutineName)
       RETURN
     END IF
   END IF
-    DstParamData%AxRedTFA = SrcParamData%AxRedTFA
+    DstMiscData%QD2T = SrcMiscData%QD2T
 ENDIF
-IF (ALLOCATED(SrcParamData%AxRedTSS)) THEN
-  i1_l = LBOUND(SrcParamData%AxRedTSS,1)
-  i1_u = UBOUND(SrcParamData%AxRedTSS,1)
-  i2_l = LBOUND(SrcParamData%AxRedTSS,2)
-  i2_u = UBOUND(SrcParamData%AxRedTSS,2)
-  i3_l = LBOUND(SrcParamData%AxRedTSS,3)
-  i3_u = UBOUND(SrcParamData%AxRedTSS,3)
-  IF (.NOT. ALLOCATED(DstParamData%AxRedTSS)) THEN 
-    ALLOCATE(DstParamData%AxRedTSS(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%AxRedTSS.', ErrStat, ErrMsg,RoutineName)
+    DstMiscData%IgnoreMod = SrcMiscData%IgnoreMod
+    DstMiscData%LSSTrqLoss = SrcMiscData%LSSTrqLoss
+IF (ALLOCATED(SrcMiscData%LinAccES)) THEN
+  i1_l = LBOUND(SrcMiscData%LinAccES,1)
+  i1_u = UBOUND(SrcMiscData%LinAccES,1)
+  i2_l = LBOUND(SrcMiscData%LinAccES,2)
+  i2_u = UBOUND(SrcMiscData%LinAccES,2)
+  i3_l = LBOUND(SrcMiscData%LinAccES,3)
+  i3_u = UBOUND(SrcMiscData%LinAccES,3)
+  IF (.NOT. ALLOCATED(DstMiscData%LinAccES)) THEN 
+    ALLOCATE(DstMiscData%LinAccES(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%LinAccES.', ErrStat, ErrMsg,RoutineName)
       RETURN
     END IF
   END IF
-    DstParamData%AxRedTSS = SrcParamData%AxRedTSS
+    DstMiscData%LinAccES = SrcMiscData%LinAccES
 ENDIF
-    DstParamData%CTFA = SrcParamData%CTFA
-    DstParamData%CTSS = SrcParamData%CTSS
-IF (ALLOCATED(SrcParamData%DHNodes)) THEN
-  i1_l = LBOUND(SrcParamData%DHNodes,1)
-  i1_u = UBOUND(SrcParamData%DHNodes,1)
-  IF (.NOT. ALLOCATED(DstParamData%DHNodes)) THEN 
-    ALLOCATE(DstParamData%DHNodes(i1_l:i1_u),STAT=ErrStat2)
+IF (ALLOCATED(SrcMiscData%AngAccEK)) THEN
+  i1_l = LBOUND(SrcMiscData%AngAccEK,1)
+  i1_u = UBOUND(SrcMiscData%AngAccEK,1)
+  i2_l = LBOUND(SrcMiscData%AngAccEK,2)
+  i2_u = UBOUND(SrcMiscData%AngAccEK,2)
+  i3_l = LBOUND(SrcMiscData%AngAccEK,3)
+  i3_u = UBOUND(SrcMiscData%AngAccEK,3)
+  IF (.NOT. ALLOCATED(DstMiscData%AngAccEK)) THEN 
+    ALLOCATE(DstMiscData%AngAccEK(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%DHNodes.', ErrStat, ErrMsg,RoutineName)
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%AngAccEK.', ErrStat, ErrMsg,RoutineName)
       RETURN
     END IF
   END IF
-    DstParamData%DHNodes = SrcParamData%DHNodes
+    DstMiscData%AngAccEK = SrcMiscData%AngAccEK
 ENDIF
-IF (ALLOCATED(SrcParamData%HNodes)) THEN
-  i1_l = LBOUND(SrcParamData%HNodes,1)
-  i1_u = UBOUND(SrcParamData%HNodes,1)
-  IF (.NOT. ALLOCATED(DstParamData%HNodes)) THEN 
-    ALLOCATE(DstParamData%HNodes(i1_l:i1_u),STAT=ErrStat2)
+IF (ALLOCATED(SrcMiscData%LinAccET)) THEN
+  i1_l = LBOUND(SrcMiscData%LinAccET,1)
+  i1_u = UBOUND(SrcMiscData%LinAccET,1)
+  i2_l = LBOUND(SrcMiscData%LinAccET,2)
+  i2_u = UBOUND(SrcMiscData%LinAccET,2)
+  IF (.NOT. ALLOCATED(DstMiscData%LinAccET)) THEN 
+    ALLOCATE(DstMiscData%LinAccET(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%HNodes.', ErrStat, ErrMsg,RoutineName)
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%LinAccET.', ErrStat, ErrMsg,RoutineName)
       RETURN
     END IF
   END IF
-    DstParamData%HNodes = SrcParamData%HNodes
+    DstMiscData%LinAccET = SrcMiscData%LinAccET
 ENDIF
-IF (ALLOCATED(SrcParamData%HNodesNorm)) THEN
-  i1_l = LBOUND(SrcParamData%HNodesNorm,1)
-  i1_u = UBOUND(SrcParamData%HNodesNorm,1)
-  IF (.NOT. ALLOCATED(DstParamData%HNodesNorm)) THEN 
-    ALLOCATE(DstParamData%HNodesNorm(i1_l:i1_u),STAT=ErrStat2)
+IF (ALLOCATED(SrcMiscData%AngAccEF)) THEN
+  i1_l = LBOUND(SrcMiscData%AngAccEF,1)
+  i1_u = UBOUND(SrcMiscData%AngAccEF,1)
+  i2_l = LBOUND(SrcMiscData%AngAccEF,2)
+  i2_u = UBOUND(SrcMiscData%AngAccEF,2)
+  IF (.NOT. ALLOCATED(DstMiscData%AngAccEF)) THEN 
+    ALLOCATE(DstMiscData%AngAccEF(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%HNodesNorm.', ErrStat, ErrMsg,RoutineName)
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%AngAccEF.', ErrStat, ErrMsg,RoutineName)
       RETURN
     END IF
   END IF
-    DstParamData%HNodesNorm = SrcParamData%HNodesNorm
+    DstMiscData%AngAccEF = SrcMiscData%AngAccEF
 ENDIF
-    DstParamData%KTFA = SrcParamData%KTFA
-    DstParamData%KTSS = SrcParamData%KTSS
-IF (ALLOCATED(SrcParamData%MassT)) THEN
-  i1_l = LBOUND(SrcParamData%MassT,1)
-  i1_u = UBOUND(SrcParamData%MassT,1)
-  IF (.NOT. ALLOCATED(DstParamData%MassT)) THEN 
-    ALLOCATE(DstParamData%MassT(i1_l:i1_u),STAT=ErrStat2)
+IF (ALLOCATED(SrcMiscData%FrcS0B)) THEN
+  i1_l = LBOUND(SrcMiscData%FrcS0B,1)
+  i1_u = UBOUND(SrcMiscData%FrcS0B,1)
+  i2_l = LBOUND(SrcMiscData%FrcS0B,2)
+  i2_u = UBOUND(SrcMiscData%FrcS0B,2)
+  IF (.NOT. ALLOCATED(DstMiscData%FrcS0B)) THEN 
+    ALLOCATE(DstMiscData%FrcS0B(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%MassT.', ErrStat, ErrMsg,RoutineName)
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%FrcS0B.', ErrStat, ErrMsg,RoutineName)
       RETURN
     END IF
   END IF
-    DstParamData%MassT = SrcParamData%MassT
+    DstMiscData%FrcS0B = SrcMiscData%FrcS0B
 ENDIF
-IF (ALLOCATED(SrcParamData%StiffTSS)) THEN
-  i1_l = LBOUND(SrcParamData%StiffTSS,1)
-  i1_u = UBOUND(SrcParamData%StiffTSS,1)
-  IF (.NOT. ALLOCATED(DstParamData%StiffTSS)) THEN 
-    ALLOCATE(DstParamData%StiffTSS(i1_l:i1_u),STAT=ErrStat2)
+IF (ALLOCATED(SrcMiscData%FTTower)) THEN
+  i1_l = LBOUND(SrcMiscData%FTTower,1)
+  i1_u = UBOUND(SrcMiscData%FTTower,1)
+  i2_l = LBOUND(SrcMiscData%FTTower,2)
+  i2_u = UBOUND(SrcMiscData%FTTower,2)
+  IF (.NOT. ALLOCATED(DstMiscData%FTTower)) THEN 
+    ALLOCATE(DstMiscData%FTTower(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%StiffTSS.', ErrStat, ErrMsg,RoutineName)
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%FTTower.', ErrStat, ErrMsg,RoutineName)
       RETURN
     END IF
   END IF
-    DstParamData%StiffTSS = SrcParamData%StiffTSS
+    DstMiscData%FTTower = SrcMiscData%FTTower
 ENDIF
-IF (ALLOCATED(SrcParamData%TwrFASF)) THEN
-  i1_l = LBOUND(SrcParamData%TwrFASF,1)
-  i1_u = UBOUND(SrcParamData%TwrFASF,1)
-  i2_l = LBOUND(SrcParamData%TwrFASF,2)
-  i2_u = UBOUND(SrcParamData%TwrFASF,2)
-  i3_l = LBOUND(SrcParamData%TwrFASF,3)
-  i3_u = UBOUND(SrcParamData%TwrFASF,3)
-  IF (.NOT. ALLOCATED(DstParamData%TwrFASF)) THEN 
-    ALLOCATE(DstParamData%TwrFASF(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+IF (ALLOCATED(SrcMiscData%MFHydro)) THEN
+  i1_l = LBOUND(SrcMiscData%MFHydro,1)
+  i1_u = UBOUND(SrcMiscData%MFHydro,1)
+  i2_l = LBOUND(SrcMiscData%MFHydro,2)
+  i2_u = UBOUND(SrcMiscData%MFHydro,2)
+  IF (.NOT. ALLOCATED(DstMiscData%MFHydro)) THEN 
+    ALLOCATE(DstMiscData%MFHydro(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%TwrFASF.', ErrStat, ErrMsg,RoutineName)
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%MFHydro.', ErrStat, ErrMsg,RoutineName)
       RETURN
     END IF
   END IF
-    DstParamData%TwrFASF = SrcParamData%TwrFASF
+    DstMiscData%MFHydro = SrcMiscData%MFHydro
 ENDIF
-    DstParamData%TwrFlexL = SrcParamData%TwrFlexL
-IF (ALLOCATED(SrcParamData%TwrSSSF)) THEN
-  i1_l = LBOUND(SrcParamData%TwrSSSF,1)
-  i1_u = UBOUND(SrcParamData%TwrSSSF,1)
-  i2_l = LBOUND(SrcParamData%TwrSSSF,2)
-  i2_u = UBOUND(SrcParamData%TwrSSSF,2)
-  i3_l = LBOUND(SrcParamData%TwrSSSF,3)
-  i3_u = UBOUND(SrcParamData%TwrSSSF,3)
-  IF (.NOT. ALLOCATED(DstParamData%TwrSSSF)) THEN 
-    ALLOCATE(DstParamData%TwrSSSF(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+IF (ALLOCATED(SrcMiscData%MomH0B)) THEN
+  i1_l = LBOUND(SrcMiscData%MomH0B,1)
+  i1_u = UBOUND(SrcMiscData%MomH0B,1)
+  i2_l = LBOUND(SrcMiscData%MomH0B,2)
+  i2_u = UBOUND(SrcMiscData%MomH0B,2)
+  IF (.NOT. ALLOCATED(DstMiscData%MomH0B)) THEN 
+    ALLOCATE(DstMiscData%MomH0B(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%TwrSSSF.', ErrStat, ErrMsg,RoutineName)
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%MomH0B.', ErrStat, ErrMsg,RoutineName)
       RETURN
     END IF
   END IF
-    DstParamData%TwrSSSF = SrcParamData%TwrSSSF
+    DstMiscData%MomH0B = SrcMiscData%MomH0B
 ENDIF
-    DstParamData%TTopNode = SrcParamData%TTopNode
-    DstParamData%TwrNodes = SrcParamData%TwrNodes
-IF (ALLOCATED(SrcParamData%InerTFA)) THEN
-  i1_l = LBOUND(SrcParamData%InerTFA,1)
-  i1_u = UBOUND(SrcParamData%InerTFA,1)
-  IF (.NOT. ALLOCATED(DstParamData%InerTFA)) THEN 
-    ALLOCATE(DstParamData%InerTFA(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%InerTFA.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
+      CALL ED_CopyInput( SrcMiscData%u_interp, DstMiscData%u_interp, CtrlCode, ErrStat2, ErrMsg2 )
+         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg,RoutineName)
+         IF (ErrStat>=AbortErrLev) RETURN
+      CALL ED_CopyContState( SrcMiscData%x_pred, DstMiscData%x_pred, CtrlCode, ErrStat2, ErrMsg2 )
+         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg,RoutineName)
+         IF (ErrStat>=AbortErrLev) RETURN
+      CALL ED_CopyContState( SrcMiscData%xdot, DstMiscData%xdot, CtrlCode, ErrStat2, ErrMsg2 )
+         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg,RoutineName)
+         IF (ErrStat>=AbortErrLev) RETURN
+ END SUBROUTINE ED_CopyMisc
+
+ SUBROUTINE ED_DestroyMisc( MiscData, ErrStat, ErrMsg, DEALLOCATEpointers )
+  TYPE(ED_MiscVarType), INTENT(INOUT) :: MiscData
+  INTEGER(IntKi),  INTENT(  OUT) :: ErrStat
+  CHARACTER(*),    INTENT(  OUT) :: ErrMsg
+  LOGICAL,OPTIONAL,INTENT(IN   ) :: DEALLOCATEpointers
+  
+  INTEGER(IntKi)                 :: i, i1, i2, i3, i4, i5 
+  LOGICAL                        :: DEALLOCATEpointers_local
+  INTEGER(IntKi)                 :: ErrStat2
+  CHARACTER(ErrMsgLen)           :: ErrMsg2
+  CHARACTER(*),    PARAMETER :: RoutineName = 'ED_DestroyMisc'
+
+  ErrStat = ErrID_None
+  ErrMsg  = ""
+
+  IF (PRESENT(DEALLOCATEpointers)) THEN
+     DEALLOCATEpointers_local = DEALLOCATEpointers
+  ELSE
+     DEALLOCATEpointers_local = .true.
   END IF
-    DstParamData%InerTFA = SrcParamData%InerTFA
+  
+  CALL ED_Destroycoordsys( MiscData%CoordSys, ErrStat2, ErrMsg2, DEALLOCATEpointers_local )
+     CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+  CALL ED_Destroyrthndside( MiscData%RtHS, ErrStat2, ErrMsg2, DEALLOCATEpointers_local )
+     CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+IF (ALLOCATED(MiscData%AllOuts)) THEN
+  DEALLOCATE(MiscData%AllOuts)
 ENDIF
-IF (ALLOCATED(SrcParamData%InerTSS)) THEN
-  i1_l = LBOUND(SrcParamData%InerTSS,1)
-  i1_u = UBOUND(SrcParamData%InerTSS,1)
-  IF (.NOT. ALLOCATED(DstParamData%InerTSS)) THEN 
-    ALLOCATE(DstParamData%InerTSS(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%InerTSS.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstParamData%InerTSS = SrcParamData%InerTSS
+IF (ALLOCATED(MiscData%AugMat)) THEN
+  DEALLOCATE(MiscData%AugMat)
 ENDIF
-IF (ALLOCATED(SrcParamData%StiffTGJ)) THEN
-  i1_l = LBOUND(SrcParamData%StiffTGJ,1)
-  i1_u = UBOUND(SrcParamData%StiffTGJ,1)
-  IF (.NOT. ALLOCATED(DstParamData%StiffTGJ)) THEN 
-    ALLOCATE(DstParamData%StiffTGJ(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%StiffTGJ.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstParamData%StiffTGJ = SrcParamData%StiffTGJ
+IF (ALLOCATED(MiscData%AugMat_factor)) THEN
+  DEALLOCATE(MiscData%AugMat_factor)
 ENDIF
-IF (ALLOCATED(SrcParamData%StiffTEA)) THEN
-  i1_l = LBOUND(SrcParamData%StiffTEA,1)
-  i1_u = UBOUND(SrcParamData%StiffTEA,1)
-  IF (.NOT. ALLOCATED(DstParamData%StiffTEA)) THEN 
-    ALLOCATE(DstParamData%StiffTEA(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%StiffTEA.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstParamData%StiffTEA = SrcParamData%StiffTEA
+IF (ALLOCATED(MiscData%SolnVec)) THEN
+  DEALLOCATE(MiscData%SolnVec)
 ENDIF
-IF (ALLOCATED(SrcParamData%StiffTFA)) THEN
-  i1_l = LBOUND(SrcParamData%StiffTFA,1)
-  i1_u = UBOUND(SrcParamData%StiffTFA,1)
-  IF (.NOT. ALLOCATED(DstParamData%StiffTFA)) THEN 
-    ALLOCATE(DstParamData%StiffTFA(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%StiffTFA.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstParamData%StiffTFA = SrcParamData%StiffTFA
+IF (ALLOCATED(MiscData%AugMat_pivot)) THEN
+  DEALLOCATE(MiscData%AugMat_pivot)
 ENDIF
-IF (ALLOCATED(SrcParamData%cgOffTFA)) THEN
-  i1_l = LBOUND(SrcParamData%cgOffTFA,1)
-  i1_u = UBOUND(SrcParamData%cgOffTFA,1)
-  IF (.NOT. ALLOCATED(DstParamData%cgOffTFA)) THEN 
-    ALLOCATE(DstParamData%cgOffTFA(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%cgOffTFA.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstParamData%cgOffTFA = SrcParamData%cgOffTFA
+IF (ALLOCATED(MiscData%OgnlGeAzRo)) THEN
+  DEALLOCATE(MiscData%OgnlGeAzRo)
 ENDIF
-IF (ALLOCATED(SrcParamData%cgOffTSS)) THEN
-  i1_l = LBOUND(SrcParamData%cgOffTSS,1)
-  i1_u = UBOUND(SrcParamData%cgOffTSS,1)
-  IF (.NOT. ALLOCATED(DstParamData%cgOffTSS)) THEN 
-    ALLOCATE(DstParamData%cgOffTSS(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%cgOffTSS.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstParamData%cgOffTSS = SrcParamData%cgOffTSS
+IF (ALLOCATED(MiscData%QD2T)) THEN
+  DEALLOCATE(MiscData%QD2T)
 ENDIF
-    DstParamData%AtfaIner = SrcParamData%AtfaIner
-IF (ALLOCATED(SrcParamData%BldCG)) THEN
-  i1_l = LBOUND(SrcParamData%BldCG,1)
-  i1_u = UBOUND(SrcParamData%BldCG,1)
-  IF (.NOT. ALLOCATED(DstParamData%BldCG)) THEN 
-    ALLOCATE(DstParamData%BldCG(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%BldCG.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstParamData%BldCG = SrcParamData%BldCG
+IF (ALLOCATED(MiscData%LinAccES)) THEN
+  DEALLOCATE(MiscData%LinAccES)
 ENDIF
-IF (ALLOCATED(SrcParamData%BldMass)) THEN
-  i1_l = LBOUND(SrcParamData%BldMass,1)
-  i1_u = UBOUND(SrcParamData%BldMass,1)
-  IF (.NOT. ALLOCATED(DstParamData%BldMass)) THEN 
-    ALLOCATE(DstParamData%BldMass(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%BldMass.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstParamData%BldMass = SrcParamData%BldMass
+IF (ALLOCATED(MiscData%AngAccEK)) THEN
+  DEALLOCATE(MiscData%AngAccEK)
 ENDIF
-    DstParamData%BoomMass = SrcParamData%BoomMass
-IF (ALLOCATED(SrcParamData%FirstMom)) THEN
-  i1_l = LBOUND(SrcParamData%FirstMom,1)
-  i1_u = UBOUND(SrcParamData%FirstMom,1)
-  IF (.NOT. ALLOCATED(DstParamData%FirstMom)) THEN 
-    ALLOCATE(DstParamData%FirstMom(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%FirstMom.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstParamData%FirstMom = SrcParamData%FirstMom
+IF (ALLOCATED(MiscData%LinAccET)) THEN
+  DEALLOCATE(MiscData%LinAccET)
 ENDIF
-    DstParamData%GenIner = SrcParamData%GenIner
-    DstParamData%Hubg1Iner = SrcParamData%Hubg1Iner
-    DstParamData%Hubg2Iner = SrcParamData%Hubg2Iner
-    DstParamData%HubMass = SrcParamData%HubMass
-    DstParamData%Nacd2Iner = SrcParamData%Nacd2Iner
-    DstParamData%NacMass = SrcParamData%NacMass
-    DstParamData%PtfmMass = SrcParamData%PtfmMass
-    DstParamData%PtfmPIner = SrcParamData%PtfmPIner
-    DstParamData%PtfmRIner = SrcParamData%PtfmRIner
-    DstParamData%PtfmYIner = SrcParamData%PtfmYIner
-    DstParamData%RFrlMass = SrcParamData%RFrlMass
-    DstParamData%RotIner = SrcParamData%RotIner
-    DstParamData%RotMass = SrcParamData%RotMass
-    DstParamData%RrfaIner = SrcParamData%RrfaIner
-IF (ALLOCATED(SrcParamData%SecondMom)) THEN
-  i1_l = LBOUND(SrcParamData%SecondMom,1)
-  i1_u = UBOUND(SrcParamData%SecondMom,1)
-  IF (.NOT. ALLOCATED(DstParamData%SecondMom)) THEN 
-    ALLOCATE(DstParamData%SecondMom(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%SecondMom.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstParamData%SecondMom = SrcParamData%SecondMom
+IF (ALLOCATED(MiscData%AngAccEF)) THEN
+  DEALLOCATE(MiscData%AngAccEF)
 ENDIF
-    DstParamData%TFinMass = SrcParamData%TFinMass
-    DstParamData%TFrlIner = SrcParamData%TFrlIner
-IF (ALLOCATED(SrcParamData%TipMass)) THEN
-  i1_l = LBOUND(SrcParamData%TipMass,1)
-  i1_u = UBOUND(SrcParamData%TipMass,1)
-  IF (.NOT. ALLOCATED(DstParamData%TipMass)) THEN 
-    ALLOCATE(DstParamData%TipMass(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%TipMass.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstParamData%TipMass = SrcParamData%TipMass
+IF (ALLOCATED(MiscData%FrcS0B)) THEN
+  DEALLOCATE(MiscData%FrcS0B)
 ENDIF
-    DstParamData%TurbMass = SrcParamData%TurbMass
-    DstParamData%TwrMass = SrcParamData%TwrMass
-    DstParamData%TwrTpMass = SrcParamData%TwrTpMass
-    DstParamData%YawBrMass = SrcParamData%YawBrMass
-    DstParamData%Gravity = SrcParamData%Gravity
-IF (ALLOCATED(SrcParamData%PitchAxis)) THEN
-  i1_l = LBOUND(SrcParamData%PitchAxis,1)
-  i1_u = UBOUND(SrcParamData%PitchAxis,1)
-  i2_l = LBOUND(SrcParamData%PitchAxis,2)
-  i2_u = UBOUND(SrcParamData%PitchAxis,2)
-  IF (.NOT. ALLOCATED(DstParamData%PitchAxis)) THEN 
-    ALLOCATE(DstParamData%PitchAxis(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%PitchAxis.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstParamData%PitchAxis = SrcParamData%PitchAxis
+IF (ALLOCATED(MiscData%FTTower)) THEN
+  DEALLOCATE(MiscData%FTTower)
 ENDIF
-IF (ALLOCATED(SrcParamData%AeroTwst)) THEN
-  i1_l = LBOUND(SrcParamData%AeroTwst,1)
-  i1_u = UBOUND(SrcParamData%AeroTwst,1)
-  IF (.NOT. ALLOCATED(DstParamData%AeroTwst)) THEN 
-    ALLOCATE(DstParamData%AeroTwst(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%AeroTwst.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstParamData%AeroTwst = SrcParamData%AeroTwst
+IF (ALLOCATED(MiscData%MFHydro)) THEN
+  DEALLOCATE(MiscData%MFHydro)
 ENDIF
-IF (ALLOCATED(SrcParamData%AxRedBld)) THEN
-  i1_l = LBOUND(SrcParamData%AxRedBld,1)
-  i1_u = UBOUND(SrcParamData%AxRedBld,1)
-  i2_l = LBOUND(SrcParamData%AxRedBld,2)
-  i2_u = UBOUND(SrcParamData%AxRedBld,2)
-  i3_l = LBOUND(SrcParamData%AxRedBld,3)
-  i3_u = UBOUND(SrcParamData%AxRedBld,3)
-  i4_l = LBOUND(SrcParamData%AxRedBld,4)
-  i4_u = UBOUND(SrcParamData%AxRedBld,4)
-  IF (.NOT. ALLOCATED(DstParamData%AxRedBld)) THEN 
-    ALLOCATE(DstParamData%AxRedBld(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u,i4_l:i4_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%AxRedBld.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstParamData%AxRedBld = SrcParamData%AxRedBld
+IF (ALLOCATED(MiscData%MomH0B)) THEN
+  DEALLOCATE(MiscData%MomH0B)
 ENDIF
-IF (ALLOCATED(SrcParamData%BAlpha)) THEN
-  i1_l = LBOUND(SrcParamData%BAlpha,1)
-  i1_u = UBOUND(SrcParamData%BAlpha,1)
-  i2_l = LBOUND(SrcParamData%BAlpha,2)
-  i2_u = UBOUND(SrcParamData%BAlpha,2)
-  IF (.NOT. ALLOCATED(DstParamData%BAlpha)) THEN 
-    ALLOCATE(DstParamData%BAlpha(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%BAlpha.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
+  CALL ED_DestroyInput( MiscData%u_interp, ErrStat2, ErrMsg2, DEALLOCATEpointers_local )
+     CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+  CALL ED_DestroyContState( MiscData%x_pred, ErrStat2, ErrMsg2, DEALLOCATEpointers_local )
+     CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+  CALL ED_DestroyContState( MiscData%xdot, ErrStat2, ErrMsg2, DEALLOCATEpointers_local )
+     CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+ END SUBROUTINE ED_DestroyMisc
+
+ SUBROUTINE ED_PackMisc( ReKiBuf, DbKiBuf, IntKiBuf, Indata, ErrStat, ErrMsg, SizeOnly )
+  REAL(ReKi),       ALLOCATABLE, INTENT(  OUT) :: ReKiBuf(:)
+  REAL(DbKi),       ALLOCATABLE, INTENT(  OUT) :: DbKiBuf(:)
+  INTEGER(IntKi),   ALLOCATABLE, INTENT(  OUT) :: IntKiBuf(:)
+  TYPE(ED_MiscVarType),  INTENT(IN) :: InData
+  INTEGER(IntKi),   INTENT(  OUT) :: ErrStat
+  CHARACTER(*),     INTENT(  OUT) :: ErrMsg
+  LOGICAL,OPTIONAL, INTENT(IN   ) :: SizeOnly
+    ! Local variables
+  INTEGER(IntKi)                 :: Re_BufSz
+  INTEGER(IntKi)                 :: Re_Xferred
+  INTEGER(IntKi)                 :: Db_BufSz
+  INTEGER(IntKi)                 :: Db_Xferred
+  INTEGER(IntKi)                 :: Int_BufSz
+  INTEGER(IntKi)                 :: Int_Xferred
+  INTEGER(IntKi)                 :: i,i1,i2,i3,i4,i5
+  LOGICAL                        :: OnlySize ! if present and true, do not pack, just allocate buffers
+  INTEGER(IntKi)                 :: ErrStat2
+  CHARACTER(ErrMsgLen)           :: ErrMsg2
+  CHARACTER(*), PARAMETER        :: RoutineName = 'ED_PackMisc'
+ ! buffers to store subtypes, if any
+  REAL(ReKi),      ALLOCATABLE   :: Re_Buf(:)
+  REAL(DbKi),      ALLOCATABLE   :: Db_Buf(:)
+  INTEGER(IntKi),  ALLOCATABLE   :: Int_Buf(:)
+
+  OnlySize = .FALSE.
+  IF ( PRESENT(SizeOnly) ) THEN
+    OnlySize = SizeOnly
+  ENDIF
+    !
+  ErrStat = ErrID_None
+  ErrMsg  = ""
+  Re_BufSz  = 0
+  Db_BufSz  = 0
+  Int_BufSz  = 0
+   ! Allocate buffers for subtypes, if any (we'll get sizes from these) 
+      Int_BufSz   = Int_BufSz + 3  ! CoordSys: size of buffers for each call to pack subtype
+      CALL ED_Packcoordsys( Re_Buf, Db_Buf, Int_Buf, InData%CoordSys, ErrStat2, ErrMsg2, .TRUE. ) ! CoordSys 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf)) THEN ! CoordSys
+         Re_BufSz  = Re_BufSz  + SIZE( Re_Buf  )
+         DEALLOCATE(Re_Buf)
+      END IF
+      IF(ALLOCATED(Db_Buf)) THEN ! CoordSys
+         Db_BufSz  = Db_BufSz  + SIZE( Db_Buf  )
+         DEALLOCATE(Db_Buf)
+      END IF
+      IF(ALLOCATED(Int_Buf)) THEN ! CoordSys
+         Int_BufSz = Int_BufSz + SIZE( Int_Buf )
+         DEALLOCATE(Int_Buf)
+      END IF
+      Int_BufSz   = Int_BufSz + 3  ! RtHS: size of buffers for each call to pack subtype
+      CALL ED_Packrthndside( Re_Buf, Db_Buf, Int_Buf, InData%RtHS, ErrStat2, ErrMsg2, .TRUE. ) ! RtHS 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf)) THEN ! RtHS
+         Re_BufSz  = Re_BufSz  + SIZE( Re_Buf  )
+         DEALLOCATE(Re_Buf)
+      END IF
+      IF(ALLOCATED(Db_Buf)) THEN ! RtHS
+         Db_BufSz  = Db_BufSz  + SIZE( Db_Buf  )
+         DEALLOCATE(Db_Buf)
+      END IF
+      IF(ALLOCATED(Int_Buf)) THEN ! RtHS
+         Int_BufSz = Int_BufSz + SIZE( Int_Buf )
+         DEALLOCATE(Int_Buf)
+      END IF
+  Int_BufSz   = Int_BufSz   + 1     ! AllOuts allocated yes/no
+  IF ( ALLOCATED(InData%AllOuts) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*1  ! AllOuts upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%AllOuts)  ! AllOuts
   END IF
-    DstParamData%BAlpha = SrcParamData%BAlpha
-ENDIF
-IF (ALLOCATED(SrcParamData%BldEDamp)) THEN
-  i1_l = LBOUND(SrcParamData%BldEDamp,1)
-  i1_u = UBOUND(SrcParamData%BldEDamp,1)
-  i2_l = LBOUND(SrcParamData%BldEDamp,2)
-  i2_u = UBOUND(SrcParamData%BldEDamp,2)
-  IF (.NOT. ALLOCATED(DstParamData%BldEDamp)) THEN 
-    ALLOCATE(DstParamData%BldEDamp(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%BldEDamp.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
+  Int_BufSz   = Int_BufSz   + 1     ! AugMat allocated yes/no
+  IF ( ALLOCATED(InData%AugMat) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*2  ! AugMat upper/lower bounds for each dimension
+      Db_BufSz   = Db_BufSz   + SIZE(InData%AugMat)  ! AugMat
   END IF
-    DstParamData%BldEDamp = SrcParamData%BldEDamp
-ENDIF
-IF (ALLOCATED(SrcParamData%BldFDamp)) THEN
-  i1_l = LBOUND(SrcParamData%BldFDamp,1)
-  i1_u = UBOUND(SrcParamData%BldFDamp,1)
-  i2_l = LBOUND(SrcParamData%BldFDamp,2)
-  i2_u = UBOUND(SrcParamData%BldFDamp,2)
-  IF (.NOT. ALLOCATED(DstParamData%BldFDamp)) THEN 
-    ALLOCATE(DstParamData%BldFDamp(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%BldFDamp.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstParamData%BldFDamp = SrcParamData%BldFDamp
-ENDIF
-    DstParamData%BldFlexL = SrcParamData%BldFlexL
-IF (ALLOCATED(SrcParamData%CAeroTwst)) THEN
-  i1_l = LBOUND(SrcParamData%CAeroTwst,1)
-  i1_u = UBOUND(SrcParamData%CAeroTwst,1)
-  IF (.NOT. ALLOCATED(DstParamData%CAeroTwst)) THEN 
-    ALLOCATE(DstParamData%CAeroTwst(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%CAeroTwst.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstParamData%CAeroTwst = SrcParamData%CAeroTwst
-ENDIF
-IF (ALLOCATED(SrcParamData%CBE)) THEN
-  i1_l = LBOUND(SrcParamData%CBE,1)
-  i1_u = UBOUND(SrcParamData%CBE,1)
-  i2_l = LBOUND(SrcParamData%CBE,2)
-  i2_u = UBOUND(SrcParamData%CBE,2)
-  i3_l = LBOUND(SrcParamData%CBE,3)
-  i3_u = UBOUND(SrcParamData%CBE,3)
-  IF (.NOT. ALLOCATED(DstParamData%CBE)) THEN 
-    ALLOCATE(DstParamData%CBE(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%CBE.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstParamData%CBE = SrcParamData%CBE
-ENDIF
-IF (ALLOCATED(SrcParamData%CBF)) THEN
-  i1_l = LBOUND(SrcParamData%CBF,1)
-  i1_u = UBOUND(SrcParamData%CBF,1)
-  i2_l = LBOUND(SrcParamData%CBF,2)
-  i2_u = UBOUND(SrcParamData%CBF,2)
-  i3_l = LBOUND(SrcParamData%CBF,3)
-  i3_u = UBOUND(SrcParamData%CBF,3)
-  IF (.NOT. ALLOCATED(DstParamData%CBF)) THEN 
-    ALLOCATE(DstParamData%CBF(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%CBF.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstParamData%CBF = SrcParamData%CBF
-ENDIF
-IF (ALLOCATED(SrcParamData%cgOffBEdg)) THEN
-  i1_l = LBOUND(SrcParamData%cgOffBEdg,1)
-  i1_u = UBOUND(SrcParamData%cgOffBEdg,1)
-  i2_l = LBOUND(SrcParamData%cgOffBEdg,2)
-  i2_u = UBOUND(SrcParamData%cgOffBEdg,2)
-  IF (.NOT. ALLOCATED(DstParamData%cgOffBEdg)) THEN 
-    ALLOCATE(DstParamData%cgOffBEdg(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%cgOffBEdg.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstParamData%cgOffBEdg = SrcParamData%cgOffBEdg
-ENDIF
-IF (ALLOCATED(SrcParamData%cgOffBFlp)) THEN
-  i1_l = LBOUND(SrcParamData%cgOffBFlp,1)
-  i1_u = UBOUND(SrcParamData%cgOffBFlp,1)
-  i2_l = LBOUND(SrcParamData%cgOffBFlp,2)
-  i2_u = UBOUND(SrcParamData%cgOffBFlp,2)
-  IF (.NOT. ALLOCATED(DstParamData%cgOffBFlp)) THEN 
-    ALLOCATE(DstParamData%cgOffBFlp(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%cgOffBFlp.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
+  Int_BufSz   = Int_BufSz   + 1     ! AugMat_factor allocated yes/no
+  IF ( ALLOCATED(InData%AugMat_factor) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*2  ! AugMat_factor upper/lower bounds for each dimension
+      Db_BufSz   = Db_BufSz   + SIZE(InData%AugMat_factor)  ! AugMat_factor
   END IF
-    DstParamData%cgOffBFlp = SrcParamData%cgOffBFlp
-ENDIF
-IF (ALLOCATED(SrcParamData%Chord)) THEN
-  i1_l = LBOUND(SrcParamData%Chord,1)
-  i1_u = UBOUND(SrcParamData%Chord,1)
-  IF (.NOT. ALLOCATED(DstParamData%Chord)) THEN 
-    ALLOCATE(DstParamData%Chord(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%Chord.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
+  Int_BufSz   = Int_BufSz   + 1     ! SolnVec allocated yes/no
+  IF ( ALLOCATED(InData%SolnVec) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*1  ! SolnVec upper/lower bounds for each dimension
+      Db_BufSz   = Db_BufSz   + SIZE(InData%SolnVec)  ! SolnVec
   END IF
-    DstParamData%Chord = SrcParamData%Chord
-ENDIF
-IF (ALLOCATED(SrcParamData%CThetaS)) THEN
-  i1_l = LBOUND(SrcParamData%CThetaS,1)
-  i1_u = UBOUND(SrcParamData%CThetaS,1)
-  i2_l = LBOUND(SrcParamData%CThetaS,2)
-  i2_u = UBOUND(SrcParamData%CThetaS,2)
-  IF (.NOT. ALLOCATED(DstParamData%CThetaS)) THEN 
-    ALLOCATE(DstParamData%CThetaS(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%CThetaS.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
+  Int_BufSz   = Int_BufSz   + 1     ! AugMat_pivot allocated yes/no
+  IF ( ALLOCATED(InData%AugMat_pivot) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*1  ! AugMat_pivot upper/lower bounds for each dimension
+      Int_BufSz  = Int_BufSz  + SIZE(InData%AugMat_pivot)  ! AugMat_pivot
   END IF
-    DstParamData%CThetaS = SrcParamData%CThetaS
-ENDIF
-IF (ALLOCATED(SrcParamData%DRNodes)) THEN
-  i1_l = LBOUND(SrcParamData%DRNodes,1)
-  i1_u = UBOUND(SrcParamData%DRNodes,1)
-  IF (.NOT. ALLOCATED(DstParamData%DRNodes)) THEN 
-    ALLOCATE(DstParamData%DRNodes(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%DRNodes.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
+  Int_BufSz   = Int_BufSz   + 1     ! OgnlGeAzRo allocated yes/no
+  IF ( ALLOCATED(InData%OgnlGeAzRo) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*1  ! OgnlGeAzRo upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%OgnlGeAzRo)  ! OgnlGeAzRo
   END IF
-    DstParamData%DRNodes = SrcParamData%DRNodes
-ENDIF
-IF (ALLOCATED(SrcParamData%EAOffBEdg)) THEN
-  i1_l = LBOUND(SrcParamData%EAOffBEdg,1)
-  i1_u = UBOUND(SrcParamData%EAOffBEdg,1)
-  i2_l = LBOUND(SrcParamData%EAOffBEdg,2)
-  i2_u = UBOUND(SrcParamData%EAOffBEdg,2)
-  IF (.NOT. ALLOCATED(DstParamData%EAOffBEdg)) THEN 
-    ALLOCATE(DstParamData%EAOffBEdg(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%EAOffBEdg.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
+  Int_BufSz   = Int_BufSz   + 1     ! QD2T allocated yes/no
+  IF ( ALLOCATED(InData%QD2T) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*1  ! QD2T upper/lower bounds for each dimension
+      Db_BufSz   = Db_BufSz   + SIZE(InData%QD2T)  ! QD2T
   END IF
-    DstParamData%EAOffBEdg = SrcParamData%EAOffBEdg
-ENDIF
-IF (ALLOCATED(SrcParamData%EAOffBFlp)) THEN
-  i1_l = LBOUND(SrcParamData%EAOffBFlp,1)
-  i1_u = UBOUND(SrcParamData%EAOffBFlp,1)
-  i2_l = LBOUND(SrcParamData%EAOffBFlp,2)
-  i2_u = UBOUND(SrcParamData%EAOffBFlp,2)
-  IF (.NOT. ALLOCATED(DstParamData%EAOffBFlp)) THEN 
-    ALLOCATE(DstParamData%EAOffBFlp(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%EAOffBFlp.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
+      Int_BufSz  = Int_BufSz  + 1  ! IgnoreMod
+      Re_BufSz   = Re_BufSz   + 1  ! LSSTrqLoss
+  Int_BufSz   = Int_BufSz   + 1     ! LinAccES allocated yes/no
+  IF ( ALLOCATED(InData%LinAccES) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*3  ! LinAccES upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%LinAccES)  ! LinAccES
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! AngAccEK allocated yes/no
+  IF ( ALLOCATED(InData%AngAccEK) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*3  ! AngAccEK upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%AngAccEK)  ! AngAccEK
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! LinAccET allocated yes/no
+  IF ( ALLOCATED(InData%LinAccET) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*2  ! LinAccET upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%LinAccET)  ! LinAccET
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! AngAccEF allocated yes/no
+  IF ( ALLOCATED(InData%AngAccEF) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*2  ! AngAccEF upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%AngAccEF)  ! AngAccEF
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! FrcS0B allocated yes/no
+  IF ( ALLOCATED(InData%FrcS0B) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*2  ! FrcS0B upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%FrcS0B)  ! FrcS0B
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! FTTower allocated yes/no
+  IF ( ALLOCATED(InData%FTTower) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*2  ! FTTower upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%FTTower)  ! FTTower
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! MFHydro allocated yes/no
+  IF ( ALLOCATED(InData%MFHydro) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*2  ! MFHydro upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%MFHydro)  ! MFHydro
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! MomH0B allocated yes/no
+  IF ( ALLOCATED(InData%MomH0B) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*2  ! MomH0B upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%MomH0B)  ! MomH0B
+  END IF
+      Int_BufSz   = Int_BufSz + 3  ! u_interp: size of buffers for each call to pack subtype
+      CALL ED_PackInput( Re_Buf, Db_Buf, Int_Buf, InData%u_interp, ErrStat2, ErrMsg2, .TRUE. ) ! u_interp 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf)) THEN ! u_interp
+         Re_BufSz  = Re_BufSz  + SIZE( Re_Buf  )
+         DEALLOCATE(Re_Buf)
+      END IF
+      IF(ALLOCATED(Db_Buf)) THEN ! u_interp
+         Db_BufSz  = Db_BufSz  + SIZE( Db_Buf  )
+         DEALLOCATE(Db_Buf)
+      END IF
+      IF(ALLOCATED(Int_Buf)) THEN ! u_interp
+         Int_BufSz = Int_BufSz + SIZE( Int_Buf )
+         DEALLOCATE(Int_Buf)
+      END IF
+      Int_BufSz   = Int_BufSz + 3  ! x_pred: size of buffers for each call to pack subtype
+      CALL ED_PackContState( Re_Buf, Db_Buf, Int_Buf, InData%x_pred, ErrStat2, ErrMsg2, .TRUE. ) ! x_pred 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf)) THEN ! x_pred
+         Re_BufSz  = Re_BufSz  + SIZE( Re_Buf  )
+         DEALLOCATE(Re_Buf)
+      END IF
+      IF(ALLOCATED(Db_Buf)) THEN ! x_pred
+         Db_BufSz  = Db_BufSz  + SIZE( Db_Buf  )
+         DEALLOCATE(Db_Buf)
+      END IF
+      IF(ALLOCATED(Int_Buf)) THEN ! x_pred
+         Int_BufSz = Int_BufSz + SIZE( Int_Buf )
+         DEALLOCATE(Int_Buf)
+      END IF
+      Int_BufSz   = Int_BufSz + 3  ! xdot: size of buffers for each call to pack subtype
+      CALL ED_PackContState( Re_Buf, Db_Buf, Int_Buf, InData%xdot, ErrStat2, ErrMsg2, .TRUE. ) ! xdot 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf)) THEN ! xdot
+         Re_BufSz  = Re_BufSz  + SIZE( Re_Buf  )
+         DEALLOCATE(Re_Buf)
+      END IF
+      IF(ALLOCATED(Db_Buf)) THEN ! xdot
+         Db_BufSz  = Db_BufSz  + SIZE( Db_Buf  )
+         DEALLOCATE(Db_Buf)
+      END IF
+      IF(ALLOCATED(Int_Buf)) THEN ! xdot
+         Int_BufSz = Int_BufSz + SIZE( Int_Buf )
+         DEALLOCATE(Int_Buf)
+      END IF
+  IF ( Re_BufSz  .GT. 0 ) THEN 
+     ALLOCATE( ReKiBuf(  Re_BufSz  ), STAT=ErrStat2 )
+     IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating ReKiBuf.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+     END IF
   END IF
-    DstParamData%EAOffBFlp = SrcParamData%EAOffBFlp
-ENDIF
-IF (ALLOCATED(SrcParamData%FStTunr)) THEN
-  i1_l = LBOUND(SrcParamData%FStTunr,1)
-  i1_u = UBOUND(SrcParamData%FStTunr,1)
-  i2_l = LBOUND(SrcParamData%FStTunr,2)
-  i2_u = UBOUND(SrcParamData%FStTunr,2)
-  IF (.NOT. ALLOCATED(DstParamData%FStTunr)) THEN 
-    ALLOCATE(DstParamData%FStTunr(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%FStTunr.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
+  IF ( Db_BufSz  .GT. 0 ) THEN 
+     ALLOCATE( DbKiBuf(  Db_BufSz  ), STAT=ErrStat2 )
+     IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating DbKiBuf.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+     END IF
   END IF
-    DstParamData%FStTunr = SrcParamData%FStTunr
-ENDIF
-IF (ALLOCATED(SrcParamData%InerBEdg)) THEN
-  i1_l = LBOUND(SrcParamData%InerBEdg,1)
-  i1_u = UBOUND(SrcParamData%InerBEdg,1)
-  i2_l = LBOUND(SrcParamData%InerBEdg,2)
-  i2_u = UBOUND(SrcParamData%InerBEdg,2)
-  IF (.NOT. ALLOCATED(DstParamData%InerBEdg)) THEN 
-    ALLOCATE(DstParamData%InerBEdg(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%InerBEdg.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
+  IF ( Int_BufSz  .GT. 0 ) THEN 
+     ALLOCATE( IntKiBuf(  Int_BufSz  ), STAT=ErrStat2 )
+     IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating IntKiBuf.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+     END IF
   END IF
-    DstParamData%InerBEdg = SrcParamData%InerBEdg
-ENDIF
-IF (ALLOCATED(SrcParamData%InerBFlp)) THEN
-  i1_l = LBOUND(SrcParamData%InerBFlp,1)
-  i1_u = UBOUND(SrcParamData%InerBFlp,1)
-  i2_l = LBOUND(SrcParamData%InerBFlp,2)
-  i2_u = UBOUND(SrcParamData%InerBFlp,2)
+  IF(OnlySize) RETURN ! return early if only trying to allocate buffers (not pack them)
+
+  Re_Xferred  = 1
+  Db_Xferred  = 1
+  Int_Xferred = 1
+
+      CALL ED_Packcoordsys( Re_Buf, Db_Buf, Int_Buf, InData%CoordSys, ErrStat2, ErrMsg2, OnlySize ) ! CoordSys 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Re_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Re_Buf) > 0) ReKiBuf( Re_Xferred:Re_Xferred+SIZE(Re_Buf)-1 ) = Re_Buf
+        Re_Xferred = Re_Xferred + SIZE(Re_Buf)
+        DEALLOCATE(Re_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      IF(ALLOCATED(Db_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Db_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Db_Buf) > 0) DbKiBuf( Db_Xferred:Db_Xferred+SIZE(Db_Buf)-1 ) = Db_Buf
+        Db_Xferred = Db_Xferred + SIZE(Db_Buf)
+        DEALLOCATE(Db_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      IF(ALLOCATED(Int_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Int_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Int_Buf) > 0) IntKiBuf( Int_Xferred:Int_Xferred+SIZE(Int_Buf)-1 ) = Int_Buf
+        Int_Xferred = Int_Xferred + SIZE(Int_Buf)
+        DEALLOCATE(Int_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      CALL ED_Packrthndside( Re_Buf, Db_Buf, Int_Buf, InData%RtHS, ErrStat2, ErrMsg2, OnlySize ) ! RtHS 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Re_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Re_Buf) > 0) ReKiBuf( Re_Xferred:Re_Xferred+SIZE(Re_Buf)-1 ) = Re_Buf
+        Re_Xferred = Re_Xferred + SIZE(Re_Buf)
+        DEALLOCATE(Re_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      IF(ALLOCATED(Db_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Db_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Db_Buf) > 0) DbKiBuf( Db_Xferred:Db_Xferred+SIZE(Db_Buf)-1 ) = Db_Buf
+        Db_Xferred = Db_Xferred + SIZE(Db_Buf)
+        DEALLOCATE(Db_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      IF(ALLOCATED(Int_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Int_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Int_Buf) > 0) IntKiBuf( Int_Xferred:Int_Xferred+SIZE(Int_Buf)-1 ) = Int_Buf
+        Int_Xferred = Int_Xferred + SIZE(Int_Buf)
+        DEALLOCATE(Int_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+  IF ( .NOT. ALLOCATED(InData%AllOuts) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%AllOuts,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%AllOuts,1)
+    Int_Xferred = Int_Xferred + 2
+
+      DO i1 = LBOUND(InData%AllOuts,1), UBOUND(InData%AllOuts,1)
+        ReKiBuf(Re_Xferred) = InData%AllOuts(i1)
+        Re_Xferred = Re_Xferred + 1
+      END DO
+  END IF
+  IF ( .NOT. ALLOCATED(InData%AugMat) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%AugMat,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%AugMat,1)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%AugMat,2)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%AugMat,2)
+    Int_Xferred = Int_Xferred + 2
+
+      DO i2 = LBOUND(InData%AugMat,2), UBOUND(InData%AugMat,2)
+        DO i1 = LBOUND(InData%AugMat,1), UBOUND(InData%AugMat,1)
+          DbKiBuf(Db_Xferred) = InData%AugMat(i1,i2)
+          Db_Xferred = Db_Xferred + 1
+        END DO
+      END DO
+  END IF
+  IF ( .NOT. ALLOCATED(InData%AugMat_factor) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%AugMat_factor,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%AugMat_factor,1)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%AugMat_factor,2)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%AugMat_factor,2)
+    Int_Xferred = Int_Xferred + 2
+
+      DO i2 = LBOUND(InData%AugMat_factor,2), UBOUND(InData%AugMat_factor,2)
+        DO i1 = LBOUND(InData%AugMat_factor,1), UBOUND(InData%AugMat_factor,1)
+          DbKiBuf(Db_Xferred) = InData%AugMat_factor(i1,i2)
+          Db_Xferred = Db_Xferred + 1
+        END DO
+      END DO
+  END IF
+  IF ( .NOT. ALLOCATED(InData%SolnVec) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%SolnVec,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%SolnVec,1)
+    Int_Xferred = Int_Xferred + 2
+
+      DO i1 = LBOUND(InData%SolnVec,1), UBOUND(InData%SolnVec,1)
+        DbKiBuf(Db_Xferred) = InData%SolnVec(i1)
+        Db_Xferred = Db_Xferred + 1
+      END DO
+  END IF
+  IF ( .NOT. ALLOCATED(InData%AugMat_pivot) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%AugMat_pivot,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%AugMat_pivot,1)
+    Int_Xferred = Int_Xferred + 2
+
+      DO i1 = LBOUND(InData%AugMat_pivot,1), UBOUND(InData%AugMat_pivot,1)
+        IntKiBuf(Int_Xferred) = InData%AugMat_pivot(i1)
+        Int_Xferred = Int_Xferred + 1
+      END DO
+  END IF
+  IF ( .NOT. ALLOCATED(InData%OgnlGeAzRo) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%OgnlGeAzRo,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%OgnlGeAzRo,1)
+    Int_Xferred = Int_Xferred + 2
+
+      DO i1 = LBOUND(InData%OgnlGeAzRo,1), UBOUND(InData%OgnlGeAzRo,1)
+        ReKiBuf(Re_Xferred) = InData%OgnlGeAzRo(i1)
+        Re_Xferred = Re_Xferred + 1
+      END DO
+  END IF
+  IF ( .NOT. ALLOCATED(InData%QD2T) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%QD2T,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%QD2T,1)
+    Int_Xferred = Int_Xferred + 2
+
+      DO i1 = LBOUND(InData%QD2T,1), UBOUND(InData%QD2T,1)
+        DbKiBuf(Db_Xferred) = InData%QD2T(i1)
+        Db_Xferred = Db_Xferred + 1
+      END DO
+  END IF
+    IntKiBuf(Int_Xferred) = TRANSFER(InData%IgnoreMod, IntKiBuf(1))
+    Int_Xferred = Int_Xferred + 1
+    ReKiBuf(Re_Xferred) = InData%LSSTrqLoss
+    Re_Xferred = Re_Xferred + 1
+  IF ( .NOT. ALLOCATED(InData%LinAccES) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%LinAccES,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%LinAccES,1)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%LinAccES,2)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%LinAccES,2)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%LinAccES,3)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%LinAccES,3)
+    Int_Xferred = Int_Xferred + 2
+
+      DO i3 = LBOUND(InData%LinAccES,3), UBOUND(InData%LinAccES,3)
+        DO i2 = LBOUND(InData%LinAccES,2), UBOUND(InData%LinAccES,2)
+          DO i1 = LBOUND(InData%LinAccES,1), UBOUND(InData%LinAccES,1)
+            ReKiBuf(Re_Xferred) = InData%LinAccES(i1,i2,i3)
+            Re_Xferred = Re_Xferred + 1
+          END DO
+        END DO
+      END DO
+  END IF
+  IF ( .NOT. ALLOCATED(InData%AngAccEK) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%AngAccEK,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%AngAccEK,1)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%AngAccEK,2)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%AngAccEK,2)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%AngAccEK,3)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%AngAccEK,3)
+    Int_Xferred = Int_Xferred + 2
+
+      DO i3 = LBOUND(InData%AngAccEK,3), UBOUND(InData%AngAccEK,3)
+        DO i2 = LBOUND(InData%AngAccEK,2), UBOUND(InData%AngAccEK,2)
+          DO i1 = LBOUND(InData%AngAccEK,1), UBOUND(InData%AngAccEK,1)
+            ReKiBuf(Re_Xferred) = InData%AngAccEK(i1,i2,i3)
+            Re_Xferred = Re_Xferred + 1
+          END DO
+        END DO
+      END DO
+  END IF
+  IF ( .NOT. ALLOCATED(InData%LinAccET) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%LinAccET,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%LinAccET,1)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%LinAccET,2)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%LinAccET,2)
+    Int_Xferred = Int_Xferred + 2
+
+      DO i2 = LBOUND(InData%LinAccET,2), UBOUND(InData%LinAccET,2)
+        DO i1 = LBOUND(InData%LinAccET,1), UBOUND(InData%LinAccET,1)
+          ReKiBuf(Re_Xferred) = InData%LinAccET(i1,i2)
+          Re_Xferred = Re_Xferred + 1
+        END DO
+      END DO
+  END IF
+  IF ( .NOT. ALLOCATED(InData%AngAccEF) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%AngAccEF,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%AngAccEF,1)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%AngAccEF,2)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%AngAccEF,2)
+    Int_Xferred = Int_Xferred + 2
+
+      DO i2 = LBOUND(InData%AngAccEF,2), UBOUND(InData%AngAccEF,2)
+        DO i1 = LBOUND(InData%AngAccEF,1), UBOUND(InData%AngAccEF,1)
+          ReKiBuf(Re_Xferred) = InData%AngAccEF(i1,i2)
+          Re_Xferred = Re_Xferred + 1
+        END DO
+      END DO
+  END IF
+  IF ( .NOT. ALLOCATED(InData%FrcS0B) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%FrcS0B,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%FrcS0B,1)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%FrcS0B,2)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%FrcS0B,2)
+    Int_Xferred = Int_Xferred + 2
+
+      DO i2 = LBOUND(InData%FrcS0B,2), UBOUND(InData%FrcS0B,2)
+        DO i1 = LBOUND(InData%FrcS0B,1), UBOUND(InData%FrcS0B,1)
+          ReKiBuf(Re_Xferred) = InData%FrcS0B(i1,i2)
+          Re_Xferred = Re_Xferred + 1
+        END DO
+      END DO
+  END IF
+  IF ( .NOT. ALLOCATED(InData%FTTower) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%FTTower,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%FTTower,1)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%FTTower,2)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%FTTower,2)
+    Int_Xferred = Int_Xferred + 2
+
+      DO i2 = LBOUND(InData%FTTower,2), UBOUND(InData%FTTower,2)
+        DO i1 = LBOUND(InData%FTTower,1), UBOUND(InData%FTTower,1)
+          ReKiBuf(Re_Xferred) = InData%FTTower(i1,i2)
+          Re_Xferred = Re_Xferred + 1
+        END DO
+      END DO
+  END IF
+  IF ( .NOT. ALLOCATED(InData%MFHydro) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%MFHydro,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%MFHydro,1)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%MFHydro,2)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%MFHydro,2)
+    Int_Xferred = Int_Xferred + 2
+
+      DO i2 = LBOUND(InData%MFHydro,2), UBOUND(InData%MFHydro,2)
+        DO i1 = LBOUND(InData%MFHydro,1), UBOUND(InData%MFHydro,1)
+          ReKiBuf(Re_Xferred) = InData%MFHydro(i1,i2)
+          Re_Xferred = Re_Xferred + 1
+        END DO
+      END DO
+  END IF
+  IF ( .NOT. ALLOCATED(InData%MomH0B) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%MomH0B,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%MomH0B,1)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%MomH0B,2)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%MomH0B,2)
+    Int_Xferred = Int_Xferred + 2
+
+      DO i2 = LBOUND(InData%MomH0B,2), UBOUND(InData%MomH0B,2)
+        DO i1 = LBOUND(InData%MomH0B,1), UBOUND(InData%MomH0B,1)
+          ReKiBuf(Re_Xferred) = InData%MomH0B(i1,i2)
+          Re_Xferred = Re_Xferred + 1
+        END DO
+      END DO
+  END IF
+      CALL ED_PackInput( Re_Buf, Db_Buf, Int_Buf, InData%u_interp, ErrStat2, ErrMsg2, OnlySize ) ! u_interp 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Re_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Re_Buf) > 0) ReKiBuf( Re_Xferred:Re_Xferred+SIZE(Re_Buf)-1 ) = Re_Buf
+        Re_Xferred = Re_Xferred + SIZE(Re_Buf)
+        DEALLOCATE(Re_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      IF(ALLOCATED(Db_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Db_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Db_Buf) > 0) DbKiBuf( Db_Xferred:Db_Xferred+SIZE(Db_Buf)-1 ) = Db_Buf
+        Db_Xferred = Db_Xferred + SIZE(Db_Buf)
+        DEALLOCATE(Db_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      IF(ALLOCATED(Int_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Int_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Int_Buf) > 0) IntKiBuf( Int_Xferred:Int_Xferred+SIZE(Int_Buf)-1 ) = Int_Buf
+        Int_Xferred = Int_Xferred + SIZE(Int_Buf)
+        DEALLOCATE(Int_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      CALL ED_PackContState( Re_Buf, Db_Buf, Int_Buf, InData%x_pred, ErrStat2, ErrMsg2, OnlySize ) ! x_pred 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Re_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Re_Buf) > 0) ReKiBuf( Re_Xferred:Re_Xferred+SIZE(Re_Buf)-1 ) = Re_Buf
+        Re_Xferred = Re_Xferred + SIZE(Re_Buf)
+        DEALLOCATE(Re_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      IF(ALLOCATED(Db_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Db_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Db_Buf) > 0) DbKiBuf( Db_Xferred:Db_Xferred+SIZE(Db_Buf)-1 ) = Db_Buf
+        Db_Xferred = Db_Xferred + SIZE(Db_Buf)
+        DEALLOCATE(Db_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      IF(ALLOCATED(Int_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Int_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Int_Buf) > 0) IntKiBuf( Int_Xferred:Int_Xferred+SIZE(Int_Buf)-1 ) = Int_Buf
+        Int_Xferred = Int_Xferred + SIZE(Int_Buf)
+        DEALLOCATE(Int_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      CALL ED_PackContState( Re_Buf, Db_Buf, Int_Buf, InData%xdot, ErrStat2, ErrMsg2, OnlySize ) ! xdot 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Re_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Re_Buf) > 0) ReKiBuf( Re_Xferred:Re_Xferred+SIZE(Re_Buf)-1 ) = Re_Buf
+        Re_Xferred = Re_Xferred + SIZE(Re_Buf)
+        DEALLOCATE(Re_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      IF(ALLOCATED(Db_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Db_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Db_Buf) > 0) DbKiBuf( Db_Xferred:Db_Xferred+SIZE(Db_Buf)-1 ) = Db_Buf
+        Db_Xferred = Db_Xferred + SIZE(Db_Buf)
+        DEALLOCATE(Db_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      IF(ALLOCATED(Int_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Int_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Int_Buf) > 0) IntKiBuf( Int_Xferred:Int_Xferred+SIZE(Int_Buf)-1 ) = Int_Buf
+        Int_Xferred = Int_Xferred + SIZE(Int_Buf)
+        DEALLOCATE(Int_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+ END SUBROUTINE ED_PackMisc
+
+ SUBROUTINE ED_UnPackMisc( ReKiBuf, DbKiBuf, IntKiBuf, Outdata, ErrStat, ErrMsg )
+  REAL(ReKi),      ALLOCATABLE, INTENT(IN   ) :: ReKiBuf(:)
+  REAL(DbKi),      ALLOCATABLE, INTENT(IN   ) :: DbKiBuf(:)
+  INTEGER(IntKi),  ALLOCATABLE, INTENT(IN   ) :: IntKiBuf(:)
+  TYPE(ED_MiscVarType), INTENT(INOUT) :: OutData
+  INTEGER(IntKi),  INTENT(  OUT) :: ErrStat
+  CHARACTER(*),    INTENT(  OUT) :: ErrMsg
+    ! Local variables
+  INTEGER(IntKi)                 :: Buf_size
+  INTEGER(IntKi)                 :: Re_Xferred
+  INTEGER(IntKi)                 :: Db_Xferred
+  INTEGER(IntKi)                 :: Int_Xferred
+  INTEGER(IntKi)                 :: i
+  INTEGER(IntKi)                 :: i1, i1_l, i1_u  !  bounds (upper/lower) for an array dimension 1
+  INTEGER(IntKi)                 :: i2, i2_l, i2_u  !  bounds (upper/lower) for an array dimension 2
+  INTEGER(IntKi)                 :: i3, i3_l, i3_u  !  bounds (upper/lower) for an array dimension 3
+  INTEGER(IntKi)                 :: ErrStat2
+  CHARACTER(ErrMsgLen)           :: ErrMsg2
+  CHARACTER(*), PARAMETER        :: RoutineName = 'ED_UnPackMisc'
+ ! buffers to store meshes, if any
+  REAL(ReKi),      ALLOCATABLE   :: Re_Buf(:)
+  REAL(DbKi),      ALLOCATABLE   :: Db_Buf(:)
+  INTEGER(IntKi),  ALLOCATABLE   :: Int_Buf(:)
+    !
+  ErrStat = ErrID_None
+  ErrMsg  = ""
+  Re_Xferred  = 1
+  Db_Xferred  = 1
+  Int_Xferred  = 1
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Re_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Re_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Re_Buf = ReKiBuf( Re_Xferred:Re_Xferred+Buf_size-1 )
+        Re_Xferred = Re_Xferred + Buf_size
+      END IF
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Db_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Db_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Db_Buf = DbKiBuf( Db_Xferred:Db_Xferred+Buf_size-1 )
+        Db_Xferred = Db_Xferred + Buf_size
+      END IF
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Int_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Int_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Int_Buf = IntKiBuf( Int_Xferred:Int_Xferred+Buf_size-1 )
+        Int_Xferred = Int_Xferred + Buf_size
+      END IF
+      CALL ED_Unpackcoordsys( Re_Buf, Db_Buf, Int_Buf, OutData%CoordSys, ErrStat2, ErrMsg2 ) ! CoordSys 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf )) DEALLOCATE(Re_Buf )
+      IF(ALLOCATED(Db_Buf )) DEALLOCATE(Db_Buf )
+      IF(ALLOCATED(Int_Buf)) DEALLOCATE(Int_Buf)
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Re_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Re_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Re_Buf = ReKiBuf( Re_Xferred:Re_Xferred+Buf_size-1 )
+        Re_Xferred = Re_Xferred + Buf_size
+      END IF
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Db_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Db_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Db_Buf = DbKiBuf( Db_Xferred:Db_Xferred+Buf_size-1 )
+        Db_Xferred = Db_Xferred + Buf_size
+      END IF
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Int_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Int_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Int_Buf = IntKiBuf( Int_Xferred:Int_Xferred+Buf_size-1 )
+        Int_Xferred = Int_Xferred + Buf_size
+      END IF
+      CALL ED_Unpackrthndside( Re_Buf, Db_Buf, Int_Buf, OutData%RtHS, ErrStat2, ErrMsg2 ) ! RtHS 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf )) DEALLOCATE(Re_Buf )
+      IF(ALLOCATED(Db_Buf )) DEALLOCATE(Db_Buf )
+      IF(ALLOCATED(Int_Buf)) DEALLOCATE(Int_Buf)
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! AllOuts not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%AllOuts)) DEALLOCATE(OutData%AllOuts)
+    ALLOCATE(OutData%AllOuts(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%AllOuts.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+      DO i1 = LBOUND(OutData%AllOuts,1), UBOUND(OutData%AllOuts,1)
+        OutData%AllOuts(i1) = ReKiBuf(Re_Xferred)
+        Re_Xferred = Re_Xferred + 1
+      END DO
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! AugMat not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%AugMat)) DEALLOCATE(OutData%AugMat)
+    ALLOCATE(OutData%AugMat(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%AugMat.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+      DO i2 = LBOUND(OutData%AugMat,2), UBOUND(OutData%AugMat,2)
+        DO i1 = LBOUND(OutData%AugMat,1), UBOUND(OutData%AugMat,1)
+          OutData%AugMat(i1,i2) = REAL(DbKiBuf(Db_Xferred), R8Ki)
+          Db_Xferred = Db_Xferred + 1
+        END DO
+      END DO
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! AugMat_factor not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%AugMat_factor)) DEALLOCATE(OutData%AugMat_factor)
+    ALLOCATE(OutData%AugMat_factor(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%AugMat_factor.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+      DO i2 = LBOUND(OutData%AugMat_factor,2), UBOUND(OutData%AugMat_factor,2)
+        DO i1 = LBOUND(OutData%AugMat_factor,1), UBOUND(OutData%AugMat_factor,1)
+          OutData%AugMat_factor(i1,i2) = REAL(DbKiBuf(Db_Xferred), R8Ki)
+          Db_Xferred = Db_Xferred + 1
+        END DO
+      END DO
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! SolnVec not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%SolnVec)) DEALLOCATE(OutData%SolnVec)
+    ALLOCATE(OutData%SolnVec(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%SolnVec.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+      DO i1 = LBOUND(OutData%SolnVec,1), UBOUND(OutData%SolnVec,1)
+        OutData%SolnVec(i1) = REAL(DbKiBuf(Db_Xferred), R8Ki)
+        Db_Xferred = Db_Xferred + 1
+      END DO
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! AugMat_pivot not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%AugMat_pivot)) DEALLOCATE(OutData%AugMat_pivot)
+    ALLOCATE(OutData%AugMat_pivot(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%AugMat_pivot.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+      DO i1 = LBOUND(OutData%AugMat_pivot,1), UBOUND(OutData%AugMat_pivot,1)
+        OutData%AugMat_pivot(i1) = IntKiBuf(Int_Xferred)
+        Int_Xferred = Int_Xferred + 1
+      END DO
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! OgnlGeAzRo not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%OgnlGeAzRo)) DEALLOCATE(OutData%OgnlGeAzRo)
+    ALLOCATE(OutData%OgnlGeAzRo(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%OgnlGeAzRo.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+      DO i1 = LBOUND(OutData%OgnlGeAzRo,1), UBOUND(OutData%OgnlGeAzRo,1)
+        OutData%OgnlGeAzRo(i1) = ReKiBuf(Re_Xferred)
+        Re_Xferred = Re_Xferred + 1
+      END DO
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! QD2T not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%QD2T)) DEALLOCATE(OutData%QD2T)
+    ALLOCATE(OutData%QD2T(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%QD2T.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+      DO i1 = LBOUND(OutData%QD2T,1), UBOUND(OutData%QD2T,1)
+        OutData%QD2T(i1) = REAL(DbKiBuf(Db_Xferred), R8Ki)
+        Db_Xferred = Db_Xferred + 1
+      END DO
+  END IF
+    OutData%IgnoreMod = TRANSFER(IntKiBuf(Int_Xferred), OutData%IgnoreMod)
+    Int_Xferred = Int_Xferred + 1
+    OutData%LSSTrqLoss = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! LinAccES not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i3_l = IntKiBuf( Int_Xferred    )
+    i3_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%LinAccES)) DEALLOCATE(OutData%LinAccES)
+    ALLOCATE(OutData%LinAccES(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%LinAccES.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+      DO i3 = LBOUND(OutData%LinAccES,3), UBOUND(OutData%LinAccES,3)
+        DO i2 = LBOUND(OutData%LinAccES,2), UBOUND(OutData%LinAccES,2)
+          DO i1 = LBOUND(OutData%LinAccES,1), UBOUND(OutData%LinAccES,1)
+            OutData%LinAccES(i1,i2,i3) = ReKiBuf(Re_Xferred)
+            Re_Xferred = Re_Xferred + 1
+          END DO
+        END DO
+      END DO
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! AngAccEK not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i3_l = IntKiBuf( Int_Xferred    )
+    i3_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%AngAccEK)) DEALLOCATE(OutData%AngAccEK)
+    ALLOCATE(OutData%AngAccEK(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%AngAccEK.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+      DO i3 = LBOUND(OutData%AngAccEK,3), UBOUND(OutData%AngAccEK,3)
+        DO i2 = LBOUND(OutData%AngAccEK,2), UBOUND(OutData%AngAccEK,2)
+          DO i1 = LBOUND(OutData%AngAccEK,1), UBOUND(OutData%AngAccEK,1)
+            OutData%AngAccEK(i1,i2,i3) = ReKiBuf(Re_Xferred)
+            Re_Xferred = Re_Xferred + 1
+          END DO
+        END DO
+      END DO
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! LinAccET not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%LinAccET)) DEALLOCATE(OutData%LinAccET)
+    ALLOCATE(OutData%LinAccET(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%LinAccET.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+      DO i2 = LBOUND(OutData%LinAccET,2), UBOUND(OutData%LinAccET,2)
+        DO i1 = LBOUND(OutData%LinAccET,1), UBOUND(OutData%LinAccET,1)
+          OutData%LinAccET(i1,i2) = ReKiBuf(Re_Xferred)
+          Re_Xferred = Re_Xferred + 1
+        END DO
+      END DO
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! AngAccEF not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%AngAccEF)) DEALLOCATE(OutData%AngAccEF)
+    ALLOCATE(OutData%AngAccEF(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%AngAccEF.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+      DO i2 = LBOUND(OutData%AngAccEF,2), UBOUND(OutData%AngAccEF,2)
+        DO i1 = LBOUND(OutData%AngAccEF,1), UBOUND(OutData%AngAccEF,1)
+          OutData%AngAccEF(i1,i2) = ReKiBuf(Re_Xferred)
+          Re_Xferred = Re_Xferred + 1
+        END DO
+      END DO
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! FrcS0B not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%FrcS0B)) DEALLOCATE(OutData%FrcS0B)
+    ALLOCATE(OutData%FrcS0B(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%FrcS0B.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+      DO i2 = LBOUND(OutData%FrcS0B,2), UBOUND(OutData%FrcS0B,2)
+        DO i1 = LBOUND(OutData%FrcS0B,1), UBOUND(OutData%FrcS0B,1)
+          OutData%FrcS0B(i1,i2) = ReKiBuf(Re_Xferred)
+          Re_Xferred = Re_Xferred + 1
+        END DO
+      END DO
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! FTTower not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%FTTower)) DEALLOCATE(OutData%FTTower)
+    ALLOCATE(OutData%FTTower(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%FTTower.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+      DO i2 = LBOUND(OutData%FTTower,2), UBOUND(OutData%FTTower,2)
+        DO i1 = LBOUND(OutData%FTTower,1), UBOUND(OutData%FTTower,1)
+          OutData%FTTower(i1,i2) = ReKiBuf(Re_Xferred)
+          Re_Xferred = Re_Xferred + 1
+        END DO
+      END DO
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! MFHydro not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%MFHydro)) DEALLOCATE(OutData%MFHydro)
+    ALLOCATE(OutData%MFHydro(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%MFHydro.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+      DO i2 = LBOUND(OutData%MFHydro,2), UBOUND(OutData%MFHydro,2)
+        DO i1 = LBOUND(OutData%MFHydro,1), UBOUND(OutData%MFHydro,1)
+          OutData%MFHydro(i1,i2) = ReKiBuf(Re_Xferred)
+          Re_Xferred = Re_Xferred + 1
+        END DO
+      END DO
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! MomH0B not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%MomH0B)) DEALLOCATE(OutData%MomH0B)
+    ALLOCATE(OutData%MomH0B(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%MomH0B.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+      DO i2 = LBOUND(OutData%MomH0B,2), UBOUND(OutData%MomH0B,2)
+        DO i1 = LBOUND(OutData%MomH0B,1), UBOUND(OutData%MomH0B,1)
+          OutData%MomH0B(i1,i2) = ReKiBuf(Re_Xferred)
+          Re_Xferred = Re_Xferred + 1
+        END DO
+      END DO
+  END IF
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Re_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Re_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Re_Buf = ReKiBuf( Re_Xferred:Re_Xferred+Buf_size-1 )
+        Re_Xferred = Re_Xferred + Buf_size
+      END IF
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Db_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Db_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Db_Buf = DbKiBuf( Db_Xferred:Db_Xferred+Buf_size-1 )
+        Db_Xferred = Db_Xferred + Buf_size
+      END IF
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Int_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Int_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Int_Buf = IntKiBuf( Int_Xferred:Int_Xferred+Buf_size-1 )
+        Int_Xferred = Int_Xferred + Buf_size
+      END IF
+      CALL ED_UnpackInput( Re_Buf, Db_Buf, Int_Buf, OutData%u_interp, ErrStat2, ErrMsg2 ) ! u_interp 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf )) DEALLOCATE(Re_Buf )
+      IF(ALLOCATED(Db_Buf )) DEALLOCATE(Db_Buf )
+      IF(ALLOCATED(Int_Buf)) DEALLOCATE(Int_Buf)
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Re_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Re_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Re_Buf = ReKiBuf( Re_Xferred:Re_Xferred+Buf_size-1 )
+        Re_Xferred = Re_Xferred + Buf_size
+      END IF
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Db_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Db_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Db_Buf = DbKiBuf( Db_Xferred:Db_Xferred+Buf_size-1 )
+        Db_Xferred = Db_Xferred + Buf_size
+      END IF
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Int_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Int_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Int_Buf = IntKiBuf( Int_Xferred:Int_Xferred+Buf_size-1 )
+        Int_Xferred = Int_Xferred + Buf_size
+      END IF
+      CALL ED_UnpackContState( Re_Buf, Db_Buf, Int_Buf, OutData%x_pred, ErrStat2, ErrMsg2 ) ! x_pred 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf )) DEALLOCATE(Re_Buf )
+      IF(ALLOCATED(Db_Buf )) DEALLOCATE(Db_Buf )
+      IF(ALLOCATED(Int_Buf)) DEALLOCATE(Int_Buf)
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Re_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Re_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Re_Buf = ReKiBuf( Re_Xferred:Re_Xferred+Buf_size-1 )
+        Re_Xferred = Re_Xferred + Buf_size
+      END IF
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Db_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Db_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Db_Buf = DbKiBuf( Db_Xferred:Db_Xferred+Buf_size-1 )
+        Db_Xferred = Db_Xferred + Buf_size
+      END IF
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Int_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Int_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Int_Buf = IntKiBuf( Int_Xferred:Int_Xferred+Buf_size-1 )
+        Int_Xferred = Int_Xferred + Buf_size
+      END IF
+      CALL ED_UnpackContState( Re_Buf, Db_Buf, Int_Buf, OutData%xdot, ErrStat2, ErrMsg2 ) ! xdot 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf )) DEALLOCATE(Re_Buf )
+      IF(ALLOCATED(Db_Buf )) DEALLOCATE(Db_Buf )
+      IF(ALLOCATED(Int_Buf)) DEALLOCATE(Int_Buf)
+ END SUBROUTINE ED_UnPackMisc
+
+ SUBROUTINE ED_CopyParam( SrcParamData, DstParamData, CtrlCode, ErrStat, ErrMsg )
+   TYPE(ED_ParameterType), INTENT(IN) :: SrcParamData
+   TYPE(ED_ParameterType), INTENT(INOUT) :: DstParamData
+   INTEGER(IntKi),  INTENT(IN   ) :: CtrlCode
+   INTEGER(IntKi),  INTENT(  OUT) :: ErrStat
+   CHARACTER(*),    INTENT(  OUT) :: ErrMsg
+! Local 
+   INTEGER(IntKi)                 :: i,j,k
+   INTEGER(IntKi)                 :: i1, i1_l, i1_u  !  bounds (upper/lower) for an array dimension 1
+   INTEGER(IntKi)                 :: i2, i2_l, i2_u  !  bounds (upper/lower) for an array dimension 2
+   INTEGER(IntKi)                 :: i3, i3_l, i3_u  !  bounds (upper/lower) for an array dimension 3
+   INTEGER(IntKi)                 :: i4, i4_l, i4_u  !  bounds (upper/lower) for an array dimension 4
+   INTEGER(IntKi)                 :: i5, i5_l, i5_u  !  bounds (upper/lower) for an array dimension 5
+   INTEGER(IntKi)                 :: ErrStat2
+   CHARACTER(ErrMsgLen)           :: ErrMsg2
+   CHARACTER(*), PARAMETER        :: RoutineName = 'ED_CopyParam'
+! 
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+    DstParamData%DT = SrcParamData%DT
+    DstParamData%DT24 = SrcParamData%DT24
+    DstParamData%BldNodes = SrcParamData%BldNodes
+    DstParamData%TipNode = SrcParamData%TipNode
+    DstParamData%NDOF = SrcParamData%NDOF
+    DstParamData%TwoPiNB = SrcParamData%TwoPiNB
+    DstParamData%NAug = SrcParamData%NAug
+    DstParamData%NPH = SrcParamData%NPH
+IF (ALLOCATED(SrcParamData%PH)) THEN
+  i1_l = LBOUND(SrcParamData%PH,1)
+  i1_u = UBOUND(SrcParamData%PH,1)
+  IF (.NOT. ALLOCATED(DstParamData%PH)) THEN 
+    ALLOCATE(DstParamData%PH(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%PH.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%PH = SrcParamData%PH
+ENDIF
+    DstParamData%NPM = SrcParamData%NPM
+IF (ALLOCATED(SrcParamData%PM)) THEN
+  i1_l = LBOUND(SrcParamData%PM,1)
+  i1_u = UBOUND(SrcParamData%PM,1)
+  i2_l = LBOUND(SrcParamData%PM,2)
+  i2_u = UBOUND(SrcParamData%PM,2)
+  IF (.NOT. ALLOCATED(DstParamData%PM)) THEN 
+    ALLOCATE(DstParamData%PM(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%PM.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%PM = SrcParamData%PM
+ENDIF
+IF (ALLOCATED(SrcParamData%DOF_Flag)) THEN
+  i1_l = LBOUND(SrcParamData%DOF_Flag,1)
+  i1_u = UBOUND(SrcParamData%DOF_Flag,1)
+  IF (.NOT. ALLOCATED(DstParamData%DOF_Flag)) THEN 
+    ALLOCATE(DstParamData%DOF_Flag(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%DOF_Flag.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%DOF_Flag = SrcParamData%DOF_Flag
+ENDIF
+IF (ALLOCATED(SrcParamData%DOF_Desc)) THEN
+  i1_l = LBOUND(SrcParamData%DOF_Desc,1)
+  i1_u = UBOUND(SrcParamData%DOF_Desc,1)
+  IF (.NOT. ALLOCATED(DstParamData%DOF_Desc)) THEN 
+    ALLOCATE(DstParamData%DOF_Desc(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%DOF_Desc.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%DOF_Desc = SrcParamData%DOF_Desc
+ENDIF
+      CALL ED_Copyactivedofs( SrcParamData%DOFs, DstParamData%DOFs, CtrlCode, ErrStat2, ErrMsg2 )
+         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg,RoutineName)
+         IF (ErrStat>=AbortErrLev) RETURN
+    DstParamData%NumOuts = SrcParamData%NumOuts
+    DstParamData%OutFmt = SrcParamData%OutFmt
+    DstParamData%NBlGages = SrcParamData%NBlGages
+    DstParamData%NTwGages = SrcParamData%NTwGages
+IF (ALLOCATED(SrcParamData%OutParam)) THEN
+  i1_l = LBOUND(SrcParamData%OutParam,1)
+  i1_u = UBOUND(SrcParamData%OutParam,1)
+  IF (.NOT. ALLOCATED(DstParamData%OutParam)) THEN 
+    ALLOCATE(DstParamData%OutParam(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%OutParam.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DO i1 = LBOUND(SrcParamData%OutParam,1), UBOUND(SrcParamData%OutParam,1)
+      CALL NWTC_Library_Copyoutparmtype( SrcParamData%OutParam(i1), DstParamData%OutParam(i1), CtrlCode, ErrStat2, ErrMsg2 )
+         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg,RoutineName)
+         IF (ErrStat>=AbortErrLev) RETURN
+    ENDDO
+ENDIF
+    DstParamData%Delim = SrcParamData%Delim
+    DstParamData%AvgNrmTpRd = SrcParamData%AvgNrmTpRd
+    DstParamData%AzimB1Up = SrcParamData%AzimB1Up
+    DstParamData%CosDel3 = SrcParamData%CosDel3
+IF (ALLOCATED(SrcParamData%CosPreC)) THEN
+  i1_l = LBOUND(SrcParamData%CosPreC,1)
+  i1_u = UBOUND(SrcParamData%CosPreC,1)
+  IF (.NOT. ALLOCATED(DstParamData%CosPreC)) THEN 
+    ALLOCATE(DstParamData%CosPreC(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%CosPreC.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%CosPreC = SrcParamData%CosPreC
+ENDIF
+    DstParamData%CRFrlSkew = SrcParamData%CRFrlSkew
+    DstParamData%CRFrlSkw2 = SrcParamData%CRFrlSkw2
+    DstParamData%CRFrlTilt = SrcParamData%CRFrlTilt
+    DstParamData%CRFrlTlt2 = SrcParamData%CRFrlTlt2
+    DstParamData%CShftSkew = SrcParamData%CShftSkew
+    DstParamData%CShftTilt = SrcParamData%CShftTilt
+    DstParamData%CSRFrlSkw = SrcParamData%CSRFrlSkw
+    DstParamData%CSRFrlTlt = SrcParamData%CSRFrlTlt
+    DstParamData%CSTFrlSkw = SrcParamData%CSTFrlSkw
+    DstParamData%CSTFrlTlt = SrcParamData%CSTFrlTlt
+    DstParamData%CTFinBank = SrcParamData%CTFinBank
+    DstParamData%CTFinSkew = SrcParamData%CTFinSkew
+    DstParamData%CTFinTilt = SrcParamData%CTFinTilt
+    DstParamData%CTFrlSkew = SrcParamData%CTFrlSkew
+    DstParamData%CTFrlSkw2 = SrcParamData%CTFrlSkw2
+    DstParamData%CTFrlTilt = SrcParamData%CTFrlTilt
+    DstParamData%CTFrlTlt2 = SrcParamData%CTFrlTlt2
+    DstParamData%HubHt = SrcParamData%HubHt
+    DstParamData%HubCM = SrcParamData%HubCM
+    DstParamData%HubRad = SrcParamData%HubRad
+    DstParamData%NacCMxn = SrcParamData%NacCMxn
+    DstParamData%NacCMyn = SrcParamData%NacCMyn
+    DstParamData%NacCMzn = SrcParamData%NacCMzn
+    DstParamData%OverHang = SrcParamData%OverHang
+    DstParamData%ProjArea = SrcParamData%ProjArea
+    DstParamData%PtfmRefzt = SrcParamData%PtfmRefzt
+    DstParamData%RefTwrHt = SrcParamData%RefTwrHt
+    DstParamData%RFrlPntxn = SrcParamData%RFrlPntxn
+    DstParamData%RFrlPntyn = SrcParamData%RFrlPntyn
+    DstParamData%RFrlPntzn = SrcParamData%RFrlPntzn
+    DstParamData%rVDxn = SrcParamData%rVDxn
+    DstParamData%rVDyn = SrcParamData%rVDyn
+    DstParamData%rVDzn = SrcParamData%rVDzn
+    DstParamData%rVIMUxn = SrcParamData%rVIMUxn
+    DstParamData%rVIMUyn = SrcParamData%rVIMUyn
+    DstParamData%rVIMUzn = SrcParamData%rVIMUzn
+    DstParamData%rVPxn = SrcParamData%rVPxn
+    DstParamData%rVPyn = SrcParamData%rVPyn
+    DstParamData%rVPzn = SrcParamData%rVPzn
+    DstParamData%rWIxn = SrcParamData%rWIxn
+    DstParamData%rWIyn = SrcParamData%rWIyn
+    DstParamData%rWIzn = SrcParamData%rWIzn
+    DstParamData%rWJxn = SrcParamData%rWJxn
+    DstParamData%rWJyn = SrcParamData%rWJyn
+    DstParamData%rWJzn = SrcParamData%rWJzn
+    DstParamData%rWKxn = SrcParamData%rWKxn
+    DstParamData%rWKyn = SrcParamData%rWKyn
+    DstParamData%rWKzn = SrcParamData%rWKzn
+    DstParamData%rZT0zt = SrcParamData%rZT0zt
+    DstParamData%rZYzt = SrcParamData%rZYzt
+    DstParamData%SinDel3 = SrcParamData%SinDel3
+IF (ALLOCATED(SrcParamData%SinPreC)) THEN
+  i1_l = LBOUND(SrcParamData%SinPreC,1)
+  i1_u = UBOUND(SrcParamData%SinPreC,1)
+  IF (.NOT. ALLOCATED(DstParamData%SinPreC)) THEN 
+    ALLOCATE(DstParamData%SinPreC(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%SinPreC.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%SinPreC = SrcParamData%SinPreC
+ENDIF
+    DstParamData%SRFrlSkew = SrcParamData%SRFrlSkew
+    DstParamData%SRFrlSkw2 = SrcParamData%SRFrlSkw2
+    DstParamData%SRFrlTilt = SrcParamData%SRFrlTilt
+    DstParamData%SRFrlTlt2 = SrcParamData%SRFrlTlt2
+    DstParamData%SShftSkew = SrcParamData%SShftSkew
+    DstParamData%SShftTilt = SrcParamData%SShftTilt
+    DstParamData%STFinBank = SrcParamData%STFinBank
+    DstParamData%STFinSkew = SrcParamData%STFinSkew
+    DstParamData%STFinTilt = SrcParamData%STFinTilt
+    DstParamData%STFrlSkew = SrcParamData%STFrlSkew
+    DstParamData%STFrlSkw2 = SrcParamData%STFrlSkw2
+    DstParamData%STFrlTilt = SrcParamData%STFrlTilt
+    DstParamData%STFrlTlt2 = SrcParamData%STFrlTlt2
+    DstParamData%TFrlPntxn = SrcParamData%TFrlPntxn
+    DstParamData%TFrlPntyn = SrcParamData%TFrlPntyn
+    DstParamData%TFrlPntzn = SrcParamData%TFrlPntzn
+    DstParamData%TipRad = SrcParamData%TipRad
+    DstParamData%TowerHt = SrcParamData%TowerHt
+    DstParamData%TowerBsHt = SrcParamData%TowerBsHt
+    DstParamData%UndSling = SrcParamData%UndSling
+    DstParamData%NumBl = SrcParamData%NumBl
+IF (ALLOCATED(SrcParamData%AxRedTFA)) THEN
+  i1_l = LBOUND(SrcParamData%AxRedTFA,1)
+  i1_u = UBOUND(SrcParamData%AxRedTFA,1)
+  i2_l = LBOUND(SrcParamData%AxRedTFA,2)
+  i2_u = UBOUND(SrcParamData%AxRedTFA,2)
+  i3_l = LBOUND(SrcParamData%AxRedTFA,3)
+  i3_u = UBOUND(SrcParamData%AxRedTFA,3)
+  IF (.NOT. ALLOCATED(DstParamData%AxRedTFA)) THEN 
+    ALLOCATE(DstParamData%AxRedTFA(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%AxRedTFA.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%AxRedTFA = SrcParamData%AxRedTFA
+ENDIF
+IF (ALLOCATED(SrcParamData%AxRedTSS)) THEN
+  i1_l = LBOUND(SrcParamData%AxRedTSS,1)
+  i1_u = UBOUND(SrcParamData%AxRedTSS,1)
+  i2_l = LBOUND(SrcParamData%AxRedTSS,2)
+  i2_u = UBOUND(SrcParamData%AxRedTSS,2)
+  i3_l = LBOUND(SrcParamData%AxRedTSS,3)
+  i3_u = UBOUND(SrcParamData%AxRedTSS,3)
+  IF (.NOT. ALLOCATED(DstParamData%AxRedTSS)) THEN 
+    ALLOCATE(DstParamData%AxRedTSS(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%AxRedTSS.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%AxRedTSS = SrcParamData%AxRedTSS
+ENDIF
+    DstParamData%CTFA = SrcParamData%CTFA
+    DstParamData%CTSS = SrcParamData%CTSS
+IF (ALLOCATED(SrcParamData%DHNodes)) THEN
+  i1_l = LBOUND(SrcParamData%DHNodes,1)
+  i1_u = UBOUND(SrcParamData%DHNodes,1)
+  IF (.NOT. ALLOCATED(DstParamData%DHNodes)) THEN 
+    ALLOCATE(DstParamData%DHNodes(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%DHNodes.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%DHNodes = SrcParamData%DHNodes
+ENDIF
+IF (ALLOCATED(SrcParamData%HNodes)) THEN
+  i1_l = LBOUND(SrcParamData%HNodes,1)
+  i1_u = UBOUND(SrcParamData%HNodes,1)
+  IF (.NOT. ALLOCATED(DstParamData%HNodes)) THEN 
+    ALLOCATE(DstParamData%HNodes(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%HNodes.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%HNodes = SrcParamData%HNodes
+ENDIF
+IF (ALLOCATED(SrcParamData%HNodesNorm)) THEN
+  i1_l = LBOUND(SrcParamData%HNodesNorm,1)
+  i1_u = UBOUND(SrcParamData%HNodesNorm,1)
+  IF (.NOT. ALLOCATED(DstParamData%HNodesNorm)) THEN 
+    ALLOCATE(DstParamData%HNodesNorm(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%HNodesNorm.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%HNodesNorm = SrcParamData%HNodesNorm
+ENDIF
+    DstParamData%KTFA = SrcParamData%KTFA
+    DstParamData%KTSS = SrcParamData%KTSS
+IF (ALLOCATED(SrcParamData%MassT)) THEN
+  i1_l = LBOUND(SrcParamData%MassT,1)
+  i1_u = UBOUND(SrcParamData%MassT,1)
+  IF (.NOT. ALLOCATED(DstParamData%MassT)) THEN 
+    ALLOCATE(DstParamData%MassT(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%MassT.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%MassT = SrcParamData%MassT
+ENDIF
+IF (ALLOCATED(SrcParamData%StiffTSS)) THEN
+  i1_l = LBOUND(SrcParamData%StiffTSS,1)
+  i1_u = UBOUND(SrcParamData%StiffTSS,1)
+  IF (.NOT. ALLOCATED(DstParamData%StiffTSS)) THEN 
+    ALLOCATE(DstParamData%StiffTSS(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%StiffTSS.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%StiffTSS = SrcParamData%StiffTSS
+ENDIF
+IF (ALLOCATED(SrcParamData%TwrFASF)) THEN
+  i1_l = LBOUND(SrcParamData%TwrFASF,1)
+  i1_u = UBOUND(SrcParamData%TwrFASF,1)
+  i2_l = LBOUND(SrcParamData%TwrFASF,2)
+  i2_u = UBOUND(SrcParamData%TwrFASF,2)
+  i3_l = LBOUND(SrcParamData%TwrFASF,3)
+  i3_u = UBOUND(SrcParamData%TwrFASF,3)
+  IF (.NOT. ALLOCATED(DstParamData%TwrFASF)) THEN 
+    ALLOCATE(DstParamData%TwrFASF(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%TwrFASF.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%TwrFASF = SrcParamData%TwrFASF
+ENDIF
+    DstParamData%TwrFlexL = SrcParamData%TwrFlexL
+IF (ALLOCATED(SrcParamData%TwrSSSF)) THEN
+  i1_l = LBOUND(SrcParamData%TwrSSSF,1)
+  i1_u = UBOUND(SrcParamData%TwrSSSF,1)
+  i2_l = LBOUND(SrcParamData%TwrSSSF,2)
+  i2_u = UBOUND(SrcParamData%TwrSSSF,2)
+  i3_l = LBOUND(SrcParamData%TwrSSSF,3)
+  i3_u = UBOUND(SrcParamData%TwrSSSF,3)
+  IF (.NOT. ALLOCATED(DstParamData%TwrSSSF)) THEN 
+    ALLOCATE(DstParamData%TwrSSSF(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%TwrSSSF.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%TwrSSSF = SrcParamData%TwrSSSF
+ENDIF
+    DstParamData%TTopNode = SrcParamData%TTopNode
+    DstParamData%TwrNodes = SrcParamData%TwrNodes
+IF (ALLOCATED(SrcParamData%InerTFA)) THEN
+  i1_l = LBOUND(SrcParamData%InerTFA,1)
+  i1_u = UBOUND(SrcParamData%InerTFA,1)
+  IF (.NOT. ALLOCATED(DstParamData%InerTFA)) THEN 
+    ALLOCATE(DstParamData%InerTFA(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%InerTFA.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%InerTFA = SrcParamData%InerTFA
+ENDIF
+IF (ALLOCATED(SrcParamData%InerTSS)) THEN
+  i1_l = LBOUND(SrcParamData%InerTSS,1)
+  i1_u = UBOUND(SrcParamData%InerTSS,1)
+  IF (.NOT. ALLOCATED(DstParamData%InerTSS)) THEN 
+    ALLOCATE(DstParamData%InerTSS(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%InerTSS.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%InerTSS = SrcParamData%InerTSS
+ENDIF
+IF (ALLOCATED(SrcParamData%StiffTGJ)) THEN
+  i1_l = LBOUND(SrcParamData%StiffTGJ,1)
+  i1_u = UBOUND(SrcParamData%StiffTGJ,1)
+  IF (.NOT. ALLOCATED(DstParamData%StiffTGJ)) THEN 
+    ALLOCATE(DstParamData%StiffTGJ(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%StiffTGJ.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%StiffTGJ = SrcParamData%StiffTGJ
+ENDIF
+IF (ALLOCATED(SrcParamData%StiffTEA)) THEN
+  i1_l = LBOUND(SrcParamData%StiffTEA,1)
+  i1_u = UBOUND(SrcParamData%StiffTEA,1)
+  IF (.NOT. ALLOCATED(DstParamData%StiffTEA)) THEN 
+    ALLOCATE(DstParamData%StiffTEA(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%StiffTEA.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%StiffTEA = SrcParamData%StiffTEA
+ENDIF
+IF (ALLOCATED(SrcParamData%StiffTFA)) THEN
+  i1_l = LBOUND(SrcParamData%StiffTFA,1)
+  i1_u = UBOUND(SrcParamData%StiffTFA,1)
+  IF (.NOT. ALLOCATED(DstParamData%StiffTFA)) THEN 
+    ALLOCATE(DstParamData%StiffTFA(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%StiffTFA.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%StiffTFA = SrcParamData%StiffTFA
+ENDIF
+IF (ALLOCATED(SrcParamData%cgOffTFA)) THEN
+  i1_l = LBOUND(SrcParamData%cgOffTFA,1)
+  i1_u = UBOUND(SrcParamData%cgOffTFA,1)
+  IF (.NOT. ALLOCATED(DstParamData%cgOffTFA)) THEN 
+    ALLOCATE(DstParamData%cgOffTFA(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%cgOffTFA.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%cgOffTFA = SrcParamData%cgOffTFA
+ENDIF
+IF (ALLOCATED(SrcParamData%cgOffTSS)) THEN
+  i1_l = LBOUND(SrcParamData%cgOffTSS,1)
+  i1_u = UBOUND(SrcParamData%cgOffTSS,1)
+  IF (.NOT. ALLOCATED(DstParamData%cgOffTSS)) THEN 
+    ALLOCATE(DstParamData%cgOffTSS(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%cgOffTSS.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%cgOffTSS = SrcParamData%cgOffTSS
+ENDIF
+    DstParamData%AtfaIner = SrcParamData%AtfaIner
+IF (ALLOCATED(SrcParamData%BldCG)) THEN
+  i1_l = LBOUND(SrcParamData%BldCG,1)
+  i1_u = UBOUND(SrcParamData%BldCG,1)
+  IF (.NOT. ALLOCATED(DstParamData%BldCG)) THEN 
+    ALLOCATE(DstParamData%BldCG(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%BldCG.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%BldCG = SrcParamData%BldCG
+ENDIF
+IF (ALLOCATED(SrcParamData%BldMass)) THEN
+  i1_l = LBOUND(SrcParamData%BldMass,1)
+  i1_u = UBOUND(SrcParamData%BldMass,1)
+  IF (.NOT. ALLOCATED(DstParamData%BldMass)) THEN 
+    ALLOCATE(DstParamData%BldMass(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%BldMass.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%BldMass = SrcParamData%BldMass
+ENDIF
+    DstParamData%BoomMass = SrcParamData%BoomMass
+IF (ALLOCATED(SrcParamData%FirstMom)) THEN
+  i1_l = LBOUND(SrcParamData%FirstMom,1)
+  i1_u = UBOUND(SrcParamData%FirstMom,1)
+  IF (.NOT. ALLOCATED(DstParamData%FirstMom)) THEN 
+    ALLOCATE(DstParamData%FirstMom(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%FirstMom.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%FirstMom = SrcParamData%FirstMom
+ENDIF
+    DstParamData%GenIner = SrcParamData%GenIner
+    DstParamData%Hubg1Iner = SrcParamData%Hubg1Iner
+    DstParamData%Hubg2Iner = SrcParamData%Hubg2Iner
+    DstParamData%HubMass = SrcParamData%HubMass
+    DstParamData%Nacd2Iner = SrcParamData%Nacd2Iner
+    DstParamData%NacMass = SrcParamData%NacMass
+    DstParamData%PtfmMass = SrcParamData%PtfmMass
+    DstParamData%PtfmPIner = SrcParamData%PtfmPIner
+    DstParamData%PtfmRIner = SrcParamData%PtfmRIner
+    DstParamData%PtfmYIner = SrcParamData%PtfmYIner
+    DstParamData%RFrlMass = SrcParamData%RFrlMass
+    DstParamData%RotIner = SrcParamData%RotIner
+    DstParamData%RotMass = SrcParamData%RotMass
+    DstParamData%RrfaIner = SrcParamData%RrfaIner
+IF (ALLOCATED(SrcParamData%SecondMom)) THEN
+  i1_l = LBOUND(SrcParamData%SecondMom,1)
+  i1_u = UBOUND(SrcParamData%SecondMom,1)
+  IF (.NOT. ALLOCATED(DstParamData%SecondMom)) THEN 
+    ALLOCATE(DstParamData%SecondMom(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%SecondMom.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%SecondMom = SrcParamData%SecondMom
+ENDIF
+    DstParamData%TFinMass = SrcParamData%TFinMass
+    DstParamData%TFrlIner = SrcParamData%TFrlIner
+IF (ALLOCATED(SrcParamData%TipMass)) THEN
+  i1_l = LBOUND(SrcParamData%TipMass,1)
+  i1_u = UBOUND(SrcParamData%TipMass,1)
+  IF (.NOT. ALLOCATED(DstParamData%TipMass)) THEN 
+    ALLOCATE(DstParamData%TipMass(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%TipMass.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%TipMass = SrcParamData%TipMass
+ENDIF
+    DstParamData%TurbMass = SrcParamData%TurbMass
+    DstParamData%TwrMass = SrcParamData%TwrMass
+    DstParamData%TwrTpMass = SrcParamData%TwrTpMass
+    DstParamData%YawBrMass = SrcParamData%YawBrMass
+    DstParamData%Gravity = SrcParamData%Gravity
+IF (ALLOCATED(SrcParamData%PitchAxis)) THEN
+  i1_l = LBOUND(SrcParamData%PitchAxis,1)
+  i1_u = UBOUND(SrcParamData%PitchAxis,1)
+  i2_l = LBOUND(SrcParamData%PitchAxis,2)
+  i2_u = UBOUND(SrcParamData%PitchAxis,2)
+  IF (.NOT. ALLOCATED(DstParamData%PitchAxis)) THEN 
+    ALLOCATE(DstParamData%PitchAxis(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%PitchAxis.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%PitchAxis = SrcParamData%PitchAxis
+ENDIF
+IF (ALLOCATED(SrcParamData%AeroTwst)) THEN
+  i1_l = LBOUND(SrcParamData%AeroTwst,1)
+  i1_u = UBOUND(SrcParamData%AeroTwst,1)
+  IF (.NOT. ALLOCATED(DstParamData%AeroTwst)) THEN 
+    ALLOCATE(DstParamData%AeroTwst(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%AeroTwst.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%AeroTwst = SrcParamData%AeroTwst
+ENDIF
+IF (ALLOCATED(SrcParamData%AxRedBld)) THEN
+  i1_l = LBOUND(SrcParamData%AxRedBld,1)
+  i1_u = UBOUND(SrcParamData%AxRedBld,1)
+  i2_l = LBOUND(SrcParamData%AxRedBld,2)
+  i2_u = UBOUND(SrcParamData%AxRedBld,2)
+  i3_l = LBOUND(SrcParamData%AxRedBld,3)
+  i3_u = UBOUND(SrcParamData%AxRedBld,3)
+  i4_l = LBOUND(SrcParamData%AxRedBld,4)
+  i4_u = UBOUND(SrcParamData%AxRedBld,4)
+  IF (.NOT. ALLOCATED(DstParamData%AxRedBld)) THEN 
+    ALLOCATE(DstParamData%AxRedBld(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u,i4_l:i4_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%AxRedBld.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%AxRedBld = SrcParamData%AxRedBld
+ENDIF
+IF (ALLOCATED(SrcParamData%BAlpha)) THEN
+  i1_l = LBOUND(SrcParamData%BAlpha,1)
+  i1_u = UBOUND(SrcParamData%BAlpha,1)
+  i2_l = LBOUND(SrcParamData%BAlpha,2)
+  i2_u = UBOUND(SrcParamData%BAlpha,2)
+  IF (.NOT. ALLOCATED(DstParamData%BAlpha)) THEN 
+    ALLOCATE(DstParamData%BAlpha(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%BAlpha.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%BAlpha = SrcParamData%BAlpha
+ENDIF
+IF (ALLOCATED(SrcParamData%BldEDamp)) THEN
+  i1_l = LBOUND(SrcParamData%BldEDamp,1)
+  i1_u = UBOUND(SrcParamData%BldEDamp,1)
+  i2_l = LBOUND(SrcParamData%BldEDamp,2)
+  i2_u = UBOUND(SrcParamData%BldEDamp,2)
+  IF (.NOT. ALLOCATED(DstParamData%BldEDamp)) THEN 
+    ALLOCATE(DstParamData%BldEDamp(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%BldEDamp.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%BldEDamp = SrcParamData%BldEDamp
+ENDIF
+IF (ALLOCATED(SrcParamData%BldFDamp)) THEN
+  i1_l = LBOUND(SrcParamData%BldFDamp,1)
+  i1_u = UBOUND(SrcParamData%BldFDamp,1)
+  i2_l = LBOUND(SrcParamData%BldFDamp,2)
+  i2_u = UBOUND(SrcParamData%BldFDamp,2)
+  IF (.NOT. ALLOCATED(DstParamData%BldFDamp)) THEN 
+    ALLOCATE(DstParamData%BldFDamp(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%BldFDamp.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%BldFDamp = SrcParamData%BldFDamp
+ENDIF
+    DstParamData%BldFlexL = SrcParamData%BldFlexL
+IF (ALLOCATED(SrcParamData%CAeroTwst)) THEN
+  i1_l = LBOUND(SrcParamData%CAeroTwst,1)
+  i1_u = UBOUND(SrcParamData%CAeroTwst,1)
+  IF (.NOT. ALLOCATED(DstParamData%CAeroTwst)) THEN 
+    ALLOCATE(DstParamData%CAeroTwst(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%CAeroTwst.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%CAeroTwst = SrcParamData%CAeroTwst
+ENDIF
+IF (ALLOCATED(SrcParamData%CBE)) THEN
+  i1_l = LBOUND(SrcParamData%CBE,1)
+  i1_u = UBOUND(SrcParamData%CBE,1)
+  i2_l = LBOUND(SrcParamData%CBE,2)
+  i2_u = UBOUND(SrcParamData%CBE,2)
+  i3_l = LBOUND(SrcParamData%CBE,3)
+  i3_u = UBOUND(SrcParamData%CBE,3)
+  IF (.NOT. ALLOCATED(DstParamData%CBE)) THEN 
+    ALLOCATE(DstParamData%CBE(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%CBE.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%CBE = SrcParamData%CBE
+ENDIF
+IF (ALLOCATED(SrcParamData%CBF)) THEN
+  i1_l = LBOUND(SrcParamData%CBF,1)
+  i1_u = UBOUND(SrcParamData%CBF,1)
+  i2_l = LBOUND(SrcParamData%CBF,2)
+  i2_u = UBOUND(SrcParamData%CBF,2)
+  i3_l = LBOUND(SrcParamData%CBF,3)
+  i3_u = UBOUND(SrcParamData%CBF,3)
+  IF (.NOT. ALLOCATED(DstParamData%CBF)) THEN 
+    ALLOCATE(DstParamData%CBF(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%CBF.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%CBF = SrcParamData%CBF
+ENDIF
+IF (ALLOCATED(SrcParamData%cgOffBEdg)) THEN
+  i1_l = LBOUND(SrcParamData%cgOffBEdg,1)
+  i1_u = UBOUND(SrcParamData%cgOffBEdg,1)
+  i2_l = LBOUND(SrcParamData%cgOffBEdg,2)
+  i2_u = UBOUND(SrcParamData%cgOffBEdg,2)
+  IF (.NOT. ALLOCATED(DstParamData%cgOffBEdg)) THEN 
+    ALLOCATE(DstParamData%cgOffBEdg(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%cgOffBEdg.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%cgOffBEdg = SrcParamData%cgOffBEdg
+ENDIF
+IF (ALLOCATED(SrcParamData%cgOffBFlp)) THEN
+  i1_l = LBOUND(SrcParamData%cgOffBFlp,1)
+  i1_u = UBOUND(SrcParamData%cgOffBFlp,1)
+  i2_l = LBOUND(SrcParamData%cgOffBFlp,2)
+  i2_u = UBOUND(SrcParamData%cgOffBFlp,2)
+  IF (.NOT. ALLOCATED(DstParamData%cgOffBFlp)) THEN 
+    ALLOCATE(DstParamData%cgOffBFlp(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%cgOffBFlp.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%cgOffBFlp = SrcParamData%cgOffBFlp
+ENDIF
+IF (ALLOCATED(SrcParamData%Chord)) THEN
+  i1_l = LBOUND(SrcParamData%Chord,1)
+  i1_u = UBOUND(SrcParamData%Chord,1)
+  IF (.NOT. ALLOCATED(DstParamData%Chord)) THEN 
+    ALLOCATE(DstParamData%Chord(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%Chord.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%Chord = SrcParamData%Chord
+ENDIF
+IF (ALLOCATED(SrcParamData%CThetaS)) THEN
+  i1_l = LBOUND(SrcParamData%CThetaS,1)
+  i1_u = UBOUND(SrcParamData%CThetaS,1)
+  i2_l = LBOUND(SrcParamData%CThetaS,2)
+  i2_u = UBOUND(SrcParamData%CThetaS,2)
+  IF (.NOT. ALLOCATED(DstParamData%CThetaS)) THEN 
+    ALLOCATE(DstParamData%CThetaS(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%CThetaS.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%CThetaS = SrcParamData%CThetaS
+ENDIF
+IF (ALLOCATED(SrcParamData%DRNodes)) THEN
+  i1_l = LBOUND(SrcParamData%DRNodes,1)
+  i1_u = UBOUND(SrcParamData%DRNodes,1)
+  IF (.NOT. ALLOCATED(DstParamData%DRNodes)) THEN 
+    ALLOCATE(DstParamData%DRNodes(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%DRNodes.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%DRNodes = SrcParamData%DRNodes
+ENDIF
+IF (ALLOCATED(SrcParamData%EAOffBEdg)) THEN
+  i1_l = LBOUND(SrcParamData%EAOffBEdg,1)
+  i1_u = UBOUND(SrcParamData%EAOffBEdg,1)
+  i2_l = LBOUND(SrcParamData%EAOffBEdg,2)
+  i2_u = UBOUND(SrcParamData%EAOffBEdg,2)
+  IF (.NOT. ALLOCATED(DstParamData%EAOffBEdg)) THEN 
+    ALLOCATE(DstParamData%EAOffBEdg(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%EAOffBEdg.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%EAOffBEdg = SrcParamData%EAOffBEdg
+ENDIF
+IF (ALLOCATED(SrcParamData%EAOffBFlp)) THEN
+  i1_l = LBOUND(SrcParamData%EAOffBFlp,1)
+  i1_u = UBOUND(SrcParamData%EAOffBFlp,1)
+  i2_l = LBOUND(SrcParamData%EAOffBFlp,2)
+  i2_u = UBOUND(SrcParamData%EAOffBFlp,2)
+  IF (.NOT. ALLOCATED(DstParamData%EAOffBFlp)) THEN 
+    ALLOCATE(DstParamData%EAOffBFlp(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%EAOffBFlp.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%EAOffBFlp = SrcParamData%EAOffBFlp
+ENDIF
+IF (ALLOCATED(SrcParamData%FStTunr)) THEN
+  i1_l = LBOUND(SrcParamData%FStTunr,1)
+  i1_u = UBOUND(SrcParamData%FStTunr,1)
+  i2_l = LBOUND(SrcParamData%FStTunr,2)
+  i2_u = UBOUND(SrcParamData%FStTunr,2)
+  IF (.NOT. ALLOCATED(DstParamData%FStTunr)) THEN 
+    ALLOCATE(DstParamData%FStTunr(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%FStTunr.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%FStTunr = SrcParamData%FStTunr
+ENDIF
+IF (ALLOCATED(SrcParamData%InerBEdg)) THEN
+  i1_l = LBOUND(SrcParamData%InerBEdg,1)
+  i1_u = UBOUND(SrcParamData%InerBEdg,1)
+  i2_l = LBOUND(SrcParamData%InerBEdg,2)
+  i2_u = UBOUND(SrcParamData%InerBEdg,2)
+  IF (.NOT. ALLOCATED(DstParamData%InerBEdg)) THEN 
+    ALLOCATE(DstParamData%InerBEdg(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%InerBEdg.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%InerBEdg = SrcParamData%InerBEdg
+ENDIF
+IF (ALLOCATED(SrcParamData%InerBFlp)) THEN
+  i1_l = LBOUND(SrcParamData%InerBFlp,1)
+  i1_u = UBOUND(SrcParamData%InerBFlp,1)
+  i2_l = LBOUND(SrcParamData%InerBFlp,2)
+  i2_u = UBOUND(SrcParamData%InerBFlp,2)
   IF (.NOT. ALLOCATED(DstParamData%InerBFlp)) THEN 
     ALLOCATE(DstParamData%InerBFlp(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
@@ -21031,259 +22665,73 @@ ENDIF
     Re_Xferred = Re_Xferred + 1
     OutData%rWKzn = ReKiBuf(Re_Xferred)
     Re_Xferred = Re_Xferred + 1
-    OutData%rZT0zt = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%rZYzt = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%SinDel3 = REAL(DbKiBuf(Db_Xferred), R8Ki)
-    Db_Xferred = Db_Xferred + 1
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! SinPreC not allocated
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    Int_Xferred = Int_Xferred + 1
-    i1_l = IntKiBuf( Int_Xferred    )
-    i1_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%SinPreC)) DEALLOCATE(OutData%SinPreC)
-    ALLOCATE(OutData%SinPreC(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%SinPreC.', ErrStat, ErrMsg,RoutineName)
-       RETURN
-    END IF
-      DO i1 = LBOUND(OutData%SinPreC,1), UBOUND(OutData%SinPreC,1)
-        OutData%SinPreC(i1) = REAL(DbKiBuf(Db_Xferred), R8Ki)
-        Db_Xferred = Db_Xferred + 1
-      END DO
-  END IF
-    OutData%SRFrlSkew = REAL(DbKiBuf(Db_Xferred), R8Ki)
-    Db_Xferred = Db_Xferred + 1
-    OutData%SRFrlSkw2 = REAL(DbKiBuf(Db_Xferred), R8Ki)
-    Db_Xferred = Db_Xferred + 1
-    OutData%SRFrlTilt = REAL(DbKiBuf(Db_Xferred), R8Ki)
-    Db_Xferred = Db_Xferred + 1
-    OutData%SRFrlTlt2 = REAL(DbKiBuf(Db_Xferred), R8Ki)
-    Db_Xferred = Db_Xferred + 1
-    OutData%SShftSkew = REAL(DbKiBuf(Db_Xferred), R8Ki)
-    Db_Xferred = Db_Xferred + 1
-    OutData%SShftTilt = REAL(DbKiBuf(Db_Xferred), R8Ki)
-    Db_Xferred = Db_Xferred + 1
-    OutData%STFinBank = REAL(DbKiBuf(Db_Xferred), R8Ki)
-    Db_Xferred = Db_Xferred + 1
-    OutData%STFinSkew = REAL(DbKiBuf(Db_Xferred), R8Ki)
-    Db_Xferred = Db_Xferred + 1
-    OutData%STFinTilt = REAL(DbKiBuf(Db_Xferred), R8Ki)
-    Db_Xferred = Db_Xferred + 1
-    OutData%STFrlSkew = REAL(DbKiBuf(Db_Xferred), R8Ki)
-    Db_Xferred = Db_Xferred + 1
-    OutData%STFrlSkw2 = REAL(DbKiBuf(Db_Xferred), R8Ki)
-    Db_Xferred = Db_Xferred + 1
-    OutData%STFrlTilt = REAL(DbKiBuf(Db_Xferred), R8Ki)
-    Db_Xferred = Db_Xferred + 1
-    OutData%STFrlTlt2 = REAL(DbKiBuf(Db_Xferred), R8Ki)
-    Db_Xferred = Db_Xferred + 1
-    OutData%TFrlPntxn = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TFrlPntyn = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TFrlPntzn = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TipRad = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TowerHt = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TowerBsHt = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%UndSling = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%NumBl = IntKiBuf(Int_Xferred)
-    Int_Xferred = Int_Xferred + 1
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! AxRedTFA not allocated
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    Int_Xferred = Int_Xferred + 1
-    i1_l = IntKiBuf( Int_Xferred    )
-    i1_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    i2_l = IntKiBuf( Int_Xferred    )
-    i2_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    i3_l = IntKiBuf( Int_Xferred    )
-    i3_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%AxRedTFA)) DEALLOCATE(OutData%AxRedTFA)
-    ALLOCATE(OutData%AxRedTFA(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%AxRedTFA.', ErrStat, ErrMsg,RoutineName)
-       RETURN
-    END IF
-      DO i3 = LBOUND(OutData%AxRedTFA,3), UBOUND(OutData%AxRedTFA,3)
-        DO i2 = LBOUND(OutData%AxRedTFA,2), UBOUND(OutData%AxRedTFA,2)
-          DO i1 = LBOUND(OutData%AxRedTFA,1), UBOUND(OutData%AxRedTFA,1)
-            OutData%AxRedTFA(i1,i2,i3) = ReKiBuf(Re_Xferred)
-            Re_Xferred = Re_Xferred + 1
-          END DO
-        END DO
-      END DO
-  END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! AxRedTSS not allocated
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    Int_Xferred = Int_Xferred + 1
-    i1_l = IntKiBuf( Int_Xferred    )
-    i1_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    i2_l = IntKiBuf( Int_Xferred    )
-    i2_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    i3_l = IntKiBuf( Int_Xferred    )
-    i3_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%AxRedTSS)) DEALLOCATE(OutData%AxRedTSS)
-    ALLOCATE(OutData%AxRedTSS(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%AxRedTSS.', ErrStat, ErrMsg,RoutineName)
-       RETURN
-    END IF
-      DO i3 = LBOUND(OutData%AxRedTSS,3), UBOUND(OutData%AxRedTSS,3)
-        DO i2 = LBOUND(OutData%AxRedTSS,2), UBOUND(OutData%AxRedTSS,2)
-          DO i1 = LBOUND(OutData%AxRedTSS,1), UBOUND(OutData%AxRedTSS,1)
-            OutData%AxRedTSS(i1,i2,i3) = ReKiBuf(Re_Xferred)
-            Re_Xferred = Re_Xferred + 1
-          END DO
-        END DO
-      END DO
-  END IF
-    i1_l = LBOUND(OutData%CTFA,1)
-    i1_u = UBOUND(OutData%CTFA,1)
-    i2_l = LBOUND(OutData%CTFA,2)
-    i2_u = UBOUND(OutData%CTFA,2)
-    DO i2 = LBOUND(OutData%CTFA,2), UBOUND(OutData%CTFA,2)
-      DO i1 = LBOUND(OutData%CTFA,1), UBOUND(OutData%CTFA,1)
-        OutData%CTFA(i1,i2) = ReKiBuf(Re_Xferred)
-        Re_Xferred = Re_Xferred + 1
-      END DO
-    END DO
-    i1_l = LBOUND(OutData%CTSS,1)
-    i1_u = UBOUND(OutData%CTSS,1)
-    i2_l = LBOUND(OutData%CTSS,2)
-    i2_u = UBOUND(OutData%CTSS,2)
-    DO i2 = LBOUND(OutData%CTSS,2), UBOUND(OutData%CTSS,2)
-      DO i1 = LBOUND(OutData%CTSS,1), UBOUND(OutData%CTSS,1)
-        OutData%CTSS(i1,i2) = ReKiBuf(Re_Xferred)
-        Re_Xferred = Re_Xferred + 1
-      END DO
-    END DO
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! DHNodes not allocated
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    Int_Xferred = Int_Xferred + 1
-    i1_l = IntKiBuf( Int_Xferred    )
-    i1_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%DHNodes)) DEALLOCATE(OutData%DHNodes)
-    ALLOCATE(OutData%DHNodes(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%DHNodes.', ErrStat, ErrMsg,RoutineName)
-       RETURN
-    END IF
-      DO i1 = LBOUND(OutData%DHNodes,1), UBOUND(OutData%DHNodes,1)
-        OutData%DHNodes(i1) = ReKiBuf(Re_Xferred)
-        Re_Xferred = Re_Xferred + 1
-      END DO
-  END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! HNodes not allocated
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    Int_Xferred = Int_Xferred + 1
-    i1_l = IntKiBuf( Int_Xferred    )
-    i1_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%HNodes)) DEALLOCATE(OutData%HNodes)
-    ALLOCATE(OutData%HNodes(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%HNodes.', ErrStat, ErrMsg,RoutineName)
-       RETURN
-    END IF
-      DO i1 = LBOUND(OutData%HNodes,1), UBOUND(OutData%HNodes,1)
-        OutData%HNodes(i1) = ReKiBuf(Re_Xferred)
-        Re_Xferred = Re_Xferred + 1
-      END DO
-  END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! HNodesNorm not allocated
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    Int_Xferred = Int_Xferred + 1
-    i1_l = IntKiBuf( Int_Xferred    )
-    i1_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%HNodesNorm)) DEALLOCATE(OutData%HNodesNorm)
-    ALLOCATE(OutData%HNodesNorm(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%HNodesNorm.', ErrStat, ErrMsg,RoutineName)
-       RETURN
-    END IF
-      DO i1 = LBOUND(OutData%HNodesNorm,1), UBOUND(OutData%HNodesNorm,1)
-        OutData%HNodesNorm(i1) = ReKiBuf(Re_Xferred)
-        Re_Xferred = Re_Xferred + 1
-      END DO
-  END IF
-    i1_l = LBOUND(OutData%KTFA,1)
-    i1_u = UBOUND(OutData%KTFA,1)
-    i2_l = LBOUND(OutData%KTFA,2)
-    i2_u = UBOUND(OutData%KTFA,2)
-    DO i2 = LBOUND(OutData%KTFA,2), UBOUND(OutData%KTFA,2)
-      DO i1 = LBOUND(OutData%KTFA,1), UBOUND(OutData%KTFA,1)
-        OutData%KTFA(i1,i2) = ReKiBuf(Re_Xferred)
-        Re_Xferred = Re_Xferred + 1
-      END DO
-    END DO
-    i1_l = LBOUND(OutData%KTSS,1)
-    i1_u = UBOUND(OutData%KTSS,1)
-    i2_l = LBOUND(OutData%KTSS,2)
-    i2_u = UBOUND(OutData%KTSS,2)
-    DO i2 = LBOUND(OutData%KTSS,2), UBOUND(OutData%KTSS,2)
-      DO i1 = LBOUND(OutData%KTSS,1), UBOUND(OutData%KTSS,1)
-        OutData%KTSS(i1,i2) = ReKiBuf(Re_Xferred)
-        Re_Xferred = Re_Xferred + 1
-      END DO
-    END DO
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! MassT not allocated
+    OutData%rZT0zt = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%rZYzt = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%SinDel3 = REAL(DbKiBuf(Db_Xferred), R8Ki)
+    Db_Xferred = Db_Xferred + 1
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! SinPreC not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%MassT)) DEALLOCATE(OutData%MassT)
-    ALLOCATE(OutData%MassT(i1_l:i1_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%SinPreC)) DEALLOCATE(OutData%SinPreC)
+    ALLOCATE(OutData%SinPreC(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%MassT.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%SinPreC.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i1 = LBOUND(OutData%MassT,1), UBOUND(OutData%MassT,1)
-        OutData%MassT(i1) = ReKiBuf(Re_Xferred)
-        Re_Xferred = Re_Xferred + 1
+      DO i1 = LBOUND(OutData%SinPreC,1), UBOUND(OutData%SinPreC,1)
+        OutData%SinPreC(i1) = REAL(DbKiBuf(Db_Xferred), R8Ki)
+        Db_Xferred = Db_Xferred + 1
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! StiffTSS not allocated
-    Int_Xferred = Int_Xferred + 1
-  ELSE
+    OutData%SRFrlSkew = REAL(DbKiBuf(Db_Xferred), R8Ki)
+    Db_Xferred = Db_Xferred + 1
+    OutData%SRFrlSkw2 = REAL(DbKiBuf(Db_Xferred), R8Ki)
+    Db_Xferred = Db_Xferred + 1
+    OutData%SRFrlTilt = REAL(DbKiBuf(Db_Xferred), R8Ki)
+    Db_Xferred = Db_Xferred + 1
+    OutData%SRFrlTlt2 = REAL(DbKiBuf(Db_Xferred), R8Ki)
+    Db_Xferred = Db_Xferred + 1
+    OutData%SShftSkew = REAL(DbKiBuf(Db_Xferred), R8Ki)
+    Db_Xferred = Db_Xferred + 1
+    OutData%SShftTilt = REAL(DbKiBuf(Db_Xferred), R8Ki)
+    Db_Xferred = Db_Xferred + 1
+    OutData%STFinBank = REAL(DbKiBuf(Db_Xferred), R8Ki)
+    Db_Xferred = Db_Xferred + 1
+    OutData%STFinSkew = REAL(DbKiBuf(Db_Xferred), R8Ki)
+    Db_Xferred = Db_Xferred + 1
+    OutData%STFinTilt = REAL(DbKiBuf(Db_Xferred), R8Ki)
+    Db_Xferred = Db_Xferred + 1
+    OutData%STFrlSkew = REAL(DbKiBuf(Db_Xferred), R8Ki)
+    Db_Xferred = Db_Xferred + 1
+    OutData%STFrlSkw2 = REAL(DbKiBuf(Db_Xferred), R8Ki)
+    Db_Xferred = Db_Xferred + 1
+    OutData%STFrlTilt = REAL(DbKiBuf(Db_Xferred), R8Ki)
+    Db_Xferred = Db_Xferred + 1
+    OutData%STFrlTlt2 = REAL(DbKiBuf(Db_Xferred), R8Ki)
+    Db_Xferred = Db_Xferred + 1
+    OutData%TFrlPntxn = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TFrlPntyn = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TFrlPntzn = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TipRad = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TowerHt = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TowerBsHt = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%UndSling = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%NumBl = IntKiBuf(Int_Xferred)
     Int_Xferred = Int_Xferred + 1
-    i1_l = IntKiBuf( Int_Xferred    )
-    i1_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%StiffTSS)) DEALLOCATE(OutData%StiffTSS)
-    ALLOCATE(OutData%StiffTSS(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%StiffTSS.', ErrStat, ErrMsg,RoutineName)
-       RETURN
-    END IF
-      DO i1 = LBOUND(OutData%StiffTSS,1), UBOUND(OutData%StiffTSS,1)
-        OutData%StiffTSS(i1) = ReKiBuf(Re_Xferred)
-        Re_Xferred = Re_Xferred + 1
-      END DO
-  END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! TwrFASF not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! AxRedTFA not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
@@ -21296,24 +22744,22 @@ ENDIF
     i3_l = IntKiBuf( Int_Xferred    )
     i3_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%TwrFASF)) DEALLOCATE(OutData%TwrFASF)
-    ALLOCATE(OutData%TwrFASF(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%AxRedTFA)) DEALLOCATE(OutData%AxRedTFA)
+    ALLOCATE(OutData%AxRedTFA(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%TwrFASF.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%AxRedTFA.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i3 = LBOUND(OutData%TwrFASF,3), UBOUND(OutData%TwrFASF,3)
-        DO i2 = LBOUND(OutData%TwrFASF,2), UBOUND(OutData%TwrFASF,2)
-          DO i1 = LBOUND(OutData%TwrFASF,1), UBOUND(OutData%TwrFASF,1)
-            OutData%TwrFASF(i1,i2,i3) = ReKiBuf(Re_Xferred)
+      DO i3 = LBOUND(OutData%AxRedTFA,3), UBOUND(OutData%AxRedTFA,3)
+        DO i2 = LBOUND(OutData%AxRedTFA,2), UBOUND(OutData%AxRedTFA,2)
+          DO i1 = LBOUND(OutData%AxRedTFA,1), UBOUND(OutData%AxRedTFA,1)
+            OutData%AxRedTFA(i1,i2,i3) = ReKiBuf(Re_Xferred)
             Re_Xferred = Re_Xferred + 1
           END DO
         END DO
       END DO
   END IF
-    OutData%TwrFlexL = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! TwrSSSF not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! AxRedTSS not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
@@ -21326,571 +22772,476 @@ ENDIF
     i3_l = IntKiBuf( Int_Xferred    )
     i3_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%TwrSSSF)) DEALLOCATE(OutData%TwrSSSF)
-    ALLOCATE(OutData%TwrSSSF(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%AxRedTSS)) DEALLOCATE(OutData%AxRedTSS)
+    ALLOCATE(OutData%AxRedTSS(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%TwrSSSF.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%AxRedTSS.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i3 = LBOUND(OutData%TwrSSSF,3), UBOUND(OutData%TwrSSSF,3)
-        DO i2 = LBOUND(OutData%TwrSSSF,2), UBOUND(OutData%TwrSSSF,2)
-          DO i1 = LBOUND(OutData%TwrSSSF,1), UBOUND(OutData%TwrSSSF,1)
-            OutData%TwrSSSF(i1,i2,i3) = ReKiBuf(Re_Xferred)
+      DO i3 = LBOUND(OutData%AxRedTSS,3), UBOUND(OutData%AxRedTSS,3)
+        DO i2 = LBOUND(OutData%AxRedTSS,2), UBOUND(OutData%AxRedTSS,2)
+          DO i1 = LBOUND(OutData%AxRedTSS,1), UBOUND(OutData%AxRedTSS,1)
+            OutData%AxRedTSS(i1,i2,i3) = ReKiBuf(Re_Xferred)
             Re_Xferred = Re_Xferred + 1
           END DO
         END DO
       END DO
   END IF
-    OutData%TTopNode = IntKiBuf(Int_Xferred)
-    Int_Xferred = Int_Xferred + 1
-    OutData%TwrNodes = IntKiBuf(Int_Xferred)
-    Int_Xferred = Int_Xferred + 1
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! InerTFA not allocated
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    Int_Xferred = Int_Xferred + 1
-    i1_l = IntKiBuf( Int_Xferred    )
-    i1_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%InerTFA)) DEALLOCATE(OutData%InerTFA)
-    ALLOCATE(OutData%InerTFA(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%InerTFA.', ErrStat, ErrMsg,RoutineName)
-       RETURN
-    END IF
-      DO i1 = LBOUND(OutData%InerTFA,1), UBOUND(OutData%InerTFA,1)
-        OutData%InerTFA(i1) = ReKiBuf(Re_Xferred)
-        Re_Xferred = Re_Xferred + 1
-      END DO
-  END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! InerTSS not allocated
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    Int_Xferred = Int_Xferred + 1
-    i1_l = IntKiBuf( Int_Xferred    )
-    i1_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%InerTSS)) DEALLOCATE(OutData%InerTSS)
-    ALLOCATE(OutData%InerTSS(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%InerTSS.', ErrStat, ErrMsg,RoutineName)
-       RETURN
-    END IF
-      DO i1 = LBOUND(OutData%InerTSS,1), UBOUND(OutData%InerTSS,1)
-        OutData%InerTSS(i1) = ReKiBuf(Re_Xferred)
-        Re_Xferred = Re_Xferred + 1
-      END DO
-  END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! StiffTGJ not allocated
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    Int_Xferred = Int_Xferred + 1
-    i1_l = IntKiBuf( Int_Xferred    )
-    i1_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%StiffTGJ)) DEALLOCATE(OutData%StiffTGJ)
-    ALLOCATE(OutData%StiffTGJ(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%StiffTGJ.', ErrStat, ErrMsg,RoutineName)
-       RETURN
-    END IF
-      DO i1 = LBOUND(OutData%StiffTGJ,1), UBOUND(OutData%StiffTGJ,1)
-        OutData%StiffTGJ(i1) = ReKiBuf(Re_Xferred)
+    i1_l = LBOUND(OutData%CTFA,1)
+    i1_u = UBOUND(OutData%CTFA,1)
+    i2_l = LBOUND(OutData%CTFA,2)
+    i2_u = UBOUND(OutData%CTFA,2)
+    DO i2 = LBOUND(OutData%CTFA,2), UBOUND(OutData%CTFA,2)
+      DO i1 = LBOUND(OutData%CTFA,1), UBOUND(OutData%CTFA,1)
+        OutData%CTFA(i1,i2) = ReKiBuf(Re_Xferred)
         Re_Xferred = Re_Xferred + 1
       END DO
-  END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! StiffTEA not allocated
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    Int_Xferred = Int_Xferred + 1
-    i1_l = IntKiBuf( Int_Xferred    )
-    i1_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%StiffTEA)) DEALLOCATE(OutData%StiffTEA)
-    ALLOCATE(OutData%StiffTEA(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%StiffTEA.', ErrStat, ErrMsg,RoutineName)
-       RETURN
-    END IF
-      DO i1 = LBOUND(OutData%StiffTEA,1), UBOUND(OutData%StiffTEA,1)
-        OutData%StiffTEA(i1) = ReKiBuf(Re_Xferred)
+    END DO
+    i1_l = LBOUND(OutData%CTSS,1)
+    i1_u = UBOUND(OutData%CTSS,1)
+    i2_l = LBOUND(OutData%CTSS,2)
+    i2_u = UBOUND(OutData%CTSS,2)
+    DO i2 = LBOUND(OutData%CTSS,2), UBOUND(OutData%CTSS,2)
+      DO i1 = LBOUND(OutData%CTSS,1), UBOUND(OutData%CTSS,1)
+        OutData%CTSS(i1,i2) = ReKiBuf(Re_Xferred)
         Re_Xferred = Re_Xferred + 1
       END DO
-  END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! StiffTFA not allocated
+    END DO
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! DHNodes not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%StiffTFA)) DEALLOCATE(OutData%StiffTFA)
-    ALLOCATE(OutData%StiffTFA(i1_l:i1_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%DHNodes)) DEALLOCATE(OutData%DHNodes)
+    ALLOCATE(OutData%DHNodes(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%StiffTFA.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%DHNodes.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i1 = LBOUND(OutData%StiffTFA,1), UBOUND(OutData%StiffTFA,1)
-        OutData%StiffTFA(i1) = ReKiBuf(Re_Xferred)
+      DO i1 = LBOUND(OutData%DHNodes,1), UBOUND(OutData%DHNodes,1)
+        OutData%DHNodes(i1) = ReKiBuf(Re_Xferred)
         Re_Xferred = Re_Xferred + 1
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! cgOffTFA not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! HNodes not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%cgOffTFA)) DEALLOCATE(OutData%cgOffTFA)
-    ALLOCATE(OutData%cgOffTFA(i1_l:i1_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%HNodes)) DEALLOCATE(OutData%HNodes)
+    ALLOCATE(OutData%HNodes(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%cgOffTFA.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%HNodes.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i1 = LBOUND(OutData%cgOffTFA,1), UBOUND(OutData%cgOffTFA,1)
-        OutData%cgOffTFA(i1) = ReKiBuf(Re_Xferred)
+      DO i1 = LBOUND(OutData%HNodes,1), UBOUND(OutData%HNodes,1)
+        OutData%HNodes(i1) = ReKiBuf(Re_Xferred)
         Re_Xferred = Re_Xferred + 1
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! cgOffTSS not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! HNodesNorm not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%cgOffTSS)) DEALLOCATE(OutData%cgOffTSS)
-    ALLOCATE(OutData%cgOffTSS(i1_l:i1_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%HNodesNorm)) DEALLOCATE(OutData%HNodesNorm)
+    ALLOCATE(OutData%HNodesNorm(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%cgOffTSS.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%HNodesNorm.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i1 = LBOUND(OutData%cgOffTSS,1), UBOUND(OutData%cgOffTSS,1)
-        OutData%cgOffTSS(i1) = ReKiBuf(Re_Xferred)
+      DO i1 = LBOUND(OutData%HNodesNorm,1), UBOUND(OutData%HNodesNorm,1)
+        OutData%HNodesNorm(i1) = ReKiBuf(Re_Xferred)
         Re_Xferred = Re_Xferred + 1
       END DO
   END IF
-    OutData%AtfaIner = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! BldCG not allocated
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    Int_Xferred = Int_Xferred + 1
-    i1_l = IntKiBuf( Int_Xferred    )
-    i1_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%BldCG)) DEALLOCATE(OutData%BldCG)
-    ALLOCATE(OutData%BldCG(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%BldCG.', ErrStat, ErrMsg,RoutineName)
-       RETURN
-    END IF
-      DO i1 = LBOUND(OutData%BldCG,1), UBOUND(OutData%BldCG,1)
-        OutData%BldCG(i1) = ReKiBuf(Re_Xferred)
+    i1_l = LBOUND(OutData%KTFA,1)
+    i1_u = UBOUND(OutData%KTFA,1)
+    i2_l = LBOUND(OutData%KTFA,2)
+    i2_u = UBOUND(OutData%KTFA,2)
+    DO i2 = LBOUND(OutData%KTFA,2), UBOUND(OutData%KTFA,2)
+      DO i1 = LBOUND(OutData%KTFA,1), UBOUND(OutData%KTFA,1)
+        OutData%KTFA(i1,i2) = ReKiBuf(Re_Xferred)
         Re_Xferred = Re_Xferred + 1
       END DO
-  END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! BldMass not allocated
+    END DO
+    i1_l = LBOUND(OutData%KTSS,1)
+    i1_u = UBOUND(OutData%KTSS,1)
+    i2_l = LBOUND(OutData%KTSS,2)
+    i2_u = UBOUND(OutData%KTSS,2)
+    DO i2 = LBOUND(OutData%KTSS,2), UBOUND(OutData%KTSS,2)
+      DO i1 = LBOUND(OutData%KTSS,1), UBOUND(OutData%KTSS,1)
+        OutData%KTSS(i1,i2) = ReKiBuf(Re_Xferred)
+        Re_Xferred = Re_Xferred + 1
+      END DO
+    END DO
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! MassT not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%BldMass)) DEALLOCATE(OutData%BldMass)
-    ALLOCATE(OutData%BldMass(i1_l:i1_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%MassT)) DEALLOCATE(OutData%MassT)
+    ALLOCATE(OutData%MassT(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%BldMass.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%MassT.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i1 = LBOUND(OutData%BldMass,1), UBOUND(OutData%BldMass,1)
-        OutData%BldMass(i1) = ReKiBuf(Re_Xferred)
+      DO i1 = LBOUND(OutData%MassT,1), UBOUND(OutData%MassT,1)
+        OutData%MassT(i1) = ReKiBuf(Re_Xferred)
         Re_Xferred = Re_Xferred + 1
       END DO
   END IF
-    OutData%BoomMass = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! FirstMom not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! StiffTSS not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%FirstMom)) DEALLOCATE(OutData%FirstMom)
-    ALLOCATE(OutData%FirstMom(i1_l:i1_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%StiffTSS)) DEALLOCATE(OutData%StiffTSS)
+    ALLOCATE(OutData%StiffTSS(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%FirstMom.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%StiffTSS.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i1 = LBOUND(OutData%FirstMom,1), UBOUND(OutData%FirstMom,1)
-        OutData%FirstMom(i1) = ReKiBuf(Re_Xferred)
+      DO i1 = LBOUND(OutData%StiffTSS,1), UBOUND(OutData%StiffTSS,1)
+        OutData%StiffTSS(i1) = ReKiBuf(Re_Xferred)
         Re_Xferred = Re_Xferred + 1
       END DO
   END IF
-    OutData%GenIner = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%Hubg1Iner = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%Hubg2Iner = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%HubMass = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%Nacd2Iner = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%NacMass = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%PtfmMass = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%PtfmPIner = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%PtfmRIner = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%PtfmYIner = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%RFrlMass = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%RotIner = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%RotMass = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%RrfaIner = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! SecondMom not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! TwrFASF not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%SecondMom)) DEALLOCATE(OutData%SecondMom)
-    ALLOCATE(OutData%SecondMom(i1_l:i1_u),STAT=ErrStat2)
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i3_l = IntKiBuf( Int_Xferred    )
+    i3_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%TwrFASF)) DEALLOCATE(OutData%TwrFASF)
+    ALLOCATE(OutData%TwrFASF(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%SecondMom.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%TwrFASF.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i1 = LBOUND(OutData%SecondMom,1), UBOUND(OutData%SecondMom,1)
-        OutData%SecondMom(i1) = ReKiBuf(Re_Xferred)
-        Re_Xferred = Re_Xferred + 1
+      DO i3 = LBOUND(OutData%TwrFASF,3), UBOUND(OutData%TwrFASF,3)
+        DO i2 = LBOUND(OutData%TwrFASF,2), UBOUND(OutData%TwrFASF,2)
+          DO i1 = LBOUND(OutData%TwrFASF,1), UBOUND(OutData%TwrFASF,1)
+            OutData%TwrFASF(i1,i2,i3) = ReKiBuf(Re_Xferred)
+            Re_Xferred = Re_Xferred + 1
+          END DO
+        END DO
       END DO
   END IF
-    OutData%TFinMass = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TFrlIner = ReKiBuf(Re_Xferred)
+    OutData%TwrFlexL = ReKiBuf(Re_Xferred)
     Re_Xferred = Re_Xferred + 1
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! TipMass not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! TwrSSSF not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%TipMass)) DEALLOCATE(OutData%TipMass)
-    ALLOCATE(OutData%TipMass(i1_l:i1_u),STAT=ErrStat2)
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i3_l = IntKiBuf( Int_Xferred    )
+    i3_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%TwrSSSF)) DEALLOCATE(OutData%TwrSSSF)
+    ALLOCATE(OutData%TwrSSSF(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%TipMass.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%TwrSSSF.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i1 = LBOUND(OutData%TipMass,1), UBOUND(OutData%TipMass,1)
-        OutData%TipMass(i1) = ReKiBuf(Re_Xferred)
-        Re_Xferred = Re_Xferred + 1
+      DO i3 = LBOUND(OutData%TwrSSSF,3), UBOUND(OutData%TwrSSSF,3)
+        DO i2 = LBOUND(OutData%TwrSSSF,2), UBOUND(OutData%TwrSSSF,2)
+          DO i1 = LBOUND(OutData%TwrSSSF,1), UBOUND(OutData%TwrSSSF,1)
+            OutData%TwrSSSF(i1,i2,i3) = ReKiBuf(Re_Xferred)
+            Re_Xferred = Re_Xferred + 1
+          END DO
+        END DO
       END DO
   END IF
-    OutData%TurbMass = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TwrMass = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TwrTpMass = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%YawBrMass = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%Gravity = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! PitchAxis not allocated
+    OutData%TTopNode = IntKiBuf(Int_Xferred)
+    Int_Xferred = Int_Xferred + 1
+    OutData%TwrNodes = IntKiBuf(Int_Xferred)
+    Int_Xferred = Int_Xferred + 1
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! InerTFA not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    i2_l = IntKiBuf( Int_Xferred    )
-    i2_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%PitchAxis)) DEALLOCATE(OutData%PitchAxis)
-    ALLOCATE(OutData%PitchAxis(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%InerTFA)) DEALLOCATE(OutData%InerTFA)
+    ALLOCATE(OutData%InerTFA(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%PitchAxis.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%InerTFA.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%PitchAxis,2), UBOUND(OutData%PitchAxis,2)
-        DO i1 = LBOUND(OutData%PitchAxis,1), UBOUND(OutData%PitchAxis,1)
-          OutData%PitchAxis(i1,i2) = ReKiBuf(Re_Xferred)
-          Re_Xferred = Re_Xferred + 1
-        END DO
+      DO i1 = LBOUND(OutData%InerTFA,1), UBOUND(OutData%InerTFA,1)
+        OutData%InerTFA(i1) = ReKiBuf(Re_Xferred)
+        Re_Xferred = Re_Xferred + 1
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! AeroTwst not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! InerTSS not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%AeroTwst)) DEALLOCATE(OutData%AeroTwst)
-    ALLOCATE(OutData%AeroTwst(i1_l:i1_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%InerTSS)) DEALLOCATE(OutData%InerTSS)
+    ALLOCATE(OutData%InerTSS(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%AeroTwst.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%InerTSS.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i1 = LBOUND(OutData%AeroTwst,1), UBOUND(OutData%AeroTwst,1)
-        OutData%AeroTwst(i1) = ReKiBuf(Re_Xferred)
+      DO i1 = LBOUND(OutData%InerTSS,1), UBOUND(OutData%InerTSS,1)
+        OutData%InerTSS(i1) = ReKiBuf(Re_Xferred)
         Re_Xferred = Re_Xferred + 1
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! AxRedBld not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! StiffTGJ not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    i2_l = IntKiBuf( Int_Xferred    )
-    i2_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    i3_l = IntKiBuf( Int_Xferred    )
-    i3_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    i4_l = IntKiBuf( Int_Xferred    )
-    i4_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%AxRedBld)) DEALLOCATE(OutData%AxRedBld)
-    ALLOCATE(OutData%AxRedBld(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u,i4_l:i4_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%StiffTGJ)) DEALLOCATE(OutData%StiffTGJ)
+    ALLOCATE(OutData%StiffTGJ(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%AxRedBld.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%StiffTGJ.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i4 = LBOUND(OutData%AxRedBld,4), UBOUND(OutData%AxRedBld,4)
-        DO i3 = LBOUND(OutData%AxRedBld,3), UBOUND(OutData%AxRedBld,3)
-          DO i2 = LBOUND(OutData%AxRedBld,2), UBOUND(OutData%AxRedBld,2)
-            DO i1 = LBOUND(OutData%AxRedBld,1), UBOUND(OutData%AxRedBld,1)
-              OutData%AxRedBld(i1,i2,i3,i4) = ReKiBuf(Re_Xferred)
-              Re_Xferred = Re_Xferred + 1
-            END DO
-          END DO
-        END DO
+      DO i1 = LBOUND(OutData%StiffTGJ,1), UBOUND(OutData%StiffTGJ,1)
+        OutData%StiffTGJ(i1) = ReKiBuf(Re_Xferred)
+        Re_Xferred = Re_Xferred + 1
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! BAlpha not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! StiffTEA not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    i2_l = IntKiBuf( Int_Xferred    )
-    i2_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%BAlpha)) DEALLOCATE(OutData%BAlpha)
-    ALLOCATE(OutData%BAlpha(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%StiffTEA)) DEALLOCATE(OutData%StiffTEA)
+    ALLOCATE(OutData%StiffTEA(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%BAlpha.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%StiffTEA.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%BAlpha,2), UBOUND(OutData%BAlpha,2)
-        DO i1 = LBOUND(OutData%BAlpha,1), UBOUND(OutData%BAlpha,1)
-          OutData%BAlpha(i1,i2) = ReKiBuf(Re_Xferred)
-          Re_Xferred = Re_Xferred + 1
-        END DO
+      DO i1 = LBOUND(OutData%StiffTEA,1), UBOUND(OutData%StiffTEA,1)
+        OutData%StiffTEA(i1) = ReKiBuf(Re_Xferred)
+        Re_Xferred = Re_Xferred + 1
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! BldEDamp not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! StiffTFA not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    i2_l = IntKiBuf( Int_Xferred    )
-    i2_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%BldEDamp)) DEALLOCATE(OutData%BldEDamp)
-    ALLOCATE(OutData%BldEDamp(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%StiffTFA)) DEALLOCATE(OutData%StiffTFA)
+    ALLOCATE(OutData%StiffTFA(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%BldEDamp.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%StiffTFA.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%BldEDamp,2), UBOUND(OutData%BldEDamp,2)
-        DO i1 = LBOUND(OutData%BldEDamp,1), UBOUND(OutData%BldEDamp,1)
-          OutData%BldEDamp(i1,i2) = ReKiBuf(Re_Xferred)
-          Re_Xferred = Re_Xferred + 1
-        END DO
+      DO i1 = LBOUND(OutData%StiffTFA,1), UBOUND(OutData%StiffTFA,1)
+        OutData%StiffTFA(i1) = ReKiBuf(Re_Xferred)
+        Re_Xferred = Re_Xferred + 1
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! BldFDamp not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! cgOffTFA not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    i2_l = IntKiBuf( Int_Xferred    )
-    i2_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%BldFDamp)) DEALLOCATE(OutData%BldFDamp)
-    ALLOCATE(OutData%BldFDamp(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%cgOffTFA)) DEALLOCATE(OutData%cgOffTFA)
+    ALLOCATE(OutData%cgOffTFA(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%BldFDamp.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%cgOffTFA.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%BldFDamp,2), UBOUND(OutData%BldFDamp,2)
-        DO i1 = LBOUND(OutData%BldFDamp,1), UBOUND(OutData%BldFDamp,1)
-          OutData%BldFDamp(i1,i2) = ReKiBuf(Re_Xferred)
-          Re_Xferred = Re_Xferred + 1
-        END DO
+      DO i1 = LBOUND(OutData%cgOffTFA,1), UBOUND(OutData%cgOffTFA,1)
+        OutData%cgOffTFA(i1) = ReKiBuf(Re_Xferred)
+        Re_Xferred = Re_Xferred + 1
       END DO
-  END IF
-    OutData%BldFlexL = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! CAeroTwst not allocated
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! cgOffTSS not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%CAeroTwst)) DEALLOCATE(OutData%CAeroTwst)
-    ALLOCATE(OutData%CAeroTwst(i1_l:i1_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%cgOffTSS)) DEALLOCATE(OutData%cgOffTSS)
+    ALLOCATE(OutData%cgOffTSS(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%CAeroTwst.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%cgOffTSS.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i1 = LBOUND(OutData%CAeroTwst,1), UBOUND(OutData%CAeroTwst,1)
-        OutData%CAeroTwst(i1) = ReKiBuf(Re_Xferred)
+      DO i1 = LBOUND(OutData%cgOffTSS,1), UBOUND(OutData%cgOffTSS,1)
+        OutData%cgOffTSS(i1) = ReKiBuf(Re_Xferred)
         Re_Xferred = Re_Xferred + 1
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! CBE not allocated
+    OutData%AtfaIner = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! BldCG not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    i2_l = IntKiBuf( Int_Xferred    )
-    i2_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    i3_l = IntKiBuf( Int_Xferred    )
-    i3_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%CBE)) DEALLOCATE(OutData%CBE)
-    ALLOCATE(OutData%CBE(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%BldCG)) DEALLOCATE(OutData%BldCG)
+    ALLOCATE(OutData%BldCG(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%CBE.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%BldCG.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i3 = LBOUND(OutData%CBE,3), UBOUND(OutData%CBE,3)
-        DO i2 = LBOUND(OutData%CBE,2), UBOUND(OutData%CBE,2)
-          DO i1 = LBOUND(OutData%CBE,1), UBOUND(OutData%CBE,1)
-            OutData%CBE(i1,i2,i3) = ReKiBuf(Re_Xferred)
-            Re_Xferred = Re_Xferred + 1
-          END DO
-        END DO
+      DO i1 = LBOUND(OutData%BldCG,1), UBOUND(OutData%BldCG,1)
+        OutData%BldCG(i1) = ReKiBuf(Re_Xferred)
+        Re_Xferred = Re_Xferred + 1
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! CBF not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! BldMass not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    i2_l = IntKiBuf( Int_Xferred    )
-    i2_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    i3_l = IntKiBuf( Int_Xferred    )
-    i3_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%CBF)) DEALLOCATE(OutData%CBF)
-    ALLOCATE(OutData%CBF(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%BldMass)) DEALLOCATE(OutData%BldMass)
+    ALLOCATE(OutData%BldMass(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%CBF.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%BldMass.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i3 = LBOUND(OutData%CBF,3), UBOUND(OutData%CBF,3)
-        DO i2 = LBOUND(OutData%CBF,2), UBOUND(OutData%CBF,2)
-          DO i1 = LBOUND(OutData%CBF,1), UBOUND(OutData%CBF,1)
-            OutData%CBF(i1,i2,i3) = ReKiBuf(Re_Xferred)
-            Re_Xferred = Re_Xferred + 1
-          END DO
-        END DO
+      DO i1 = LBOUND(OutData%BldMass,1), UBOUND(OutData%BldMass,1)
+        OutData%BldMass(i1) = ReKiBuf(Re_Xferred)
+        Re_Xferred = Re_Xferred + 1
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! cgOffBEdg not allocated
+    OutData%BoomMass = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! FirstMom not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    i2_l = IntKiBuf( Int_Xferred    )
-    i2_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%cgOffBEdg)) DEALLOCATE(OutData%cgOffBEdg)
-    ALLOCATE(OutData%cgOffBEdg(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%FirstMom)) DEALLOCATE(OutData%FirstMom)
+    ALLOCATE(OutData%FirstMom(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%cgOffBEdg.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%FirstMom.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%cgOffBEdg,2), UBOUND(OutData%cgOffBEdg,2)
-        DO i1 = LBOUND(OutData%cgOffBEdg,1), UBOUND(OutData%cgOffBEdg,1)
-          OutData%cgOffBEdg(i1,i2) = ReKiBuf(Re_Xferred)
-          Re_Xferred = Re_Xferred + 1
-        END DO
+      DO i1 = LBOUND(OutData%FirstMom,1), UBOUND(OutData%FirstMom,1)
+        OutData%FirstMom(i1) = ReKiBuf(Re_Xferred)
+        Re_Xferred = Re_Xferred + 1
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! cgOffBFlp not allocated
+    OutData%GenIner = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%Hubg1Iner = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%Hubg2Iner = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%HubMass = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%Nacd2Iner = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%NacMass = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%PtfmMass = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%PtfmPIner = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%PtfmRIner = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%PtfmYIner = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%RFrlMass = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%RotIner = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%RotMass = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%RrfaIner = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! SecondMom not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    i2_l = IntKiBuf( Int_Xferred    )
-    i2_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%cgOffBFlp)) DEALLOCATE(OutData%cgOffBFlp)
-    ALLOCATE(OutData%cgOffBFlp(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%SecondMom)) DEALLOCATE(OutData%SecondMom)
+    ALLOCATE(OutData%SecondMom(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%cgOffBFlp.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%SecondMom.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%cgOffBFlp,2), UBOUND(OutData%cgOffBFlp,2)
-        DO i1 = LBOUND(OutData%cgOffBFlp,1), UBOUND(OutData%cgOffBFlp,1)
-          OutData%cgOffBFlp(i1,i2) = ReKiBuf(Re_Xferred)
-          Re_Xferred = Re_Xferred + 1
-        END DO
+      DO i1 = LBOUND(OutData%SecondMom,1), UBOUND(OutData%SecondMom,1)
+        OutData%SecondMom(i1) = ReKiBuf(Re_Xferred)
+        Re_Xferred = Re_Xferred + 1
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! Chord not allocated
+    OutData%TFinMass = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TFrlIner = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! TipMass not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%Chord)) DEALLOCATE(OutData%Chord)
-    ALLOCATE(OutData%Chord(i1_l:i1_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%TipMass)) DEALLOCATE(OutData%TipMass)
+    ALLOCATE(OutData%TipMass(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%Chord.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%TipMass.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i1 = LBOUND(OutData%Chord,1), UBOUND(OutData%Chord,1)
-        OutData%Chord(i1) = ReKiBuf(Re_Xferred)
+      DO i1 = LBOUND(OutData%TipMass,1), UBOUND(OutData%TipMass,1)
+        OutData%TipMass(i1) = ReKiBuf(Re_Xferred)
         Re_Xferred = Re_Xferred + 1
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! CThetaS not allocated
+    OutData%TurbMass = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TwrMass = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TwrTpMass = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%YawBrMass = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%Gravity = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! PitchAxis not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
@@ -21900,38 +23251,38 @@ ENDIF
     i2_l = IntKiBuf( Int_Xferred    )
     i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%CThetaS)) DEALLOCATE(OutData%CThetaS)
-    ALLOCATE(OutData%CThetaS(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%PitchAxis)) DEALLOCATE(OutData%PitchAxis)
+    ALLOCATE(OutData%PitchAxis(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%CThetaS.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%PitchAxis.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%CThetaS,2), UBOUND(OutData%CThetaS,2)
-        DO i1 = LBOUND(OutData%CThetaS,1), UBOUND(OutData%CThetaS,1)
-          OutData%CThetaS(i1,i2) = REAL(DbKiBuf(Db_Xferred), R8Ki)
-          Db_Xferred = Db_Xferred + 1
+      DO i2 = LBOUND(OutData%PitchAxis,2), UBOUND(OutData%PitchAxis,2)
+        DO i1 = LBOUND(OutData%PitchAxis,1), UBOUND(OutData%PitchAxis,1)
+          OutData%PitchAxis(i1,i2) = ReKiBuf(Re_Xferred)
+          Re_Xferred = Re_Xferred + 1
         END DO
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! DRNodes not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! AeroTwst not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%DRNodes)) DEALLOCATE(OutData%DRNodes)
-    ALLOCATE(OutData%DRNodes(i1_l:i1_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%AeroTwst)) DEALLOCATE(OutData%AeroTwst)
+    ALLOCATE(OutData%AeroTwst(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%DRNodes.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%AeroTwst.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i1 = LBOUND(OutData%DRNodes,1), UBOUND(OutData%DRNodes,1)
-        OutData%DRNodes(i1) = ReKiBuf(Re_Xferred)
+      DO i1 = LBOUND(OutData%AeroTwst,1), UBOUND(OutData%AeroTwst,1)
+        OutData%AeroTwst(i1) = ReKiBuf(Re_Xferred)
         Re_Xferred = Re_Xferred + 1
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! EAOffBEdg not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! AxRedBld not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
@@ -21941,43 +23292,30 @@ ENDIF
     i2_l = IntKiBuf( Int_Xferred    )
     i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%EAOffBEdg)) DEALLOCATE(OutData%EAOffBEdg)
-    ALLOCATE(OutData%EAOffBEdg(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%EAOffBEdg.', ErrStat, ErrMsg,RoutineName)
-       RETURN
-    END IF
-      DO i2 = LBOUND(OutData%EAOffBEdg,2), UBOUND(OutData%EAOffBEdg,2)
-        DO i1 = LBOUND(OutData%EAOffBEdg,1), UBOUND(OutData%EAOffBEdg,1)
-          OutData%EAOffBEdg(i1,i2) = ReKiBuf(Re_Xferred)
-          Re_Xferred = Re_Xferred + 1
-        END DO
-      END DO
-  END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! EAOffBFlp not allocated
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    Int_Xferred = Int_Xferred + 1
-    i1_l = IntKiBuf( Int_Xferred    )
-    i1_u = IntKiBuf( Int_Xferred + 1)
+    i3_l = IntKiBuf( Int_Xferred    )
+    i3_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    i2_l = IntKiBuf( Int_Xferred    )
-    i2_u = IntKiBuf( Int_Xferred + 1)
+    i4_l = IntKiBuf( Int_Xferred    )
+    i4_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%EAOffBFlp)) DEALLOCATE(OutData%EAOffBFlp)
-    ALLOCATE(OutData%EAOffBFlp(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%AxRedBld)) DEALLOCATE(OutData%AxRedBld)
+    ALLOCATE(OutData%AxRedBld(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u,i4_l:i4_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%EAOffBFlp.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%AxRedBld.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%EAOffBFlp,2), UBOUND(OutData%EAOffBFlp,2)
-        DO i1 = LBOUND(OutData%EAOffBFlp,1), UBOUND(OutData%EAOffBFlp,1)
-          OutData%EAOffBFlp(i1,i2) = ReKiBuf(Re_Xferred)
-          Re_Xferred = Re_Xferred + 1
+      DO i4 = LBOUND(OutData%AxRedBld,4), UBOUND(OutData%AxRedBld,4)
+        DO i3 = LBOUND(OutData%AxRedBld,3), UBOUND(OutData%AxRedBld,3)
+          DO i2 = LBOUND(OutData%AxRedBld,2), UBOUND(OutData%AxRedBld,2)
+            DO i1 = LBOUND(OutData%AxRedBld,1), UBOUND(OutData%AxRedBld,1)
+              OutData%AxRedBld(i1,i2,i3,i4) = ReKiBuf(Re_Xferred)
+              Re_Xferred = Re_Xferred + 1
+            END DO
+          END DO
         END DO
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! FStTunr not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! BAlpha not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
@@ -21987,20 +23325,20 @@ ENDIF
     i2_l = IntKiBuf( Int_Xferred    )
     i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%FStTunr)) DEALLOCATE(OutData%FStTunr)
-    ALLOCATE(OutData%FStTunr(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%BAlpha)) DEALLOCATE(OutData%BAlpha)
+    ALLOCATE(OutData%BAlpha(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%FStTunr.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%BAlpha.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%FStTunr,2), UBOUND(OutData%FStTunr,2)
-        DO i1 = LBOUND(OutData%FStTunr,1), UBOUND(OutData%FStTunr,1)
-          OutData%FStTunr(i1,i2) = ReKiBuf(Re_Xferred)
+      DO i2 = LBOUND(OutData%BAlpha,2), UBOUND(OutData%BAlpha,2)
+        DO i1 = LBOUND(OutData%BAlpha,1), UBOUND(OutData%BAlpha,1)
+          OutData%BAlpha(i1,i2) = ReKiBuf(Re_Xferred)
           Re_Xferred = Re_Xferred + 1
         END DO
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! InerBEdg not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! BldEDamp not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
@@ -22010,20 +23348,20 @@ ENDIF
     i2_l = IntKiBuf( Int_Xferred    )
     i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%InerBEdg)) DEALLOCATE(OutData%InerBEdg)
-    ALLOCATE(OutData%InerBEdg(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%BldEDamp)) DEALLOCATE(OutData%BldEDamp)
+    ALLOCATE(OutData%BldEDamp(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%InerBEdg.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%BldEDamp.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%InerBEdg,2), UBOUND(OutData%InerBEdg,2)
-        DO i1 = LBOUND(OutData%InerBEdg,1), UBOUND(OutData%InerBEdg,1)
-          OutData%InerBEdg(i1,i2) = ReKiBuf(Re_Xferred)
+      DO i2 = LBOUND(OutData%BldEDamp,2), UBOUND(OutData%BldEDamp,2)
+        DO i1 = LBOUND(OutData%BldEDamp,1), UBOUND(OutData%BldEDamp,1)
+          OutData%BldEDamp(i1,i2) = ReKiBuf(Re_Xferred)
           Re_Xferred = Re_Xferred + 1
         END DO
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! InerBFlp not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! BldFDamp not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
@@ -22033,48 +23371,40 @@ ENDIF
     i2_l = IntKiBuf( Int_Xferred    )
     i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%InerBFlp)) DEALLOCATE(OutData%InerBFlp)
-    ALLOCATE(OutData%InerBFlp(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%BldFDamp)) DEALLOCATE(OutData%BldFDamp)
+    ALLOCATE(OutData%BldFDamp(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%InerBFlp.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%BldFDamp.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%InerBFlp,2), UBOUND(OutData%InerBFlp,2)
-        DO i1 = LBOUND(OutData%InerBFlp,1), UBOUND(OutData%InerBFlp,1)
-          OutData%InerBFlp(i1,i2) = ReKiBuf(Re_Xferred)
+      DO i2 = LBOUND(OutData%BldFDamp,2), UBOUND(OutData%BldFDamp,2)
+        DO i1 = LBOUND(OutData%BldFDamp,1), UBOUND(OutData%BldFDamp,1)
+          OutData%BldFDamp(i1,i2) = ReKiBuf(Re_Xferred)
           Re_Xferred = Re_Xferred + 1
         END DO
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! KBE not allocated
+    OutData%BldFlexL = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! CAeroTwst not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    i2_l = IntKiBuf( Int_Xferred    )
-    i2_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    i3_l = IntKiBuf( Int_Xferred    )
-    i3_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%KBE)) DEALLOCATE(OutData%KBE)
-    ALLOCATE(OutData%KBE(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%CAeroTwst)) DEALLOCATE(OutData%CAeroTwst)
+    ALLOCATE(OutData%CAeroTwst(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%KBE.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%CAeroTwst.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i3 = LBOUND(OutData%KBE,3), UBOUND(OutData%KBE,3)
-        DO i2 = LBOUND(OutData%KBE,2), UBOUND(OutData%KBE,2)
-          DO i1 = LBOUND(OutData%KBE,1), UBOUND(OutData%KBE,1)
-            OutData%KBE(i1,i2,i3) = ReKiBuf(Re_Xferred)
-            Re_Xferred = Re_Xferred + 1
-          END DO
-        END DO
+      DO i1 = LBOUND(OutData%CAeroTwst,1), UBOUND(OutData%CAeroTwst,1)
+        OutData%CAeroTwst(i1) = ReKiBuf(Re_Xferred)
+        Re_Xferred = Re_Xferred + 1
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! KBF not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! CBE not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
@@ -22087,22 +23417,22 @@ ENDIF
     i3_l = IntKiBuf( Int_Xferred    )
     i3_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%KBF)) DEALLOCATE(OutData%KBF)
-    ALLOCATE(OutData%KBF(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%CBE)) DEALLOCATE(OutData%CBE)
+    ALLOCATE(OutData%CBE(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%KBF.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%CBE.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i3 = LBOUND(OutData%KBF,3), UBOUND(OutData%KBF,3)
-        DO i2 = LBOUND(OutData%KBF,2), UBOUND(OutData%KBF,2)
-          DO i1 = LBOUND(OutData%KBF,1), UBOUND(OutData%KBF,1)
-            OutData%KBF(i1,i2,i3) = ReKiBuf(Re_Xferred)
+      DO i3 = LBOUND(OutData%CBE,3), UBOUND(OutData%CBE,3)
+        DO i2 = LBOUND(OutData%CBE,2), UBOUND(OutData%CBE,2)
+          DO i1 = LBOUND(OutData%CBE,1), UBOUND(OutData%CBE,1)
+            OutData%CBE(i1,i2,i3) = ReKiBuf(Re_Xferred)
             Re_Xferred = Re_Xferred + 1
           END DO
         END DO
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! MassB not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! CBF not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
@@ -22112,20 +23442,25 @@ ENDIF
     i2_l = IntKiBuf( Int_Xferred    )
     i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%MassB)) DEALLOCATE(OutData%MassB)
-    ALLOCATE(OutData%MassB(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    i3_l = IntKiBuf( Int_Xferred    )
+    i3_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%CBF)) DEALLOCATE(OutData%CBF)
+    ALLOCATE(OutData%CBF(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%MassB.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%CBF.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%MassB,2), UBOUND(OutData%MassB,2)
-        DO i1 = LBOUND(OutData%MassB,1), UBOUND(OutData%MassB,1)
-          OutData%MassB(i1,i2) = ReKiBuf(Re_Xferred)
-          Re_Xferred = Re_Xferred + 1
+      DO i3 = LBOUND(OutData%CBF,3), UBOUND(OutData%CBF,3)
+        DO i2 = LBOUND(OutData%CBF,2), UBOUND(OutData%CBF,2)
+          DO i1 = LBOUND(OutData%CBF,1), UBOUND(OutData%CBF,1)
+            OutData%CBF(i1,i2,i3) = ReKiBuf(Re_Xferred)
+            Re_Xferred = Re_Xferred + 1
+          END DO
         END DO
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! RefAxisxb not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! cgOffBEdg not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
@@ -22135,20 +23470,20 @@ ENDIF
     i2_l = IntKiBuf( Int_Xferred    )
     i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%RefAxisxb)) DEALLOCATE(OutData%RefAxisxb)
-    ALLOCATE(OutData%RefAxisxb(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%cgOffBEdg)) DEALLOCATE(OutData%cgOffBEdg)
+    ALLOCATE(OutData%cgOffBEdg(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%RefAxisxb.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%cgOffBEdg.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%RefAxisxb,2), UBOUND(OutData%RefAxisxb,2)
-        DO i1 = LBOUND(OutData%RefAxisxb,1), UBOUND(OutData%RefAxisxb,1)
-          OutData%RefAxisxb(i1,i2) = ReKiBuf(Re_Xferred)
+      DO i2 = LBOUND(OutData%cgOffBEdg,2), UBOUND(OutData%cgOffBEdg,2)
+        DO i1 = LBOUND(OutData%cgOffBEdg,1), UBOUND(OutData%cgOffBEdg,1)
+          OutData%cgOffBEdg(i1,i2) = ReKiBuf(Re_Xferred)
           Re_Xferred = Re_Xferred + 1
         END DO
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! RefAxisyb not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! cgOffBFlp not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
@@ -22158,79 +23493,38 @@ ENDIF
     i2_l = IntKiBuf( Int_Xferred    )
     i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%RefAxisyb)) DEALLOCATE(OutData%RefAxisyb)
-    ALLOCATE(OutData%RefAxisyb(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%cgOffBFlp)) DEALLOCATE(OutData%cgOffBFlp)
+    ALLOCATE(OutData%cgOffBFlp(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%RefAxisyb.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%cgOffBFlp.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%RefAxisyb,2), UBOUND(OutData%RefAxisyb,2)
-        DO i1 = LBOUND(OutData%RefAxisyb,1), UBOUND(OutData%RefAxisyb,1)
-          OutData%RefAxisyb(i1,i2) = ReKiBuf(Re_Xferred)
+      DO i2 = LBOUND(OutData%cgOffBFlp,2), UBOUND(OutData%cgOffBFlp,2)
+        DO i1 = LBOUND(OutData%cgOffBFlp,1), UBOUND(OutData%cgOffBFlp,1)
+          OutData%cgOffBFlp(i1,i2) = ReKiBuf(Re_Xferred)
           Re_Xferred = Re_Xferred + 1
         END DO
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! RNodes not allocated
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    Int_Xferred = Int_Xferred + 1
-    i1_l = IntKiBuf( Int_Xferred    )
-    i1_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%RNodes)) DEALLOCATE(OutData%RNodes)
-    ALLOCATE(OutData%RNodes(i1_l:i1_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%RNodes.', ErrStat, ErrMsg,RoutineName)
-       RETURN
-    END IF
-      DO i1 = LBOUND(OutData%RNodes,1), UBOUND(OutData%RNodes,1)
-        OutData%RNodes(i1) = ReKiBuf(Re_Xferred)
-        Re_Xferred = Re_Xferred + 1
-      END DO
-  END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! RNodesNorm not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! Chord not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%RNodesNorm)) DEALLOCATE(OutData%RNodesNorm)
-    ALLOCATE(OutData%RNodesNorm(i1_l:i1_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%Chord)) DEALLOCATE(OutData%Chord)
+    ALLOCATE(OutData%Chord(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%RNodesNorm.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%Chord.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i1 = LBOUND(OutData%RNodesNorm,1), UBOUND(OutData%RNodesNorm,1)
-        OutData%RNodesNorm(i1) = ReKiBuf(Re_Xferred)
+      DO i1 = LBOUND(OutData%Chord,1), UBOUND(OutData%Chord,1)
+        OutData%Chord(i1) = ReKiBuf(Re_Xferred)
         Re_Xferred = Re_Xferred + 1
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! rSAerCenn1 not allocated
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    Int_Xferred = Int_Xferred + 1
-    i1_l = IntKiBuf( Int_Xferred    )
-    i1_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    i2_l = IntKiBuf( Int_Xferred    )
-    i2_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%rSAerCenn1)) DEALLOCATE(OutData%rSAerCenn1)
-    ALLOCATE(OutData%rSAerCenn1(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%rSAerCenn1.', ErrStat, ErrMsg,RoutineName)
-       RETURN
-    END IF
-      DO i2 = LBOUND(OutData%rSAerCenn1,2), UBOUND(OutData%rSAerCenn1,2)
-        DO i1 = LBOUND(OutData%rSAerCenn1,1), UBOUND(OutData%rSAerCenn1,1)
-          OutData%rSAerCenn1(i1,i2) = ReKiBuf(Re_Xferred)
-          Re_Xferred = Re_Xferred + 1
-        END DO
-      END DO
-  END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! rSAerCenn2 not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! CThetaS not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
@@ -22240,38 +23534,38 @@ ENDIF
     i2_l = IntKiBuf( Int_Xferred    )
     i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%rSAerCenn2)) DEALLOCATE(OutData%rSAerCenn2)
-    ALLOCATE(OutData%rSAerCenn2(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%CThetaS)) DEALLOCATE(OutData%CThetaS)
+    ALLOCATE(OutData%CThetaS(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%rSAerCenn2.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%CThetaS.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%rSAerCenn2,2), UBOUND(OutData%rSAerCenn2,2)
-        DO i1 = LBOUND(OutData%rSAerCenn2,1), UBOUND(OutData%rSAerCenn2,1)
-          OutData%rSAerCenn2(i1,i2) = ReKiBuf(Re_Xferred)
-          Re_Xferred = Re_Xferred + 1
+      DO i2 = LBOUND(OutData%CThetaS,2), UBOUND(OutData%CThetaS,2)
+        DO i1 = LBOUND(OutData%CThetaS,1), UBOUND(OutData%CThetaS,1)
+          OutData%CThetaS(i1,i2) = REAL(DbKiBuf(Db_Xferred), R8Ki)
+          Db_Xferred = Db_Xferred + 1
         END DO
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! SAeroTwst not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! DRNodes not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%SAeroTwst)) DEALLOCATE(OutData%SAeroTwst)
-    ALLOCATE(OutData%SAeroTwst(i1_l:i1_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%DRNodes)) DEALLOCATE(OutData%DRNodes)
+    ALLOCATE(OutData%DRNodes(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%SAeroTwst.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%DRNodes.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i1 = LBOUND(OutData%SAeroTwst,1), UBOUND(OutData%SAeroTwst,1)
-        OutData%SAeroTwst(i1) = ReKiBuf(Re_Xferred)
+      DO i1 = LBOUND(OutData%DRNodes,1), UBOUND(OutData%DRNodes,1)
+        OutData%DRNodes(i1) = ReKiBuf(Re_Xferred)
         Re_Xferred = Re_Xferred + 1
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! StiffBE not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! EAOffBEdg not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
@@ -22281,20 +23575,20 @@ ENDIF
     i2_l = IntKiBuf( Int_Xferred    )
     i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%StiffBE)) DEALLOCATE(OutData%StiffBE)
-    ALLOCATE(OutData%StiffBE(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%EAOffBEdg)) DEALLOCATE(OutData%EAOffBEdg)
+    ALLOCATE(OutData%EAOffBEdg(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%StiffBE.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%EAOffBEdg.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%StiffBE,2), UBOUND(OutData%StiffBE,2)
-        DO i1 = LBOUND(OutData%StiffBE,1), UBOUND(OutData%StiffBE,1)
-          OutData%StiffBE(i1,i2) = ReKiBuf(Re_Xferred)
+      DO i2 = LBOUND(OutData%EAOffBEdg,2), UBOUND(OutData%EAOffBEdg,2)
+        DO i1 = LBOUND(OutData%EAOffBEdg,1), UBOUND(OutData%EAOffBEdg,1)
+          OutData%EAOffBEdg(i1,i2) = ReKiBuf(Re_Xferred)
           Re_Xferred = Re_Xferred + 1
         END DO
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! StiffBEA not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! EAOffBFlp not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
@@ -22304,20 +23598,20 @@ ENDIF
     i2_l = IntKiBuf( Int_Xferred    )
     i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%StiffBEA)) DEALLOCATE(OutData%StiffBEA)
-    ALLOCATE(OutData%StiffBEA(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%EAOffBFlp)) DEALLOCATE(OutData%EAOffBFlp)
+    ALLOCATE(OutData%EAOffBFlp(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%StiffBEA.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%EAOffBFlp.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%StiffBEA,2), UBOUND(OutData%StiffBEA,2)
-        DO i1 = LBOUND(OutData%StiffBEA,1), UBOUND(OutData%StiffBEA,1)
-          OutData%StiffBEA(i1,i2) = ReKiBuf(Re_Xferred)
+      DO i2 = LBOUND(OutData%EAOffBFlp,2), UBOUND(OutData%EAOffBFlp,2)
+        DO i1 = LBOUND(OutData%EAOffBFlp,1), UBOUND(OutData%EAOffBFlp,1)
+          OutData%EAOffBFlp(i1,i2) = ReKiBuf(Re_Xferred)
           Re_Xferred = Re_Xferred + 1
         END DO
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! StiffBF not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! FStTunr not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
@@ -22327,20 +23621,20 @@ ENDIF
     i2_l = IntKiBuf( Int_Xferred    )
     i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%StiffBF)) DEALLOCATE(OutData%StiffBF)
-    ALLOCATE(OutData%StiffBF(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%FStTunr)) DEALLOCATE(OutData%FStTunr)
+    ALLOCATE(OutData%FStTunr(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%StiffBF.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%FStTunr.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%StiffBF,2), UBOUND(OutData%StiffBF,2)
-        DO i1 = LBOUND(OutData%StiffBF,1), UBOUND(OutData%StiffBF,1)
-          OutData%StiffBF(i1,i2) = ReKiBuf(Re_Xferred)
+      DO i2 = LBOUND(OutData%FStTunr,2), UBOUND(OutData%FStTunr,2)
+        DO i1 = LBOUND(OutData%FStTunr,1), UBOUND(OutData%FStTunr,1)
+          OutData%FStTunr(i1,i2) = ReKiBuf(Re_Xferred)
           Re_Xferred = Re_Xferred + 1
         END DO
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! StiffBGJ not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! InerBEdg not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
@@ -22350,20 +23644,20 @@ ENDIF
     i2_l = IntKiBuf( Int_Xferred    )
     i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%StiffBGJ)) DEALLOCATE(OutData%StiffBGJ)
-    ALLOCATE(OutData%StiffBGJ(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%InerBEdg)) DEALLOCATE(OutData%InerBEdg)
+    ALLOCATE(OutData%InerBEdg(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%StiffBGJ.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%InerBEdg.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%StiffBGJ,2), UBOUND(OutData%StiffBGJ,2)
-        DO i1 = LBOUND(OutData%StiffBGJ,1), UBOUND(OutData%StiffBGJ,1)
-          OutData%StiffBGJ(i1,i2) = ReKiBuf(Re_Xferred)
+      DO i2 = LBOUND(OutData%InerBEdg,2), UBOUND(OutData%InerBEdg,2)
+        DO i1 = LBOUND(OutData%InerBEdg,1), UBOUND(OutData%InerBEdg,1)
+          OutData%InerBEdg(i1,i2) = ReKiBuf(Re_Xferred)
           Re_Xferred = Re_Xferred + 1
         END DO
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! SThetaS not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! InerBFlp not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
@@ -22373,20 +23667,20 @@ ENDIF
     i2_l = IntKiBuf( Int_Xferred    )
     i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%SThetaS)) DEALLOCATE(OutData%SThetaS)
-    ALLOCATE(OutData%SThetaS(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%InerBFlp)) DEALLOCATE(OutData%InerBFlp)
+    ALLOCATE(OutData%InerBFlp(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%SThetaS.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%InerBFlp.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%SThetaS,2), UBOUND(OutData%SThetaS,2)
-        DO i1 = LBOUND(OutData%SThetaS,1), UBOUND(OutData%SThetaS,1)
-          OutData%SThetaS(i1,i2) = REAL(DbKiBuf(Db_Xferred), R8Ki)
-          Db_Xferred = Db_Xferred + 1
+      DO i2 = LBOUND(OutData%InerBFlp,2), UBOUND(OutData%InerBFlp,2)
+        DO i1 = LBOUND(OutData%InerBFlp,1), UBOUND(OutData%InerBFlp,1)
+          OutData%InerBFlp(i1,i2) = ReKiBuf(Re_Xferred)
+          Re_Xferred = Re_Xferred + 1
         END DO
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! ThetaS not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! KBE not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
@@ -22396,20 +23690,25 @@ ENDIF
     i2_l = IntKiBuf( Int_Xferred    )
     i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%ThetaS)) DEALLOCATE(OutData%ThetaS)
-    ALLOCATE(OutData%ThetaS(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    i3_l = IntKiBuf( Int_Xferred    )
+    i3_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%KBE)) DEALLOCATE(OutData%KBE)
+    ALLOCATE(OutData%KBE(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%ThetaS.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%KBE.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%ThetaS,2), UBOUND(OutData%ThetaS,2)
-        DO i1 = LBOUND(OutData%ThetaS,1), UBOUND(OutData%ThetaS,1)
-          OutData%ThetaS(i1,i2) = ReKiBuf(Re_Xferred)
-          Re_Xferred = Re_Xferred + 1
+      DO i3 = LBOUND(OutData%KBE,3), UBOUND(OutData%KBE,3)
+        DO i2 = LBOUND(OutData%KBE,2), UBOUND(OutData%KBE,2)
+          DO i1 = LBOUND(OutData%KBE,1), UBOUND(OutData%KBE,1)
+            OutData%KBE(i1,i2,i3) = ReKiBuf(Re_Xferred)
+            Re_Xferred = Re_Xferred + 1
+          END DO
         END DO
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! TwistedSF not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! KBF not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
@@ -22422,32 +23721,22 @@ ENDIF
     i3_l = IntKiBuf( Int_Xferred    )
     i3_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    i4_l = IntKiBuf( Int_Xferred    )
-    i4_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    i5_l = IntKiBuf( Int_Xferred    )
-    i5_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%TwistedSF)) DEALLOCATE(OutData%TwistedSF)
-    ALLOCATE(OutData%TwistedSF(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u,i4_l:i4_u,i5_l:i5_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%KBF)) DEALLOCATE(OutData%KBF)
+    ALLOCATE(OutData%KBF(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%TwistedSF.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%KBF.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i5 = LBOUND(OutData%TwistedSF,5), UBOUND(OutData%TwistedSF,5)
-        DO i4 = LBOUND(OutData%TwistedSF,4), UBOUND(OutData%TwistedSF,4)
-          DO i3 = LBOUND(OutData%TwistedSF,3), UBOUND(OutData%TwistedSF,3)
-            DO i2 = LBOUND(OutData%TwistedSF,2), UBOUND(OutData%TwistedSF,2)
-              DO i1 = LBOUND(OutData%TwistedSF,1), UBOUND(OutData%TwistedSF,1)
-                OutData%TwistedSF(i1,i2,i3,i4,i5) = ReKiBuf(Re_Xferred)
-                Re_Xferred = Re_Xferred + 1
-              END DO
-            END DO
+      DO i3 = LBOUND(OutData%KBF,3), UBOUND(OutData%KBF,3)
+        DO i2 = LBOUND(OutData%KBF,2), UBOUND(OutData%KBF,2)
+          DO i1 = LBOUND(OutData%KBF,1), UBOUND(OutData%KBF,1)
+            OutData%KBF(i1,i2,i3) = ReKiBuf(Re_Xferred)
+            Re_Xferred = Re_Xferred + 1
           END DO
         END DO
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! BldFl1Sh not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! MassB not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
@@ -22457,20 +23746,20 @@ ENDIF
     i2_l = IntKiBuf( Int_Xferred    )
     i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%BldFl1Sh)) DEALLOCATE(OutData%BldFl1Sh)
-    ALLOCATE(OutData%BldFl1Sh(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%MassB)) DEALLOCATE(OutData%MassB)
+    ALLOCATE(OutData%MassB(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%BldFl1Sh.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%MassB.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%BldFl1Sh,2), UBOUND(OutData%BldFl1Sh,2)
-        DO i1 = LBOUND(OutData%BldFl1Sh,1), UBOUND(OutData%BldFl1Sh,1)
-          OutData%BldFl1Sh(i1,i2) = ReKiBuf(Re_Xferred)
+      DO i2 = LBOUND(OutData%MassB,2), UBOUND(OutData%MassB,2)
+        DO i1 = LBOUND(OutData%MassB,1), UBOUND(OutData%MassB,1)
+          OutData%MassB(i1,i2) = ReKiBuf(Re_Xferred)
           Re_Xferred = Re_Xferred + 1
         END DO
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! BldFl2Sh not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! RefAxisxb not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
@@ -22480,20 +23769,20 @@ ENDIF
     i2_l = IntKiBuf( Int_Xferred    )
     i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%BldFl2Sh)) DEALLOCATE(OutData%BldFl2Sh)
-    ALLOCATE(OutData%BldFl2Sh(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%RefAxisxb)) DEALLOCATE(OutData%RefAxisxb)
+    ALLOCATE(OutData%RefAxisxb(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%BldFl2Sh.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%RefAxisxb.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%BldFl2Sh,2), UBOUND(OutData%BldFl2Sh,2)
-        DO i1 = LBOUND(OutData%BldFl2Sh,1), UBOUND(OutData%BldFl2Sh,1)
-          OutData%BldFl2Sh(i1,i2) = ReKiBuf(Re_Xferred)
+      DO i2 = LBOUND(OutData%RefAxisxb,2), UBOUND(OutData%RefAxisxb,2)
+        DO i1 = LBOUND(OutData%RefAxisxb,1), UBOUND(OutData%RefAxisxb,1)
+          OutData%RefAxisxb(i1,i2) = ReKiBuf(Re_Xferred)
           Re_Xferred = Re_Xferred + 1
         END DO
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! BldEdgSh not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! RefAxisyb not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
@@ -22503,190 +23792,56 @@ ENDIF
     i2_l = IntKiBuf( Int_Xferred    )
     i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%BldEdgSh)) DEALLOCATE(OutData%BldEdgSh)
-    ALLOCATE(OutData%BldEdgSh(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%RefAxisyb)) DEALLOCATE(OutData%RefAxisyb)
+    ALLOCATE(OutData%RefAxisyb(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%BldEdgSh.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%RefAxisyb.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%BldEdgSh,2), UBOUND(OutData%BldEdgSh,2)
-        DO i1 = LBOUND(OutData%BldEdgSh,1), UBOUND(OutData%BldEdgSh,1)
-          OutData%BldEdgSh(i1,i2) = ReKiBuf(Re_Xferred)
+      DO i2 = LBOUND(OutData%RefAxisyb,2), UBOUND(OutData%RefAxisyb,2)
+        DO i1 = LBOUND(OutData%RefAxisyb,1), UBOUND(OutData%RefAxisyb,1)
+          OutData%RefAxisyb(i1,i2) = ReKiBuf(Re_Xferred)
           Re_Xferred = Re_Xferred + 1
         END DO
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! FreqBE not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! RNodes not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    i2_l = IntKiBuf( Int_Xferred    )
-    i2_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    i3_l = IntKiBuf( Int_Xferred    )
-    i3_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%FreqBE)) DEALLOCATE(OutData%FreqBE)
-    ALLOCATE(OutData%FreqBE(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%RNodes)) DEALLOCATE(OutData%RNodes)
+    ALLOCATE(OutData%RNodes(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%FreqBE.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%RNodes.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i3 = LBOUND(OutData%FreqBE,3), UBOUND(OutData%FreqBE,3)
-        DO i2 = LBOUND(OutData%FreqBE,2), UBOUND(OutData%FreqBE,2)
-          DO i1 = LBOUND(OutData%FreqBE,1), UBOUND(OutData%FreqBE,1)
-            OutData%FreqBE(i1,i2,i3) = ReKiBuf(Re_Xferred)
-            Re_Xferred = Re_Xferred + 1
-          END DO
-        END DO
+      DO i1 = LBOUND(OutData%RNodes,1), UBOUND(OutData%RNodes,1)
+        OutData%RNodes(i1) = ReKiBuf(Re_Xferred)
+        Re_Xferred = Re_Xferred + 1
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! FreqBF not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! RNodesNorm not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    i2_l = IntKiBuf( Int_Xferred    )
-    i2_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    i3_l = IntKiBuf( Int_Xferred    )
-    i3_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%FreqBF)) DEALLOCATE(OutData%FreqBF)
-    ALLOCATE(OutData%FreqBF(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%RNodesNorm)) DEALLOCATE(OutData%RNodesNorm)
+    ALLOCATE(OutData%RNodesNorm(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%FreqBF.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%RNodesNorm.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i3 = LBOUND(OutData%FreqBF,3), UBOUND(OutData%FreqBF,3)
-        DO i2 = LBOUND(OutData%FreqBF,2), UBOUND(OutData%FreqBF,2)
-          DO i1 = LBOUND(OutData%FreqBF,1), UBOUND(OutData%FreqBF,1)
-            OutData%FreqBF(i1,i2,i3) = ReKiBuf(Re_Xferred)
-            Re_Xferred = Re_Xferred + 1
-          END DO
-        END DO
-      END DO
-  END IF
-    i1_l = LBOUND(OutData%FreqTFA,1)
-    i1_u = UBOUND(OutData%FreqTFA,1)
-    i2_l = LBOUND(OutData%FreqTFA,2)
-    i2_u = UBOUND(OutData%FreqTFA,2)
-    DO i2 = LBOUND(OutData%FreqTFA,2), UBOUND(OutData%FreqTFA,2)
-      DO i1 = LBOUND(OutData%FreqTFA,1), UBOUND(OutData%FreqTFA,1)
-        OutData%FreqTFA(i1,i2) = ReKiBuf(Re_Xferred)
-        Re_Xferred = Re_Xferred + 1
-      END DO
-    END DO
-    i1_l = LBOUND(OutData%FreqTSS,1)
-    i1_u = UBOUND(OutData%FreqTSS,1)
-    i2_l = LBOUND(OutData%FreqTSS,2)
-    i2_u = UBOUND(OutData%FreqTSS,2)
-    DO i2 = LBOUND(OutData%FreqTSS,2), UBOUND(OutData%FreqTSS,2)
-      DO i1 = LBOUND(OutData%FreqTSS,1), UBOUND(OutData%FreqTSS,1)
-        OutData%FreqTSS(i1,i2) = ReKiBuf(Re_Xferred)
-        Re_Xferred = Re_Xferred + 1
-      END DO
-    END DO
-    OutData%TeetCDmp = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TeetDmp = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TeetDmpP = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TeetHSSp = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TeetHStP = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TeetSSSp = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TeetSStP = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TeetMod = IntKiBuf(Int_Xferred)
-    Int_Xferred = Int_Xferred + 1
-    OutData%TFrlCDmp = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TFrlDmp = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TFrlDSDmp = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TFrlDSDP = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TFrlDSSP = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TFrlDSSpr = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TFrlSpr = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TFrlUSDmp = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TFrlUSDP = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TFrlUSSP = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TFrlUSSpr = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%TFrlMod = IntKiBuf(Int_Xferred)
-    Int_Xferred = Int_Xferred + 1
-    OutData%RFrlCDmp = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%RFrlDmp = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%RFrlDSDmp = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%RFrlDSDP = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%RFrlDSSP = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%RFrlDSSpr = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%RFrlSpr = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%RFrlUSDmp = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%RFrlUSDP = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%RFrlUSSP = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%RFrlUSSpr = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%RFrlMod = IntKiBuf(Int_Xferred)
-    Int_Xferred = Int_Xferred + 1
-    OutData%ShftGagL = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    i1_l = LBOUND(OutData%BldGagNd,1)
-    i1_u = UBOUND(OutData%BldGagNd,1)
-    DO i1 = LBOUND(OutData%BldGagNd,1), UBOUND(OutData%BldGagNd,1)
-      OutData%BldGagNd(i1) = IntKiBuf(Int_Xferred)
-      Int_Xferred = Int_Xferred + 1
-    END DO
-    i1_l = LBOUND(OutData%TwrGagNd,1)
-    i1_u = UBOUND(OutData%TwrGagNd,1)
-    DO i1 = LBOUND(OutData%TwrGagNd,1), UBOUND(OutData%TwrGagNd,1)
-      OutData%TwrGagNd(i1) = IntKiBuf(Int_Xferred)
-      Int_Xferred = Int_Xferred + 1
-    END DO
-    OutData%TStart = DbKiBuf(Db_Xferred)
-    Db_Xferred = Db_Xferred + 1
-    OutData%DTTorDmp = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%DTTorSpr = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%GBRatio = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%GBoxEff = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%RotSpeed = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    DO I = 1, LEN(OutData%RootName)
-      OutData%RootName(I:I) = CHAR(IntKiBuf(Int_Xferred))
-      Int_Xferred = Int_Xferred + 1
-    END DO ! I
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! BElmntMass not allocated
+      DO i1 = LBOUND(OutData%RNodesNorm,1), UBOUND(OutData%RNodesNorm,1)
+        OutData%RNodesNorm(i1) = ReKiBuf(Re_Xferred)
+        Re_Xferred = Re_Xferred + 1
+      END DO
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! rSAerCenn1 not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
@@ -22696,126 +23851,61 @@ ENDIF
     i2_l = IntKiBuf( Int_Xferred    )
     i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%BElmntMass)) DEALLOCATE(OutData%BElmntMass)
-    ALLOCATE(OutData%BElmntMass(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%rSAerCenn1)) DEALLOCATE(OutData%rSAerCenn1)
+    ALLOCATE(OutData%rSAerCenn1(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%BElmntMass.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%rSAerCenn1.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%BElmntMass,2), UBOUND(OutData%BElmntMass,2)
-        DO i1 = LBOUND(OutData%BElmntMass,1), UBOUND(OutData%BElmntMass,1)
-          OutData%BElmntMass(i1,i2) = ReKiBuf(Re_Xferred)
+      DO i2 = LBOUND(OutData%rSAerCenn1,2), UBOUND(OutData%rSAerCenn1,2)
+        DO i1 = LBOUND(OutData%rSAerCenn1,1), UBOUND(OutData%rSAerCenn1,1)
+          OutData%rSAerCenn1(i1,i2) = ReKiBuf(Re_Xferred)
           Re_Xferred = Re_Xferred + 1
         END DO
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! TElmntMass not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! rSAerCenn2 not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%TElmntMass)) DEALLOCATE(OutData%TElmntMass)
-    ALLOCATE(OutData%TElmntMass(i1_l:i1_u),STAT=ErrStat2)
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%rSAerCenn2)) DEALLOCATE(OutData%rSAerCenn2)
+    ALLOCATE(OutData%rSAerCenn2(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%TElmntMass.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%rSAerCenn2.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i1 = LBOUND(OutData%TElmntMass,1), UBOUND(OutData%TElmntMass,1)
-        OutData%TElmntMass(i1) = ReKiBuf(Re_Xferred)
-        Re_Xferred = Re_Xferred + 1
+      DO i2 = LBOUND(OutData%rSAerCenn2,2), UBOUND(OutData%rSAerCenn2,2)
+        DO i1 = LBOUND(OutData%rSAerCenn2,1), UBOUND(OutData%rSAerCenn2,1)
+          OutData%rSAerCenn2(i1,i2) = ReKiBuf(Re_Xferred)
+          Re_Xferred = Re_Xferred + 1
+        END DO
       END DO
   END IF
-    OutData%method = IntKiBuf(Int_Xferred)
-    Int_Xferred = Int_Xferred + 1
-    OutData%PtfmCMxt = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%PtfmCMyt = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%BD4Blades = TRANSFER(IntKiBuf(Int_Xferred), OutData%BD4Blades)
-    Int_Xferred = Int_Xferred + 1
-    OutData%UseAD14 = TRANSFER(IntKiBuf(Int_Xferred), OutData%UseAD14)
-    Int_Xferred = Int_Xferred + 1
-    i1_l = LBOUND(OutData%DTLInpTrq,1)
-    i1_u = UBOUND(OutData%DTLInpTrq,1)
-    DO i1 = LBOUND(OutData%DTLInpTrq,1), UBOUND(OutData%DTLInpTrq,1)
-      OutData%DTLInpTrq(i1) = ReKiBuf(Re_Xferred)
-      Re_Xferred = Re_Xferred + 1
-    END DO
-    i1_l = LBOUND(OutData%DTLTrq,1)
-    i1_u = UBOUND(OutData%DTLTrq,1)
-    DO i1 = LBOUND(OutData%DTLTrq,1), UBOUND(OutData%DTLTrq,1)
-      OutData%DTLTrq(i1) = ReKiBuf(Re_Xferred)
-      Re_Xferred = Re_Xferred + 1
-    END DO
-    OutData%DTLInpN = IntKiBuf(Int_Xferred)
-    Int_Xferred = Int_Xferred + 1
-    OutData%DTLoss = TRANSFER(IntKiBuf(Int_Xferred), OutData%DTLoss)
-    Int_Xferred = Int_Xferred + 1
-    OutData%BldNd_NumOuts = IntKiBuf(Int_Xferred)
-    Int_Xferred = Int_Xferred + 1
-    OutData%BldNd_TotNumOuts = IntKiBuf(Int_Xferred)
-    Int_Xferred = Int_Xferred + 1
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! BldNd_OutParam not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! SAeroTwst not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%BldNd_OutParam)) DEALLOCATE(OutData%BldNd_OutParam)
-    ALLOCATE(OutData%BldNd_OutParam(i1_l:i1_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%SAeroTwst)) DEALLOCATE(OutData%SAeroTwst)
+    ALLOCATE(OutData%SAeroTwst(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%BldNd_OutParam.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%SAeroTwst.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-    DO i1 = LBOUND(OutData%BldNd_OutParam,1), UBOUND(OutData%BldNd_OutParam,1)
-      Buf_size=IntKiBuf( Int_Xferred )
-      Int_Xferred = Int_Xferred + 1
-      IF(Buf_size > 0) THEN
-        ALLOCATE(Re_Buf(Buf_size),STAT=ErrStat2)
-        IF (ErrStat2 /= 0) THEN 
-           CALL SetErrStat(ErrID_Fatal, 'Error allocating Re_Buf.', ErrStat, ErrMsg,RoutineName)
-           RETURN
-        END IF
-        Re_Buf = ReKiBuf( Re_Xferred:Re_Xferred+Buf_size-1 )
-        Re_Xferred = Re_Xferred + Buf_size
-      END IF
-      Buf_size=IntKiBuf( Int_Xferred )
-      Int_Xferred = Int_Xferred + 1
-      IF(Buf_size > 0) THEN
-        ALLOCATE(Db_Buf(Buf_size),STAT=ErrStat2)
-        IF (ErrStat2 /= 0) THEN 
-           CALL SetErrStat(ErrID_Fatal, 'Error allocating Db_Buf.', ErrStat, ErrMsg,RoutineName)
-           RETURN
-        END IF
-        Db_Buf = DbKiBuf( Db_Xferred:Db_Xferred+Buf_size-1 )
-        Db_Xferred = Db_Xferred + Buf_size
-      END IF
-      Buf_size=IntKiBuf( Int_Xferred )
-      Int_Xferred = Int_Xferred + 1
-      IF(Buf_size > 0) THEN
-        ALLOCATE(Int_Buf(Buf_size),STAT=ErrStat2)
-        IF (ErrStat2 /= 0) THEN 
-           CALL SetErrStat(ErrID_Fatal, 'Error allocating Int_Buf.', ErrStat, ErrMsg,RoutineName)
-           RETURN
-        END IF
-        Int_Buf = IntKiBuf( Int_Xferred:Int_Xferred+Buf_size-1 )
-        Int_Xferred = Int_Xferred + Buf_size
-      END IF
-      CALL NWTC_Library_Unpackoutparmtype( Re_Buf, Db_Buf, Int_Buf, OutData%BldNd_OutParam(i1), ErrStat2, ErrMsg2 ) ! BldNd_OutParam 
-        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-        IF (ErrStat >= AbortErrLev) RETURN
-
-      IF(ALLOCATED(Re_Buf )) DEALLOCATE(Re_Buf )
-      IF(ALLOCATED(Db_Buf )) DEALLOCATE(Db_Buf )
-      IF(ALLOCATED(Int_Buf)) DEALLOCATE(Int_Buf)
-    END DO
+      DO i1 = LBOUND(OutData%SAeroTwst,1), UBOUND(OutData%SAeroTwst,1)
+        OutData%SAeroTwst(i1) = ReKiBuf(Re_Xferred)
+        Re_Xferred = Re_Xferred + 1
+      END DO
   END IF
-    OutData%BldNd_BladesOut = IntKiBuf(Int_Xferred)
-    Int_Xferred = Int_Xferred + 1
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! Jac_u_indx not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! StiffBE not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
@@ -22825,600 +23915,496 @@ ENDIF
     i2_l = IntKiBuf( Int_Xferred    )
     i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%Jac_u_indx)) DEALLOCATE(OutData%Jac_u_indx)
-    ALLOCATE(OutData%Jac_u_indx(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%StiffBE)) DEALLOCATE(OutData%StiffBE)
+    ALLOCATE(OutData%StiffBE(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%Jac_u_indx.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%StiffBE.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i2 = LBOUND(OutData%Jac_u_indx,2), UBOUND(OutData%Jac_u_indx,2)
-        DO i1 = LBOUND(OutData%Jac_u_indx,1), UBOUND(OutData%Jac_u_indx,1)
-          OutData%Jac_u_indx(i1,i2) = IntKiBuf(Int_Xferred)
-          Int_Xferred = Int_Xferred + 1
+      DO i2 = LBOUND(OutData%StiffBE,2), UBOUND(OutData%StiffBE,2)
+        DO i1 = LBOUND(OutData%StiffBE,1), UBOUND(OutData%StiffBE,1)
+          OutData%StiffBE(i1,i2) = ReKiBuf(Re_Xferred)
+          Re_Xferred = Re_Xferred + 1
         END DO
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! du not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! StiffBEA not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%du)) DEALLOCATE(OutData%du)
-    ALLOCATE(OutData%du(i1_l:i1_u),STAT=ErrStat2)
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%StiffBEA)) DEALLOCATE(OutData%StiffBEA)
+    ALLOCATE(OutData%StiffBEA(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%du.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%StiffBEA.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i1 = LBOUND(OutData%du,1), UBOUND(OutData%du,1)
-        OutData%du(i1) = REAL(DbKiBuf(Db_Xferred), R8Ki)
-        Db_Xferred = Db_Xferred + 1
+      DO i2 = LBOUND(OutData%StiffBEA,2), UBOUND(OutData%StiffBEA,2)
+        DO i1 = LBOUND(OutData%StiffBEA,1), UBOUND(OutData%StiffBEA,1)
+          OutData%StiffBEA(i1,i2) = ReKiBuf(Re_Xferred)
+          Re_Xferred = Re_Xferred + 1
+        END DO
       END DO
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! dx not allocated
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! StiffBF not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%dx)) DEALLOCATE(OutData%dx)
-    ALLOCATE(OutData%dx(i1_l:i1_u),STAT=ErrStat2)
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%StiffBF)) DEALLOCATE(OutData%StiffBF)
+    ALLOCATE(OutData%StiffBF(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%dx.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%StiffBF.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i1 = LBOUND(OutData%dx,1), UBOUND(OutData%dx,1)
-        OutData%dx(i1) = REAL(DbKiBuf(Db_Xferred), R8Ki)
-        Db_Xferred = Db_Xferred + 1
+      DO i2 = LBOUND(OutData%StiffBF,2), UBOUND(OutData%StiffBF,2)
+        DO i1 = LBOUND(OutData%StiffBF,1), UBOUND(OutData%StiffBF,1)
+          OutData%StiffBF(i1,i2) = ReKiBuf(Re_Xferred)
+          Re_Xferred = Re_Xferred + 1
+        END DO
       END DO
   END IF
-    OutData%Jac_ny = IntKiBuf(Int_Xferred)
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! StiffBGJ not allocated
     Int_Xferred = Int_Xferred + 1
- END SUBROUTINE ED_UnPackParam
-
- SUBROUTINE ED_CopyInput( SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg )
-   TYPE(ED_InputType), INTENT(INOUT) :: SrcInputData
-   TYPE(ED_InputType), INTENT(INOUT) :: DstInputData
-   INTEGER(IntKi),  INTENT(IN   ) :: CtrlCode
-   INTEGER(IntKi),  INTENT(  OUT) :: ErrStat
-   CHARACTER(*),    INTENT(  OUT) :: ErrMsg
-! Local 
-   INTEGER(IntKi)                 :: i,j,k
-   INTEGER(IntKi)                 :: i1, i1_l, i1_u  !  bounds (upper/lower) for an array dimension 1
-   INTEGER(IntKi)                 :: i2, i2_l, i2_u  !  bounds (upper/lower) for an array dimension 2
-   INTEGER(IntKi)                 :: i3, i3_l, i3_u  !  bounds (upper/lower) for an array dimension 3
-   INTEGER(IntKi)                 :: ErrStat2
-   CHARACTER(ErrMsgLen)           :: ErrMsg2
-   CHARACTER(*), PARAMETER        :: RoutineName = 'ED_CopyInput'
-! 
-   ErrStat = ErrID_None
-   ErrMsg  = ""
-IF (ALLOCATED(SrcInputData%BladePtLoads)) THEN
-  i1_l = LBOUND(SrcInputData%BladePtLoads,1)
-  i1_u = UBOUND(SrcInputData%BladePtLoads,1)
-  IF (.NOT. ALLOCATED(DstInputData%BladePtLoads)) THEN 
-    ALLOCATE(DstInputData%BladePtLoads(i1_l:i1_u),STAT=ErrStat2)
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%StiffBGJ)) DEALLOCATE(OutData%StiffBGJ)
+    ALLOCATE(OutData%StiffBGJ(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstInputData%BladePtLoads.', ErrStat, ErrMsg,RoutineName)
-      RETURN
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%StiffBGJ.', ErrStat, ErrMsg,RoutineName)
+       RETURN
     END IF
+      DO i2 = LBOUND(OutData%StiffBGJ,2), UBOUND(OutData%StiffBGJ,2)
+        DO i1 = LBOUND(OutData%StiffBGJ,1), UBOUND(OutData%StiffBGJ,1)
+          OutData%StiffBGJ(i1,i2) = ReKiBuf(Re_Xferred)
+          Re_Xferred = Re_Xferred + 1
+        END DO
+      END DO
   END IF
-    DO i1 = LBOUND(SrcInputData%BladePtLoads,1), UBOUND(SrcInputData%BladePtLoads,1)
-      CALL MeshCopy( SrcInputData%BladePtLoads(i1), DstInputData%BladePtLoads(i1), CtrlCode, ErrStat2, ErrMsg2 )
-         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-         IF (ErrStat>=AbortErrLev) RETURN
-    ENDDO
-ENDIF
-      CALL MeshCopy( SrcInputData%PlatformPtMesh, DstInputData%PlatformPtMesh, CtrlCode, ErrStat2, ErrMsg2 )
-         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-         IF (ErrStat>=AbortErrLev) RETURN
-      CALL MeshCopy( SrcInputData%TowerPtLoads, DstInputData%TowerPtLoads, CtrlCode, ErrStat2, ErrMsg2 )
-         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-         IF (ErrStat>=AbortErrLev) RETURN
-      CALL MeshCopy( SrcInputData%HubPtLoad, DstInputData%HubPtLoad, CtrlCode, ErrStat2, ErrMsg2 )
-         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-         IF (ErrStat>=AbortErrLev) RETURN
-      CALL MeshCopy( SrcInputData%NacelleLoads, DstInputData%NacelleLoads, CtrlCode, ErrStat2, ErrMsg2 )
-         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-         IF (ErrStat>=AbortErrLev) RETURN
-IF (ALLOCATED(SrcInputData%TwrAddedMass)) THEN
-  i1_l = LBOUND(SrcInputData%TwrAddedMass,1)
-  i1_u = UBOUND(SrcInputData%TwrAddedMass,1)
-  i2_l = LBOUND(SrcInputData%TwrAddedMass,2)
-  i2_u = UBOUND(SrcInputData%TwrAddedMass,2)
-  i3_l = LBOUND(SrcInputData%TwrAddedMass,3)
-  i3_u = UBOUND(SrcInputData%TwrAddedMass,3)
-  IF (.NOT. ALLOCATED(DstInputData%TwrAddedMass)) THEN 
-    ALLOCATE(DstInputData%TwrAddedMass(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! SThetaS not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%SThetaS)) DEALLOCATE(OutData%SThetaS)
+    ALLOCATE(OutData%SThetaS(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstInputData%TwrAddedMass.', ErrStat, ErrMsg,RoutineName)
-      RETURN
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%SThetaS.', ErrStat, ErrMsg,RoutineName)
+       RETURN
     END IF
+      DO i2 = LBOUND(OutData%SThetaS,2), UBOUND(OutData%SThetaS,2)
+        DO i1 = LBOUND(OutData%SThetaS,1), UBOUND(OutData%SThetaS,1)
+          OutData%SThetaS(i1,i2) = REAL(DbKiBuf(Db_Xferred), R8Ki)
+          Db_Xferred = Db_Xferred + 1
+        END DO
+      END DO
   END IF
-    DstInputData%TwrAddedMass = SrcInputData%TwrAddedMass
-ENDIF
-    DstInputData%PtfmAddedMass = SrcInputData%PtfmAddedMass
-IF (ALLOCATED(SrcInputData%BlPitchCom)) THEN
-  i1_l = LBOUND(SrcInputData%BlPitchCom,1)
-  i1_u = UBOUND(SrcInputData%BlPitchCom,1)
-  IF (.NOT. ALLOCATED(DstInputData%BlPitchCom)) THEN 
-    ALLOCATE(DstInputData%BlPitchCom(i1_l:i1_u),STAT=ErrStat2)
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! ThetaS not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%ThetaS)) DEALLOCATE(OutData%ThetaS)
+    ALLOCATE(OutData%ThetaS(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstInputData%BlPitchCom.', ErrStat, ErrMsg,RoutineName)
-      RETURN
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%ThetaS.', ErrStat, ErrMsg,RoutineName)
+       RETURN
     END IF
+      DO i2 = LBOUND(OutData%ThetaS,2), UBOUND(OutData%ThetaS,2)
+        DO i1 = LBOUND(OutData%ThetaS,1), UBOUND(OutData%ThetaS,1)
+          OutData%ThetaS(i1,i2) = ReKiBuf(Re_Xferred)
+          Re_Xferred = Re_Xferred + 1
+        END DO
+      END DO
   END IF
-    DstInputData%BlPitchCom = SrcInputData%BlPitchCom
-ENDIF
-    DstInputData%YawMom = SrcInputData%YawMom
-    DstInputData%GenTrq = SrcInputData%GenTrq
-    DstInputData%HSSBrTrqC = SrcInputData%HSSBrTrqC
- END SUBROUTINE ED_CopyInput
-
- SUBROUTINE ED_DestroyInput( InputData, ErrStat, ErrMsg, DEALLOCATEpointers )
-  TYPE(ED_InputType), INTENT(INOUT) :: InputData
-  INTEGER(IntKi),  INTENT(  OUT) :: ErrStat
-  CHARACTER(*),    INTENT(  OUT) :: ErrMsg
-  LOGICAL,OPTIONAL,INTENT(IN   ) :: DEALLOCATEpointers
-  
-  INTEGER(IntKi)                 :: i, i1, i2, i3, i4, i5 
-  LOGICAL                        :: DEALLOCATEpointers_local
-  INTEGER(IntKi)                 :: ErrStat2
-  CHARACTER(ErrMsgLen)           :: ErrMsg2
-  CHARACTER(*),    PARAMETER :: RoutineName = 'ED_DestroyInput'
-
-  ErrStat = ErrID_None
-  ErrMsg  = ""
-
-  IF (PRESENT(DEALLOCATEpointers)) THEN
-     DEALLOCATEpointers_local = DEALLOCATEpointers
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! TwistedSF not allocated
+    Int_Xferred = Int_Xferred + 1
   ELSE
-     DEALLOCATEpointers_local = .true.
-  END IF
-  
-IF (ALLOCATED(InputData%BladePtLoads)) THEN
-DO i1 = LBOUND(InputData%BladePtLoads,1), UBOUND(InputData%BladePtLoads,1)
-  CALL MeshDestroy( InputData%BladePtLoads(i1), ErrStat2, ErrMsg2 )
-     CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-ENDDO
-  DEALLOCATE(InputData%BladePtLoads)
-ENDIF
-  CALL MeshDestroy( InputData%PlatformPtMesh, ErrStat2, ErrMsg2 )
-     CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-  CALL MeshDestroy( InputData%TowerPtLoads, ErrStat2, ErrMsg2 )
-     CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-  CALL MeshDestroy( InputData%HubPtLoad, ErrStat2, ErrMsg2 )
-     CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-  CALL MeshDestroy( InputData%NacelleLoads, ErrStat2, ErrMsg2 )
-     CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-IF (ALLOCATED(InputData%TwrAddedMass)) THEN
-  DEALLOCATE(InputData%TwrAddedMass)
-ENDIF
-IF (ALLOCATED(InputData%BlPitchCom)) THEN
-  DEALLOCATE(InputData%BlPitchCom)
-ENDIF
- END SUBROUTINE ED_DestroyInput
-
- SUBROUTINE ED_PackInput( ReKiBuf, DbKiBuf, IntKiBuf, Indata, ErrStat, ErrMsg, SizeOnly )
-  REAL(ReKi),       ALLOCATABLE, INTENT(  OUT) :: ReKiBuf(:)
-  REAL(DbKi),       ALLOCATABLE, INTENT(  OUT) :: DbKiBuf(:)
-  INTEGER(IntKi),   ALLOCATABLE, INTENT(  OUT) :: IntKiBuf(:)
-  TYPE(ED_InputType),  INTENT(IN) :: InData
-  INTEGER(IntKi),   INTENT(  OUT) :: ErrStat
-  CHARACTER(*),     INTENT(  OUT) :: ErrMsg
-  LOGICAL,OPTIONAL, INTENT(IN   ) :: SizeOnly
-    ! Local variables
-  INTEGER(IntKi)                 :: Re_BufSz
-  INTEGER(IntKi)                 :: Re_Xferred
-  INTEGER(IntKi)                 :: Db_BufSz
-  INTEGER(IntKi)                 :: Db_Xferred
-  INTEGER(IntKi)                 :: Int_BufSz
-  INTEGER(IntKi)                 :: Int_Xferred
-  INTEGER(IntKi)                 :: i,i1,i2,i3,i4,i5
-  LOGICAL                        :: OnlySize ! if present and true, do not pack, just allocate buffers
-  INTEGER(IntKi)                 :: ErrStat2
-  CHARACTER(ErrMsgLen)           :: ErrMsg2
-  CHARACTER(*), PARAMETER        :: RoutineName = 'ED_PackInput'
- ! buffers to store subtypes, if any
-  REAL(ReKi),      ALLOCATABLE   :: Re_Buf(:)
-  REAL(DbKi),      ALLOCATABLE   :: Db_Buf(:)
-  INTEGER(IntKi),  ALLOCATABLE   :: Int_Buf(:)
-
-  OnlySize = .FALSE.
-  IF ( PRESENT(SizeOnly) ) THEN
-    OnlySize = SizeOnly
-  ENDIF
-    !
-  ErrStat = ErrID_None
-  ErrMsg  = ""
-  Re_BufSz  = 0
-  Db_BufSz  = 0
-  Int_BufSz  = 0
-  Int_BufSz   = Int_BufSz   + 1     ! BladePtLoads allocated yes/no
-  IF ( ALLOCATED(InData%BladePtLoads) ) THEN
-    Int_BufSz   = Int_BufSz   + 2*1  ! BladePtLoads upper/lower bounds for each dimension
-   ! Allocate buffers for subtypes, if any (we'll get sizes from these) 
-    DO i1 = LBOUND(InData%BladePtLoads,1), UBOUND(InData%BladePtLoads,1)
-      Int_BufSz   = Int_BufSz + 3  ! BladePtLoads: size of buffers for each call to pack subtype
-      CALL MeshPack( InData%BladePtLoads(i1), Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2, .TRUE. ) ! BladePtLoads 
-        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-        IF (ErrStat >= AbortErrLev) RETURN
-
-      IF(ALLOCATED(Re_Buf)) THEN ! BladePtLoads
-         Re_BufSz  = Re_BufSz  + SIZE( Re_Buf  )
-         DEALLOCATE(Re_Buf)
-      END IF
-      IF(ALLOCATED(Db_Buf)) THEN ! BladePtLoads
-         Db_BufSz  = Db_BufSz  + SIZE( Db_Buf  )
-         DEALLOCATE(Db_Buf)
-      END IF
-      IF(ALLOCATED(Int_Buf)) THEN ! BladePtLoads
-         Int_BufSz = Int_BufSz + SIZE( Int_Buf )
-         DEALLOCATE(Int_Buf)
-      END IF
-    END DO
-  END IF
-      Int_BufSz   = Int_BufSz + 3  ! PlatformPtMesh: size of buffers for each call to pack subtype
-      CALL MeshPack( InData%PlatformPtMesh, Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2, .TRUE. ) ! PlatformPtMesh 
-        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-        IF (ErrStat >= AbortErrLev) RETURN
-
-      IF(ALLOCATED(Re_Buf)) THEN ! PlatformPtMesh
-         Re_BufSz  = Re_BufSz  + SIZE( Re_Buf  )
-         DEALLOCATE(Re_Buf)
-      END IF
-      IF(ALLOCATED(Db_Buf)) THEN ! PlatformPtMesh
-         Db_BufSz  = Db_BufSz  + SIZE( Db_Buf  )
-         DEALLOCATE(Db_Buf)
-      END IF
-      IF(ALLOCATED(Int_Buf)) THEN ! PlatformPtMesh
-         Int_BufSz = Int_BufSz + SIZE( Int_Buf )
-         DEALLOCATE(Int_Buf)
-      END IF
-      Int_BufSz   = Int_BufSz + 3  ! TowerPtLoads: size of buffers for each call to pack subtype
-      CALL MeshPack( InData%TowerPtLoads, Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2, .TRUE. ) ! TowerPtLoads 
-        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-        IF (ErrStat >= AbortErrLev) RETURN
-
-      IF(ALLOCATED(Re_Buf)) THEN ! TowerPtLoads
-         Re_BufSz  = Re_BufSz  + SIZE( Re_Buf  )
-         DEALLOCATE(Re_Buf)
-      END IF
-      IF(ALLOCATED(Db_Buf)) THEN ! TowerPtLoads
-         Db_BufSz  = Db_BufSz  + SIZE( Db_Buf  )
-         DEALLOCATE(Db_Buf)
-      END IF
-      IF(ALLOCATED(Int_Buf)) THEN ! TowerPtLoads
-         Int_BufSz = Int_BufSz + SIZE( Int_Buf )
-         DEALLOCATE(Int_Buf)
-      END IF
-      Int_BufSz   = Int_BufSz + 3  ! HubPtLoad: size of buffers for each call to pack subtype
-      CALL MeshPack( InData%HubPtLoad, Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2, .TRUE. ) ! HubPtLoad 
-        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-        IF (ErrStat >= AbortErrLev) RETURN
-
-      IF(ALLOCATED(Re_Buf)) THEN ! HubPtLoad
-         Re_BufSz  = Re_BufSz  + SIZE( Re_Buf  )
-         DEALLOCATE(Re_Buf)
-      END IF
-      IF(ALLOCATED(Db_Buf)) THEN ! HubPtLoad
-         Db_BufSz  = Db_BufSz  + SIZE( Db_Buf  )
-         DEALLOCATE(Db_Buf)
-      END IF
-      IF(ALLOCATED(Int_Buf)) THEN ! HubPtLoad
-         Int_BufSz = Int_BufSz + SIZE( Int_Buf )
-         DEALLOCATE(Int_Buf)
-      END IF
-      Int_BufSz   = Int_BufSz + 3  ! NacelleLoads: size of buffers for each call to pack subtype
-      CALL MeshPack( InData%NacelleLoads, Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2, .TRUE. ) ! NacelleLoads 
-        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-        IF (ErrStat >= AbortErrLev) RETURN
-
-      IF(ALLOCATED(Re_Buf)) THEN ! NacelleLoads
-         Re_BufSz  = Re_BufSz  + SIZE( Re_Buf  )
-         DEALLOCATE(Re_Buf)
-      END IF
-      IF(ALLOCATED(Db_Buf)) THEN ! NacelleLoads
-         Db_BufSz  = Db_BufSz  + SIZE( Db_Buf  )
-         DEALLOCATE(Db_Buf)
-      END IF
-      IF(ALLOCATED(Int_Buf)) THEN ! NacelleLoads
-         Int_BufSz = Int_BufSz + SIZE( Int_Buf )
-         DEALLOCATE(Int_Buf)
-      END IF
-  Int_BufSz   = Int_BufSz   + 1     ! TwrAddedMass allocated yes/no
-  IF ( ALLOCATED(InData%TwrAddedMass) ) THEN
-    Int_BufSz   = Int_BufSz   + 2*3  ! TwrAddedMass upper/lower bounds for each dimension
-      Re_BufSz   = Re_BufSz   + SIZE(InData%TwrAddedMass)  ! TwrAddedMass
-  END IF
-      Re_BufSz   = Re_BufSz   + SIZE(InData%PtfmAddedMass)  ! PtfmAddedMass
-  Int_BufSz   = Int_BufSz   + 1     ! BlPitchCom allocated yes/no
-  IF ( ALLOCATED(InData%BlPitchCom) ) THEN
-    Int_BufSz   = Int_BufSz   + 2*1  ! BlPitchCom upper/lower bounds for each dimension
-      Re_BufSz   = Re_BufSz   + SIZE(InData%BlPitchCom)  ! BlPitchCom
-  END IF
-      Re_BufSz   = Re_BufSz   + 1  ! YawMom
-      Re_BufSz   = Re_BufSz   + 1  ! GenTrq
-      Re_BufSz   = Re_BufSz   + 1  ! HSSBrTrqC
-  IF ( Re_BufSz  .GT. 0 ) THEN 
-     ALLOCATE( ReKiBuf(  Re_BufSz  ), STAT=ErrStat2 )
-     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating ReKiBuf.', ErrStat, ErrMsg,RoutineName)
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i3_l = IntKiBuf( Int_Xferred    )
+    i3_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i4_l = IntKiBuf( Int_Xferred    )
+    i4_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i5_l = IntKiBuf( Int_Xferred    )
+    i5_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%TwistedSF)) DEALLOCATE(OutData%TwistedSF)
+    ALLOCATE(OutData%TwistedSF(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u,i4_l:i4_u,i5_l:i5_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%TwistedSF.', ErrStat, ErrMsg,RoutineName)
        RETURN
-     END IF
+    END IF
+      DO i5 = LBOUND(OutData%TwistedSF,5), UBOUND(OutData%TwistedSF,5)
+        DO i4 = LBOUND(OutData%TwistedSF,4), UBOUND(OutData%TwistedSF,4)
+          DO i3 = LBOUND(OutData%TwistedSF,3), UBOUND(OutData%TwistedSF,3)
+            DO i2 = LBOUND(OutData%TwistedSF,2), UBOUND(OutData%TwistedSF,2)
+              DO i1 = LBOUND(OutData%TwistedSF,1), UBOUND(OutData%TwistedSF,1)
+                OutData%TwistedSF(i1,i2,i3,i4,i5) = ReKiBuf(Re_Xferred)
+                Re_Xferred = Re_Xferred + 1
+              END DO
+            END DO
+          END DO
+        END DO
+      END DO
   END IF
-  IF ( Db_BufSz  .GT. 0 ) THEN 
-     ALLOCATE( DbKiBuf(  Db_BufSz  ), STAT=ErrStat2 )
-     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating DbKiBuf.', ErrStat, ErrMsg,RoutineName)
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! BldFl1Sh not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%BldFl1Sh)) DEALLOCATE(OutData%BldFl1Sh)
+    ALLOCATE(OutData%BldFl1Sh(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%BldFl1Sh.', ErrStat, ErrMsg,RoutineName)
        RETURN
-     END IF
+    END IF
+      DO i2 = LBOUND(OutData%BldFl1Sh,2), UBOUND(OutData%BldFl1Sh,2)
+        DO i1 = LBOUND(OutData%BldFl1Sh,1), UBOUND(OutData%BldFl1Sh,1)
+          OutData%BldFl1Sh(i1,i2) = ReKiBuf(Re_Xferred)
+          Re_Xferred = Re_Xferred + 1
+        END DO
+      END DO
   END IF
-  IF ( Int_BufSz  .GT. 0 ) THEN 
-     ALLOCATE( IntKiBuf(  Int_BufSz  ), STAT=ErrStat2 )
-     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating IntKiBuf.', ErrStat, ErrMsg,RoutineName)
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! BldFl2Sh not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%BldFl2Sh)) DEALLOCATE(OutData%BldFl2Sh)
+    ALLOCATE(OutData%BldFl2Sh(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%BldFl2Sh.', ErrStat, ErrMsg,RoutineName)
        RETURN
-     END IF
+    END IF
+      DO i2 = LBOUND(OutData%BldFl2Sh,2), UBOUND(OutData%BldFl2Sh,2)
+        DO i1 = LBOUND(OutData%BldFl2Sh,1), UBOUND(OutData%BldFl2Sh,1)
+          OutData%BldFl2Sh(i1,i2) = ReKiBuf(Re_Xferred)
+          Re_Xferred = Re_Xferred + 1
+        END DO
+      END DO
   END IF
-  IF(OnlySize) RETURN ! return early if only trying to allocate buffers (not pack them)
-
-  Re_Xferred  = 1
-  Db_Xferred  = 1
-  Int_Xferred = 1
-
-  IF ( .NOT. ALLOCATED(InData%BladePtLoads) ) THEN
-    IntKiBuf( Int_Xferred ) = 0
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! BldEdgSh not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
-    IntKiBuf( Int_Xferred ) = 1
     Int_Xferred = Int_Xferred + 1
-    IntKiBuf( Int_Xferred    ) = LBOUND(InData%BladePtLoads,1)
-    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%BladePtLoads,1)
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-
-    DO i1 = LBOUND(InData%BladePtLoads,1), UBOUND(InData%BladePtLoads,1)
-      CALL MeshPack( InData%BladePtLoads(i1), Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2, OnlySize ) ! BladePtLoads 
-        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-        IF (ErrStat >= AbortErrLev) RETURN
-
-      IF(ALLOCATED(Re_Buf)) THEN
-        IntKiBuf( Int_Xferred ) = SIZE(Re_Buf); Int_Xferred = Int_Xferred + 1
-        IF (SIZE(Re_Buf) > 0) ReKiBuf( Re_Xferred:Re_Xferred+SIZE(Re_Buf)-1 ) = Re_Buf
-        Re_Xferred = Re_Xferred + SIZE(Re_Buf)
-        DEALLOCATE(Re_Buf)
-      ELSE
-        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
-      ENDIF
-      IF(ALLOCATED(Db_Buf)) THEN
-        IntKiBuf( Int_Xferred ) = SIZE(Db_Buf); Int_Xferred = Int_Xferred + 1
-        IF (SIZE(Db_Buf) > 0) DbKiBuf( Db_Xferred:Db_Xferred+SIZE(Db_Buf)-1 ) = Db_Buf
-        Db_Xferred = Db_Xferred + SIZE(Db_Buf)
-        DEALLOCATE(Db_Buf)
-      ELSE
-        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
-      ENDIF
-      IF(ALLOCATED(Int_Buf)) THEN
-        IntKiBuf( Int_Xferred ) = SIZE(Int_Buf); Int_Xferred = Int_Xferred + 1
-        IF (SIZE(Int_Buf) > 0) IntKiBuf( Int_Xferred:Int_Xferred+SIZE(Int_Buf)-1 ) = Int_Buf
-        Int_Xferred = Int_Xferred + SIZE(Int_Buf)
-        DEALLOCATE(Int_Buf)
-      ELSE
-        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
-      ENDIF
-    END DO
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%BldEdgSh)) DEALLOCATE(OutData%BldEdgSh)
+    ALLOCATE(OutData%BldEdgSh(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%BldEdgSh.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+      DO i2 = LBOUND(OutData%BldEdgSh,2), UBOUND(OutData%BldEdgSh,2)
+        DO i1 = LBOUND(OutData%BldEdgSh,1), UBOUND(OutData%BldEdgSh,1)
+          OutData%BldEdgSh(i1,i2) = ReKiBuf(Re_Xferred)
+          Re_Xferred = Re_Xferred + 1
+        END DO
+      END DO
   END IF
-      CALL MeshPack( InData%PlatformPtMesh, Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2, OnlySize ) ! PlatformPtMesh 
-        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-        IF (ErrStat >= AbortErrLev) RETURN
-
-      IF(ALLOCATED(Re_Buf)) THEN
-        IntKiBuf( Int_Xferred ) = SIZE(Re_Buf); Int_Xferred = Int_Xferred + 1
-        IF (SIZE(Re_Buf) > 0) ReKiBuf( Re_Xferred:Re_Xferred+SIZE(Re_Buf)-1 ) = Re_Buf
-        Re_Xferred = Re_Xferred + SIZE(Re_Buf)
-        DEALLOCATE(Re_Buf)
-      ELSE
-        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
-      ENDIF
-      IF(ALLOCATED(Db_Buf)) THEN
-        IntKiBuf( Int_Xferred ) = SIZE(Db_Buf); Int_Xferred = Int_Xferred + 1
-        IF (SIZE(Db_Buf) > 0) DbKiBuf( Db_Xferred:Db_Xferred+SIZE(Db_Buf)-1 ) = Db_Buf
-        Db_Xferred = Db_Xferred + SIZE(Db_Buf)
-        DEALLOCATE(Db_Buf)
-      ELSE
-        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
-      ENDIF
-      IF(ALLOCATED(Int_Buf)) THEN
-        IntKiBuf( Int_Xferred ) = SIZE(Int_Buf); Int_Xferred = Int_Xferred + 1
-        IF (SIZE(Int_Buf) > 0) IntKiBuf( Int_Xferred:Int_Xferred+SIZE(Int_Buf)-1 ) = Int_Buf
-        Int_Xferred = Int_Xferred + SIZE(Int_Buf)
-        DEALLOCATE(Int_Buf)
-      ELSE
-        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
-      ENDIF
-      CALL MeshPack( InData%TowerPtLoads, Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2, OnlySize ) ! TowerPtLoads 
-        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-        IF (ErrStat >= AbortErrLev) RETURN
-
-      IF(ALLOCATED(Re_Buf)) THEN
-        IntKiBuf( Int_Xferred ) = SIZE(Re_Buf); Int_Xferred = Int_Xferred + 1
-        IF (SIZE(Re_Buf) > 0) ReKiBuf( Re_Xferred:Re_Xferred+SIZE(Re_Buf)-1 ) = Re_Buf
-        Re_Xferred = Re_Xferred + SIZE(Re_Buf)
-        DEALLOCATE(Re_Buf)
-      ELSE
-        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
-      ENDIF
-      IF(ALLOCATED(Db_Buf)) THEN
-        IntKiBuf( Int_Xferred ) = SIZE(Db_Buf); Int_Xferred = Int_Xferred + 1
-        IF (SIZE(Db_Buf) > 0) DbKiBuf( Db_Xferred:Db_Xferred+SIZE(Db_Buf)-1 ) = Db_Buf
-        Db_Xferred = Db_Xferred + SIZE(Db_Buf)
-        DEALLOCATE(Db_Buf)
-      ELSE
-        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
-      ENDIF
-      IF(ALLOCATED(Int_Buf)) THEN
-        IntKiBuf( Int_Xferred ) = SIZE(Int_Buf); Int_Xferred = Int_Xferred + 1
-        IF (SIZE(Int_Buf) > 0) IntKiBuf( Int_Xferred:Int_Xferred+SIZE(Int_Buf)-1 ) = Int_Buf
-        Int_Xferred = Int_Xferred + SIZE(Int_Buf)
-        DEALLOCATE(Int_Buf)
-      ELSE
-        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
-      ENDIF
-      CALL MeshPack( InData%HubPtLoad, Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2, OnlySize ) ! HubPtLoad 
-        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-        IF (ErrStat >= AbortErrLev) RETURN
-
-      IF(ALLOCATED(Re_Buf)) THEN
-        IntKiBuf( Int_Xferred ) = SIZE(Re_Buf); Int_Xferred = Int_Xferred + 1
-        IF (SIZE(Re_Buf) > 0) ReKiBuf( Re_Xferred:Re_Xferred+SIZE(Re_Buf)-1 ) = Re_Buf
-        Re_Xferred = Re_Xferred + SIZE(Re_Buf)
-        DEALLOCATE(Re_Buf)
-      ELSE
-        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
-      ENDIF
-      IF(ALLOCATED(Db_Buf)) THEN
-        IntKiBuf( Int_Xferred ) = SIZE(Db_Buf); Int_Xferred = Int_Xferred + 1
-        IF (SIZE(Db_Buf) > 0) DbKiBuf( Db_Xferred:Db_Xferred+SIZE(Db_Buf)-1 ) = Db_Buf
-        Db_Xferred = Db_Xferred + SIZE(Db_Buf)
-        DEALLOCATE(Db_Buf)
-      ELSE
-        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
-      ENDIF
-      IF(ALLOCATED(Int_Buf)) THEN
-        IntKiBuf( Int_Xferred ) = SIZE(Int_Buf); Int_Xferred = Int_Xferred + 1
-        IF (SIZE(Int_Buf) > 0) IntKiBuf( Int_Xferred:Int_Xferred+SIZE(Int_Buf)-1 ) = Int_Buf
-        Int_Xferred = Int_Xferred + SIZE(Int_Buf)
-        DEALLOCATE(Int_Buf)
-      ELSE
-        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
-      ENDIF
-      CALL MeshPack( InData%NacelleLoads, Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2, OnlySize ) ! NacelleLoads 
-        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-        IF (ErrStat >= AbortErrLev) RETURN
-
-      IF(ALLOCATED(Re_Buf)) THEN
-        IntKiBuf( Int_Xferred ) = SIZE(Re_Buf); Int_Xferred = Int_Xferred + 1
-        IF (SIZE(Re_Buf) > 0) ReKiBuf( Re_Xferred:Re_Xferred+SIZE(Re_Buf)-1 ) = Re_Buf
-        Re_Xferred = Re_Xferred + SIZE(Re_Buf)
-        DEALLOCATE(Re_Buf)
-      ELSE
-        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
-      ENDIF
-      IF(ALLOCATED(Db_Buf)) THEN
-        IntKiBuf( Int_Xferred ) = SIZE(Db_Buf); Int_Xferred = Int_Xferred + 1
-        IF (SIZE(Db_Buf) > 0) DbKiBuf( Db_Xferred:Db_Xferred+SIZE(Db_Buf)-1 ) = Db_Buf
-        Db_Xferred = Db_Xferred + SIZE(Db_Buf)
-        DEALLOCATE(Db_Buf)
-      ELSE
-        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
-      ENDIF
-      IF(ALLOCATED(Int_Buf)) THEN
-        IntKiBuf( Int_Xferred ) = SIZE(Int_Buf); Int_Xferred = Int_Xferred + 1
-        IF (SIZE(Int_Buf) > 0) IntKiBuf( Int_Xferred:Int_Xferred+SIZE(Int_Buf)-1 ) = Int_Buf
-        Int_Xferred = Int_Xferred + SIZE(Int_Buf)
-        DEALLOCATE(Int_Buf)
-      ELSE
-        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
-      ENDIF
-  IF ( .NOT. ALLOCATED(InData%TwrAddedMass) ) THEN
-    IntKiBuf( Int_Xferred ) = 0
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! FreqBE not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i3_l = IntKiBuf( Int_Xferred    )
+    i3_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%FreqBE)) DEALLOCATE(OutData%FreqBE)
+    ALLOCATE(OutData%FreqBE(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%FreqBE.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+      DO i3 = LBOUND(OutData%FreqBE,3), UBOUND(OutData%FreqBE,3)
+        DO i2 = LBOUND(OutData%FreqBE,2), UBOUND(OutData%FreqBE,2)
+          DO i1 = LBOUND(OutData%FreqBE,1), UBOUND(OutData%FreqBE,1)
+            OutData%FreqBE(i1,i2,i3) = ReKiBuf(Re_Xferred)
+            Re_Xferred = Re_Xferred + 1
+          END DO
+        END DO
+      END DO
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! FreqBF not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
-    IntKiBuf( Int_Xferred ) = 1
     Int_Xferred = Int_Xferred + 1
-    IntKiBuf( Int_Xferred    ) = LBOUND(InData%TwrAddedMass,1)
-    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%TwrAddedMass,1)
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IntKiBuf( Int_Xferred    ) = LBOUND(InData%TwrAddedMass,2)
-    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%TwrAddedMass,2)
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IntKiBuf( Int_Xferred    ) = LBOUND(InData%TwrAddedMass,3)
-    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%TwrAddedMass,3)
+    i3_l = IntKiBuf( Int_Xferred    )
+    i3_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-
-      DO i3 = LBOUND(InData%TwrAddedMass,3), UBOUND(InData%TwrAddedMass,3)
-        DO i2 = LBOUND(InData%TwrAddedMass,2), UBOUND(InData%TwrAddedMass,2)
-          DO i1 = LBOUND(InData%TwrAddedMass,1), UBOUND(InData%TwrAddedMass,1)
-            ReKiBuf(Re_Xferred) = InData%TwrAddedMass(i1,i2,i3)
+    IF (ALLOCATED(OutData%FreqBF)) DEALLOCATE(OutData%FreqBF)
+    ALLOCATE(OutData%FreqBF(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%FreqBF.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+      DO i3 = LBOUND(OutData%FreqBF,3), UBOUND(OutData%FreqBF,3)
+        DO i2 = LBOUND(OutData%FreqBF,2), UBOUND(OutData%FreqBF,2)
+          DO i1 = LBOUND(OutData%FreqBF,1), UBOUND(OutData%FreqBF,1)
+            OutData%FreqBF(i1,i2,i3) = ReKiBuf(Re_Xferred)
             Re_Xferred = Re_Xferred + 1
           END DO
         END DO
       END DO
   END IF
-    DO i2 = LBOUND(InData%PtfmAddedMass,2), UBOUND(InData%PtfmAddedMass,2)
-      DO i1 = LBOUND(InData%PtfmAddedMass,1), UBOUND(InData%PtfmAddedMass,1)
-        ReKiBuf(Re_Xferred) = InData%PtfmAddedMass(i1,i2)
+    i1_l = LBOUND(OutData%FreqTFA,1)
+    i1_u = UBOUND(OutData%FreqTFA,1)
+    i2_l = LBOUND(OutData%FreqTFA,2)
+    i2_u = UBOUND(OutData%FreqTFA,2)
+    DO i2 = LBOUND(OutData%FreqTFA,2), UBOUND(OutData%FreqTFA,2)
+      DO i1 = LBOUND(OutData%FreqTFA,1), UBOUND(OutData%FreqTFA,1)
+        OutData%FreqTFA(i1,i2) = ReKiBuf(Re_Xferred)
         Re_Xferred = Re_Xferred + 1
       END DO
     END DO
-  IF ( .NOT. ALLOCATED(InData%BlPitchCom) ) THEN
-    IntKiBuf( Int_Xferred ) = 0
+    i1_l = LBOUND(OutData%FreqTSS,1)
+    i1_u = UBOUND(OutData%FreqTSS,1)
+    i2_l = LBOUND(OutData%FreqTSS,2)
+    i2_u = UBOUND(OutData%FreqTSS,2)
+    DO i2 = LBOUND(OutData%FreqTSS,2), UBOUND(OutData%FreqTSS,2)
+      DO i1 = LBOUND(OutData%FreqTSS,1), UBOUND(OutData%FreqTSS,1)
+        OutData%FreqTSS(i1,i2) = ReKiBuf(Re_Xferred)
+        Re_Xferred = Re_Xferred + 1
+      END DO
+    END DO
+    OutData%TeetCDmp = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TeetDmp = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TeetDmpP = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TeetHSSp = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TeetHStP = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TeetSSSp = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TeetSStP = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TeetMod = IntKiBuf(Int_Xferred)
+    Int_Xferred = Int_Xferred + 1
+    OutData%TFrlCDmp = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TFrlDmp = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TFrlDSDmp = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TFrlDSDP = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TFrlDSSP = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TFrlDSSpr = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TFrlSpr = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TFrlUSDmp = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TFrlUSDP = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TFrlUSSP = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TFrlUSSpr = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%TFrlMod = IntKiBuf(Int_Xferred)
+    Int_Xferred = Int_Xferred + 1
+    OutData%RFrlCDmp = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%RFrlDmp = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%RFrlDSDmp = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%RFrlDSDP = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%RFrlDSSP = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%RFrlDSSpr = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%RFrlSpr = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%RFrlUSDmp = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%RFrlUSDP = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%RFrlUSSP = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%RFrlUSSpr = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%RFrlMod = IntKiBuf(Int_Xferred)
+    Int_Xferred = Int_Xferred + 1
+    OutData%ShftGagL = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    i1_l = LBOUND(OutData%BldGagNd,1)
+    i1_u = UBOUND(OutData%BldGagNd,1)
+    DO i1 = LBOUND(OutData%BldGagNd,1), UBOUND(OutData%BldGagNd,1)
+      OutData%BldGagNd(i1) = IntKiBuf(Int_Xferred)
+      Int_Xferred = Int_Xferred + 1
+    END DO
+    i1_l = LBOUND(OutData%TwrGagNd,1)
+    i1_u = UBOUND(OutData%TwrGagNd,1)
+    DO i1 = LBOUND(OutData%TwrGagNd,1), UBOUND(OutData%TwrGagNd,1)
+      OutData%TwrGagNd(i1) = IntKiBuf(Int_Xferred)
+      Int_Xferred = Int_Xferred + 1
+    END DO
+    OutData%TStart = DbKiBuf(Db_Xferred)
+    Db_Xferred = Db_Xferred + 1
+    OutData%DTTorDmp = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%DTTorSpr = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%GBRatio = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%GBoxEff = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    OutData%RotSpeed = ReKiBuf(Re_Xferred)
+    Re_Xferred = Re_Xferred + 1
+    DO I = 1, LEN(OutData%RootName)
+      OutData%RootName(I:I) = CHAR(IntKiBuf(Int_Xferred))
+      Int_Xferred = Int_Xferred + 1
+    END DO ! I
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! BElmntMass not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
-    IntKiBuf( Int_Xferred ) = 1
     Int_Xferred = Int_Xferred + 1
-    IntKiBuf( Int_Xferred    ) = LBOUND(InData%BlPitchCom,1)
-    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%BlPitchCom,1)
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-
-      DO i1 = LBOUND(InData%BlPitchCom,1), UBOUND(InData%BlPitchCom,1)
-        ReKiBuf(Re_Xferred) = InData%BlPitchCom(i1)
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%BElmntMass)) DEALLOCATE(OutData%BElmntMass)
+    ALLOCATE(OutData%BElmntMass(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%BElmntMass.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+      DO i2 = LBOUND(OutData%BElmntMass,2), UBOUND(OutData%BElmntMass,2)
+        DO i1 = LBOUND(OutData%BElmntMass,1), UBOUND(OutData%BElmntMass,1)
+          OutData%BElmntMass(i1,i2) = ReKiBuf(Re_Xferred)
+          Re_Xferred = Re_Xferred + 1
+        END DO
+      END DO
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! TElmntMass not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%TElmntMass)) DEALLOCATE(OutData%TElmntMass)
+    ALLOCATE(OutData%TElmntMass(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%TElmntMass.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+      DO i1 = LBOUND(OutData%TElmntMass,1), UBOUND(OutData%TElmntMass,1)
+        OutData%TElmntMass(i1) = ReKiBuf(Re_Xferred)
         Re_Xferred = Re_Xferred + 1
       END DO
   END IF
-    ReKiBuf(Re_Xferred) = InData%YawMom
-    Re_Xferred = Re_Xferred + 1
-    ReKiBuf(Re_Xferred) = InData%GenTrq
+    OutData%method = IntKiBuf(Int_Xferred)
+    Int_Xferred = Int_Xferred + 1
+    OutData%PtfmCMxt = ReKiBuf(Re_Xferred)
     Re_Xferred = Re_Xferred + 1
-    ReKiBuf(Re_Xferred) = InData%HSSBrTrqC
+    OutData%PtfmCMyt = ReKiBuf(Re_Xferred)
     Re_Xferred = Re_Xferred + 1
- END SUBROUTINE ED_PackInput
-
- SUBROUTINE ED_UnPackInput( ReKiBuf, DbKiBuf, IntKiBuf, Outdata, ErrStat, ErrMsg )
-  REAL(ReKi),      ALLOCATABLE, INTENT(IN   ) :: ReKiBuf(:)
-  REAL(DbKi),      ALLOCATABLE, INTENT(IN   ) :: DbKiBuf(:)
-  INTEGER(IntKi),  ALLOCATABLE, INTENT(IN   ) :: IntKiBuf(:)
-  TYPE(ED_InputType), INTENT(INOUT) :: OutData
-  INTEGER(IntKi),  INTENT(  OUT) :: ErrStat
-  CHARACTER(*),    INTENT(  OUT) :: ErrMsg
-    ! Local variables
-  INTEGER(IntKi)                 :: Buf_size
-  INTEGER(IntKi)                 :: Re_Xferred
-  INTEGER(IntKi)                 :: Db_Xferred
-  INTEGER(IntKi)                 :: Int_Xferred
-  INTEGER(IntKi)                 :: i
-  INTEGER(IntKi)                 :: i1, i1_l, i1_u  !  bounds (upper/lower) for an array dimension 1
-  INTEGER(IntKi)                 :: i2, i2_l, i2_u  !  bounds (upper/lower) for an array dimension 2
-  INTEGER(IntKi)                 :: i3, i3_l, i3_u  !  bounds (upper/lower) for an array dimension 3
-  INTEGER(IntKi)                 :: ErrStat2
-  CHARACTER(ErrMsgLen)           :: ErrMsg2
-  CHARACTER(*), PARAMETER        :: RoutineName = 'ED_UnPackInput'
- ! buffers to store meshes, if any
-  REAL(ReKi),      ALLOCATABLE   :: Re_Buf(:)
-  REAL(DbKi),      ALLOCATABLE   :: Db_Buf(:)
-  INTEGER(IntKi),  ALLOCATABLE   :: Int_Buf(:)
-    !
-  ErrStat = ErrID_None
-  ErrMsg  = ""
-  Re_Xferred  = 1
-  Db_Xferred  = 1
-  Int_Xferred  = 1
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! BladePtLoads not allocated
+    OutData%BD4Blades = TRANSFER(IntKiBuf(Int_Xferred), OutData%BD4Blades)
+    Int_Xferred = Int_Xferred + 1
+    OutData%UseAD14 = TRANSFER(IntKiBuf(Int_Xferred), OutData%UseAD14)
+    Int_Xferred = Int_Xferred + 1
+    i1_l = LBOUND(OutData%DTLInpTrq,1)
+    i1_u = UBOUND(OutData%DTLInpTrq,1)
+    DO i1 = LBOUND(OutData%DTLInpTrq,1), UBOUND(OutData%DTLInpTrq,1)
+      OutData%DTLInpTrq(i1) = ReKiBuf(Re_Xferred)
+      Re_Xferred = Re_Xferred + 1
+    END DO
+    i1_l = LBOUND(OutData%DTLTrq,1)
+    i1_u = UBOUND(OutData%DTLTrq,1)
+    DO i1 = LBOUND(OutData%DTLTrq,1), UBOUND(OutData%DTLTrq,1)
+      OutData%DTLTrq(i1) = ReKiBuf(Re_Xferred)
+      Re_Xferred = Re_Xferred + 1
+    END DO
+    OutData%DTLInpN = IntKiBuf(Int_Xferred)
+    Int_Xferred = Int_Xferred + 1
+    OutData%DTLoss = TRANSFER(IntKiBuf(Int_Xferred), OutData%DTLoss)
+    Int_Xferred = Int_Xferred + 1
+    OutData%BldNd_NumOuts = IntKiBuf(Int_Xferred)
+    Int_Xferred = Int_Xferred + 1
+    OutData%BldNd_TotNumOuts = IntKiBuf(Int_Xferred)
+    Int_Xferred = Int_Xferred + 1
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! BldNd_OutParam not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%BladePtLoads)) DEALLOCATE(OutData%BladePtLoads)
-    ALLOCATE(OutData%BladePtLoads(i1_l:i1_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%BldNd_OutParam)) DEALLOCATE(OutData%BldNd_OutParam)
+    ALLOCATE(OutData%BldNd_OutParam(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%BladePtLoads.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%BldNd_OutParam.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-    DO i1 = LBOUND(OutData%BladePtLoads,1), UBOUND(OutData%BladePtLoads,1)
+    DO i1 = LBOUND(OutData%BldNd_OutParam,1), UBOUND(OutData%BldNd_OutParam,1)
       Buf_size=IntKiBuf( Int_Xferred )
       Int_Xferred = Int_Xferred + 1
       IF(Buf_size > 0) THEN
@@ -23452,7 +24438,7 @@ ENDIF
         Int_Buf = IntKiBuf( Int_Xferred:Int_Xferred+Buf_size-1 )
         Int_Xferred = Int_Xferred + Buf_size
       END IF
-      CALL MeshUnpack( OutData%BladePtLoads(i1), Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2 ) ! BladePtLoads 
+      CALL NWTC_Library_Unpackoutparmtype( Re_Buf, Db_Buf, Int_Buf, OutData%BldNd_OutParam(i1), ErrStat2, ErrMsg2 ) ! BldNd_OutParam 
         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
         IF (ErrStat >= AbortErrLev) RETURN
 
@@ -23461,167 +24447,9 @@ ENDIF
       IF(ALLOCATED(Int_Buf)) DEALLOCATE(Int_Buf)
     END DO
   END IF
-      Buf_size=IntKiBuf( Int_Xferred )
-      Int_Xferred = Int_Xferred + 1
-      IF(Buf_size > 0) THEN
-        ALLOCATE(Re_Buf(Buf_size),STAT=ErrStat2)
-        IF (ErrStat2 /= 0) THEN 
-           CALL SetErrStat(ErrID_Fatal, 'Error allocating Re_Buf.', ErrStat, ErrMsg,RoutineName)
-           RETURN
-        END IF
-        Re_Buf = ReKiBuf( Re_Xferred:Re_Xferred+Buf_size-1 )
-        Re_Xferred = Re_Xferred + Buf_size
-      END IF
-      Buf_size=IntKiBuf( Int_Xferred )
-      Int_Xferred = Int_Xferred + 1
-      IF(Buf_size > 0) THEN
-        ALLOCATE(Db_Buf(Buf_size),STAT=ErrStat2)
-        IF (ErrStat2 /= 0) THEN 
-           CALL SetErrStat(ErrID_Fatal, 'Error allocating Db_Buf.', ErrStat, ErrMsg,RoutineName)
-           RETURN
-        END IF
-        Db_Buf = DbKiBuf( Db_Xferred:Db_Xferred+Buf_size-1 )
-        Db_Xferred = Db_Xferred + Buf_size
-      END IF
-      Buf_size=IntKiBuf( Int_Xferred )
-      Int_Xferred = Int_Xferred + 1
-      IF(Buf_size > 0) THEN
-        ALLOCATE(Int_Buf(Buf_size),STAT=ErrStat2)
-        IF (ErrStat2 /= 0) THEN 
-           CALL SetErrStat(ErrID_Fatal, 'Error allocating Int_Buf.', ErrStat, ErrMsg,RoutineName)
-           RETURN
-        END IF
-        Int_Buf = IntKiBuf( Int_Xferred:Int_Xferred+Buf_size-1 )
-        Int_Xferred = Int_Xferred + Buf_size
-      END IF
-      CALL MeshUnpack( OutData%PlatformPtMesh, Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2 ) ! PlatformPtMesh 
-        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-        IF (ErrStat >= AbortErrLev) RETURN
-
-      IF(ALLOCATED(Re_Buf )) DEALLOCATE(Re_Buf )
-      IF(ALLOCATED(Db_Buf )) DEALLOCATE(Db_Buf )
-      IF(ALLOCATED(Int_Buf)) DEALLOCATE(Int_Buf)
-      Buf_size=IntKiBuf( Int_Xferred )
-      Int_Xferred = Int_Xferred + 1
-      IF(Buf_size > 0) THEN
-        ALLOCATE(Re_Buf(Buf_size),STAT=ErrStat2)
-        IF (ErrStat2 /= 0) THEN 
-           CALL SetErrStat(ErrID_Fatal, 'Error allocating Re_Buf.', ErrStat, ErrMsg,RoutineName)
-           RETURN
-        END IF
-        Re_Buf = ReKiBuf( Re_Xferred:Re_Xferred+Buf_size-1 )
-        Re_Xferred = Re_Xferred + Buf_size
-      END IF
-      Buf_size=IntKiBuf( Int_Xferred )
-      Int_Xferred = Int_Xferred + 1
-      IF(Buf_size > 0) THEN
-        ALLOCATE(Db_Buf(Buf_size),STAT=ErrStat2)
-        IF (ErrStat2 /= 0) THEN 
-           CALL SetErrStat(ErrID_Fatal, 'Error allocating Db_Buf.', ErrStat, ErrMsg,RoutineName)
-           RETURN
-        END IF
-        Db_Buf = DbKiBuf( Db_Xferred:Db_Xferred+Buf_size-1 )
-        Db_Xferred = Db_Xferred + Buf_size
-      END IF
-      Buf_size=IntKiBuf( Int_Xferred )
-      Int_Xferred = Int_Xferred + 1
-      IF(Buf_size > 0) THEN
-        ALLOCATE(Int_Buf(Buf_size),STAT=ErrStat2)
-        IF (ErrStat2 /= 0) THEN 
-           CALL SetErrStat(ErrID_Fatal, 'Error allocating Int_Buf.', ErrStat, ErrMsg,RoutineName)
-           RETURN
-        END IF
-        Int_Buf = IntKiBuf( Int_Xferred:Int_Xferred+Buf_size-1 )
-        Int_Xferred = Int_Xferred + Buf_size
-      END IF
-      CALL MeshUnpack( OutData%TowerPtLoads, Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2 ) ! TowerPtLoads 
-        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-        IF (ErrStat >= AbortErrLev) RETURN
-
-      IF(ALLOCATED(Re_Buf )) DEALLOCATE(Re_Buf )
-      IF(ALLOCATED(Db_Buf )) DEALLOCATE(Db_Buf )
-      IF(ALLOCATED(Int_Buf)) DEALLOCATE(Int_Buf)
-      Buf_size=IntKiBuf( Int_Xferred )
-      Int_Xferred = Int_Xferred + 1
-      IF(Buf_size > 0) THEN
-        ALLOCATE(Re_Buf(Buf_size),STAT=ErrStat2)
-        IF (ErrStat2 /= 0) THEN 
-           CALL SetErrStat(ErrID_Fatal, 'Error allocating Re_Buf.', ErrStat, ErrMsg,RoutineName)
-           RETURN
-        END IF
-        Re_Buf = ReKiBuf( Re_Xferred:Re_Xferred+Buf_size-1 )
-        Re_Xferred = Re_Xferred + Buf_size
-      END IF
-      Buf_size=IntKiBuf( Int_Xferred )
-      Int_Xferred = Int_Xferred + 1
-      IF(Buf_size > 0) THEN
-        ALLOCATE(Db_Buf(Buf_size),STAT=ErrStat2)
-        IF (ErrStat2 /= 0) THEN 
-           CALL SetErrStat(ErrID_Fatal, 'Error allocating Db_Buf.', ErrStat, ErrMsg,RoutineName)
-           RETURN
-        END IF
-        Db_Buf = DbKiBuf( Db_Xferred:Db_Xferred+Buf_size-1 )
-        Db_Xferred = Db_Xferred + Buf_size
-      END IF
-      Buf_size=IntKiBuf( Int_Xferred )
-      Int_Xferred = Int_Xferred + 1
-      IF(Buf_size > 0) THEN
-        ALLOCATE(Int_Buf(Buf_size),STAT=ErrStat2)
-        IF (ErrStat2 /= 0) THEN 
-           CALL SetErrStat(ErrID_Fatal, 'Error allocating Int_Buf.', ErrStat, ErrMsg,RoutineName)
-           RETURN
-        END IF
-        Int_Buf = IntKiBuf( Int_Xferred:Int_Xferred+Buf_size-1 )
-        Int_Xferred = Int_Xferred + Buf_size
-      END IF
-      CALL MeshUnpack( OutData%HubPtLoad, Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2 ) ! HubPtLoad 
-        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-        IF (ErrStat >= AbortErrLev) RETURN
-
-      IF(ALLOCATED(Re_Buf )) DEALLOCATE(Re_Buf )
-      IF(ALLOCATED(Db_Buf )) DEALLOCATE(Db_Buf )
-      IF(ALLOCATED(Int_Buf)) DEALLOCATE(Int_Buf)
-      Buf_size=IntKiBuf( Int_Xferred )
-      Int_Xferred = Int_Xferred + 1
-      IF(Buf_size > 0) THEN
-        ALLOCATE(Re_Buf(Buf_size),STAT=ErrStat2)
-        IF (ErrStat2 /= 0) THEN 
-           CALL SetErrStat(ErrID_Fatal, 'Error allocating Re_Buf.', ErrStat, ErrMsg,RoutineName)
-           RETURN
-        END IF
-        Re_Buf = ReKiBuf( Re_Xferred:Re_Xferred+Buf_size-1 )
-        Re_Xferred = Re_Xferred + Buf_size
-      END IF
-      Buf_size=IntKiBuf( Int_Xferred )
-      Int_Xferred = Int_Xferred + 1
-      IF(Buf_size > 0) THEN
-        ALLOCATE(Db_Buf(Buf_size),STAT=ErrStat2)
-        IF (ErrStat2 /= 0) THEN 
-           CALL SetErrStat(ErrID_Fatal, 'Error allocating Db_Buf.', ErrStat, ErrMsg,RoutineName)
-           RETURN
-        END IF
-        Db_Buf = DbKiBuf( Db_Xferred:Db_Xferred+Buf_size-1 )
-        Db_Xferred = Db_Xferred + Buf_size
-      END IF
-      Buf_size=IntKiBuf( Int_Xferred )
-      Int_Xferred = Int_Xferred + 1
-      IF(Buf_size > 0) THEN
-        ALLOCATE(Int_Buf(Buf_size),STAT=ErrStat2)
-        IF (ErrStat2 /= 0) THEN 
-           CALL SetErrStat(ErrID_Fatal, 'Error allocating Int_Buf.', ErrStat, ErrMsg,RoutineName)
-           RETURN
-        END IF
-        Int_Buf = IntKiBuf( Int_Xferred:Int_Xferred+Buf_size-1 )
-        Int_Xferred = Int_Xferred + Buf_size
-      END IF
-      CALL MeshUnpack( OutData%NacelleLoads, Re_Buf, Db_Buf, Int_Buf, ErrStat2, ErrMsg2 ) ! NacelleLoads 
-        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-        IF (ErrStat >= AbortErrLev) RETURN
-
-      IF(ALLOCATED(Re_Buf )) DEALLOCATE(Re_Buf )
-      IF(ALLOCATED(Db_Buf )) DEALLOCATE(Db_Buf )
-      IF(ALLOCATED(Int_Buf)) DEALLOCATE(Int_Buf)
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! TwrAddedMass not allocated
+    OutData%BldNd_BladesOut = IntKiBuf(Int_Xferred)
+    Int_Xferred = Int_Xferred + 1
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! Jac_u_indx not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
@@ -23631,59 +24459,58 @@ ENDIF
     i2_l = IntKiBuf( Int_Xferred    )
     i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    i3_l = IntKiBuf( Int_Xferred    )
-    i3_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%TwrAddedMass)) DEALLOCATE(OutData%TwrAddedMass)
-    ALLOCATE(OutData%TwrAddedMass(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%Jac_u_indx)) DEALLOCATE(OutData%Jac_u_indx)
+    ALLOCATE(OutData%Jac_u_indx(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%TwrAddedMass.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%Jac_u_indx.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i3 = LBOUND(OutData%TwrAddedMass,3), UBOUND(OutData%TwrAddedMass,3)
-        DO i2 = LBOUND(OutData%TwrAddedMass,2), UBOUND(OutData%TwrAddedMass,2)
-          DO i1 = LBOUND(OutData%TwrAddedMass,1), UBOUND(OutData%TwrAddedMass,1)
-            OutData%TwrAddedMass(i1,i2,i3) = ReKiBuf(Re_Xferred)
-            Re_Xferred = Re_Xferred + 1
-          END DO
+      DO i2 = LBOUND(OutData%Jac_u_indx,2), UBOUND(OutData%Jac_u_indx,2)
+        DO i1 = LBOUND(OutData%Jac_u_indx,1), UBOUND(OutData%Jac_u_indx,1)
+          OutData%Jac_u_indx(i1,i2) = IntKiBuf(Int_Xferred)
+          Int_Xferred = Int_Xferred + 1
         END DO
       END DO
   END IF
-    i1_l = LBOUND(OutData%PtfmAddedMass,1)
-    i1_u = UBOUND(OutData%PtfmAddedMass,1)
-    i2_l = LBOUND(OutData%PtfmAddedMass,2)
-    i2_u = UBOUND(OutData%PtfmAddedMass,2)
-    DO i2 = LBOUND(OutData%PtfmAddedMass,2), UBOUND(OutData%PtfmAddedMass,2)
-      DO i1 = LBOUND(OutData%PtfmAddedMass,1), UBOUND(OutData%PtfmAddedMass,1)
-        OutData%PtfmAddedMass(i1,i2) = ReKiBuf(Re_Xferred)
-        Re_Xferred = Re_Xferred + 1
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! du not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%du)) DEALLOCATE(OutData%du)
+    ALLOCATE(OutData%du(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%du.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+      DO i1 = LBOUND(OutData%du,1), UBOUND(OutData%du,1)
+        OutData%du(i1) = REAL(DbKiBuf(Db_Xferred), R8Ki)
+        Db_Xferred = Db_Xferred + 1
       END DO
-    END DO
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! BlPitchCom not allocated
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! dx not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
     Int_Xferred = Int_Xferred + 1
     i1_l = IntKiBuf( Int_Xferred    )
     i1_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%BlPitchCom)) DEALLOCATE(OutData%BlPitchCom)
-    ALLOCATE(OutData%BlPitchCom(i1_l:i1_u),STAT=ErrStat2)
+    IF (ALLOCATED(OutData%dx)) DEALLOCATE(OutData%dx)
+    ALLOCATE(OutData%dx(i1_l:i1_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%BlPitchCom.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%dx.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-      DO i1 = LBOUND(OutData%BlPitchCom,1), UBOUND(OutData%BlPitchCom,1)
-        OutData%BlPitchCom(i1) = ReKiBuf(Re_Xferred)
-        Re_Xferred = Re_Xferred + 1
+      DO i1 = LBOUND(OutData%dx,1), UBOUND(OutData%dx,1)
+        OutData%dx(i1) = REAL(DbKiBuf(Db_Xferred), R8Ki)
+        Db_Xferred = Db_Xferred + 1
       END DO
   END IF
-    OutData%YawMom = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%GenTrq = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
-    OutData%HSSBrTrqC = ReKiBuf(Re_Xferred)
-    Re_Xferred = Re_Xferred + 1
- END SUBROUTINE ED_UnPackInput
+    OutData%Jac_ny = IntKiBuf(Int_Xferred)
+    Int_Xferred = Int_Xferred + 1
+ END SUBROUTINE ED_UnPackParam
 
  SUBROUTINE ED_CopyOutput( SrcOutputData, DstOutputData, CtrlCode, ErrStat, ErrMsg )
    TYPE(ED_OutputType), INTENT(INOUT) :: SrcOutputData
@@ -0,0 +1,96 @@
+
+#include "InflowWindLib.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// ifw_c_benchmark measures the points per second of the two velocity queries of the InflowWind C binding with the same
+// points: IfW_C_CalcOutput (interleaved single precision positions, fixed number of points, output channels) and
+// IfW_C_CalcVelocities (separate x, y, z and u, v, w arrays in double precision). The points are spread randomly over a
+// box around the hub, half a rotor radius deep in x, and the queries are repeated at times T0, T0 + DT, ...
+
+static double seconds_since(std::chrono::steady_clock::time_point t_start) {
+   return std::chrono::duration<double>(std::chrono::steady_clock::now() - t_start).count();
+}
+
+int main(int argc, char** argv) {
+   if (argc < 4 || argc > 6) {
+      std::cerr << "Incorrect syntax. Expected syntax is `ifw_c_benchmark InflowWind.dat HUB_HEIGHT RADIUS [N_POINTS [N_CALLS]]`" << std::endl;
+      return 1;
+   }
+   const double hub_height = atof(argv[2]);
+   const double radius = atof(argv[3]);
+   const int n_points = argc > 4 ? atoi(argv[4]) : 100000;
+   const int n_calls = argc > 5 ? atoi(argv[5]) : 20;
+   const double t0 = 1.0;
+   const double dt = 0.05;
+   if (n_points < 1 || n_calls < 1 || radius <= 0.0 || hub_height <= radius) {
+      std::cerr << "N_POINTS and N_CALLS must be positive and 0 < RADIUS < HUB_HEIGHT" << std::endl;
+      return 1;
+   }
+
+   // Same points in both layouts
+   std::mt19937 rng(1);
+   std::uniform_real_distribution<double> unit(-1.0, 1.0);
+   std::vector<double> x(n_points), y(n_points), z(n_points);
+   std::vector<float> positions(3 * n_points);
+   for (int i = 0; i < n_points; i++) {
+      x[i] = 0.5 * radius * unit(rng);
+      y[i] = radius * unit(rng);
+      z[i] = hub_height + radius * unit(rng);
+      // round to single precision so that both queries see the same coordinates
+      positions[3 * i] = (float) x[i];
+      positions[3 * i + 1] = (float) y[i];
+      positions[3 * i + 2] = (float) z[i];
+      x[i] = positions[3 * i];
+      y[i] = positions[3 * i + 1];
+      z[i] = positions[3 * i + 2];
+   }
+   std::vector<float> velocities(3 * n_points);
+   std::vector<double> u(n_points), v(n_points), w(n_points);
+
+   double t_calc_output = 0.0;
+   double t_calc_velocities = 0.0;
+   double max_difference = 0.0;
+   try {
+      InflowWindLib ifw(InflowWindLib::read_lines(argv[1]), std::vector<std::string>(), n_points, dt);
+
+      for (int i_call = 0; i_call < n_calls; i_call++) {
+         double time = t0 + i_call * dt;
+
+         std::chrono::steady_clock::time_point t_start = std::chrono::steady_clock::now();
+         ifw.calc_output(time, positions, velocities);
+         t_calc_output += seconds_since(t_start);
+
+         t_start = std::chrono::steady_clock::now();
+         ifw.calc_velocities(time, x, y, z, u, v, w);
+         t_calc_velocities += seconds_since(t_start);
+
+         for (int i = 0; i < n_points; i++) {
+            max_difference = std::max(max_difference, fabs(u[i] - velocities[3 * i]));
+            max_difference = std::max(max_difference, fabs(v[i] - velocities[3 * i + 1]));
+            max_difference = std::max(max_difference, fabs(w[i] - velocities[3 * i + 2]));
+         }
+      }
+      ifw.end();
+   } catch (const std::exception & e) {
+      std::cerr << e.what() << std::endl;
+      return 1;
+   }
+
+   double n_total = (double) n_points * n_calls;
+   printf("\n");
+   printf("InflowWind velocity queries of %s: %d points, %d calls\n", argv[1], n_points, n_calls);
+   printf("  IfW_C_CalcOutput:     %12.3f s %14.0f points/s\n", t_calc_output, n_total / t_calc_output);
+   printf("  IfW_C_CalcVelocities: %12.3f s %14.0f points/s\n", t_calc_velocities, n_total / t_calc_velocities);
+   printf("  Speed-up:             %12.2f\n", t_calc_output / t_calc_velocities);
+   printf("  Largest difference in the velocities: %g m/s\n", max_difference);
+
+   return 0;
+}
@@ -21,14 +21,16 @@ MODULE InflowWind_C_BINDING
 
     USE ISO_C_BINDING
     USE InflowWind
-    USE InflowWind_Subs, only: MaxOutPts
+    USE InflowWind_Subs, only: MaxOutPts, CalculateOutput
     USE InflowWind_Types
+    USE IfW_FFWind_Base, only: IfW_FFWind_CalcOutputBatch
     USE NWTC_Library
 
    IMPLICIT NONE
 
    PUBLIC :: IfW_C_Init
    PUBLIC :: IfW_C_CalcOutput
+   PUBLIC :: IfW_C_CalcVelocities
    PUBLIC :: IfW_C_End
 
    ! Accessible to all routines inside module
@@ -43,6 +45,11 @@ MODULE InflowWind_C_BINDING
    TYPE(InflowWind_OutputType)             :: y                 !< Initial output (outputs are not calculated; only the output mesh is initialized)
    TYPE(InflowWind_MiscVarType)            :: m                 !< Misc variables for optimization (not copied in glue code)
 
+   ! Work arrays of IfW_C_CalcVelocities, kept between calls so that calls with the same (or fewer) points do not allocate.
+   ! They are shared by all calls, so IfW_C_CalcVelocities is not reentrant (see IfW_C_Binding.h)
+   REAL(ReKi), ALLOCATABLE                 :: BatchPos(:,:)     !< X, Y and Z coordinates of the points in the wind file coordinates, one column each
+   REAL(ReKi), ALLOCATABLE                 :: BatchVel(:,:)     !< U, V and W velocities in the wind file coordinates, one column each
+
    !  This must exactly match the value in the Python interface. We are not using the variable 'ErrMsgLen'
    !  so that we avoid issues if ErrMsgLen changes in the NWTC Library. If the value of ErrMsgLen does change
    !  in the NWTC Library, ErrMsgLen_C (and the equivalent value in the Python interface) can be updated 
@@ -219,6 +226,134 @@ CONTAINS
    end function Failed
 END SUBROUTINE IfW_C_CalcOutput
 
+!===============================================================================================================
+!------------------------------------------- IFW CALCVELOCITIES ------------------------------------------------
+!===============================================================================================================
+!> This routine calculates the wind velocities at NumPts_C points whose coordinates are given in separate X, Y and Z arrays
+!! and returns the U, V and W components in separate arrays. Unlike IfW_C_CalcOutput, the number of points is not limited to 
+!! the NumWindPts_C of IfW_C_Init and may change between calls, and the output channels are not calculated. Full-field wind
+!! (TurbSim, Bladed and HAWC files) is interpolated by IfW_FFWind_CalcOutputBatch; the other wind types use the same routine as
+!! IfW_C_CalcOutput.
+SUBROUTINE IfW_C_CalcVelocities(Time_C,NumPts_C,PosX_C,PosY_C,PosZ_C,VelU_C,VelV_C,VelW_C,ErrStat_C,ErrMsg_C) BIND (C, NAME='IfW_C_CalcVelocities')
+   IMPLICIT NONE
+#ifndef IMPLICIT_DLLEXPORT
+!DEC$ ATTRIBUTES DLLEXPORT :: IfW_C_CalcVelocities
+!GCC$ ATTRIBUTES DLLEXPORT :: IfW_C_CalcVelocities
+#endif
+   REAL(C_DOUBLE)                , INTENT(IN   )      :: Time_C
+   INTEGER(C_INT)                , INTENT(IN   )      :: NumPts_C
+   REAL(C_DOUBLE)                , INTENT(IN   )      :: PosX_C(NumPts_C)
+   REAL(C_DOUBLE)                , INTENT(IN   )      :: PosY_C(NumPts_C)
+   REAL(C_DOUBLE)                , INTENT(IN   )      :: PosZ_C(NumPts_C)
+   REAL(C_DOUBLE)                , INTENT(  OUT)      :: VelU_C(NumPts_C)
+   REAL(C_DOUBLE)                , INTENT(  OUT)      :: VelV_C(NumPts_C)
+   REAL(C_DOUBLE)                , INTENT(  OUT)      :: VelW_C(NumPts_C)
+   INTEGER(C_INT)                , INTENT(  OUT)      :: ErrStat_C
+   CHARACTER(KIND=C_CHAR)        , INTENT(  OUT)      :: ErrMsg_C(ErrMsgLen_C)
+
+   ! Local variables
+   REAL(DbKi)                                         :: Time
+   REAL(ReKi)                                         :: Pos(3), Vel(3)
+   INTEGER                                            :: i
+   INTEGER                                            :: ErrStat                          !< aggregated error message
+   CHARACTER(ErrMsgLen)                               :: ErrMsg                           !< aggregated error message
+   INTEGER                                            :: ErrStat2                         !< temporary error status  from a call
+   CHARACTER(ErrMsgLen)                               :: ErrMsg2                          !< temporary error message from a call
+   character(*), parameter                            :: RoutineName = 'IfW_C_CalcVelocities' !< for error handling
+
+   ! Initialize error handling
+   ErrStat  =  ErrID_None
+   ErrMsg   =  ""
+
+   Time = REAL(Time_C,DbKi)
+   if (NumPts_C < 1) then
+      call SetErr(ErrStat,ErrMsg,ErrStat_C,ErrMsg_C)
+      return
+   endif
+
+   if (p%WindType /= TSFF_WindNumber .and. p%WindType /= BladedFF_WindNumber .and. p%WindType /= HAWC_WindNumber) then
+      call CalcOtherWind();   if (Failed())  return
+      call SetErr(ErrStat,ErrMsg,ErrStat_C,ErrMsg_C)
+      return
+   endif
+
+   if (allocated(BatchPos)) then
+      if (size(BatchPos,1) < NumPts_C) deallocate(BatchPos, BatchVel)
+   endif
+   if (.not. allocated(BatchPos)) then
+      call AllocAry(BatchPos, NumPts_C, 3, 'BatchPos', ErrStat2, ErrMsg2);  if (Failed())  return
+      call AllocAry(BatchVel, NumPts_C, 3, 'BatchVel', ErrStat2, ErrMsg2);  if (Failed())  return
+   endif
+
+   ! Convert the positions to the wind file coordinates (see CalculateOutput in InflowWind_Subs)
+   if (p%RotateWindBox) then
+      do i = 1,NumPts_C
+         Pos = MATMUL( p%RotToWind, (/ REAL(PosX_C(i),ReKi), REAL(PosY_C(i),ReKi), REAL(PosZ_C(i),ReKi) /) - p%RefPosition ) + p%RefPosition
+         BatchPos(i,1) = Pos(1)
+         BatchPos(i,2) = Pos(2)
+         BatchPos(i,3) = Pos(3)
+      enddo
+   else
+      BatchPos(1:NumPts_C,1) = REAL(PosX_C,ReKi)
+      BatchPos(1:NumPts_C,2) = REAL(PosY_C,ReKi)
+      BatchPos(1:NumPts_C,3) = REAL(PosZ_C,ReKi)
+   endif
+
+   select case (p%WindType)
+   case (TSFF_WindNumber)
+      call IfW_FFWind_CalcOutputBatch(Time, BatchPos(1:NumPts_C,1), BatchPos(1:NumPts_C,2), BatchPos(1:NumPts_C,3), p%TSFFWind%FF, &
+                                      BatchVel(1:NumPts_C,1), BatchVel(1:NumPts_C,2), BatchVel(1:NumPts_C,3), ErrStat2, ErrMsg2)
+   case (BladedFF_WindNumber)
+      call IfW_FFWind_CalcOutputBatch(Time, BatchPos(1:NumPts_C,1), BatchPos(1:NumPts_C,2), BatchPos(1:NumPts_C,3), p%BladedFFWind%FF, &
+                                      BatchVel(1:NumPts_C,1), BatchVel(1:NumPts_C,2), BatchVel(1:NumPts_C,3), ErrStat2, ErrMsg2)
+   case (HAWC_WindNumber)
+      call IfW_FFWind_CalcOutputBatch(Time, BatchPos(1:NumPts_C,1), BatchPos(1:NumPts_C,2), BatchPos(1:NumPts_C,3), p%HAWCWind%FF, &
+                                      BatchVel(1:NumPts_C,1), BatchVel(1:NumPts_C,2), BatchVel(1:NumPts_C,3), ErrStat2, ErrMsg2)
+   end select
+      if (Failed())  return
+
+   ! Rotate the velocities back to the global coordinates
+   if (p%RotateWindBox) then
+      do i = 1,NumPts_C
+         Vel = MATMUL( p%RotFromWind, (/ BatchVel(i,1), BatchVel(i,2), BatchVel(i,3) /) )
+         VelU_C(i) = REAL(Vel(1), C_DOUBLE)
+         VelV_C(i) = REAL(Vel(2), C_DOUBLE)
+         VelW_C(i) = REAL(Vel(3), C_DOUBLE)
+      enddo
+   else
+      VelU_C = REAL(BatchVel(1:NumPts_C,1), C_DOUBLE)
+      VelV_C = REAL(BatchVel(1:NumPts_C,2), C_DOUBLE)
+      VelW_C = REAL(BatchVel(1:NumPts_C,3), C_DOUBLE)
+   endif
+
+   call SetErr(ErrStat,ErrMsg,ErrStat_C,ErrMsg_C)
+
+CONTAINS
+   logical function Failed()
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+      Failed = ErrStat >= AbortErrLev
+      if (Failed)    call SetErr(ErrStat,ErrMsg,ErrStat_C,ErrMsg_C)
+   end function Failed
+
+   !> Wind types without a batch kernel go through CalculateOutput with a temporary copy of the points
+   subroutine CalcOtherWind()
+      TYPE(InflowWind_InputType)                      :: BatchInput
+      TYPE(InflowWind_OutputType)                     :: BatchOutput
+
+      call AllocAry(BatchInput%PositionXYZ, 3, NumPts_C, 'BatchInput%PositionXYZ', ErrStat2, ErrMsg2);  if (ErrStat2 >= AbortErrLev) return
+      call AllocAry(BatchOutput%VelocityUVW, 3, NumPts_C, 'BatchOutput%VelocityUVW', ErrStat2, ErrMsg2);  if (ErrStat2 >= AbortErrLev) return
+      BatchInput%PositionXYZ(1,:) = REAL(PosX_C,ReKi)
+      BatchInput%PositionXYZ(2,:) = REAL(PosY_C,ReKi)
+      BatchInput%PositionXYZ(3,:) = REAL(PosZ_C,ReKi)
+
+      call CalculateOutput( Time, BatchInput, p, ContStates, DiscStates, ConstrStates, OtherStates, BatchOutput, m, .FALSE., ErrStat2, ErrMsg2 )
+
+      VelU_C = REAL(BatchOutput%VelocityUVW(1,:), C_DOUBLE)
+      VelV_C = REAL(BatchOutput%VelocityUVW(2,:), C_DOUBLE)
+      VelW_C = REAL(BatchOutput%VelocityUVW(3,:), C_DOUBLE)
+   end subroutine CalcOtherWind
+END SUBROUTINE IfW_C_CalcVelocities
+
 !===============================================================================================================
 !--------------------------------------------------- IFW END ---------------------------------------------------
 !===============================================================================================================
@@ -239,6 +374,9 @@ SUBROUTINE IfW_C_End(ErrStat_C,ErrMsg_C) BIND (C, NAME='IfW_C_End')
    ! Call the main subroutine InflowWind_End
    CALL InflowWind_End( InputData, p, ContStates, DiscStates, ConstrStates, OtherStates, y, m, ErrStat, ErrMsg )
 
+   if (allocated(BatchPos)) deallocate(BatchPos)
+   if (allocated(BatchVel)) deallocate(BatchVel)
+
    call SetErr(ErrStat,ErrMsg,ErrStat_C,ErrMsg_C)
 
 END SUBROUTINE IfW_C_End
@@ -0,0 +1,30 @@
+#ifndef IFW_C_BINDING_H
+#define IFW_C_BINDING_H
+
+// routines in the ifw_c_binding library (IfW_C_Binding.f90)
+
+#ifdef __cplusplus
+#define IFW_EXTERNAL_ROUTINE extern "C"
+#else
+#define IFW_EXTERNAL_ROUTINE extern
+#endif
+
+// InputFileString and InputUniformString hold the lines of the files separated by NULL characters
+IFW_EXTERNAL_ROUTINE void IfW_C_Init(const char **InputFileString, int *InputFileStringLength, const char **InputUniformString, int *InputUniformStringLength,
+   int *NumWindPts, double *DT, int *NumChannels, char *OutputChannelNames, char *OutputChannelUnits, int *ErrStat, char *ErrMsg);
+// Positions and Velocities hold x,y,z (u,v,w) of each of the NumWindPts points of IfW_C_Init
+IFW_EXTERNAL_ROUTINE void IfW_C_CalcOutput(double *Time, float *Positions, float *Velocities, float *OutputChannelValues, int *ErrStat, char *ErrMsg);
+// Velocities at any number of points, with one array per coordinate and velocity component; no output channels.
+// Not reentrant: the points are copied to work arrays shared by all calls (kept to avoid an allocation per call),
+// so calls from different threads must be serialized by the caller, like the other routines of this library.
+IFW_EXTERNAL_ROUTINE void IfW_C_CalcVelocities(double *Time, int *NumPts, const double *PosX, const double *PosY, const double *PosZ,
+   double *VelU, double *VelV, double *VelW, int *ErrStat, char *ErrMsg);
+IFW_EXTERNAL_ROUTINE void IfW_C_End(int *ErrStat, char *ErrMsg);
+
+// some constants (keep these synced with values in IfW_C_Binding.f90, InflowWind_Subs.f90 and NWTC_Base.f90)
+#define IFW_ERRMSG_LENGTH 1025
+#define IFW_CHANNEL_LENGTH 20
+#define IFW_ERRID_FATAL 4
+#define IFW_MAXIMUM_OUTPUTS 59   // MaxOutPts in InflowWind_Subs.f90
+
+#endif
@@ -36,6 +36,7 @@ MODULE IfW_FFWind_Base
 
    USE                                          NWTC_Library
    USE                                          IfW_FFWind_Base_Types
+   USE, INTRINSIC                            :: ISO_C_BINDING
 
    IMPLICIT                                     NONE
 
@@ -48,7 +49,94 @@ MODULE IfW_FFWind_Base
    INTEGER(IntKi), PARAMETER  :: ScaleMethod_None         = 0     !< no scaling
    INTEGER(IntKi), PARAMETER  :: ScaleMethod_Direct       = 1     !< direct scaling factors
    INTEGER(IntKi), PARAMETER  :: ScaleMethod_StdDev       = 2     !< requested standard deviation
-   
+
+   CHARACTER(*),   PARAMETER  :: MappedFile_ID            = 'IfW.FFM'  !< first characters of a memory-mapped full-field file
+   INTEGER(IntKi), PARAMETER  :: MappedFile_Version       = 1     !< version of the memory-mapped full-field file layout
+   INTEGER(IntKi), PARAMETER  :: MappedFile_Align         = 4096  !< the FF and tower data of a memory-mapped file start at multiples of this many bytes
+
+
+      !> Header of a memory-mapped full-field file (see ConvertFFWind_to_Mapped). The FF data (FFData) and tower data (FFTower)
+      !! of the parameters follow at DataOffset and TowerOffset bytes from the start of the file, as 4-byte reals in the byte order
+      !! of the machine that wrote the file. The components are ordered so that there is no padding.
+   TYPE, BIND(C) :: FFWind_MappedHeader
+      CHARACTER(KIND=C_CHAR)  :: FileID(8)                         !< MappedFile_ID, NULL terminated
+      INTEGER(C_INT32_T)      :: Version                           !< MappedFile_Version
+      INTEGER(C_INT32_T)      :: NZGrids
+      INTEGER(C_INT32_T)      :: NYGrids
+      INTEGER(C_INT32_T)      :: NFFComp
+      INTEGER(C_INT32_T)      :: NFFSteps
+      INTEGER(C_INT32_T)      :: NTGrids
+      INTEGER(C_INT32_T)      :: NDataSlices                       !< last dimension of FFData
+      INTEGER(C_INT32_T)      :: NTowerSlices                      !< last dimension of FFTower
+      INTEGER(C_INT32_T)      :: WindFileFormat
+      INTEGER(C_INT32_T)      :: WindProfileType
+      INTEGER(C_INT32_T)      :: Periodic                          !< 1 = .TRUE.
+      INTEGER(C_INT32_T)      :: InterpTower                       !< 1 = .TRUE.
+      INTEGER(C_INT32_T)      :: AddMeanAfterInterp                !< 1 = .TRUE.
+      INTEGER(C_INT32_T)      :: Unused
+      INTEGER(C_INT64_T)      :: DataOffset
+      INTEGER(C_INT64_T)      :: TowerOffset
+      REAL(C_DOUBLE)          :: FFDTime
+      REAL(C_DOUBLE)          :: FFRate
+      REAL(C_DOUBLE)          :: FFYHWid
+      REAL(C_DOUBLE)          :: FFZHWid
+      REAL(C_DOUBLE)          :: RefHt
+      REAL(C_DOUBLE)          :: GridBase
+      REAL(C_DOUBLE)          :: InitXPosition
+      REAL(C_DOUBLE)          :: InvFFYD
+      REAL(C_DOUBLE)          :: InvFFZD
+      REAL(C_DOUBLE)          :: InvMFFWS
+      REAL(C_DOUBLE)          :: MeanFFWS
+      REAL(C_DOUBLE)          :: TotalTime
+      REAL(C_DOUBLE)          :: PLExp
+      REAL(C_DOUBLE)          :: Z0
+   END TYPE FFWind_MappedHeader
+
+      !> A memory-mapped full-field file. Parameters that use it have p%MapID set to its index in MappedFiles; the file stays
+      !! mapped while any of them uses it, so several instances in one process share one mapping. The users are the parameters
+      !! that FFWind_MapFile was called with, identified by their addresses: a copy of them (e.g., from IfW_FFWind_CopyParam,
+      !! which copies p%MapID like any other integer) reads the same mapping but does not own it, so releasing the copy does not
+      !! unmap the file, and the copy must not be used after the parameters it was copied from are released.
+      !! Instances may be mapped and released on several threads at once (e.g., by FastBatchRunner), so MappedFiles is only
+      !! changed with the lock of IfW_MappedFile.c held. Its entries never move, so FFWind_GetData reads the data pointers of an
+      !! entry in use without the lock: they only change when the entry is free.
+   TYPE :: FFWind_MappedFile
+      CHARACTER(1024)                       :: FileName = ''
+      INTEGER(IntKi)                        :: NumUsers = 0
+      INTEGER(C_INTPTR_T), ALLOCATABLE      :: Users(:)                  !< addresses of the parameters that use the file (1:NumUsers)
+      TYPE(C_PTR)                           :: Base     = C_NULL_PTR
+      INTEGER(C_INT64_T)                    :: nBytes   = 0
+      REAL(SiKi), POINTER, CONTIGUOUS       :: FFData(:,:,:,:) => NULL()
+      REAL(SiKi), POINTER, CONTIGUOUS       :: FFTower(:,:,:)  => NULL()
+   END TYPE FFWind_MappedFile
+
+   INTEGER(IntKi), PARAMETER, PRIVATE :: MaxMappedFiles = 64             !< number of files that can be mapped at once in a process
+   TYPE(FFWind_MappedFile), SAVE, PRIVATE :: MappedFiles(MaxMappedFiles)
+   PRIVATE :: MapFileLocked, ReleaseUserLocked
+
+   INTERFACE
+         ! see IfW_MappedFile.c
+      FUNCTION IfW_MapFile(FileName, Base, nBytes) BIND(C, NAME='IfW_MapFile')
+         IMPORT                                :: C_CHAR, C_PTR, C_INT, C_INT64_T
+         CHARACTER(KIND=C_CHAR), INTENT(IN   ) :: FileName(*)
+         TYPE(C_PTR),            INTENT(  OUT) :: Base
+         INTEGER(C_INT64_T),     INTENT(  OUT) :: nBytes
+         INTEGER(C_INT)                        :: IfW_MapFile
+      END FUNCTION IfW_MapFile
+
+      SUBROUTINE IfW_UnmapFile(Base, nBytes) BIND(C, NAME='IfW_UnmapFile')
+         IMPORT                                :: C_PTR, C_INT64_T
+         TYPE(C_PTR), VALUE                    :: Base
+         INTEGER(C_INT64_T),     INTENT(IN   ) :: nBytes
+      END SUBROUTINE IfW_UnmapFile
+
+      SUBROUTINE IfW_LockMappedFiles() BIND(C, NAME='IfW_LockMappedFiles')
+      END SUBROUTINE IfW_LockMappedFiles
+
+      SUBROUTINE IfW_UnlockMappedFiles() BIND(C, NAME='IfW_UnlockMappedFiles')
+      END SUBROUTINE IfW_UnlockMappedFiles
+   END INTERFACE
+
 
 CONTAINS
 !====================================================================================================
@@ -142,6 +230,181 @@ SUBROUTINE IfW_FFWind_CalcOutput(Time, PositionXYZ, p, Velocity, DiskVel, ErrSta
    RETURN
 
 END SUBROUTINE IfW_FFWind_CalcOutput
+!====================================================================================================
+!> This routine calculates the velocities at a batch of points whose coordinates are given in separate X, Y and Z arrays and
+!! returns the U, V and W components in separate arrays. It gives the same velocities as IfW_FFWind_CalcOutput, but it works on
+!! chunks of points: one loop finds the bounding time slices, grid rows and columns and the interpolation weights of all points
+!! in the chunk, and a second loop does the trilinear interpolation of the points inside the grid. Neither loop calls functions
+!! or builds error messages, but they are not branch free: the first one has the periodic/non-periodic time branches, and the
+!! second one skips the points outside the grid and gathers the corner values from FFData through the computed indices, so
+!! whether and how well they vectorize is up to the compiler. The few points that are not inside the grid (below the ground,
+!! on the tower, on the top row or last column of the grid, or outside the time range of non-periodic files) are passed to
+!! FFWind_Interp in a third loop.
+SUBROUTINE IfW_FFWind_CalcOutputBatch(Time, PosX, PosY, PosZ, p, VelU, VelV, VelW, ErrStat, ErrMsg)
+
+   IMPLICIT                                                       NONE
+
+   REAL(DbKi),                                  INTENT(IN   )  :: Time              !< time from the start of the simulation
+   REAL(ReKi),                                  INTENT(IN   )  :: PosX(:)           !< X coordinates of the points
+   REAL(ReKi),                                  INTENT(IN   )  :: PosY(:)           !< Y coordinates of the points
+   REAL(ReKi),                                  INTENT(IN   )  :: PosZ(:)           !< Z coordinates of the points
+   TYPE(IfW_FFWind_ParameterType), TARGET,      INTENT(IN   )  :: p                 !< Parameters
+   REAL(ReKi),                                  INTENT(INOUT)  :: VelU(:)           !< U component of the velocity at Time
+   REAL(ReKi),                                  INTENT(INOUT)  :: VelV(:)           !< V component of the velocity at Time
+   REAL(ReKi),                                  INTENT(INOUT)  :: VelW(:)           !< W component of the velocity at Time
+   INTEGER(IntKi),                              INTENT(  OUT)  :: ErrStat           !< error status
+   CHARACTER(*),                                INTENT(  OUT)  :: ErrMsg            !< The error message
+
+      ! local variables
+   INTEGER(IntKi),   PARAMETER                                 :: ChunkSize = 256   ! number of points whose indices are kept at a time
+   REAL(ReKi),       PARAMETER                                 :: Tol = 1.0E-3      ! same tolerance as FFWind_Interp
+   CHARACTER(*),     PARAMETER                                 :: RoutineName = 'IfW_FFWind_CalcOutputBatch'
+
+   INTEGER(IntKi)                                              :: ITLO(ChunkSize), ITHI(ChunkSize)  ! bounding time slices
+   INTEGER(IntKi)                                              :: IYLO(ChunkSize), IYHI(ChunkSize)  ! bounding grid columns
+   INTEGER(IntKi)                                              :: IZLO(ChunkSize), IZHI(ChunkSize)  ! bounding grid rows
+   REAL(ReKi)                                                  :: T(ChunkSize), Y(ChunkSize), Z(ChunkSize) ! relative positions between the bounds (-1 to 1)
+   LOGICAL                                                     :: InGrid(ChunkSize) ! the point is inside the grid and the time range
+
+   REAL(ReKi)                                                  :: TimeShifted
+   REAL(ReKi)                                                  :: TGRID, YGRID, ZGRID
+   REAL(ReKi)                                                  :: N(8)              ! scaling factors for the interpolation
+   REAL(ReKi)                                                  :: Vel(3)
+   REAL(SiKi), POINTER, CONTIGUOUS                             :: FFData(:,:,:,:)   ! the FF data of p
+   REAL(SiKi), POINTER, CONTIGUOUS                             :: FFTower(:,:,:)    ! the tower data of p (not used here)
+   INTEGER(IntKi)                                              :: NumPoints, FirstPoint, NumInChunk
+   INTEGER(IntKi)                                              :: i, k, IDIM
+
+   INTEGER(IntKi)                                              :: TmpErrStat        ! temporary error status
+   CHARACTER(ErrMsgLen)                                        :: TmpErrMsg         ! temporary error message
+
+
+   ErrStat     = ErrID_None
+   ErrMsg      = ''
+
+   NumPoints   = SIZE(PosX)
+   CALL FFWind_GetData(p, FFData, FFTower)
+
+   !$OMP PARALLEL DO default(shared) if(NumPoints>4*ChunkSize) schedule(static) &
+   !$OMP private(FirstPoint, NumInChunk, i, k, IDIM, ITLO, ITHI, IYLO, IYHI, IZLO, IZHI, T, Y, Z, InGrid, TimeShifted, TGRID, YGRID, ZGRID, N, Vel, TmpErrStat, TmpErrMsg)
+   DO FirstPoint = 1, NumPoints, ChunkSize
+
+      NumInChunk = MIN( ChunkSize, NumPoints - FirstPoint + 1 )
+
+      !-------------------------------------------------------------------------------------------------
+      ! Bounding time slices, columns and rows (see FFWind_Interp for the details)
+      !-------------------------------------------------------------------------------------------------
+      DO k = 1, NumInChunk
+         i = FirstPoint + k - 1
+
+         TimeShifted = TIME + ( p%InitXPosition - PosX(i) )*p%InvMFFWS
+
+         IF ( p%Periodic ) THEN
+            TimeShifted = MODULO( TimeShifted, p%TotalTime )
+            IF (TimeShifted == p%TotalTime) TimeShifted = 0.0_ReKi
+
+            TGRID   = TimeShifted*p%FFRate
+            ITLO(k) = INT( TGRID )
+            T(k)    = 2.0_ReKi * ( TGRID - REAL(ITLO(k), ReKi) ) - 1.0_ReKi
+
+            ITLO(k) = ITLO(k) + 1
+            IF ( ITLO(k) == p%NFFSteps ) THEN
+               ITHI(k) = 1
+            ELSE
+               IF (ITLO(k) > p%NFFSteps) ITLO(k) = 1
+               ITHI(k) = ITLO(k) + 1
+            ENDIF
+            InGrid(k) = .TRUE.
+         ELSE
+            TGRID   = TimeShifted*p%FFRate
+            ITLO(k) = INT( TGRID )
+            T(k)    = 2.0_ReKi * ( TGRID - REAL(ITLO(k), ReKi) ) - 1.0_ReKi
+
+            ITLO(k) = ITLO(k) + 1
+            ITHI(k) = ITLO(k) + 1
+            InGrid(k) = ITLO(k) >= 1 .AND. ITLO(k) < p%NFFSteps
+         ENDIF
+
+         ZGRID   = ( PosZ(i) - p%GridBase )*p%InvFFZD
+         IZLO(k) = INT( ZGRID ) + 1
+         IZHI(k) = IZLO(k) + 1
+         Z(k)    = 2.0_ReKi * (ZGRID - REAL(IZLO(k) - 1_IntKi, ReKi)) - 1.0_ReKi
+
+         YGRID   = ( PosY(i) + p%FFYHWid )*p%InvFFYD
+         IYLO(k) = INT( YGRID ) + 1
+         IYHI(k) = IYLO(k) + 1
+         Y(k)    = 2.0_ReKi * (YGRID - REAL(IYLO(k) - 1_IntKi, ReKi)) - 1.0_ReKi
+
+         InGrid(k) = InGrid(k) .AND. PosZ(i) > 0.0_ReKi .AND. ZGRID > -1*TOL .AND. &
+                     IZLO(k) < p%NZGrids .AND. IYLO(k) >= 1 .AND. IYLO(k) < p%NYGrids
+      END DO
+
+      !-------------------------------------------------------------------------------------------------
+      ! Interpolate on the grid
+      !-------------------------------------------------------------------------------------------------
+      DO k = 1, NumInChunk
+         IF ( .NOT. InGrid(k) ) CYCLE
+         i = FirstPoint + k - 1
+
+         N(1)  = ( 1.0_ReKi + Z(k) )*( 1.0_ReKi - Y(k) )*( 1.0_ReKi - T(k) )
+         N(2)  = ( 1.0_ReKi + Z(k) )*( 1.0_ReKi + Y(k) )*( 1.0_ReKi - T(k) )
+         N(3)  = ( 1.0_ReKi - Z(k) )*( 1.0_ReKi + Y(k) )*( 1.0_ReKi - T(k) )
+         N(4)  = ( 1.0_ReKi - Z(k) )*( 1.0_ReKi - Y(k) )*( 1.0_ReKi - T(k) )
+         N(5)  = ( 1.0_ReKi + Z(k) )*( 1.0_ReKi - Y(k) )*( 1.0_ReKi + T(k) )
+         N(6)  = ( 1.0_ReKi + Z(k) )*( 1.0_ReKi + Y(k) )*( 1.0_ReKi + T(k) )
+         N(7)  = ( 1.0_ReKi - Z(k) )*( 1.0_ReKi + Y(k) )*( 1.0_ReKi + T(k) )
+         N(8)  = ( 1.0_ReKi - Z(k) )*( 1.0_ReKi - Y(k) )*( 1.0_ReKi + T(k) )
+         N     = N / REAL( SIZE(N), ReKi )  ! normalize
+
+         Vel = 0.0_ReKi
+         DO IDIM = 1, p%NFFComp
+            Vel(IDIM) = N(1)*FFData( IZHI(k), IYLO(k), IDIM, ITLO(k) ) &
+                      + N(2)*FFData( IZHI(k), IYHI(k), IDIM, ITLO(k) ) &
+                      + N(3)*FFData( IZLO(k), IYHI(k), IDIM, ITLO(k) ) &
+                      + N(4)*FFData( IZLO(k), IYLO(k), IDIM, ITLO(k) ) &
+                      + N(5)*FFData( IZHI(k), IYLO(k), IDIM, ITHI(k) ) &
+                      + N(6)*FFData( IZHI(k), IYHI(k), IDIM, ITHI(k) ) &
+                      + N(7)*FFData( IZLO(k), IYHI(k), IDIM, ITHI(k) ) &
+                      + N(8)*FFData( IZLO(k), IYLO(k), IDIM, ITHI(k) )
+         END DO
+         VelU(i) = Vel(1)
+         VelV(i) = Vel(2)
+         VelW(i) = Vel(3)
+      END DO
+
+      !-------------------------------------------------------------------------------------------------
+      ! The other points, including the ones that are out of bounds
+      !-------------------------------------------------------------------------------------------------
+      DO k = 1, NumInChunk
+         IF ( InGrid(k) ) CYCLE
+         i = FirstPoint + k - 1
+
+         Vel = FFWind_Interp(Time, (/ PosX(i), PosY(i), PosZ(i) /), p, TmpErrStat, TmpErrMsg)
+         VelU(i) = Vel(1)
+         VelV(i) = Vel(2)
+         VelW(i) = Vel(3)
+
+         IF (TmpErrStat /= ErrID_None) THEN
+            !$OMP CRITICAL  ! Needed to avoid data race on ErrStat and ErrMsg
+            CALL SetErrStat( TmpErrStat, TmpErrMsg, ErrStat, ErrMsg, RoutineName//" [position=("//   &
+                                                         TRIM(Num2LStr(PosX(i)))//", "// &
+                                                         TRIM(Num2LStr(PosY(i)))//", "// &
+                                                         TRIM(Num2LStr(PosZ(i)))//")  in wind-file coordinates]" )
+            !$OMP END CRITICAL
+         END IF
+      END DO
+
+   END DO
+   !$OMP END PARALLEL DO
+   IF (ErrStat >= AbortErrLev) RETURN
+
+   IF (p%AddMeanAfterInterp) THEN
+      DO i = 1, NumPoints
+         VelU(i) = VelU(i) + CalculateMeanVelocity(p,PosZ(i))
+      ENDDO
+   END IF
+
+END SUBROUTINE IfW_FFWind_CalcOutputBatch
 !+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-
 !>    This function is used to interpolate into the full-field wind array or tower array if it has
 !!    been defined and is necessary for the given inputs.  It receives X, Y, Z and
@@ -168,7 +431,7 @@ FUNCTION FFWind_Interp(Time, Position, p, ErrStat, ErrMsg)
 
    REAL(DbKi),                            INTENT(IN   )  :: Time              !< time (s)
    REAL(ReKi),                            INTENT(IN   )  :: Position(3)       !< takes the place of XGrnd, YGrnd, ZGrnd
-   TYPE(IfW_FFWind_ParameterType),        INTENT(IN   )  :: p                 !< Parameters
+   TYPE(IfW_FFWind_ParameterType), TARGET,INTENT(IN   )  :: p                 !< Parameters
    REAL(ReKi)                                            :: FFWind_Interp(3)  !< The U, V, W velocities
 
    INTEGER(IntKi),                        INTENT(  OUT)  :: ErrStat           !< error status
@@ -199,6 +462,9 @@ FUNCTION FFWind_Interp(Time, Position, p, ErrStat, ErrMsg)
 
    LOGICAL                                               :: OnGrid
 
+   REAL(SiKi), POINTER, CONTIGUOUS                       :: FFData(:,:,:,:)   ! the FF data of p
+   REAL(SiKi), POINTER, CONTIGUOUS                       :: FFTower(:,:,:)    ! the tower data of p
+
    !-------------------------------------------------------------------------------------------------
    ! Initialize variables
    !-------------------------------------------------------------------------------------------------
@@ -366,6 +632,8 @@ FUNCTION FFWind_Interp(Time, Position, p, ErrStat, ErrMsg)
 
    END IF
 
+   CALL FFWind_GetData(p, FFData, FFTower)
+
    IF ( OnGrid ) THEN      ! The tower points don't use this
 
       CALL GetInterpValues(); if (ErrStat/=ErrID_None) return
@@ -376,14 +644,14 @@ FUNCTION FFWind_Interp(Time, Position, p, ErrStat, ErrMsg)
 
       DO IDIM=1,p%NFFComp       ! all the components
 
-         u(1)  = p%FFData( IZHI, IYLO, IDIM, ITLO )
-         u(2)  = p%FFData( IZHI, IYHI, IDIM, ITLO )
-         u(3)  = p%FFData( IZLO, IYHI, IDIM, ITLO )
-         u(4)  = p%FFData( IZLO, IYLO, IDIM, ITLO )
-         u(5)  = p%FFData( IZHI, IYLO, IDIM, ITHI )
-         u(6)  = p%FFData( IZHI, IYHI, IDIM, ITHI )
-         u(7)  = p%FFData( IZLO, IYHI, IDIM, ITHI )
-         u(8)  = p%FFData( IZLO, IYLO, IDIM, ITHI )
+         u(1)  = FFData( IZHI, IYLO, IDIM, ITLO )
+         u(2)  = FFData( IZHI, IYHI, IDIM, ITLO )
+         u(3)  = FFData( IZLO, IYHI, IDIM, ITLO )
+         u(4)  = FFData( IZLO, IYLO, IDIM, ITLO )
+         u(5)  = FFData( IZHI, IYLO, IDIM, ITHI )
+         u(6)  = FFData( IZHI, IYHI, IDIM, ITHI )
+         u(7)  = FFData( IZLO, IYHI, IDIM, ITHI )
+         u(8)  = FFData( IZLO, IYLO, IDIM, ITHI )
             
          FFWind_Interp(IDIM)  =  SUM ( N * u ) 
 
@@ -401,12 +669,12 @@ FUNCTION FFWind_Interp(Time, Position, p, ErrStat, ErrMsg)
 
          DO IDIM=1,p%NFFComp       ! all the components
 
-            u(1)  = p%FFData( IZHI, IYLO, IDIM, ITLO )
-            u(2)  = p%FFData( IZHI, IYHI, IDIM, ITLO )
+            u(1)  = FFData( IZHI, IYLO, IDIM, ITLO )
+            u(2)  = FFData( IZHI, IYHI, IDIM, ITLO )
             u(3)  = 0.0_ReKi !p%FFData( IZLO, IYHI, IDIM, ITLO )
             u(4)  = 0.0_ReKi !p%FFData( IZLO, IYLO, IDIM, ITLO )
-            u(5)  = p%FFData( IZHI, IYLO, IDIM, ITHI )
-            u(6)  = p%FFData( IZHI, IYHI, IDIM, ITHI )
+            u(5)  = FFData( IZHI, IYLO, IDIM, ITHI )
+            u(6)  = FFData( IZHI, IYHI, IDIM, ITHI )
             u(7)  = 0.0_ReKi !p%FFData( IZLO, IYHI, IDIM, ITHI )
             u(8)  = 0.0_ReKi !p%FFData( IZLO, IYLO, IDIM, ITHI )
             
@@ -437,12 +705,12 @@ FUNCTION FFWind_Interp(Time, Position, p, ErrStat, ErrMsg)
                v(1)  =  0.0_ReKi  ! on the ground
                v(2)  =  0.0_ReKi  ! on the ground
             ELSE
-               v(1)  =  p%FFTower( IDIM, IZHI, ITLO )
-               v(2)  =  p%FFTower( IDIM, IZHI, ITHI )
+               v(1)  =  FFTower( IDIM, IZHI, ITLO )
+               v(2)  =  FFTower( IDIM, IZHI, ITHI )
             END IF
             
-            v(3)  =  p%FFTower( IDIM, IZLO, ITLO )
-            v(4)  =  p%FFTower( IDIM, IZLO, ITHI )
+            v(3)  =  FFTower( IDIM, IZLO, ITLO )
+            v(4)  =  FFTower( IDIM, IZLO, ITHI )
             
             FFWind_Interp(IDIM)  =  SUM ( M * v ) 
 
@@ -775,7 +1043,7 @@ END SUBROUTINE FFWind_ValidateInput
 !====================================================================================================
 SUBROUTINE ConvertFFWind_to_HAWC2(FileRootName, p, ErrStat, ErrMsg)
    CHARACTER(*),                             INTENT(IN   )  :: FileRootName      !< RootName for output files
-   TYPE(IfW_FFWind_ParameterType),           INTENT(IN   )  :: p                 !< Parameters
+   TYPE(IfW_FFWind_ParameterType), TARGET,   INTENT(IN   )  :: p                 !< Parameters
 
    INTEGER(IntKi),                           INTENT(  OUT)  :: ErrStat           !< Error status of the operation
    CHARACTER(*),                             INTENT(  OUT)  :: ErrMsg            !< Error message if ErrStat /= ErrID_None
@@ -783,12 +1051,15 @@ SUBROUTINE ConvertFFWind_to_HAWC2(FileRootName, p, ErrStat, ErrMsg)
 
       ! Local variables
    REAL(SiKi)                                               :: delta(3)
+   REAL(SiKi), POINTER, CONTIGUOUS                          :: FFData(:,:,:,:)
+   REAL(SiKi), POINTER, CONTIGUOUS                          :: FFTower(:,:,:)
 
    delta(1) = p%MeanFFWS * p%FFDTime
    delta(2) = 1.0_SiKi / p%InvFFYD
    delta(3) = 1.0_SiKi / p%InvFFZD
    
-   CALL WrBinHAWC(FileRootName, p%FFData(:,:,:,1:p%NFFSteps), delta, ErrStat, ErrMsg)
+   CALL FFWind_GetData(p, FFData, FFTower)
+   CALL WrBinHAWC(FileRootName, FFData(:,:,:,1:p%NFFSteps), delta, ErrStat, ErrMsg)
 
    IF (.NOT. p%Periodic) THEN
       call SetErrStat( ErrID_Severe, 'File converted to HAWC format is not periodic. Jumps may occur in resulting simulation.', &
@@ -799,7 +1070,7 @@ END SUBROUTINE ConvertFFWind_to_HAWC2
 !====================================================================================================
 SUBROUTINE ConvertFFWind_to_Bladed(FileRootName, p, ErrStat, ErrMsg)
    CHARACTER(*),                             INTENT(IN   )  :: FileRootName      !< RootName for output files
-   TYPE(IfW_FFWind_ParameterType),           INTENT(IN   )  :: p                 !< Parameters
+   TYPE(IfW_FFWind_ParameterType), TARGET,   INTENT(IN   )  :: p                 !< Parameters
 
    INTEGER(IntKi),                           INTENT(  OUT)  :: ErrStat           !< Error status of the operation
    CHARACTER(*),                             INTENT(  OUT)  :: ErrMsg            !< Error message if ErrStat /= ErrID_None
@@ -807,14 +1078,118 @@ SUBROUTINE ConvertFFWind_to_Bladed(FileRootName, p, ErrStat, ErrMsg)
 
       ! Local variables
    REAL(SiKi)                                               :: delta(3)
+   REAL(SiKi), POINTER, CONTIGUOUS                          :: FFData(:,:,:,:)
+   REAL(SiKi), POINTER, CONTIGUOUS                          :: FFTower(:,:,:)
 
    delta(1) = p%MeanFFWS * p%FFDTime
    delta(2) = 1.0_SiKi / p%InvFFYD
    delta(3) = 1.0_SiKi / p%InvFFZD
    
-   CALL WrBinBladed(FileRootName, p%FFData(:,:,:,1:p%NFFSteps), delta, p%MeanFFWS, p%RefHt, p%GridBase, p%Periodic, p%AddMeanAfterInterp, ErrStat, ErrMsg)
+   CALL FFWind_GetData(p, FFData, FFTower)
+   CALL WrBinBladed(FileRootName, FFData(:,:,:,1:p%NFFSteps), delta, p%MeanFFWS, p%RefHt, p%GridBase, p%Periodic, p%AddMeanAfterInterp, ErrStat, ErrMsg)
 
 END SUBROUTINE ConvertFFWind_to_Bladed
+!====================================================================================================
+!> This routine writes the FF and tower data of p, with the parameters needed to use them, to a memory-mapped full-field file
+!! named FileRootName.ffm. InflowWind reads this file with WindType = 3 (TurbSim full-field) by mapping it into memory instead
+!! of reading it (see FFWind_MapFile), so initialization doesn't depend on the size of the file and all processes on a machine
+!! share one copy of the data in the page cache. The file holds the data after any scaling and mean wind profile have been
+!! applied, and it is written in the byte order of this machine.
+SUBROUTINE ConvertFFWind_to_Mapped(FileRootName, p, ErrStat, ErrMsg)
+   CHARACTER(*),                             INTENT(IN   )  :: FileRootName      !< RootName for output files
+   TYPE(IfW_FFWind_ParameterType), TARGET,   INTENT(IN   )  :: p                 !< Parameters
+
+   INTEGER(IntKi),                           INTENT(  OUT)  :: ErrStat           !< Error status of the operation
+   CHARACTER(*),                             INTENT(  OUT)  :: ErrMsg            !< Error message if ErrStat /= ErrID_None
+
+
+      ! Local variables
+   TYPE(FFWind_MappedHeader)                                :: Header
+   REAL(SiKi), POINTER, CONTIGUOUS                          :: FFData(:,:,:,:)
+   REAL(SiKi), POINTER, CONTIGUOUS                          :: FFTower(:,:,:)
+   CHARACTER(1024)                                          :: FileName
+   INTEGER(IntKi)                                           :: UnWind
+   INTEGER(IntKi)                                           :: i
+   INTEGER(IntKi)                                           :: IOS
+
+   INTEGER(IntKi)                                           :: ErrStat2
+   CHARACTER(ErrMsgLen)                                     :: ErrMsg2
+   CHARACTER(*), PARAMETER                                  :: RoutineName = 'ConvertFFWind_to_Mapped'
+
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+
+   CALL FFWind_GetData(p, FFData, FFTower)
+   IF (.NOT. ASSOCIATED(FFData)) THEN
+      CALL SetErrStat( ErrID_Fatal, 'There are no FF data to write.', ErrStat, ErrMsg, RoutineName )
+      RETURN
+   END IF
+
+   Header%FileID = C_NULL_CHAR
+   DO i = 1, LEN(MappedFile_ID)
+      Header%FileID(i) = MappedFile_ID(i:i)
+   END DO
+   Header%Version            = MappedFile_Version
+   Header%NZGrids            = p%NZGrids
+   Header%NYGrids            = p%NYGrids
+   Header%NFFComp            = p%NFFComp
+   Header%NFFSteps           = p%NFFSteps
+   Header%NTGrids            = 0
+   Header%NDataSlices        = SIZE(FFData,4)
+   Header%NTowerSlices       = 0
+   IF (ASSOCIATED(FFTower) .AND. p%NTGrids > 0) THEN
+      Header%NTGrids         = p%NTGrids
+      Header%NTowerSlices    = SIZE(FFTower,3)
+   END IF
+   Header%WindFileFormat     = p%WindFileFormat
+   Header%WindProfileType    = p%WindProfileType
+   Header%Periodic           = MERGE(1, 0, p%Periodic)
+   Header%InterpTower        = MERGE(1, 0, p%InterpTower)
+   Header%AddMeanAfterInterp = MERGE(1, 0, p%AddMeanAfterInterp)
+   Header%Unused             = 0
+   Header%FFDTime            = p%FFDTime
+   Header%FFRate             = p%FFRate
+   Header%FFYHWid            = p%FFYHWid
+   Header%FFZHWid            = p%FFZHWid
+   Header%RefHt              = p%RefHt
+   Header%GridBase           = p%GridBase
+   Header%InitXPosition      = p%InitXPosition
+   Header%InvFFYD            = p%InvFFYD
+   Header%InvFFZD            = p%InvFFZD
+   Header%InvMFFWS           = p%InvMFFWS
+   Header%MeanFFWS           = p%MeanFFWS
+   Header%TotalTime          = p%TotalTime
+   Header%PLExp              = p%PLExp
+   Header%Z0                 = p%Z0
+
+      ! the data start on page boundaries
+   Header%DataOffset         = MappedFile_Align
+   Header%TowerOffset        = Header%DataOffset + C_SIZEOF(FFData(1,1,1,1))*SIZE(FFData, KIND=C_INT64_T)
+   Header%TowerOffset        = ( (Header%TowerOffset + MappedFile_Align - 1) / MappedFile_Align ) * MappedFile_Align
+
+   FileName = TRIM(FileRootName)//'.ffm'
+
+   CALL GetNewUnit( UnWind, ErrStat2, ErrMsg2 )
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+      IF (ErrStat >= AbortErrLev) RETURN
+
+      ! STATUS='REPLACE' so that nothing of an older, longer file is left at the end
+   OPEN( UnWind, FILE=TRIM(FileName), STATUS='REPLACE', FORM='UNFORMATTED', ACCESS='STREAM', ACTION='WRITE', IOSTAT=IOS )
+   IF (IOS /= 0) THEN
+      CALL SetErrStat( ErrID_Fatal, 'Cannot open file "'//TRIM(FileName)//'".', ErrStat, ErrMsg, RoutineName )
+      RETURN
+   END IF
+
+   WRITE( UnWind, POS=1, IOSTAT=IOS ) Header
+   IF (IOS == 0) WRITE( UnWind, POS=Header%DataOffset+1, IOSTAT=IOS ) FFData
+   IF (IOS == 0 .AND. Header%NTGrids > 0) WRITE( UnWind, POS=Header%TowerOffset+1, IOSTAT=IOS ) FFTower
+   CLOSE( UnWind )
+
+   IF (IOS /= 0) THEN
+      CALL SetErrStat( ErrID_Fatal, 'Error writing file "'//TRIM(FileName)//'".', ErrStat, ErrMsg, RoutineName )
+   END IF
+
+END SUBROUTINE ConvertFFWind_to_Mapped
 !==================================================================================================================================
    SUBROUTINE WrBinHAWC(FileRootName, FFWind, delta, ErrStat, ErrMsg)
    CHARACTER(*),      INTENT(IN) :: FileRootName                     !< Name of the file to write the output in
@@ -1103,7 +1478,7 @@ END SUBROUTINE ConvertFFWind_to_Bladed
 !====================================================================================================
 SUBROUTINE ConvertFFWind_toVTK(FileRootName, p, ErrStat, ErrMsg)
    CHARACTER(*),                             INTENT(IN   )  :: FileRootName      !< RootName for output files
-   TYPE(IfW_FFWind_ParameterType),           INTENT(IN   )  :: p                 !< Parameters
+   TYPE(IfW_FFWind_ParameterType), TARGET,   INTENT(IN   )  :: p                 !< Parameters
 
    INTEGER(IntKi),                           INTENT(  OUT)  :: ErrStat           !< Error status of the operation
    CHARACTER(*),                             INTENT(  OUT)  :: ErrMsg            !< Error message if ErrStat /= ErrID_None
@@ -1116,12 +1491,15 @@ SUBROUTINE ConvertFFWind_toVTK(FileRootName, p, ErrStat, ErrMsg)
    INTEGER                                                  :: i
    INTEGER                                                  :: iy
    INTEGER                                                  :: iz
+   REAL(SiKi), POINTER, CONTIGUOUS                          :: FFData(:,:,:,:)
+   REAL(SiKi), POINTER, CONTIGUOUS                          :: FFTower(:,:,:)
 
    INTEGER(IntKi)                                           :: ErrStat2
    CHARACTER(ErrMsgLen)                                     :: ErrMsg2
    CHARACTER(*), PARAMETER                                  :: RoutineName = 'ConvertFFWind_toVTK'
 
    
+   CALL FFWind_GetData(p, FFData, FFTower)
    CALL GetPath ( FileRootName, RootPathName )
    CALL GetNewUnit( UnWind, ErrStat, ErrMsg )
 
@@ -1155,7 +1533,7 @@ SUBROUTINE ConvertFFWind_toVTK(FileRootName, p, ErrStat, ErrMsg)
          
       DO iz=1,p%NZGrids
          DO iy=1,p%NYGrids
-            WRITE(UnWind,'(3(f10.2,1X))')   p%FFData(iz,iy,:,i)
+            WRITE(UnWind,'(3(f10.2,1X))')   FFData(iz,iy,:,i)
          END DO
       END DO
 
@@ -1165,6 +1543,275 @@ SUBROUTINE ConvertFFWind_toVTK(FileRootName, p, ErrStat, ErrMsg)
    
    
 END SUBROUTINE ConvertFFWind_toVTK
+!====================================================================================================
+!> This routine points FFData and FFTower at the FF and tower data of p, which are either in p%FFData and p%FFTower or in a
+!! memory-mapped file (p%MapID > 0). Pointers are not associated when there are no such data. The mapping is not locked: p
+!! keeps its entry of MappedFiles in use, and the entry does not move (see FFWind_MappedFile).
+SUBROUTINE FFWind_GetData(p, FFData, FFTower)
+   TYPE(IfW_FFWind_ParameterType), TARGET,   INTENT(IN   )  :: p                 !< Parameters
+   REAL(SiKi), POINTER, CONTIGUOUS,          INTENT(  OUT)  :: FFData(:,:,:,:)   !< FF data of p
+   REAL(SiKi), POINTER, CONTIGUOUS,          INTENT(  OUT)  :: FFTower(:,:,:)    !< tower data of p
+
+   IF (p%MapID > 0) THEN
+      FFData  => MappedFiles(p%MapID)%FFData
+      FFTower => MappedFiles(p%MapID)%FFTower
+   ELSE
+      NULLIFY(FFData, FFTower)
+      IF (ALLOCATED(p%FFData))  FFData  => p%FFData
+      IF (ALLOCATED(p%FFTower)) FFTower => p%FFTower
+   END IF
+
+END SUBROUTINE FFWind_GetData
+!====================================================================================================
+!> This function returns .TRUE. if FileName is a memory-mapped full-field file written by ConvertFFWind_to_Mapped.
+FUNCTION FFWind_IsMappedFile(FileName)
+   CHARACTER(*),                             INTENT(IN   )  :: FileName          !< name of the file
+   LOGICAL                                                  :: FFWind_IsMappedFile
+
+   CHARACTER(LEN(MappedFile_ID))                            :: FileID
+   INTEGER(IntKi)                                           :: UnWind
+   INTEGER(IntKi)                                           :: IOS
+   INTEGER(IntKi)                                           :: ErrStat2
+   CHARACTER(ErrMsgLen)                                     :: ErrMsg2
+
+   FFWind_IsMappedFile = .FALSE.
+
+   CALL GetNewUnit( UnWind, ErrStat2, ErrMsg2 )
+   OPEN( UnWind, FILE=TRIM(FileName), STATUS='OLD', FORM='UNFORMATTED', ACCESS='STREAM', ACTION='READ', IOSTAT=IOS )
+   IF (IOS /= 0) RETURN
+
+   READ( UnWind, IOSTAT=IOS ) FileID
+   CLOSE( UnWind )
+
+   FFWind_IsMappedFile = IOS == 0 .AND. FileID == MappedFile_ID
+
+END FUNCTION FFWind_IsMappedFile
+!====================================================================================================
+!> This routine maps a memory-mapped full-field file written by ConvertFFWind_to_Mapped into memory and sets the parameters p
+!! from it. The data are not copied: p%FFData and p%FFTower are not allocated, and the routines of this module get the data
+!! from the mapping through p%MapID (see FFWind_GetData). The mapping is read only and shared by all processes that map the
+!! file; a file that is already mapped in this process is not mapped again. Call FFWind_UnmapFile with p itself (not a copy
+!! of it) when p is no longer used.
+SUBROUTINE FFWind_MapFile(FileName, p, ErrStat, ErrMsg)
+   CHARACTER(*),                             INTENT(IN   )  :: FileName          !< name of the memory-mapped full-field file
+   TYPE(IfW_FFWind_ParameterType), TARGET,   INTENT(INOUT)  :: p                 !< Parameters
+   INTEGER(IntKi),                           INTENT(  OUT)  :: ErrStat           !< Error status of the operation
+   CHARACTER(*),                             INTENT(  OUT)  :: ErrMsg            !< Error message if ErrStat /= ErrID_None
+
+   CALL IfW_LockMappedFiles()
+   CALL MapFileLocked(FileName, p, ErrStat, ErrMsg)
+   CALL IfW_UnlockMappedFiles()
+
+END SUBROUTINE FFWind_MapFile
+!====================================================================================================
+!> This routine is FFWind_MapFile for a caller that holds the lock of MappedFiles.
+SUBROUTINE MapFileLocked(FileName, p, ErrStat, ErrMsg)
+   CHARACTER(*),                             INTENT(IN   )  :: FileName          !< name of the memory-mapped full-field file
+   TYPE(IfW_FFWind_ParameterType), TARGET,   INTENT(INOUT)  :: p                 !< Parameters
+   INTEGER(IntKi),                           INTENT(  OUT)  :: ErrStat           !< Error status of the operation
+   CHARACTER(*),                             INTENT(  OUT)  :: ErrMsg            !< Error message if ErrStat /= ErrID_None
+
+      ! Local variables
+   TYPE(FFWind_MappedHeader), POINTER                       :: Header
+   INTEGER(C_INT8_T), POINTER                               :: Bytes(:)          ! the mapped file
+   TYPE(C_PTR)                                              :: DataPtr           ! start of the FF or tower data in the mapped file
+   INTEGER(C_INTPTR_T), ALLOCATABLE                         :: TmpUsers(:)
+   CHARACTER(LEN(MappedFile_ID))                            :: FileID
+   INTEGER(C_INT64_T)                                       :: DataBytes
+   INTEGER(C_INT64_T)                                       :: TowerBytes
+   INTEGER(IntKi)                                           :: i
+   INTEGER(IntKi)                                           :: iFile
+   INTEGER(C_INT)                                           :: Status
+   CHARACTER(*), PARAMETER                                  :: RoutineName = 'FFWind_MapFile'
+
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+
+      ! use the mapping if this process has already mapped the file; otherwise, use a free entry of MappedFiles
+   iFile = 0
+   DO i = 1, SIZE(MappedFiles)
+      IF (MappedFiles(i)%NumUsers > 0 .AND. MappedFiles(i)%FileName == FileName) THEN
+         iFile = i
+         EXIT
+      ELSE IF (MappedFiles(i)%NumUsers == 0 .AND. iFile == 0) THEN
+         iFile = -i
+      END IF
+   END DO
+
+   IF (iFile <= 0) THEN
+
+      IF (iFile == 0) THEN
+         CALL SetErrStat( ErrID_Fatal, 'Cannot map file "'//TRIM(FileName)//'" into memory: '//TRIM(Num2LStr(MaxMappedFiles))// &
+                          ' full-field wind files are mapped in this process already.', ErrStat, ErrMsg, RoutineName )
+         RETURN
+      END IF
+      iFile = -iFile
+
+      Status = IfW_MapFile( TRIM(FileName)//C_NULL_CHAR, MappedFiles(iFile)%Base, MappedFiles(iFile)%nBytes )
+      IF (Status /= 0) THEN
+         CALL SetErrStat( ErrID_Fatal, 'Cannot map file "'//TRIM(FileName)//'" into memory (error '//TRIM(Num2LStr(Status))//').', &
+                          ErrStat, ErrMsg, RoutineName )
+         RETURN
+      END IF
+      CALL C_F_POINTER( MappedFiles(iFile)%Base, Bytes, (/ MappedFiles(iFile)%nBytes /) )
+      CALL C_F_POINTER( MappedFiles(iFile)%Base, Header )
+
+         ! check that this is a file we can use
+      FileID = ''
+      IF (MappedFiles(iFile)%nBytes >= C_SIZEOF(Header)) THEN
+         DO i = 1, LEN(MappedFile_ID)
+            FileID(i:i) = Header%FileID(i)
+         END DO
+      END IF
+      IF (FileID /= MappedFile_ID) THEN
+         CALL SetErrStat( ErrID_Fatal, '"'//TRIM(FileName)//'" is not a memory-mapped full-field wind file.', ErrStat, ErrMsg, RoutineName )
+      ELSE IF (Header%Version /= MappedFile_Version) THEN
+         CALL SetErrStat( ErrID_Fatal, '"'//TRIM(FileName)//'" is a memory-mapped full-field wind file of version '// &
+                          TRIM(Num2LStr(Header%Version))//'; this version of InflowWind reads version '// &
+                          TRIM(Num2LStr(MappedFile_Version))//'.', ErrStat, ErrMsg, RoutineName )
+      ELSE
+         DataBytes  = 4_C_INT64_T*Header%NZGrids*Header%NYGrids*Header%NFFComp*Header%NDataSlices
+         TowerBytes = 4_C_INT64_T*Header%NFFComp*Header%NTGrids*Header%NTowerSlices
+         IF ( Header%NZGrids < 1 .OR. Header%NYGrids < 1 .OR. Header%NFFComp < 1 .OR. Header%NDataSlices < Header%NFFSteps .OR. &
+              Header%DataOffset < C_SIZEOF(Header) .OR. Header%DataOffset + DataBytes > MappedFiles(iFile)%nBytes .OR. &
+              (TowerBytes > 0 .AND. Header%TowerOffset + TowerBytes > MappedFiles(iFile)%nBytes) ) THEN
+            CALL SetErrStat( ErrID_Fatal, 'The memory-mapped full-field wind file "'//TRIM(FileName)//'" is truncated or corrupt.', &
+                             ErrStat, ErrMsg, RoutineName )
+         END IF
+      END IF
+      IF (ErrStat >= AbortErrLev) THEN
+         CALL IfW_UnmapFile( MappedFiles(iFile)%Base, MappedFiles(iFile)%nBytes )
+         MappedFiles(iFile)%Base = C_NULL_PTR
+         RETURN
+      END IF
+
+      DataPtr = C_LOC(Bytes(Header%DataOffset+1))
+      CALL C_F_POINTER( DataPtr, MappedFiles(iFile)%FFData, (/ Header%NZGrids, Header%NYGrids, Header%NFFComp, Header%NDataSlices /) )
+      IF (Header%NTGrids > 0) THEN
+         DataPtr = C_LOC(Bytes(Header%TowerOffset+1))
+         CALL C_F_POINTER( DataPtr, MappedFiles(iFile)%FFTower, (/ Header%NFFComp, Header%NTGrids, Header%NTowerSlices /) )
+      ELSE
+         NULLIFY( MappedFiles(iFile)%FFTower )
+      END IF
+      MappedFiles(iFile)%FileName = FileName
+
+   ELSE
+      CALL C_F_POINTER( MappedFiles(iFile)%Base, Header )
+   END IF
+
+   IF (.NOT. ALLOCATED(MappedFiles(iFile)%Users)) ALLOCATE(MappedFiles(iFile)%Users(4))
+   IF (MappedFiles(iFile)%NumUsers == SIZE(MappedFiles(iFile)%Users)) THEN
+      ALLOCATE(TmpUsers(2*SIZE(MappedFiles(iFile)%Users)))
+      TmpUsers(1:MappedFiles(iFile)%NumUsers) = MappedFiles(iFile)%Users
+      CALL MOVE_ALLOC(TmpUsers, MappedFiles(iFile)%Users)
+   END IF
+   MappedFiles(iFile)%NumUsers = MappedFiles(iFile)%NumUsers + 1
+   MappedFiles(iFile)%Users(MappedFiles(iFile)%NumUsers) = TRANSFER(C_LOC(p%MapID), 0_C_INTPTR_T)
+
+   p%MapID              = iFile
+   p%MappedFileName     = FileName
+   p%NZGrids            = Header%NZGrids
+   p%NYGrids            = Header%NYGrids
+   p%NFFComp            = Header%NFFComp
+   p%NFFSteps           = Header%NFFSteps
+   p%NTGrids            = Header%NTGrids
+   p%WindFileFormat     = Header%WindFileFormat
+   p%WindProfileType    = Header%WindProfileType
+   p%Periodic           = Header%Periodic /= 0
+   p%InterpTower        = Header%InterpTower /= 0
+   p%AddMeanAfterInterp = Header%AddMeanAfterInterp /= 0
+   p%FFDTime            = Header%FFDTime
+   p%FFRate             = Header%FFRate
+   p%FFYHWid            = Header%FFYHWid
+   p%FFZHWid            = Header%FFZHWid
+   p%RefHt              = Header%RefHt
+   p%GridBase           = Header%GridBase
+   p%InitXPosition      = Header%InitXPosition
+   p%InvFFYD            = Header%InvFFYD
+   p%InvFFZD            = Header%InvFFZD
+   p%InvMFFWS           = Header%InvMFFWS
+   p%MeanFFWS           = Header%MeanFFWS
+   p%TotalTime          = Header%TotalTime
+   p%PLExp              = Header%PLExp
+   p%Z0                 = Header%Z0
+
+END SUBROUTINE MapFileLocked
+!====================================================================================================
+!> This routine maps the memory-mapped full-field file of p again after p has been restored from a checkpoint file, where
+!! p%MapID refers to the mappings of the process that wrote the checkpoint. If p used a mapping before it was restored (e.g.,
+!! a warm start into the parameters of a running instance), that use is released first.
+SUBROUTINE FFWind_RestoreMapping(p, ErrStat, ErrMsg)
+   TYPE(IfW_FFWind_ParameterType), TARGET,   INTENT(INOUT)  :: p                 !< Parameters
+   INTEGER(IntKi),                           INTENT(  OUT)  :: ErrStat           !< Error status of the operation
+   CHARACTER(*),                             INTENT(  OUT)  :: ErrMsg            !< Error message if ErrStat /= ErrID_None
+
+   INTEGER(IntKi)                                           :: iFile
+
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+
+   CALL IfW_LockMappedFiles()
+
+      ! the restored p%MapID does not tell which entry p used, so look for p in all of them
+   DO iFile = 1, MaxMappedFiles
+      CALL ReleaseUserLocked(iFile, TRANSFER(C_LOC(p%MapID), 0_C_INTPTR_T))
+   END DO
+
+   IF (p%MapID > 0) THEN
+      p%MapID = 0
+      CALL MapFileLocked(p%MappedFileName, p, ErrStat, ErrMsg)
+   END IF
+
+   CALL IfW_UnlockMappedFiles()
+
+END SUBROUTINE FFWind_RestoreMapping
+!====================================================================================================
+!> This routine releases the memory-mapped full-field file of p (if any); the file is unmapped when no parameters use it. A copy
+!! of the parameters that mapped the file only forgets the mapping (see FFWind_MappedFile).
+SUBROUTINE FFWind_UnmapFile(p)
+   TYPE(IfW_FFWind_ParameterType), TARGET,   INTENT(INOUT)  :: p                 !< Parameters
+
+   INTEGER(IntKi)                                           :: iFile
+
+   iFile   = p%MapID
+   p%MapID = 0
+   IF (iFile < 1 .OR. iFile > MaxMappedFiles) RETURN
+
+   CALL IfW_LockMappedFiles()
+   CALL ReleaseUserLocked(iFile, TRANSFER(C_LOC(p%MapID), 0_C_INTPTR_T))
+   CALL IfW_UnlockMappedFiles()
+
+END SUBROUTINE FFWind_UnmapFile
+!====================================================================================================
+!> This routine removes User from the users of entry iFile of MappedFiles (if it is one of them) and unmaps the file when it
+!! has no users left. The caller holds the lock of MappedFiles.
+SUBROUTINE ReleaseUserLocked(iFile, User)
+   INTEGER(IntKi),                           INTENT(IN   )  :: iFile             !< entry of MappedFiles
+   INTEGER(C_INTPTR_T),                      INTENT(IN   )  :: User              !< address of the parameters that use the file
+
+   INTEGER(IntKi)                                           :: iUser
+   INTEGER(IntKi)                                           :: i
+
+   iUser = 0
+   DO i = 1, MappedFiles(iFile)%NumUsers
+      IF (MappedFiles(iFile)%Users(i) == User) THEN
+         iUser = i
+         EXIT
+      END IF
+   END DO
+   IF (iUser == 0) RETURN
+
+   MappedFiles(iFile)%Users(iUser) = MappedFiles(iFile)%Users(MappedFiles(iFile)%NumUsers)
+   MappedFiles(iFile)%NumUsers = MappedFiles(iFile)%NumUsers - 1
+   IF (MappedFiles(iFile)%NumUsers == 0) THEN
+      NULLIFY( MappedFiles(iFile)%FFData, MappedFiles(iFile)%FFTower )
+      CALL IfW_UnmapFile( MappedFiles(iFile)%Base, MappedFiles(iFile)%nBytes )
+      MappedFiles(iFile)%Base     = C_NULL_PTR
+      MappedFiles(iFile)%nBytes   = 0
+      MappedFiles(iFile)%FileName = ''
+   END IF
+
+END SUBROUTINE ReleaseUserLocked
 
    
 !====================================================================================================
@@ -74,6 +74,8 @@ IMPLICIT NONE
     INTEGER(IntKi)  :: WindProfileType = -1      !< Wind profile type (0=constant;1=logarithmic;2=power law) [-]
     REAL(ReKi)  :: PLExp = 0      !< Power law exponent (used for PL wind profile type only) [-]
     REAL(ReKi)  :: Z0 = 0      !< Surface roughness length (used for LOG wind profile type only) [-]
+    INTEGER(IntKi)  :: MapID = 0      !< Index of the memory-mapped file that holds the FF and tower data (0 = data are in FFData and FFTower) [-]
+    CHARACTER(1024)  :: MappedFileName      !< Name of the memory-mapped file that holds the FF and tower data (when MapID > 0) [-]
   END TYPE IfW_FFWind_ParameterType
 ! =======================
 CONTAINS
@@ -358,6 +360,8 @@ ENDIF
     DstParamData%WindProfileType = SrcParamData%WindProfileType
     DstParamData%PLExp = SrcParamData%PLExp
     DstParamData%Z0 = SrcParamData%Z0
+    DstParamData%MapID = SrcParamData%MapID
+    DstParamData%MappedFileName = SrcParamData%MappedFileName
  END SUBROUTINE IfW_FFWind_CopyParam
 
  SUBROUTINE IfW_FFWind_DestroyParam( ParamData, ErrStat, ErrMsg, DEALLOCATEpointers )
@@ -458,6 +462,8 @@ ENDIF
       Int_BufSz  = Int_BufSz  + 1  ! WindProfileType
       Re_BufSz   = Re_BufSz   + 1  ! PLExp
       Re_BufSz   = Re_BufSz   + 1  ! Z0
+      Int_BufSz  = Int_BufSz  + 1  ! MapID
+      Int_BufSz  = Int_BufSz  + 1*LEN(InData%MappedFileName)  ! MappedFileName
   IF ( Re_BufSz  .GT. 0 ) THEN 
      ALLOCATE( ReKiBuf(  Re_BufSz  ), STAT=ErrStat2 )
      IF (ErrStat2 /= 0) THEN 
@@ -588,6 +594,12 @@ ENDIF
     Re_Xferred = Re_Xferred + 1
     ReKiBuf(Re_Xferred) = InData%Z0
     Re_Xferred = Re_Xferred + 1
+    IntKiBuf(Int_Xferred) = InData%MapID
+    Int_Xferred = Int_Xferred + 1
+    DO I = 1, LEN(InData%MappedFileName)
+      IntKiBuf(Int_Xferred) = ICHAR(InData%MappedFileName(I:I), IntKi)
+      Int_Xferred = Int_Xferred + 1
+    END DO ! I
  END SUBROUTINE IfW_FFWind_PackParam
 
  SUBROUTINE IfW_FFWind_UnPackParam( ReKiBuf, DbKiBuf, IntKiBuf, Outdata, ErrStat, ErrMsg )
@@ -729,6 +741,12 @@ ENDIF
     Re_Xferred = Re_Xferred + 1
     OutData%Z0 = ReKiBuf(Re_Xferred)
     Re_Xferred = Re_Xferred + 1
+    OutData%MapID = IntKiBuf(Int_Xferred)
+    Int_Xferred = Int_Xferred + 1
+    DO I = 1, LEN(OutData%MappedFileName)
+      OutData%MappedFileName(I:I) = CHAR(IntKiBuf(Int_Xferred))
+      Int_Xferred = Int_Xferred + 1
+    END DO ! I
  END SUBROUTINE IfW_FFWind_UnPackParam
 
 END MODULE IfW_FFWind_Base_Types
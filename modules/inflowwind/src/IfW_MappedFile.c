@@ -0,0 +1,125 @@
+/*
+ * Copyright 2026 National Renewable Energy Laboratory
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Read-only memory mapping of the full-field wind files written by ConvertFFWind_to_Mapped (IfW_FFWind_Base.f90).
+ * The pages are shared through the page cache by all processes that map the same file.
+ */
+
+#include <stdint.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/* Maps the file FileName (a NULL-terminated string). Returns 0 and sets *Base and *nBytes on success; returns the error code
+ * of the operating system otherwise. */
+int IfW_MapFile(const char *FileName, void **Base, int64_t *nBytes)
+{
+    *Base = NULL;
+    *nBytes = 0;
+
+#ifdef _WIN32
+    HANDLE file, mapping;
+    LARGE_INTEGER size;
+    void *view;
+    int error;
+
+    file = CreateFileA(FileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return (int)GetLastError();
+
+    if (!GetFileSizeEx(file, &size)) {
+        error = (int)GetLastError();
+        CloseHandle(file);
+        return error;
+    }
+
+    mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL) {
+        error = (int)GetLastError();
+        CloseHandle(file);
+        return error;
+    }
+
+    view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    error = (view == NULL) ? (int)GetLastError() : 0;
+
+    /* the view keeps the mapping open */
+    CloseHandle(mapping);
+    CloseHandle(file);
+    if (error != 0) return error;
+
+    *Base = view;
+    *nBytes = (int64_t)size.QuadPart;
+#else
+    struct stat info;
+    void *view;
+    int fd, error;
+
+    fd = open(FileName, O_RDONLY);
+    if (fd < 0) return errno;
+
+    if (fstat(fd, &info) != 0) {
+        error = errno;
+        close(fd);
+        return error;
+    }
+
+    view = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    error = (view == MAP_FAILED) ? errno : 0;
+
+    /* the mapping stays valid after the file is closed */
+    close(fd);
+    if (error != 0) return error;
+
+    *Base = view;
+    *nBytes = (int64_t)info.st_size;
+#endif
+
+    return 0;
+}
+
+/* Unmaps a file mapped by IfW_MapFile */
+void IfW_UnmapFile(void *Base, int64_t *nBytes)
+{
+    if (Base == NULL) return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(Base);
+#else
+    munmap(Base, (size_t)*nBytes);
+#endif
+}
+
+/* The lock of the table of mapped files in IfW_FFWind_Base.f90, which instances on several threads may change at once */
+#ifdef _WIN32
+static SRWLOCK MappedFilesLock = SRWLOCK_INIT;
+
+void IfW_LockMappedFiles(void) { AcquireSRWLockExclusive(&MappedFilesLock); }
+void IfW_UnlockMappedFiles(void) { ReleaseSRWLockExclusive(&MappedFilesLock); }
+#else
+static pthread_mutex_t MappedFilesLock = PTHREAD_MUTEX_INITIALIZER;
+
+void IfW_LockMappedFiles(void) { pthread_mutex_lock(&MappedFilesLock); }
+void IfW_UnlockMappedFiles(void) { pthread_mutex_unlock(&MappedFilesLock); }
+#endif
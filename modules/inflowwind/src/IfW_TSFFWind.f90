@@ -96,6 +96,37 @@ SUBROUTINE IfW_TSFFWind_Init(InitData, ParamData, MiscVars, InitOutData, ErrStat
    ParamData%FF%AddMeanAfterInterp = .false.
 
 
+      !----------------------------------------------------------------------------------------------
+      ! A memory-mapped full-field file (written by ConvertFFWind_to_Mapped from any of the full-field
+      ! wind types) holds all of the parameters and data, so map it instead of reading it.
+      !----------------------------------------------------------------------------------------------
+
+   IF ( FFWind_IsMappedFile( InitData%WindFileName ) ) THEN
+
+      CALL FFWind_MapFile( InitData%WindFileName, ParamData%FF, TmpErrStat, TmpErrMsg )
+      CALL SetErrStat(TmpErrStat,TmpErrMsg,ErrStat,ErrMsg,RoutineName)
+      IF ( ErrStat >= AbortErrLev ) RETURN
+
+      IF ( InitData%SumFileUnit > 0 ) THEN
+         WRITE(InitData%SumFileUnit,'(A)',        IOSTAT=TmpErrStat)
+         WRITE(InitData%SumFileUnit,'(A)',        IOSTAT=TmpErrStat)    'Memory-mapped full-field wind file.  Mapped by InflowWind sub-module '// &
+                                                                                    TRIM(IfW_TSFFWind_Ver%Name)//' '//TRIM(IfW_TSFFWind_Ver%Ver)
+         WRITE(InitData%SumFileUnit,'(A)',        IOSTAT=TmpErrStat)    '     FileName:                    '//TRIM(InitData%WindFileName)
+         WRITE(InitData%SumFileUnit,'(A34,I3)',   IOSTAT=TmpErrStat)    '     Binary file format id:       ',ParamData%FF%WindFileFormat
+         WRITE(InitData%SumFileUnit,'(A34,G12.4)',IOSTAT=TmpErrStat)    '     Reference height (m):        ',ParamData%FF%RefHt
+         WRITE(InitData%SumFileUnit,'(A34,G12.4)',IOSTAT=TmpErrStat)    '     Timestep (s):                ',ParamData%FF%FFDTime
+         WRITE(InitData%SumFileUnit,'(A34,I12)',  IOSTAT=TmpErrStat)    '     Number of timesteps:         ',ParamData%FF%NFFSteps
+         WRITE(InitData%SumFileUnit,'(A34,G12.4)',IOSTAT=TmpErrStat)    '     Mean windspeed (m/s):        ',ParamData%FF%MeanFFWS
+         WRITE(InitData%SumFileUnit,'(A34,L1)',   IOSTAT=TmpErrStat)    '     Windfile is periodic:        ',ParamData%FF%Periodic
+         WRITE(InitData%SumFileUnit,'(A34,L1)',   IOSTAT=TmpErrStat)    '     Windfile includes tower:     ',ParamData%FF%NTGrids > 0
+      END IF
+
+      InitOutdata%Ver         = IfW_TSFFWind_Ver
+      RETURN
+
+   END IF
+
+
       ! Get a unit number to use
 
    CALL GetNewUnit(UnitWind, TmpErrStat, TmpErrMsg)
@@ -640,8 +671,9 @@ SUBROUTINE IfW_TSFFWind_End( p, m, ErrStat, ErrMsg)
 
 
 
-      ! Destroy parameter data
+      ! Destroy parameter data (releasing the memory-mapped file first, if there is one)
 
+   CALL FFWind_UnmapFile( p%FF )
    CALL IfW_TSFFWind_DestroyParam( p, TmpErrStat, TmpErrMsg )
    CALL SetErrStat( TmpErrStat, TmpErrMsg, ErrStat, ErrMsg, RoutineName)
 
@@ -64,6 +64,8 @@ MODULE InflowWind
    PUBLIC :: InflowWind_Convert2HAWC               !< An extension of the FAST framework, this routine converts an InflowWind data structure to HAWC format wind files
    PUBLIC :: InflowWind_Convert2Bladed             !< An extension of the FAST framework, this routine converts an InflowWind data structure to Bladed format wind files (with shear already included)
    PUBLIC :: InflowWind_Convert2VTK                !< An extension of the FAST framework, this routine converts an InflowWind data structure to VTK format wind files
+   PUBLIC :: InflowWind_Convert2Mapped             !< An extension of the FAST framework, this routine converts an InflowWind data structure to a memory-mapped full-field file
+   PUBLIC :: InflowWind_RestoreMapping             !< Maps the memory-mapped full-field wind file again after restoring from a checkpoint
 
 
       ! These routines satisfy the framework, but do nothing at present.
@@ -1694,6 +1696,95 @@ SUBROUTINE InflowWind_Convert2Bladed( FileRootName, p, m, ErrStat, ErrMsg )
    
 END SUBROUTINE InflowWind_Convert2Bladed
 
+!====================================================================================================
+!> This routine writes the full-field wind data of p to a memory-mapped full-field file, FileRootName.ffm. Simulations that
+!! read this file with WindType = 3 map it into memory instead of reading and processing the original wind file, so all
+!! processes on a machine share one copy of the data (see ConvertFFWind_to_Mapped).
+SUBROUTINE InflowWind_Convert2Mapped( FileRootName, p, m, ErrStat, ErrMsg )
+
+   USE IfW_FFWind_Base
+   IMPLICIT NONE
+
+   CHARACTER(*),              PARAMETER                     :: RoutineName="InflowWind_Convert2Mapped"
+
+      ! Subroutine arguments
+
+   TYPE(InflowWind_ParameterType),           INTENT(IN   )  :: p                 !< Parameters
+   TYPE(InflowWind_MiscVarType),             INTENT(INOUT)  :: m                 !< Misc/optimization variables
+   CHARACTER(*),                             INTENT(IN   )  :: FileRootName      !< RootName for output files
+
+   INTEGER(IntKi),                           INTENT(  OUT)  :: ErrStat           !< Error status of the operation
+   CHARACTER(*),                             INTENT(  OUT)  :: ErrMsg            !< Error message if ErrStat /= ErrID_None
+   
+      ! Local variables
+   TYPE(IfW_FFWind_ParameterType)                           :: p_ff              !< FF Parameters
+   INTEGER(IntKi)                                           :: ErrStat2
+   CHARACTER(ErrMsgLen)                                     :: ErrMsg2
+
+   ErrStat = ErrID_None
+   ErrMsg = ""
+
+   SELECT CASE ( p%WindType )
+         
+   CASE (Steady_WindNumber, Uniform_WindNumber)
+
+      CALL Uniform_to_FF(p%UniformWind, m%UniformWind, p_ff, ErrStat2, ErrMsg2)
+         CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
+            
+      IF (ErrStat < AbortErrLev) THEN
+         CALL ConvertFFWind_to_Mapped(FileRootName, p_ff, ErrStat2, ErrMsg2)
+         CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
+      END IF
+            
+      CALL IfW_FFWind_DestroyParam(p_ff,ErrStat2,ErrMsg2)
+
+   CASE (TSFF_WindNumber)
+
+      CALL ConvertFFWind_to_Mapped(FileRootName, p%TSFFWind%FF, ErrStat, ErrMsg)
+
+   CASE (BladedFF_WindNumber)
+
+      CALL ConvertFFWind_to_Mapped(FileRootName, p%BladedFFWind%FF, ErrStat, ErrMsg)
+
+   CASE ( HAWC_WindNumber )
+
+      CALL ConvertFFWind_to_Mapped(FileRootName, p%HAWCWind%FF, ErrStat, ErrMsg)
+
+   CASE DEFAULT ! User_WindNumber
+
+      ErrStat = ErrID_Warn
+      ErrMsg  = 'Wind type '//TRIM(Num2LStr(p%WindType))//' cannot be converted to a memory-mapped full-field file.'
+
+   END SELECT
+   
+END SUBROUTINE InflowWind_Convert2Mapped
+
+!====================================================================================================
+!> This routine maps the memory-mapped full-field wind file of p (if any) again after p has been restored from a checkpoint file.
+SUBROUTINE InflowWind_RestoreMapping( p, ErrStat, ErrMsg )
+
+   USE IfW_FFWind_Base
+   IMPLICIT NONE
+
+   CHARACTER(*),              PARAMETER                     :: RoutineName="InflowWind_RestoreMapping"
+
+   TYPE(InflowWind_ParameterType),           INTENT(INOUT)  :: p                 !< Parameters
+   INTEGER(IntKi),                           INTENT(  OUT)  :: ErrStat           !< Error status of the operation
+   CHARACTER(*),                             INTENT(  OUT)  :: ErrMsg            !< Error message if ErrStat /= ErrID_None
+
+   INTEGER(IntKi)                                           :: ErrStat2
+   CHARACTER(ErrMsgLen)                                     :: ErrMsg2
+
+   ErrStat = ErrID_None
+   ErrMsg = ""
+
+   IF ( p%WindType == TSFF_WindNumber ) THEN
+      CALL FFWind_RestoreMapping(p%TSFFWind%FF, ErrStat2, ErrMsg2)
+         CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
+   END IF
+
+END SUBROUTINE InflowWind_RestoreMapping
+
 !====================================================================================================
 SUBROUTINE InflowWind_Convert2VTK( FileRootName, p, m, ErrStat, ErrMsg )
 
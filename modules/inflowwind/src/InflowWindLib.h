@@ -0,0 +1,169 @@
+#ifndef InflowWindLib_h
+#define InflowWindLib_h
+
+#include "IfW_C_Binding.h"
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// InflowWindLib is a header-only C++ interface to the ifw_c_binding library. The library keeps a single InflowWind instance,
+// so only one InflowWindLib may exist at a time.
+//
+// calc_velocities takes the points as separate x, y and z arrays and returns separate u, v and w arrays. It goes through
+// IfW_C_CalcVelocities, which takes any number of points per call and interpolates full-field wind with a vectorized kernel.
+// calc_output is the original interface with interleaved single precision arrays of num_wind_points points, which also
+// returns the output channels.
+class InflowWindLib {
+
+    private:
+        int num_wind_points;
+        bool ended;
+        std::vector<std::string> channel_names;
+        std::vector<std::string> channel_units;
+
+        static std::string join_lines(const std::vector<std::string> & lines) {
+            // The lines are separated by NULL characters
+            std::string joined;
+            for (size_t i = 0; i < lines.size(); i++) {
+                if (i > 0) joined.push_back('\0');
+                joined += lines[i];
+            }
+            return joined;
+        }
+
+        static std::vector<std::string> split_channels(const char *buffer, int num_channels) {
+            std::vector<std::string> names;
+            for (int i = 0; i < num_channels; i++) {
+                std::string name(buffer + i * IFW_CHANNEL_LENGTH, IFW_CHANNEL_LENGTH);
+                name.erase(name.find_last_not_of(' ') + 1);
+                names.push_back(name);
+            }
+            return names;
+        }
+
+        static void check_error(int error_status, const char *error_message) {
+            if (error_status >= IFW_ERRID_FATAL) {
+                throw std::runtime_error( "InflowWindLib: Error " + std::to_string(error_status) + ": " + error_message );
+            }
+        }
+
+    public:
+
+        // input_file_lines are the lines of the InflowWind input file. uniform_file_lines are the lines of the uniform wind file
+        // for WindType = 2, or empty to read it from the file named in the input file. num_wind_points is the number of points
+        // of calc_output (calc_velocities takes any number of points).
+        InflowWindLib(const std::vector<std::string> & input_file_lines, const std::vector<std::string> & uniform_file_lines,
+                      int num_wind_points, double dt):
+            num_wind_points(num_wind_points),
+            ended(false)
+        {
+            std::string input_string = join_lines(input_file_lines);
+            std::string uniform_string = join_lines(uniform_file_lines);
+            const char *input_ptr = input_string.c_str();
+            const char *uniform_ptr = uniform_string.c_str();
+            int input_length = input_string.size();
+            int uniform_length = uniform_string.size();
+            int num_channels = 0;
+            std::vector<char> names(IFW_CHANNEL_LENGTH * IFW_MAXIMUM_OUTPUTS + 1);
+            std::vector<char> units(IFW_CHANNEL_LENGTH * IFW_MAXIMUM_OUTPUTS + 1);
+            int error_status = 0;
+            char error_message[IFW_ERRMSG_LENGTH];
+
+            IfW_C_Init(
+                &input_ptr,
+                &input_length,
+                &uniform_ptr,
+                &uniform_length,
+                &this->num_wind_points,
+                &dt,
+                &num_channels,
+                names.data(),
+                units.data(),
+                &error_status,
+                error_message
+            );
+            check_error(error_status, error_message);
+
+            channel_names = split_channels(names.data(), num_channels);
+            channel_units = split_channels(units.data(), num_channels);
+            output_channel_values.resize(num_channels);
+        }
+
+        ~InflowWindLib() {
+            if (!ended) {
+                int error_status = 0;
+                char error_message[IFW_ERRMSG_LENGTH];
+                IfW_C_End(&error_status, error_message);
+            }
+        }
+
+        InflowWindLib(const InflowWindLib &) = delete;
+        InflowWindLib & operator=(const InflowWindLib &) = delete;
+
+        // Reads the lines of a text file, e.g. for the constructor
+        static std::vector<std::string> read_lines(const std::string & file_name) {
+            std::ifstream file(file_name.c_str());
+            if (!file) {
+                throw std::runtime_error( "InflowWindLib: could not open " + file_name );
+            }
+            std::vector<std::string> lines;
+            std::string line;
+            while (std::getline(file, line)) {
+                lines.push_back(line);
+            }
+            return lines;
+        }
+
+        // Velocities (u, v, w) at time at the n points (x, y, z)
+        void calc_velocities(double time, int n, const double *x, const double *y, const double *z, double *u, double *v, double *w) {
+            int error_status = 0;
+            char error_message[IFW_ERRMSG_LENGTH];
+
+            IfW_C_CalcVelocities(&time, &n, x, y, z, u, v, w, &error_status, error_message);
+            check_error(error_status, error_message);
+        }
+
+        void calc_velocities(double time, const std::vector<double> & x, const std::vector<double> & y, const std::vector<double> & z,
+                             std::vector<double> & u, std::vector<double> & v, std::vector<double> & w) {
+            if (y.size() != x.size() || z.size() != x.size()) {
+                throw std::invalid_argument( "InflowWindLib: x, y and z must have the same size" );
+            }
+            u.resize(x.size());
+            v.resize(x.size());
+            w.resize(x.size());
+            calc_velocities(time, x.size(), x.data(), y.data(), z.data(), u.data(), v.data(), w.data());
+        }
+
+        // Velocities (u, v, w of each point) at time at the num_wind_points positions (x, y, z of each point); the values of the
+        // output channels are put in output_channel_values
+        void calc_output(double time, std::vector<float> & positions, std::vector<float> & velocities) {
+            int error_status = 0;
+            char error_message[IFW_ERRMSG_LENGTH];
+
+            if (positions.size() != 3 * (size_t) num_wind_points) {
+                throw std::invalid_argument( "InflowWindLib: positions must have 3*num_wind_points values" );
+            }
+            velocities.resize(positions.size());
+            IfW_C_CalcOutput(&time, positions.data(), velocities.data(), output_channel_values.data(), &error_status, error_message);
+            check_error(error_status, error_message);
+        }
+
+        void end() {
+            int error_status = 0;
+            char error_message[IFW_ERRMSG_LENGTH];
+
+            if (!ended) {
+                ended = true;
+                IfW_C_End(&error_status, error_message);
+                check_error(error_status, error_message);
+            }
+        }
+
+        const std::vector<std::string> & output_channel_names() const { return channel_names; }
+        const std::vector<std::string> & output_channel_units() const { return channel_units; }
+
+        std::vector<float> output_channel_values;
+};
+
+#endif
@@ -170,6 +170,7 @@ PROGRAM InflowWind_Driver
    CLSettingsFlags%WrHAWC              =  .FALSE.        ! don't convert to HAWC format
    CLSettingsFlags%WrBladed            =  .FALSE.        ! don't convert to Bladed format
    CLSettingsFlags%WrVTK               =  .FALSE.        ! don't convert to VTK format
+   CLSettingsFlags%WrMapped            =  .FALSE.        ! don't convert to a memory-mapped full-field file
 
       ! Initialize the driver settings to their default values (same as the CL -- command line -- values)
    Settings       =  CLSettings
@@ -278,6 +279,7 @@ PROGRAM InflowWind_Driver
       SettingsFlags%WrHAWC = .FALSE.
       SettingsFlags%WrBladed = .FALSE.
       SettingsFlags%WrVTK = .FALSE.
+      SettingsFlags%WrMapped = .FALSE.
 
          ! VVerbose error reporting
       IF ( IfWDriver_Verbose >= 10_IntKi ) CALL WrScr('No driver input file used. Updating driver settings with command line arguments')
@@ -536,6 +538,24 @@ PROGRAM InflowWind_Driver
          IF ( IfWDriver_Verbose >= 5_IntKi ) CALL WrScr(NewLine//'InflowWind_Convert2VTK CALL returned without errors.'//NewLine)
       END IF
    
+   END IF
+
+      ! Convert InflowWind file to a memory-mapped full-field file
+   IF (SettingsFlags%WrMapped) THEN
+      CALL InflowWind_Convert2Mapped( InflowWind_InitInp%RootName, InflowWind_p, InflowWind_MiscVars, ErrStat, ErrMsg )
+      
+      IF (ErrStat > ErrID_None) THEN
+         CALL WrScr( TRIM(ErrMsg) )
+         IF ( ErrStat >= AbortErrLev ) THEN
+            CALL DriverCleanup()
+            CALL ProgAbort( ErrMsg )
+         ELSEIF ( IfWDriver_Verbose >= 7_IntKi ) THEN
+            CALL WrScr(NewLine//' InflowWind_Convert2Mapped returned: ErrStat: '//TRIM(Num2LStr(ErrStat)))
+         END IF
+      ELSE
+         IF ( IfWDriver_Verbose >= 5_IntKi ) CALL WrScr(NewLine//'InflowWind_Convert2Mapped CALL returned without errors.'//NewLine)
+      END IF
+   
    END IF
    
 
@@ -77,6 +77,7 @@ SUBROUTINE DispHelpText( ErrStat, ErrMsg )
    CALL WrScr("                  "//SwChar//"HAWC          -- convert contents of <filename> to HAWC format ")
    CALL WrScr("                  "//SwChar//"Bladed        -- convert contents of <filename> to Bladed format ")
    CALL WrScr("                  "//SwChar//"vtk           -- convert contents of <filename> to vtk format ")
+   CALL WrScr("                  "//SwChar//"mapped        -- convert contents of <filename> to a memory-mapped full-field file (.ffm)")
    CALL WrScr("                  "//SwChar//"help          -- print this help menu and exit")
    CALL WrScr("")
    CALL WrScr("   Notes:")
@@ -324,6 +325,9 @@ SUBROUTINE RetrieveArgs( CLSettings, CLFlags, ErrStat, ErrMsg )
          ELSEIF   ( TRIM(ThisArgUC) == "VTK"   )   THEN
             CLFlags%WrVTK        = .TRUE.
             RETURN
+         ELSEIF   ( TRIM(ThisArgUC) == "MAPPED"   )   THEN
+            CLFlags%WrMapped     = .TRUE.
+            RETURN
          ELSE
             CALL SetErrStat( ErrID_Warn," Unrecognized option '"//SwChar//TRIM(ThisArg)//"'. Ignoring. Use option "//SwChar//"help for list of options.",  &
                ErrStat,ErrMsg,'ParseArg')
@@ -1332,6 +1336,7 @@ SUBROUTINE UpdateSettingsWithCL( DvrFlags, DvrSettings, CLFlags, CLSettings, DVR
    DvrFlags%WrHAWC   = DvrFlags%WrHAWC   .or. CLFlags%WrHAWC      ! create file if specified in either place
    DvrFlags%WrBladed = DvrFlags%WrBladed .or. CLFlags%WrBladed    ! create file if specified in either place
    DvrFlags%WrVTK    = DvrFlags%WrVTK .or. CLFlags%WrVTK          ! create file if specified in either place
+   DvrFlags%WrMapped = DvrFlags%WrMapped .or. CLFlags%WrMapped    ! create file if specified on the command line
 
 !      ! Due to the complexity, we are handling overwriting driver input file settings with
 !      ! command line settings and the instance where no driver input file is read separately.
@@ -64,15 +64,12 @@ MAP_ERROR_CODE free_outlist(Domain* domain, char* map_msg, MAP_ERROR_CODE* ierr)
 };
 
 
-MAP_ERROR_CODE free_cable_library(list_t* restrict library)
+MAP_ERROR_CODE free_cable_library(CableLibrary* restrict library, const int size)
 {
-  CableLibrary* iter_library = NULL;
-  list_iterator_start(library);          /* starting an iteration "session" */
-  while (list_iterator_hasnext(library)) { /* tell whether more values available */
-    iter_library = (CableLibrary*)list_iterator_next(library);
-    bdestroy(iter_library->label);
+  int i = 0;
+  for (i=0 ; i<size ; i++) {
+    bdestroy(library[i].label);
   };
-  list_iterator_stop(library);
   return MAP_SAFE;
 };
 
@@ -93,12 +90,12 @@ MAP_ERROR_CODE free_update_list (list_t* restrict ref_list)
 };
 
 
-MAP_ERROR_CODE free_line(list_t* restrict line) 
+MAP_ERROR_CODE free_line(Line* restrict line, const int size) 
 {
   Line* line_iter = NULL;
-  list_iterator_start(line); /* starting an iteration "session" */
-  while (list_iterator_hasnext(line)) { /* tell whether more values available */
-    line_iter = (Line*)list_iterator_next(line);
+  int i = 0;
+  for (i=0 ; i<size ; i++) {
+    line_iter = &line[i];
     // @rm  bdestroy(line_iter->psi.name); 
     // @rm  bdestroy(line_iter->psi.units);
     // @rm  bdestroy(line_iter->alpha.name);
@@ -145,18 +142,17 @@ MAP_ERROR_CODE free_line(list_t* restrict line)
     line_iter->anchor = NULL; 
     line_iter->fairlead = NULL;
   };
-  list_iterator_stop(line); /* ending the iteration "session" */  
   return MAP_SAFE;
 };
 
 
-MAP_ERROR_CODE free_node(list_t *restrict node)
+MAP_ERROR_CODE free_node(Node* restrict node, const int size)
 {
   Node* iterNode = NULL;
   MAP_ERROR_CODE success = MAP_SAFE;
-  list_iterator_start(node);            /* starting an iteration "session" */
-  while (list_iterator_hasnext(node)) { /* tell whether more values available */ 
-    iterNode = (Node*)list_iterator_next(node);
+  int i = 0;
+  for (i=0 ; i<size ; i++) {
+    iterNode = &node[i];
 
     success = bdestroy(iterNode->M_applied.name); 
     success = bdestroy(iterNode->M_applied.units);
@@ -184,7 +180,6 @@ MAP_ERROR_CODE free_node(list_t *restrict node)
     success = bdestroy(iterNode->sum_force_ptr.fz.name); 
     success = bdestroy(iterNode->sum_force_ptr.fz.units);
   };
-  list_iterator_stop(node); /* ending the iteration "session" */  
   return MAP_SAFE;
 };
 
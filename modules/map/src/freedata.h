@@ -47,9 +47,10 @@ MAP_ERROR_CODE free_update_list (list_t* restrict ref_list);
 /**
  * @brief   Deallocate the 'label' parameter in the CableLibrary
  * @details Accessed in {@link map_end()}
- * @param   library, library link list
+ * @param   library, library array
+ * @param   size, number of entries in library
  */
-MAP_ERROR_CODE free_cable_library(list_t* restrict library);
+MAP_ERROR_CODE free_cable_library(CableLibrary* restrict library, const int size);
 
 
 /**
@@ -64,23 +65,25 @@ MAP_ERROR_CODE free_outlist(Domain* domain, char* map_msg, MAP_ERROR_CODE* ierr)
 
 
 /**
- * @brief     Deallocates all lines. Function loops through the elemenet link list and frees allocated data. Pointers
- *            are nullified.  
- * @param     line the line link list
+ * @brief     Deallocates all lines. Function loops through the line array and frees allocated data. Pointers
+ *            are nullified. The array itself is freed by the caller.
+ * @param     line the line array
+ * @param     size number of lines
  * @return    MAP_SAFE if it completes successfully
  * @see       {@link Line_t()}
  */
-MAP_ERROR_CODE free_line(list_t *restrict line);
+MAP_ERROR_CODE free_line(Line* restrict line, const int size);
 
 
 /**
- * @brief     Deallocates all nodes. Function loops through the elemenet link list and frees allocated data. Pointers
- *            are nullified.  
- * @param     node the node link list
+ * @brief     Deallocates all nodes. Function loops through the node array and frees allocated data. Pointers
+ *            are nullified. The array itself is freed by the caller.
+ * @param     node the node array
+ * @param     size number of nodes
  * @return    MAP_SAFE if it completes successfully
  * @see       {@link Line_t()}
  */
-MAP_ERROR_CODE free_node(list_t *restrict node);
+MAP_ERROR_CODE free_node(Node* restrict node, const int size);
 
 
 #endif // _FREE_DATA_H
@@ -389,3 +389,191 @@ MAP_ERROR_CODE central_difference_jacobian(MAP_OtherStateType_t* other_type, MAP
 
   return MAP_SAFE;
 };
+
+
+MAP_ERROR_CODE line_force_derivatives(Line* line, double K[3][3], double A[3][3])
+{
+  const double H = *(line->H.value);
+  const double V = *(line->V.value);
+  const double psi = line->psi;
+  const double l = line->l;
+  const double x_fair = *(line->fairlead->position_ptr.x.value);
+  const double y_fair = *(line->fairlead->position_ptr.y.value);
+  const double z_fair = *(line->fairlead->position_ptr.z.value);
+  const double x_anch = *(line->anchor->position_ptr.x.value);
+  const double y_anch = *(line->anchor->position_ptr.y.value);
+  const double z_anch = *(line->anchor->position_ptr.z.value);
+  const double sign_h = (z_fair>=z_anch) ? 1.0 : -1.0; /* h = |z_fair-z_anch| */
+  const double EA = line->line_property->EA;
+  const double w = line->line_property->omega;
+  const double cb = line->line_property->cb;
+  const double Lu = line->Lu.value;
+  double dl[3];   /* dl/d(fairlead position) */
+  double dh[3];   /* dh/d(fairlead position) */
+  double dpsi[3]; /* dpsi/d(fairlead position) */
+  double e[3];    /* fairlead position relative to the anchor */
+  double dxdh = 0.0;
+  double dxdv = 0.0;
+  double dzdh = 0.0;
+  double dzdv = 0.0;
+  double det = 0.0;
+  double dH = 0.0;
+  double dV = 0.0;
+  double Ha = H;
+  double dHa = 0.0;
+  double dVa = 0.0;
+  double norm = 0.0;
+  double T = 0.0;
+  int i = 0;
+  int j = 0;
+
+  if (line->options.linear_spring) {
+    /* fairlead force T*e/|e| (z component made positive, see solve_linear_spring_cable), anchor force is the opposite */
+    e[0] = x_fair - x_anch;
+    e[1] = y_fair - y_anch;
+    e[2] = z_fair - z_anch;
+    norm = sqrt(e[0]*e[0] + e[1]*e[1] + e[2]*e[2]);
+    T = EA/Lu*(norm - Lu);
+    for (i=0 ; i<3 ; i++) {
+      for (j=0 ; j<3 ; j++) {
+        if (norm<=Lu || norm<MACHINE_EPSILON) { /* slack */
+          K[i][j] = 0.0;
+        } else {
+          K[i][j] = (EA/Lu - T/norm)*e[i]*e[j]/(norm*norm) + ((i==j) ? T/norm : 0.0);
+        };
+        if (i==2) {
+          K[i][j] *= sign_h;
+        };
+        A[i][j] = -K[i][j];
+      };
+    };
+    return MAP_SAFE;
+  };
+
+  /* same branches as inner_function_evals() */
+  if (line->options.omit_contact==true || w<0.0 || (V-w*Lu)>0.0) { 
+    dxdh = jacobian_dxdh_no_contact(V, H, w, Lu, EA);
+    dxdv = jacobian_dxdv_no_contact(V, H, w, Lu, EA);
+    dzdh = jacobian_dzdh_no_contact(V, H, w, Lu, EA);
+    dzdv = jacobian_dzdv_no_contact(V, H, w, Lu, EA);
+  } else { 
+    dxdh = jacobian_dxdh_contact(V, H, w, Lu, EA, cb);
+    dxdv = jacobian_dxdv_contact(V, H, w, Lu, EA, cb);
+    dzdh = jacobian_dzdh_contact(V, H, w, Lu, EA, cb);
+    dzdv = jacobian_dzdv_contact(V, H, w, Lu, EA, cb);
+  };
+
+  det = dxdh*dzdv - dxdv*dzdh;
+  if (fabs(det)<MACHINE_EPSILON) {
+    return MAP_FATAL;
+  };
+
+  dl[0] = cos(psi);      dl[1] = sin(psi);     dl[2] = 0.0;
+  dh[0] = 0.0;           dh[1] = 0.0;          dh[2] = sign_h;
+  dpsi[0] = -sin(psi)/l; dpsi[1] = cos(psi)/l; dpsi[2] = 0.0;
+
+  for (j=0 ; j<3 ; j++) {
+    /* implicit function theorem: [dH dV] = [dx/dH dx/dV ; dz/dH dz/dV]^(-1) [dl dh] */
+    dH = ( dzdv*dl[j] - dxdv*dh[j])/det;
+    dV = (-dzdh*dl[j] + dxdh*dh[j])/det;
+
+    /* fairlead force H*cos(psi), H*sin(psi), V */
+    K[0][j] = dH*cos(psi) - H*sin(psi)*dpsi[j];
+    K[1][j] = dH*sin(psi) + H*cos(psi)*dpsi[j];
+    K[2][j] = dV;
+
+    /* anchor tension, as in set_line_variables_post_solve() */
+    if (line->options.omit_contact==true || w<0.0 || (V-w*Lu)>0.0) { 
+      Ha = H;
+      dHa = dH;
+      dVa = dV;
+    } else { 
+      Ha = H - cb*w*(Lu - V/w);
+      dHa = dH + cb*dV;
+      if (Ha<=0.0) {
+        Ha = 0.0;
+        dHa = 0.0;
+      };
+      dVa = 0.0;
+    };
+
+    /* anchor force -Ha*cos(psi), -Ha*sin(psi), -Va */
+    A[0][j] = -(dHa*cos(psi) - Ha*sin(psi)*dpsi[j]);
+    A[1][j] = -(dHa*sin(psi) + Ha*cos(psi)*dpsi[j]);
+    A[2][j] = -dVa;
+  };
+  return MAP_SAFE;
+};
+
+
+MAP_ERROR_CODE analytic_jacobian(MAP_OtherStateType_t* other_type, MAP_ConstraintStateType_t* z_type, Domain* domain, char* map_msg, MAP_ERROR_CODE* ierr)
+{
+  OuterSolveAttributes* ns = &domain->outer_loop;
+  MAP_ERROR_CODE success = MAP_SAFE;
+  Line* line_iter = NULL;
+  double K[3][3]; /* d(fairlead force)/d(fairlead position); d/d(anchor position) = -K */
+  double A[3][3]; /* d(anchor force)/d(fairlead position); d/d(anchor position) = -A */
+  const int THREE = 3;
+  const int z_size = z_type->z_Len; 
+  int fair = 0;   /* connect node index of the fairlead, -1 if the node is not a connect node */
+  int anch = 0;   /* connect node index of the anchor, -1 if the node is not a connect node */
+  int i = 0;
+  int j = 0;
+  int k = 0;
+
+  for (i=0 ; i<z_size ; i++) {
+    ns->b[THREE*i] = other_type->Fx_connect[i];
+    ns->b[THREE*i+1] = other_type->Fy_connect[i];
+    ns->b[THREE*i+2] = other_type->Fz_connect[i];      
+  }
+
+  for (i=0 ; i<THREE*z_size ; i++) {
+    for (j=0 ; j<THREE*z_size ; j++) {
+      ns->jac[i][j] = 0.0;
+    };
+  };
+
+  /* The connect node forces are sums of line end forces, and each line end force only depends on the 
+   * positions of the two line ends through the line solution (H, V). The external forces are constant.
+   */
+  for (k=0 ; k<domain->line_size ; k++) {
+    line_iter = &domain->line[k];
+    fair = (line_iter->fairlead->type==CONNECT) ? (int)(line_iter->fairlead->position_ptr.x.value - z_type->x) : -1;
+    anch = (line_iter->anchor->type==CONNECT) ? (int)(line_iter->anchor->position_ptr.x.value - z_type->x) : -1;
+    if (fair<0 && anch<0) {
+      continue;
+    };
+
+    success = line_force_derivatives(line_iter, K, A);
+    if (success) {
+      set_universal_error_with_message(map_msg, ierr, MAP_FATAL_99, "Line segment %d.", k+1);
+      return MAP_FATAL;
+    };
+
+    for (i=0 ; i<THREE ; i++) {
+      for (j=0 ; j<THREE ; j++) {
+        if (fair>=0) {
+          ns->jac[THREE*fair+i][THREE*fair+j] += K[i][j];
+          if (anch>=0) {
+            ns->jac[THREE*fair+i][THREE*anch+j] -= K[i][j];
+          };
+        };
+        if (anch>=0) {
+          ns->jac[THREE*anch+i][THREE*anch+j] -= A[i][j];
+          if (fair>=0) {
+            ns->jac[THREE*anch+i][THREE*fair+j] += A[i][j];
+          };
+        };
+      };
+    };
+  };
+
+  /* read flag to set scaling parameter */
+  if (ns->pg) {
+    for (i=0 ; i<THREE*z_size ; i++) { 
+      ns->jac[i][i] += (ns->ds/pow(ns->iteration_count,1.5)+ns->d);
+    };
+  };
+
+  return MAP_SAFE;
+};
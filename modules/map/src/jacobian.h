@@ -40,4 +40,30 @@ MAP_ERROR_CODE forward_difference_jacobian(MAP_OtherStateType_t* other_type, MAP
 MAP_ERROR_CODE backward_difference_jacobian(MAP_OtherStateType_t* other_type, MAP_ParameterType_t* p_type, MAP_ConstraintStateType_t* z_type, Domain* domain, char* map_msg, MAP_ERROR_CODE* ierr);
 MAP_ERROR_CODE central_difference_jacobian(MAP_OtherStateType_t* other_type, MAP_ParameterType_t* p_type, MAP_ConstraintStateType_t* z_type, Domain* domain, char* map_msg, MAP_ERROR_CODE* ierr);
 
+
+/**
+ * @brief   Derivatives of the line end forces with respect to the fairlead position
+ * @details From the implicit function theorem applied to the catenary equations at the 
+ *          current line solution (H, V), using the jacobian_* functions above. The 
+ *          derivatives with respect to the anchor position are -K and -A. Linear spring 
+ *          lines are differentiated in closed form.
+ * @param   line, a solved line
+ * @param   K, derivative of the force on the fairlead node
+ * @param   A, derivative of the force on the anchor node
+ * @see     analytic_jacobian()
+ * @return  MAP_FATAL when the line Jacobian is singular
+ */
+MAP_ERROR_CODE line_force_derivatives(Line* line, double K[3][3], double A[3][3]);
+
+
+/**
+ * @brief   Outer-loop Jacobian assembled from the line derivatives
+ * @details Selected with the 'OUTER_ANALYTIC' model option. Unlike the finite-difference 
+ *          Jacobians, no line is solved again; the lines must be solved at the current
+ *          connect node positions.
+ * @see     line_force_derivatives(), newton_solve_sequence(), krylov_solve_sequence()
+ * @return  MAP error code
+ */
+MAP_ERROR_CODE analytic_jacobian(MAP_OtherStateType_t* other_type, MAP_ConstraintStateType_t* z_type, Domain* domain, char* map_msg, MAP_ERROR_CODE* ierr);
+
 #endif // _JACOBIAN_H
@@ -31,15 +31,14 @@
 MAP_ERROR_CODE reset_node_force_to_zero(Domain* domain, char* map_msg, MAP_ERROR_CODE* ierr)
 {
   Node* node_iter = NULL;
+  int i = 0;
 
-  list_iterator_start(&domain->node);            /* starting an iteration "session" */
-  while (list_iterator_hasnext(&domain->node)) { /* tell whether more values available */
-    node_iter = (Node*)list_iterator_next(&domain->node);
+  for (i=0 ; i<domain->node_size ; i++) {
+    node_iter = &domain->node[i];
     *(node_iter->sum_force_ptr.fx.value) = 0.0;
     *(node_iter->sum_force_ptr.fy.value) = 0.0;
     *(node_iter->sum_force_ptr.fz.value) = 0.0;    
   };
-  list_iterator_stop(&domain->node); /* ending the iteration "session" */    
   return MAP_SAFE;
 };
 
@@ -60,10 +59,10 @@ MAP_ERROR_CODE calculate_node_sum_force(Domain* domain, MAP_ParameterType_t* p_t
   double fx_a = 0.0;
   double fy_a = 0.0;
   double fz_a = 0.0;
+  int i = 0;
 
-  list_iterator_start(&domain->line);         /* starting an iteration "session" */
-  while (list_iterator_hasnext(&domain->line)) { /* tell whether more values available */
-    line_iter = (Line*)list_iterator_next(&domain->line);
+  for (i=0 ; i<domain->line_size ; i++) {
+    line_iter = &domain->line[i];
     psi = line_iter->psi;
     fx = *(line_iter->H.value)*cos(psi);
     fx_a = -(line_iter->H_at_anchor)*cos(psi);
@@ -83,7 +82,6 @@ MAP_ERROR_CODE calculate_node_sum_force(Domain* domain, MAP_ParameterType_t* p_t
     add_to_sum_fz(line_iter->fairlead, fz);
     add_to_sum_fz(line_iter->anchor, fz_a);
   }; 
-  list_iterator_stop(&domain->line); /* ending the iteration "session" */    
 
   /* This is where we include the externally applied forces on the node. Note that
    *     \sum F_x= \left \{ \mathbf{f}_\textup{lines} \right \}_x-\left \{ \mathbf{f}_\textup{ext} \right \}_x \\
@@ -91,9 +89,8 @@ MAP_ERROR_CODE calculate_node_sum_force(Domain* domain, MAP_ParameterType_t* p_t
    *     \sum F_z= \left \{ \mathbf{f}_\textup{lines} \right \}_z-\left \{ \mathbf{f}_\textup{ext} \right \}_z - gM_{\textup{app}} + \rho gB_{\textup{app}}
    * The \mathbf{f}_{\textup{lines}} portion is summed in the line iterator above. 
    */
-  list_iterator_start(&domain->node);  /* starting an iteration "session" */
-  while (list_iterator_hasnext(&domain->node)) { /* tell whether more values available */
-    node_iter = (Node*)list_iterator_next(&domain->node);
+  for (i=0 ; i<domain->node_size ; i++) {
+    node_iter = &domain->node[i];
     if (node_iter->type==CONNECT) {
       sum_fx = -(node_iter->external_force.fx.value);
       sum_fy = -(node_iter->external_force.fy.value);
@@ -104,7 +101,6 @@ MAP_ERROR_CODE calculate_node_sum_force(Domain* domain, MAP_ParameterType_t* p_t
       add_to_sum_fz(node_iter, sum_fz);
      };
   }; 
-  list_iterator_stop(&domain->node); /* ending the iteration "session" */    
   return MAP_SAFE;
 }
 
@@ -133,9 +129,8 @@ MAP_ERROR_CODE set_line_variables_pre_solve(Domain* domain, char* map_msg, MAP_E
   Line* line_iter = NULL;
   int i = 0;
 
-  list_iterator_start(&domain->line);            /* starting an iteration "session" */
-  while (list_iterator_hasnext(&domain->line)) { /* tell whether more values available */ 
-    line_iter = (Line*)list_iterator_next(&domain->line);    
+  for (i=0 ; i<domain->line_size ; i++) {
+    line_iter = &domain->line[i];
         
     /* no fairlead or anchor was not set. End program gracefully. 
      * there is likely an error in the input file 
@@ -156,9 +151,7 @@ MAP_ERROR_CODE set_line_variables_pre_solve(Domain* domain, char* map_msg, MAP_E
     if (success!=MAP_SAFE) {
       set_universal_error_with_message(map_msg, ierr, MAP_WARNING_6, "Line number %d", i);
     };
-    i++;
   };
-  list_iterator_stop(&domain->line); /* ending the iteration "session" */    
 
   MAP_RETURN_STATUS(*ierr);
 };
@@ -176,10 +169,10 @@ MAP_ERROR_CODE set_line_variables_post_solve(Domain* domain, char* map_msg, MAP_
   double Lb = 0.0;
   double cb = 0.0;
   bool contact_flag = false;
+  int i = 0;
    
-  list_iterator_start(&domain->line); /* starting an iteration "session" */
-  while (list_iterator_hasnext(&domain->line)) { /* tell whether more values available */ 
-    line_iter = (Line*)list_iterator_next(&domain->line);
+  for (i=0 ; i<domain->line_size ; i++) {
+    line_iter = &domain->line[i];
     
     /* altitude angle at fairlead */
     H = *(line_iter->H.value);
@@ -225,7 +218,6 @@ MAP_ERROR_CODE set_line_variables_post_solve(Domain* domain, char* map_msg, MAP_
     line_iter->fy_anchor = Ha*sin(line_iter->psi);
     line_iter->fz_anchor = Va;
   };
-  list_iterator_stop(&domain->line); /* ending the iteration "session" */        
   return MAP_SAFE;
 };
 
@@ -297,10 +289,10 @@ MAP_ERROR_CODE set_line_initial_guess(Domain* domain, char* map_msg, MAP_ERROR_C
   double height = 0.0;
   double w = 0.0;
   double Lu = 0.0;
+  int i = 0;
 
-  list_iterator_start(&domain->line);            /* starting an iteration "session" */
-  while (list_iterator_hasnext(&domain->line)) { /* tell whether more values available */ 
-    line_iter = (Line*)list_iterator_next(&domain->line);    
+  for (i=0 ; i<domain->line_size ; i++) {
+    line_iter = &domain->line[i];
     w = line_iter->line_property->omega;
     length = line_iter->l;
     height = line_iter->h;
@@ -336,7 +328,6 @@ MAP_ERROR_CODE set_line_initial_guess(Domain* domain, char* map_msg, MAP_ERROR_C
     };
     
   };
-  list_iterator_stop(&domain->line); /* ending the iteration "session" */    
   return MAP_SAFE;
 };
 
@@ -411,8 +402,14 @@ MAP_ERROR_CODE krylov_solve_sequence(Domain* domain, MAP_ParameterType_t* p_type
       case FORWARD_DIFFERENCE :
         success = forward_difference_jacobian(other_type, p_type, z_type, domain, map_msg, ierr); CHECKERRQ(MAP_FATAL_77);
         break;
+      case ANALYTIC_JACOBIAN : /* the Jacobian is evaluated at the current line solution */
+        success = line_solve_sequence(domain, p_type, time, map_msg, ierr); CHECKERRQ(MAP_FATAL_78);
+        success = analytic_jacobian(other_type, z_type, domain, map_msg, ierr); CHECKERRQ(MAP_FATAL_99);
+        break;
+      };
+      if (ns->fd!=ANALYTIC_JACOBIAN) { /* undo the finite-difference perturbations of the line solution */
+        success = line_solve_sequence(domain, p_type, time, map_msg, ierr); CHECKERRQ(MAP_FATAL_78);
       };
-      success = line_solve_sequence(domain, p_type, time, map_msg, ierr); CHECKERRQ(MAP_FATAL_78);
       success = lu(ns, rows, map_msg, ierr); CHECKERRQ(MAP_FATAL_74);
     };
     
@@ -519,9 +516,14 @@ MAP_ERROR_CODE newton_solve_sequence(Domain* domain, MAP_ParameterType_t* p_type
     case FORWARD_DIFFERENCE :
       success = forward_difference_jacobian(other_type, p_type, z_type, domain, map_msg, ierr); CHECKERRQ(MAP_FATAL_77);
       break;
+    case ANALYTIC_JACOBIAN :
+      success = analytic_jacobian(other_type, z_type, domain, map_msg, ierr); CHECKERRQ(MAP_FATAL_99);
+      break;
     };
     
-    success = line_solve_sequence(domain, p_type, time, map_msg, ierr); CHECKERRQ(MAP_FATAL_78);
+    if (ns->fd!=ANALYTIC_JACOBIAN) { /* undo the finite-difference perturbations of the line solution */
+      success = line_solve_sequence(domain, p_type, time, map_msg, ierr); CHECKERRQ(MAP_FATAL_78);
+    };
     success = root_finding_step(ns, SIZE, z_type, other_type, &error, map_msg, ierr); CHECKERRQ(MAP_FATAL_92);
     
     ns->iteration_count++;
@@ -563,34 +565,58 @@ MAP_ERROR_CODE solve_line(Domain* domain, const float time, char* map_msg, MAP_E
 {
   MAP_ERROR_CODE success = MAP_SAFE;
   Line* line_iter = NULL;
-  int n = 1; /* line counter */
+  int n_solve = 0; /* lines [0, n_solve) passed the checks below and are solved */
+  int i = 0;
 
-  list_iterator_start(&domain->line);            /* starting an iteration "session" */
-  while (list_iterator_hasnext(&domain->line)) { /* tell whether more values available */ 
-    line_iter = (Line*)list_iterator_next(&domain->line);
+  for (i=0 ; i<domain->line_size ; i++) {
+    line_iter = &domain->line[i];
 
     // if (line_iter->l<MAP_HORIZONTAL_TOL && line_iter->l>=0.0) { /* perfectly vertical */
     //   /* this should be triggered for  perfectly vertical cable */
     //   line_iter->l = MAP_HORIZONTAL_TOL;
     // } else if (line_iter->l<0.0) {
 	if (line_iter->l<0.0) {
-      set_universal_error_with_message(map_msg, ierr, MAP_FATAL_54, "Line segment %d, l = %d [m].", n, line_iter->l);
+      set_universal_error_with_message(map_msg, ierr, MAP_FATAL_54, "Line segment %d, l = %d [m].", i+1, line_iter->l);
       break; 
     } else if (line_iter->h<=-MACHINE_EPSILON) {
-      set_universal_error_with_message(map_msg, ierr, MAP_FATAL_55, "Line segment %d, h = %d [m].", n, line_iter->h);
+      set_universal_error_with_message(map_msg, ierr, MAP_FATAL_55, "Line segment %d, h = %d [m].", i+1, line_iter->h);
       break; 
     } else if (line_iter->line_property->omega>0.0) {
       success = check_maximum_line_length(line_iter, line_iter->options.omit_contact, map_msg, ierr);
       if (success) {        
-        set_universal_error_with_message(map_msg, ierr, MAP_FATAL_59, "Line segment %d.", n);
+        set_universal_error_with_message(map_msg, ierr, MAP_FATAL_59, "Line segment %d.", i+1);
         break;
       };
     };    
 
     if (line_iter->options.linear_spring) {
       success = solve_linear_spring_cable(line_iter, map_msg, ierr); CHECKERRQ(MAP_FATAL_87);
-    } else {
-      success = call_minpack_lmder(line_iter, &domain->inner_loop, n, time, map_msg, ierr); CHECKERRQ(MAP_FATAL_79);
+    };
+  };
+  n_solve = i;
+
+  /* The catenary solves only read the line geometry set in set_line_variables_pre_solve and write
+   * to their own line, so they run concurrently. Each thread has its own copy of the lmder work
+   * arrays. A line's solution does not depend on the number of threads.
+   */
+#pragma omp parallel if (n_solve>=MAP_MIN_PARALLEL_LINES)
+  {
+    InnerSolveAttributes inner_opt = domain->inner_loop;
+    int j = 0;
+
+#pragma omp for schedule(dynamic, 4)
+    for (j=0 ; j<n_solve ; j++) {
+      if (!domain->line[j].options.linear_spring) {
+        minpack_lmder_line(&domain->line[j], &inner_opt);
+      };
+    };
+  };
+
+  /* diagnostics and lmder errors are reported in line order */
+  for (i=0 ; i<n_solve ; i++) {
+    line_iter = &domain->line[i];
+    if (!line_iter->options.linear_spring) {
+      success = check_minpack_lmder_exit(line_iter, &domain->inner_loop, i+1, time, map_msg, ierr); CHECKERRQ(MAP_FATAL_79);
     };
 
     /* 
@@ -598,12 +624,10 @@ MAP_ERROR_CODE solve_line(Domain* domain, const float time, char* map_msg, MAP_E
     */
     // /* check if L^2 norm is small. If not, MAP converged prematurely */
     // if (line_iter->residual_norm>1e-3) {
-    //   set_universal_error_with_message(map_msg, ierr, MAP_FATAL_90, "Line segment %d.", n);
+    //   set_universal_error_with_message(map_msg, ierr, MAP_FATAL_90, "Line segment %d.", i+1);
     //   break;      
     // };
-    n++;
   };
-  list_iterator_stop(&domain->line); /* ending the iteration "session" */    
 
   if (*ierr==MAP_SAFE) {
     return MAP_SAFE;
@@ -68,7 +68,8 @@ typedef enum NodeType_enum {
 typedef enum FdType_enum {
   BACKWARD_DIFFERENCE, /**< */
   CENTRAL_DIFFERENCE,  /**< */
-  FORWARD_DIFFERENCE   /**< */
+  FORWARD_DIFFERENCE,  /**< */
+  ANALYTIC_JACOBIAN    /**< Assembled from the line derivatives; no finite differences, see {@link analytic_jacobian} */
 } FdType;
 
 
@@ -438,9 +439,12 @@ struct Domain_t {
   SolveType MAP_SOLVE_TYPE;        /**< Identifies the solver type: single line, partitioned (multisegmented), and lumped-mass/FEA. Initialized in {@link initialize_domain_to_null}
                                     * */
   Vessel vessel;                   /**< Vessel for the mooring instance. Initialized in {@link initialize_vessel_to_null}. Associated VarType's are set in {@link set_vessel} */
-  list_t library;                  /**< Cable library link list; stores cable properties, e.g., @see CableLibrary_t */
-  list_t line;                     /**< Line link list */
-  list_t node;                     /**< Node link list */
+  CableLibrary* library;           /**< Cable library array; stores cable properties, e.g., @see CableLibrary_t. Allocated in {@link set_cable_library_list} */
+  Line* line;                      /**< Line array, in input file order. Allocated once in {@link set_line_list} */
+  Node* node;                      /**< Node array, in input file order. Allocated once in {@link set_node_list}; lines keep pointers to their anchor and fairlead in it */
+  int library_size;                /**< Number of cable library entries */
+  int line_size;                   /**< Number of lines */
+  int node_size;                   /**< Number of nodes */
   list_t u_update_list;            /**< List to update the references in VarType-associated u_type's in UpdateStates. Used when coupled to FAST */
   void* HEAD_U_TYPE;               /**< Checks if the reference to MAP_InputType_t changes */
 }; typedef struct Domain_t Domain;
@@ -0,0 +1,228 @@
+/****************************************************************
+ *   Copyright (C) 2014 mdm                                     *
+ *   map[dot]plus[dot]plus[dot]help[at]gmail                    *
+ *                                                              *
+ * Licensed to the Apache Software Foundation (ASF) under one   *
+ * or more contributor license agreements.  See the NOTICE file *
+ * distributed with this work for additional information        *
+ * regarding copyright ownership.  The ASF licenses this file   *
+ * to you under the Apache License, Version 2.0 (the            *
+ * "License"); you may not use this file except in compliance   *
+ * with the License.  You may obtain a copy of the License at   *
+ *                                                              *
+ *   http://www.apache.org/licenses/LICENSE-2.0                 *
+ *                                                              *
+ * Unless required by applicable law or agreed to in writing,   *
+ * software distributed under the License is distributed on an  *
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY       *
+ * KIND, either express or implied.  See the License for the    *
+ * specific language governing permissions and limitations      *
+ * under the License.                                           *
+ ****************************************************************/
+
+
+/**
+ * @file
+ * map_benchmark times map_update_states() and map_calc_output() for a farm mooring system built in memory:
+ * N_LINES OC3-Hywind catenary lines (three per floater, floaters 1 km apart) between fixed anchors and vessel
+ * fairleads. The vessel is moved in surge and sway at every step, so that every line is solved again. The sum
+ * of the fairlead forces is printed to compare builds.
+ *
+ * In OpenMP builds, the case is run with 1, 2, 4, ... up to MAX_THREADS threads (default omp_get_max_threads()),
+ * and the fairlead forces of every run are compared with those of the run on one thread.
+ *
+ *   map_benchmark [N_LINES [N_STEPS [MAX_THREADS]]]
+ */
+
+
+#include "map.h"
+#include "maperror.h"
+#include "MAP_Types.h"
+#include "mapapi.h"
+#include <time.h>
+#ifdef _OPENMP
+#  include <omp.h>
+#endif
+
+
+static double seconds_now( )
+{
+# if defined(_WIN32) || defined(_WIN64)
+  return (double)clock()/CLOCKS_PER_SEC;
+# else
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (double)now.tv_sec + 1.0E-9*(double)now.tv_nsec;
+# endif
+};
+
+
+/* Builds the farm, runs n_steps steps and returns the time spent in map_update_states and map_calc_output. The
+ * fairlead forces (fx, fy, fz of each line) are stored in forces. */
+static int run_farm(const int n_lines, const int n_steps, double* t_update, double* forces)
+{
+  const double depth = 320.0;
+  const double anchor_radius = 853.87;
+  const double fairlead_radius = 5.2;
+  const double fairlead_depth = -70.0;
+  const double spacing = 1000.0;
+  const int n_floaters = (n_lines+2)/3;
+  const int n_columns = (int)ceil(sqrt((double)n_floaters));
+  char map_msg[MAP_ERROR_STRING_LENGTH] = "\0";
+  MAP_ERROR_CODE ierr = MAP_SAFE;
+  MAP_InitInputType_t* init_type = NULL;
+  MAP_InitOutputType_t* io_type = NULL;
+  MAP_InputType_t* u_type = NULL;
+  MAP_ParameterType_t* p_type = NULL;
+  MAP_ContinuousStateType_t* x_type = NULL;
+  MAP_DiscreteStateType_t xd_type;
+  MAP_ConstraintStateType_t* z_type = NULL;
+  MAP_OtherStateType_t* other_type = NULL;
+  MAP_OutputType_t* y_type = NULL;
+  double angle = 0.0;
+  double x0 = 0.0;
+  double y0 = 0.0;
+  double t_start = 0.0;
+  int i = 0;
+  int step = 0;
+
+  *t_update = 0.0;
+  init_type = map_create_init_type(map_msg, &ierr);
+  io_type = map_create_initout_type(map_msg, &ierr);
+  u_type = map_create_input_type(map_msg, &ierr);
+  p_type = map_create_parameter_type(map_msg, &ierr);
+  x_type = map_create_continuous_type(map_msg, &ierr);
+  z_type = map_create_constraint_type(map_msg, &ierr);
+  other_type = map_create_other_type(map_msg, &ierr);
+  y_type = map_create_output_type(map_msg, &ierr);
+  xd_type.object = NULL;
+  if (ierr!=MAP_SAFE) {
+    printf("%s\n", map_msg);
+    return 1;
+  };
+
+  map_initialize_msqs_base(u_type, p_type, x_type, z_type, other_type, y_type, io_type);
+  map_set_sea_depth(p_type, depth);
+  map_set_gravity(p_type, 9.81);
+  map_set_sea_density(p_type, 1025.0);
+  MAP_STRCPY(init_type->summary_file_name, MAX_INIT_TYPE_STRING_LENGTH, "map_benchmark.sum.txt");
+  map_set_summary_file_name(init_type, map_msg, &ierr);
+
+  /* same input lines as a MAP input file; the trailing space is added by the Fortran glue code, too */
+  map_snprintf(init_type->library_input_str, MAX_INIT_TYPE_STRING_LENGTH, "steel 0.09 77.7066 384.243E6 1.0 1.0E8 0.6 -1.0 0.05 ");
+  map_add_cable_library_input_text(init_type);
+
+  for (i=0 ; i<n_lines ; i++) {
+    x0 = spacing*(double)((i/3)%n_columns);
+    y0 = spacing*(double)((i/3)/n_columns);
+    angle = (180.0 + 120.0*(double)(i%3))*DEG2RAD;
+    map_snprintf(init_type->node_input_str, MAX_INIT_TYPE_STRING_LENGTH, "%d Fix %f %f depth 0 0 # # # ",
+                 2*i+1, x0+anchor_radius*cos(angle), y0+anchor_radius*sin(angle));
+    map_add_node_input_text(init_type);
+    map_snprintf(init_type->node_input_str, MAX_INIT_TYPE_STRING_LENGTH, "%d Vessel %f %f %f 0 0 # # # ",
+                 2*i+2, x0+fairlead_radius*cos(angle), y0+fairlead_radius*sin(angle), fairlead_depth);
+    map_add_node_input_text(init_type);
+    map_snprintf(init_type->line_input_str, MAX_INIT_TYPE_STRING_LENGTH, "%d steel 902.2 %d %d ", i+1, 2*i+1, 2*i+2);
+    map_add_line_input_text(init_type);
+  };
+
+  map_snprintf(init_type->option_input_str, MAX_INIT_TYPE_STRING_LENGTH, "outer_tol 1e-5 ");
+  map_add_options_input_text(init_type);
+
+  map_init(init_type, u_type, p_type, x_type, &xd_type, z_type, other_type, y_type, io_type, &ierr, map_msg);
+  if (ierr!=MAP_SAFE) {
+    printf("map_init: %s\n", map_msg);
+    if (ierr>=MAP_ERROR) return 1;
+  };
+
+  for (step=0 ; step<n_steps ; step++) {
+    /* slow surge and sway of all floaters */
+    map_offset_vessel(other_type, u_type, 5.0*sin(0.1*step), 2.0*cos(0.07*step), 0.0, 0.0, 0.0, 0.0, map_msg, &ierr);
+
+    t_start = seconds_now( );
+    map_update_states((float)step, step, u_type, p_type, x_type, &xd_type, z_type, other_type, &ierr, map_msg);
+    map_calc_output((float)step, u_type, p_type, x_type, &xd_type, z_type, other_type, y_type, &ierr, map_msg);
+    *t_update += seconds_now( ) - t_start;
+    if (ierr>=MAP_ERROR) {
+      printf("Step %d: %s\n", step, map_msg);
+      return 1;
+    };
+  };
+
+  for (i=0 ; i<n_lines ; i++) {
+    map_get_fairlead_force_3d(&forces[3*i], &forces[3*i+1], &forces[3*i+2], other_type, i, map_msg, &ierr);
+  };
+
+  map_end(u_type, p_type, x_type, &xd_type, z_type, other_type, y_type, &ierr, map_msg);
+
+  MAPFREE(init_type);
+  MAPFREE(io_type);
+  MAPFREE(u_type);
+  MAPFREE(p_type);
+  MAPFREE(x_type);
+  MAPFREE(z_type);
+  MAPFREE(other_type);
+  MAPFREE(y_type);
+  return 0;
+};
+
+
+int main(int argc, char** argv)
+{
+  const int n_lines = argc>1 ? atoi(argv[1]) : 100;
+  const int n_steps = argc>2 ? atoi(argv[2]) : 200;
+# ifdef _OPENMP
+  const int max_threads = argc>3 ? atoi(argv[3]) : omp_get_max_threads();
+# else
+  const int max_threads = 1;
+# endif
+  double* forces = NULL;
+  double* serial_forces = NULL;
+  double force_sum = 0.0;
+  double max_difference = 0.0;
+  double t_update = 0.0;
+  double t_serial = 0.0;
+  int n_threads = 1;
+  int i = 0;
+
+  if (n_lines<1 || n_steps<1 || max_threads<1) {
+    printf("Syntax: map_benchmark [N_LINES [N_STEPS [MAX_THREADS]]], with positive arguments\n");
+    return 1;
+  };
+
+  forces = (double*)malloc(3*n_lines*sizeof(double));
+  serial_forces = (double*)malloc(3*n_lines*sizeof(double));
+  if (forces==NULL || serial_forces==NULL) {
+    printf("Out of memory\n");
+    return 1;
+  };
+
+  printf("\n");
+  printf("MAP++ farm mooring system: %d lines, %d steps\n", n_lines, n_steps);
+  printf("  threads  map_update_states + map_calc_output   speed-up  max |force difference|\n");
+  for (n_threads=1 ; n_threads<=max_threads ; n_threads = n_threads<max_threads && 2*n_threads>max_threads ? max_threads : 2*n_threads) {
+#   ifdef _OPENMP
+    omp_set_num_threads(n_threads);
+#   endif
+    if (run_farm(n_lines, n_steps, &t_update, n_threads==1 ? serial_forces : forces)) {
+      return 1;
+    };
+    if (n_threads==1) {
+      t_serial = t_update;
+      for (i=0 ; i<3*n_lines ; i++) {
+        force_sum += fabs(serial_forces[i]);
+      };
+    } else {
+      max_difference = 0.0;
+      for (i=0 ; i<3*n_lines ; i++) {
+        max_difference = fabs(forces[i]-serial_forces[i])>max_difference ? fabs(forces[i]-serial_forces[i]) : max_difference;
+      };
+    };
+    printf("  %7d  %10.4f s %12.3f ms/step %12.2f  %g N\n", n_threads, t_update, 1000.0*t_update/n_steps, t_serial/t_update, max_difference);
+  };
+  printf("  Sum of |fairlead force| components:  %.10e N\n", force_sum);
+
+  MAPFREE(forces);
+  MAPFREE(serial_forces);
+  return 0;
+};
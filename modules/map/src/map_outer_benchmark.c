@@ -0,0 +1,282 @@
+/****************************************************************
+ *   Copyright (C) 2014 mdm                                     *
+ *   map[dot]plus[dot]plus[dot]help[at]gmail                    *
+ *                                                              *
+ * Licensed to the Apache Software Foundation (ASF) under one   *
+ * or more contributor license agreements.  See the NOTICE file *
+ * distributed with this work for additional information        *
+ * regarding copyright ownership.  The ASF licenses this file   *
+ * to you under the Apache License, Version 2.0 (the            *
+ * "License"); you may not use this file except in compliance   *
+ * with the License.  You may obtain a copy of the License at   *
+ *                                                              *
+ *   http://www.apache.org/licenses/LICENSE-2.0                 *
+ *                                                              *
+ * Unless required by applicable law or agreed to in writing,   *
+ * software distributed under the License is distributed on an  *
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY       *
+ * KIND, either express or implied.  See the License for the    *
+ * specific language governing permissions and limitations      *
+ * under the License.                                           *
+ ****************************************************************/
+
+
+/**
+ * @file
+ * map_outer_benchmark compares the outer-loop (connect node) Jacobians: OUTER_BD, OUTER_CD, OUTER_FD and
+ * OUTER_ANALYTIC. The mooring system has N_LEGS two-segment legs (three per floater, floaters 1 km apart), each
+ * with a clump weight on the connect node between the anchor and the fairlead segments. The connect node of the
+ * first leg is also held by two linear-spring tethers, one up to a fixed point above it (fairlead below the anchor)
+ * and one down to the seabed, so that the Jacobian check covers both directions of the linear-spring lines. For
+ * every Jacobian, the vessel is moved in surge and sway for N_STEPS steps; the time of map_update_states() and the
+ * Newton iterations are reported, with the fairlead forces compared to the OUTER_BD run. Before the steps, the
+ * analytic Jacobian is compared with the central-difference Jacobian at the initial solution.
+ *
+ *   map_outer_benchmark [N_LEGS [N_STEPS]]
+ */
+
+
+#include "map.h"
+#include "maperror.h"
+#include "MAP_Types.h"
+#include "mapapi.h"
+#include "jacobian.h"
+#include "lineroutines.h"
+#include <time.h>
+
+
+static double seconds_now( )
+{
+# if defined(_WIN32) || defined(_WIN64)
+  return (double)clock()/CLOCKS_PER_SEC;
+# else
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (double)now.tv_sec + 1.0E-9*(double)now.tv_nsec;
+# endif
+};
+
+
+/* Largest difference between the analytic and central-difference Jacobians at the current solution, relative to
+ * the largest entry of the central-difference Jacobian */
+static double compare_jacobians(MAP_OtherStateType_t* other_type, MAP_ParameterType_t* p_type, MAP_ConstraintStateType_t* z_type, char* map_msg, MAP_ERROR_CODE* ierr)
+{
+  Domain* domain = other_type->object;
+  OuterSolveAttributes* ns = &domain->outer_loop;
+  const int n = 3*z_type->z_Len;
+  double* analytic = (double*)malloc(n*n*sizeof(double));
+  double largest = 0.0;
+  double difference = 0.0;
+  int i = 0;
+  int j = 0;
+
+  line_solve_sequence(domain, p_type, 0.0, map_msg, ierr);
+  analytic_jacobian(other_type, z_type, domain, map_msg, ierr);
+  for (i=0 ; i<n ; i++) {
+    for (j=0 ; j<n ; j++) {
+      analytic[i*n+j] = ns->jac[i][j];
+    };
+  };
+  central_difference_jacobian(other_type, p_type, z_type, domain, map_msg, ierr);
+  line_solve_sequence(domain, p_type, 0.0, map_msg, ierr);
+  for (i=0 ; i<n ; i++) {
+    for (j=0 ; j<n ; j++) {
+      largest = fabs(ns->jac[i][j])>largest ? fabs(ns->jac[i][j]) : largest;
+      difference = fabs(ns->jac[i][j]-analytic[i*n+j])>difference ? fabs(ns->jac[i][j]-analytic[i*n+j]) : difference;
+    };
+  };
+  MAPFREE(analytic);
+  return largest>0.0 ? difference/largest : difference;
+};
+
+
+/* Builds the mooring system with the given outer-loop option, runs n_steps steps and returns the time spent in
+ * map_update_states, the number of Newton iterations and the fairlead forces (fx, fy, fz of each leg). */
+static int run_legs(const char* jacobian_option, const int n_legs, const int n_steps, double* t_update, int* iterations, double* forces, double* jacobian_difference)
+{
+  const double depth = 320.0;
+  const double anchor_radius = 853.87;
+  const double connect_radius = 400.0;
+  const double connect_depth = -200.0;
+  const double fairlead_radius = 5.2;
+  const double fairlead_depth = -70.0;
+  const double spacing = 1000.0;
+  const int n_floaters = (n_legs+2)/3;
+  const int n_columns = (int)ceil(sqrt((double)n_floaters));
+  char map_msg[MAP_ERROR_STRING_LENGTH] = "\0";
+  MAP_ERROR_CODE ierr = MAP_SAFE;
+  MAP_InitInputType_t* init_type = NULL;
+  MAP_InitOutputType_t* io_type = NULL;
+  MAP_InputType_t* u_type = NULL;
+  MAP_ParameterType_t* p_type = NULL;
+  MAP_ContinuousStateType_t* x_type = NULL;
+  MAP_DiscreteStateType_t xd_type;
+  MAP_ConstraintStateType_t* z_type = NULL;
+  MAP_OtherStateType_t* other_type = NULL;
+  MAP_OutputType_t* y_type = NULL;
+  Domain* domain = NULL;
+  double angle = 0.0;
+  double x0 = 0.0;
+  double y0 = 0.0;
+  double t_start = 0.0;
+  int i = 0;
+  int step = 0;
+
+  *t_update = 0.0;
+  *iterations = 0;
+  init_type = map_create_init_type(map_msg, &ierr);
+  io_type = map_create_initout_type(map_msg, &ierr);
+  u_type = map_create_input_type(map_msg, &ierr);
+  p_type = map_create_parameter_type(map_msg, &ierr);
+  x_type = map_create_continuous_type(map_msg, &ierr);
+  z_type = map_create_constraint_type(map_msg, &ierr);
+  other_type = map_create_other_type(map_msg, &ierr);
+  y_type = map_create_output_type(map_msg, &ierr);
+  xd_type.object = NULL;
+  if (ierr!=MAP_SAFE) {
+    printf("%s\n", map_msg);
+    return 1;
+  };
+
+  map_initialize_msqs_base(u_type, p_type, x_type, z_type, other_type, y_type, io_type);
+  map_set_sea_depth(p_type, depth);
+  map_set_gravity(p_type, 9.81);
+  map_set_sea_density(p_type, 1025.0);
+  MAP_STRCPY(init_type->summary_file_name, MAX_INIT_TYPE_STRING_LENGTH, "map_outer_benchmark.sum.txt");
+  map_set_summary_file_name(init_type, map_msg, &ierr);
+
+  /* same input lines as a MAP input file; the trailing space is added by the Fortran glue code, too */
+  map_snprintf(init_type->library_input_str, MAX_INIT_TYPE_STRING_LENGTH, "steel 0.09 77.7066 384.243E6 1.0 1.0E8 0.6 -1.0 0.05 ");
+  map_add_cable_library_input_text(init_type);
+  map_snprintf(init_type->library_input_str, MAX_INIT_TYPE_STRING_LENGTH, "tether 0.05 1.0 2.0E5 1.0 1.0E8 0.6 -1.0 0.05 ");
+  map_add_cable_library_input_text(init_type);
+
+  for (i=0 ; i<n_legs ; i++) {
+    x0 = spacing*(double)((i/3)%n_columns);
+    y0 = spacing*(double)((i/3)/n_columns);
+    angle = (180.0 + 120.0*(double)(i%3))*DEG2RAD;
+    map_snprintf(init_type->node_input_str, MAX_INIT_TYPE_STRING_LENGTH, "%d Fix %f %f depth 0 0 # # # ",
+                 3*i+1, x0+anchor_radius*cos(angle), y0+anchor_radius*sin(angle));
+    map_add_node_input_text(init_type);
+    map_snprintf(init_type->node_input_str, MAX_INIT_TYPE_STRING_LENGTH, "%d Connect #%f #%f #%f 2000 0 0 0 0 ",
+                 3*i+2, x0+connect_radius*cos(angle), y0+connect_radius*sin(angle), connect_depth);
+    map_add_node_input_text(init_type);
+    map_snprintf(init_type->node_input_str, MAX_INIT_TYPE_STRING_LENGTH, "%d Vessel %f %f %f 0 0 # # # ",
+                 3*i+3, x0+fairlead_radius*cos(angle), y0+fairlead_radius*sin(angle), fairlead_depth);
+    map_add_node_input_text(init_type);
+    map_snprintf(init_type->line_input_str, MAX_INIT_TYPE_STRING_LENGTH, "%d steel 480.0 %d %d ", 2*i+1, 3*i+1, 3*i+2);
+    map_add_line_input_text(init_type);
+    map_snprintf(init_type->line_input_str, MAX_INIT_TYPE_STRING_LENGTH, "%d steel 450.0 %d %d ", 2*i+2, 3*i+2, 3*i+3);
+    map_add_line_input_text(init_type);
+  };
+
+  /* linear-spring tethers on the connect node of the first leg, which is at (-connect_radius, 0, connect_depth) */
+  map_snprintf(init_type->node_input_str, MAX_INIT_TYPE_STRING_LENGTH, "%d Fix %f 0 %f 0 0 # # # ", 3*n_legs+1, -connect_radius+30.0, connect_depth+50.0);
+  map_add_node_input_text(init_type);
+  map_snprintf(init_type->node_input_str, MAX_INIT_TYPE_STRING_LENGTH, "%d Fix %f 0 depth 0 0 # # # ", 3*n_legs+2, -connect_radius+20.0);
+  map_add_node_input_text(init_type);
+  map_snprintf(init_type->line_input_str, MAX_INIT_TYPE_STRING_LENGTH, "%d tether 50.0 %d 2 LINEAR_SPRING ", 2*n_legs+1, 3*n_legs+1);
+  map_add_line_input_text(init_type);
+  map_snprintf(init_type->line_input_str, MAX_INIT_TYPE_STRING_LENGTH, "%d tether 110.0 %d 2 LINEAR_SPRING ", 2*n_legs+2, 3*n_legs+2);
+  map_add_line_input_text(init_type);
+
+  map_snprintf(init_type->option_input_str, MAX_INIT_TYPE_STRING_LENGTH, "outer_tol 0.1 ");
+  map_add_options_input_text(init_type);
+  map_snprintf(init_type->option_input_str, MAX_INIT_TYPE_STRING_LENGTH, "%s ", jacobian_option);
+  map_add_options_input_text(init_type);
+
+  map_init(init_type, u_type, p_type, x_type, &xd_type, z_type, other_type, y_type, io_type, &ierr, map_msg);
+  if (ierr!=MAP_SAFE) {
+    printf("map_init: %s\n", map_msg);
+    if (ierr>=MAP_ERROR) return 1;
+  };
+  domain = other_type->object;
+
+  if (jacobian_difference!=NULL) {
+    *jacobian_difference = compare_jacobians(other_type, p_type, z_type, map_msg, &ierr);
+  };
+
+  for (step=0 ; step<n_steps ; step++) {
+    /* slow surge and sway of all floaters */
+    map_offset_vessel(other_type, u_type, 5.0*sin(0.1*step), 2.0*cos(0.07*step), 0.0, 0.0, 0.0, 0.0, map_msg, &ierr);
+
+    t_start = seconds_now( );
+    map_update_states((float)step, step, u_type, p_type, x_type, &xd_type, z_type, other_type, &ierr, map_msg);
+    *t_update += seconds_now( ) - t_start;
+    *iterations += domain->outer_loop.iteration_count - 1;
+    if (ierr>=MAP_ERROR) {
+      printf("Step %d: %s\n", step, map_msg);
+      return 1;
+    };
+  };
+  map_calc_output((float)n_steps, u_type, p_type, x_type, &xd_type, z_type, other_type, y_type, &ierr, map_msg);
+
+  for (i=0 ; i<n_legs ; i++) {
+    map_get_fairlead_force_3d(&forces[3*i], &forces[3*i+1], &forces[3*i+2], other_type, 2*i+1, map_msg, &ierr);
+  };
+
+  map_end(u_type, p_type, x_type, &xd_type, z_type, other_type, y_type, &ierr, map_msg);
+
+  MAPFREE(init_type);
+  MAPFREE(io_type);
+  MAPFREE(u_type);
+  MAPFREE(p_type);
+  MAPFREE(x_type);
+  MAPFREE(z_type);
+  MAPFREE(other_type);
+  MAPFREE(y_type);
+  return 0;
+};
+
+
+int main(int argc, char** argv)
+{
+  const char* jacobian_options[] = {"outer_bd", "outer_cd", "outer_fd", "outer_analytic"};
+  const int n_legs = argc>1 ? atoi(argv[1]) : 6;
+  const int n_steps = argc>2 ? atoi(argv[2]) : 50;
+  double* forces = NULL;
+  double* reference_forces = NULL;
+  double jacobian_difference = 0.0;
+  double max_difference = 0.0;
+  double t_update = 0.0;
+  double t_reference = 0.0;
+  int iterations = 0;
+  int i = 0;
+  int k = 0;
+
+  if (n_legs<1 || n_steps<1) {
+    printf("Syntax: map_outer_benchmark [N_LEGS [N_STEPS]], with N_LEGS>0 and N_STEPS>0\n");
+    return 1;
+  };
+
+  forces = (double*)malloc(3*n_legs*sizeof(double));
+  reference_forces = (double*)malloc(3*n_legs*sizeof(double));
+  if (forces==NULL || reference_forces==NULL) {
+    printf("Out of memory\n");
+    return 1;
+  };
+
+  printf("\n");
+  printf("MAP++ outer-loop Jacobians: %d legs (%d connect nodes), %d steps\n", n_legs, n_legs, n_steps);
+  printf("  option          map_update_states          iterations/step   speed-up  max |force difference|\n");
+  for (k=0 ; k<4 ; k++) {
+    if (run_legs(jacobian_options[k], n_legs, n_steps, &t_update, &iterations, k==0 ? reference_forces : forces, k==3 ? &jacobian_difference : NULL)) {
+      return 1;
+    };
+    max_difference = 0.0;
+    if (k==0) {
+      t_reference = t_update;
+    } else {
+      for (i=0 ; i<3*n_legs ; i++) {
+        max_difference = fabs(forces[i]-reference_forces[i])>max_difference ? fabs(forces[i]-reference_forces[i]) : max_difference;
+      };
+    };
+    printf("  %-14s  %8.4f s %10.3f ms/step  %12.2f  %12.2f  %g N\n", jacobian_options[k], t_update, 1000.0*t_update/n_steps,
+           (double)iterations/n_steps, t_reference/t_update, max_difference);
+  };
+  printf("  Analytic vs. central-difference Jacobian at the initial solution: %.3e (relative to the largest entry)\n", jacobian_difference);
+
+  MAPFREE(forces);
+  MAPFREE(reference_forces);
+  return 0;
+};
@@ -51,19 +51,11 @@ MAP_EXTERNCALL void map_initialize_msqs_base(MAP_InputType_t* u_type,
    */  
   success = initialize_fortran_types(u_type, p_type, x_type, z_type, other_type, y_type, io_type);
 
-  /* create a cable library link lists for:
-   *  - nodes
-   *  - lines
-   *  - cable library (properties)
-   * The following are simclist routines 
+  /* create the link list of input references. The nodes, lines and cable library are
+   * arrays allocated in map_init() once their sizes are known. The following are 
+   * simclist routines 
    */
-  list_init(&domain->library); 
-  list_init(&domain->node); 
-  list_init(&domain->line);  
   list_init(&domain->u_update_list);  
-  list_attributes_copy(&domain->library, cable_library_meter, 1); 
-  list_attributes_copy(&domain->node, node_meter, 1); 
-  list_attributes_copy(&domain->line, cable_line_meter, 1);    
   list_attributes_copy(&domain->u_update_list, u_list_meter, 1);    
 };
 
@@ -312,15 +304,18 @@ MAP_EXTERNCALL void map_end(MAP_InputType_t* u_type,
   success = free_outer_solve_data(&domain->outer_loop, z_type->x_Len, map_msg, ierr); CHECKERRQ(MAP_FATAL_73);
   success = map_free_types(u_type, p_type, x_type, z_type, other_type, y_type); 
   success = free_outlist(domain,map_msg,ierr); CHECKERRQ(MAP_FATAL_47);//@rm, should be replaced with a MAPFREE(data->y_list)   
-  success = free_line(&domain->line);
-  success = free_node(&domain->node);
+  success = free_line(domain->line, domain->line_size);
+  success = free_node(domain->node, domain->node_size);
   success = free_vessel(&domain->vessel);
-  success = free_cable_library(&domain->library);
+  success = free_cable_library(domain->library, domain->library_size);
   success = free_update_list(&domain->u_update_list);
   
-  list_destroy(&domain->line);
-  list_destroy(&domain->node);
-  list_destroy(&domain->library);
+  MAPFREE(domain->line);
+  MAPFREE(domain->node);
+  MAPFREE(domain->library);
+  domain->line_size = 0;
+  domain->node_size = 0;
+  domain->library_size = 0;
   list_destroy(&domain->u_update_list);  
   MAPFREE(domain->model_options.repeat_angle);
   MAP_OtherState_Delete(domain);
@@ -588,7 +583,7 @@ MAP_EXTERNCALL double* map_plot_x_array(MAP_OtherStateType_t* other_type, int i,
   int s = 0;
 
   map_reset_universal_error(map_msg, ierr);
-  line = (Line*)list_get_at(&domain->line, i);  
+  line = (i>=0 && i<domain->line_size) ? &domain->line[i] : NULL;  
   
   if (line==NULL) {    
     set_universal_error_with_message(map_msg, ierr, MAP_FATAL_42, "Line out of range: <%d>.", i);
@@ -666,7 +661,7 @@ MAP_EXTERNCALL double* map_plot_y_array(MAP_OtherStateType_t* other_type, int i,
   // int ret = 0;
 
   map_reset_universal_error(map_msg, ierr);  
-  line = (Line*)list_get_at(&data->line, i);
+  line = (i>=0 && i<data->line_size) ? &data->line[i] : NULL;
   
   if (line==NULL) {
     set_universal_error_with_message(map_msg, ierr, MAP_FATAL_42, "Line out of range: <%d>.", i);
@@ -743,7 +738,7 @@ MAP_EXTERNCALL double* map_plot_z_array(MAP_OtherStateType_t* other_type, int i,
   int s = 0;
 
   map_reset_universal_error(map_msg, ierr);  
-  line = (Line*)list_get_at(&data->line, i);
+  line = (i>=0 && i<data->line_size) ? &data->line[i] : NULL;
   
   if (line==NULL){
     set_universal_error_with_message(map_msg, ierr, MAP_FATAL_42, "Line out of range: <%d>.", i);
@@ -820,7 +815,7 @@ MAP_EXTERNCALL double map_residual_function_length(MAP_OtherStateType_t* other_t
   bool contact_flag = false;
 
   map_reset_universal_error(map_msg, ierr);  
-  line = (Line*)list_get_at(&domain->line, i);
+  line = (i>=0 && i<domain->line_size) ? &domain->line[i] : NULL;
 
   if (line==NULL) {
     set_universal_error_with_message(map_msg, ierr, MAP_FATAL_42, "Line out of range: <%d>.", i);
@@ -859,7 +854,7 @@ MAP_EXTERNCALL double map_residual_function_height(MAP_OtherStateType_t* other_t
 
 
   map_reset_universal_error(map_msg, ierr);  
-  line = (Line*)list_get_at(&domain->line, i);
+  line = (i>=0 && i<domain->line_size) ? &domain->line[i] : NULL;
 
   if (line==NULL) {    
     set_universal_error_with_message(map_msg, ierr, MAP_FATAL_42, "Line out of range: <%d>.", i);
@@ -896,7 +891,7 @@ MAP_EXTERNCALL double map_jacobian_dxdh(MAP_OtherStateType_t* other_type, int i,
   bool contact_flag = false;
 
   map_reset_universal_error(map_msg, ierr);  
-  line = (Line*)list_get_at(&domain->line, i);
+  line = (i>=0 && i<domain->line_size) ? &domain->line[i] : NULL;
 
   if (line==NULL) {    
     set_universal_error_with_message(map_msg, ierr, MAP_FATAL_42, "Line out of range: <%d>.", i);
@@ -932,7 +927,7 @@ MAP_EXTERNCALL double map_jacobian_dxdv(MAP_OtherStateType_t* other_type, int i,
   bool contact_flag = false;
 
   map_reset_universal_error(map_msg, ierr);  
-  line = (Line*)list_get_at(&domain->line, i);
+  line = (i>=0 && i<domain->line_size) ? &domain->line[i] : NULL;
   
   if (line==NULL) {    
     set_universal_error_with_message(map_msg, ierr, MAP_FATAL_42, "Line out of range: <%d>.", i);
@@ -968,7 +963,7 @@ MAP_EXTERNCALL double map_jacobian_dzdh(MAP_OtherStateType_t* other_type, int i,
   bool contact_flag = false;
 
   map_reset_universal_error(map_msg, ierr);  
-  line = (Line*)list_get_at(&domain->line, i);
+  line = (i>=0 && i<domain->line_size) ? &domain->line[i] : NULL;
 
   if (line==NULL) {    
     set_universal_error_with_message(map_msg, ierr, MAP_FATAL_42, "Line out of range: <%d>.", i);
@@ -1004,7 +999,7 @@ MAP_EXTERNCALL double map_jacobian_dzdv(MAP_OtherStateType_t* other_type, int i,
   bool contact_flag = false;
 
   map_reset_universal_error(map_msg, ierr);  
-  line = (Line*)list_get_at(&domain->line, i);
+  line = (i>=0 && i<domain->line_size) ? &domain->line[i] : NULL;
 
   if (line==NULL) {    
     set_universal_error_with_message(map_msg, ierr, MAP_FATAL_42, "Line out of range: <%d>.", i);
@@ -1035,8 +1030,8 @@ MAP_EXTERNCALL void map_get_fairlead_force_2d(double* H, double* V, MAP_OtherSta
 
   map_reset_universal_error(map_msg, ierr);  
 
-  if (i<=list_size(&domain->line)-1) {
-    iter_line = (Line*)list_get_at(&domain->line, i);
+  if (i<(unsigned int)domain->line_size) {
+    iter_line = &domain->line[i];
     *H = *(iter_line->H.value);
     *V = *(iter_line->V.value);
   } else {
@@ -1053,8 +1048,8 @@ MAP_EXTERNCALL void map_get_fairlead_force_3d(double* fx, double* fy, double* fz
   double psi = 0.0;
   const unsigned int i = index;
 
-  if (i<=list_size(&domain->line)-1) {
-    iter_line = (Line*)list_get_at(&domain->line, i);
+  if (i<(unsigned int)domain->line_size) {
+    iter_line = &domain->line[i];
     psi = iter_line->psi;
     *fx = *(iter_line->H.value)*cos(psi);
     *fy = *(iter_line->H.value)*sin(psi);
@@ -1070,7 +1065,7 @@ MAP_EXTERNCALL int map_size_lines(MAP_OtherStateType_t* other_type, MAP_ERROR_CO
 {
   Domain* domain = other_type->object;
   map_reset_universal_error(map_msg, ierr);  
-  return list_size(&domain->line);
+  return domain->line_size;
 };
 
 
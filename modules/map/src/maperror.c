@@ -125,6 +125,7 @@ const char MAP_ERROR_STRING[][256] = {
   /* MAP_FATAL_96   */  "Atempting to run option KRYLOV_ACCELERATOR without LAPACK libraries compiled in. This option is not available without the LAPACK library",
   /* MAP_FATAL_97   */  "Cannot associate constraint variable in map_update_states",
   /* MAP_FATAL_98   */  "Cannot associate constraint variable in map_calc_output",
+  /* MAP_FATAL_99   */  "Analytic Jacobian failed. The Jacobian of a line is singular. Try a finite-difference Jacobian: option 'OUTER_BD', 'OUTER_CD' or 'OUTER_FD'",
   /* MAP_ERROR_1    */  "Line option 'DAMGE_TIME' does not trail with a valid value. Ignoring this run-time flag. Chek the MAP input file",
   /* MAP_ERROR_2    */  "Value for 'INNER_FTOL' is not a valid numeric value. Using the default value <1e-6>",
   /* MAP_ERROR_3    */  "Value for 'OUTER_TOL' is not a valid numeric value. Using the default value <1e-6>",
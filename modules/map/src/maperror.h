@@ -132,6 +132,7 @@ typedef enum MAP_ERROR_CODE {
   MAP_FATAL_96  , // Atempting to run option KRYLOV_ACCELERATOR without LAPACK libraries compiled in. This option is not available without the LAPACK library
   MAP_FATAL_97  , // Cannot associate constriaint variable in UpdateStates",
   MAP_FATAL_98  , // Cannot associate constriaint variable in CalcOutput",
+  MAP_FATAL_99  , // Analytic Jacobian failed. Singular line Jacobian
   MAP_ERROR_1   , // Line option 'DAMAGE_TIME' does not trail with a valid value. Ignoring this run-time flag. Chek the MAP input file
   MAP_ERROR_2   , // Value for 'INNER_FTOL' is not a valid numeric value. Using the default value <1e-6>
   MAP_ERROR_3   , // Value for 'OUTER_TOL' is not a valid numeric value. Using the default value <1e-6>
@@ -124,6 +124,12 @@ void initialize_domain_to_null(Domain* domain)
 {
   domain->MAP_SOLVE_TYPE = -999;
   domain->y_list = NULL; 
+  domain->library = NULL;
+  domain->line = NULL;
+  domain->node = NULL;
+  domain->library_size = 0;
+  domain->line_size = 0;
+  domain->node_size = 0;
   initialize_inner_solve_data_defaults(&domain->inner_loop);    
   initialize_outer_solve_data_defaults(&domain->outer_loop);    
   initialize_vessel_to_null(&domain->vessel);    
@@ -131,24 +137,6 @@ void initialize_domain_to_null(Domain* domain)
 };
 
 
-size_t cable_line_meter(const void *el) 
-{
-  return sizeof(Line);
-};
-
-
-size_t cable_library_meter(const void *el) 
-{
-  return sizeof(CableLibrary);
-};
-
-
-size_t node_meter(const void *el) 
-{
-  return sizeof(Node);
-};
-
-
 size_t u_list_meter(const void *el) 
 {
   return sizeof(ReferencePoint);
@@ -849,6 +837,18 @@ MAP_ERROR_CODE check_outer_fd_flag(struct bstrList* list, FdType* fd)
 };
 
 
+MAP_ERROR_CODE check_outer_analytic_flag(struct bstrList* list, FdType* aj)
+{
+  int success = 0;
+
+  success = biseqcstrcaseless(list->entry[0],"OUTER_ANALYTIC"); /* string compare */
+  if (success) {
+    *aj = ANALYTIC_JACOBIAN;
+  };
+  return MAP_SAFE;
+};
+
+
 MAP_ERROR_CODE check_wave_kinematics_flag(struct bstrList* list, bool* wave)
 {
   int success = 0;
@@ -1020,6 +1020,8 @@ MAP_ERROR_CODE check_uncaught_flag(struct bstrList* list)
     return MAP_SAFE;
   } else if (biseqcstrcaseless(list->entry[0],"OUTER_FD")) {
     return MAP_SAFE;
+  } else if (biseqcstrcaseless(list->entry[0],"OUTER_ANALYTIC")) {
+    return MAP_SAFE;
   } else if (biseqcstrcaseless(list->entry[0],"WAVE_KINEMATICS")) {
     return MAP_SAFE;
   } else if (biseqcstrcaseless(list->entry[0],"LM_MODEL")) {
@@ -1156,6 +1158,7 @@ MAP_ERROR_CODE set_model_options_list(Domain* domain, InitializationData* init_d
     success = check_outer_bd_flag(parsed, &domain->outer_loop.fd);
     success = check_outer_cd_flag(parsed, &domain->outer_loop.fd);
     success = check_outer_fd_flag(parsed, &domain->outer_loop.fd);      
+    success = check_outer_analytic_flag(parsed, &domain->outer_loop.fd);
     success = check_wave_kinematics_flag(parsed, &domain->model_options.wave_kinematics); CHECKERRK(MAP_WARNING_10);
     success = check_lm_model_flag(parsed, &domain->model_options.lm_model); CHECKERRK(MAP_WARNING_11);
     success = check_pg_cooked_flag(parsed, &domain->outer_loop); CHECKERRK(MAP_WARNING_8);
@@ -1224,9 +1227,16 @@ MAP_ERROR_CODE set_cable_library_list(Domain* domain, InitializationData* init_d
   cstr2tbstr(tokens," \t\n\r"); /* token for splitting line into indivdual words is a tab and space */   
   success = reset_cable_library(&new_cable_library);
 
+  domain->library = malloc((n_lines+1)*sizeof(CableLibrary));
+  if (domain->library==NULL) {
+    set_universal_error_with_message(map_msg, ierr, MAP_FATAL_47, "Failed allocation of the cable library");
+    return MAP_FATAL;
+  };
+  domain->library_size = n_lines+1;
+
   for (i=0 ; i<=n_lines ; i++) { 
-    list_append(&domain->library, &new_cable_library);
-    library_iter = (CableLibrary*)list_get_at(&domain->library, i);
+    domain->library[i] = new_cable_library;
+    library_iter = &domain->library[i];
 
     parsed = bsplits(init_data->library_input_string->entry[i], &tokens);
     n = 0;
@@ -1285,10 +1295,10 @@ MAP_ERROR_CODE initialize_cable_library_variables(Domain* domain, MAP_ParameterT
   const double g = p_type->g;
   const double PI = 3.14159264;
   CableLibrary* library_iter = NULL;
+  int i = 0;
 
-  list_iterator_start(&domain->library); /* starting an iteration "session" */
-  while ( list_iterator_hasnext(&domain->library)) { /* tell whether more values available */ 
-    library_iter = (CableLibrary*)list_iterator_next(&domain->library);
+  for (i=0 ; i<domain->library_size ; i++) {
+    library_iter = &domain->library[i];
     radius = library_iter->diam/2;
     area = PI*pow(radius,2);
     mu = library_iter->mass_density;
@@ -1301,7 +1311,6 @@ MAP_ERROR_CODE initialize_cable_library_variables(Domain* domain, MAP_ParameterT
                                        "omega = %f <= 1.0", library_iter->omega);
     };
   };
-  list_iterator_stop(&domain->library); /* ending the iteration "session" */    
   
   if (fabs(library_iter->omega)<=1.0E-3) {
     return MAP_FATAL;
@@ -1882,10 +1891,18 @@ MAP_ERROR_CODE set_node_list(const MAP_ParameterType_t* p_type,  MAP_InputType_t
 
   success = allocate_types_for_nodes(u_type, z_type, other_type, y_type, domain, node_input_string, map_msg, ierr);
   success = reset_node(&new_node); /* create an empty node */
+
+  /* the array is not resized after this; lines point to their anchor and fairlead nodes in it */
+  domain->node = malloc(num_nodes*sizeof(Node));
+  if (domain->node==NULL) {
+    set_universal_error_with_message(map_msg, ierr, MAP_FATAL_47, "Failed allocation of the node array");
+    return MAP_FATAL;
+  };
+  domain->node_size = num_nodes;
    
   for(i=0 ; i<num_nodes ; i++) {         
-    list_append(&domain->node, &new_node); /* append node to list */
-    node_iter = (Node*)list_get_at(&domain->node, i);
+    domain->node[i] = new_node;
+    node_iter = &domain->node[i];
     // success = set_node_vartype(node_iter);
     i_parsed = 0;
     next = 0;
@@ -2236,10 +2253,17 @@ MAP_ERROR_CODE set_line_list(MAP_ConstraintStateType_t* z_type, Domain* domain,
     set_universal_error_with_message(map_msg, ierr, MAP_FATAL_53, "Failed allocation of a z_type");
     return MAP_FATAL;
   };
+
+  domain->line = malloc(num_lines*sizeof(Line));
+  if (domain->line==NULL) {
+    set_universal_error_with_message(map_msg, ierr, MAP_FATAL_47, "Failed allocation of the line array");
+    return MAP_FATAL;
+  };
+  domain->line_size = num_lines;
   
   for(i=0 ; i<num_lines ; i++) {         
-    list_append(&domain->line, &new_line);
-    line_iter = (Line*)list_get_at(&domain->line, i);
+    domain->line[i] = new_line;
+    line_iter = &domain->line[i];
     // success = set_line_vartype(line_iter, i); /* @todo: check error */ @rm
 
     i_parsed = 0;
@@ -2318,11 +2342,11 @@ MAP_ERROR_CODE set_output_list(Domain* domain, MAP_InitOutputType_t* io_type, ch
   OutputList* y_list = domain->y_list;
   // int size = 0;
   int line_num = 1;
+  int i = 0;
   // VarTypePtr* iter_vartype = NULL;
 
-  list_iterator_start(&domain->line); /* starting an iteration "session" */
-  while (list_iterator_hasnext(&domain->line)) { /* tell whether more values available */ 
-    line_iter = (Line*)list_iterator_next(&domain->line);    
+  for (i=0 ; i<domain->line_size ; i++) {
+    line_iter = &domain->line[i];
     
     if (line_iter->options.gx_anchor_pos_flag) {
       list_append(&y_list->out_list_ptr, &line_iter->anchor->position_ptr.x);      
@@ -2452,7 +2476,6 @@ MAP_ERROR_CODE set_output_list(Domain* domain, MAP_InitOutputType_t* io_type, ch
 
     line_num++;
   };
-  list_iterator_stop(&domain->line); /* ending the iteration session */  
 
   return MAP_SAFE;
 };
@@ -2578,20 +2601,18 @@ MAP_ERROR_CODE associate_line_with_cable_property(Line* line_ptr, Domain* domain
 {
   // MAP_ERROR_CODE success = MAP_SAFE;
   CableLibrary* library_iterator = NULL;
+  int i = 0;
 
   library_iterator = NULL;
   line_ptr->line_property = NULL;
 
-  list_iterator_start(&domain->library); /* starting an iteration session */
-  while (list_iterator_hasnext(&domain->library)) { /* tell whether more values available */
-    library_iterator = (CableLibrary*)list_iterator_next(&domain->library);
+  for (i=0 ; i<domain->library_size ; i++) {
+    library_iterator = &domain->library[i];
     if (biseqcstrcaseless(library_iterator->label, word)) {      
       line_ptr->line_property = library_iterator;
-      list_iterator_stop(&domain->library); /* ending the iteration session */  
       break;
     }; 
   };
-  list_iterator_stop(&domain->library); /* ending the iteration session */  
   if (line_ptr->line_property==NULL) {        
     set_universal_error_with_message(map_msg, ierr, MAP_FATAL_27, "No libraries match <%s>.", word);
     return MAP_FATAL;
@@ -2610,7 +2631,7 @@ MAP_ERROR_CODE associate_line_with_anchor_node(Line* line_ptr, Domain* domain, c
   
   if (is_numeric(word)) {
     node_num = (int)atoi(word); 
-    node_iter = (Node*)list_get_at(&domain->node, node_num-1);
+    node_iter = (node_num>=1 && node_num<=domain->node_size) ? &domain->node[node_num-1] : NULL;
     line_ptr->anchor = node_iter; /* create the associate with anchor here */
     if (!node_iter) {
       set_universal_error_with_message(map_msg, ierr, MAP_FATAL_30, "Line %d.", line_num);
@@ -2634,7 +2655,7 @@ MAP_ERROR_CODE associate_line_with_fairlead_node(Line* line_ptr, Domain* domain,
 
   if (is_numeric(word)) {
     node_num = (int)atoi(word); 
-    node_iter = (Node*)list_get_at(&domain->node, node_num-1);
+    node_iter = (node_num>=1 && node_num<=domain->node_size) ? &domain->node[node_num-1] : NULL;
     line_ptr->fairlead = node_iter; /* create the associate with anchor here */
     if (!node_iter) {
       set_universal_error_with_message(map_msg, ierr, MAP_FATAL_31, "Line %d.", line_num);
@@ -2822,6 +2843,7 @@ MAP_ERROR_CODE print_help_to_screen()
   printf("      -outer_bd,\n");
   printf("      -outer_cd,\n");
   printf("      -outer_fd,\n");
+  printf("      -outer_analytic,\n");
   printf("      -pg_cooked <1000.0> <1.0>,\n");
   printf("      -krylov_accelerator <3>,\n");
   printf("      -integration_dt <0.01>,\n");
@@ -2849,22 +2871,18 @@ MAP_ERROR_CODE associate_constraint_states(Domain* domain, MAP_ConstraintStateTy
   Line* line_iter = NULL;
   int next = 0;
   MAP_ERROR_CODE success = MAP_SAFE;
+  int i = 0;
   
   MAP_BEGIN_ERROR_LOG;
 
-  list_iterator_start(&domain->line);            /* starting an iteration "session" */
-  while (list_iterator_hasnext(&domain->line)) { /* tell whether more values available */
-    line_iter = (Line*)list_iterator_next(&domain->line);
-    success = associate_vartype_ptr(&line_iter->H, z_type->H, next+1);
-    success = associate_vartype_ptr(&line_iter->V, z_type->V, next+1);
-    next++;
+  for (i=0 ; i<domain->line_size ; i++) {
+    line_iter = &domain->line[i];
+    success = associate_vartype_ptr(&line_iter->H, z_type->H, i+1);
+    success = associate_vartype_ptr(&line_iter->V, z_type->V, i+1);
   };
-  list_iterator_stop(&domain->line); /* ending the iteration "session" */    
   
-  next = 0;
-  list_iterator_start(&domain->node);            /* starting an iteration "session" */
-  while (list_iterator_hasnext(&domain->node)) { /* tell whether more values available */
-    node_iter = (Node*)list_iterator_next(&domain->node);
+  for (i=0 ; i<domain->node_size ; i++) {
+    node_iter = &domain->node[i];
     if (node_iter->type==CONNECT) {
       success = associate_vartype_ptr(&node_iter->position_ptr.x, z_type->x, next+1);
       success = associate_vartype_ptr(&node_iter->position_ptr.y, z_type->y, next+1);
@@ -2872,7 +2890,6 @@ MAP_ERROR_CODE associate_constraint_states(Domain* domain, MAP_ConstraintStateTy
       next++;
     };
   };
-  list_iterator_stop(&domain->node); /* ending the iteration "session" */    
 
   MAP_END_ERROR_LOG;
 
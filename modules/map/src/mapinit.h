@@ -32,33 +32,6 @@ MAP_ERROR_CODE initialize_fortran_types(MAP_InputType_t* u_type, MAP_ParameterTy
 MAP_ERROR_CODE allocate_outlist(Domain* data, char* map_msg, MAP_ERROR_CODE* ierr);
 
 
-/**
- * @brief   Returns the size of CableLibrary structure for link list creation
- * @param   el, opaque object used in simclist
- * @see     map_init()
- * @return  Size of CableLibrary structure
- */
-size_t cable_library_meter(const void* el);
-
-
-/**
- * @brief   Returns the size of Node structure for link list creation
- * @param   el, opaque object used in simclist
- * @see     map_init()
- * @return  Size of Node structure
- */
-size_t node_meter(const void* el);
-
-
-/**
- * @brief   Returns the size of Line structure for link list creation
- * @param   el, opaque object used in simclist
- * @see     map_init()
- * @return  Size of Line structure
- */
-size_t cable_line_meter(const void* el);
-
-
 /**
  * @brief   Returns the size of ReferencePoint (inputs) structure for link list creation
  * @param   el, opaque object used in simclist
@@ -375,6 +348,24 @@ MAP_ERROR_CODE check_outer_cd_flag(struct bstrList* list, FdType* cd);
 MAP_ERROR_CODE check_outer_fd_flag(struct bstrList* list, FdType* fd);
 
 
+/**
+ * @brief   Sets FdType type to ANALYTIC-JACOBIAN
+ * @details Called by {@link set_model_option_list} to assemble the outer-loop
+ *          Jacobian from the derivatives of the line solutions instead of 
+ *          finite differences. One line solve per Jacobian instead of one per
+ *          connect node degree-of-freedom. 
+ *          MAP input file syntax:
+ *          <pre>
+ *          outer_analytic
+ *          </pre>
+ * @param   list, a character array structure
+ * @param   aj, finite difference type
+ * @see     set_model_options_list(), map_init(), analytic_jacobian()
+ * @return  MAP error code
+ */
+MAP_ERROR_CODE check_outer_analytic_flag(struct bstrList* list, FdType* aj);
+
+
 /**
  * @brief   Sets DS and DSM preconditioning coefficients for outer-loop solver
  * @details Called by {@link set_model_option_list} to set preconditioner coefficients
@@ -116,6 +116,7 @@
 #define MAX_INIT_COMPILING_DATA_STRING_LENGTH 25
 #define MAP_ERROR_STRING_LENGTH 1024
 #define MAP_HORIZONTAL_TOL 1E-2
+#define MAP_MIN_PARALLEL_LINES 8 /* smaller systems are solved on one thread in OpenMP builds; see solve_line() */
 
 #define PROGNAME "MAP++ (Mooring Analysis Program++)"
 #define PROGVERSION "1.20.10"
@@ -176,8 +176,13 @@ MAP_ERROR_CODE lu_back_substitution(OuterSolveAttributes* ns, const int n, char*
 
 MAP_ERROR_CODE call_minpack_lmder(Line* line, InnerSolveAttributes* inner_opt, const int line_num, const float time, char* map_msg, MAP_ERROR_CODE* ierr)
 {
-  MAP_ERROR_CODE success = MAP_SAFE;
+  minpack_lmder_line(line, inner_opt);
+  return check_minpack_lmder_exit(line, inner_opt, line_num, time, map_msg, ierr);
+};
+
 
+void minpack_lmder_line(Line* line, InnerSolveAttributes* inner_opt)
+{
   /* initial guess vector is set in set_line_initial_guess(..); otherwise, the previous solution is used as the initial guess */
   inner_opt->x[0] = fabs(*(line->H.value)) > MAP_HORIZONTAL_TOL ? fabs(*(line->H.value)) : MAP_HORIZONTAL_TOL;
   // inner_opt->x[0] = *(line->H.value);
@@ -212,7 +217,16 @@ MAP_ERROR_CODE call_minpack_lmder(Line* line, InnerSolveAttributes* inner_opt, c
                                       inner_opt->wa4);
   
   line->residual_norm = (double)__minpack_func__(enorm)(&inner_opt->m, inner_opt->fvec);
-  
+  *(line->H.value) = inner_opt->x[0];
+  *(line->V.value) = inner_opt->x[1];
+  line->converge_reason = inner_opt->info;
+};
+
+
+MAP_ERROR_CODE check_minpack_lmder_exit(Line* line, const InnerSolveAttributes* inner_opt, const int line_num, const float time, char* map_msg, MAP_ERROR_CODE* ierr)
+{
+  MAP_ERROR_CODE success = MAP_SAFE;
+
   if (line->options.diagnostics_flag && (double)line->diagnostic_type>time /* || line->residual_norm>inner_opt->f_tol */ ) {
     printf("\n      %4.3f [sec]  Line %d\n",time, line_num);
     printf("      ----------------------------------------------------\n");
@@ -222,14 +236,10 @@ MAP_ERROR_CODE call_minpack_lmder(Line* line, InnerSolveAttributes* inner_opt, c
 	if (line->residual_norm>inner_opt->f_tol) {
 		printf("      WARNING: l2 norm is much larger than f_tol. Premature convergence is likely\n");
 	}
-    printf("      Exit parameter                %10i\n\n", inner_opt->info);
+    printf("      Exit parameter                %10i\n\n", line->converge_reason);
   };
   
-  *(line->H.value) = inner_opt->x[0];
-  *(line->V.value) = inner_opt->x[1];
-  line->converge_reason = inner_opt->info;
-  
-  switch (inner_opt->info) {
+  switch (line->converge_reason) {
   case 0 :
     success = MAP_FATAL;
     set_universal_error_with_message(map_msg, ierr, MAP_FATAL_39, "Line segment %d.", line_num);
@@ -87,6 +87,34 @@ MAP_ERROR_CODE root_finding_step(OuterSolveAttributes* ns, const int n, MAP_Cons
 MAP_ERROR_CODE call_minpack_lmder(Line* line, InnerSolveAttributes* inner_opt, const int line_num, const float time, char* map_msg, MAP_ERROR_CODE* ierr);
 
 
+/**
+ * @brief   Solve the catenary equations of one line with lmder
+ * @details First half of {@link call_minpack_lmder}. Only the line and the
+ *          work arrays in inner_opt are written to, so lines can be solved
+ *          concurrently when each thread has its own copy of inner_opt. The
+ *          lmder exit parameter is kept in line->converge_reason.
+ * @param   line, the line structure to be solved
+ * @param   inner_opt, solver options and work arrays (wa1..wa4, fjac, ipvt, ...)
+ * @see     solve_line()
+ */
+void minpack_lmder_line(Line* line, InnerSolveAttributes* inner_opt);
+
+
+/**
+ * @brief   Print the line diagnostics and raise errors for the lmder exit parameter
+ * @details Second half of {@link call_minpack_lmder}, called after
+ *          {@link minpack_lmder_line}. Not thread safe: it writes to map_msg.
+ * @param   line, the solved line structure
+ * @param   inner_opt, solver options
+ * @param   line_num, line number for error logging
+ * @param   time, current time
+ * @param   map_msg, error message
+ * @param   ierr, error code
+ * @return  MAP error code
+ */
+MAP_ERROR_CODE check_minpack_lmder_exit(Line* line, const InnerSolveAttributes* inner_opt, const int line_num, const float time, char* map_msg, MAP_ERROR_CODE* ierr);
+
+
 /**
  * @brief   Return the residual and Jacobian for each line
  * @details Passed as a function pointer to the cminpack lmder routine.
@@ -210,10 +210,10 @@ MAP_ERROR_CODE write_summary_file(InitializationData* init, MAP_ParameterType_t*
 MAP_ERROR_CODE write_cable_library_information_to_summary_file(FILE* file, Domain* domain)
 {
   CableLibrary* library_iter = NULL;  
+  int i = 0;
 
-  list_iterator_start(&domain->library);    
-  while (list_iterator_hasnext(&domain->library)) { 
-    library_iter = (CableLibrary*)list_iterator_next(&domain->library);    
+  for (i=0 ; i<domain->library_size ; i++) {
+    library_iter = &domain->library[i];
     fprintf(file, "    Cable Type          : %s\n", library_iter->label->data);
     fprintf(file, "    Diameter     [m]    : %1.4f\n", library_iter->diam);
     fprintf(file, "    Mass Density [kg/m] : %1.2f\n", library_iter->mass_density);
@@ -221,7 +221,6 @@ MAP_ERROR_CODE write_cable_library_information_to_summary_file(FILE* file, Domai
     fprintf(file, "    omega        [N/m]  : %1.2f\n", library_iter->omega);
     fprintf(file, "    CB                  : %1.2f\n\n", library_iter->cb);
   };
-  list_iterator_stop(&domain->library);  
   return MAP_SAFE;
 };
 
@@ -677,7 +676,7 @@ MAP_ERROR_CODE write_node_information_to_summary_file(FILE* file, Domain* domain
   bstring line9 = NULL;
   Node* node_iter = NULL;  
   const int FOUR = 4;
-  const unsigned int num_nodes = list_size(&domain->node);  
+  const unsigned int num_nodes = domain->node_size;  
   unsigned int col = 0;
   MAP_ERROR_CODE success = MAP_SAFE;
 
@@ -702,7 +701,7 @@ MAP_ERROR_CODE write_node_information_to_summary_file(FILE* file, Domain* domain
     line9 = bformat("");
 
     for (col=i ; col<i+num ; col++) {
-      node_iter = (Node*)list_get_at(&domain->node, col);      
+      node_iter = &domain->node[col];
       success = write_node_header_to_summary_file(col-i, col_cnt, col+1, line0); CHECKERRQ(MAP_FATAL_70);
       success = write_node_type_to_summary_file(col-i, col_cnt, node_iter->type, line1); CHECKERRQ(MAP_FATAL_70);
       success = write_node_x_position_to_summary_file(col-i, col_cnt, &node_iter->position_ptr.x, line2); CHECKERRQ(MAP_FATAL_70);
@@ -749,7 +748,7 @@ MAP_ERROR_CODE write_node_information_to_summary_file(FILE* file, Domain* domain
 
 MAP_ERROR_CODE write_line_information_to_summary_file(FILE* file, Domain* domain)
 {
-  const unsigned int num_lines = list_size(&domain->line);
+  const unsigned int num_lines = domain->line_size;
   Line* line_iter = NULL;  
   bstring line0 = NULL;
   bstring line1 = NULL;
@@ -765,7 +764,7 @@ MAP_ERROR_CODE write_line_information_to_summary_file(FILE* file, Domain* domain
   unsigned int i = 0;  
 
   for (i=0 ; i<num_lines ; i++) {
-    line_iter = (Line*)list_get_at(&domain->line, i);
+    line_iter = &domain->line[i];
 
     line0 = bformat("");
     line1 = bformat("");
@@ -39,6 +39,8 @@ MODULE ModMesh
    IMPLICIT NONE
 !   INTEGER :: DEBUG_UNIT = 74
 
+   PRIVATE :: MeshCopyFields
+
    INTEGER,     PARAMETER, PRIVATE :: BUMPUP = 64                !< size element list will be increased when adding an element that does not fit in the currently allocated space; do not set to less than 2
    CHARACTER(*),PARAMETER          :: VTK_AryFmt = '(3(F30.5))'  !< text format for triplets written to VTK text files
 
@@ -2200,6 +2202,21 @@ SUBROUTINE MeshWrVTK_PointSurface ( RefPoint, M, FileRootName, VTKcount, OutputF
       DestMesh%Initialized = SrcMesh%Initialized
       DestMesh%Committed   = SrcMesh%Committed
       DestMesh%refNode = SrcMesh%refNode
+      CALL MeshCopyFields( SrcMesh, DestMesh )
+
+
+      !DestMesh%spatial = SrcMesh%spatial !bjj: unused?
+
+   END SUBROUTINE MeshCopy
+
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine copies the fields that SrcMesh and DestMesh both have. The meshes are not TARGETs here, so the compiler knows that
+!! their fields do not overlap and copies them without array temporaries (MeshCopy is called in every time step).
+   SUBROUTINE MeshCopyFields( SrcMesh, DestMesh )
+
+     TYPE(MeshType),              INTENT(IN)    :: SrcMesh           !< Mesh being copied
+     TYPE(MeshType),              INTENT(INOUT) :: DestMesh          !< Copy of mesh
+
       IF ( ALLOCATED(SrcMesh%Force          ) .AND. ALLOCATED(DestMesh%Force          ) ) DestMesh%Force = SrcMesh%Force
       IF ( ALLOCATED(SrcMesh%Moment         ) .AND. ALLOCATED(DestMesh%Moment         ) ) DestMesh%Moment = SrcMesh%Moment
       IF ( ALLOCATED(SrcMesh%Orientation    ) .AND. ALLOCATED(DestMesh%Orientation    ) ) DestMesh%Orientation = SrcMesh%Orientation
@@ -2210,10 +2227,7 @@ SUBROUTINE MeshWrVTK_PointSurface ( RefPoint, M, FileRootName, VTKcount, OutputF
       IF ( ALLOCATED(SrcMesh%RotationAcc    ) .AND. ALLOCATED(DestMesh%RotationAcc    ) ) DestMesh%RotationAcc = SrcMesh%RotationAcc
       IF ( ALLOCATED(SrcMesh%Scalars        ) .AND. ALLOCATED(DestMesh%Scalars        ) ) DestMesh%Scalars = SrcMesh%Scalars
 
-
-      !DestMesh%spatial = SrcMesh%spatial !bjj: unused?
-
-   END SUBROUTINE MeshCopy
+   END SUBROUTINE MeshCopyFields
 
 !----------------------------------------------------------------------------------------------------------------------------------
 !> For a given node in a mesh, assign the coordinates of the node in the global coordinate space. 
@@ -3302,7 +3316,7 @@ SUBROUTINE MeshWrVTK_PointSurface ( RefPoint, M, FileRootName, VTKcount, OutputF
                                                                      
       ! local variables                                              
     INTEGER(IntKi), parameter           :: order = 1                 ! order of polynomial fit (max 2)
-    REAL(DbKi)                          :: t(SIZE(tin))              ! Times associated with the inputs
+    REAL(DbKi)                          :: t(order+1)                ! Times associated with the inputs
     REAL(DbKi)                          :: t_out                     ! Time to which to be extrap/interpd
                                                                      
     REAL(DbKi)                          :: scaleFactor               ! temporary for extrapolation/interpolation
@@ -3316,19 +3330,19 @@ SUBROUTINE MeshWrVTK_PointSurface ( RefPoint, M, FileRootName, VTKcount, OutputF
        ErrStat = ErrID_None
        ErrMsg  = ""
 
-          ! we'll subtract a constant from the times to resolve some
-          ! numerical issues when t gets large (and to simplify the equations)
-       t = tin - tin(1)
-       t_out = tin_out - tin(1)
-
           ! some error checking:
 
-       if ( size(t) .ne. order+1) then
+       if ( size(tin) .ne. order+1) then
           ErrStat = ErrID_Fatal
           ErrMsg = 'MeshExtrapInterp1: size(t) must equal 2.'
           RETURN
        end if
 
+          ! we'll subtract a constant from the times to resolve some
+          ! numerical issues when t gets large (and to simplify the equations)
+       t = tin - tin(1)
+       t_out = tin_out - tin(1)
+
       IF ( EqualRealNos( t(1), t(2) ) ) THEN
          ErrStat = ErrID_Fatal
          ErrMsg  = 'MeshExtrapInterp1: t(1) must not equal t(2) to avoid a division-by-zero error.'
@@ -3425,7 +3439,7 @@ SUBROUTINE MeshWrVTK_PointSurface ( RefPoint, M, FileRootName, VTKcount, OutputF
       ! local variables                                              
     INTEGER(IntKi), parameter           :: order = 2                 ! order of polynomial fit (max 2)
 
-    REAL(DbKi)                          :: t(SIZE(tin))              ! Times associated with the inputs
+    REAL(DbKi)                          :: t(order+1)                ! Times associated with the inputs
     REAL(DbKi)                          :: t_out                     ! Time to which to be extrap/interpd                                                                     
     REAL(DbKi)                          :: scaleFactor               ! temporary for extrapolation/interpolation    
     REAL(DbKi)                          :: tensor(3, order+1)        ! for extrapolation of orientations 
@@ -3441,20 +3455,19 @@ SUBROUTINE MeshWrVTK_PointSurface ( RefPoint, M, FileRootName, VTKcount, OutputF
 
 !bjj: TODO check that we've initialized the mesh
 
-          ! we'll subtract a constant from the times to resolve some
-          ! numerical issues when t gets large (and to simplify the equations)
-       t = tin - tin(1)
-       t_out = tin_out - tin(1)
-
-
          ! Some error checking:
 
-      if ( size(t) .ne. order+1) then
+      if ( size(tin) .ne. order+1) then
          ErrStat = ErrID_Fatal
          ErrMsg = 'MeshExtrapInterp2: size(t) must equal 3.'
          RETURN
       end if
 
+          ! we'll subtract a constant from the times to resolve some
+          ! numerical issues when t gets large (and to simplify the equations)
+       t = tin - tin(1)
+       t_out = tin_out - tin(1)
+
       IF ( EqualRealNos( t(1), t(2) ) ) THEN
          ErrStat = ErrID_Fatal
          ErrMsg  = 'MeshExtrapInterp2: t(1) must not equal t(2) to avoid a division-by-zero error.'
@@ -65,6 +65,16 @@ MODULE NWTC_IO
    INTEGER(IntKi), PARAMETER     :: NWTC_SizeOfNumWord = 200                     !< maximum length of the words containing numeric input (for ParseVar routines)
 
 
+      ! Variables for the cache of parsed input data (see InputCacheRead and InputCacheWrite)
+
+   INTEGER(B4Ki), PARAMETER      :: InputCacheVersion = 2                        !< Version of the input cache file format; files with other versions are ignored
+   INTEGER(B8Ki), PARAMETER      :: InputCacheHashInit(2) = (/ 2166136261_B8Ki, 2166136261_B8Ki /) !< Initial value of the hashes computed by InputCacheHashBytes
+   CHARACTER(1024)               :: InputCacheDir = ' '                          !< Directory holding the cache of parsed input data; the cache is disabled if blank
+   INTEGER(IntKi)                :: InputCacheHits   = 0                         !< Number of input cache lookups that found valid data
+   INTEGER(IntKi)                :: InputCacheMisses = 0                         !< Number of input cache lookups that did not find valid data
+   INTEGER(IntKi)                :: InputCacheWriteErrors = 0                    !< Number of input cache entries that could not be written
+
+
       ! Parameters for writing to echo files (in this module only)
 
    INTEGER(IntKi), PARAMETER :: NWTC_MaxAryLen = 100 !< the maximum length of arrays that can be printed with the array formats below (used to make sure we don't crash when trying to write too many):
@@ -2513,6 +2523,332 @@ END SUBROUTINE CheckR16Var
    RETURN
    END SUBROUTINE GetWords
 !=======================================================================
+!> This function returns the name of the input cache file for the data of module ModName with key KeyHash.
+   FUNCTION InputCacheFileName ( ModName, KeyHash )
+
+   CHARACTER(1024)                 :: InputCacheFileName                     !< name of the cache file
+
+   CHARACTER(*),   INTENT(IN)      :: ModName                                !< name of the module whose data is cached
+   INTEGER(B8Ki),  INTENT(IN)      :: KeyHash(2)                             !< hash of the module inputs that determine the data (see InputCacheKey)
+
+   CHARACTER(16)                   :: HashStr                                ! hexadecimal representation of KeyHash
+
+
+   WRITE (HashStr,'(2Z8.8)')  KeyHash
+
+   InputCacheFileName = TRIM(InputCacheDir)//PathSep//TRIM(ModName)//'_'//HashStr//'.cache'
+
+   END FUNCTION InputCacheFileName
+!=======================================================================
+!> This routine adds the bytes in Bytes to a 64-bit hash, stored as the 32-bit FNV-1a (Hash(1)) and FNV-1 (Hash(2)) hashes.
+!! Hash must be set to nwtc_io::inputcachehashinit before the first call.
+   SUBROUTINE InputCacheHashBytes ( Bytes, Hash )
+
+   INTEGER(B1Ki),  INTENT(IN   )   :: Bytes(:)                               !< data to hash
+   INTEGER(B8Ki),  INTENT(INOUT)   :: Hash(2)                                !< hash
+
+   INTEGER(B8Ki), PARAMETER        :: Mask32 = 4294967295_B8Ki               ! the hashes are computed modulo 2^32; this keeps the products below 2^63
+   INTEGER(B8Ki), PARAMETER        :: FNVPrime = 16777619_B8Ki               ! the 32-bit FNV prime
+   INTEGER(B8Ki)                   :: Byte                                   ! unsigned value of a byte
+   INTEGER                         :: I                                      ! generic loop counter
+
+
+   DO I = 1,SIZE(Bytes)
+      Byte    = IAND( INT( Bytes(I), B8Ki ), 255_B8Ki )
+      Hash(1) = IAND( IEOR( Hash(1), Byte ) * FNVPrime, Mask32 )
+      Hash(2) = IEOR( IAND( Hash(2) * FNVPrime, Mask32 ), Byte )
+   END DO
+
+   END SUBROUTINE InputCacheHashBytes
+!=======================================================================
+!> This routine computes the hash and size of the contents of file FileName.
+   SUBROUTINE InputCacheHashFile ( FileName, FileSize, Hash, ErrStat, ErrMsg )
+
+   CHARACTER(*),   INTENT(IN   )   :: FileName                               !< name of the file to hash
+   INTEGER(B8Ki),  INTENT(  OUT)   :: FileSize                               !< size of the file in bytes
+   INTEGER(B8Ki),  INTENT(  OUT)   :: Hash(2)                                !< hash of the file contents
+   INTEGER(IntKi), INTENT(  OUT)   :: ErrStat                                !< Error status
+   CHARACTER(*),   INTENT(  OUT)   :: ErrMsg                                 !< Error message
+
+   INTEGER(B1Ki), ALLOCATABLE      :: Bytes(:)                               ! file contents
+   INTEGER(IntKi)                  :: Un                                     ! unit number of the file
+   INTEGER(IntKi)                  :: IOS                                    ! I/O status
+
+
+   Hash     = InputCacheHashInit
+   FileSize = -1
+
+   CALL GetNewUnit( Un, ErrStat, ErrMsg )
+   CALL OpenBInpFile( Un, FileName, ErrStat, ErrMsg )
+   IF ( ErrStat >= AbortErrLev ) RETURN
+
+   INQUIRE( Un, SIZE=FileSize )
+   IF ( FileSize < 0 ) THEN
+      ErrStat = ErrID_Fatal
+      ErrMsg  = 'InputCacheHashFile:Cannot determine the size of file "'//TRIM( FileName )//'".'
+      CLOSE( Un )
+      RETURN
+   END IF
+
+   ALLOCATE( Bytes(FileSize), STAT=IOS )
+   IF ( IOS /= 0 ) THEN
+      ErrStat = ErrID_Fatal
+      ErrMsg  = 'InputCacheHashFile:Error allocating memory for the contents of file "'//TRIM( FileName )//'".'
+      CLOSE( Un )
+      RETURN
+   END IF
+
+   IF ( FileSize > 0 ) READ( Un, IOSTAT=IOS ) Bytes
+   CLOSE( Un )
+   IF ( IOS /= 0 ) THEN
+      ErrStat = ErrID_Fatal
+      ErrMsg  = 'InputCacheHashFile:Error reading file "'//TRIM( FileName )//'".'
+      RETURN
+   END IF
+
+   CALL InputCacheHashBytes( Bytes, Hash )
+
+   END SUBROUTINE InputCacheHashFile
+!=======================================================================
+!> This routine computes the key of an input cache entry from the name of the module and the packed module inputs
+!! that determine the cached data (e.g., the packed InitInput type, which includes the name of the input file).
+   SUBROUTINE InputCacheKey ( ModName, ReKiBuf, DbKiBuf, IntKiBuf, KeyHash )
+
+   CHARACTER(*),                INTENT(IN   ) :: ModName                     !< name of the module whose data is cached
+   REAL(ReKi),     ALLOCATABLE, INTENT(IN   ) :: ReKiBuf(:)                  !< packed reals of the module inputs
+   REAL(DbKi),     ALLOCATABLE, INTENT(IN   ) :: DbKiBuf(:)                  !< packed doubles of the module inputs
+   INTEGER(IntKi), ALLOCATABLE, INTENT(IN   ) :: IntKiBuf(:)                 !< packed integers of the module inputs
+   INTEGER(B8Ki),               INTENT(  OUT) :: KeyHash(2)                  !< key of the cache entry
+
+   INTEGER(IntKi)                             :: ArraySizes(3)               ! sizes of the packed arrays
+
+
+   ArraySizes = 0
+   IF ( ALLOCATED(ReKiBuf)  ) ArraySizes(1) = SIZE(ReKiBuf)
+   IF ( ALLOCATED(DbKiBuf)  ) ArraySizes(2) = SIZE(DbKiBuf)
+   IF ( ALLOCATED(IntKiBuf) ) ArraySizes(3) = SIZE(IntKiBuf)
+
+   KeyHash = InputCacheHashInit
+   CALL InputCacheHashBytes( TRANSFER( TRIM(ModName), (/ 0_B1Ki /) ), KeyHash )
+   CALL InputCacheHashBytes( TRANSFER( ArraySizes,    (/ 0_B1Ki /) ), KeyHash )
+   IF ( ArraySizes(1) > 0 ) CALL InputCacheHashBytes( TRANSFER( ReKiBuf,  (/ 0_B1Ki /) ), KeyHash )
+   IF ( ArraySizes(2) > 0 ) CALL InputCacheHashBytes( TRANSFER( DbKiBuf,  (/ 0_B1Ki /) ), KeyHash )
+   IF ( ArraySizes(3) > 0 ) CALL InputCacheHashBytes( TRANSFER( IntKiBuf, (/ 0_B1Ki /) ), KeyHash )
+
+   END SUBROUTINE InputCacheKey
+!=======================================================================
+!> This routine looks up the packed data of module ModName with key KeyHash (see InputCacheKey) in the input cache.
+!! The data are returned only if all the files they were read from are unchanged since the entry was written by InputCacheWrite.
+!! A file whose size differs from the one in the entry has changed; a file whose size and modification time are the ones in the
+!! entry has not. Only the contents of the other files are hashed and compared with the entry.
+!! A missing, outdated or unreadable entry is not an error: Found is returned as .false. and the caller parses its input files.
+   SUBROUTINE InputCacheRead ( ModName, KeyHash, ReKiBuf, DbKiBuf, IntKiBuf, Found )
+
+   CHARACTER(*),                INTENT(IN   ) :: ModName                     !< name of the module whose data is cached
+   INTEGER(B8Ki),               INTENT(IN   ) :: KeyHash(2)                  !< key of the cache entry
+   REAL(ReKi),     ALLOCATABLE, INTENT(  OUT) :: ReKiBuf(:)                  !< packed reals of the cached data
+   REAL(DbKi),     ALLOCATABLE, INTENT(  OUT) :: DbKiBuf(:)                  !< packed doubles of the cached data
+   INTEGER(IntKi), ALLOCATABLE, INTENT(  OUT) :: IntKiBuf(:)                 !< packed integers of the cached data
+   LOGICAL,                     INTENT(  OUT) :: Found                       !< whether valid data were found
+
+   CHARACTER(1024)                            :: FileName                    ! name of the cache file
+   CHARACTER(1024)                            :: DepFileName                 ! name of a file the data were read from
+   INTEGER(B4Ki)                              :: Header(4)                   ! kinds of the packed arrays and file format version
+   INTEGER(B4Ki)                              :: ArraySizes(3)               ! sizes of the packed arrays
+   INTEGER(B4Ki)                              :: NumFiles                    ! number of files the data were read from
+   INTEGER(B4Ki)                              :: Trailer                     ! marks a completely written file
+   INTEGER(B8Ki)                              :: FileKeyHash(2)              ! key stored in the cache file
+   INTEGER(B8Ki)                              :: DepFileSize                 ! size of a file the data were read from, when the entry was written
+   INTEGER(B8Ki)                              :: DepModTime                  ! modification time of a file the data were read from, when the entry was written (-1 if unknown)
+   INTEGER(B8Ki)                              :: DepHash(2)                  ! hash of a file the data were read from, when the entry was written
+   INTEGER(B8Ki)                              :: FileSize                    ! current size of a file the data were read from
+   INTEGER(B8Ki)                              :: Hash(2)                     ! current hash of a file the data were read from
+   INTEGER(IntKi)                             :: Un                          ! unit number of the cache file
+   INTEGER(IntKi)                             :: I                           ! generic loop counter
+   INTEGER(IntKi)                             :: IOS                         ! I/O status
+   INTEGER(IntKi)                             :: ErrStat2                    ! local error status
+   CHARACTER(ErrMsgLen)                       :: ErrMsg2                     ! local error message
+   LOGICAL                                    :: Exists                      ! whether the cache file exists
+
+
+   Found = .FALSE.
+   IF ( LEN_TRIM(InputCacheDir) == 0 ) RETURN
+
+   InputCacheMisses = InputCacheMisses + 1
+
+   FileName = InputCacheFileName( ModName, KeyHash )
+   INQUIRE( FILE=TRIM(FileName), EXIST=Exists )
+   IF ( .NOT. Exists ) RETURN
+
+   CALL GetNewUnit( Un, ErrStat2, ErrMsg2 )
+   CALL OpenBInpFile( Un, FileName, ErrStat2, ErrMsg2 )
+   IF ( ErrStat2 >= AbortErrLev ) RETURN
+
+   Found = ReadEntry()
+   CLOSE( Un )
+
+   IF ( Found ) THEN
+      InputCacheMisses = InputCacheMisses - 1
+      InputCacheHits   = InputCacheHits + 1
+   ELSE
+      IF ( ALLOCATED(ReKiBuf)  ) DEALLOCATE( ReKiBuf )
+      IF ( ALLOCATED(DbKiBuf)  ) DEALLOCATE( DbKiBuf )
+      IF ( ALLOCATED(IntKiBuf) ) DEALLOCATE( IntKiBuf )
+   END IF
+
+CONTAINS
+   !...............................................................................................................................
+   !> Reads the entry from the open cache file and returns whether it is valid.
+   LOGICAL FUNCTION ReadEntry()
+
+      ReadEntry = .FALSE.
+
+      READ( Un, IOSTAT=IOS ) Header, FileKeyHash
+      IF ( IOS /= 0 ) RETURN
+      IF ( Header(1) /= ReKi .OR. Header(2) /= DbKi .OR. Header(3) /= IntKi .OR. Header(4) /= InputCacheVersion ) RETURN
+      IF ( ANY( FileKeyHash /= KeyHash ) ) RETURN
+
+         ! Make sure none of the files the data were read from have changed
+
+      READ( Un, IOSTAT=IOS ) NumFiles
+      IF ( IOS /= 0 ) RETURN
+      DO I = 1,NumFiles
+         READ( Un, IOSTAT=IOS ) DepFileName, DepFileSize, DepModTime, DepHash
+         IF ( IOS /= 0 ) RETURN
+         FileSize = -1
+         INQUIRE( FILE=TRIM(DepFileName), SIZE=FileSize, IOSTAT=IOS )
+         IF ( IOS /= 0 .OR. FileSize /= DepFileSize ) RETURN
+         IF ( DepModTime >= 0 ) THEN
+            IF ( FileModTime( DepFileName ) == DepModTime ) CYCLE
+         END IF
+         CALL InputCacheHashFile( DepFileName, FileSize, Hash, ErrStat2, ErrMsg2 )
+         IF ( ErrStat2 >= AbortErrLev .OR. FileSize /= DepFileSize .OR. ANY( Hash /= DepHash ) ) RETURN
+      END DO
+
+      READ( Un, IOSTAT=IOS ) ArraySizes
+      IF ( IOS /= 0 .OR. ANY( ArraySizes < 0 ) ) RETURN
+      ALLOCATE( ReKiBuf(ArraySizes(1)), DbKiBuf(ArraySizes(2)), IntKiBuf(ArraySizes(3)), STAT=IOS )
+      IF ( IOS /= 0 ) RETURN
+      READ( Un, IOSTAT=IOS ) ReKiBuf, DbKiBuf, IntKiBuf, Trailer
+      IF ( IOS /= 0 .OR. Trailer /= InputCacheVersion ) RETURN
+
+      ReadEntry = .TRUE.
+
+   END FUNCTION ReadEntry
+   !...............................................................................................................................
+   END SUBROUTINE InputCacheRead
+!=======================================================================
+!> This routine writes the packed data of module ModName with key KeyHash (see InputCacheKey) to the input cache, together
+!! with the sizes, modification times and hashes of the files in FileList that the data were read from. A failure to write the entry is not an
+!! error; it is counted in nwtc_io::inputcachewriteerrors and the next lookup is a miss.
+!! The entry is written to a new temporary file that is then renamed to the cache file, so that simulations sharing the cache
+!! directory never read (or write into) an entry that another one is still writing.
+   SUBROUTINE InputCacheWrite ( ModName, KeyHash, FileList, ReKiBuf, DbKiBuf, IntKiBuf )
+
+   CHARACTER(*),                INTENT(IN   ) :: ModName                     !< name of the module whose data is cached
+   INTEGER(B8Ki),               INTENT(IN   ) :: KeyHash(2)                  !< key of the cache entry
+   CHARACTER(*),                INTENT(IN   ) :: FileList(:)                 !< names of the files the data were read from
+   REAL(ReKi),     ALLOCATABLE, INTENT(IN   ) :: ReKiBuf(:)                  !< packed reals of the data
+   REAL(DbKi),     ALLOCATABLE, INTENT(IN   ) :: DbKiBuf(:)                  !< packed doubles of the data
+   INTEGER(IntKi), ALLOCATABLE, INTENT(IN   ) :: IntKiBuf(:)                 !< packed integers of the data
+
+   CHARACTER(1024)                            :: FileName                    ! name of the cache file
+   CHARACTER(1024)                            :: DepFileName                 ! name of a file the data were read from
+   INTEGER(B4Ki)                              :: ArraySizes(3)               ! sizes of the packed arrays
+   INTEGER(B8Ki)                              :: FileSize(SIZE(FileList))    ! sizes of the files the data were read from
+   INTEGER(B8Ki)                              :: ModTime(SIZE(FileList))     ! modification times of the files the data were read from
+   INTEGER(B8Ki)                              :: Hash(2,SIZE(FileList))      ! hashes of the files the data were read from
+   INTEGER(B8Ki)                              :: TmpModTime                  ! modification time of the new temporary file
+   INTEGER(IntKi)                             :: Un                          ! unit number of the cache file
+   INTEGER(IntKi)                             :: I                           ! generic loop counter
+   INTEGER(IntKi)                             :: IOS                         ! I/O status
+   INTEGER(IntKi)                             :: ErrStat2                    ! local error status
+   CHARACTER(ErrMsgLen)                       :: ErrMsg2                     ! local error message
+   CHARACTER(1024)                            :: TmpFileName                 ! name of the temporary file the entry is written to
+
+   INTEGER(IntKi), PARAMETER                  :: MaxTmpFiles = 1000          ! number of temporary file names tried before giving up
+
+   INTERFACE
+      FUNCTION C_Rename ( OldName, NewName ) BIND ( C, NAME='rename' )     ! rename() of the C standard library
+         USE, INTRINSIC :: ISO_C_BINDING, ONLY: C_INT, C_CHAR
+         INTEGER(C_INT)                      :: C_Rename
+         CHARACTER(KIND=C_CHAR), INTENT(IN)  :: OldName(*)
+         CHARACTER(KIND=C_CHAR), INTENT(IN)  :: NewName(*)
+      END FUNCTION C_Rename
+   END INTERFACE
+
+
+   IF ( LEN_TRIM(InputCacheDir) == 0 ) RETURN
+
+   DO I = 1,SIZE(FileList)
+      ModTime(I) = FileModTime( FileList(I) )
+      CALL InputCacheHashFile( FileList(I), FileSize(I), Hash(:,I), ErrStat2, ErrMsg2 )
+      IF ( ErrStat2 >= AbortErrLev ) THEN
+         InputCacheWriteErrors = InputCacheWriteErrors + 1
+         RETURN
+      END IF
+   END DO
+
+   ArraySizes = 0
+   IF ( ALLOCATED(ReKiBuf)  ) ArraySizes(1) = SIZE(ReKiBuf)
+   IF ( ALLOCATED(DbKiBuf)  ) ArraySizes(2) = SIZE(DbKiBuf)
+   IF ( ALLOCATED(IntKiBuf) ) ArraySizes(3) = SIZE(IntKiBuf)
+
+   FileName = InputCacheFileName( ModName, KeyHash )
+   CALL GetNewUnit( Un, ErrStat2, ErrMsg2 )
+
+      ! STATUS='NEW' fails if the file exists, so each writer gets a temporary file of its own
+   DO I = 1,MaxTmpFiles
+      TmpFileName = TRIM(FileName)//'.tmp'//TRIM(Num2LStr(I))
+      OPEN( Un, FILE=TRIM(TmpFileName), STATUS='NEW', FORM='UNFORMATTED', ACCESS='STREAM', ACTION='WRITE', IOSTAT=IOS )
+      IF ( IOS == 0 ) EXIT
+   END DO
+   IF ( IOS /= 0 ) THEN
+      InputCacheWriteErrors = InputCacheWriteErrors + 1
+      RETURN
+   END IF
+
+      ! The modification times have a resolution of a second. A file modified in the second it was hashed in (no later than the
+      ! temporary file was created) could change again without changing its modification time, so its contents are always checked.
+   TmpModTime = FileModTime( TmpFileName )
+   DO I = 1,SIZE(FileList)
+      IF ( ModTime(I) >= TmpModTime .OR. TmpModTime < 0 ) ModTime(I) = -1
+   END DO
+
+   WRITE( Un, IOSTAT=IOS ) INT(ReKi,B4Ki), INT(DbKi,B4Ki), INT(IntKi,B4Ki), InputCacheVersion, KeyHash
+   IF ( IOS == 0 ) WRITE( Un, IOSTAT=IOS ) INT(SIZE(FileList),B4Ki)
+   DO I = 1,SIZE(FileList)
+      DepFileName = FileList(I)
+      IF ( IOS == 0 ) WRITE( Un, IOSTAT=IOS ) DepFileName, FileSize(I), ModTime(I), Hash(:,I)
+   END DO
+   IF ( IOS == 0 ) WRITE( Un, IOSTAT=IOS ) ArraySizes
+   IF ( IOS == 0 .AND. ArraySizes(1) > 0 ) WRITE( Un, IOSTAT=IOS ) ReKiBuf
+   IF ( IOS == 0 .AND. ArraySizes(2) > 0 ) WRITE( Un, IOSTAT=IOS ) DbKiBuf
+   IF ( IOS == 0 .AND. ArraySizes(3) > 0 ) WRITE( Un, IOSTAT=IOS ) IntKiBuf
+   IF ( IOS == 0 ) WRITE( Un, IOSTAT=IOS ) InputCacheVersion             ! trailer: a file without it was not completely written
+
+   IF ( IOS /= 0 ) THEN
+      InputCacheWriteErrors = InputCacheWriteErrors + 1
+      CLOSE( Un, STATUS='DELETE' )
+      RETURN
+   END IF
+   CLOSE( Un, IOSTAT=IOS )
+
+      ! Move the complete entry into place. On Windows, rename() fails if the cache file exists, so remove it and try again.
+   IF ( IOS == 0 ) IOS = C_Rename( TRIM(TmpFileName)//C_NULL_CHAR, TRIM(FileName)//C_NULL_CHAR )
+   IF ( IOS /= 0 ) THEN
+      OPEN( Un, FILE=TRIM(FileName), STATUS='OLD', IOSTAT=IOS )
+      IF ( IOS == 0 ) CLOSE( Un, STATUS='DELETE' )
+      IOS = C_Rename( TRIM(TmpFileName)//C_NULL_CHAR, TRIM(FileName)//C_NULL_CHAR )
+   END IF
+   IF ( IOS /= 0 ) THEN
+      InputCacheWriteErrors = InputCacheWriteErrors + 1
+      OPEN( Un, FILE=TRIM(TmpFileName), STATUS='OLD', IOSTAT=IOS )
+      IF ( IOS == 0 ) CLOSE( Un, STATUS='DELETE' )
+   END IF
+
+   END SUBROUTINE InputCacheWrite
+!=======================================================================
 !> This routine converts an ASCII array of integers into an equivalent string
 !! (character array). This routine is the inverse of the Str2IntAry() (nwtc_io::str2intary) routine.
    SUBROUTINE IntAry2Str( IntAry, Str, ErrStat, ErrMsg )
@@ -5899,14 +5899,24 @@ end function Rad2M180to180Deg
    REAL(DbKi)                          :: SQRT1SqrdSum                                    ! = SQRT( 1.0 + Theta1^2 + Theta2^2 + Theta3^2 )
 
    LOGICAL,    SAVE                    :: FrstWarn  = .TRUE.                              ! When .TRUE., indicates that we're on the first warning.
+   LOGICAL                             :: Warn                                            ! When .TRUE., this call displays the warning.
 
 
    ErrStat = ErrID_None
    ErrMsg  = ''
 
-      ! Display a warning message if at least one angle gets too large in magnitude:
+      ! Display a warning message if at least one angle gets too large in magnitude.
+      ! FrstWarn is shared by all threads, so only one of them may test and clear it:
 
-   IF ( ( ( ABS(Theta1) > LrgAngle ) .OR. ( ABS(Theta2) > LrgAngle ) .OR. ( ABS(Theta3) > LrgAngle ) ) .AND. FrstWarn )  THEN
+   Warn = .FALSE.
+   IF ( ( ABS(Theta1) > LrgAngle ) .OR. ( ABS(Theta2) > LrgAngle ) .OR. ( ABS(Theta3) > LrgAngle ) )  THEN
+      !$OMP CRITICAL(SmllRotTrans_FrstWarn)
+      Warn     = FrstWarn
+      FrstWarn = .FALSE.   ! Don't enter here again!
+      !$OMP END CRITICAL(SmllRotTrans_FrstWarn)
+   END IF
+
+   IF ( Warn )  THEN
 
       ErrStat= ErrID_Severe
       ErrMsg = 'Small angle assumption violated in SUBROUTINE SmllRotTrans() due to a large '//TRIM(RotationType)//'. '// &
@@ -5918,8 +5928,6 @@ end function Rad2M180to180Deg
 
       !CALL ProgWarn( TRIM(ErrMsg) )
 
-      FrstWarn = .FALSE.   ! Don't enter here again!
-
    ENDIF
 
 
@@ -5994,14 +6002,24 @@ end function Rad2M180to180Deg
    REAL(DbKi)                          :: SQRT1SqrdSum                                    ! = SQRT( 1.0 + Theta1^2 + Theta2^2 + Theta3^2 )
 
    LOGICAL,    SAVE                    :: FrstWarn  = .TRUE.                              ! When .TRUE., indicates that we're on the first warning.
+   LOGICAL                             :: Warn                                            ! When .TRUE., this call displays the warning.
 
 
    ErrStat = ErrID_None
    ErrMsg  = ''
 
-      ! Display a warning message if at least one angle gets too large in magnitude:
+      ! Display a warning message if at least one angle gets too large in magnitude.
+      ! FrstWarn is shared by all threads, so only one of them may test and clear it:
+
+   Warn = .FALSE.
+   IF ( ( ABS(Theta1) > LrgAngle ) .OR. ( ABS(Theta2) > LrgAngle ) .OR. ( ABS(Theta3) > LrgAngle ) )  THEN
+      !$OMP CRITICAL(SmllRotTrans_FrstWarn)
+      Warn     = FrstWarn
+      FrstWarn = .FALSE.   ! Don't enter here again!
+      !$OMP END CRITICAL(SmllRotTrans_FrstWarn)
+   END IF
 
-   IF ( ( ( ABS(Theta1) > LrgAngle ) .OR. ( ABS(Theta2) > LrgAngle ) .OR. ( ABS(Theta3) > LrgAngle ) ) .AND. FrstWarn )  THEN
+   IF ( Warn )  THEN
 
       ErrStat= ErrID_Severe
       ErrMsg = 'Small angle assumption violated in SUBROUTINE SmllRotTrans() due to a large '//TRIM(RotationType)//'. '// &
@@ -6013,8 +6031,6 @@ end function Rad2M180to180Deg
 
       !CALL ProgWarn( TRIM(ErrMsg) )
 
-      FrstWarn = .FALSE.   ! Don't enter here again!
-
    ENDIF
 
 
@@ -6126,14 +6142,24 @@ end function Rad2M180to180Deg
    REAL(ReKi)                          :: SQRT1SqrdSum                                    ! = SQRT( 1.0 + Theta1^2 + Theta2^2 + Theta3^2 )
 
    LOGICAL,    SAVE                    :: FrstWarn  = .TRUE.                              ! When .TRUE., indicates that we're on the first warning.
+   LOGICAL                             :: Warn                                            ! When .TRUE., this call displays the warning.
 
 
    ErrStat = ErrID_None
    ErrMsg  = ''
 
-      ! Display a warning message if at least one angle gets too large in magnitude:
+      ! Display a warning message if at least one angle gets too large in magnitude.
+      ! FrstWarn is shared by all threads, so only one of them may test and clear it:
 
-   IF ( ( ( ABS(Theta1) > LrgAngle ) .OR. ( ABS(Theta2) > LrgAngle ) .OR. ( ABS(Theta3) > LrgAngle ) ) .AND. FrstWarn )  THEN
+   Warn = .FALSE.
+   IF ( ( ABS(Theta1) > LrgAngle ) .OR. ( ABS(Theta2) > LrgAngle ) .OR. ( ABS(Theta3) > LrgAngle ) )  THEN
+      !$OMP CRITICAL(SmllRotTrans_FrstWarn)
+      Warn     = FrstWarn
+      FrstWarn = .FALSE.   ! Don't enter here again!
+      !$OMP END CRITICAL(SmllRotTrans_FrstWarn)
+   END IF
+
+   IF ( Warn )  THEN
 
       ErrStat= ErrID_Severe
       ErrMsg = 'Small angle assumption violated in SUBROUTINE SmllRotTrans() due to a large '//TRIM(RotationType)//'. '// &
@@ -6145,8 +6171,6 @@ end function Rad2M180to180Deg
 
       !CALL ProgWarn( TRIM(ErrMsg) )
 
-      FrstWarn = .FALSE.   ! Don't enter here again!
-
    ENDIF
 
 
@@ -7108,7 +7132,7 @@ end function Rad2M180to180Deg
                                                                      
          ! local variables                                              
        INTEGER(IntKi), parameter           :: order = 1                 ! order of polynomial fit (max 2)
-       REAL(DbKi)                          :: t(SIZE(tin))              ! Times associated with the inputs
+       REAL(DbKi)                          :: t(order+1)                ! Times associated with the inputs
        REAL(DbKi)                          :: t_out                     ! Time to which to be extrap/interpd
                                                                      
        REAL(SiKi)                          :: Angle2_mod
@@ -7152,7 +7176,7 @@ end function Rad2M180to180Deg
          
          ! local variables                                              
        INTEGER(IntKi), parameter           :: order = 1                 ! order of polynomial fit (max 2)
-       REAL(DbKi)                          :: t(SIZE(tin))              ! Times associated with the inputs
+       REAL(DbKi)                          :: t(order+1)                ! Times associated with the inputs
        REAL(DbKi)                          :: t_out                     ! Time to which to be extrap/interpd
                                                                      
        REAL(R8Ki)                          :: Angle2_mod
@@ -7195,7 +7219,7 @@ end function Rad2M180to180Deg
 
        ! local variables                                              
        INTEGER(IntKi), parameter           :: order = 1                 ! order of polynomial fit (max 2)
-       REAL(DbKi)                          :: t(SIZE(tin))              ! Times associated with the inputs
+       REAL(DbKi)                          :: t(order+1)                ! Times associated with the inputs
        REAL(DbKi)                          :: t_out                     ! Time to which to be extrap/interpd
                                                                      
        REAL(QuKi)                          :: Angle2_mod
@@ -7238,7 +7262,7 @@ end function Rad2M180to180Deg
                                                                      
          ! local variables                                              
        INTEGER(IntKi), parameter           :: order = 1                 ! order of polynomial fit (max 2)
-       REAL(ReKi)                          :: t(SIZE(tin))              ! Times associated with the inputs
+       REAL(ReKi)                          :: t(order+1)                ! Times associated with the inputs
        REAL(ReKi)                          :: t_out                     ! Time to which to be extrap/interpd
                                                                      
        REAL(SiKi)                          :: Angle2_mod
@@ -7282,7 +7306,7 @@ end function Rad2M180to180Deg
          
          ! local variables                                              
        INTEGER(IntKi), parameter           :: order = 1                 ! order of polynomial fit (max 2)
-       REAL(ReKi)                          :: t(SIZE(tin))              ! Times associated with the inputs
+       REAL(ReKi)                          :: t(order+1)                ! Times associated with the inputs
        REAL(ReKi)                          :: t_out                     ! Time to which to be extrap/interpd
                                                                      
        REAL(R8Ki)                          :: Angle2_mod
@@ -7325,7 +7349,7 @@ end function Rad2M180to180Deg
 
        ! local variables                                              
        INTEGER(IntKi), parameter           :: order = 1                 ! order of polynomial fit (max 2)
-       REAL(ReKi)                          :: t(SIZE(tin))              ! Times associated with the inputs
+       REAL(ReKi)                          :: t(order+1)                ! Times associated with the inputs
        REAL(ReKi)                          :: t_out                     ! Time to which to be extrap/interpd
                                                                      
        REAL(QuKi)                          :: Angle2_mod
@@ -7369,7 +7393,7 @@ end function Rad2M180to180Deg
                                                                      
          ! local variables                                              
        INTEGER(IntKi), parameter           :: order = 2                 ! order of polynomial fit (max 2)
-       REAL(DbKi)                          :: t(SIZE(tin))              ! Times associated with the inputs
+       REAL(DbKi)                          :: t(order+1)                ! Times associated with the inputs
        REAL(DbKi)                          :: t_out                     ! Time to which to be extrap/interpd
                                                                      
        REAL(DbKi)                          :: scaleFactor               ! temporary for extrapolation/interpolation
@@ -7432,7 +7456,7 @@ end function Rad2M180to180Deg
                                                                      
          ! local variables                                              
        INTEGER(IntKi), parameter           :: order = 2                 ! order of polynomial fit (max 2)
-       REAL(DbKi)                          :: t(SIZE(tin))              ! Times associated with the inputs
+       REAL(DbKi)                          :: t(order+1)                ! Times associated with the inputs
        REAL(DbKi)                          :: t_out                     ! Time to which to be extrap/interpd
                                                                      
        REAL(DbKi)                          :: scaleFactor               ! temporary for extrapolation/interpolation
@@ -7494,7 +7518,7 @@ end function Rad2M180to180Deg
                                                                      
          ! local variables                                              
        INTEGER(IntKi), parameter           :: order = 2                 ! order of polynomial fit (max 2)
-       REAL(DbKi)                          :: t(SIZE(tin))              ! Times associated with the inputs
+       REAL(DbKi)                          :: t(order+1)                ! Times associated with the inputs
        REAL(DbKi)                          :: t_out                     ! Time to which to be extrap/interpd
                                                                      
        REAL(DbKi)                          :: scaleFactor               ! temporary for extrapolation/interpolation
@@ -7556,7 +7580,7 @@ end function Rad2M180to180Deg
                                                                      
          ! local variables                                              
        INTEGER(IntKi), parameter           :: order = 2                 ! order of polynomial fit (max 2)
-       REAL(ReKi)                          :: t(SIZE(tin))              ! Times associated with the inputs
+       REAL(ReKi)                          :: t(order+1)                ! Times associated with the inputs
        REAL(ReKi)                          :: t_out                     ! Time to which to be extrap/interpd
                                                                      
        REAL(DbKi)                          :: scaleFactor               ! temporary for extrapolation/interpolation
@@ -7619,7 +7643,7 @@ end function Rad2M180to180Deg
                                                                      
          ! local variables                                              
        INTEGER(IntKi), parameter           :: order = 2                 ! order of polynomial fit (max 2)
-       REAL(ReKi)                          :: t(SIZE(tin))              ! Times associated with the inputs
+       REAL(ReKi)                          :: t(order+1)                ! Times associated with the inputs
        REAL(ReKi)                          :: t_out                     ! Time to which to be extrap/interpd
                                                                      
        REAL(DbKi)                          :: scaleFactor               ! temporary for extrapolation/interpolation
@@ -7681,7 +7705,7 @@ end function Rad2M180to180Deg
                                                                      
          ! local variables                                              
        INTEGER(IntKi), parameter           :: order = 2                 ! order of polynomial fit (max 2)
-       REAL(ReKi)                          :: t(SIZE(tin))              ! Times associated with the inputs
+       REAL(ReKi)                          :: t(order+1)                ! Times associated with the inputs
        REAL(ReKi)                          :: t_out                     ! Time to which to be extrap/interpd
                                                                      
        REAL(DbKi)                          :: scaleFactor               ! temporary for extrapolation/interpolation
@@ -33,6 +33,7 @@ MODULE SysSubs
    ! It contains the following routines:
 
    !     FUNCTION    FileSize( Unit )                                         ! Returns the size (in bytes) of an open file.
+   !     FUNCTION    FileModTime( FileName )                                  ! Returns the modification time (in seconds since 1970) of a file.
    !     SUBROUTINE  FlushOut ( Unit )
    !     FUNCTION    NWTC_ERF( x )
    !     FUNCTION    NWTC_gamma( x )
@@ -127,6 +128,29 @@ CONTAINS
 
    RETURN
    END FUNCTION FileSize ! ( Unit )
+!=======================================================================
+   FUNCTION FileModTime( FileName )
+
+   ! This function calls the portability routine, STAT, to obtain the time of the last modification (in seconds
+   ! since 1970) of a file or returns -1 on error.
+
+   !USE IFPORT
+
+   INTEGER(B8Ki)                             :: FileModTime                   ! The modification time of the file to be returned.
+   CHARACTER(*), INTENT(IN)                  :: FileName                      ! The name of the file.
+   INTEGER                                   :: StatArray(12)                 ! An array returned by STAT that includes the modification time.
+   INTEGER                                   :: Status                        ! The status returned by STAT.
+
+   Status = STAT( TRIM( FileName ), StatArray )
+
+   IF ( Status /= 0 ) THEN
+      FileModTime = -1
+   ELSE
+      FileModTime = StatArray(10)
+   END IF
+
+   RETURN
+   END FUNCTION FileModTime ! ( FileName )
 !=======================================================================
    SUBROUTINE FlushOut ( Unit )
 
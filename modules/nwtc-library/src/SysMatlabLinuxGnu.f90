@@ -26,6 +26,7 @@ MODULE SysSubs
    ! SysMatlabGnuLinux.f90 is specifically for the GNU Fortran (gfortran) compiler on Linux and macOS.
    ! It contains the following routines:
    !     FUNCTION    FileSize( Unit )                                         ! Returns the size (in bytes) of an open file.
+   !     FUNCTION    FileModTime( FileName )                                  ! Returns the modification time (in seconds since 1970) of a file.
    !     FUNCTION    Is_NaN( DblNum )                                         ! Please use IEEE_IS_NAN() instead
    !     FUNCTION    NWTC_ERF( x )
    !     FUNCTION    NWTC_gamma( x )                                          ! Returns the gamma value of its argument.   
@@ -94,6 +95,27 @@ FUNCTION FileSize( Unit )
    RETURN
 END FUNCTION FileSize ! ( Unit )
 !=======================================================================
+FUNCTION FileModTime( FileName )
+
+   ! This function calls the portability routine, STAT, to obtain the time of the last modification (in seconds
+   ! since 1970) of a file or returns -1 on error.
+
+   INTEGER(B8Ki)                             :: FileModTime                   ! The modification time of the file to be returned.
+   CHARACTER(*), INTENT(IN)                  :: FileName                      ! The name of the file.
+   INTEGER(4)                                :: StatArray(13)                 ! An array returned by STAT that includes the modification time.
+   INTEGER(4)                                :: Status                        ! The status returned by STAT.
+
+   Status = STAT( TRIM( FileName ), StatArray )
+
+   IF ( Status /= 0 ) THEN
+      FileModTime = -1
+   ELSE
+      FileModTime = StatArray(10)
+   END IF
+
+   RETURN
+END FUNCTION FileModTime ! ( FileName )
+!=======================================================================
 FUNCTION Is_NaN( DblNum )
 
    ! This routine determines if a REAL(DbKi) variable holds a proper number.
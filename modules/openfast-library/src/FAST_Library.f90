@@ -27,10 +27,26 @@ MODULE FAST_Data
    
    
       ! Global (static) data:
+      ! n_t_global, ErrStat and ErrMsg are shared by all turbines, so the routines that use them (e.g. FAST_Sizes, FAST_Start,
+      ! FAST_Update, FAST_End and the checkpoint routines) must not be called concurrently. FAST_UpdateTurbine and
+      ! FAST_OpFM_StepTurbine only use the data of their turbine and local error variables.
    TYPE(FAST_TurbineType), ALLOCATABLE   :: Turbine(:)               ! Data for each turbine
    INTEGER(IntKi)                        :: n_t_global               ! simulation time step, loop counter for global (FAST) simulation
    INTEGER(IntKi)                        :: ErrStat                  ! Error status
    CHARACTER(IntfStrLen-1)               :: ErrMsg                   ! Error message  (this needs to be static so that it will print in Matlab's mex library)
+
+   TYPE :: PackedCheckpointType
+      INTEGER(B1Ki), ALLOCATABLE         :: ChkpBuf(:)               ! Contents of the checkpoint file of a turbine
+   END TYPE PackedCheckpointType
+   TYPE(PackedCheckpointType), ALLOCATABLE :: PackedCheckpoint(:)    ! Checkpoints packed by FAST_PackCheckpoint that have not been copied out yet
+   INTEGER(IntKi), ALLOCATABLE           :: n_t_turbine(:)           ! time step of each turbine advanced with FAST_UpdateTurbine
+
+   TYPE :: OutputBufferType
+      REAL(ReKi), ALLOCATABLE            :: Outputs(:)               ! WriteOutput values of all (or the subscribed) channels at the current time step (without time)
+      INTEGER(IntKi), ALLOCATABLE        :: ChannelIndx(:)           ! Indices (without time) of the channels subscribed with FAST_SetOutputChannels, in ascending order
+      INTEGER(IntKi), ALLOCATABLE        :: ChannelPos(:)            ! Position in Outputs of each channel in ChannelIndx
+   END TYPE OutputBufferType
+   TYPE(OutputBufferType), ALLOCATABLE   :: OutputBuffer(:)          ! Outputs of each turbine, kept between calls so that time steps need no temporary arrays
    
 contains
 !================================================================================================================================== 
@@ -54,6 +70,10 @@ subroutine FAST_AllocateTurbines(nTurbines, ErrStat_c, ErrMsg_c) BIND (C, NAME='
    end if
 
    allocate(Turbine(0:NumTurbines-1),Stat=ErrStat) !Allocate in C style because most of the other Turbine properties from the input file are in C style inside the C++ driver
+   if (ErrStat == 0) allocate(PackedCheckpoint(0:NumTurbines-1),Stat=ErrStat)
+   if (ErrStat == 0) allocate(n_t_turbine(0:NumTurbines-1),Stat=ErrStat)
+   if (ErrStat == 0) n_t_turbine = 0
+   if (ErrStat == 0) allocate(OutputBuffer(0:NumTurbines-1),Stat=ErrStat)
 
    if (ErrStat /= 0) then
       ErrStat_c = ErrID_Fatal
@@ -79,10 +99,105 @@ subroutine FAST_DeallocateTurbines(ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_Deal
       deallocate(Turbine)
    end if
 
+   if (Allocated(PackedCheckpoint)) then
+      deallocate(PackedCheckpoint)
+   end if
+
+   if (Allocated(n_t_turbine)) then
+      deallocate(n_t_turbine)
+   end if
+
+   if (Allocated(OutputBuffer)) then
+      deallocate(OutputBuffer)
+   end if
+
    ErrStat_c = ErrID_None
    ErrMsg_c = C_NULL_CHAR
 end subroutine
 !==================================================================================================================================
+!> This routine sets the directory of the input cache, where modules store the data parsed from their input files so that later
+!! initializations (by FAST_Sizes) with unchanged input files can skip parsing them. A blank directory disables the cache. 
+subroutine FAST_SetInputCache(CacheDir_c, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_SetInputCache')
+   IMPLICIT NONE
+#ifndef IMPLICIT_DLLEXPORT
+!DEC$ ATTRIBUTES DLLEXPORT :: FAST_SetInputCache
+!GCC$ ATTRIBUTES DLLEXPORT :: FAST_SetInputCache
+#endif
+   CHARACTER(KIND=C_CHAR), INTENT(IN   ) :: CacheDir_c(IntfStrLen)
+   INTEGER(C_INT),         INTENT(  OUT) :: ErrStat_c
+   CHARACTER(KIND=C_CHAR), INTENT(  OUT) :: ErrMsg_c(IntfStrLen)
+
+   ! local
+   CHARACTER(IntfStrLen)               :: CacheDir
+   INTEGER                             :: I
+   INTEGER(IntKi)                      :: Un
+   INTEGER(IntKi)                      :: IOS
+   
+      ! transfer the character array from C to a Fortran string:   
+   CacheDir = TRANSFER( CacheDir_c, CacheDir )
+   I = INDEX(CacheDir,C_NULL_CHAR) - 1            ! if this has a c null character at the end...
+   IF ( I >= 0 ) CacheDir = CacheDir(1:I)         ! remove it
+
+   ErrStat_c = ErrID_None
+   ErrMsg_c  = C_NULL_CHAR
+   InputCacheDir = ''
+   IF ( LEN_TRIM(CacheDir) == 0 ) RETURN
+
+      ! make sure we can write to the cache directory so that problems are reported here instead of silently missing the cache
+   CALL GetNewUnit( Un, ErrStat, ErrMsg )
+   OPEN( Un, FILE=TRIM(CacheDir)//PathSep//'FAST_InputCache.tmp', STATUS='REPLACE', FORM='UNFORMATTED', ACCESS='STREAM', ACTION='WRITE', IOSTAT=IOS )
+   IF ( IOS /= 0 ) THEN
+      ErrStat_c = ErrID_Fatal
+      ErrMsg    = 'FAST_SetInputCache:Cannot write to the input cache directory "'//TRIM(CacheDir)//'".'
+      ErrMsg    = TRIM(ErrMsg)//C_NULL_CHAR
+      ErrMsg_c  = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+      RETURN
+   END IF
+   CLOSE( Un, STATUS='DELETE' )
+
+   InputCacheDir = CacheDir
+
+end subroutine FAST_SetInputCache
+!==================================================================================================================================
+!> This routine returns whether the library was built so that different turbines can be advanced concurrently from different
+!! threads (e.g. with FAST_UpdateTurbine). This requires the modules to keep all of their local variables on the stack, which
+!! the compilers only guarantee in OpenMP builds; otherwise large and initialized local variables are static.
+!! It does not mean that every turbine configuration is reentrant: some optional routines keep their states in SAVE variables
+!! shared by all turbines. Check each turbine with FAST_IsTurbineReentrant after FAST_Sizes.
+subroutine FAST_IsReentrant(Reentrant_c) BIND (C, NAME='FAST_IsReentrant')
+   IMPLICIT NONE
+#ifndef IMPLICIT_DLLEXPORT
+!DEC$ ATTRIBUTES DLLEXPORT :: FAST_IsReentrant
+!GCC$ ATTRIBUTES DLLEXPORT :: FAST_IsReentrant
+#endif
+   LOGICAL(C_BOOL),        INTENT(  OUT) :: Reentrant_c
+
+   Reentrant_c = .FALSE.
+!$ Reentrant_c = .TRUE.
+
+end subroutine FAST_IsReentrant
+!==================================================================================================================================
+!> This routine returns whether turbine iTurb can be advanced concurrently with other turbines from different threads. It is true
+!! for the configurations that were audited for shared data in a reentrant build (see FAST_IsReentrant). It is false if ServoDyn
+!! uses a user-defined control routine (control mode 3, e.g. UserVSCont_KP and PitchCntrl_ACH), which keeps its states in SAVE
+!! variables. Note that the turbines load a Bladed-style controller DLL only once per file name, so turbines advanced concurrently
+!! need their own copies of DLLs that keep static states.
+subroutine FAST_IsTurbineReentrant(iTurb, Reentrant_c) BIND (C, NAME='FAST_IsTurbineReentrant')
+   IMPLICIT NONE
+#ifndef IMPLICIT_DLLEXPORT
+!DEC$ ATTRIBUTES DLLEXPORT :: FAST_IsTurbineReentrant
+!GCC$ ATTRIBUTES DLLEXPORT :: FAST_IsTurbineReentrant
+#endif
+   INTEGER(C_INT),         INTENT(IN   ) :: iTurb            ! Turbine number 
+   LOGICAL(C_BOOL),        INTENT(  OUT) :: Reentrant_c
+
+   call FAST_IsReentrant(Reentrant_c)
+   if (Turbine(iTurb)%p_FAST%CompServo == Module_SrvD) then
+      Reentrant_c = Reentrant_c .AND. SrvD_IsReentrant(Turbine(iTurb)%SrvD%p)
+   end if
+
+end subroutine FAST_IsTurbineReentrant
+!==================================================================================================================================
 subroutine FAST_Sizes(iTurb, InputFileName_c, AbortErrLev_c, NumOuts_c, dt_c, dt_out_c, tmax_c, ErrStat_c, ErrMsg_c, ChannelNames_c, TMax, InitInpAry) BIND (C, NAME='FAST_Sizes')
    IMPLICIT NONE 
 #ifndef IMPLICIT_DLLEXPORT
@@ -179,6 +294,73 @@ subroutine FAST_Sizes(iTurb, InputFileName_c, AbortErrLev_c, NumOuts_c, dt_c, dt
       
 end subroutine FAST_Sizes
 !==================================================================================================================================
+!> This routine subscribes to a subset of the output channels of turbine iTurb, so that FAST_Start and FAST_Update return only the
+!! time and those channels in OutputAry, in the order given here. ChannelIndx_c holds the indices of the channels in the list of 
+!! channel names returned by FAST_Sizes, where index 1 is the time (which is always returned first and can't be subscribed). 
+!! NumChannels_c = 0 returns all channels again. The channels written to the FAST output files are not affected.
+subroutine FAST_SetOutputChannels(iTurb, NumChannels_c, ChannelIndx_c, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_SetOutputChannels')
+   IMPLICIT NONE 
+#ifndef IMPLICIT_DLLEXPORT
+!DEC$ ATTRIBUTES DLLEXPORT :: FAST_SetOutputChannels
+!GCC$ ATTRIBUTES DLLEXPORT :: FAST_SetOutputChannels
+#endif
+   INTEGER(C_INT),         INTENT(IN   ) :: iTurb            ! Turbine number 
+   INTEGER(C_INT),         INTENT(IN   ) :: NumChannels_c    ! Number of channels to subscribe to
+   INTEGER(C_INT),         INTENT(IN   ) :: ChannelIndx_c(*) ! Indices of the channels to subscribe to
+   INTEGER(C_INT),         INTENT(  OUT) :: ErrStat_c      
+   CHARACTER(KIND=C_CHAR), INTENT(  OUT) :: ErrMsg_c(IntfStrLen) 
+   
+   ! local
+   INTEGER(IntKi)                        :: i, j
+   INTEGER(IntKi)                        :: Indx, Pos
+   INTEGER(IntKi)                        :: ErrStat2
+   CHARACTER(ErrMsgLen)                  :: ErrMsg2
+   
+   ErrStat_c = ErrID_None
+   ErrMsg    = " "
+   
+   IF ( ALLOCATED(OutputBuffer(iTurb)%ChannelIndx) ) DEALLOCATE(OutputBuffer(iTurb)%ChannelIndx)
+   IF ( ALLOCATED(OutputBuffer(iTurb)%ChannelPos ) ) DEALLOCATE(OutputBuffer(iTurb)%ChannelPos )
+   IF ( ALLOCATED(OutputBuffer(iTurb)%Outputs    ) ) DEALLOCATE(OutputBuffer(iTurb)%Outputs    )
+   
+   IF ( NumChannels_c > 0 ) THEN
+      IF ( .NOT. ALLOCATED(Turbine(iTurb)%y_FAST%ChannelNames) ) THEN
+         ErrStat_c = ErrID_Fatal
+         ErrMsg    = "FAST_SetOutputChannels: FAST_Sizes must be called before subscribing to output channels."
+      ELSEIF ( ANY( ChannelIndx_c(1:NumChannels_c) < 2 .OR. ChannelIndx_c(1:NumChannels_c) > SIZE(Turbine(iTurb)%y_FAST%ChannelNames) ) ) THEN
+         ErrStat_c = ErrID_Fatal
+         ErrMsg    = "FAST_SetOutputChannels: channel indices must be between 2 and "//TRIM(Num2LStr(SIZE(Turbine(iTurb)%y_FAST%ChannelNames)))//"."
+      ELSE
+         CALL AllocAry( OutputBuffer(iTurb)%ChannelIndx, NumChannels_c, 'ChannelIndx', ErrStat2, ErrMsg2 )
+         IF ( ErrStat2 < AbortErrLev ) CALL AllocAry( OutputBuffer(iTurb)%ChannelPos, NumChannels_c, 'ChannelPos', ErrStat2, ErrMsg2 )
+         IF ( ErrStat2 >= AbortErrLev ) THEN
+            ErrStat_c = ErrStat2
+            ErrMsg    = "FAST_SetOutputChannels: "//TRIM(ErrMsg2)
+            IF ( ALLOCATED(OutputBuffer(iTurb)%ChannelIndx) ) DEALLOCATE(OutputBuffer(iTurb)%ChannelIndx)
+         ELSE
+               ! sort the channels by index (without time), so that FillOutputAry can pick them in one pass over the modules
+            DO i = 1, NumChannels_c
+               Indx = ChannelIndx_c(i) - 1
+               Pos  = i
+               j = i - 1
+               DO WHILE ( j >= 1 )
+                  IF ( OutputBuffer(iTurb)%ChannelIndx(j) <= Indx ) EXIT
+                  OutputBuffer(iTurb)%ChannelIndx(j+1) = OutputBuffer(iTurb)%ChannelIndx(j)
+                  OutputBuffer(iTurb)%ChannelPos(j+1)  = OutputBuffer(iTurb)%ChannelPos(j)
+                  j = j - 1
+               END DO
+               OutputBuffer(iTurb)%ChannelIndx(j+1) = Indx
+               OutputBuffer(iTurb)%ChannelPos(j+1)  = Pos
+            END DO
+         END IF
+      END IF
+   END IF
+   
+   ErrMsg    = TRIM(ErrMsg)//C_NULL_CHAR
+   ErrMsg_c  = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+   
+end subroutine FAST_SetOutputChannels
+!==================================================================================================================================
 subroutine FAST_Start(iTurb, NumInputs_c, NumOutputs_c, InputAry, OutputAry, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_Start')
    IMPLICIT NONE 
 #ifndef IMPLICIT_DLLEXPORT
@@ -197,13 +379,13 @@ subroutine FAST_Start(iTurb, NumInputs_c, NumOutputs_c, InputAry, OutputAry, Err
    ! local
    CHARACTER(IntfStrLen)                 :: InputFileName   
    INTEGER                               :: i
-   REAL(ReKi)                            :: Outputs(NumOutputs_c-1)
      
    INTEGER(IntKi)                        :: ErrStat2                                ! Error status
    CHARACTER(IntfStrLen-1)               :: ErrMsg2                                 ! Error message  (this needs to be static so that it will print in Matlab's mex library)
    
       ! initialize variables:   
    n_t_global = 0
+   n_t_turbine(iTurb) = 0
 
 
    !...............................................................................................................................
@@ -213,14 +395,16 @@ subroutine FAST_Start(iTurb, NumInputs_c, NumOutputs_c, InputAry, OutputAry, Err
    
    if (ErrStat <= AbortErrLev) then
          ! return outputs here, too
-      IF(NumOutputs_c /= SIZE(Turbine(iTurb)%y_FAST%ChannelNames) ) THEN
+      IF(NumOutputs_c /= FAST_NumOutputs(iTurb) ) THEN
          ErrStat = ErrID_Fatal
          ErrMsg  = trim(ErrMsg)//NewLine//"FAST_Start:size of NumOutputs is invalid."
       ELSE
       
-         CALL FillOutputAry_T(Turbine(iTurb), Outputs)   
-         OutputAry(1)              = Turbine(iTurb)%m_FAST%t_global 
-         OutputAry(2:NumOutputs_c) = Outputs 
+         CALL FAST_GetOutputAry(iTurb, NumOutputs_c, OutputAry, ErrStat2, ErrMsg2)
+         if (ErrStat2 /= ErrID_None) then
+            ErrStat = max(ErrStat,ErrStat2)
+            ErrMsg = TRIM(ErrMsg)//NewLine//TRIM(ErrMsg2)
+         end if
 
          CALL FAST_Linearize_T(t_initial, 0, Turbine(iTurb), ErrStat2, ErrMsg2)
          if (ErrStat2 /= ErrID_None) then
@@ -256,73 +440,165 @@ subroutine FAST_Update(iTurb, NumInputs_c, NumOutputs_c, InputAry, OutputAry, En
    REAL(C_DOUBLE),         INTENT(  OUT) :: OutputAry(NumOutputs_c)
    LOGICAL(C_BOOL),        INTENT(  OUT) :: EndSimulationEarly
    INTEGER(C_INT),         INTENT(  OUT) :: ErrStat_c      
+   CHARACTER(KIND=C_CHAR), INTENT(  OUT) :: ErrMsg_c(IntfStrLen)      
+
+   CALL FAST_UpdateStep(iTurb, n_t_global, 'FAST_Update', NumInputs_c, NumOutputs_c, InputAry, OutputAry, EndSimulationEarly, ErrStat_c, ErrMsg_c)
+
+end subroutine FAST_Update 
+!==================================================================================================================================
+!> This routine is the same as FAST_Update, but it advances turbine iTurb from its own time step n_t_turbine(iTurb). Turbines started
+!! with FAST_Start can thus be advanced independently of each other, and concurrently.
+subroutine FAST_UpdateTurbine(iTurb, NumInputs_c, NumOutputs_c, InputAry, OutputAry, EndSimulationEarly, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_UpdateTurbine')
+   IMPLICIT NONE
+#ifndef IMPLICIT_DLLEXPORT
+!DEC$ ATTRIBUTES DLLEXPORT :: FAST_UpdateTurbine
+!GCC$ ATTRIBUTES DLLEXPORT :: FAST_UpdateTurbine
+#endif
+   INTEGER(C_INT),         INTENT(IN   ) :: iTurb            ! Turbine number 
+   INTEGER(C_INT),         INTENT(IN   ) :: NumInputs_c      
+   INTEGER(C_INT),         INTENT(IN   ) :: NumOutputs_c      
+   REAL(C_DOUBLE),         INTENT(IN   ) :: InputAry(NumInputs_c)
+   REAL(C_DOUBLE),         INTENT(  OUT) :: OutputAry(NumOutputs_c)
+   LOGICAL(C_BOOL),        INTENT(  OUT) :: EndSimulationEarly
+   INTEGER(C_INT),         INTENT(  OUT) :: ErrStat_c      
+   CHARACTER(KIND=C_CHAR), INTENT(  OUT) :: ErrMsg_c(IntfStrLen)      
+
+   CALL FAST_UpdateStep(iTurb, n_t_turbine(iTurb), 'FAST_UpdateTurbine', NumInputs_c, NumOutputs_c, InputAry, OutputAry, EndSimulationEarly, ErrStat_c, ErrMsg_c)
+
+end subroutine FAST_UpdateTurbine
+!==================================================================================================================================
+!> This routine advances turbine iTurb by one time step from time step n_t for FAST_Update and FAST_UpdateTurbine. It only uses the
+!! data of turbine iTurb, n_t and local error variables.
+subroutine FAST_UpdateStep(iTurb, n_t, RoutineName, NumInputs_c, NumOutputs_c, InputAry, OutputAry, EndSimulationEarly, ErrStat_c, ErrMsg_c)
+   INTEGER(C_INT),         INTENT(IN   ) :: iTurb            ! Turbine number 
+   INTEGER(IntKi),         INTENT(INOUT) :: n_t              ! Time step of the turbine (n_t_global or n_t_turbine(iTurb))
+   CHARACTER(*),           INTENT(IN   ) :: RoutineName      ! Name of the calling routine, for error messages
+   INTEGER(C_INT),         INTENT(IN   ) :: NumInputs_c      
+   INTEGER(C_INT),         INTENT(IN   ) :: NumOutputs_c      
+   REAL(C_DOUBLE),         INTENT(IN   ) :: InputAry(NumInputs_c)
+   REAL(C_DOUBLE),         INTENT(  OUT) :: OutputAry(NumOutputs_c)
+   LOGICAL(C_BOOL),        INTENT(  OUT) :: EndSimulationEarly
+   INTEGER(C_INT),         INTENT(  OUT) :: ErrStat_c      
    CHARACTER(KIND=C_CHAR), INTENT(  OUT) :: ErrMsg_c(IntfStrLen)      
    
       ! local variables
-   REAL(ReKi)                            :: Outputs(NumOutputs_c-1)
-   INTEGER(IntKi)                        :: i
-   INTEGER(IntKi)                        :: ErrStat2                                ! Error status
-   CHARACTER(IntfStrLen-1)               :: ErrMsg2                                 ! Error message  (this needs to be static so that it will print in Matlab's mex library)
+   INTEGER(IntKi)                        :: ErrStat2, ErrStat3                      ! Error status
+   CHARACTER(IntfStrLen-1)               :: ErrMsg2, ErrMsg3                        ! Error message
                  
    EndSimulationEarly = .FALSE.
 
-   IF ( n_t_global > Turbine(iTurb)%p_FAST%n_TMax_m1 ) THEN !finish 
+   IF ( n_t > Turbine(iTurb)%p_FAST%n_TMax_m1 ) THEN !finish 
       
       ! we can't continue because we might over-step some arrays that are allocated to the size of the simulation
 
-      IF (n_t_global == Turbine(iTurb)%p_FAST%n_TMax_m1 + 1) THEN  ! we call update an extra time in Simulink, which we can ignore until the time shift with outputs is solved
-         n_t_global = n_t_global + 1
+      IF (n_t == Turbine(iTurb)%p_FAST%n_TMax_m1 + 1) THEN  ! we call update an extra time in Simulink, which we can ignore until the time shift with outputs is solved
+         n_t = n_t + 1
          ErrStat_c = ErrID_None
-         ErrMsg = C_NULL_CHAR
-         ErrMsg_c = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+         ErrMsg2 = C_NULL_CHAR
       ELSE     
          ErrStat_c = ErrID_Info
-         ErrMsg = "Simulation completed."//C_NULL_CHAR
-         ErrMsg_c = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+         ErrMsg2 = "Simulation completed."//C_NULL_CHAR
       END IF
+      ErrMsg_c = TRANSFER( ErrMsg2//C_NULL_CHAR, ErrMsg_c )
       
-   ELSEIF(NumOutputs_c /= SIZE(Turbine(iTurb)%y_FAST%ChannelNames) ) THEN
+   ELSEIF(NumOutputs_c /= FAST_NumOutputs(iTurb) ) THEN
       ErrStat_c = ErrID_Fatal
-      ErrMsg    = "FAST_Update:size of OutputAry is invalid or FAST has too many outputs."//C_NULL_CHAR
-      ErrMsg_c  = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+      ErrMsg2   = RoutineName//":size of OutputAry is invalid or FAST has too many outputs."//C_NULL_CHAR
+      ErrMsg_c  = TRANSFER( ErrMsg2//C_NULL_CHAR, ErrMsg_c )
       RETURN
    ELSEIF(  NumInputs_c /= NumFixedInputs .AND. NumInputs_c /= NumFixedInputs+3 ) THEN
       ErrStat_c = ErrID_Fatal
-      ErrMsg    = "FAST_Update:size of InputAry is invalid."//C_NULL_CHAR
-      ErrMsg_c  = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+      ErrMsg2   = RoutineName//":size of InputAry is invalid."//C_NULL_CHAR
+      ErrMsg_c  = TRANSFER( ErrMsg2//C_NULL_CHAR, ErrMsg_c )
       RETURN
    ELSE
 
       CALL FAST_SetExternalInputs(iTurb, NumInputs_c, InputAry, Turbine(iTurb)%m_FAST)
 
-      CALL FAST_Solution_T( t_initial, n_t_global, Turbine(iTurb), ErrStat, ErrMsg )                  
-      n_t_global = n_t_global + 1
+      CALL FAST_Solution_T( t_initial, n_t, Turbine(iTurb), ErrStat2, ErrMsg2 )                  
+      n_t = n_t + 1
 
-      CALL FAST_Linearize_T( t_initial, n_t_global, Turbine(iTurb), ErrStat2, ErrMsg2)
-      if (ErrStat2 /= ErrID_None) then
-         ErrStat = max(ErrStat,ErrStat2)
-         ErrMsg = TRIM(ErrMsg)//NewLine//TRIM(ErrMsg2)
+      CALL FAST_Linearize_T( t_initial, n_t, Turbine(iTurb), ErrStat3, ErrMsg3)
+      if (ErrStat3 /= ErrID_None) then
+         ErrStat2 = max(ErrStat2,ErrStat3)
+         ErrMsg2 = TRIM(ErrMsg2)//NewLine//TRIM(ErrMsg3)
       end if
       
       IF ( Turbine(iTurb)%m_FAST%Lin%FoundSteady) THEN
          EndSimulationEarly = .TRUE.
       END IF
       
-      ErrStat_c     = ErrStat
-      ErrMsg        = TRIM(ErrMsg)//C_NULL_CHAR
-      ErrMsg_c      = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+      ErrStat_c     = ErrStat2
+      IF ( ErrStat2 == ErrID_None ) THEN
+         ErrMsg_c(1) = C_NULL_CHAR  ! avoid the string temporaries below in time steps without errors
+      ELSE
+         ErrMsg2       = TRIM(ErrMsg2)//C_NULL_CHAR
+         ErrMsg_c      = TRANSFER( ErrMsg2//C_NULL_CHAR, ErrMsg_c )
+      END IF
    END IF
 
    ! set the outputs for external code here
-   CALL FillOutputAry_T(Turbine(iTurb), Outputs)   
-   OutputAry(1)              = Turbine(iTurb)%m_FAST%t_global 
-   OutputAry(2:NumOutputs_c) = Outputs 
+   CALL FAST_GetOutputAry(iTurb, NumOutputs_c, OutputAry, ErrStat3, ErrMsg3)
+   IF ( ErrStat3 /= ErrID_None ) THEN
+      ErrStat_c = max(ErrStat_c, ErrStat3)
+      ErrMsg3   = TRIM(ErrMsg3)//C_NULL_CHAR
+      ErrMsg_c  = TRANSFER( ErrMsg3//C_NULL_CHAR, ErrMsg_c )
+   END IF
 
 #ifdef CONSOLE_FILE   
-   if (ErrStat /= ErrID_None) call wrscr1(trim(ErrMsg))
+   if (ErrStat_c /= ErrID_None) call wrscr1(trim(ErrMsg2))
 #endif   
       
-end subroutine FAST_Update 
+end subroutine FAST_UpdateStep
+!==================================================================================================================================
+!> This routine calls FAST_Update for up to nSteps time steps, so that callers need one call instead of one per time step. The outputs
+!! of each time step are written to the column of OutputAry for its output step: time step n_t_global+1 goes to output step
+!! n_t_global/StepsPerOutput + 1, counted from the output step of the first time step. Like with repeated calls to FAST_Update, an
+!! output step thus holds the outputs of the last time step written to it. The loop stops early on an error at or above AbortErrLev
+!! or if the simulation ends early; nStepsDone returns the number of time steps taken.
+subroutine FAST_UpdateSteps(iTurb, nSteps, StepsPerOutput, NumInputs_c, NumOutputs_c, InputAry, OutputAry, nStepsDone, EndSimulationEarly, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_UpdateSteps')
+   IMPLICIT NONE
+#ifndef IMPLICIT_DLLEXPORT
+!DEC$ ATTRIBUTES DLLEXPORT :: FAST_UpdateSteps
+!GCC$ ATTRIBUTES DLLEXPORT :: FAST_UpdateSteps
+#endif
+   INTEGER(C_INT),         INTENT(IN   ) :: iTurb            ! Turbine number 
+   INTEGER(C_INT),         INTENT(IN   ) :: nSteps           ! Maximum number of time steps to take
+   INTEGER(C_INT),         INTENT(IN   ) :: StepsPerOutput   ! Number of time steps per output step
+   INTEGER(C_INT),         INTENT(IN   ) :: NumInputs_c      
+   INTEGER(C_INT),         INTENT(IN   ) :: NumOutputs_c      
+   REAL(C_DOUBLE),         INTENT(IN   ) :: InputAry(NumInputs_c)
+   REAL(C_DOUBLE),         INTENT(INOUT) :: OutputAry(NumOutputs_c,*)
+   INTEGER(C_INT),         INTENT(  OUT) :: nStepsDone
+   LOGICAL(C_BOOL),        INTENT(  OUT) :: EndSimulationEarly
+   INTEGER(C_INT),         INTENT(  OUT) :: ErrStat_c      
+   CHARACTER(KIND=C_CHAR), INTENT(  OUT) :: ErrMsg_c(IntfStrLen)      
+   
+      ! local variables
+   INTEGER(IntKi)                        :: FirstOutput                             ! Output step of the first time step
+   INTEGER(IntKi)                        :: iStep
+   
+   nStepsDone = 0
+   EndSimulationEarly = .FALSE.
+   ErrStat_c = ErrID_None
+   ErrMsg_c  = C_NULL_CHAR
+   
+   IF ( StepsPerOutput < 1 ) THEN
+      ErrStat_c = ErrID_Fatal
+      ErrMsg    = "FAST_UpdateSteps:StepsPerOutput must be at least 1."//C_NULL_CHAR
+      ErrMsg_c  = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+      RETURN
+   END IF
+   
+   FirstOutput = n_t_global / StepsPerOutput
+   
+   DO iStep = 1, nSteps
+      CALL FAST_Update(iTurb, NumInputs_c, NumOutputs_c, InputAry, OutputAry(:, n_t_global/StepsPerOutput - FirstOutput + 1), EndSimulationEarly, ErrStat_c, ErrMsg_c)
+      nStepsDone = iStep
+      IF ( ErrStat_c >= AbortErrLev .OR. EndSimulationEarly ) EXIT
+   END DO
+      
+end subroutine FAST_UpdateSteps
 !==================================================================================================================================
 ! Get the hub's absolute position, rotation velocity, and orientation DCM for the current time step
 subroutine FAST_HubPosition(iTurb, AbsPosition_c, RotationalVel_c, Orientation_c, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_HubPosition')
@@ -398,6 +674,54 @@ subroutine FAST_SetExternalInputs(iTurb, NumInputs_c, InputAry, m_FAST)
       
 end subroutine FAST_SetExternalInputs
 !==================================================================================================================================
+!> This routine sets OutputAry to the time and the WriteOutput values of all modules of turbine iTurb. The values are assembled in
+!! OutputBuffer(iTurb), which is allocated on the first call, so later calls do not allocate memory.
+subroutine FAST_GetOutputAry(iTurb, NumOutputs_c, OutputAry, ErrStat, ErrMsg)
+
+   INTEGER(C_INT),         INTENT(IN   ) :: iTurb            ! Turbine number 
+   INTEGER(C_INT),         INTENT(IN   ) :: NumOutputs_c      
+   REAL(C_DOUBLE),         INTENT(  OUT) :: OutputAry(NumOutputs_c)
+   INTEGER(IntKi),         INTENT(  OUT) :: ErrStat          ! Error status
+   CHARACTER(*),           INTENT(  OUT) :: ErrMsg           ! Error message
+
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+
+   IF ( ALLOCATED(OutputBuffer(iTurb)%Outputs) ) THEN
+      IF ( SIZE(OutputBuffer(iTurb)%Outputs) /= NumOutputs_c-1 ) DEALLOCATE(OutputBuffer(iTurb)%Outputs)
+   END IF
+   IF ( .NOT. ALLOCATED(OutputBuffer(iTurb)%Outputs) ) THEN
+      CALL AllocAry(OutputBuffer(iTurb)%Outputs, NumOutputs_c-1, 'OutputBuffer', ErrStat, ErrMsg)
+      IF ( ErrStat >= AbortErrLev ) THEN
+         OutputAry = 0.0_C_DOUBLE
+         RETURN
+      END IF
+   END IF
+
+   IF ( ALLOCATED(OutputBuffer(iTurb)%ChannelIndx) ) THEN
+      CALL FillOutputAry_T(Turbine(iTurb), OutputBuffer(iTurb)%Outputs, OutputBuffer(iTurb)%ChannelIndx, OutputBuffer(iTurb)%ChannelPos)
+   ELSE
+      CALL FillOutputAry_T(Turbine(iTurb), OutputBuffer(iTurb)%Outputs)
+   END IF
+   OutputAry(1)              = Turbine(iTurb)%m_FAST%t_global 
+   OutputAry(2:NumOutputs_c) = OutputBuffer(iTurb)%Outputs
+
+end subroutine FAST_GetOutputAry
+!==================================================================================================================================
+!> This function returns the size of OutputAry expected by FAST_Start and FAST_Update for turbine iTurb: the time plus all output 
+!! channels, or plus the channels subscribed with FAST_SetOutputChannels.
+integer(IntKi) function FAST_NumOutputs(iTurb)
+
+   INTEGER(C_INT),         INTENT(IN   ) :: iTurb            ! Turbine number 
+
+   IF ( ALLOCATED(OutputBuffer(iTurb)%ChannelIndx) ) THEN
+      FAST_NumOutputs = SIZE(OutputBuffer(iTurb)%ChannelIndx) + 1
+   ELSE
+      FAST_NumOutputs = SIZE(Turbine(iTurb)%y_FAST%ChannelNames)
+   END IF
+
+end function FAST_NumOutputs
+!==================================================================================================================================
 subroutine FAST_End(iTurb, StopTheProgram) BIND (C, NAME='FAST_End')
    IMPLICIT NONE
 #ifndef IMPLICIT_DLLEXPORT
@@ -425,7 +749,6 @@ subroutine FAST_CreateCheckpoint(iTurb, CheckpointRootName_c, ErrStat_c, ErrMsg_
    ! local
    CHARACTER(IntfStrLen)                 :: CheckpointRootName   
    INTEGER(IntKi)                        :: I
-   INTEGER(IntKi)                        :: Unit
              
    
       ! transfer the character array from C to a Fortran string:   
@@ -438,8 +761,9 @@ subroutine FAST_CreateCheckpoint(iTurb, CheckpointRootName_c, ErrStat_c, ErrMsg_
    end if
    
       
-   Unit = -1
-   CALL FAST_CreateCheckpoint_T(t_initial, n_t_global, 1, Turbine(iTurb), CheckpointRootName, ErrStat, ErrMsg, Unit )
+      ! without a unit number, the checkpoint file is closed when it is written (with one, it stays open for the next turbine
+      ! unless TurbID equals the number of turbines, which is not the case for turbine 0)
+   CALL FAST_CreateCheckpoint_T(t_initial, n_t_global, 1, Turbine(iTurb), CheckpointRootName, ErrStat, ErrMsg )
 
       ! transfer Fortran variables to C:      
    ErrStat_c     = ErrStat
@@ -453,6 +777,72 @@ subroutine FAST_CreateCheckpoint(iTurb, CheckpointRootName_c, ErrStat_c, ErrMsg_
       
 end subroutine FAST_CreateCheckpoint 
 !==================================================================================================================================
+!> This routine packs the checkpoint data of turbine iTurb into memory instead of writing it to a file. The packed data are kept 
+!! until they are copied with FAST_CopyPackedCheckpoint, so that the caller can write the checkpoint file in the background. 
+!! On return, CheckpointRootName_c contains the root name of the checkpoint file and nBytes_c the size of the file.
+subroutine FAST_PackCheckpoint(iTurb, CheckpointRootName_c, nBytes_c, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_PackCheckpoint')
+   IMPLICIT NONE
+#ifndef IMPLICIT_DLLEXPORT
+!DEC$ ATTRIBUTES DLLEXPORT :: FAST_PackCheckpoint
+!GCC$ ATTRIBUTES DLLEXPORT :: FAST_PackCheckpoint
+#endif
+   INTEGER(C_INT),         INTENT(IN   ) :: iTurb            ! Turbine number 
+   CHARACTER(KIND=C_CHAR), INTENT(INOUT) :: CheckpointRootName_c(IntfStrLen)      
+   INTEGER(C_INT64_T),     INTENT(  OUT) :: nBytes_c         ! Size of the checkpoint data - May exceed 2 GB
+   INTEGER(C_INT),         INTENT(  OUT) :: ErrStat_c      
+   CHARACTER(KIND=C_CHAR), INTENT(  OUT) :: ErrMsg_c(IntfStrLen)      
+   
+   ! local
+   CHARACTER(IntfStrLen)                 :: CheckpointRootName   
+   INTEGER(IntKi)                        :: I
+             
+   
+      ! transfer the character array from C to a Fortran string:   
+   CheckpointRootName = TRANSFER( CheckpointRootName_c, CheckpointRootName )
+   I = INDEX(CheckpointRootName,C_NULL_CHAR) - 1                 ! if this has a c null character at the end...
+   IF ( I > 0 ) CheckpointRootName = CheckpointRootName(1:I)     ! remove it
+   
+   if ( LEN_TRIM(CheckpointRootName) == 0 ) then
+      CheckpointRootName = TRIM(Turbine(iTurb)%p_FAST%OutFileRoot)//'.'//trim( Num2LStr(n_t_global) )
+   end if
+   
+   CALL FAST_PackCheckpoint_T(t_initial, n_t_global, 1, Turbine(iTurb), CheckpointRootName, PackedCheckpoint(iTurb)%ChkpBuf, ErrStat, ErrMsg )
+
+   nBytes_c = 0
+   IF ( ALLOCATED(PackedCheckpoint(iTurb)%ChkpBuf) ) nBytes_c = SIZE(PackedCheckpoint(iTurb)%ChkpBuf, KIND=C_INT64_T)
+
+      ! transfer Fortran variables to C:      
+   CheckpointRootName   = TRIM(CheckpointRootName)//C_NULL_CHAR
+   CheckpointRootName_c = TRANSFER( CheckpointRootName, CheckpointRootName_c )
+   ErrStat_c     = ErrStat
+   ErrMsg        = TRIM(ErrMsg)//C_NULL_CHAR
+   ErrMsg_c      = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+
+
+#ifdef CONSOLE_FILE   
+   if (ErrStat /= ErrID_None) call wrscr1(trim(ErrMsg))
+#endif   
+      
+end subroutine FAST_PackCheckpoint
+!==================================================================================================================================
+!> This routine copies the checkpoint data packed by FAST_PackCheckpoint for turbine iTurb into Checkpoint_c (nBytes_c bytes) and
+!! frees the packed data.
+subroutine FAST_CopyPackedCheckpoint(iTurb, Checkpoint_c) BIND (C, NAME='FAST_CopyPackedCheckpoint')
+   IMPLICIT NONE
+#ifndef IMPLICIT_DLLEXPORT
+!DEC$ ATTRIBUTES DLLEXPORT :: FAST_CopyPackedCheckpoint
+!GCC$ ATTRIBUTES DLLEXPORT :: FAST_CopyPackedCheckpoint
+#endif
+   INTEGER(C_INT),         INTENT(IN   ) :: iTurb            ! Turbine number 
+   INTEGER(C_SIGNED_CHAR), INTENT(  OUT) :: Checkpoint_c(*)  ! Contents of the checkpoint file 
+
+   IF ( ALLOCATED(PackedCheckpoint(iTurb)%ChkpBuf) ) THEN
+      Checkpoint_c(1:SIZE(PackedCheckpoint(iTurb)%ChkpBuf, KIND=C_INT64_T)) = PackedCheckpoint(iTurb)%ChkpBuf
+      DEALLOCATE(PackedCheckpoint(iTurb)%ChkpBuf)
+   END IF
+
+end subroutine FAST_CopyPackedCheckpoint
+!==================================================================================================================================
 subroutine FAST_Restart(iTurb, CheckpointRootName_c, AbortErrLev_c, NumOuts_c, dt_c, n_t_global_c, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_Restart')
    IMPLICIT NONE
 #ifndef IMPLICIT_DLLEXPORT
@@ -506,6 +896,87 @@ subroutine FAST_Restart(iTurb, CheckpointRootName_c, AbortErrLev_c, NumOuts_c, d
       
 end subroutine FAST_Restart 
 !==================================================================================================================================
+!> This routine continues a simulation from the checkpoint file of another one, e.g. a simulation that was run once to a settled 
+!! state with FAST_CreateCheckpoint. The turbine writes its output files with the root name OutFileRoot_c, so that many simulations 
+!! can be started from the same checkpoint. It returns the same sizes as FAST_Sizes, plus the time step of the checkpoint.
+subroutine FAST_WarmStart(iTurb, CheckpointRootName_c, OutFileRoot_c, AbortErrLev_c, NumOuts_c, dt_c, dt_out_c, tmax_c, n_t_global_c, ErrStat_c, ErrMsg_c, ChannelNames_c) BIND (C, NAME='FAST_WarmStart')
+   IMPLICIT NONE
+#ifndef IMPLICIT_DLLEXPORT
+!DEC$ ATTRIBUTES DLLEXPORT :: FAST_WarmStart
+!GCC$ ATTRIBUTES DLLEXPORT :: FAST_WarmStart
+#endif
+   INTEGER(C_INT),         INTENT(IN   ) :: iTurb            ! Turbine number 
+   CHARACTER(KIND=C_CHAR), INTENT(IN   ) :: CheckpointRootName_c(IntfStrLen)      
+   CHARACTER(KIND=C_CHAR), INTENT(IN   ) :: OutFileRoot_c(IntfStrLen)      
+   INTEGER(C_INT),         INTENT(  OUT) :: AbortErrLev_c      
+   INTEGER(C_INT),         INTENT(  OUT) :: NumOuts_c      
+   REAL(C_DOUBLE),         INTENT(  OUT) :: dt_c      
+   REAL(C_DOUBLE),         INTENT(  OUT) :: dt_out_c      
+   REAL(C_DOUBLE),         INTENT(  OUT) :: tmax_c
+   INTEGER(C_INT),         INTENT(  OUT) :: n_t_global_c      
+   INTEGER(C_INT),         INTENT(  OUT) :: ErrStat_c      
+   CHARACTER(KIND=C_CHAR), INTENT(  OUT) :: ErrMsg_c(IntfStrLen)      
+   CHARACTER(KIND=C_CHAR), INTENT(  OUT) :: ChannelNames_c(ChanLen*MAXOUTPUTS+1)
+   
+   ! local
+   CHARACTER(IntfStrLen)                 :: CheckpointRootName   
+   CHARACTER(IntfStrLen)                 :: OutFileRoot   
+   INTEGER(IntKi)                        :: I, J, K
+   REAL(DbKi)                            :: t_initial_out
+   INTEGER(IntKi)                        :: NumTurbines_out
+   CHARACTER(*),           PARAMETER     :: RoutineName = 'FAST_WarmStart' 
+             
+   
+      ! transfer the character arrays from C to Fortran strings:   
+   CheckpointRootName = TRANSFER( CheckpointRootName_c, CheckpointRootName )
+   I = INDEX(CheckpointRootName,C_NULL_CHAR) - 1                 ! if this has a c null character at the end...
+   IF ( I > 0 ) CheckpointRootName = CheckpointRootName(1:I)     ! remove it
+
+   OutFileRoot = TRANSFER( OutFileRoot_c, OutFileRoot )
+   I = INDEX(OutFileRoot,C_NULL_CHAR) - 1                        ! if this has a c null character at the end...
+   IF ( I > 0 ) OutFileRoot = OutFileRoot(1:I)                   ! remove it
+   
+      ! without a unit number, the snapshot file is closed after reading, so that other cases can start from it
+   CALL FAST_RestoreFromCheckpoint_T(t_initial_out, n_t_global, NumTurbines_out, Turbine(iTurb), CheckpointRootName, ErrStat, ErrMsg, OutFileRoot=OutFileRoot )
+   
+      ! check that these are valid:
+      IF (t_initial_out /= t_initial) CALL SetErrStat(ErrID_Fatal, "invalid value of t_initial.", ErrStat, ErrMsg, RoutineName )
+      IF (NumTurbines_out /= 1) CALL SetErrStat(ErrID_Fatal, "invalid value of NumTurbines.", ErrStat, ErrMsg, RoutineName )
+   
+   n_t_turbine(iTurb) = n_t_global
+   
+      ! transfer Fortran variables to C: 
+   n_t_global_c  = n_t_global
+   AbortErrLev_c = AbortErrLev   
+   NumOuts_c     = min(MAXOUTPUTS, SUM( Turbine(iTurb)%y_FAST%numOuts )) ! includes time
+   dt_c          = Turbine(iTurb)%p_FAST%dt      
+   dt_out_c      = Turbine(iTurb)%p_FAST%DT_Out
+   tmax_c        = Turbine(iTurb)%p_FAST%TMax
+      
+   ErrStat_c     = ErrStat
+   ErrMsg        = TRIM(ErrMsg)//C_NULL_CHAR
+   ErrMsg_c      = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+
+#ifdef CONSOLE_FILE   
+   if (ErrStat /= ErrID_None) call wrscr1(trim(ErrMsg))
+#endif   
+   
+      ! return the names of the output channels
+   IF ( ALLOCATED( Turbine(iTurb)%y_FAST%ChannelNames ) )  then
+      K = 1;
+      DO I=1,NumOuts_c
+         DO J=1,ChanLen
+            ChannelNames_c(K)=Turbine(iTurb)%y_FAST%ChannelNames(I)(J:J)
+            K = K+1
+         END DO
+      END DO
+      ChannelNames_c(K) = C_NULL_CHAR
+   ELSE
+      ChannelNames_c = C_NULL_CHAR
+   END IF
+      
+end subroutine FAST_WarmStart
+!==================================================================================================================================
 subroutine FAST_OpFM_Init(iTurb, TMax, InputFileName_c, TurbID, NumSC2CtrlGlob, NumSC2Ctrl, NumCtrl2SC, InitSCOutputsGlob, InitSCOutputsTurbine, NumActForcePtsBlade, NumActForcePtsTower, TurbPosn, AbortErrLev_c, dt_c, NumBl_c, NumBlElem_c, &
                           OpFM_Input_from_FAST, OpFM_Output_to_FAST, SC_DX_Input_from_FAST, SC_DX_Output_to_FAST, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_OpFM_Init')
    IMPLICIT NONE
@@ -818,6 +1289,61 @@ subroutine FAST_OpFM_Step(iTurb, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_OpFM_S
    END IF
    
       
-end subroutine FAST_OpFM_Step 
-!==================================================================================================================================   
+end subroutine FAST_OpFM_Step
+!==================================================================================================================================
+!> This routine advances turbine iTurb from n_t_global to n_t_global + 1. Unlike FAST_OpFM_Step, it uses local error variables and
+!! does not advance n_t_global, so different turbines can be stepped concurrently. Call FAST_OpFM_IncrementStep once all turbines
+!! have been stepped.
+subroutine FAST_OpFM_StepTurbine(iTurb, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_OpFM_StepTurbine')
+   IMPLICIT NONE
+#ifndef IMPLICIT_DLLEXPORT
+!DEC$ ATTRIBUTES DLLEXPORT :: FAST_OpFM_StepTurbine
+!GCC$ ATTRIBUTES DLLEXPORT :: FAST_OpFM_StepTurbine
+#endif
+   INTEGER(C_INT),         INTENT(IN   ) :: iTurb            ! Turbine number
+   INTEGER(C_INT),         INTENT(  OUT) :: ErrStat_c
+   CHARACTER(KIND=C_CHAR), INTENT(  OUT) :: ErrMsg_c(IntfStrLen)
+
+      ! local variables
+   INTEGER(IntKi)                        :: ErrStat2                                ! Error status
+   CHARACTER(IntfStrLen-1)               :: ErrMsg2                                 ! Error message
+
+   IF ( n_t_global > Turbine(iTurb)%p_FAST%n_TMax_m1 ) THEN !finish
+
+      ! we can't continue because we might over-step some arrays that are allocated to the size of the simulation
+      IF (n_t_global == Turbine(iTurb)%p_FAST%n_TMax_m1 + 1) THEN  ! we call update an extra time in Simulink, which we can ignore until the time shift with outputs is solved
+         ErrStat_c = ErrID_None
+         ErrMsg2 = C_NULL_CHAR
+      ELSE
+         ErrStat_c = ErrID_Info
+         ErrMsg2 = "Simulation completed."//C_NULL_CHAR
+      END IF
+
+   ELSE
+
+      CALL FAST_Solution_T( t_initial, n_t_global, Turbine(iTurb), ErrStat2, ErrMsg2 )
+      ErrStat_c = ErrStat2
+      ErrMsg2 = TRIM(ErrMsg2)//C_NULL_CHAR
+
+   END IF
+
+   ErrMsg_c = TRANSFER( ErrMsg2//C_NULL_CHAR, ErrMsg_c )
+
+end subroutine FAST_OpFM_StepTurbine
+!==================================================================================================================================
+!> This routine advances the global time step counter after all turbines have been stepped with FAST_OpFM_StepTurbine.
+subroutine FAST_OpFM_IncrementStep() BIND (C, NAME='FAST_OpFM_IncrementStep')
+   IMPLICIT NONE
+#ifndef IMPLICIT_DLLEXPORT
+!DEC$ ATTRIBUTES DLLEXPORT :: FAST_OpFM_IncrementStep
+!GCC$ ATTRIBUTES DLLEXPORT :: FAST_OpFM_IncrementStep
+#endif
+
+   ! keep the same logic as FAST_OpFM_Step for the last turbine
+   IF ( n_t_global <= Turbine(NumTurbines-1)%p_FAST%n_TMax_m1 + 1 ) THEN
+      n_t_global = n_t_global + 1
+   END IF
+
+end subroutine FAST_OpFM_IncrementStep
+!==================================================================================================================================
 END MODULE FAST_Data
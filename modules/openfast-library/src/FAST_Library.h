@@ -5,6 +5,7 @@
 #include "OpenFOAM_Types.h"
 #include "SCDataEx_Types.h"
 #include "stdio.h"
+#include "stdint.h"
 
 #ifdef __cplusplus
 #define EXTERNAL_ROUTINE extern "C"
@@ -14,6 +15,9 @@
 
 EXTERNAL_ROUTINE void FAST_AllocateTurbines(int * iTurb, int *ErrStat, char *ErrMsg);
 EXTERNAL_ROUTINE void FAST_DeallocateTurbines(int *ErrStat, char *ErrMsg);
+EXTERNAL_ROUTINE void FAST_SetInputCache(const char *CacheDir, int *ErrStat, char *ErrMsg);
+EXTERNAL_ROUTINE void FAST_IsReentrant(bool *Reentrant);
+EXTERNAL_ROUTINE void FAST_IsTurbineReentrant(int * iTurb, bool *Reentrant);
 
 EXTERNAL_ROUTINE void FAST_OpFM_Restart(int * iTurb, const char *CheckpointRootName, int *AbortErrLev, double * dt, int * NumBl, int * NumBlElem, int * n_t_global,
    OpFM_InputType_t* OpFM_Input, OpFM_OutputType_t* OpFM_Output, SC_DX_InputType_t* SC_DX_Input, SC_DX_OutputType_t* SC_DX_Output, int *ErrStat, char *ErrMsg);
@@ -22,19 +26,27 @@ EXTERNAL_ROUTINE void FAST_OpFM_Init(int * iTurb, double *TMax, const char *Inpu
    int *ErrStat, char *ErrMsg);
 EXTERNAL_ROUTINE void FAST_OpFM_Solution0(int * iTurb, int *ErrStat, char *ErrMsg);
 EXTERNAL_ROUTINE void FAST_OpFM_Step(int * iTurb, int *ErrStat, char *ErrMsg);
+EXTERNAL_ROUTINE void FAST_OpFM_StepTurbine(int * iTurb, int *ErrStat, char *ErrMsg);
+EXTERNAL_ROUTINE void FAST_OpFM_IncrementStep();
 
 EXTERNAL_ROUTINE void FAST_HubPosition(int * iTurb, float * absolute_position, float * rotation_veocity, double * orientation_dcm, int *ErrStat, char *ErrMsg);
 
 EXTERNAL_ROUTINE void FAST_Restart(int * iTurb, const char *CheckpointRootName, int *AbortErrLev, int * NumOuts, double * dt, int * n_t_global, int *ErrStat, char *ErrMsg);
+EXTERNAL_ROUTINE void FAST_WarmStart(int * iTurb, const char *CheckpointRootName, const char *OutFileRoot, int *AbortErrLev, int * NumOuts, double * dt, double * dt_out, double * tmax, int * n_t_global, int *ErrStat, char *ErrMsg, char *ChannelNames);
 #ifdef __cplusplus
 EXTERNAL_ROUTINE void FAST_Sizes(int * iTurb, const char *InputFileName, int *AbortErrLev, int * NumOuts, double * dt, double * dt_out, double * tmax, int *ErrStat, char *ErrMsg, char *ChannelNames, double *TMax = NULL, double *InitInputAry = NULL); 
 #else
 EXTERNAL_ROUTINE void FAST_Sizes(int * iTurb, const char *InputFileName, int *AbortErrLev, int * NumOuts, double * dt, double * dt_out, double * tmax, int *ErrStat, char *ErrMsg, char *ChannelNames, double *TMax, double *InitInputAry);
 #endif
+EXTERNAL_ROUTINE void FAST_SetOutputChannels(int * iTurb, int * NumChannels, int * ChannelIndices, int *ErrStat, char *ErrMsg);
 EXTERNAL_ROUTINE void FAST_Start(int * iTurb, int *NumInputs_c, int *NumOutputs_c, double *InputAry, double *OutputAry, int *ErrStat, char *ErrMsg);
 EXTERNAL_ROUTINE void FAST_Update(int * iTurb, int *NumInputs_c, int *NumOutputs_c, double *InputAry, double *OutputAry, bool *EndSimulationEarly, int *ErrStat, char *ErrMsg);
+EXTERNAL_ROUTINE void FAST_UpdateSteps(int * iTurb, int *nSteps, int *StepsPerOutput, int *NumInputs_c, int *NumOutputs_c, double *InputAry, double *OutputAry, int *nStepsDone, bool *EndSimulationEarly, int *ErrStat, char *ErrMsg);
+EXTERNAL_ROUTINE void FAST_UpdateTurbine(int * iTurb, int *NumInputs_c, int *NumOutputs_c, double *InputAry, double *OutputAry, bool *EndSimulationEarly, int *ErrStat, char *ErrMsg);
 EXTERNAL_ROUTINE void FAST_End(int * iTurb, bool * stopThisProgram);
 EXTERNAL_ROUTINE void FAST_CreateCheckpoint(int * iTurb, const char *CheckpointRootName, int *ErrStat, char *ErrMsg);
+EXTERNAL_ROUTINE void FAST_PackCheckpoint(int * iTurb, char *CheckpointRootName, int64_t *nBytes, int *ErrStat, char *ErrMsg);
+EXTERNAL_ROUTINE void FAST_CopyPackedCheckpoint(int * iTurb, char *Checkpoint);
 
 // some constants (keep these synced with values in FAST's fortran code)
 #define INTERFACE_STRING_LENGTH 1025
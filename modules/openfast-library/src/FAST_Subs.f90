@@ -120,6 +120,10 @@ SUBROUTINE FAST_InitializeAll( t_initial, p_FAST, y_FAST, m_FAST, ED, BD, SrvD,
    INTEGER(IntKi)                          :: I                   ! generic loop counter
    INTEGER(IntKi)                          :: k                   ! blade loop counter
    logical                                 :: CallStart
+   REAL(DbKi)                              :: InitTime(NumModules) ! wall-clock time spent in the initialization routine of each module (s)
+   INTEGER(B8Ki)                           :: InitClockStart      ! clock count when the current initialization routine was called
+   INTEGER(IntKi)                          :: InputCacheHits0     ! number of input cache hits before this turbine was initialized
+   INTEGER(IntKi)                          :: InputCacheMisses0   ! number of input cache misses before this turbine was initialized
    
    
    INTEGER(IntKi)                          :: NumBl
@@ -133,6 +137,10 @@ SUBROUTINE FAST_InitializeAll( t_initial, p_FAST, y_FAST, m_FAST, ED, BD, SrvD,
    ErrStat = ErrID_None
    ErrMsg  = ""
 
+   InitTime = 0.0_DbKi
+   InputCacheHits0   = InputCacheHits
+   InputCacheMisses0 = InputCacheMisses
+
    y_FAST%UnSum = -1                                                    ! set the summary file unit to -1 to indicate it's not open
    y_FAST%UnOu  = -1                                                    ! set the text output file unit to -1 to indicate it's not open
    y_FAST%UnGra = -1                                                    ! set the binary graphics output file unit to -1 to indicate it's not open
@@ -202,15 +210,21 @@ SUBROUTINE FAST_InitializeAll( t_initial, p_FAST, y_FAST, m_FAST, ED, BD, SrvD,
       end if
 
       if (ExternInitData%FarmIntegration) then ! we're integrating with FAST.Farm
+         CALL StartInitTimer()
          CALL FAST_Init( p_FAST, m_FAST, y_FAST, t_initial, InputFile, ErrStat2, ErrMsg2, ExternInitData%TMax, OverrideAbortLev=.false., RootName=ExternInitData%RootName )
+         CALL StopInitTimer( Module_Glue )
       else
+         CALL StartInitTimer()
          CALL FAST_Init( p_FAST, m_FAST, y_FAST, t_initial, InputFile, ErrStat2, ErrMsg2, ExternInitData%TMax, ExternInitData%TurbineID )  ! We have the name of the input file and the simulation length from somewhere else (e.g. Simulink)
+         CALL StopInitTimer( Module_Glue )
       end if
 
    else
       p_FAST%TurbinePos = 0.0_ReKi
       p_FAST%WaveFieldMod = 0
+      CALL StartInitTimer()
       CALL FAST_Init( p_FAST, m_FAST, y_FAST, t_initial, InputFile, ErrStat2, ErrMsg2 )                       ! We have the name of the input file from somewhere else (e.g. Simulink)
+      CALL StopInitTimer( Module_Glue )
    end if
 
    CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
@@ -248,8 +262,10 @@ SUBROUTINE FAST_InitializeAll( t_initial, p_FAST, y_FAST, m_FAST, ED, BD, SrvD,
 
    Init%InData_ED%Gravity       = p_FAST%Gravity
 
+   CALL StartInitTimer()
    CALL ED_Init( Init%InData_ED, ED%Input(1), ED%p, ED%x(STATE_CURR), ED%xd(STATE_CURR), ED%z(STATE_CURR), ED%OtherSt(STATE_CURR), &
                   ED%y, ED%m, p_FAST%dt_module( MODULE_ED ), Init%OutData_ED, ErrStat2, ErrMsg2 )
+   CALL StopInitTimer( Module_ED )
       CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
 
    p_FAST%ModuleInitialized(Module_ED) = .TRUE.
@@ -367,8 +383,10 @@ SUBROUTINE FAST_InitializeAll( t_initial, p_FAST, y_FAST, m_FAST, ED, BD, SrvD,
          Init%InData_BD%RootVel(1:3) = ED%y%BladeRootMotion(k)%TranslationVel(:,1)    ! {:}    - - "Initial root velocities and angular veolcities"
          Init%InData_BD%RootVel(4:6) = ED%y%BladeRootMotion(k)%RotationVel(:,1)       ! {:}    - - "Initial root velocities and angular veolcities"
 
+         CALL StartInitTimer()
          CALL BD_Init( Init%InData_BD, BD%Input(1,k), BD%p(k),  BD%x(k,STATE_CURR), BD%xd(k,STATE_CURR), BD%z(k,STATE_CURR), &
                            BD%OtherSt(k,STATE_CURR), BD%y(k),  BD%m(k), dt_BD, Init%OutData_BD(k), ErrStat2, ErrMsg2 )
+         CALL StopInitTimer( Module_BD )
             CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
 
          !bjj: we're going to force this to have the same timestep because I don't want to have to deal with n BD modules with n timesteps.
@@ -434,8 +452,10 @@ SUBROUTINE FAST_InitializeAll( t_initial, p_FAST, y_FAST, m_FAST, ED, BD, SrvD,
       CALL AD_SetInitInput(Init%InData_AD14, Init%OutData_ED, ED%y, p_FAST, ErrStat2, ErrMsg2)            ! set the values in Init%InData_AD14
          CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
 
+      CALL StartInitTimer()
       CALL AD14_Init( Init%InData_AD14, AD14%Input(1), AD14%p, AD14%x(STATE_CURR), AD14%xd(STATE_CURR), AD14%z(STATE_CURR), &
                      AD14%OtherSt(STATE_CURR), AD14%y, AD14%m, p_FAST%dt_module( MODULE_AD14 ), Init%OutData_AD14, ErrStat2, ErrMsg2 )
+      CALL StopInitTimer( Module_AD14 )
          CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
 
       p_FAST%ModuleInitialized(Module_AD14) = .TRUE.
@@ -504,8 +524,10 @@ SUBROUTINE FAST_InitializeAll( t_initial, p_FAST, y_FAST, m_FAST, ED, BD, SrvD,
          Init%InData_AD%rotors(1)%BladeRootOrientation(:,:,k) = ED%y%BladeRootMotion(k)%RefOrientation(:,:,1)
       end do
       
+      CALL StartInitTimer()
       CALL AD_Init( Init%InData_AD, AD%Input(1), AD%p, AD%x(STATE_CURR), AD%xd(STATE_CURR), AD%z(STATE_CURR), &
                     AD%OtherSt(STATE_CURR), AD%y, AD%m, p_FAST%dt_module( MODULE_AD ), Init%OutData_AD, ErrStat2, ErrMsg2 )
+      CALL StopInitTimer( Module_AD )
          CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
 
       p_FAST%ModuleInitialized(Module_AD) = .TRUE.
@@ -603,8 +625,10 @@ SUBROUTINE FAST_InitializeAll( t_initial, p_FAST, y_FAST, m_FAST, ED, BD, SrvD,
          Init%InData_IfW%Use4Dext                  = .false.
       END IF
 
+      CALL StartInitTimer()
       CALL InflowWind_Init( Init%InData_IfW, IfW%Input(1), IfW%p, IfW%x(STATE_CURR), IfW%xd(STATE_CURR), IfW%z(STATE_CURR),  &
                      IfW%OtherSt(STATE_CURR), IfW%y, IfW%m, p_FAST%dt_module( MODULE_IfW ), Init%OutData_IfW, ErrStat2, ErrMsg2 )
+      CALL StopInitTimer( Module_IfW )
          CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
 
       p_FAST%ModuleInitialized(Module_IfW) = .TRUE.
@@ -750,8 +774,10 @@ SUBROUTINE FAST_InitializeAll( t_initial, p_FAST, y_FAST, m_FAST, ED, BD, SrvD,
       Init%InData_HD%PtfmLocationX = p_FAST%TurbinePos(1)
       Init%InData_HD%PtfmLocationY = p_FAST%TurbinePos(2)
 
+      CALL StartInitTimer()
       CALL HydroDyn_Init( Init%InData_HD, HD%Input(1), HD%p,  HD%x(STATE_CURR), HD%xd(STATE_CURR), HD%z(STATE_CURR), &
                           HD%OtherSt(STATE_CURR), HD%y, HD%m, p_FAST%dt_module( MODULE_HD ), Init%OutData_HD, ErrStat2, ErrMsg2 )
+      CALL StopInitTimer( Module_HD )
          CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
 
       p_FAST%ModuleInitialized(Module_HD) = .TRUE.
@@ -811,8 +837,10 @@ SUBROUTINE FAST_InitializeAll( t_initial, p_FAST, y_FAST, m_FAST, ED, BD, SrvD,
       Init%InData_SD%SubRotateZ    = 0.0                                        ! Used by driver to rotate structure around z
       
             
+      CALL StartInitTimer()
       CALL SD_Init( Init%InData_SD, SD%Input(1), SD%p,  SD%x(STATE_CURR), SD%xd(STATE_CURR), SD%z(STATE_CURR),  &
                     SD%OtherSt(STATE_CURR), SD%y, SD%m, p_FAST%dt_module( MODULE_SD ), Init%OutData_SD, ErrStat2, ErrMsg2 )
+      CALL StopInitTimer( Module_SD )
          CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
 
       p_FAST%ModuleInitialized(Module_SD) = .TRUE.
@@ -845,9 +873,11 @@ SUBROUTINE FAST_InitializeAll( t_initial, p_FAST, y_FAST, m_FAST, ED, BD, SrvD,
       Init%InData_ExtPtfm%Linearize = p_FAST%Linearize
       Init%InData_ExtPtfm%PtfmRefzt = ED%p%PtfmRefzt ! Required
 
+      CALL StartInitTimer()
       CALL ExtPtfm_Init( Init%InData_ExtPtfm, ExtPtfm%Input(1), ExtPtfm%p,  &
                          ExtPtfm%x(STATE_CURR), ExtPtfm%xd(STATE_CURR), ExtPtfm%z(STATE_CURR),  ExtPtfm%OtherSt(STATE_CURR), &
                          ExtPtfm%y, ExtPtfm%m, p_FAST%dt_module( MODULE_ExtPtfm ), Init%OutData_ExtPtfm, ErrStat2, ErrMsg2 )
+      CALL StopInitTimer( Module_ExtPtfm )
          CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
 
       p_FAST%ModuleInitialized(MODULE_ExtPtfm) = .TRUE.
@@ -924,8 +954,10 @@ SUBROUTINE FAST_InitializeAll( t_initial, p_FAST, y_FAST, m_FAST, ED, BD, SrvD,
 
       Init%InData_MAP%LinInitInp%Linearize = p_FAST%Linearize
 
+      CALL StartInitTimer()
       CALL MAP_Init( Init%InData_MAP, MAPp%Input(1), MAPp%p,  MAPp%x(STATE_CURR), MAPp%xd(STATE_CURR), MAPp%z(STATE_CURR), MAPp%OtherSt, &
                       MAPp%y, p_FAST%dt_module( MODULE_MAP ), Init%OutData_MAP, ErrStat2, ErrMsg2 )
+      CALL StopInitTimer( Module_MAP )
          CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
 
       p_FAST%ModuleInitialized(Module_MAP) = .TRUE.
@@ -974,8 +1006,10 @@ SUBROUTINE FAST_InitializeAll( t_initial, p_FAST, y_FAST, m_FAST, ED, BD, SrvD,
       Init%InData_MD%Linearize = p_FAST%Linearize
 
 
+      CALL StartInitTimer()
       CALL MD_Init( Init%InData_MD, MD%Input(1), MD%p, MD%x(STATE_CURR), MD%xd(STATE_CURR), MD%z(STATE_CURR), &
                     MD%OtherSt(STATE_CURR), MD%y, MD%m, p_FAST%dt_module( MODULE_MD ), Init%OutData_MD, ErrStat2, ErrMsg2 )
+      CALL StopInitTimer( Module_MD )
          CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
 
       p_FAST%ModuleInitialized(Module_MD) = .TRUE.
@@ -1015,8 +1049,10 @@ SUBROUTINE FAST_InitializeAll( t_initial, p_FAST, y_FAST, m_FAST, ED, BD, SrvD,
       Init%InData_FEAM%WtrDens     = Init%OutData_HD%WtrDens     ! This needs to be set according to seawater density in HydroDyn      
 !      Init%InData_FEAM%depth       =  Init%OutData_HD%WtrDpth    ! This need to be set according to the water depth in HydroDyn
 
+      CALL StartInitTimer()
       CALL FEAM_Init( Init%InData_FEAM, FEAM%Input(1), FEAM%p,  FEAM%x(STATE_CURR), FEAM%xd(STATE_CURR), FEAM%z(STATE_CURR), &
                       FEAM%OtherSt(STATE_CURR), FEAM%y, FEAM%m, p_FAST%dt_module( MODULE_FEAM ), Init%OutData_FEAM, ErrStat2, ErrMsg2 )
+      CALL StopInitTimer( Module_FEAM )
          CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
 
       p_FAST%ModuleInitialized(Module_FEAM) = .TRUE.
@@ -1036,8 +1072,10 @@ SUBROUTINE FAST_InitializeAll( t_initial, p_FAST, y_FAST, m_FAST, ED, BD, SrvD,
       Init%InData_Orca%RootName  = p_FAST%OutFileRoot
       Init%InData_Orca%TMax      = p_FAST%TMax
 
+      CALL StartInitTimer()
       CALL Orca_Init( Init%InData_Orca, Orca%Input(1), Orca%p,  Orca%x(STATE_CURR), Orca%xd(STATE_CURR), Orca%z(STATE_CURR), Orca%OtherSt(STATE_CURR), &
                       Orca%y, Orca%m, p_FAST%dt_module( MODULE_Orca ), Init%OutData_Orca, ErrStat2, ErrMsg2 )
+      CALL StopInitTimer( Module_Orca )
          CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
 
       p_FAST%ModuleInitialized(MODULE_Orca) = .TRUE.
@@ -1104,8 +1142,10 @@ SUBROUTINE FAST_InitializeAll( t_initial, p_FAST, y_FAST, m_FAST, ED, BD, SrvD,
       Init%InData_IceF%MSL2SWL       = Init%OutData_HD%MSL2SWL
       Init%InData_IceF%gravity       = p_FAST%Gravity
       
+      CALL StartInitTimer()
       CALL IceFloe_Init( Init%InData_IceF, IceF%Input(1), IceF%p,  IceF%x(STATE_CURR), IceF%xd(STATE_CURR), IceF%z(STATE_CURR), &
                          IceF%OtherSt(STATE_CURR), IceF%y, IceF%m, p_FAST%dt_module( MODULE_IceF ), Init%OutData_IceF, ErrStat2, ErrMsg2 )
+      CALL StopInitTimer( Module_IceF )
          CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
 
       p_FAST%ModuleInitialized(Module_IceF) = .TRUE.
@@ -1129,8 +1169,10 @@ SUBROUTINE FAST_InitializeAll( t_initial, p_FAST, y_FAST, m_FAST, ED, BD, SrvD,
       Init%InData_IceD%TMax          = p_FAST%TMax
       Init%InData_IceD%LegNum        = 1
 
+      CALL StartInitTimer()
       CALL IceD_Init( Init%InData_IceD, IceD%Input(1,1), IceD%p(1),  IceD%x(1,STATE_CURR), IceD%xd(1,STATE_CURR), IceD%z(1,STATE_CURR), &
                       IceD%OtherSt(1,STATE_CURR), IceD%y(1), IceD%m(1), p_FAST%dt_module( MODULE_IceD ), Init%OutData_IceD, ErrStat2, ErrMsg2 )
+      CALL StopInitTimer( Module_IceD )
          CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
 
       p_FAST%ModuleInitialized(Module_IceD) = .TRUE.
@@ -1151,8 +1193,10 @@ SUBROUTINE FAST_InitializeAll( t_initial, p_FAST, y_FAST, m_FAST, ED, BD, SrvD,
          Init%InData_IceD%LegNum = i
          Init%InData_IceD%RootName = TRIM(p_FAST%OutFileRoot)//'.'//TRIM(y_FAST%Module_Abrev(Module_IceD))//TRIM(Num2LStr(i))
 
+         CALL StartInitTimer()
          CALL IceD_Init( Init%InData_IceD, IceD%Input(1,i), IceD%p(i),  IceD%x(i,STATE_CURR), IceD%xd(i,STATE_CURR), IceD%z(i,STATE_CURR), &
                             IceD%OtherSt(i,STATE_CURR), IceD%y(i), IceD%m(i), dt_IceD, Init%OutData_IceD, ErrStat2, ErrMsg2 )
+         CALL StopInitTimer( Module_IceD )
             CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
 
          !bjj: we're going to force this to have the same timestep because I don't want to have to deal with n IceD modules with n timesteps.
@@ -1275,8 +1319,10 @@ SUBROUTINE FAST_InitializeAll( t_initial, p_FAST, y_FAST, m_FAST, ED, BD, SrvD,
       end if
 
       Init%InData_SrvD%BlPitchInit   = Init%OutData_ED%BlPitch
+      CALL StartInitTimer()
       CALL SrvD_Init( Init%InData_SrvD, SrvD%Input(1), SrvD%p, SrvD%x(STATE_CURR), SrvD%xd(STATE_CURR), SrvD%z(STATE_CURR), &
                       SrvD%OtherSt(STATE_CURR), SrvD%y, SrvD%m, p_FAST%dt_module( MODULE_SrvD ), Init%OutData_SrvD, ErrStat2, ErrMsg2 )
+      CALL StopInitTimer( Module_SrvD )
          CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
       p_FAST%ModuleInitialized(Module_SrvD) = .TRUE.
 
@@ -1388,7 +1434,7 @@ SUBROUTINE FAST_InitializeAll( t_initial, p_FAST, y_FAST, m_FAST, ED, BD, SrvD,
    ! Write initialization data to FAST summary file:
    ! -------------------------------------------------------------------------
    if (p_FAST%SumPrint)  then
-       CALL FAST_WrSum( p_FAST, y_FAST, MeshMapData, ErrStat2, ErrMsg2 )
+       CALL FAST_WrSum( p_FAST, y_FAST, MeshMapData, InitTime, InputCacheHits - InputCacheHits0, InputCacheMisses - InputCacheMisses0, ErrStat2, ErrMsg2 )
           CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
    endif
 
@@ -1544,6 +1590,22 @@ CONTAINS
          endif
       endif
    END SUBROUTINE SetSrvDCableControls
+   !...............................................................................................................................
+   !> Starts timing a module initialization routine.
+   SUBROUTINE StartInitTimer()
+      CALL SYSTEM_CLOCK( InitClockStart )
+   END SUBROUTINE StartInitTimer
+   !...............................................................................................................................
+   !> Adds the wall-clock time since StartInitTimer was called to the initialization time of module ModuleID.
+   SUBROUTINE StopInitTimer( ModuleID )
+      INTEGER(IntKi), INTENT(IN   ) :: ModuleID            !< module whose initialization routine was timed
+      INTEGER(B8Ki)                 :: ClockEnd            ! clock count when the initialization routine returned
+      INTEGER(B8Ki)                 :: ClockRate           ! clock counts per second
+
+      CALL SYSTEM_CLOCK( ClockEnd, ClockRate )
+      IF ( ClockRate > 0 ) InitTime(ModuleID) = InitTime(ModuleID) + REAL( ClockEnd - InitClockStart, DbKi ) / REAL( ClockRate, DbKi )
+   END SUBROUTINE StopInitTimer
+   !...............................................................................................................................
 
 END SUBROUTINE FAST_InitializeAll
 
@@ -2241,64 +2303,9 @@ end do
          y_FAST%OutFmt_a = trim(y_FAST%OutFmt_a)//','//trim(num2lstr(y_FAST%ActualChanLen - p_FAST%FmtWidth))//'x'
       end if
 
-      CALL GetNewUnit( y_FAST%UnOu, ErrStat, ErrMsg )
+      CALL FAST_OpenTextOutput( p_FAST, y_FAST, ErrStat, ErrMsg )
          IF ( ErrStat >= AbortErrLev ) RETURN
 
-      CALL OpenFOutFile ( y_FAST%UnOu, TRIM(p_FAST%OutFileRoot)//'.out', ErrStat, ErrMsg )
-         IF ( ErrStat >= AbortErrLev ) RETURN
-
-         ! Add some file information:
-
-      WRITE (y_FAST%UnOu,'(/,A)')  TRIM( y_FAST%FileDescLines(1) )
-      WRITE (y_FAST%UnOu,'(1X,A)') TRIM( y_FAST%FileDescLines(2) )
-      WRITE (y_FAST%UnOu,'()' )    !print a blank line
-      WRITE (y_FAST%UnOu,'(A)'   ) TRIM( y_FAST%FileDescLines(3) )
-      WRITE (y_FAST%UnOu,'()' )    !print a blank line
-
-
-         !......................................................
-         ! Write the names of the output parameters on one line:
-         !......................................................
-      if (p_FAST%Delim /= " ") then ! trim trailing spaces if not space delimited:
-
-         CALL WrFileNR ( y_FAST%UnOu, trim(y_FAST%ChannelNames(1)) ) ! first one is time, with a special format
-
-         DO I=2,NumOuts
-            CALL WrFileNR ( y_FAST%UnOu, p_FAST%Delim//trim(y_FAST%ChannelNames(I)) )
-         ENDDO ! I
-      else
-
-         CALL WrFileNR ( y_FAST%UnOu, y_FAST%ChannelNames(1)(1:p_FAST%TChanLen) ) ! first one is time, with a special format
-
-         DO I=2,NumOuts
-            CALL WrFileNR ( y_FAST%UnOu, p_FAST%Delim//y_FAST%ChannelNames(I)(1:y_FAST%ActualChanLen) )
-         ENDDO ! I
-      end if
-
-      WRITE (y_FAST%UnOu,'()')
-
-         !......................................................
-         ! Write the units of the output parameters on one line:
-         !......................................................
-
-      if (p_FAST%Delim /= " ") then
-
-         CALL WrFileNR ( y_FAST%UnOu, trim(y_FAST%ChannelUnits(1)) )
-
-         DO I=2,NumOuts
-            CALL WrFileNR ( y_FAST%UnOu, p_FAST%Delim//trim(y_FAST%ChannelUnits(I)) )
-         ENDDO ! I
-      else
-
-         CALL WrFileNR ( y_FAST%UnOu, y_FAST%ChannelUnits(1)(1:p_FAST%TChanLen) )
-
-         DO I=2,NumOuts
-            CALL WrFileNR ( y_FAST%UnOu, p_FAST%Delim//y_FAST%ChannelUnits(I)(1:y_FAST%ActualChanLen) )
-         ENDDO ! I
-      end if
-
-      WRITE (y_FAST%UnOu,'()')
-
    END IF
 
    !......................................................
@@ -2333,6 +2340,84 @@ end do
 RETURN
 END SUBROUTINE FAST_InitOutput
 !----------------------------------------------------------------------------------------------------------------------------------
+!> This routine opens the text output file, OutFileRoot.out, and writes the file description lines and the names and units of the
+!! output channels.
+SUBROUTINE FAST_OpenTextOutput( p_FAST, y_FAST, ErrStat, ErrMsg )
+
+   TYPE(FAST_ParameterType),       INTENT(IN)           :: p_FAST                                !< Glue-code simulation parameters
+   TYPE(FAST_OutputFileType),      INTENT(INOUT)        :: y_FAST                                !< Glue-code simulation outputs
+
+   INTEGER(IntKi),                 INTENT(OUT)          :: ErrStat                               !< Error status
+   CHARACTER(*),                   INTENT(OUT)          :: ErrMsg                                !< Error message corresponding to ErrStat
+
+      ! Local variables.
+
+   INTEGER(IntKi)                   :: I                                               ! Generic index for DO loops.
+   INTEGER(IntKi)                   :: NumOuts                                         ! number of channels to be written to the output file
+
+
+   NumOuts = SIZE( y_FAST%ChannelNames )
+
+   CALL GetNewUnit( y_FAST%UnOu, ErrStat, ErrMsg )
+      IF ( ErrStat >= AbortErrLev ) RETURN
+
+   CALL OpenFOutFile ( y_FAST%UnOu, TRIM(p_FAST%OutFileRoot)//'.out', ErrStat, ErrMsg )
+      IF ( ErrStat >= AbortErrLev ) RETURN
+
+      ! Add some file information:
+
+   WRITE (y_FAST%UnOu,'(/,A)')  TRIM( y_FAST%FileDescLines(1) )
+   WRITE (y_FAST%UnOu,'(1X,A)') TRIM( y_FAST%FileDescLines(2) )
+   WRITE (y_FAST%UnOu,'()' )    !print a blank line
+   WRITE (y_FAST%UnOu,'(A)'   ) TRIM( y_FAST%FileDescLines(3) )
+   WRITE (y_FAST%UnOu,'()' )    !print a blank line
+
+
+      !......................................................
+      ! Write the names of the output parameters on one line:
+      !......................................................
+   if (p_FAST%Delim /= " ") then ! trim trailing spaces if not space delimited:
+
+      CALL WrFileNR ( y_FAST%UnOu, trim(y_FAST%ChannelNames(1)) ) ! first one is time, with a special format
+
+      DO I=2,NumOuts
+         CALL WrFileNR ( y_FAST%UnOu, p_FAST%Delim//trim(y_FAST%ChannelNames(I)) )
+      ENDDO ! I
+   else
+
+      CALL WrFileNR ( y_FAST%UnOu, y_FAST%ChannelNames(1)(1:p_FAST%TChanLen) ) ! first one is time, with a special format
+
+      DO I=2,NumOuts
+         CALL WrFileNR ( y_FAST%UnOu, p_FAST%Delim//y_FAST%ChannelNames(I)(1:y_FAST%ActualChanLen) )
+      ENDDO ! I
+   end if
+
+   WRITE (y_FAST%UnOu,'()')
+
+      !......................................................
+      ! Write the units of the output parameters on one line:
+      !......................................................
+
+   if (p_FAST%Delim /= " ") then
+
+      CALL WrFileNR ( y_FAST%UnOu, trim(y_FAST%ChannelUnits(1)) )
+
+      DO I=2,NumOuts
+         CALL WrFileNR ( y_FAST%UnOu, p_FAST%Delim//trim(y_FAST%ChannelUnits(I)) )
+      ENDDO ! I
+   else
+
+      CALL WrFileNR ( y_FAST%UnOu, y_FAST%ChannelUnits(1)(1:p_FAST%TChanLen) )
+
+      DO I=2,NumOuts
+         CALL WrFileNR ( y_FAST%UnOu, p_FAST%Delim//y_FAST%ChannelUnits(I)(1:y_FAST%ActualChanLen) )
+      ENDDO ! I
+   end if
+
+   WRITE (y_FAST%UnOu,'()')
+
+END SUBROUTINE FAST_OpenTextOutput
+!----------------------------------------------------------------------------------------------------------------------------------
 !> This routine reads in the primary FAST input file, does some validation, and places the values it reads in the
 !!   parameter structure (p). It prints to an echo file if requested.
 SUBROUTINE FAST_ReadPrimaryFile( InputFile, p, m_FAST, OverrideAbortErrLev, ErrStat, ErrMsg )
@@ -3865,11 +3950,14 @@ SUBROUTINE SetModuleSubstepTime(ModuleID, p_FAST, y_FAST, ErrStat, ErrMsg)
 END SUBROUTINE SetModuleSubstepTime
 !----------------------------------------------------------------------------------------------------------------------------------
 !> This writes data to the FAST summary file.
-SUBROUTINE FAST_WrSum( p_FAST, y_FAST, MeshMapData, ErrStat, ErrMsg )
+SUBROUTINE FAST_WrSum( p_FAST, y_FAST, MeshMapData, InitTime, CacheHits, CacheMisses, ErrStat, ErrMsg )
 
    TYPE(FAST_ParameterType), INTENT(IN)    :: p_FAST                             !< Glue-code simulation parameters
    TYPE(FAST_OutputFileType),INTENT(INOUT) :: y_FAST                             !< Glue-code simulation outputs (changes value of UnSum)
    TYPE(FAST_ModuleMapType), INTENT(IN)    :: MeshMapData                        !< Data for mapping between modules
+   REAL(DbKi),               INTENT(IN)    :: InitTime(NumModules)               !< Wall-clock time spent in the initialization routine of each module (s)
+   INTEGER(IntKi),           INTENT(IN)    :: CacheHits                          !< Number of module inputs reused from the input cache
+   INTEGER(IntKi),           INTENT(IN)    :: CacheMisses                        !< Number of module inputs parsed with the input cache enabled
    INTEGER(IntKi),           INTENT(OUT)   :: ErrStat                            !< Error status (level)
    CHARACTER(*),             INTENT(OUT)   :: ErrMsg                             !< Message describing error reported in ErrStat
 
@@ -4067,6 +4155,30 @@ SUBROUTINE FAST_WrSum( p_FAST, y_FAST, MeshMapData, ErrStat, ErrMsg )
    END IF
 
 
+   !.......................... Initialization times: ...................................................
+
+   WRITE (y_FAST%UnSum,'(//,2X,A)') " Initialization Wall-Clock Times  "
+   WRITE (y_FAST%UnSum,   '(2X,A)') "-------------------------------------------------"
+   Fmt = '(2X,A17,2X,A15)'
+   WRITE (y_FAST%UnSum, Fmt ) "Component        ", "Time (s)       "
+   WRITE (y_FAST%UnSum, Fmt ) "-----------------", "---------------"
+   Fmt = '(2X,A17,2X,F15.4)'
+   WRITE (y_FAST%UnSum, Fmt ) "FAST (glue code) ", InitTime(Module_Glue)
+   DO Module_Number=2,NumModules ! assumes glue-code is module number 1 (i.e., MODULE_Glue == 1)
+      IF (p_FAST%ModuleInitialized(Module_Number)) THEN
+         WRITE (y_FAST%UnSum, Fmt ) y_FAST%Module_Ver(Module_Number)%Name, InitTime(Module_Number)
+      END IF
+   END DO
+
+   IF ( LEN_TRIM(InputCacheDir) > 0 ) THEN
+      WRITE (y_FAST%UnSum,'(/,2X,A)'  ) 'Input cache: '//TRIM(InputCacheDir)
+      WRITE (y_FAST%UnSum,'(2X,A,I8)' ) 'Module inputs reused from the cache: ', CacheHits
+      WRITE (y_FAST%UnSum,'(2X,A,I8)' ) 'Module inputs parsed:                ', CacheMisses
+   ELSE
+      WRITE (y_FAST%UnSum,'(/,2X,A)'  ) 'Input cache: disabled'
+   END IF
+
+
    !.......................... Requested Output Channels ............................................
 
    WRITE (y_FAST%UnSum,'(//,2X,A)') " Requested Channels in FAST Output File(s)  "
@@ -5178,13 +5290,31 @@ SUBROUTINE WrOutputLine( t, p_FAST, y_FAST, IfWOutput, OpFMOutput, EDOutput, y_A
    CHARACTER(200)                   :: Frmt                                      ! A string to hold a format specifier
    CHARACTER(p_FAST%TChanLen)       :: TmpStr                                    ! temporary string to print the time output as text
 
-   REAL(ReKi)                       :: OutputAry(SIZE(y_FAST%ChannelNames)-1)
+   REAL(ReKi), ALLOCATABLE          :: OutputAry(:)                              ! output values, when they are not stored in y_FAST%AllOutData
+   LOGICAL                          :: StoreBin                                  ! whether the output values are stored for the binary output file
 
    ErrStat = ErrID_None
    ErrMsg  = ''
-   
-   CALL FillOutputAry(p_FAST, y_FAST, IfWOutput, OpFMOutput, EDOutput, y_AD, SrvDOutput, HDOutput, SDOutput, ExtPtfmOutput, &
-                      MAPOutput, FEAMOutput, MDOutput, OrcaOutput, IceFOutput, y_IceD, y_BD, OutputAry)   
+
+      ! The values for the binary output file are assembled in place in y_FAST%AllOutData, so that writing an output step
+      ! allocates no memory when only the binary output file is written
+   StoreBin = p_FAST%WrBinOutFile .AND. y_FAST%n_Out < y_FAST%NOutSteps
+   IF ( StoreBin ) THEN
+      y_FAST%n_Out = y_FAST%n_Out + 1
+
+         ! store time data
+      IF ( y_FAST%n_Out == 1_IntKi .OR. p_FAST%WrBinMod == FileFmtID_WithTime ) THEN
+         y_FAST%TimeData(y_FAST%n_Out) = t   ! Time associated with these outputs
+      END IF
+
+         ! store individual module data
+      CALL FillOutputAry(p_FAST, y_FAST, IfWOutput, OpFMOutput, EDOutput, y_AD, SrvDOutput, HDOutput, SDOutput, ExtPtfmOutput, &
+                         MAPOutput, FEAMOutput, MDOutput, OrcaOutput, IceFOutput, y_IceD, y_BD, y_FAST%AllOutData(:, y_FAST%n_Out))
+   ELSE IF ( p_FAST%WrTxtOutFile ) THEN
+      ALLOCATE( OutputAry(SIZE(y_FAST%ChannelNames)-1) )
+      CALL FillOutputAry(p_FAST, y_FAST, IfWOutput, OpFMOutput, EDOutput, y_AD, SrvDOutput, HDOutput, SDOutput, ExtPtfmOutput, &
+                         MAPOutput, FEAMOutput, MDOutput, OrcaOutput, IceFOutput, y_IceD, y_BD, OutputAry)
+   END IF
 
    IF (p_FAST%WrTxtOutFile) THEN
 
@@ -5197,7 +5327,11 @@ SUBROUTINE WrOutputLine( t, p_FAST, y_FAST, IfWOutput, OpFMOutput, EDOutput, y_A
       CALL WrFileNR( y_FAST%UnOu, TmpStr )
 
          ! write the individual module output (convert to SiKi if necessary, so that we don't need to print so many digits in the exponent)
-      CALL WrNumAryFileNR ( y_FAST%UnOu, REAL(OutputAry,SiKi), Frmt, ErrStat, ErrMsg )
+      IF ( StoreBin ) THEN
+         CALL WrNumAryFileNR ( y_FAST%UnOu, REAL(y_FAST%AllOutData(:, y_FAST%n_Out),SiKi), Frmt, ErrStat, ErrMsg )
+      ELSE
+         CALL WrNumAryFileNR ( y_FAST%UnOu, REAL(OutputAry,SiKi), Frmt, ErrStat, ErrMsg )
+      END IF
          !IF ( ErrStat >= AbortErrLev ) RETURN
 
          ! write a new line (advance to the next line)
@@ -5205,30 +5339,12 @@ SUBROUTINE WrOutputLine( t, p_FAST, y_FAST, IfWOutput, OpFMOutput, EDOutput, y_A
 
    END IF
 
-
-   IF (p_FAST%WrBinOutFile) THEN
-
-         ! Write data to array for binary output file
-
-      IF ( y_FAST%n_Out == y_FAST%NOutSteps ) THEN
-         ErrStat = ErrID_Warn
-         ErrMsg = 'Not all data could be written to the binary output file.'
-         !CALL ProgWarn( 'Not all data could be written to the binary output file.' )
-         !this really would only happen if we have an error somewhere else, right?
-         !otherwise, we could allocate a new, larger array and move existing data
-      ELSE
-         y_FAST%n_Out = y_FAST%n_Out + 1
-
-            ! store time data
-         IF ( y_FAST%n_Out == 1_IntKi .OR. p_FAST%WrBinMod == FileFmtID_WithTime ) THEN
-            y_FAST%TimeData(y_FAST%n_Out) = t   ! Time associated with these outputs
-         END IF
-
-            ! store individual module data
-         y_FAST%AllOutData(:, y_FAST%n_Out) = OutputAry
-
-      END IF
-
+   IF ( p_FAST%WrBinOutFile .AND. .NOT. StoreBin ) THEN
+      ErrStat = ErrID_Warn
+      ErrMsg = 'Not all data could be written to the binary output file.'
+      !CALL ProgWarn( 'Not all data could be written to the binary output file.' )
+      !this really would only happen if we have an error somewhere else, right?
+      !otherwise, we could allocate a new, larger array and move existing data
    END IF
 
    RETURN
@@ -5236,24 +5352,27 @@ END SUBROUTINE WrOutputLine
 !----------------------------------------------------------------------------------------------------------------------------------
 !> Routine that calls FillOutputAry for one instance of a Turbine data structure. This is a separate subroutine so that the FAST
 !! driver programs do not need to change or operate on the individual module level. (Called from Simulink interface.)
-SUBROUTINE FillOutputAry_T(Turbine, Outputs)
+SUBROUTINE FillOutputAry_T(Turbine, Outputs, ChannelIndx, ChannelPos)
 
    TYPE(FAST_TurbineType),   INTENT(IN   ) :: Turbine                          !< all data for one instance of a turbine
    REAL(ReKi),               INTENT(  OUT) :: Outputs(:)                       !< single array of output
+   INTEGER(IntKi), OPTIONAL, INTENT(IN   ) :: ChannelIndx(:)                   !< subset of the outputs to return (see FillOutputAry)
+   INTEGER(IntKi), OPTIONAL, INTENT(IN   ) :: ChannelPos(:)                    !< positions of the subset in Outputs (see FillOutputAry)
 
 
       CALL FillOutputAry(Turbine%p_FAST, Turbine%y_FAST, Turbine%IfW%y%WriteOutput, Turbine%OpFM%y%WriteOutput, &
                 Turbine%ED%y%WriteOutput, Turbine%AD%y, Turbine%SrvD%y%WriteOutput, &
                 Turbine%HD%y%WriteOutput, Turbine%SD%y%WriteOutput, Turbine%ExtPtfm%y%WriteOutput, Turbine%MAP%y%WriteOutput, &
                 Turbine%FEAM%y%WriteOutput, Turbine%MD%y%WriteOutput, Turbine%Orca%y%WriteOutput, &
-                Turbine%IceF%y%WriteOutput, Turbine%IceD%y, Turbine%BD%y, Outputs)
+                Turbine%IceF%y%WriteOutput, Turbine%IceD%y, Turbine%BD%y, Outputs, ChannelIndx, ChannelPos)
 
 END SUBROUTINE FillOutputAry_T
 !----------------------------------------------------------------------------------------------------------------------------------
 !> This routine concatenates all of the WriteOutput values from the module Output into one array to be written to the FAST
-!! output file.
+!! output file. If ChannelIndx is present, only the outputs with those indices (in ascending order) are copied, output
+!! ChannelIndx(i) to OutputAry(ChannelPos(i)), so that callers that need a few channels do not pay for copying all of them.
 SUBROUTINE FillOutputAry(p_FAST, y_FAST, IfWOutput, OpFMOutput, EDOutput, y_AD, SrvDOutput, HDOutput, SDOutput, ExtPtfmOutput, &
-                        MAPOutput, FEAMOutput, MDOutput, OrcaOutput, IceFOutput, y_IceD, y_BD, OutputAry)
+                        MAPOutput, FEAMOutput, MDOutput, OrcaOutput, IceFOutput, y_IceD, y_BD, OutputAry, ChannelIndx, ChannelPos)
 
    TYPE(FAST_ParameterType), INTENT(IN)    :: p_FAST                             !< Glue-code simulation parameters
    TYPE(FAST_OutputFileType),INTENT(IN)    :: y_FAST                             !< Glue-code simulation outputs
@@ -5275,109 +5394,102 @@ SUBROUTINE FillOutputAry(p_FAST, y_FAST, IfWOutput, OpFMOutput, EDOutput, y_AD,
    TYPE(BD_OutputType),      INTENT(IN)    :: y_BD (:)                           !< BeamDyn outputs (WriteOutput values are subset)
 
    REAL(ReKi),               INTENT(OUT)   :: OutputAry(:)                       !< single array of output
+   INTEGER(IntKi), OPTIONAL, INTENT(IN)    :: ChannelIndx(:)                     !< indices of the outputs to copy, in ascending order (default: all)
+   INTEGER(IntKi), OPTIONAL, INTENT(IN)    :: ChannelPos(:)                      !< index in OutputAry of each output in ChannelIndx
 
    INTEGER(IntKi)                          :: i                                  ! loop counter
    INTEGER(IntKi)                          :: indxLast                           ! The index of the last row value to be written to AllOutData for this time step (column).
    INTEGER(IntKi)                          :: indxNext                           ! The index of the next row value to be written to AllOutData for this time step (column).
+   INTEGER(IntKi)                          :: iSub                               ! The index of the next output in ChannelIndx
 
 
             ! store individual module data into one array for output
 
       indxLast = 0
       indxNext = 1
+      iSub     = 1
       
       IF (y_FAST%numOuts(Module_Glue) > 1) THEN ! if we output more than just the time channel....
-         indxLast = indxNext + SIZE(y_FAST%DriverWriteOutput) - 1
-         OutputAry(indxNext:indxLast) = y_FAST%DriverWriteOutput
-         indxNext = IndxLast + 1
+         CALL AddOutputs( y_FAST%DriverWriteOutput )
       END IF
 
       IF ( y_FAST%numOuts(Module_IfW) > 0 ) THEN
-         indxLast = indxNext + SIZE(IfWOutput) - 1
-         OutputAry(indxNext:indxLast) = IfWOutput
-         indxNext = IndxLast + 1
+         CALL AddOutputs( IfWOutput )
       ELSEIF ( y_FAST%numOuts(Module_OpFM) > 0 ) THEN
-         indxLast = indxNext + SIZE(OpFMOutput) - 1
-         OutputAry(indxNext:indxLast) = OpFMOutput
-         indxNext = IndxLast + 1
+         CALL AddOutputs( OpFMOutput )
       END IF
 
       IF ( y_FAST%numOuts(Module_ED) > 0 ) THEN
-         indxLast = indxNext + SIZE(EDOutput) - 1
-         OutputAry(indxNext:indxLast) = EDOutput
-         indxNext = IndxLast + 1
+         CALL AddOutputs( EDOutput )
       END IF
 
       IF ( y_FAST%numOuts(Module_BD) > 0 ) THEN
          do i=1,SIZE(y_BD)
-            indxLast = indxNext + SIZE(y_BD(i)%WriteOutput) - 1
-            OutputAry(indxNext:indxLast) = y_BD(i)%WriteOutput
-            indxNext = IndxLast + 1
+            CALL AddOutputs( y_BD(i)%WriteOutput )
          end do
       END IF
 
       IF ( y_FAST%numOuts(Module_AD) > 0 ) THEN
          do i=1,SIZE(y_AD%Rotors)
             if (allocated(y_AD%Rotors(i)%WriteOutput)) then
-               indxLast = indxNext + SIZE(y_AD%Rotors(i)%WriteOutput) - 1
-               OutputAry(indxNext:indxLast) = y_AD%Rotors(i)%WriteOutput
-               indxNext = IndxLast + 1
+               CALL AddOutputs( y_AD%Rotors(i)%WriteOutput )
             endif
          end do         
       END IF            
          
       IF ( y_FAST%numOuts(Module_SrvD) > 0 ) THEN
-         indxLast = indxNext + SIZE(SrvDOutput) - 1
-         OutputAry(indxNext:indxLast) = SrvDOutput
-         indxNext = IndxLast + 1
+         CALL AddOutputs( SrvDOutput )
       END IF
 
       IF ( y_FAST%numOuts(Module_HD) > 0 ) THEN
-         indxLast = indxNext + SIZE(HDOutput) - 1
-         OutputAry(indxNext:indxLast) = HDOutput
-         indxNext = IndxLast + 1
+         CALL AddOutputs( HDOutput )
       END IF
 
       IF ( y_FAST%numOuts(Module_SD) > 0 ) THEN
-         indxLast = indxNext + SIZE(SDOutput) - 1
-         OutputAry(indxNext:indxLast) = SDOutput
-         indxNext = IndxLast + 1
+         CALL AddOutputs( SDOutput )
       ELSE IF ( y_FAST%numOuts(Module_ExtPtfm) > 0 ) THEN
-         indxLast = indxNext + SIZE(ExtPtfmOutput) - 1
-         OutputAry(indxNext:indxLast) = ExtPtfmOutput
-         indxNext = IndxLast + 1
+         CALL AddOutputs( ExtPtfmOutput )
       END IF
 
       IF ( y_FAST%numOuts(Module_MAP) > 0 ) THEN
-         indxLast = indxNext + SIZE(MAPOutput) - 1
-         OutputAry(indxNext:indxLast) = MAPOutput
-         indxNext = IndxLast + 1
+         CALL AddOutputs( MAPOutput )
       ELSEIF ( y_FAST%numOuts(Module_MD) > 0 ) THEN
-         indxLast = indxNext + SIZE(MDOutput) - 1
-         OutputAry(indxNext:indxLast) = MDOutput
-         indxNext = IndxLast + 1
+         CALL AddOutputs( MDOutput )
       ELSEIF ( y_FAST%numOuts(Module_FEAM) > 0 ) THEN
-         indxLast = indxNext + SIZE(FEAMOutput) - 1
-         OutputAry(indxNext:indxLast) = FEAMOutput
-         indxNext = IndxLast + 1
+         CALL AddOutputs( FEAMOutput )
       ELSEIF ( y_FAST%numOuts(Module_Orca) > 0 ) THEN
-         indxLast = indxNext + SIZE(OrcaOutput) - 1
-         OutputAry(indxNext:indxLast) = OrcaOutput
-         indxNext = IndxLast + 1
+         CALL AddOutputs( OrcaOutput )
       END IF
 
       IF ( y_FAST%numOuts(Module_IceF) > 0 ) THEN
-         indxLast = indxNext + SIZE(IceFOutput) - 1
-         OutputAry(indxNext:indxLast) = IceFOutput
-         indxNext = IndxLast + 1
+         CALL AddOutputs( IceFOutput )
       ELSEIF ( y_FAST%numOuts(Module_IceD) > 0 ) THEN
          DO i=1,p_FAST%numIceLegs
-            indxLast = indxNext + SIZE(y_IceD(i)%WriteOutput) - 1
-            OutputAry(indxNext:indxLast) = y_IceD(i)%WriteOutput
-            indxNext = IndxLast + 1
+            CALL AddOutputs( y_IceD(i)%WriteOutput )
          END DO
       END IF
 
+
+CONTAINS
+   !...............................................................................................................................
+   !> This routine appends the outputs of one module to OutputAry, or the ones of them that are in ChannelIndx.
+   SUBROUTINE AddOutputs( ModOutput )
+      REAL(ReKi),            INTENT(IN)    :: ModOutput(:)                       !< WriteOutput values of the module
+
+      indxLast = indxNext + SIZE(ModOutput) - 1
+      IF ( PRESENT(ChannelIndx) ) THEN
+         DO WHILE ( iSub <= SIZE(ChannelIndx) )
+            IF ( ChannelIndx(iSub) > indxLast ) EXIT
+            OutputAry(ChannelPos(iSub)) = ModOutput(ChannelIndx(iSub) - indxNext + 1)
+            iSub = iSub + 1
+         END DO
+      ELSE
+         OutputAry(indxNext:indxLast) = ModOutput
+      END IF
+      indxNext = indxLast + 1
+
+   END SUBROUTINE AddOutputs
+   !...............................................................................................................................
 END SUBROUTINE FillOutputAry
 !----------------------------------------------------------------------------------------------------------------------------------
 SUBROUTINE WriteVTK(t_global, p_FAST, y_FAST, MeshMapData, ED, BD, AD, IfW, OpFM, HD, SD, ExtPtfm, SrvD, MAPp, FEAM, MD, Orca, IceF, IceD)
@@ -6905,9 +7017,6 @@ END SUBROUTINE FAST_CreateCheckpoint_Tary
 !! before writing the turbine data to the file.
 SUBROUTINE FAST_CreateCheckpoint_T(t_initial, n_t_global, NumTurbines, Turbine, CheckpointRoot, ErrStat, ErrMsg, Unit )
 
-   USE BladedInterface, ONLY: CallBladedDLL  ! Hack for Bladed-style DLL
-   USE BladedInterface, ONLY: GH_DISCON_STATUS_CHECKPOINT
-
    REAL(DbKi),               INTENT(IN   ) :: t_initial           !< initial time
    INTEGER(IntKi),           INTENT(IN   ) :: n_t_global          !< loop counter
    INTEGER(IntKi),           INTENT(IN   ) :: NumTurbines         !< Number of turbines in this simulation
@@ -6925,7 +7034,6 @@ SUBROUTINE FAST_CreateCheckpoint_T(t_initial, n_t_global, NumTurbines, Turbine,
    INTEGER(B4Ki)                           :: ArraySizes(3)
 
    INTEGER(IntKi)                          :: unOut               ! unit number for output file
-   INTEGER(IntKi)                          :: old_avrSwap1        ! previous value of avrSwap(1) !hack for Bladed DLL checkpoint/restore
    INTEGER(IntKi)                          :: ErrStat2            ! local error status
    CHARACTER(ErrMsgLen)                    :: ErrMsg2             ! local error message
    CHARACTER(*),             PARAMETER     :: RoutineName = 'FAST_CreateCheckpoint_T'
@@ -7009,6 +7117,113 @@ SUBROUTINE FAST_CreateCheckpoint_T(t_initial, n_t_global, NumTurbines, Turbine,
    IF (PRESENT(Unit)) Unit = unOut
 
       ! A hack to pack Bladed-style DLL data
+   CALL FAST_CreateCheckpointDLL_T(Turbine, DLLFileName, ErrStat2, ErrMsg2)
+      CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+
+   call cleanup()
+
+contains
+   subroutine cleanup()
+      IF ( ALLOCATED(ReKiBuf)  ) DEALLOCATE(ReKiBuf)
+      IF ( ALLOCATED(DbKiBuf)  ) DEALLOCATE(DbKiBuf)
+      IF ( ALLOCATED(IntKiBuf) ) DEALLOCATE(IntKiBuf)
+   end subroutine cleanup
+END SUBROUTINE FAST_CreateCheckpoint_T
+!----------------------------------------------------------------------------------------------------------------------------------
+!> Routine that packs all of the data from one turbine instance into a byte array laid out exactly like the checkpoint file
+!! FAST_CreateCheckpoint_T writes for a single turbine, so the caller can write the file later (e.g., in the background).
+SUBROUTINE FAST_PackCheckpoint_T(t_initial, n_t_global, NumTurbines, Turbine, CheckpointRoot, ChkpBuf, ErrStat, ErrMsg )
+
+   REAL(DbKi),               INTENT(IN   ) :: t_initial           !< initial time
+   INTEGER(IntKi),           INTENT(IN   ) :: n_t_global          !< loop counter
+   INTEGER(IntKi),           INTENT(IN   ) :: NumTurbines         !< Number of turbines in this simulation
+   TYPE(FAST_TurbineType),   INTENT(INOUT) :: Turbine             !< all data for one instance of a turbine (INTENT(OUT) only because of hack for Bladed DLL)
+   CHARACTER(*),             INTENT(IN   ) :: CheckpointRoot      !< Rootname of checkpoint file
+   INTEGER(B1Ki), ALLOCATABLE, INTENT(INOUT) :: ChkpBuf(:)        !< contents of the checkpoint file
+   INTEGER(IntKi),           INTENT(  OUT) :: ErrStat             !< Error status of the operation
+   CHARACTER(*),             INTENT(  OUT) :: ErrMsg              !< Error message if ErrStat /= ErrID_None
+
+      ! local variables:
+   REAL(ReKi),               ALLOCATABLE   :: ReKiBuf(:)
+   REAL(DbKi),               ALLOCATABLE   :: DbKiBuf(:)
+   INTEGER(IntKi),           ALLOCATABLE   :: IntKiBuf(:)
+
+   INTEGER(B4Ki)                           :: ArraySizes(3)
+   INTEGER(B1Ki)                           :: Mold(1)             ! mold for converting the data to bytes
+
+   INTEGER(IntKi)                          :: ErrStat2            ! local error status
+   CHARACTER(ErrMsgLen)                    :: ErrMsg2             ! local error message
+   CHARACTER(*),             PARAMETER     :: RoutineName = 'FAST_PackCheckpoint_T'
+
+      ! init error status
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+
+      ! Get the arrays of data to be stored in the output file
+   CALL FAST_PackTurbineType( ReKiBuf, DbKiBuf, IntKiBuf, Turbine, ErrStat2, ErrMsg2 )
+      CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+      if (ErrStat >= AbortErrLev ) then
+         call cleanup()
+         RETURN
+      end if
+
+   IF ( .NOT. ALLOCATED(ReKiBuf)  ) ALLOCATE(ReKiBuf(0))
+   IF ( .NOT. ALLOCATED(DbKiBuf)  ) ALLOCATE(DbKiBuf(0))
+   IF ( .NOT. ALLOCATED(IntKiBuf) ) ALLOCATE(IntKiBuf(0))
+
+   ArraySizes(1) = SIZE(ReKiBuf)
+   ArraySizes(2) = SIZE(DbKiBuf)
+   ArraySizes(3) = SIZE(IntKiBuf)
+
+      ! checkpoint file header followed by the data from the current turbine (see FAST_CreateCheckpoint_T):
+   IF ( ALLOCATED(ChkpBuf) ) DEALLOCATE(ChkpBuf)
+   ChkpBuf = (/ TRANSFER( INT(ReKi ,B4Ki), Mold ), &
+                TRANSFER( INT(DbKi ,B4Ki), Mold ), &
+                TRANSFER( INT(IntKi,B4Ki), Mold ), &
+                TRANSFER( AbortErrLev,     Mold ), &
+                TRANSFER( NumTurbines,     Mold ), &
+                TRANSFER( t_initial,       Mold ), &
+                TRANSFER( n_t_global,      Mold ), &
+                TRANSFER( ArraySizes,      Mold ), &
+                TRANSFER( ReKiBuf,         Mold ), &
+                TRANSFER( DbKiBuf,         Mold ), &
+                TRANSFER( IntKiBuf,        Mold ) /)
+
+      ! A hack to pack Bladed-style DLL data
+   CALL FAST_CreateCheckpointDLL_T(Turbine, TRIM(CheckpointRoot)//'.dll.chkp', ErrStat2, ErrMsg2)
+      CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+
+   call cleanup()
+
+contains
+   subroutine cleanup()
+      IF ( ALLOCATED(ReKiBuf)  ) DEALLOCATE(ReKiBuf)
+      IF ( ALLOCATED(DbKiBuf)  ) DEALLOCATE(DbKiBuf)
+      IF ( ALLOCATED(IntKiBuf) ) DEALLOCATE(IntKiBuf)
+   end subroutine cleanup
+END SUBROUTINE FAST_PackCheckpoint_T
+!----------------------------------------------------------------------------------------------------------------------------------
+!> Routine that asks a Bladed-style DLL controller to write its own checkpoint file, DLLFileName.
+SUBROUTINE FAST_CreateCheckpointDLL_T(Turbine, DLLFileName, ErrStat, ErrMsg)
+
+   USE BladedInterface, ONLY: CallBladedDLL  ! Hack for Bladed-style DLL
+   USE BladedInterface, ONLY: GH_DISCON_STATUS_CHECKPOINT
+
+   TYPE(FAST_TurbineType),   INTENT(INOUT) :: Turbine             !< all data for one instance of a turbine
+   CHARACTER(*),             INTENT(IN   ) :: DLLFileName         !< Name of the DLL checkpoint file
+   INTEGER(IntKi),           INTENT(  OUT) :: ErrStat             !< Error status of the operation
+   CHARACTER(*),             INTENT(  OUT) :: ErrMsg              !< Error message if ErrStat /= ErrID_None
+
+      ! local variables:
+   INTEGER(IntKi)                          :: old_avrSwap1        ! previous value of avrSwap(1) !hack for Bladed DLL checkpoint/restore
+   CHARACTER(1024)                         :: FileName            ! Name of the DLL input file
+
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+
+      ! the ServoDyn parameters are not set when ServoDyn is not used
+   IF (Turbine%p_FAST%CompServo /= Module_SrvD) RETURN
+
    IF (Turbine%SrvD%p%UseBladedInterface) THEN
       if (Turbine%SrvD%m%dll_data%avrSWAP( 1) > 0   ) then
             ! store value to be overwritten
@@ -7019,8 +7234,7 @@ SUBROUTINE FAST_CreateCheckpoint_T(t_initial, n_t_global, NumTurbines, Turbine,
          Turbine%SrvD%m%dll_data%avrSWAP(50) = REAL( LEN_TRIM(DLLFileName) ) +1 ! No. of characters in the "INFILE"  argument (-) (we add one for the C NULL CHARACTER)
          Turbine%SrvD%m%dll_data%avrSWAP( 1) = GH_DISCON_STATUS_CHECKPOINT
          Turbine%SrvD%m%dll_data%SimStatus = Turbine%SrvD%m%dll_data%avrSWAP( 1)
-         CALL CallBladedDLL(Turbine%SrvD%Input(1), Turbine%SrvD%p, Turbine%SrvD%m%dll_data, ErrStat2, ErrMsg2)
-            CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+         CALL CallBladedDLL(Turbine%SrvD%Input(1), Turbine%SrvD%p, Turbine%SrvD%m%dll_data, ErrStat, ErrMsg)
 
             ! put values back:
          Turbine%SrvD%m%dll_data%DLL_InFile = FileName
@@ -7030,15 +7244,7 @@ SUBROUTINE FAST_CreateCheckpoint_T(t_initial, n_t_global, NumTurbines, Turbine,
       end if
    END IF
 
-   call cleanup()
-
-contains
-   subroutine cleanup()
-      IF ( ALLOCATED(ReKiBuf)  ) DEALLOCATE(ReKiBuf)
-      IF ( ALLOCATED(DbKiBuf)  ) DEALLOCATE(DbKiBuf)
-      IF ( ALLOCATED(IntKiBuf) ) DEALLOCATE(IntKiBuf)
-   end subroutine cleanup
-END SUBROUTINE FAST_CreateCheckpoint_T
+END SUBROUTINE FAST_CreateCheckpointDLL_T
 !----------------------------------------------------------------------------------------------------------------------------------
 !> Routine that calls FAST_RestoreFromCheckpoint_T for an array of Turbine data structures.
 SUBROUTINE FAST_RestoreFromCheckpoint_Tary(t_initial, n_t_global, Turbine, CheckpointRoot, ErrStat, ErrMsg  )
@@ -7085,8 +7291,9 @@ SUBROUTINE FAST_RestoreFromCheckpoint_Tary(t_initial, n_t_global, Turbine, Check
 END SUBROUTINE FAST_RestoreFromCheckpoint_Tary
 !----------------------------------------------------------------------------------------------------------------------------------
 !> This routine is the inverse of FAST_CreateCheckpoint_T. It reads data from a checkpoint file and populates data structures for
-!! the turbine instance.
-SUBROUTINE FAST_RestoreFromCheckpoint_T(t_initial, n_t_global, NumTurbines, Turbine, CheckpointRoot, ErrStat, ErrMsg, Unit )
+!! the turbine instance. If OutFileRoot is present and not blank, the restored turbine writes its output files with that root name
+!! instead of the one stored in the checkpoint file, so that several simulations can be continued from the same checkpoint.
+SUBROUTINE FAST_RestoreFromCheckpoint_T(t_initial, n_t_global, NumTurbines, Turbine, CheckpointRoot, ErrStat, ErrMsg, Unit, OutFileRoot )
    USE BladedInterface, ONLY: CallBladedDLL  ! Hack for Bladed-style DLL
    USE BladedInterface, ONLY: GH_DISCON_STATUS_RESTARTING
 
@@ -7098,6 +7305,7 @@ SUBROUTINE FAST_RestoreFromCheckpoint_T(t_initial, n_t_global, NumTurbines, Turb
    INTEGER(IntKi),           INTENT(  OUT) :: ErrStat             !< Error status of the operation
    CHARACTER(*),             INTENT(  OUT) :: ErrMsg              !< Error message if ErrStat /= ErrID_None
    INTEGER(IntKi), OPTIONAL, INTENT(INOUT) :: Unit                !< unit number for output file
+   CHARACTER(*),   OPTIONAL, INTENT(IN   ) :: OutFileRoot         !< Rootname of the output files of the restored turbine
 
       ! local variables:
    REAL(ReKi),               ALLOCATABLE   :: ReKiBuf(:)
@@ -7114,6 +7322,7 @@ SUBROUTINE FAST_RestoreFromCheckpoint_T(t_initial, n_t_global, NumTurbines, Turb
 
    CHARACTER(1024)                         :: FileName            ! Name of the (input) checkpoint file
    CHARACTER(1024)                         :: DLLFileName         ! Name of the (input) checkpoint file
+   LOGICAL                                 :: NewOutFile          ! whether the output files get a new root name
 
 
    ErrStat=ErrID_None
@@ -7185,6 +7394,15 @@ SUBROUTINE FAST_RestoreFromCheckpoint_T(t_initial, n_t_global, NumTurbines, Turb
    END IF
 
 
+   NewOutFile = .FALSE.
+   IF (PRESENT(OutFileRoot)) THEN
+      IF (LEN_TRIM(OutFileRoot) > 0) THEN
+         NewOutFile = .TRUE.
+         Turbine%p_FAST%OutFileRoot = OutFileRoot
+      END IF
+   END IF
+
+
       ! close file if necessary (do this after unpacking turbine data, so that TurbID is set)
    IF (Turbine%TurbID == NumTurbines .OR. .NOT. PRESENT(Unit)) THEN
       CLOSE(unIn)
@@ -7209,8 +7427,15 @@ SUBROUTINE FAST_RestoreFromCheckpoint_T(t_initial, n_t_global, NumTurbines, Turb
    END IF
 
 
-      ! A hack to restore Bladed-style DLL data
-   if (Turbine%SrvD%p%UseBladedInterface) then
+      ! Map a memory-mapped full-field wind file again (the checkpoint file has the name of the file, not the mapping)
+   IF (Turbine%p_FAST%CompInflow == Module_IfW) THEN
+      CALL InflowWind_RestoreMapping( Turbine%IfW%p, ErrStat2, ErrMsg2 )
+         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   END IF
+
+
+      ! A hack to restore Bladed-style DLL data (the ServoDyn parameters are not set when ServoDyn is not used)
+   if (Turbine%p_FAST%CompServo == Module_SrvD .and. Turbine%SrvD%p%UseBladedInterface) then
       if (Turbine%SrvD%m%dll_data%avrSWAP( 1) > 0   ) then ! this isn't allocated if UseBladedInterface is FALSE
             ! store value to be overwritten
          old_avrSwap1 = Turbine%SrvD%m%dll_data%avrSWAP( 1)
@@ -7235,10 +7460,17 @@ SUBROUTINE FAST_RestoreFromCheckpoint_T(t_initial, n_t_global, NumTurbines, Turb
 
    ! deal with files that were open:
    IF (Turbine%p_FAST%WrTxtOutFile) THEN
-      CALL OpenFunkFileAppend ( Turbine%y_FAST%UnOu, TRIM(Turbine%p_FAST%OutFileRoot)//'.out', ErrStat2, ErrMsg2)
-      IF ( ErrStat2 >= AbortErrLev ) RETURN
-      CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-      CALL WrFileNR ( Turbine%y_FAST%UnOu, '#Restarting here')
+      IF (NewOutFile) THEN
+         CALL FAST_OpenTextOutput( Turbine%p_FAST, Turbine%y_FAST, ErrStat2, ErrMsg2 )
+         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+         IF ( ErrStat >= AbortErrLev ) RETURN
+         CALL WrFileNR ( Turbine%y_FAST%UnOu, '#Restarting here from '//TRIM(CheckpointRoot))
+      ELSE
+         CALL OpenFunkFileAppend ( Turbine%y_FAST%UnOu, TRIM(Turbine%p_FAST%OutFileRoot)//'.out', ErrStat2, ErrMsg2)
+         IF ( ErrStat2 >= AbortErrLev ) RETURN
+         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+         CALL WrFileNR ( Turbine%y_FAST%UnOu, '#Restarting here')
+      END IF
       WRITE(Turbine%y_FAST%UnOu, '()')
    END IF
    ! (ignoring for now; will have fort.x files if any were open [though I printed a warning about not outputting binary files earlier])
@@ -24,7 +24,68 @@ def test_hub_position(library_path, input_file):
     # This case is initially still
     # Velocities should be 0 and the DCM should be identity
     np.testing.assert_array_equal( rotational_velocity, np.zeros(3) )
-    np.testing.assert_array_equal( np.reshape( orientation_dcm[:], (3,3) ), np.eye(3) )
+    np.testing.assert_array_equal( np.reshape( orientation_dcm, (3,3), order='F' ), np.eye(3) )
+    openfastlib.fast_deinit()
+
+
+def test_step(library_path, input_file):
+    # Advancing by several time steps per call gives the same outputs as one time step per call
+    openfastlib = openfast_library.FastLibAPI(library_path, input_file)
+    openfastlib.fast_init()
+    openfastlib.fast_start()
+    n_steps = 0
+    while openfastlib.step() == 1:
+        n_steps += 1
+    assert n_steps == openfastlib.total_time_steps - 1
+    assert openfastlib.step() == 0
+    single_step_values = openfastlib.output_values.copy()
+    openfastlib.fast_deinit()
+
+    openfastlib = openfast_library.FastLibAPI(library_path, input_file)
+    openfastlib.fast_init()
+    openfastlib.fast_start()
+    n_steps = 0
+    while True:
+        n_steps_done = openfastlib.step(7)
+        if n_steps_done == 0:
+            break
+        assert n_steps_done == min(7, openfastlib.total_time_steps - 1 - n_steps)
+        n_steps += n_steps_done
+    assert n_steps == openfastlib.total_time_steps - 1
+    np.testing.assert_array_equal( openfastlib.output_values, single_step_values )
+    openfastlib.fast_deinit()
+
+
+def test_output_values(library_path, input_file):
+    # The outputs are written into an array given by the caller, without a copy
+    openfastlib = openfast_library.FastLibAPI(library_path, input_file)
+    openfastlib.fast_init()
+    output_shape = openfastlib.output_values.shape
+    openfastlib.fast_deinit()
+
+    openfastlib = openfast_library.FastLibAPI(library_path, input_file)
+    try:
+        openfastlib.fast_init(np.zeros( (output_shape[0] + 1, output_shape[1]) ))
+        assert False, "fast_init accepted output_values of the wrong shape"
+    except ValueError:
+        pass
+    openfastlib.fast_deinit()
+
+    output_values = np.full( output_shape, np.nan )
+    openfastlib = openfast_library.FastLibAPI(library_path, input_file)
+    openfastlib.fast_init(output_values)
+    assert openfastlib.output_values is output_values
+    openfastlib.fast_sim()
+    openfastlib.fast_deinit()
+
+    # The first column is the time of each output step
+    np.testing.assert_allclose(
+        output_values[:, 0],
+        np.arange(output_shape[0]) * openfastlib.dt_out.value,
+        rtol=0.0,
+        atol=1e-8
+    )
+    assert not np.isnan(output_values).any()
 
 
 if __name__=="__main__":
@@ -45,3 +106,5 @@ if __name__=="__main__":
         pass
 
     test_hub_position(library_path, input_file)
+    test_step(library_path, input_file)
+    test_output_values(library_path, input_file)
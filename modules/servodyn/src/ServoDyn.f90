@@ -93,6 +93,7 @@ MODULE ServoDyn
                                                  !   (Xd), and constraint-state (Z) equations all with respect to the constraint
                                                  !   states (z)
    PUBLIC :: SrvD_GetOP                          ! Routine to pack the operating point values (for linearization) into arrays
+   PUBLIC :: SrvD_IsReentrant                    ! Function that returns whether instances can be advanced concurrently
 
 
 CONTAINS
@@ -4467,6 +4468,20 @@ CONTAINS
 
 END SUBROUTINE SrvD_GetOP
 !++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This function returns whether the time steps of this instance only use the data of the instance, so that it can be advanced
+!! concurrently with other instances. The user-defined control routines (control mode 3, e.g. UserVSCont_KP and PitchCntrl_ACH)
+!! keep their states in SAVE variables, which are shared by all instances.
+LOGICAL FUNCTION SrvD_IsReentrant( p )
+!..................................................................................................................................
+
+   TYPE(SrvD_ParameterType),       INTENT(IN   )  :: p           !< Parameters
+
+   SrvD_IsReentrant = p%PCMode    /= ControlMode_USER .AND. p%VSContrl  /= ControlMode_USER .AND. p%GenModel /= ControlMode_USER .AND. &
+                      p%HSSBrMode /= ControlMode_USER .AND. p%YCMode    /= ControlMode_USER
+
+END FUNCTION SrvD_IsReentrant
+!----------------------------------------------------------------------------------------------------------------------------------
 
 !----------------------------------------------------------------------------------------------------------------------------------
 !> This routine validates the inputs from the primary input file.